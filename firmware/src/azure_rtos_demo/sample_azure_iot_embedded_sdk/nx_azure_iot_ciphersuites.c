@@ -34,6 +34,9 @@ extern NX_CRYPTO_METHOD crypto_method_rsa;
 extern NX_CRYPTO_METHOD crypto_method_ecdhe;
 extern NX_CRYPTO_METHOD crypto_method_ecdsa;
 extern NX_CRYPTO_METHOD crypto_method_ec_secp384;
+#ifdef NX_SECURE_ENABLE_AEAD_CIPHER
+extern NX_CRYPTO_METHOD crypto_method_chacha20_poly1305;
+#endif /* NX_SECURE_ENABLE_AEAD_CIPHER */
 #endif /* NX_SECURE_ENABLE_ECC_CIPHERSUITE */ 
 
 const NX_CRYPTO_METHOD *_nx_azure_iot_tls_supported_crypto[] =
@@ -49,6 +52,9 @@ const NX_CRYPTO_METHOD *_nx_azure_iot_tls_supported_crypto[] =
     &crypto_method_ecdhe,
     &crypto_method_ecdsa,
     &crypto_method_ec_secp384,    
+#ifdef NX_SECURE_ENABLE_AEAD_CIPHER
+    &crypto_method_chacha20_poly1305,
+#endif /* NX_SECURE_ENABLE_AEAD_CIPHER */
 #endif /* NX_SECURE_ENABLE_ECC_CIPHERSUITE */
 };
 
@@ -57,6 +63,9 @@ const UINT _nx_azure_iot_tls_supported_crypto_size = sizeof(_nx_azure_iot_tls_su
 
 /* Define supported TLS ciphersuites.  */
 #ifdef NX_SECURE_ENABLE_ECC_CIPHERSUITE
+#ifdef NX_SECURE_ENABLE_AEAD_CIPHER
+extern const NX_CRYPTO_CIPHERSUITE nx_crypto_tls_ecdhe_rsa_with_chacha20_poly1305_sha256;
+#endif /* NX_SECURE_ENABLE_AEAD_CIPHER */
 extern const NX_CRYPTO_CIPHERSUITE nx_crypto_tls_ecdhe_rsa_with_aes_128_cbc_sha256;
 #else
 extern const NX_CRYPTO_CIPHERSUITE nx_crypto_tls_rsa_with_aes_128_cbc_sha256;
@@ -74,6 +83,9 @@ const NX_CRYPTO_CIPHERSUITE *_nx_azure_iot_tls_ciphersuite_map[] =
 
     /* TLS ciphersuites. */
 #ifdef NX_SECURE_ENABLE_ECC_CIPHERSUITE
+#ifdef NX_SECURE_ENABLE_AEAD_CIPHER
+    &nx_crypto_tls_ecdhe_rsa_with_chacha20_poly1305_sha256,
+#endif /* NX_SECURE_ENABLE_AEAD_CIPHER */
     &nx_crypto_tls_ecdhe_rsa_with_aes_128_cbc_sha256,
 #else
     &nx_crypto_tls_rsa_with_aes_128_cbc_sha256,
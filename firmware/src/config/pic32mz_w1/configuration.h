@@ -198,6 +198,7 @@ extern "C" {
 
 /* MPLAB Harmony BA414E Driver Definitions*/
 #define DRV_BA414E_NUM_CLIENTS 5
+#define DRV_BA414E_QUEUE_SIZE 10
 
 
 /* Net Pres RTOS Configurations*/
@@ -115,6 +115,25 @@ typedef void ( *DRV_BA414E_CALLBACK )
     uintptr_t context
 );
 
+// *****************************************************************************
+/* BA414E Driver Client Priority
+
+   Summary
+    Scheduling priority of the operations submitted on a client handle.
+
+   Description
+    When several operations are queued, the driver starts the one with the
+    highest priority next.  Operations of equal priority are started in the
+    order in which they were submitted.  An operation that is already running
+    on the hardware is never preempted.
+*/
+
+typedef enum
+{
+    DRV_BA414E_PRIORITY_NORMAL = 0,
+    DRV_BA414E_PRIORITY_HIGH = 1,
+} DRV_BA414E_PRIORITY;
+
 // PIC32MZW1 hardware module operand size.
 // Domains with smaller operands must be rounded up to the specified bit sizes
 typedef enum
@@ -143,6 +162,155 @@ typedef struct
     int cofactor;                                   // Cofactor
 } DRV_BA414E_ECC_DOMAIN;
 
+// *****************************************************************************
+/* BA414E Driver Operations
+
+   Summary
+    Identifies the operation carried by a job request.
+*/
+
+typedef enum
+{
+    DRV_BA414E_OP_NONE = 0,
+    DRV_BA414E_OP_ECDSA_SIGN,
+    DRV_BA414E_OP_ECDSA_VERIFY,
+    DRV_BA414E_OP_PRIM_ECC_POINT_DOUBLE,
+    DRV_BA414E_OP_PRIM_ECC_POINT_ADDITION,
+    DRV_BA414E_OP_PRIM_ECC_POINT_MULTIPLICATION,
+    DRV_BA414E_OP_PRIM_ECC_CHECK_POINT_ON_CURVE,
+    DRV_BA414E_OP_PRIM_MOD_ADDITION,
+    DRV_BA414E_OP_PRIM_MOD_SUBTRACTION,
+    DRV_BA414E_OP_PRIM_MOD_MULTIPLICATION,
+    DRV_BA414E_OP_PRIM_MOD_EXP,            
+            
+}DRV_BA414E_OPERATIONS;
+
+// Operands are little endian and keySize (ECC) or opSize * 8 (modular
+// arithmetic) bytes long, except the message hash, which is big endian.
+
+typedef struct
+{
+    const DRV_BA414E_ECC_DOMAIN * domain;
+    uint8_t * R;
+    uint8_t * S;
+    const uint8_t * privateKey;
+    const uint8_t * k;
+    const uint8_t * msgHash;
+    int msgHashSz;    
+}DRV_BA414E_ecdsaSignOpParams;
+
+typedef struct
+{
+    const DRV_BA414E_ECC_DOMAIN * domain;
+    uint8_t * R;
+    uint8_t * S;
+    const uint8_t * publicKeyX;
+    const uint8_t * publicKeyY;
+    const uint8_t * msgHash;
+    int msgHashSz;    
+}DRV_BA414E_ecdsaVerifyOpParams;
+
+typedef struct
+{
+    const DRV_BA414E_ECC_DOMAIN * domain;
+    uint8_t * outX;
+    uint8_t * outY;
+    const uint8_t * p1X;
+    const uint8_t * p1Y;
+
+}DRV_BA414E_primEccPointDoubleOpParams;
+
+typedef struct
+{
+    const DRV_BA414E_ECC_DOMAIN * domain;
+    uint8_t * outX;
+    uint8_t * outY;
+    const uint8_t * p1X;
+    const uint8_t * p1Y;
+    const uint8_t * p2X;
+    const uint8_t * p2Y;
+
+}DRV_BA414E_primEccPointAdditionOpParams;
+
+typedef struct
+{
+    const DRV_BA414E_ECC_DOMAIN * domain;
+    uint8_t * outX;
+    uint8_t * outY;
+    const uint8_t * p1X;
+    const uint8_t * p1Y;
+    const uint8_t * k;
+
+}DRV_BA414E_primEccPointMultiplicationOpParams;
+
+typedef struct
+{
+    const DRV_BA414E_ECC_DOMAIN * domain;
+    const uint8_t * p1X;
+    const uint8_t * p1Y;
+
+}DRV_BA414E_primEccCheckPointOnCurveOpParams;
+
+typedef struct
+{
+    DRV_BA414E_OPERAND_SIZE opSize;    // Hardware operand size
+    uint8_t * c;
+    const uint8_t * p;
+    const uint8_t * a;
+    const uint8_t * b;
+}DRV_BA414E_primModOperationParams;
+
+typedef struct
+{
+    DRV_BA414E_OPERAND_SIZE opSize;    // Hardware operand size
+    uint8_t * C;
+    const uint8_t * n;
+    const uint8_t * M;
+    const uint8_t * e;
+}DRV_BA414E_primModExpOpParams;
+
+// *****************************************************************************
+/* BA414E Driver Job Request
+
+   Summary
+    Describes one operation submitted with DRV_BA414E_JobSubmit.
+
+   Description
+    The member of the union selected by operation holds the parameters.  The
+    request is copied when the job is submitted, but the buffers it points to
+    are used until the job completes.
+*/
+
+typedef struct
+{
+    DRV_BA414E_OPERATIONS operation;
+    union {
+        DRV_BA414E_ecdsaSignOpParams ecdsaSignParams;
+        DRV_BA414E_ecdsaVerifyOpParams ecdsaVerifyParams;
+        DRV_BA414E_primEccPointDoubleOpParams eccPointDoubleParams;
+        DRV_BA414E_primEccPointAdditionOpParams eccPointAdditionParams;
+        DRV_BA414E_primEccPointMultiplicationOpParams eccPointMultiplicationParams;
+        DRV_BA414E_primEccCheckPointOnCurveOpParams eccCheckPointOnCurveParams;
+        DRV_BA414E_primModOperationParams modOperationParams;
+        DRV_BA414E_primModExpOpParams modExpParams;        
+    };
+} DRV_BA414E_JOB_REQUEST;
+
+// *****************************************************************************
+/* BA414E Driver Job Handle
+
+   Summary
+    Identifies a job submitted with DRV_BA414E_JobSubmit.
+
+   Description
+    A job handle is valid from its submission until its result has been
+    returned by DRV_BA414E_JobComplete, or until its callback returns.
+*/
+
+typedef uintptr_t DRV_BA414E_JOB_HANDLE;
+
+#define DRV_BA414E_JOB_HANDLE_INVALID  ((DRV_BA414E_JOB_HANDLE)(-1))
+
 
 // *****************************************************************************
 // *****************************************************************************
@@ -443,7 +611,9 @@ DRV_HANDLE DRV_BA414E_Open( const SYS_MODULE_INDEX index,
     driver, invalidating the handle. After calling this routine, the handle 
     passed in "handle" must not be used with any of the remaining driver 
     routines. A new handle must be obtained by calling 
-    DRV_BA414E_Open before the caller may use the driver again.
+    DRV_BA414E_Open before the caller may use the driver again.  Jobs
+    submitted on the handle that have not started are dropped; a job that is
+    running completes and its callback is still called.
 
   Precondition:
     The DRV_BA414E_Initialize routine must have been called for 
@@ -469,6 +639,161 @@ DRV_HANDLE DRV_BA414E_Open( const SYS_MODULE_INDEX index,
 */
 void DRV_BA414E_Close( const DRV_HANDLE handle);
 
+// *****************************************************************************
+/* Function:
+    void DRV_BA414E_PrioritySet( const DRV_HANDLE handle,
+                                 DRV_BA414E_PRIORITY priority )
+
+  Summary:
+    Sets the scheduling priority of an opened-instance of the BA414E crypto
+    driver.
+    <p><b>Implementation:</b> Dynamic</p>
+
+  Description:
+    This routine sets the priority used to order the operations submitted on
+    this handle against those of other clients.  Operations on the critical
+    path of a handshake should be submitted on a handle with
+    DRV_BA414E_PRIORITY_HIGH so that they do not wait behind background
+    work.  A handle has DRV_BA414E_PRIORITY_NORMAL when it is opened.
+
+  Precondition:
+    DRV_BA414E_Open must have been called to obtain a valid opened
+    device handle.
+
+  Parameters:
+    handle       - A valid open-instance handle, returned from the driver's
+                   open routine
+
+    priority     - Priority of the operations submitted on this handle
+
+  Returns:
+    None.
+
+  Example:
+    <code>
+    DRV_HANDLE handle;  // Returned from DRV_BA414E_Open
+
+    DRV_BA414E_PrioritySet(handle, DRV_BA414E_PRIORITY_HIGH);
+
+    </code>
+
+  Remarks:
+    The priority of an operation is taken when it is submitted, so changing
+    it does not affect an operation that is already pending.
+*/
+void DRV_BA414E_PrioritySet( const DRV_HANDLE handle,
+        DRV_BA414E_PRIORITY priority);
+
+// *****************************************************************************
+/* Function:
+    DRV_BA414E_OP_RESULT DRV_BA414E_JobSubmit( const DRV_HANDLE handle,
+                                     const DRV_BA414E_JOB_REQUEST * request,
+                                     DRV_BA414E_PRIORITY priority,
+                                     DRV_BA414E_CALLBACK callback,
+                                     uintptr_t context,
+                                     DRV_BA414E_JOB_HANDLE * job )
+
+  Summary:
+    Queues an operation on the BA414E crypto driver.
+    <p><b>Implementation:</b> Dynamic</p>
+
+  Description:
+    This routine adds the operation described by request to the driver's job
+    queue and returns without waiting for it, whatever the ioIntent of the
+    handle.  A client may have several jobs in flight, and jobs from all
+    clients share one queue of DRV_BA414E_QUEUE_SIZE entries.  The queue is
+    ordered by priority, then by submission.
+
+    When the job completes, callback is called from the driver task with the
+    result and context, and the job is released when the callback returns.
+    Without a callback the job keeps its result until it is collected with
+    DRV_BA414E_JobComplete.
+
+  Precondition:
+    DRV_BA414E_Open must have been called to obtain a valid opened
+    device handle.
+
+  Parameters:
+    handle       - A valid open-instance handle, returned from the driver's
+                   open routine
+    request      - The operation and its parameters
+    priority     - Scheduling priority of this job
+    callback     - Called when the job completes, or NULL to collect the
+                   result with DRV_BA414E_JobComplete
+    context      - The context passed to the callback
+    job          - Returns the handle of the job.  May be NULL when a
+                   callback is given.
+
+  Returns:
+    DRV_BA414E_OP_PENDING - The job was queued
+    DRV_BA414E_OP_ERROR   - The handle or request is not valid
+    DRV_BA414E_OP_BUSY    - The job queue is full, the caller should wait
+                            and try again later
+
+  Example:
+    <code>
+    DRV_HANDLE handle;  // Returned from DRV_BA414E_Open
+    DRV_BA414E_JOB_REQUEST request;
+    DRV_BA414E_JOB_HANDLE job;
+
+    memset(&request, 0, sizeof(request));
+    request.operation = DRV_BA414E_OP_ECDSA_VERIFY;
+    request.ecdsaVerifyParams.domain = &eccDomain;
+    ...
+    if (DRV_BA414E_JobSubmit(handle, &request, DRV_BA414E_PRIORITY_HIGH,
+            NULL, 0, &job) == DRV_BA414E_OP_PENDING)
+    {
+        // Do other work, then collect the result.
+        while (DRV_BA414E_JobComplete(handle, job) == DRV_BA414E_OP_PENDING)
+        {
+        }
+    }
+    </code>
+*/
+DRV_BA414E_OP_RESULT DRV_BA414E_JobSubmit( const DRV_HANDLE handle,
+        const DRV_BA414E_JOB_REQUEST * request,
+        DRV_BA414E_PRIORITY priority,
+        DRV_BA414E_CALLBACK callback,
+        uintptr_t context,
+        DRV_BA414E_JOB_HANDLE * job);
+
+// *****************************************************************************
+/* Function:
+    DRV_BA414E_OP_RESULT DRV_BA414E_JobComplete( const DRV_HANDLE handle,
+                                                 DRV_BA414E_JOB_HANDLE job )
+
+  Summary:
+    Collects the result of a job submitted without a callback.
+    <p><b>Implementation:</b> Dynamic</p>
+
+  Description:
+    This routine returns DRV_BA414E_OP_PENDING while the job is queued or
+    running.  Once it has completed, the routine returns the result of the
+    operation and releases the job, so the job handle must not be used
+    again.  On a handle opened with DRV_IO_INTENT_BLOCKING the routine waits
+    for the job to complete.
+
+  Precondition:
+    The job must have been submitted on this handle with DRV_BA414E_JobSubmit
+    and without a callback.
+
+  Parameters:
+    handle       - A valid open-instance handle, returned from the driver's
+                   open routine
+    job          - The job handle returned by DRV_BA414E_JobSubmit
+
+  Returns:
+    DRV_BA414E_OP_PENDING - The job has not completed yet
+    DRV_BA414E_OP_ERROR   - The job handle is not valid, or the operation
+                            failed
+    Otherwise, the result of the operation.
+
+  Remarks:
+    Closing the handle releases its jobs that have not started.
+*/
+DRV_BA414E_OP_RESULT DRV_BA414E_JobComplete( const DRV_HANDLE handle,
+        DRV_BA414E_JOB_HANDLE job);
+
 // *****************************************************************************
 /* Function:
     DRV_BA414E_OP_RESULT DRV_BA414E_ECDSA_Sign(     const DRV_HANDLE handle,
@@ -519,8 +844,8 @@ void DRV_BA414E_Close( const DRV_HANDLE handle);
     DRV_BA414E_OP_PENDING - With non-blocking operations, this return signals 
                             that the operation is pending
     DRV_BA414E_OP_ERROR   - There was an error with the operation
-    DRV_BA414E_OP_BUSY    - There is currently an operation pending, the caller
-                            should wait and try again later
+    DRV_BA414E_OP_BUSY    - The job queue is full, the caller should wait
+                            and try again later
     DRV_BA414E_OP_SIGN_VERIFY_FAIL - Signature generated by the hardware is
                                      invalid
 
@@ -613,8 +938,8 @@ DRV_BA414E_OP_RESULT DRV_BA414E_ECDSA_Sign(
     DRV_BA414E_OP_PENDING - With non-blocking operations, this return signals 
                             that the operation is pending
     DRV_BA414E_OP_ERROR   - There was an error with the operation
-    DRV_BA414E_OP_BUSY    - There is currently an operation pending, the caller
-                            should wait and try again later
+    DRV_BA414E_OP_BUSY    - The job queue is full, the caller should wait
+                            and try again later
     DRV_BA414E_OP_SIGN_VERIFY_FAIL - The operation completed successfully, but
                                      the provided signature is not valid.
 
@@ -703,8 +1028,8 @@ DRV_BA414E_OP_RESULT DRV_BA414E_ECDSA_Verify(
     DRV_BA414E_OP_PENDING - With non-blocking operations, this return signals 
                             that the operation is pending
     DRV_BA414E_OP_ERROR   - There was an error with the operation
-    DRV_BA414E_OP_BUSY    - There is currently an operation pending, the caller
-                            should wait and try again later
+    DRV_BA414E_OP_BUSY    - The job queue is full, the caller should wait
+                            and try again later
     
   Example:
     <code>
@@ -789,8 +1114,8 @@ DRV_BA414E_OP_RESULT DRV_BA414E_PRIM_EccPointDouble(
     DRV_BA414E_OP_PENDING - With non-blocking operations, this return signals 
                             that the operation is pending
     DRV_BA414E_OP_ERROR   - There was an error with the operation
-    DRV_BA414E_OP_BUSY    - There is currently an operation pending, the caller
-                            should wait and try again later
+    DRV_BA414E_OP_BUSY    - The job queue is full, the caller should wait
+                            and try again later
     DRV_BA414E_OP_ERROR_POINT_AT_INFINITY - The operation resulted in a point 
                                             that is positioned at infinity
     
@@ -880,8 +1205,8 @@ DRV_BA414E_OP_RESULT DRV_BA414E_PRIM_EccPointAddition(
     DRV_BA414E_OP_PENDING - With non-blocking operations, this return signals 
                             that the operation is pending
     DRV_BA414E_OP_ERROR   - There was an error with the operation
-    DRV_BA414E_OP_BUSY    - There is currently an operation pending, the caller
-                            should wait and try again later
+    DRV_BA414E_OP_BUSY    - The job queue is full, the caller should wait
+                            and try again later
     
   Example:
     <code>
@@ -962,8 +1287,8 @@ DRV_BA414E_OP_RESULT DRV_BA414E_PRIM_EccPointMultiplication(
     DRV_BA414E_OP_PENDING - With non-blocking operations, this return signals 
                             that the operation is pending
     DRV_BA414E_OP_ERROR   - There was an error with the operation
-    DRV_BA414E_OP_BUSY    - There is currently an operation pending, the caller
-                            should wait and try again later
+    DRV_BA414E_OP_BUSY    - The job queue is full, the caller should wait
+                            and try again later
     DRV_BA414E_OP_POINT_NOT_ON_CURVE - the point is not on the curve.
     
   Example:
@@ -1044,8 +1369,8 @@ DRV_BA414E_OP_RESULT DRV_BA414E_PRIM_EccCheckPointOnCurve(
     DRV_BA414E_OP_PENDING - With non-blocking operations, this return signals 
                             that the operation is pending
     DRV_BA414E_OP_ERROR   - There was an error with the operation
-    DRV_BA414E_OP_BUSY    - There is currently an operation pending, the caller
-                            should wait and try again later
+    DRV_BA414E_OP_BUSY    - The job queue is full, the caller should wait
+                            and try again later
     
   Example:
     <code>
@@ -1119,8 +1444,8 @@ DRV_BA414E_OP_RESULT DRV_BA414E_PRIM_ModAddition(
     DRV_BA414E_OP_PENDING - With non-blocking operations, this return signals 
                             that the operation is pending
     DRV_BA414E_OP_ERROR   - There was an error with the operation
-    DRV_BA414E_OP_BUSY    - There is currently an operation pending, the caller
-                            should wait and try again later
+    DRV_BA414E_OP_BUSY    - The job queue is full, the caller should wait
+                            and try again later
     
   Example:
     <code>
@@ -1193,8 +1518,8 @@ DRV_BA414E_OP_RESULT DRV_BA414E_PRIM_ModSubtraction(
     DRV_BA414E_OP_PENDING - With non-blocking operations, this return signals 
                             that the operation is pending
     DRV_BA414E_OP_ERROR   - There was an error with the operation
-    DRV_BA414E_OP_BUSY    - There is currently an operation pending, the caller
-                            should wait and try again later
+    DRV_BA414E_OP_BUSY    - The job queue is full, the caller should wait
+                            and try again later
     
   Example:
     <code>
@@ -1268,8 +1593,8 @@ DRV_BA414E_OP_RESULT DRV_BA414E_PRIM_ModMultiplication(
     DRV_BA414E_OP_PENDING - With non-blocking operations, this return signals 
                             that the operation is pending
     DRV_BA414E_OP_ERROR   - There was an error with the operation
-    DRV_BA414E_OP_BUSY    - There is currently an operation pending, the caller
-                            should wait and try again later
+    DRV_BA414E_OP_BUSY    - The job queue is full, the caller should wait
+                            and try again later
     
   Example:
     <code>
@@ -0,0 +1,846 @@
+/*******************************************************************************
+  BA414E Crypto Driver Host Test
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    drv_ba414e_host_test.c
+
+  Summary:
+    Host test and benchmark of the BA414E job queue on the software backend.
+
+  Description:
+    This program runs the BA414E driver job queue (drv_ba414e_queue.c) with
+    the NetX Crypto software backend (drv_ba414e_sw.c) on a host.  It checks
+    every operation against known answers, the queue semantics (several jobs
+    in flight per client, priority order, callbacks against
+    DRV_BA414E_JobComplete, a full queue and closing a client with queued
+    jobs) and concurrent blocking clients, then reports the time of each
+    operation and the queue latency of normal and high priority clients.
+
+    The known answers were computed independently of NetX Crypto with affine
+    double-and-add.  Build and run with the Makefile in this directory:
+
+      make test         RTOS build, with a driver task thread and blocking
+                        clients, then the polled build, with the driver task
+                        called from the test loop
+      make benchmark    RTOS build, timings only
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*******************************************************************************
+Copyright (c) 2018 released Microchip Technology Inc.  All rights reserved.
+
+Microchip licenses to you the right to use, modify, copy and distribute Software
+only when embedded on a Microchip microcontroller or digital  signal  controller
+that is integrated into your product or third party  product  (pursuant  to  the
+sublicense terms in the accompanying license agreement).
+
+You should refer to the license agreement accompanying this Software for
+additional information regarding your rights and obligations.
+
+SOFTWARE AND DOCUMENTATION ARE PROVIDED AS IS  WITHOUT  WARRANTY  OF  ANY  KIND,
+EITHER EXPRESS  OR  IMPLIED,  INCLUDING  WITHOUT  LIMITATION,  ANY  WARRANTY  OF
+MERCHANTABILITY, TITLE, NON-INFRINGEMENT AND FITNESS FOR A  PARTICULAR  PURPOSE.
+IN NO EVENT SHALL MICROCHIP OR  ITS  LICENSORS  BE  LIABLE  OR  OBLIGATED  UNDER
+CONTRACT, NEGLIGENCE, STRICT LIABILITY, CONTRIBUTION,  BREACH  OF  WARRANTY,  OR
+OTHER LEGAL  EQUITABLE  THEORY  ANY  DIRECT  OR  INDIRECT  DAMAGES  OR  EXPENSES
+INCLUDING BUT NOT LIMITED TO ANY  INCIDENTAL,  SPECIAL,  INDIRECT,  PUNITIVE  OR
+CONSEQUENTIAL DAMAGES, LOST  PROFITS  OR  LOST  DATA,  COST  OF  PROCUREMENT  OF
+SUBSTITUTE  GOODS,  TECHNOLOGY,  SERVICES,  OR  ANY  CLAIMS  BY  THIRD   PARTIES
+(INCLUDING BUT NOT LIMITED TO ANY DEFENSE  THEREOF),  OR  OTHER  SIMILAR  COSTS.
+*******************************************************************************/
+//DOM-IGNORE-END
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "configuration.h"
+#include "driver/ba414e/drv_ba414e.h"
+
+#define HOST_CHECK(cond)                                                    \
+    do {                                                                    \
+        if (!(cond))                                                        \
+        {                                                                   \
+            printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #cond);          \
+            hostFailures++;                                                 \
+        }                                                                   \
+    } while (0)
+
+static SYS_MODULE_OBJ hostObj;
+static int hostFailures;
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Known Answers
+// *****************************************************************************
+// *****************************************************************************
+
+// SHA-256("sample"), the message hash of the known signatures.
+static const uint8_t sha256Sample[] =
+{
+    0xAF, 0x2B, 0xDB, 0xE1, 0xAA, 0x9B, 0x6E, 0xC1, 0xE2, 0xAD, 0xE1, 0xD6, 0x94, 0xF4, 0x1F, 0xC7,
+    0x1A, 0x83, 0x1D, 0x02, 0x68, 0xE9, 0x89, 0x15, 0x62, 0x11, 0x3D, 0x8A, 0x62, 0xAD, 0xD1, 0xBF
+};
+
+#include "drv_ba414e_host_vectors.h"
+
+typedef struct
+{
+    const char * name;
+    DRV_BA414E_ECC_DOMAIN domain;
+    const uint8_t * d;
+    const uint8_t * k;
+    const uint8_t * qx;
+    const uint8_t * qy;
+    const uint8_t * r;
+    const uint8_t * s;
+    const uint8_t * g2x;
+    const uint8_t * g2y;
+    const uint8_t * g3x;
+    const uint8_t * g3y;
+} HOST_CURVE;
+
+#define HOST_CURVE_ENTRY(c, size, opsz)                                     \
+    {                                                                       \
+        #c,                                                                 \
+        { size, opsz, c##_p, c##_n, c##_gx, c##_gy, c##_a, c##_b, 1 },      \
+        c##_d, c##_k, c##_qx, c##_qy, c##_r, c##_s,                         \
+        c##_g2x, c##_g2y, c##_g3x, c##_g3y                                  \
+    }
+
+static const HOST_CURVE hostCurves[] =
+{
+    HOST_CURVE_ENTRY(secp192r1, 24, DRV_BA414E_OPSZ_192),
+    HOST_CURVE_ENTRY(secp224r1, 28, DRV_BA414E_OPSZ_256),
+    HOST_CURVE_ENTRY(secp256r1, 32, DRV_BA414E_OPSZ_256),
+    HOST_CURVE_ENTRY(secp384r1, 48, DRV_BA414E_OPSZ_384),
+};
+
+#define HOST_P256 (&hostCurves[2])
+#define HOST_P384 (&hostCurves[3])
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Helpers
+// *****************************************************************************
+// *****************************************************************************
+
+// Runs a job and waits for its result.  In the polled build the driver task
+// is called here; otherwise the driver task thread runs it, and a blocking
+// handle waits in DRV_BA414E_JobComplete.
+static DRV_BA414E_OP_RESULT HostRun(DRV_HANDLE handle, const DRV_BA414E_JOB_REQUEST * request)
+{
+    DRV_BA414E_JOB_HANDLE job;
+    DRV_BA414E_OP_RESULT ret;
+
+    ret = DRV_BA414E_JobSubmit(handle, request, DRV_BA414E_PRIORITY_NORMAL, NULL, 0, &job);
+    while (ret == DRV_BA414E_OP_PENDING)
+    {
+#if !defined(DRV_BA414E_RTOS_STACK_SIZE)
+        DRV_BA414E_Tasks(hostObj);
+#endif
+        ret = DRV_BA414E_JobComplete(handle, job);
+    }
+    return ret;
+}
+
+static DRV_BA414E_JOB_REQUEST HostSign(const HOST_CURVE * c, uint8_t * r, uint8_t * s)
+{
+    DRV_BA414E_JOB_REQUEST req;
+    memset(&req, 0, sizeof(req));
+    req.operation = DRV_BA414E_OP_ECDSA_SIGN;
+    req.ecdsaSignParams.domain = &c->domain;
+    req.ecdsaSignParams.R = r;
+    req.ecdsaSignParams.S = s;
+    req.ecdsaSignParams.privateKey = c->d;
+    req.ecdsaSignParams.k = c->k;
+    req.ecdsaSignParams.msgHash = sha256Sample;
+    req.ecdsaSignParams.msgHashSz = sizeof(sha256Sample);
+    return req;
+}
+
+static DRV_BA414E_JOB_REQUEST HostVerify(const DRV_BA414E_ECC_DOMAIN * domain,
+        const uint8_t * qx, const uint8_t * qy, const uint8_t * r, const uint8_t * s,
+        const uint8_t * hash)
+{
+    DRV_BA414E_JOB_REQUEST req;
+    memset(&req, 0, sizeof(req));
+    req.operation = DRV_BA414E_OP_ECDSA_VERIFY;
+    req.ecdsaVerifyParams.domain = domain;
+    req.ecdsaVerifyParams.publicKeyX = qx;
+    req.ecdsaVerifyParams.publicKeyY = qy;
+    req.ecdsaVerifyParams.R = (uint8_t *)r;
+    req.ecdsaVerifyParams.S = (uint8_t *)s;
+    req.ecdsaVerifyParams.msgHash = hash;
+    req.ecdsaVerifyParams.msgHashSz = sizeof(sha256Sample);
+    return req;
+}
+
+static DRV_BA414E_JOB_REQUEST HostPointOp(DRV_BA414E_OPERATIONS op,
+        const DRV_BA414E_ECC_DOMAIN * domain, uint8_t * outX, uint8_t * outY,
+        const uint8_t * p1X, const uint8_t * p1Y, const uint8_t * p2X, const uint8_t * p2Y)
+{
+    DRV_BA414E_JOB_REQUEST req;
+    memset(&req, 0, sizeof(req));
+    req.operation = op;
+    switch (op)
+    {
+        case DRV_BA414E_OP_PRIM_ECC_POINT_DOUBLE:
+            req.eccPointDoubleParams.domain = domain;
+            req.eccPointDoubleParams.outX = outX;
+            req.eccPointDoubleParams.outY = outY;
+            req.eccPointDoubleParams.p1X = p1X;
+            req.eccPointDoubleParams.p1Y = p1Y;
+            break;
+        case DRV_BA414E_OP_PRIM_ECC_POINT_ADDITION:
+            req.eccPointAdditionParams.domain = domain;
+            req.eccPointAdditionParams.outX = outX;
+            req.eccPointAdditionParams.outY = outY;
+            req.eccPointAdditionParams.p1X = p1X;
+            req.eccPointAdditionParams.p1Y = p1Y;
+            req.eccPointAdditionParams.p2X = p2X;
+            req.eccPointAdditionParams.p2Y = p2Y;
+            break;
+        case DRV_BA414E_OP_PRIM_ECC_POINT_MULTIPLICATION:
+            // p2X is the factor.
+            req.eccPointMultiplicationParams.domain = domain;
+            req.eccPointMultiplicationParams.outX = outX;
+            req.eccPointMultiplicationParams.outY = outY;
+            req.eccPointMultiplicationParams.p1X = p1X;
+            req.eccPointMultiplicationParams.p1Y = p1Y;
+            req.eccPointMultiplicationParams.k = p2X;
+            break;
+        case DRV_BA414E_OP_PRIM_ECC_CHECK_POINT_ON_CURVE:
+        default:
+            req.eccCheckPointOnCurveParams.domain = domain;
+            req.eccCheckPointOnCurveParams.p1X = p1X;
+            req.eccCheckPointOnCurveParams.p1Y = p1Y;
+            break;
+    }
+    return req;
+}
+
+static DRV_BA414E_JOB_REQUEST HostModOp(DRV_BA414E_OPERATIONS op, DRV_BA414E_OPERAND_SIZE opSize,
+        uint8_t * c, const uint8_t * p, const uint8_t * a, const uint8_t * b)
+{
+    DRV_BA414E_JOB_REQUEST req;
+    memset(&req, 0, sizeof(req));
+    req.operation = op;
+    if (op == DRV_BA414E_OP_PRIM_MOD_EXP)
+    {
+        req.modExpParams.opSize = opSize;
+        req.modExpParams.C = c;
+        req.modExpParams.n = p;
+        req.modExpParams.M = a;
+        req.modExpParams.e = b;
+    }
+    else
+    {
+        req.modOperationParams.opSize = opSize;
+        req.modOperationParams.c = c;
+        req.modOperationParams.p = p;
+        req.modOperationParams.a = a;
+        req.modOperationParams.b = b;
+    }
+    return req;
+}
+
+// Writes a small value as a little-endian operand.
+static void HostSetValue(uint8_t * dst, uint32_t len, uint32_t value)
+{
+    memset(dst, 0, len);
+    dst[0] = (uint8_t)value;
+    dst[1] = (uint8_t)(value >> 8);
+    dst[2] = (uint8_t)(value >> 16);
+    dst[3] = (uint8_t)(value >> 24);
+}
+
+static uint32_t HostGetValue(const uint8_t * src)
+{
+    return src[0] | (src[1] << 8) | (src[2] << 16) | ((uint32_t)src[3] << 24);
+}
+
+// dst = p - y, little-endian.
+static void HostNegate(uint8_t * dst, const uint8_t * p, const uint8_t * y, uint32_t len)
+{
+    int borrow = 0;
+    uint32_t i;
+    for (i = 0; i < len; i++)
+    {
+        int v = p[i] - y[i] - borrow;
+        borrow = (v < 0);
+        dst[i] = (uint8_t)v;
+    }
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Operation Tests
+// *****************************************************************************
+// *****************************************************************************
+
+static void HostTestCurve(DRV_HANDLE handle, const HOST_CURVE * c)
+{
+    const DRV_BA414E_ECC_DOMAIN * domain = &c->domain;
+    uint32_t len = domain->keySize;
+    uint8_t x[DRV_BA414E_MAX_KEY_SIZE], y[DRV_BA414E_MAX_KEY_SIZE];
+    uint8_t r[DRV_BA414E_MAX_KEY_SIZE], s[DRV_BA414E_MAX_KEY_SIZE];
+    uint8_t t[DRV_BA414E_MAX_KEY_SIZE];
+    uint8_t hash[sizeof(sha256Sample)];
+    DRV_BA414E_JOB_REQUEST req;
+
+    // q = dG
+    req = HostPointOp(DRV_BA414E_OP_PRIM_ECC_POINT_MULTIPLICATION, domain, x, y, domain->generatorX, domain->generatorY, c->d, NULL);
+    HOST_CHECK(HostRun(handle, &req) == DRV_BA414E_OP_SUCCESS);
+    HOST_CHECK((memcmp(x, c->qx, len) == 0) && (memcmp(y, c->qy, len) == 0));
+
+    // The same factor on a point that is not the generator.
+    req = HostPointOp(DRV_BA414E_OP_PRIM_ECC_POINT_MULTIPLICATION, domain, x, y, c->g2x, c->g2y, c->d, NULL);
+    HOST_CHECK(HostRun(handle, &req) == DRV_BA414E_OP_SUCCESS);
+    req = HostPointOp(DRV_BA414E_OP_PRIM_ECC_POINT_DOUBLE, domain, r, s, c->qx, c->qy, NULL, NULL);
+    HOST_CHECK(HostRun(handle, &req) == DRV_BA414E_OP_SUCCESS);
+    HOST_CHECK((memcmp(x, r, len) == 0) && (memcmp(y, s, len) == 0));
+
+    // nG and 0G are the point at infinity.
+    req = HostPointOp(DRV_BA414E_OP_PRIM_ECC_POINT_MULTIPLICATION, domain, x, y, domain->generatorX, domain->generatorY, domain->order, NULL);
+    HOST_CHECK(HostRun(handle, &req) == DRV_BA414E_OP_POINT_AT_INFINITY);
+    memset(t, 0, sizeof(t));
+    req = HostPointOp(DRV_BA414E_OP_PRIM_ECC_POINT_MULTIPLICATION, domain, x, y, c->qx, c->qy, t, NULL);
+    HOST_CHECK(HostRun(handle, &req) == DRV_BA414E_OP_POINT_AT_INFINITY);
+
+    // 2G, G + 2G, G + (-G) and G + O
+    req = HostPointOp(DRV_BA414E_OP_PRIM_ECC_POINT_DOUBLE, domain, x, y, domain->generatorX, domain->generatorY, NULL, NULL);
+    HOST_CHECK(HostRun(handle, &req) == DRV_BA414E_OP_SUCCESS);
+    HOST_CHECK((memcmp(x, c->g2x, len) == 0) && (memcmp(y, c->g2y, len) == 0));
+    req = HostPointOp(DRV_BA414E_OP_PRIM_ECC_POINT_ADDITION, domain, x, y, domain->generatorX, domain->generatorY, c->g2x, c->g2y);
+    HOST_CHECK(HostRun(handle, &req) == DRV_BA414E_OP_SUCCESS);
+    HOST_CHECK((memcmp(x, c->g3x, len) == 0) && (memcmp(y, c->g3y, len) == 0));
+    HostNegate(t, domain->primeField, domain->generatorY, len);
+    req = HostPointOp(DRV_BA414E_OP_PRIM_ECC_POINT_ADDITION, domain, x, y, domain->generatorX, domain->generatorY, domain->generatorX, t);
+    HOST_CHECK(HostRun(handle, &req) == DRV_BA414E_OP_POINT_AT_INFINITY);
+    memset(t, 0, sizeof(t));
+    req = HostPointOp(DRV_BA414E_OP_PRIM_ECC_POINT_ADDITION, domain, x, y, domain->generatorX, domain->generatorY, t, t);
+    HOST_CHECK(HostRun(handle, &req) == DRV_BA414E_OP_SUCCESS);
+    HOST_CHECK((memcmp(x, domain->generatorX, len) == 0) && (memcmp(y, domain->generatorY, len) == 0));
+
+    // Points on and off the curve
+    req = HostPointOp(DRV_BA414E_OP_PRIM_ECC_CHECK_POINT_ON_CURVE, domain, NULL, NULL, c->qx, c->qy, NULL, NULL);
+    HOST_CHECK(HostRun(handle, &req) == DRV_BA414E_OP_SUCCESS);
+    memcpy(t, c->qy, len);
+    t[0] ^= 1;
+    req = HostPointOp(DRV_BA414E_OP_PRIM_ECC_CHECK_POINT_ON_CURVE, domain, NULL, NULL, c->qx, t, NULL, NULL);
+    HOST_CHECK(HostRun(handle, &req) == DRV_BA414E_OP_POINT_NOT_ON_CURVE);
+
+    // Signature and verification
+    req = HostSign(c, r, s);
+    HOST_CHECK(HostRun(handle, &req) == DRV_BA414E_OP_SUCCESS);
+    HOST_CHECK((memcmp(r, c->r, len) == 0) && (memcmp(s, c->s, len) == 0));
+    req = HostVerify(domain, c->qx, c->qy, r, s, sha256Sample);
+    HOST_CHECK(HostRun(handle, &req) == DRV_BA414E_OP_SUCCESS);
+    memcpy(hash, sha256Sample, sizeof(hash));
+    hash[0] ^= 0x80;
+    req = HostVerify(domain, c->qx, c->qy, r, s, hash);
+    HOST_CHECK(HostRun(handle, &req) == DRV_BA414E_OP_SIGN_VERIFY_FAIL);
+    req = HostVerify(domain, c->qx, c->qy, r, domain->order, sha256Sample);
+    HOST_CHECK(HostRun(handle, &req) == DRV_BA414E_OP_SIGN_VERIFY_FAIL);
+}
+
+// A domain that is not one of the named curves runs on the generic routines:
+// secp256r1 with 2G as the generator.  Its public key d(2G) must match 2q
+// from the named curve, and its signatures must verify.
+static void HostTestGenericDomain(DRV_HANDLE handle)
+{
+    const HOST_CURVE * c = HOST_P256;
+    DRV_BA414E_ECC_DOMAIN domain = c->domain;
+    uint32_t len = domain.keySize;
+    uint8_t qx[DRV_BA414E_MAX_KEY_SIZE], qy[DRV_BA414E_MAX_KEY_SIZE];
+    uint8_t x[DRV_BA414E_MAX_KEY_SIZE], y[DRV_BA414E_MAX_KEY_SIZE];
+    uint8_t r[DRV_BA414E_MAX_KEY_SIZE], s[DRV_BA414E_MAX_KEY_SIZE];
+    uint8_t zero[DRV_BA414E_MAX_KEY_SIZE];
+    DRV_BA414E_JOB_REQUEST req;
+
+    domain.generatorX = c->g2x;
+    domain.generatorY = c->g2y;
+    req = HostPointOp(DRV_BA414E_OP_PRIM_ECC_POINT_MULTIPLICATION, &domain, qx, qy, domain.generatorX, domain.generatorY, c->d, NULL);
+    HOST_CHECK(HostRun(handle, &req) == DRV_BA414E_OP_SUCCESS);
+    req = HostPointOp(DRV_BA414E_OP_PRIM_ECC_POINT_DOUBLE, &c->domain, x, y, c->qx, c->qy, NULL, NULL);
+    HOST_CHECK(HostRun(handle, &req) == DRV_BA414E_OP_SUCCESS);
+    HOST_CHECK((memcmp(x, qx, len) == 0) && (memcmp(y, qy, len) == 0));
+
+    memset(&req, 0, sizeof(req));
+    req = HostSign(c, r, s);
+    req.ecdsaSignParams.domain = &domain;
+    HOST_CHECK(HostRun(handle, &req) == DRV_BA414E_OP_SUCCESS);
+    req = HostVerify(&domain, qx, qy, r, s, sha256Sample);
+    HOST_CHECK(HostRun(handle, &req) == DRV_BA414E_OP_SUCCESS);
+    req = HostVerify(&c->domain, qx, qy, r, s, sha256Sample);
+    HOST_CHECK(HostRun(handle, &req) == DRV_BA414E_OP_SIGN_VERIFY_FAIL);
+
+    // Curves with a != -3 are not supported by the software backend.
+    memset(zero, 0, sizeof(zero));
+    domain.a = zero;
+    req = HostPointOp(DRV_BA414E_OP_PRIM_ECC_POINT_DOUBLE, &domain, x, y, c->qx, c->qy, NULL, NULL);
+    HOST_CHECK(HostRun(handle, &req) == DRV_BA414E_OP_ERROR);
+}
+
+static void HostTestModOps(DRV_HANDLE handle)
+{
+    uint8_t p[16], a[16], b[16], c[16];
+    uint8_t big[64], m[64], e[64], out[64];
+    DRV_BA414E_JOB_REQUEST req;
+    int i;
+
+    HostSetValue(p, sizeof(p), 497);
+    HostSetValue(a, sizeof(a), 400);
+    HostSetValue(b, sizeof(b), 200);
+    req = HostModOp(DRV_BA414E_OP_PRIM_MOD_ADDITION, DRV_BA414E_OPSZ_128, c, p, a, b);
+    HOST_CHECK((HostRun(handle, &req) == DRV_BA414E_OP_SUCCESS) && (HostGetValue(c) == 103));
+    req = HostModOp(DRV_BA414E_OP_PRIM_MOD_SUBTRACTION, DRV_BA414E_OPSZ_128, c, p, b, a);
+    HOST_CHECK((HostRun(handle, &req) == DRV_BA414E_OP_SUCCESS) && (HostGetValue(c) == 297));
+    req = HostModOp(DRV_BA414E_OP_PRIM_MOD_MULTIPLICATION, DRV_BA414E_OPSZ_128, c, p, a, b);
+    HOST_CHECK((HostRun(handle, &req) == DRV_BA414E_OP_SUCCESS) && (HostGetValue(c) == 480));
+
+    // 4^13 mod 497, 3^5 mod 100 (even modulus) and x^0
+    HostSetValue(a, sizeof(a), 4);
+    HostSetValue(b, sizeof(b), 13);
+    req = HostModOp(DRV_BA414E_OP_PRIM_MOD_EXP, DRV_BA414E_OPSZ_128, c, p, a, b);
+    HOST_CHECK((HostRun(handle, &req) == DRV_BA414E_OP_SUCCESS) && (HostGetValue(c) == 445));
+    HostSetValue(p, sizeof(p), 100);
+    HostSetValue(a, sizeof(a), 3);
+    HostSetValue(b, sizeof(b), 5);
+    req = HostModOp(DRV_BA414E_OP_PRIM_MOD_EXP, DRV_BA414E_OPSZ_128, c, p, a, b);
+    HOST_CHECK((HostRun(handle, &req) == DRV_BA414E_OP_SUCCESS) && (HostGetValue(c) == 43));
+    HostSetValue(b, sizeof(b), 0);
+    req = HostModOp(DRV_BA414E_OP_PRIM_MOD_EXP, DRV_BA414E_OPSZ_128, c, p, a, b);
+    HOST_CHECK((HostRun(handle, &req) == DRV_BA414E_OP_SUCCESS) && (HostGetValue(c) == 1));
+
+    // Fermat on the secp256r1 prime at the largest operand size:
+    // a^(p-1) = 1 mod p.
+    memset(big, 0, sizeof(big));
+    memcpy(big, HOST_P256->domain.primeField, 32);
+    memcpy(e, big, sizeof(e));
+    e[0] -= 1;
+    for (i = 0; i < 64; i++)
+    {
+        m[i] = (uint8_t)(i * 7 + 1);
+    }
+    memset(&m[32], 0, 32);
+    req = HostModOp(DRV_BA414E_OP_PRIM_MOD_EXP, DRV_BA414E_OPSZ_512, out, big, m, e);
+    HOST_CHECK((HostRun(handle, &req) == DRV_BA414E_OP_SUCCESS) && (HostGetValue(out) == 1) &&
+               (memcmp(&out[4], &big[60], 4) == 0));
+
+    // Operand sizes the engine does not take
+    req = HostModOp(DRV_BA414E_OP_PRIM_MOD_ADDITION, (DRV_BA414E_OPERAND_SIZE)9, out, big, m, e);
+    HOST_CHECK(HostRun(handle, &req) == DRV_BA414E_OP_ERROR);
+    HostSetValue(p, sizeof(p), 0);
+    req = HostModOp(DRV_BA414E_OP_PRIM_MOD_ADDITION, DRV_BA414E_OPSZ_128, c, p, a, b);
+    HOST_CHECK(HostRun(handle, &req) == DRV_BA414E_OP_ERROR);
+}
+
+#if !defined(DRV_BA414E_RTOS_STACK_SIZE)
+// *****************************************************************************
+// *****************************************************************************
+// Section: Queue Tests (polled build)
+// *****************************************************************************
+// *****************************************************************************
+
+// With the driver task called from here, jobs run exactly when the test
+// says, so the order of completion can be checked.
+
+static uintptr_t hostOrder[2 * DRV_BA414E_QUEUE_SIZE];
+static int hostOrderCount;
+static DRV_BA414E_OP_RESULT hostOrderResult[2 * DRV_BA414E_QUEUE_SIZE];
+
+static void HostRecord(DRV_BA414E_OP_RESULT result, uintptr_t context)
+{
+    hostOrderResult[hostOrderCount] = result;
+    hostOrder[hostOrderCount++] = context;
+}
+
+static void HostRunTasks(int jobs)
+{
+    int i;
+    // Four steps per job: pick, start, wait and finish.
+    for (i = 0; i < (4 * jobs) + 4; i++)
+    {
+        DRV_BA414E_Tasks(hostObj);
+    }
+}
+
+static void HostTestQueue(void)
+{
+    static const uintptr_t expected[] = { 10, 11, 1, 2, 3 };
+    DRV_HANDLE a = DRV_BA414E_Open(0, DRV_IO_INTENT_READWRITE | DRV_IO_INTENT_NONBLOCKING);
+    DRV_HANDLE b = DRV_BA414E_Open(0, DRV_IO_INTENT_READWRITE | DRV_IO_INTENT_NONBLOCKING);
+    uint8_t p[16], y[16];
+    uint8_t x[2 * DRV_BA414E_QUEUE_SIZE][16];
+    uint8_t c[2 * DRV_BA414E_QUEUE_SIZE][16];
+    DRV_BA414E_JOB_REQUEST req;
+    DRV_BA414E_JOB_HANDLE job, other;
+    int i;
+
+    HOST_CHECK((a != DRV_HANDLE_INVALID) && (b != DRV_HANDLE_INVALID));
+    HostSetValue(p, sizeof(p), 1000003);
+    HostSetValue(y, sizeof(y), 1);
+
+    // Several jobs of one client in flight, and a high priority client that
+    // overtakes them.  Jobs of equal priority keep their order.
+    hostOrderCount = 0;
+    for (i = 1; i <= 3; i++)
+    {
+        HostSetValue(x[i], sizeof(x[i]), i);
+        req = HostModOp(DRV_BA414E_OP_PRIM_MOD_ADDITION, DRV_BA414E_OPSZ_128, c[i], p, x[i], y);
+        HOST_CHECK(DRV_BA414E_JobSubmit(a, &req, DRV_BA414E_PRIORITY_NORMAL, HostRecord, i, NULL) == DRV_BA414E_OP_PENDING);
+    }
+    DRV_BA414E_PrioritySet(b, DRV_BA414E_PRIORITY_HIGH);
+    HostSetValue(x[10], sizeof(x[10]), 10);
+    HOST_CHECK(DRV_BA414E_PRIM_ModAddition(b, DRV_BA414E_OPSZ_128, c[10], p, x[10], y, HostRecord, 10) == DRV_BA414E_OP_PENDING);
+    req = HostModOp(DRV_BA414E_OP_PRIM_MOD_ADDITION, DRV_BA414E_OPSZ_128, c[11], p, x[10], y);
+    HOST_CHECK(DRV_BA414E_JobSubmit(a, &req, DRV_BA414E_PRIORITY_HIGH, HostRecord, 11, NULL) == DRV_BA414E_OP_PENDING);
+    HostRunTasks(5);
+    HOST_CHECK(hostOrderCount == 5);
+    HOST_CHECK(memcmp(hostOrder, expected, sizeof(expected)) == 0);
+    for (i = 0; i < hostOrderCount; i++)
+    {
+        HOST_CHECK(hostOrderResult[i] == DRV_BA414E_OP_SUCCESS);
+        HOST_CHECK(HostGetValue(c[hostOrder[i]]) == ((hostOrder[i] >= 10) ? 11 : hostOrder[i] + 1));
+    }
+
+    // A job without a callback is collected once with DRV_BA414E_JobComplete,
+    // and only by its own client.
+    req = HostModOp(DRV_BA414E_OP_PRIM_MOD_MULTIPLICATION, DRV_BA414E_OPSZ_128, c[0], p, p, y);
+    HOST_CHECK(DRV_BA414E_JobSubmit(a, &req, DRV_BA414E_PRIORITY_NORMAL, NULL, 0, &job) == DRV_BA414E_OP_PENDING);
+    HOST_CHECK(DRV_BA414E_JobComplete(a, job) == DRV_BA414E_OP_PENDING);
+    HOST_CHECK(DRV_BA414E_JobComplete(b, job) == DRV_BA414E_OP_ERROR);
+    HOST_CHECK(DRV_BA414E_JobComplete(a, job + 1) == DRV_BA414E_OP_ERROR);
+    HostRunTasks(1);
+    HOST_CHECK(DRV_BA414E_JobComplete(a, job) == DRV_BA414E_OP_SUCCESS);
+    HOST_CHECK(HostGetValue(c[0]) == 0);
+    HOST_CHECK(DRV_BA414E_JobComplete(a, job) == DRV_BA414E_OP_ERROR);
+
+    // Requests that are not valid
+    req.operation = DRV_BA414E_OP_NONE;
+    HOST_CHECK(DRV_BA414E_JobSubmit(a, &req, DRV_BA414E_PRIORITY_NORMAL, HostRecord, 0, NULL) == DRV_BA414E_OP_ERROR);
+    req.operation = DRV_BA414E_OP_PRIM_MOD_ADDITION;
+    HOST_CHECK(DRV_BA414E_JobSubmit(a, &req, DRV_BA414E_PRIORITY_NORMAL, NULL, 0, NULL) == DRV_BA414E_OP_ERROR);
+    HOST_CHECK(DRV_BA414E_JobSubmit(DRV_HANDLE_INVALID, &req, DRV_BA414E_PRIORITY_NORMAL, HostRecord, 0, NULL) == DRV_BA414E_OP_ERROR);
+    HOST_CHECK(DRV_BA414E_JobSubmit(a + 1, &req, DRV_BA414E_PRIORITY_NORMAL, HostRecord, 0, NULL) == DRV_BA414E_OP_ERROR);
+
+    // A full queue
+    hostOrderCount = 0;
+    for (i = 0; i < DRV_BA414E_QUEUE_SIZE; i++)
+    {
+        req = HostModOp(DRV_BA414E_OP_PRIM_MOD_ADDITION, DRV_BA414E_OPSZ_128, c[i], p, x[0], y);
+        HOST_CHECK(DRV_BA414E_JobSubmit(a, &req, DRV_BA414E_PRIORITY_NORMAL, HostRecord, i, NULL) == DRV_BA414E_OP_PENDING);
+    }
+    HOST_CHECK(DRV_BA414E_JobSubmit(b, &req, DRV_BA414E_PRIORITY_HIGH, HostRecord, 99, NULL) == DRV_BA414E_OP_BUSY);
+    HostRunTasks(DRV_BA414E_QUEUE_SIZE);
+    HOST_CHECK(hostOrderCount == DRV_BA414E_QUEUE_SIZE);
+
+    // Closing a client drops its queued jobs.  A job that is running
+    // completes, and its slot is released.
+    hostOrderCount = 0;
+    req = HostModOp(DRV_BA414E_OP_PRIM_MOD_ADDITION, DRV_BA414E_OPSZ_128, c[0], p, x[0], y);
+    HOST_CHECK(DRV_BA414E_JobSubmit(a, &req, DRV_BA414E_PRIORITY_NORMAL, NULL, 0, &job) == DRV_BA414E_OP_PENDING);
+    for (i = 1; i <= 3; i++)
+    {
+        HOST_CHECK(DRV_BA414E_JobSubmit(a, &req, DRV_BA414E_PRIORITY_NORMAL, HostRecord, i, NULL) == DRV_BA414E_OP_PENDING);
+    }
+    HOST_CHECK(DRV_BA414E_JobSubmit(b, &req, DRV_BA414E_PRIORITY_NORMAL, NULL, 0, &other) == DRV_BA414E_OP_PENDING);
+    DRV_BA414E_Tasks(hostObj);
+    DRV_BA414E_Tasks(hostObj);
+    DRV_BA414E_Close(a);
+    HostRunTasks(2);
+    HOST_CHECK(hostOrderCount == 0);
+    HOST_CHECK(DRV_BA414E_JobComplete(b, other) == DRV_BA414E_OP_SUCCESS);
+    for (i = 0; i < DRV_BA414E_QUEUE_SIZE; i++)
+    {
+        HOST_CHECK(DRV_BA414E_JobSubmit(b, &req, DRV_BA414E_PRIORITY_NORMAL, HostRecord, i, NULL) == DRV_BA414E_OP_PENDING);
+    }
+    HostRunTasks(DRV_BA414E_QUEUE_SIZE);
+    HOST_CHECK(hostOrderCount == DRV_BA414E_QUEUE_SIZE);
+
+    DRV_BA414E_Close(b);
+}
+
+#else
+// *****************************************************************************
+// *****************************************************************************
+// Section: Concurrency Tests and Benchmark (RTOS build)
+// *****************************************************************************
+// *****************************************************************************
+
+static pthread_mutex_t hostLock = PTHREAD_MUTEX_INITIALIZER;
+static volatile int hostStop;
+
+static double HostNow(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+static void * HostTaskThread(void * arg)
+{
+    (void)arg;
+    for (;;)
+    {
+        DRV_BA414E_Tasks(hostObj);
+    }
+    return NULL;
+}
+
+// A blocking client signing and verifying in a loop, on the wrapper routines.
+static void * HostSignerThread(void * arg)
+{
+    const HOST_CURVE * c = (const HOST_CURVE *)arg;
+    DRV_HANDLE handle = DRV_BA414E_Open(0, DRV_IO_INTENT_READWRITE | DRV_IO_INTENT_BLOCKING);
+    uint8_t r[DRV_BA414E_MAX_KEY_SIZE], s[DRV_BA414E_MAX_KEY_SIZE];
+    int errors = 0;
+    int i;
+
+    if (handle == DRV_HANDLE_INVALID)
+    {
+        errors++;
+    }
+    for (i = 0; (i < 20) && (errors == 0); i++)
+    {
+        if ((DRV_BA414E_ECDSA_Sign(handle, &c->domain, r, s, c->d, c->k, sha256Sample, sizeof(sha256Sample), NULL, 0) != DRV_BA414E_OP_SUCCESS) ||
+            (memcmp(r, c->r, c->domain.keySize) != 0) || (memcmp(s, c->s, c->domain.keySize) != 0) ||
+            (DRV_BA414E_ECDSA_Verify(handle, &c->domain, c->qx, c->qy, r, s, sha256Sample, sizeof(sha256Sample), NULL, 0) != DRV_BA414E_OP_SUCCESS))
+        {
+            errors++;
+        }
+    }
+    DRV_BA414E_Close(handle);
+    pthread_mutex_lock(&hostLock);
+    hostFailures += errors;
+    pthread_mutex_unlock(&hostLock);
+    return NULL;
+}
+
+static volatile int hostCallbacks;
+
+static void HostCount(DRV_BA414E_OP_RESULT result, uintptr_t context)
+{
+    (void)context;
+    pthread_mutex_lock(&hostLock);
+    hostCallbacks += (result == DRV_BA414E_OP_SUCCESS) ? 1 : 1000;
+    pthread_mutex_unlock(&hostLock);
+}
+
+static void HostTestConcurrent(void)
+{
+    pthread_t threads[DRV_BA414E_NUM_CLIENTS - 1];
+    DRV_HANDLE handle;
+    uint8_t r[3][DRV_BA414E_MAX_KEY_SIZE], s[3][DRV_BA414E_MAX_KEY_SIZE];
+    int i, n;
+
+    for (i = 0; i < DRV_BA414E_NUM_CLIENTS - 1; i++)
+    {
+        pthread_create(&threads[i], NULL, HostSignerThread, (void *)&hostCurves[i % 4]);
+    }
+
+    // A non-blocking client with several jobs in flight at once
+    handle = DRV_BA414E_Open(0, DRV_IO_INTENT_READWRITE | DRV_IO_INTENT_NONBLOCKING);
+    HOST_CHECK(handle != DRV_HANDLE_INVALID);
+    hostCallbacks = 0;
+    for (n = 0; n < 10; n++)
+    {
+        for (i = 0; i < 3; i++)
+        {
+            DRV_BA414E_JOB_REQUEST req = HostSign(HOST_P256, r[i], s[i]);
+            while (DRV_BA414E_JobSubmit(handle, &req, DRV_BA414E_PRIORITY_NORMAL, HostCount, i, NULL) == DRV_BA414E_OP_BUSY)
+            {
+                sched_yield();
+            }
+        }
+        while (hostCallbacks < 3 * (n + 1))
+        {
+            sched_yield();
+        }
+        for (i = 0; i < 3; i++)
+        {
+            HOST_CHECK((memcmp(r[i], HOST_P256->r, 32) == 0) && (memcmp(s[i], HOST_P256->s, 32) == 0));
+        }
+    }
+    HOST_CHECK(hostCallbacks == 30);
+    DRV_BA414E_Close(handle);
+
+    for (i = 0; i < DRV_BA414E_NUM_CLIENTS - 1; i++)
+    {
+        pthread_join(threads[i], NULL);
+    }
+}
+
+static double HostTime(DRV_HANDLE handle, const DRV_BA414E_JOB_REQUEST * req, int count)
+{
+    double start = HostNow();
+    int i;
+    for (i = 0; i < count; i++)
+    {
+        HostRun(handle, req);
+    }
+    return (HostNow() - start) / count;
+}
+
+static void HostBenchmarkOps(void)
+{
+    DRV_HANDLE handle = DRV_BA414E_Open(0, DRV_IO_INTENT_READWRITE | DRV_IO_INTENT_BLOCKING);
+    uint8_t x[DRV_BA414E_MAX_KEY_SIZE], y[DRV_BA414E_MAX_KEY_SIZE];
+    uint8_t n[64], m[64], e[64];
+    DRV_BA414E_JOB_REQUEST req;
+    unsigned i;
+
+    printf("\n%-34s %12s\n", "operation (through the queue)", "usec/op");
+    for (i = 0; i < sizeof(hostCurves) / sizeof(hostCurves[0]); i++)
+    {
+        const HOST_CURVE * c = &hostCurves[i];
+        char name[64];
+
+        req = HostSign(c, x, y);
+        snprintf(name, sizeof(name), "%s ECDSA sign", c->name);
+        printf("%-34s %12.1f\n", name, HostTime(handle, &req, 50) * 1e6);
+        req = HostVerify(&c->domain, c->qx, c->qy, c->r, c->s, sha256Sample);
+        snprintf(name, sizeof(name), "%s ECDSA verify", c->name);
+        printf("%-34s %12.1f\n", name, HostTime(handle, &req, 50) * 1e6);
+        req = HostPointOp(DRV_BA414E_OP_PRIM_ECC_POINT_MULTIPLICATION, &c->domain, x, y, c->qx, c->qy, c->k, NULL);
+        snprintf(name, sizeof(name), "%s point multiplication", c->name);
+        printf("%-34s %12.1f\n", name, HostTime(handle, &req, 50) * 1e6);
+        req = HostPointOp(DRV_BA414E_OP_PRIM_ECC_POINT_ADDITION, &c->domain, x, y, c->qx, c->qy, c->g2x, c->g2y);
+        snprintf(name, sizeof(name), "%s point addition", c->name);
+        printf("%-34s %12.1f\n", name, HostTime(handle, &req, 200) * 1e6);
+    }
+    for (i = 0; i < sizeof(n); i++)
+    {
+        n[i] = (uint8_t)(0xA5 ^ (i * 13));
+        m[i] = (uint8_t)(i * 31 + 7);
+        e[i] = (uint8_t)(0x5A ^ (i * 11));
+    }
+    n[0] |= 1;
+    n[63] |= 0x80;
+    req = HostModOp(DRV_BA414E_OP_PRIM_MOD_EXP, DRV_BA414E_OPSZ_512, x, n, m, e);
+    printf("%-34s %12.1f\n", "512-bit modular exponentiation", HostTime(handle, &req, 50) * 1e6);
+    req = HostModOp(DRV_BA414E_OP_PRIM_MOD_MULTIPLICATION, DRV_BA414E_OPSZ_512, x, n, m, e);
+    printf("%-34s %12.1f\n", "512-bit modular multiplication", HostTime(handle, &req, 1000) * 1e6);
+    req = HostModOp(DRV_BA414E_OP_PRIM_MOD_ADDITION, DRV_BA414E_OPSZ_128, x, n, m, e);
+    printf("%-34s %12.1f\n", "128-bit modular addition", HostTime(handle, &req, 1000) * 1e6);
+    DRV_BA414E_Close(handle);
+}
+
+// A background client keeping the queue busy with secp384r1 signatures.
+static void * HostLoadThread(void * arg)
+{
+    DRV_HANDLE handle = DRV_BA414E_Open(0, DRV_IO_INTENT_READWRITE | DRV_IO_INTENT_BLOCKING);
+    uint8_t r[DRV_BA414E_MAX_KEY_SIZE], s[DRV_BA414E_MAX_KEY_SIZE];
+    DRV_BA414E_JOB_REQUEST req = HostSign(HOST_P384, r, s);
+
+    (void)arg;
+    while (!hostStop)
+    {
+        HostRun(handle, &req);
+    }
+    DRV_BA414E_Close(handle);
+    return NULL;
+}
+
+// Time from submitting a secp256r1 verification to its completion, while
+// three other clients keep the engine busy.  The priority is the client's,
+// set with DRV_BA414E_PrioritySet.
+static void HostBenchmarkLatency(void)
+{
+    static const char * names[] = { "normal", "high" };
+    pthread_t threads[3];
+    DRV_HANDLE handle = DRV_BA414E_Open(0, DRV_IO_INTENT_READWRITE | DRV_IO_INTENT_BLOCKING);
+    DRV_BA414E_JOB_REQUEST req = HostVerify(&HOST_P256->domain, HOST_P256->qx, HOST_P256->qy,
+                                            HOST_P256->r, HOST_P256->s, sha256Sample);
+    double idle;
+    int i, p;
+
+    idle = HostTime(handle, &req, 50);
+    hostStop = 0;
+    for (i = 0; i < 3; i++)
+    {
+        pthread_create(&threads[i], NULL, HostLoadThread, NULL);
+    }
+    printf("\n%-34s %12s %12s\n", "secp256r1 verify latency", "usec", "x idle");
+    printf("%-34s %12.1f %12.2f\n", "idle queue", idle * 1e6, 1.0);
+    for (p = DRV_BA414E_PRIORITY_NORMAL; p <= DRV_BA414E_PRIORITY_HIGH; p++)
+    {
+        char name[64];
+        double t = HostNow();
+        DRV_BA414E_PrioritySet(handle, (DRV_BA414E_PRIORITY)p);
+        for (i = 0; i < 50; i++)
+        {
+            DRV_BA414E_ECDSA_Verify(handle, &HOST_P256->domain, HOST_P256->qx, HOST_P256->qy,
+                    (uint8_t *)HOST_P256->r, (uint8_t *)HOST_P256->s, sha256Sample, sizeof(sha256Sample), NULL, 0);
+        }
+        t = (HostNow() - t) / 50;
+        snprintf(name, sizeof(name), "3 busy clients, %s priority", names[p]);
+        printf("%-34s %12.1f %12.2f\n", name, t * 1e6, t / idle);
+    }
+    hostStop = 1;
+    for (i = 0; i < 3; i++)
+    {
+        pthread_join(threads[i], NULL);
+    }
+    DRV_BA414E_Close(handle);
+}
+#endif
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Main
+// *****************************************************************************
+// *****************************************************************************
+
+int main(int argc, char ** argv)
+{
+    bool benchmarkOnly = (argc > 1) && (strcmp(argv[1], "-b") == 0);
+    DRV_HANDLE handle;
+    unsigned i;
+
+    hostObj = DRV_BA414E_Initialize(0, NULL);
+#if defined(DRV_BA414E_RTOS_STACK_SIZE)
+    pthread_t task;
+    pthread_create(&task, NULL, HostTaskThread, NULL);
+    handle = DRV_BA414E_Open(0, DRV_IO_INTENT_READWRITE | DRV_IO_INTENT_BLOCKING);
+#else
+    (void)benchmarkOnly;
+    handle = DRV_BA414E_Open(0, DRV_IO_INTENT_READWRITE | DRV_IO_INTENT_NONBLOCKING);
+#endif
+    HOST_CHECK(handle != DRV_HANDLE_INVALID);
+
+    if (!benchmarkOnly)
+    {
+        for (i = 0; i < sizeof(hostCurves) / sizeof(hostCurves[0]); i++)
+        {
+            HostTestCurve(handle, &hostCurves[i]);
+        }
+        HostTestGenericDomain(handle);
+        HostTestModOps(handle);
+    }
+    DRV_BA414E_Close(handle);
+
+#if defined(DRV_BA414E_RTOS_STACK_SIZE)
+    if (!benchmarkOnly)
+    {
+        HostTestConcurrent();
+    }
+    HostBenchmarkOps();
+    HostBenchmarkLatency();
+#else
+    HostTestQueue();
+#endif
+
+    if (!benchmarkOnly)
+    {
+        printf("\n%s: %d failure(s)\n", (hostFailures == 0) ? "PASS" : "FAIL", hostFailures);
+    }
+    return (hostFailures == 0) ? 0 : 1;
+}
@@ -0,0 +1,366 @@
+/*******************************************************************************
+  BA414E Crypto Driver Host Test Vectors
+
+  File Name:
+    drv_ba414e_host_vectors.h
+
+  Summary:
+    Known answers for drv_ba414e_host_test.c.
+
+  Description:
+    Domain parameters and known answers of the SEC 2 curves the software
+    backend runs on its named-curve routines, little-endian as the BA414E
+    takes them.  d and k are a private key and a nonce, (qx, qy) = dG, (r, s)
+    is the ECDSA signature of SHA-256("sample") with d and k, and g2 and g3
+    are 2G and 3G.  They were computed with affine double-and-add, without
+    NetX Crypto.
+*******************************************************************************/
+
+#ifndef DRV_BA414E_HOST_VECTORS_H
+#define DRV_BA414E_HOST_VECTORS_H
+
+// secp192r1
+static const uint8_t secp192r1_p[] =
+{
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF
+};
+static const uint8_t secp192r1_n[] =
+{
+    0x31, 0x28, 0xD2, 0xB4, 0xB1, 0xC9, 0x6B, 0x14, 0x36, 0xF8, 0xDE, 0x99, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF
+};
+static const uint8_t secp192r1_gx[] =
+{
+    0x12, 0x10, 0xFF, 0x82, 0xFD, 0x0A, 0xFF, 0xF4, 0x00, 0x88, 0xA1, 0x43, 0xEB, 0x20, 0xBF, 0x7C,
+    0xF6, 0x90, 0x30, 0xB0, 0x0E, 0xA8, 0x8D, 0x18
+};
+static const uint8_t secp192r1_gy[] =
+{
+    0x11, 0x48, 0x79, 0x1E, 0xA1, 0x77, 0xF9, 0x73, 0xD5, 0xCD, 0x24, 0x6B, 0xED, 0x11, 0x10, 0x63,
+    0x78, 0xDA, 0xC8, 0xFF, 0x95, 0x2B, 0x19, 0x07
+};
+static const uint8_t secp192r1_a[] =
+{
+    0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF
+};
+static const uint8_t secp192r1_b[] =
+{
+    0xB1, 0xB9, 0x46, 0xC1, 0xEC, 0xDE, 0xB8, 0xFE, 0x49, 0x30, 0x24, 0x72, 0xAB, 0xE9, 0xA7, 0x0F,
+    0xE7, 0x80, 0x9C, 0xE5, 0x19, 0x05, 0x21, 0x64
+};
+static const uint8_t secp192r1_d[] =
+{
+    0x75, 0xAC, 0x48, 0x11, 0x80, 0x35, 0x28, 0x6D, 0x4E, 0xCA, 0x1D, 0x57, 0x9F, 0xA3, 0x67, 0xF4,
+    0x42, 0x8D, 0x64, 0x6D, 0xF9, 0xB4, 0x3B, 0xFF
+};
+static const uint8_t secp192r1_k[] =
+{
+    0xBD, 0x99, 0xA9, 0xDD, 0x75, 0x14, 0x35, 0xDD, 0x4F, 0x82, 0x3F, 0xA4, 0xB6, 0xFC, 0x7B, 0x5D,
+    0x1E, 0xC0, 0x36, 0x46, 0x66, 0x14, 0x38, 0x74
+};
+static const uint8_t secp192r1_qx[] =
+{
+    0x15, 0x14, 0x86, 0x3D, 0x96, 0xE1, 0xB1, 0x9E, 0x7B, 0x42, 0xDB, 0x0E, 0x4B, 0xC6, 0xA6, 0x38,
+    0xDF, 0xFA, 0x31, 0xCF, 0x3F, 0xF0, 0xF2, 0x43
+};
+static const uint8_t secp192r1_qy[] =
+{
+    0xD4, 0xB1, 0x65, 0xCE, 0x87, 0xDF, 0x52, 0xDF, 0xC0, 0x22, 0xB0, 0xCC, 0x6F, 0x34, 0xF2, 0xF2,
+    0xBE, 0x3B, 0x1B, 0x83, 0x44, 0x49, 0x20, 0x10
+};
+static const uint8_t secp192r1_r[] =
+{
+    0xA9, 0xA3, 0x13, 0x9E, 0xF3, 0x0B, 0xD0, 0x96, 0x82, 0xC0, 0xE5, 0x03, 0xE7, 0xCD, 0x7F, 0xD6,
+    0x4D, 0xB4, 0xBC, 0x15, 0x05, 0x2B, 0x84, 0x63
+};
+static const uint8_t secp192r1_s[] =
+{
+    0x2D, 0xC6, 0x17, 0xB7, 0xD2, 0x16, 0xDD, 0xD0, 0x78, 0xF9, 0x38, 0xA4, 0xEC, 0x3A, 0xA0, 0x09,
+    0x7D, 0x17, 0x3E, 0xC3, 0x0A, 0x9A, 0x85, 0xA6
+};
+static const uint8_t secp192r1_g2x[] =
+{
+    0x88, 0xA8, 0x82, 0x69, 0xB1, 0x0F, 0xA7, 0x29, 0xF6, 0xA3, 0x88, 0x15, 0x63, 0x34, 0x55, 0xD3,
+    0x2A, 0x3F, 0x78, 0x28, 0x58, 0xBF, 0xFE, 0xDA
+};
+static const uint8_t secp192r1_g2y[] =
+{
+    0xAB, 0x93, 0x7E, 0x5C, 0xFA, 0x1A, 0x33, 0x59, 0x8F, 0x86, 0x1B, 0x14, 0xBC, 0x7B, 0xB2, 0x46,
+    0xFA, 0xA0, 0x3D, 0x99, 0x0D, 0xDA, 0x6B, 0xDD
+};
+static const uint8_t secp192r1_g3x[] =
+{
+    0xDA, 0x63, 0xB2, 0xCB, 0x59, 0xD3, 0xD0, 0xDF, 0xAA, 0xB9, 0xB2, 0x1F, 0x20, 0x83, 0xD2, 0xDC,
+    0x6E, 0x9E, 0x59, 0x57, 0x25, 0x2A, 0xE3, 0x76
+};
+static const uint8_t secp192r1_g3y[] =
+{
+    0xFD, 0x05, 0xFD, 0x0C, 0x66, 0x43, 0xB5, 0xF3, 0x9E, 0xD4, 0x21, 0xD1, 0xFE, 0xE0, 0x62, 0xAA,
+    0x20, 0x45, 0xBA, 0x72, 0xE3, 0x37, 0x2C, 0x78
+};
+
+// secp224r1
+static const uint8_t secp224r1_p[] =
+{
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF
+};
+static const uint8_t secp224r1_n[] =
+{
+    0x3D, 0x2A, 0x5C, 0x5C, 0x45, 0x29, 0xDD, 0x13, 0x3E, 0xF0, 0xB8, 0xE0, 0xA2, 0x16, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF
+};
+static const uint8_t secp224r1_gx[] =
+{
+    0x21, 0x1D, 0x5C, 0x11, 0xD6, 0x80, 0x32, 0x34, 0x22, 0x11, 0xC2, 0x56, 0xD3, 0xC1, 0x03, 0x4A,
+    0xB9, 0x90, 0x13, 0x32, 0x7F, 0xBF, 0xB4, 0x6B, 0xBD, 0x0C, 0x0E, 0xB7
+};
+static const uint8_t secp224r1_gy[] =
+{
+    0x34, 0x7E, 0x00, 0x85, 0x99, 0x81, 0xD5, 0x44, 0x64, 0x47, 0x07, 0x5A, 0xA0, 0x75, 0x43, 0xCD,
+    0xE6, 0xDF, 0x22, 0x4C, 0xFB, 0x23, 0xF7, 0xB5, 0x88, 0x63, 0x37, 0xBD
+};
+static const uint8_t secp224r1_a[] =
+{
+    0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF
+};
+static const uint8_t secp224r1_b[] =
+{
+    0xB4, 0xFF, 0x55, 0x23, 0x43, 0x39, 0x0B, 0x27, 0xBA, 0xD8, 0xBF, 0xD7, 0xB7, 0xB0, 0x44, 0x50,
+    0x56, 0x32, 0x41, 0xF5, 0xAB, 0xB3, 0x04, 0x0C, 0x85, 0x0A, 0x05, 0xB4
+};
+static const uint8_t secp224r1_d[] =
+{
+    0x91, 0x40, 0xD6, 0xCE, 0x68, 0x55, 0x9A, 0x21, 0x1A, 0x67, 0xE0, 0x48, 0x3C, 0x2D, 0x68, 0x41,
+    0x57, 0x8A, 0xF3, 0x1E, 0x95, 0x97, 0x38, 0x70, 0x9C, 0x89, 0x17, 0x34
+};
+static const uint8_t secp224r1_k[] =
+{
+    0x12, 0xB4, 0xC0, 0x5F, 0x86, 0x5C, 0xDA, 0x38, 0x46, 0x82, 0x41, 0xFC, 0xAC, 0x87, 0x3D, 0xC5,
+    0xA4, 0x59, 0x65, 0xBB, 0x99, 0x8F, 0x73, 0x24, 0x41, 0x79, 0x16, 0x3B
+};
+static const uint8_t secp224r1_qx[] =
+{
+    0x37, 0x39, 0x57, 0x79, 0x9E, 0x92, 0x65, 0xCD, 0x34, 0x18, 0x7B, 0x73, 0x2B, 0xF0, 0xF5, 0x33,
+    0x05, 0x4A, 0xA8, 0xFE, 0x66, 0xCE, 0x4B, 0xA9, 0xD3, 0xC1, 0x6E, 0x23
+};
+static const uint8_t secp224r1_qy[] =
+{
+    0x68, 0xEC, 0x67, 0xF8, 0x2A, 0x02, 0xE6, 0x62, 0x40, 0x3C, 0xCB, 0x99, 0x73, 0xFD, 0x63, 0x41,
+    0xF0, 0x48, 0x7D, 0x06, 0xFA, 0x36, 0xA7, 0xE3, 0x98, 0x17, 0x38, 0x26
+};
+static const uint8_t secp224r1_r[] =
+{
+    0x67, 0xC5, 0xEF, 0xB7, 0x20, 0x08, 0xFE, 0xB1, 0x95, 0x77, 0x47, 0xAF, 0x50, 0x11, 0x35, 0x4D,
+    0xC4, 0x7C, 0xD3, 0xC0, 0x29, 0x83, 0x06, 0xFF, 0x51, 0xB8, 0xD3, 0x60
+};
+static const uint8_t secp224r1_s[] =
+{
+    0x1C, 0x9A, 0x1B, 0xC3, 0x84, 0xA1, 0xF7, 0x37, 0x74, 0xA8, 0x97, 0x25, 0x51, 0x3F, 0xAE, 0x94,
+    0x04, 0x5D, 0x43, 0xF5, 0x33, 0x45, 0x60, 0x64, 0xFE, 0x55, 0x9B, 0xA2
+};
+static const uint8_t secp224r1_g2x[] =
+{
+    0xA6, 0x4F, 0x70, 0x1A, 0xFD, 0x68, 0xD2, 0x32, 0x80, 0xC1, 0x6D, 0xD1, 0x88, 0x47, 0x47, 0x89,
+    0x6D, 0x0E, 0xE6, 0x98, 0x67, 0xB7, 0xDC, 0x76, 0xDC, 0x46, 0x6A, 0x70
+};
+static const uint8_t secp224r1_g2y[] =
+{
+    0xBB, 0xE8, 0xE4, 0xD2, 0x09, 0x37, 0xCF, 0x7A, 0x48, 0x29, 0xA6, 0xFC, 0x49, 0x28, 0x89, 0x86,
+    0xA9, 0x4F, 0x70, 0x2A, 0x70, 0xE7, 0x25, 0xBC, 0xA7, 0x76, 0x2B, 0x1C
+};
+static const uint8_t secp224r1_g3x[] =
+{
+    0x04, 0x6D, 0x89, 0xFD, 0x08, 0x0D, 0xFE, 0x79, 0x02, 0x18, 0xC2, 0x75, 0xCC, 0xD2, 0xB9, 0x58,
+    0x25, 0x82, 0xFF, 0x1E, 0xD3, 0xD0, 0x51, 0xA5, 0x66, 0x1D, 0x1B, 0xDF
+};
+static const uint8_t secp224r1_g3y[] =
+{
+    0x25, 0xA9, 0x81, 0x19, 0x59, 0xF3, 0x1A, 0x4E, 0x34, 0x17, 0xD3, 0x77, 0xDF, 0x0D, 0x13, 0x30,
+    0x68, 0xA5, 0x0A, 0x4C, 0x44, 0xBE, 0xD0, 0xAD, 0x3C, 0xF0, 0xF7, 0xA3
+};
+
+// secp256r1
+static const uint8_t secp256r1_p[] =
+{
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF
+};
+static const uint8_t secp256r1_n[] =
+{
+    0x51, 0x25, 0x63, 0xFC, 0xC2, 0xCA, 0xB9, 0xF3, 0x84, 0x9E, 0x17, 0xA7, 0xAD, 0xFA, 0xE6, 0xBC,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF
+};
+static const uint8_t secp256r1_gx[] =
+{
+    0x96, 0xC2, 0x98, 0xD8, 0x45, 0x39, 0xA1, 0xF4, 0xA0, 0x33, 0xEB, 0x2D, 0x81, 0x7D, 0x03, 0x77,
+    0xF2, 0x40, 0xA4, 0x63, 0xE5, 0xE6, 0xBC, 0xF8, 0x47, 0x42, 0x2C, 0xE1, 0xF2, 0xD1, 0x17, 0x6B
+};
+static const uint8_t secp256r1_gy[] =
+{
+    0xF5, 0x51, 0xBF, 0x37, 0x68, 0x40, 0xB6, 0xCB, 0xCE, 0x5E, 0x31, 0x6B, 0x57, 0x33, 0xCE, 0x2B,
+    0x16, 0x9E, 0x0F, 0x7C, 0x4A, 0xEB, 0xE7, 0x8E, 0x9B, 0x7F, 0x1A, 0xFE, 0xE2, 0x42, 0xE3, 0x4F
+};
+static const uint8_t secp256r1_a[] =
+{
+    0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF
+};
+static const uint8_t secp256r1_b[] =
+{
+    0x4B, 0x60, 0xD2, 0x27, 0x3E, 0x3C, 0xCE, 0x3B, 0xF6, 0xB0, 0x53, 0xCC, 0xB0, 0x06, 0x1D, 0x65,
+    0xBC, 0x86, 0x98, 0x76, 0x55, 0xBD, 0xEB, 0xB3, 0xE7, 0x93, 0x3A, 0xAA, 0xD8, 0x35, 0xC6, 0x5A
+};
+static const uint8_t secp256r1_d[] =
+{
+    0x81, 0x70, 0xF4, 0x13, 0xC1, 0x53, 0xA7, 0xA8, 0x79, 0x60, 0x61, 0x8F, 0xD8, 0xB2, 0xCB, 0x53,
+    0x55, 0xA1, 0x16, 0x67, 0xE4, 0xC0, 0x44, 0x6A, 0x5A, 0x20, 0xA6, 0x3E, 0x6D, 0xF3, 0x72, 0xA5
+};
+static const uint8_t secp256r1_k[] =
+{
+    0xD7, 0x20, 0xAB, 0xF7, 0x0B, 0x7C, 0x78, 0xBE, 0x8D, 0x8B, 0x25, 0x15, 0x64, 0x52, 0xE9, 0xFB,
+    0x36, 0xA5, 0xD3, 0xC7, 0xA9, 0xF1, 0x8B, 0xCD, 0x22, 0x1D, 0x3B, 0x30, 0x0E, 0xA1, 0xAF, 0x99
+};
+static const uint8_t secp256r1_qx[] =
+{
+    0x33, 0x78, 0x51, 0x5C, 0xFF, 0xE2, 0x1B, 0x1B, 0xC4, 0x8E, 0xB2, 0x6D, 0x96, 0xFE, 0x38, 0x18,
+    0x99, 0xC8, 0xDC, 0xE5, 0x2B, 0x27, 0x35, 0x35, 0xB2, 0xEB, 0x93, 0x3E, 0x38, 0x64, 0xC2, 0x09
+};
+static const uint8_t secp256r1_qy[] =
+{
+    0x98, 0x16, 0x51, 0xAF, 0x50, 0x3D, 0x04, 0x5D, 0xBA, 0xA9, 0xEF, 0x07, 0x64, 0xCE, 0xFB, 0x26,
+    0xE5, 0x5B, 0xFE, 0xE5, 0xBB, 0x58, 0x7D, 0xA6, 0x56, 0x77, 0x22, 0xE4, 0x53, 0x6C, 0x47, 0xE0
+};
+static const uint8_t secp256r1_r[] =
+{
+    0xA7, 0x1B, 0x72, 0x2A, 0x4F, 0x0D, 0x89, 0xB0, 0x81, 0x26, 0x35, 0x0E, 0xBB, 0xA5, 0xD6, 0x8D,
+    0x26, 0xA4, 0xDF, 0xFE, 0x26, 0xF3, 0x0C, 0x41, 0xB2, 0x79, 0x05, 0x8D, 0x84, 0x8F, 0x5C, 0x0D
+};
+static const uint8_t secp256r1_s[] =
+{
+    0x6A, 0xCD, 0xC7, 0x33, 0xAB, 0x66, 0xB5, 0xDD, 0x28, 0xBB, 0xEC, 0xB0, 0x0E, 0xDE, 0x6C, 0x87,
+    0x54, 0x4D, 0x7A, 0x28, 0xB8, 0xAD, 0x2E, 0x7C, 0x15, 0x83, 0xB7, 0x9E, 0x40, 0x6D, 0xA6, 0xCE
+};
+static const uint8_t secp256r1_g2x[] =
+{
+    0x78, 0x99, 0x66, 0x47, 0xFC, 0x48, 0x0B, 0xA6, 0x35, 0x1B, 0xF2, 0x77, 0xE2, 0x69, 0x89, 0xC0,
+    0xC3, 0x1A, 0xB5, 0x04, 0x03, 0x38, 0x52, 0x8A, 0x7E, 0x4F, 0x03, 0x8D, 0x18, 0x7B, 0xF2, 0x7C
+};
+static const uint8_t secp256r1_g2y[] =
+{
+    0xD1, 0x73, 0x78, 0x22, 0x9D, 0xB7, 0x04, 0x9E, 0x29, 0x82, 0xE9, 0x3C, 0xE6, 0xAD, 0x7D, 0xBA,
+    0xDB, 0x30, 0x74, 0x9F, 0xC6, 0x9A, 0x3D, 0x29, 0x40, 0xD0, 0x8E, 0xDB, 0x10, 0x55, 0x77, 0x07
+};
+static const uint8_t secp256r1_g3x[] =
+{
+    0x6C, 0xFD, 0xE7, 0xC6, 0x1B, 0x66, 0x41, 0xFB, 0x85, 0xA9, 0xAD, 0xEF, 0x21, 0xB7, 0xC6, 0xE6,
+    0x65, 0xF1, 0x4B, 0x1D, 0x95, 0xEF, 0xF7, 0xC8, 0x44, 0x0A, 0x33, 0xA6, 0xD1, 0xE4, 0xCB, 0x5E
+};
+static const uint8_t secp256r1_g3y[] =
+{
+    0x32, 0x50, 0x7D, 0xA2, 0x27, 0xB1, 0x79, 0x9A, 0x3D, 0xB8, 0x4F, 0x38, 0x36, 0xB0, 0x2A, 0xD8,
+    0xEC, 0xA2, 0x64, 0x1A, 0xCE, 0x06, 0x4B, 0x37, 0x7E, 0xFF, 0x98, 0x49, 0x0C, 0x64, 0x34, 0x87
+};
+
+// secp384r1
+static const uint8_t secp384r1_p[] =
+{
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF
+};
+static const uint8_t secp384r1_n[] =
+{
+    0x73, 0x29, 0xC5, 0xCC, 0x6A, 0x19, 0xEC, 0xEC, 0x7A, 0xA7, 0xB0, 0x48, 0xB2, 0x0D, 0x1A, 0x58,
+    0xDF, 0x2D, 0x37, 0xF4, 0x81, 0x4D, 0x63, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF
+};
+static const uint8_t secp384r1_gx[] =
+{
+    0xB7, 0x0A, 0x76, 0x72, 0x38, 0x5E, 0x54, 0x3A, 0x6C, 0x29, 0x55, 0xBF, 0x5D, 0xF2, 0x02, 0x55,
+    0x38, 0x2A, 0x54, 0x82, 0xE0, 0x41, 0xF7, 0x59, 0x98, 0x9B, 0xA7, 0x8B, 0x62, 0x3B, 0x1D, 0x6E,
+    0x74, 0xAD, 0x20, 0xF3, 0x1E, 0xC7, 0xB1, 0x8E, 0x37, 0x05, 0x8B, 0xBE, 0x22, 0xCA, 0x87, 0xAA
+};
+static const uint8_t secp384r1_gy[] =
+{
+    0x5F, 0x0E, 0xEA, 0x90, 0x7C, 0x1D, 0x43, 0x7A, 0x9D, 0x81, 0x7E, 0x1D, 0xCE, 0xB1, 0x60, 0x0A,
+    0xC0, 0xB8, 0xF0, 0xB5, 0x13, 0x31, 0xDA, 0xE9, 0x7C, 0x14, 0x9A, 0x28, 0xBD, 0x1D, 0xF4, 0xF8,
+    0x29, 0xDC, 0x92, 0x92, 0xBF, 0x98, 0x9E, 0x5D, 0x6F, 0x2C, 0x26, 0x96, 0x4A, 0xDE, 0x17, 0x36
+};
+static const uint8_t secp384r1_a[] =
+{
+    0xFC, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF
+};
+static const uint8_t secp384r1_b[] =
+{
+    0xEF, 0x2A, 0xEC, 0xD3, 0xED, 0xC8, 0x85, 0x2A, 0x9D, 0xD1, 0x2E, 0x8A, 0x8D, 0x39, 0x56, 0xC6,
+    0x5A, 0x87, 0x13, 0x50, 0x8F, 0x08, 0x14, 0x03, 0x12, 0x41, 0x81, 0xFE, 0x6E, 0x9C, 0x1D, 0x18,
+    0x19, 0x2D, 0xF8, 0xE3, 0x6B, 0x05, 0x8E, 0x98, 0xE4, 0xE7, 0x3E, 0xE2, 0xA7, 0x2F, 0x31, 0xB3
+};
+static const uint8_t secp384r1_d[] =
+{
+    0x13, 0xB0, 0xD7, 0x20, 0x02, 0xAB, 0x47, 0x36, 0x0B, 0x22, 0xE8, 0x99, 0xDD, 0xAF, 0x5D, 0xF6,
+    0xD5, 0x84, 0x21, 0x24, 0xB2, 0xEC, 0x06, 0x9B, 0xC4, 0x10, 0x65, 0x1F, 0x87, 0x6D, 0x61, 0x90,
+    0x9C, 0xA9, 0x32, 0x63, 0xB0, 0x66, 0xB3, 0xBA, 0x73, 0x19, 0x2F, 0x89, 0xBA, 0x5C, 0x6F, 0x9F
+};
+static const uint8_t secp384r1_k[] =
+{
+    0x5B, 0x8D, 0x4C, 0x6F, 0x26, 0x8E, 0x9C, 0x7C, 0xCB, 0xAA, 0xB1, 0x27, 0xFB, 0xB7, 0x33, 0x34,
+    0x1E, 0x67, 0x36, 0xF7, 0xC2, 0x2E, 0x3D, 0x74, 0x3E, 0x7D, 0x2C, 0x29, 0x48, 0x4C, 0xC6, 0xF7,
+    0xEB, 0x86, 0x7E, 0xE8, 0x43, 0x37, 0x67, 0xE7, 0x42, 0x56, 0x91, 0xA1, 0x7C, 0x5D, 0x2F, 0x02
+};
+static const uint8_t secp384r1_qx[] =
+{
+    0xEF, 0x84, 0x0F, 0x9C, 0x4C, 0x12, 0x2D, 0xAE, 0xC3, 0x5D, 0x33, 0x44, 0xC2, 0xBE, 0xCB, 0xDB,
+    0x08, 0x05, 0xF6, 0x6B, 0xAF, 0xAB, 0x47, 0x4B, 0x1C, 0x53, 0xD8, 0xDE, 0xF7, 0xF5, 0xE0, 0x7C,
+    0x01, 0x1A, 0xD4, 0x66, 0xDF, 0x72, 0x3C, 0x08, 0xBD, 0xB7, 0x63, 0xE2, 0x7A, 0x0E, 0x3C, 0xA1
+};
+static const uint8_t secp384r1_qy[] =
+{
+    0x89, 0x43, 0x38, 0x77, 0x81, 0x48, 0x30, 0xC5, 0xC4, 0x80, 0x37, 0xF8, 0x7B, 0x4F, 0x5B, 0x08,
+    0x87, 0x56, 0x3A, 0x5E, 0xB4, 0x9B, 0x3A, 0x29, 0x46, 0x7B, 0x90, 0x68, 0x84, 0xA3, 0xC7, 0x6D,
+    0x5F, 0x1E, 0x75, 0xB4, 0xB6, 0xC0, 0x09, 0xFA, 0xA1, 0x7E, 0xCE, 0xF0, 0x04, 0x0E, 0x54, 0x58
+};
+static const uint8_t secp384r1_r[] =
+{
+    0xDD, 0x74, 0x82, 0xA9, 0x6C, 0x20, 0x42, 0x83, 0x42, 0x7B, 0xAC, 0xF9, 0xD6, 0xDF, 0x97, 0xE0,
+    0xE4, 0x70, 0x9F, 0x5B, 0x14, 0xAE, 0x86, 0x81, 0xD4, 0x0A, 0x6C, 0x0A, 0x73, 0xA2, 0x20, 0xE1,
+    0x97, 0x0B, 0x69, 0x06, 0x48, 0xBF, 0x1E, 0x4C, 0xD6, 0xAA, 0x50, 0xA7, 0xEF, 0x09, 0xE0, 0xE1
+};
+static const uint8_t secp384r1_s[] =
+{
+    0x9F, 0x25, 0xD2, 0xCC, 0xA1, 0x67, 0xB1, 0xAA, 0xB1, 0x7C, 0x77, 0x63, 0x39, 0x7B, 0xAE, 0x7B,
+    0xED, 0xF0, 0x4B, 0x2B, 0x27, 0x4A, 0x62, 0xE2, 0xD5, 0x37, 0xCD, 0x40, 0x68, 0x57, 0x67, 0x5B,
+    0x94, 0x52, 0x85, 0xFD, 0xD7, 0x6E, 0x60, 0xE7, 0x58, 0x37, 0x18, 0xAC, 0xB1, 0xDC, 0xC8, 0x27
+};
+static const uint8_t secp384r1_g2x[] =
+{
+    0x61, 0xDF, 0x95, 0x52, 0xC7, 0xA9, 0x96, 0x5B, 0xF8, 0x64, 0x0E, 0xBE, 0x6E, 0xE8, 0xE0, 0x4F,
+    0x9E, 0x6E, 0xB9, 0x9F, 0xD1, 0x07, 0xD2, 0x51, 0xD6, 0x34, 0xF4, 0xA6, 0x59, 0x59, 0x02, 0x89,
+    0xF0, 0x97, 0x5B, 0xC5, 0x45, 0x00, 0x26, 0x69, 0xD9, 0xD2, 0xA3, 0x7B, 0x05, 0x99, 0xD9, 0x08
+};
+static const uint8_t secp384r1_g2y[] =
+{
+    0x80, 0x0E, 0x94, 0x0A, 0x70, 0x1E, 0x50, 0x61, 0x2D, 0xE2, 0x39, 0x4D, 0xE9, 0x43, 0xFD, 0x5F,
+    0x25, 0xB4, 0x6A, 0x25, 0x5F, 0x50, 0x4E, 0x90, 0x3E, 0xC4, 0x6C, 0xBC, 0x75, 0xD8, 0x75, 0xB2,
+    0x74, 0xBA, 0x6D, 0xFD, 0xDF, 0xE8, 0xBF, 0xB7, 0xED, 0x3C, 0x1B, 0x5B, 0xFA, 0xF1, 0x80, 0x8E
+};
+static const uint8_t secp384r1_g3x[] =
+{
+    0x31, 0xC8, 0x00, 0x05, 0xC7, 0xE5, 0xD7, 0x02, 0x0D, 0x58, 0x26, 0x50, 0xAE, 0xBB, 0x08, 0xB4,
+    0xA6, 0x6D, 0x56, 0xD3, 0x40, 0xF2, 0xA4, 0xBE, 0x06, 0xCD, 0x2D, 0x20, 0x10, 0x39, 0x9D, 0xCB,
+    0x98, 0x7D, 0xDC, 0x5F, 0x7E, 0x3C, 0x79, 0x64, 0x14, 0xFA, 0x6F, 0x60, 0xD4, 0x41, 0x7A, 0x07
+};
+static const uint8_t secp384r1_g3y[] =
+{
+    0xF1, 0x1D, 0x2F, 0x0A, 0x60, 0x28, 0x5F, 0xB6, 0x98, 0xD2, 0xB5, 0xE4, 0x6B, 0xBD, 0x4A, 0xC2,
+    0xAC, 0x1E, 0x11, 0xDC, 0x0E, 0x4C, 0x68, 0xF7, 0xA5, 0x5A, 0x11, 0x85, 0x1C, 0xB4, 0x20, 0x85,
+    0x99, 0xFC, 0xA9, 0x02, 0x96, 0xBE, 0x0B, 0x7D, 0x83, 0x42, 0x0C, 0x0B, 0xCA, 0xF7, 0x95, 0xC9
+};
+
+#endif //DRV_BA414E_HOST_VECTORS_H
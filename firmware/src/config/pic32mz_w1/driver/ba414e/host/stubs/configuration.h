@@ -0,0 +1,26 @@
+/*******************************************************************************
+  BA414E Host Build Configuration
+
+  File Name:
+    configuration.h
+
+  Summary:
+    Driver configuration for the host build of the BA414E job queue.
+
+  Description:
+    Stands in for the generated configuration.h of the firmware.  The sizes
+    match firmware/src/config/pic32mz_w1/configuration.h.  Defining
+    DRV_BA414E_HOST_POLLED builds the driver without RTOS support, with the
+    driver task called from the application loop.
+*******************************************************************************/
+
+#ifndef CONFIGURATION_H
+#define CONFIGURATION_H
+
+#define DRV_BA414E_NUM_CLIENTS 5
+#define DRV_BA414E_QUEUE_SIZE 10
+#if !defined(DRV_BA414E_HOST_POLLED)
+#define DRV_BA414E_RTOS_STACK_SIZE           1024
+#endif
+
+#endif // CONFIGURATION_H
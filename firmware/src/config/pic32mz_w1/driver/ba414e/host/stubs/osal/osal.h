@@ -0,0 +1,96 @@
+/*******************************************************************************
+  BA414E Host Build OSAL
+
+  File Name:
+    osal.h
+
+  Summary:
+    The OSAL semaphores used by the BA414E driver, on POSIX threads.
+
+  Description:
+    Stands in for osal/osal.h in the host build of the BA414E job queue.
+    Binary semaphores saturate at one, as they do on the RTOS.
+*******************************************************************************/
+
+#ifndef OSAL_H
+#define OSAL_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <pthread.h>
+
+#define OSAL_WAIT_FOREVER               0xFFFF
+
+typedef enum OSAL_SEM_TYPE
+{
+  OSAL_SEM_TYPE_BINARY,
+  OSAL_SEM_TYPE_COUNTING
+} OSAL_SEM_TYPE;
+
+typedef enum OSAL_RESULT
+{
+  OSAL_RESULT_NOT_IMPLEMENTED = -1,
+  OSAL_RESULT_FALSE = 0,
+  OSAL_RESULT_TRUE = 1
+} OSAL_RESULT;
+
+typedef struct
+{
+    pthread_mutex_t mutex;
+    pthread_cond_t cond;
+    uint32_t count;
+    uint32_t maxCount;
+} OSAL_SEM_HANDLE_TYPE;
+
+#define OSAL_SEM_DECLARE(semID)         OSAL_SEM_HANDLE_TYPE semID
+
+static inline OSAL_RESULT OSAL_SEM_Create(OSAL_SEM_HANDLE_TYPE* semID, OSAL_SEM_TYPE type, uint8_t maxCount, uint8_t initialCount)
+{
+    pthread_mutex_init(&semID->mutex, NULL);
+    pthread_cond_init(&semID->cond, NULL);
+    semID->maxCount = (type == OSAL_SEM_TYPE_BINARY) ? 1 : maxCount;
+    semID->count = initialCount;
+    return OSAL_RESULT_TRUE;
+}
+
+static inline OSAL_RESULT OSAL_SEM_Delete(OSAL_SEM_HANDLE_TYPE* semID)
+{
+    pthread_cond_destroy(&semID->cond);
+    pthread_mutex_destroy(&semID->mutex);
+    return OSAL_RESULT_TRUE;
+}
+
+// Only OSAL_WAIT_FOREVER is used by the driver.
+static inline OSAL_RESULT OSAL_SEM_Pend(OSAL_SEM_HANDLE_TYPE* semID, uint16_t waitMS)
+{
+    (void)waitMS;
+    pthread_mutex_lock(&semID->mutex);
+    while (semID->count == 0)
+    {
+        pthread_cond_wait(&semID->cond, &semID->mutex);
+    }
+    semID->count--;
+    pthread_mutex_unlock(&semID->mutex);
+    return OSAL_RESULT_TRUE;
+}
+
+static inline OSAL_RESULT OSAL_SEM_Post(OSAL_SEM_HANDLE_TYPE* semID)
+{
+    OSAL_RESULT ret = OSAL_RESULT_FALSE;
+    pthread_mutex_lock(&semID->mutex);
+    if (semID->count < semID->maxCount)
+    {
+        semID->count++;
+        pthread_cond_signal(&semID->cond);
+        ret = OSAL_RESULT_TRUE;
+    }
+    pthread_mutex_unlock(&semID->mutex);
+    return ret;
+}
+
+static inline OSAL_RESULT OSAL_SEM_PostISR(OSAL_SEM_HANDLE_TYPE* semID)
+{
+    return OSAL_SEM_Post(semID);
+}
+
+#endif // OSAL_H
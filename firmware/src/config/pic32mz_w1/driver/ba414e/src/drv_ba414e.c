@@ -1,5 +1,5 @@
 /********************************************************************************
-  BA414E Crypto Driver Dynamic implementation.
+  BA414E Crypto Driver Hardware Backend implementation.
 
   Company:
     Microchip Technology Inc.
@@ -8,12 +8,11 @@
     drv_ba414e.c
 
   Summary:
-    Source code for the BA414E Crypto driver dynamic 
-    implementation.
+    Source code for the BA414E Crypto driver hardware backend.
 
   Description:
-    This file contains the source code for the dynamic implementation of the
-    BA414E Crypto driver.
+    This file contains the source code that runs the job queue's operations
+    on the BA414E public key engine.
 *******************************************************************************/
 
 //DOM-IGNORE-BEGIN
@@ -57,6 +56,8 @@ SUBSTITUTE  GOODS,  TECHNOLOGY,  SERVICES,  OR  ANY  CLAIMS  BY  THIRD   PARTIES
 #include <stdio.h>
 #include <stdlib.h>
 
+#if !defined(DRV_BA414E_SOFTWARE_BACKEND)
+
 #define min(a,b) (((a)<(b))?(a):(b))
 
 extern char * dbgBufferPtr;
@@ -68,8 +69,7 @@ extern uint32_t debugBufferSize;
 // *****************************************************************************
 // *****************************************************************************
 
-static DRV_BA414E_OperationalData opData = {0};
-static DRV_BA414E_ClientData clientData[DRV_BA414E_NUM_CLIENTS];
+static DRV_BA414E_HardwareData hwData = {0};
 
 static const uint32_t init_ucode_array[810]={
     0x10032004,0x48013e00,0x5a800d20,0x09a80202,0x011a8090,0x60287805,0xba022780,0xb2e02fa8,0x0cee0070,
@@ -440,199 +440,44 @@ static void DRV_BA414E_ucmemInit(void)
 
 // *****************************************************************************
 // *****************************************************************************
-// Section: BA414E Driver Interface State Handlers
+// Section: BA414E Driver Backend Implementation
 // *****************************************************************************
 // *****************************************************************************
 
-void DRV_BA414E_InitialStateHandler()
+void DRV_BA414E_BackendInitialize(void)
 {
     DRV_BA414E_ucmemInit();
     DRV_BA414E_scmClear();
 }
 
 
-// *****************************************************************************
-// *****************************************************************************
-// Section: BA414E Driver Interface Implementations
-// *****************************************************************************
-// *****************************************************************************
-
-
-
-SYS_MODULE_OBJ DRV_BA414E_Initialize
-(
-    const SYS_MODULE_INDEX index,
-    const SYS_MODULE_INIT * const init
-)
-{
-    SYS_MODULE_OBJ ret = 0;
-    if ((index != 0) || (opData.inited == 1))
-    {
-        ret = SYS_MODULE_OBJ_INVALID;
-    }
-    else
-    {
-        memset(&opData, 0, sizeof(DRV_BA414E_OperationalData));
-        opData.inited = 1;
-        opData.state = DRV_BA414E_INITIALIZE;
-        opData.status = SYS_STATUS_UNINITIALIZED;
-#if defined(DRV_BA414E_RTOS_STACK_SIZE)
-        OSAL_SEM_Create(&opData.clientListSema, OSAL_SEM_TYPE_BINARY, 1, 1);
-        OSAL_SEM_Create(&opData.wfi, OSAL_SEM_TYPE_BINARY, DRV_BA414E_NUM_CLIENTS, 0);
-    #if !defined(DRV_BA414_RTOS_TASK_DELAY)
-        OSAL_SEM_Create(&opData.clientAction, OSAL_SEM_TYPE_COUNTING, DRV_BA414E_NUM_CLIENTS, 0);
-    #endif
-#endif        
-        memset(&clientData, 0, sizeof(clientData));
-        int counter;
-        for (counter = 0; counter < DRV_BA414E_NUM_CLIENTS; counter++)
-        {
-#if defined(DRV_BA414E_RTOS_STACK_SIZE)
-            OSAL_SEM_Create(&(clientData[counter].clientBlock), OSAL_SEM_TYPE_BINARY, 1, 0);
-#endif            
-        }
-        
-        ret = (SYS_MODULE_OBJ)&opData;
-    }
-    return ret;
-}
-
-void DRV_BA414E_Deinitialize( SYS_MODULE_OBJ object)
-{
-    if (object == (SYS_MODULE_OBJ)&opData)
-    {
-#if defined(DRV_BA414E_RTOS_STACK_SIZE)
-        OSAL_SEM_Delete(&opData.clientListSema);
-        OSAL_SEM_Delete(&opData.wfi);
-    #if !defined(DRV_BA414_RTOS_TASK_DELAY)
-        OSAL_SEM_Delete(&opData.clientAction);
-    #endif
-#endif        
-        int counter;
-        for (counter = 0; counter < DRV_BA414E_NUM_CLIENTS; counter++)
-        {
-#if defined(DRV_BA414E_RTOS_STACK_SIZE)
-            OSAL_SEM_Delete(&(clientData[counter].clientBlock));
-#endif            
-        }
-        memset(&clientData, 0, sizeof(clientData));
-        memset(&opData, 0, sizeof(DRV_BA414E_OperationalData));
-    }
-}
-
-DRV_HANDLE DRV_BA414E_Open( const SYS_MODULE_INDEX index, 
-        const DRV_IO_INTENT ioIntent)
-{
-    DRV_HANDLE ret = DRV_HANDLE_INVALID;
-    if (index == 0)
-    {
-#if !defined(DRV_BA414E_RTOS_STACK_SIZE)
-        if ((ioIntent & DRV_IO_INTENT_NONBLOCKING) == DRV_IO_INTENT_NONBLOCKING)
-#endif
-        {        
-            if ((ioIntent & DRV_IO_INTENT_WRITE) == DRV_IO_INTENT_WRITE)
-            {
-                uint8_t lookingForExclusive = 0;
-                if ((ioIntent & DRV_IO_INTENT_EXCLUSIVE) == DRV_IO_INTENT_EXCLUSIVE)
-                {
-                    lookingForExclusive = 1;
-                }
-                uint8_t found = -1;
-#if defined(DRV_BA414E_RTOS_STACK_SIZE)
-                OSAL_SEM_Pend(&opData.clientListSema, OSAL_WAIT_FOREVER);
-#endif                
-                int counter;
-                for (counter = 0; counter < DRV_BA414E_NUM_CLIENTS; counter++)
-                {
-                    if (clientData[counter].inUse == 0)
-                    {
-                        found = counter;
-                    }
-                    else
-                    {
-                        if (lookingForExclusive == 1 || ((clientData[counter].ioIntent & DRV_IO_INTENT_EXCLUSIVE) == DRV_IO_INTENT_EXCLUSIVE))
-                        {
-                            found = -1;
-                            break;
-                        }
-                    }
-                }
-                if (found != -1)
-                {
-                    clientData[found].inUse = 1;
-                    clientData[found].ioIntent = ioIntent;
-                    ret = (DRV_HANDLE)&(clientData[found]);
-                }
-#if defined(DRV_BA414E_RTOS_STACK_SIZE)
-                OSAL_SEM_Post(&opData.clientListSema);
-#endif                                
-            }
-        }  
-        
-    }
-        
-    return ret;
-}
-
-void DRV_BA414E_Close( const DRV_HANDLE handle)
-{
-    if (handle != DRV_HANDLE_INVALID)
-    {
-#if defined(DRV_BA414E_RTOS_STACK_SIZE)
-        OSAL_SEM_Pend(&opData.clientListSema, OSAL_WAIT_FOREVER);
-#endif                
-        DRV_BA414E_ClientData * cd = (DRV_BA414E_ClientData*)handle;
-        cd->ioIntent = 0;
-        cd->inUse = 0;                
-#if defined(DRV_BA414E_RTOS_STACK_SIZE)
-        OSAL_SEM_Post(&opData.clientListSema);
-#endif                                
-    }           
-}
-
-
-SYS_STATUS DRV_BA414E_Status( SYS_MODULE_OBJ object)
-{
-    SYS_STATUS ret = SYS_STATUS_ERROR;
-    if (object == (SYS_MODULE_OBJ)&opData)
-    {
-        ret = opData.status;
-    }
-    return ret;
-}
-
-
 void DRV_BA414E_InterruptHandler()
 {
-#if defined(DRV_BA414E_RTOS_STACK_SIZE)
-    OSAL_SEM_PostISR(&opData.wfi);
-#endif
-    opData.doneInterrupt = 1;
-    opData.lastStatus = PKSTATUS;
+    hwData.doneInterrupt = 1;
+    hwData.lastStatus = PKSTATUS;
     PKCONTROL = 0;
     SYS_INT_SourceDisable(INT_SOURCE_CRYPTO1);
+    DRV_BA414E_OperationDoneISR();
 }
 
 void DRV_BA414E_ErrorInterruptHandler()
 {
-#if defined(DRV_BA414E_RTOS_STACK_SIZE)
-    OSAL_SEM_PostISR(&opData.wfi);
-#endif
-    opData.errorInterrupt = 1;
-    opData.lastStatus = PKSTATUS;
+    hwData.errorInterrupt = 1;
+    hwData.lastStatus = PKSTATUS;
     PKCONTROL = 0;
     SYS_INT_SourceDisable(INT_SOURCE_CRYPTO1_FAULT);    
+    DRV_BA414E_OperationDoneISR();
 }
 
 void DRV_BA414E_StartOp()
 {
     PKCONTROL = 0;
-    //snprintf(dbgBufferPtr, debugBufferSize, "%s\r\n%s: PKSTATUS %08X Done %d Error %d\r\n", dbgBufferPtr, __FUNCTION__, PKSTATUS, opData.doneInterrupt, opData.errorInterrupt);
+    //snprintf(dbgBufferPtr, debugBufferSize, "%s\r\n%s: PKSTATUS %08X Done %d Error %d\r\n", dbgBufferPtr, __FUNCTION__, PKSTATUS, hwData.doneInterrupt, hwData.errorInterrupt);
     SYS_INT_SourceStatusClear(INT_SOURCE_CRYPTO1_FAULT);
     SYS_INT_SourceStatusClear(INT_SOURCE_CRYPTO1);
-    opData.doneInterrupt = 0;
-    opData.errorInterrupt = 0;
-    //snprintf(dbgBufferPtr, debugBufferSize, "%s\r\n%s: PKSTATUS %08X Done %d Error %d\r\n", dbgBufferPtr, __FUNCTION__, PKSTATUS, opData.doneInterrupt, opData.errorInterrupt);
+    hwData.doneInterrupt = 0;
+    hwData.errorInterrupt = 0;
+    //snprintf(dbgBufferPtr, debugBufferSize, "%s\r\n%s: PKSTATUS %08X Done %d Error %d\r\n", dbgBufferPtr, __FUNCTION__, PKSTATUS, hwData.doneInterrupt, hwData.errorInterrupt);
     if (SYS_INT_SourceStatusGet(INT_SOURCE_CRYPTO1) != 0)
     {
         //snprintf(dbgBufferPtr, debugBufferSize, "%s\r\n%s: Int still triggered\r\n", dbgBufferPtr, __FUNCTION__);
@@ -640,83 +485,83 @@ void DRV_BA414E_StartOp()
         SYS_INT_SourceStatusClear(INT_SOURCE_CRYPTO1_FAULT);
         SYS_INT_SourceStatusClear(INT_SOURCE_CRYPTO1);        
     }
-    //snprintf(dbgBufferPtr, debugBufferSize, "%s\r\n%s: PKSTATUS %08X Done %d Error %d\r\n", dbgBufferPtr, __FUNCTION__, PKSTATUS, opData.doneInterrupt, opData.errorInterrupt);
+    //snprintf(dbgBufferPtr, debugBufferSize, "%s\r\n%s: PKSTATUS %08X Done %d Error %d\r\n", dbgBufferPtr, __FUNCTION__, PKSTATUS, hwData.doneInterrupt, hwData.errorInterrupt);
     SYS_INT_SourceEnable(INT_SOURCE_CRYPTO1_FAULT);
     SYS_INT_SourceEnable(INT_SOURCE_CRYPTO1);
-    //snprintf(dbgBufferPtr, debugBufferSize, "%s\r\n%s: PKSTATUS %08X Done %d Error %d\r\n", dbgBufferPtr, __FUNCTION__, PKSTATUS, opData.doneInterrupt, opData.errorInterrupt);
+    //snprintf(dbgBufferPtr, debugBufferSize, "%s\r\n%s: PKSTATUS %08X Done %d Error %d\r\n", dbgBufferPtr, __FUNCTION__, PKSTATUS, hwData.doneInterrupt, hwData.errorInterrupt);
     PKCONTROL = 1;
 }
 
-void DRV_BA414E_PrepareEcdsaSign(DRV_BA414E_ClientData * cd)
+void DRV_BA414E_PrepareEcdsaSign(const DRV_BA414E_JOB_REQUEST * req)
 {
-    uint32_t len = cd->ecdsaSignParams.domain->keySize;
+    uint32_t len = req->ecdsaSignParams.domain->keySize;
 
     DRV_BA414E_scmClear();
     BA414E_PKCOMMANDbits cmd = {{0}};
     cmd.s.OPERATION = BA414E_OPC_ECC_ECDSA_SIGN;
-    cmd.s.OPSIZE = cd->ecdsaSignParams.domain->opSize;
+    cmd.s.OPSIZE = req->ecdsaSignParams.domain->opSize;
     cmd.s.CALCR2 = 1;
     PKCOMMAND = cmd.v;
     PKCONFIG = 0;
     
     
-    DRV_BA414E_copyToScm4(cd->ecdsaSignParams.domain->primeField, len, BA414E_ECDSA_SLOT_P, 0, 0, 0);    
-    DRV_BA414E_copyToScm4(cd->ecdsaSignParams.domain->order, len, BA414E_ECDSA_SLOT_N, 0, 0, 0);    
-    DRV_BA414E_copyToScm4(cd->ecdsaSignParams.domain->generatorX, len, BA414E_ECDSA_SLOT_GX, 0, 0, 0);    
-    DRV_BA414E_copyToScm4(cd->ecdsaSignParams.domain->generatorY, len, BA414E_ECDSA_SLOT_GY, 0, 0, 0);    
-    DRV_BA414E_copyToScm4(cd->ecdsaSignParams.domain->a, len, BA414E_ECDSA_SLOT_A, 0, 0, 0);    
-    DRV_BA414E_copyToScm4(cd->ecdsaSignParams.domain->b, len, BA414E_ECDSA_SLOT_B, 0, 0, 0);    
+    DRV_BA414E_copyToScm4(req->ecdsaSignParams.domain->primeField, len, BA414E_ECDSA_SLOT_P, 0, 0, 0);    
+    DRV_BA414E_copyToScm4(req->ecdsaSignParams.domain->order, len, BA414E_ECDSA_SLOT_N, 0, 0, 0);    
+    DRV_BA414E_copyToScm4(req->ecdsaSignParams.domain->generatorX, len, BA414E_ECDSA_SLOT_GX, 0, 0, 0);    
+    DRV_BA414E_copyToScm4(req->ecdsaSignParams.domain->generatorY, len, BA414E_ECDSA_SLOT_GY, 0, 0, 0);    
+    DRV_BA414E_copyToScm4(req->ecdsaSignParams.domain->a, len, BA414E_ECDSA_SLOT_A, 0, 0, 0);    
+    DRV_BA414E_copyToScm4(req->ecdsaSignParams.domain->b, len, BA414E_ECDSA_SLOT_B, 0, 0, 0);    
     
-    DRV_BA414E_copyToScm4(cd->ecdsaSignParams.privateKey, len, BA414E_ECDSA_SLOT_PRIV_KEY, 0, 0, 0);    
-    DRV_BA414E_copyToScm4(cd->ecdsaSignParams.k, len, BA414E_ECDSA_SLOT_K, 0, 0, 0);    
-    DRV_BA414E_copyToScm4(cd->ecdsaSignParams.msgHash, cd->ecdsaSignParams.msgHashSz, BA414E_ECDSA_SLOT_H, 1, 1, 0);
-    opData.doneInterrupt = 0;
-    opData.errorInterrupt = 0;
+    DRV_BA414E_copyToScm4(req->ecdsaSignParams.privateKey, len, BA414E_ECDSA_SLOT_PRIV_KEY, 0, 0, 0);    
+    DRV_BA414E_copyToScm4(req->ecdsaSignParams.k, len, BA414E_ECDSA_SLOT_K, 0, 0, 0);    
+    DRV_BA414E_copyToScm4(req->ecdsaSignParams.msgHash, req->ecdsaSignParams.msgHashSz, BA414E_ECDSA_SLOT_H, 1, 1, 0);
+    hwData.doneInterrupt = 0;
+    hwData.errorInterrupt = 0;
     SYS_INT_SourceEnable(INT_SOURCE_CRYPTO1_FAULT);
     SYS_INT_SourceEnable(INT_SOURCE_CRYPTO1);
     PKCONTROL = 1;
 }
 
-void DRV_BA414E_PrepareEcdsaVerify(DRV_BA414E_ClientData * cd)
+void DRV_BA414E_PrepareEcdsaVerify(const DRV_BA414E_JOB_REQUEST * req)
 {
-    uint32_t len = cd->ecdsaVerifyParams.domain->keySize;
+    uint32_t len = req->ecdsaVerifyParams.domain->keySize;
 
     DRV_BA414E_scmClear();
     BA414E_PKCOMMANDbits cmd = {{0}};
     cmd.s.OPERATION = BA414E_OPC_ECC_ECDSA_VERIFY;
-    cmd.s.OPSIZE = cd->ecdsaVerifyParams.domain->opSize;
+    cmd.s.OPSIZE = req->ecdsaVerifyParams.domain->opSize;
     cmd.s.CALCR2 = 1;
     PKCOMMAND = cmd.v;
     PKCONFIG = 0;
         
-    DRV_BA414E_copyToScm4(cd->ecdsaVerifyParams.domain->primeField, len, BA414E_ECDSA_SLOT_P, 0, 0, 0);    
-    DRV_BA414E_copyToScm4(cd->ecdsaVerifyParams.domain->order, len, BA414E_ECDSA_SLOT_N, 0, 0, 0);    
-    DRV_BA414E_copyToScm4(cd->ecdsaVerifyParams.domain->generatorX, len, BA414E_ECDSA_SLOT_GX, 0, 0, 0);    
-    DRV_BA414E_copyToScm4(cd->ecdsaVerifyParams.domain->generatorY, len, BA414E_ECDSA_SLOT_GY, 0, 0, 0);    
-    DRV_BA414E_copyToScm4(cd->ecdsaVerifyParams.domain->a, len, BA414E_ECDSA_SLOT_A, 0, 0, 0);    
-    DRV_BA414E_copyToScm4(cd->ecdsaVerifyParams.domain->b, len, BA414E_ECDSA_SLOT_B, 0, 0, 0);    
-    
-    DRV_BA414E_copyToScm4(cd->ecdsaVerifyParams.publicKeyX, len, BA414E_ECDSA_SLOT_X0, 0, 0, 0);    
-    DRV_BA414E_copyToScm4(cd->ecdsaVerifyParams.publicKeyY, len, BA414E_ECDSA_SLOT_Y0, 0, 0, 0);
-    DRV_BA414E_copyToScm4(cd->ecdsaVerifyParams.R, len, BA414E_ECDSA_SLOT_R, 0, 0, 0);    
-    DRV_BA414E_copyToScm4(cd->ecdsaVerifyParams.S, len, BA414E_ECDSA_SLOT_S, 0, 0, 0);
-    
-    DRV_BA414E_copyToScm4(cd->ecdsaVerifyParams.msgHash, cd->ecdsaSignParams.msgHashSz, BA414E_ECDSA_SLOT_H, 1, 1, 0);
-    opData.doneInterrupt = 0;
-    opData.errorInterrupt = 0;    
+    DRV_BA414E_copyToScm4(req->ecdsaVerifyParams.domain->primeField, len, BA414E_ECDSA_SLOT_P, 0, 0, 0);    
+    DRV_BA414E_copyToScm4(req->ecdsaVerifyParams.domain->order, len, BA414E_ECDSA_SLOT_N, 0, 0, 0);    
+    DRV_BA414E_copyToScm4(req->ecdsaVerifyParams.domain->generatorX, len, BA414E_ECDSA_SLOT_GX, 0, 0, 0);    
+    DRV_BA414E_copyToScm4(req->ecdsaVerifyParams.domain->generatorY, len, BA414E_ECDSA_SLOT_GY, 0, 0, 0);    
+    DRV_BA414E_copyToScm4(req->ecdsaVerifyParams.domain->a, len, BA414E_ECDSA_SLOT_A, 0, 0, 0);    
+    DRV_BA414E_copyToScm4(req->ecdsaVerifyParams.domain->b, len, BA414E_ECDSA_SLOT_B, 0, 0, 0);    
+    
+    DRV_BA414E_copyToScm4(req->ecdsaVerifyParams.publicKeyX, len, BA414E_ECDSA_SLOT_X0, 0, 0, 0);    
+    DRV_BA414E_copyToScm4(req->ecdsaVerifyParams.publicKeyY, len, BA414E_ECDSA_SLOT_Y0, 0, 0, 0);
+    DRV_BA414E_copyToScm4(req->ecdsaVerifyParams.R, len, BA414E_ECDSA_SLOT_R, 0, 0, 0);    
+    DRV_BA414E_copyToScm4(req->ecdsaVerifyParams.S, len, BA414E_ECDSA_SLOT_S, 0, 0, 0);
+    
+    DRV_BA414E_copyToScm4(req->ecdsaVerifyParams.msgHash, req->ecdsaSignParams.msgHashSz, BA414E_ECDSA_SLOT_H, 1, 1, 0);
+    hwData.doneInterrupt = 0;
+    hwData.errorInterrupt = 0;    
     SYS_INT_SourceEnable(INT_SOURCE_CRYPTO1_FAULT);
     SYS_INT_SourceEnable(INT_SOURCE_CRYPTO1);    
     PKCONTROL = 1;
 }
 
-void DRV_BA414E_PrimEccPointDouble(DRV_BA414E_ClientData * cd)
+void DRV_BA414E_PrimEccPointDouble(const DRV_BA414E_JOB_REQUEST * req)
 {
-    uint32_t len = cd->eccPointDoubleParams.domain->keySize;
+    uint32_t len = req->eccPointDoubleParams.domain->keySize;
 
     DRV_BA414E_scmClear();
     BA414E_PKCOMMANDbits cmd = {{0}};
     cmd.s.OPERATION = BA414E_OPC_PRIM_ECC_POINT_DOUBLE;
-    cmd.s.OPSIZE = cd->eccPointDoubleParams.domain->opSize;
+    cmd.s.OPSIZE = req->eccPointDoubleParams.domain->opSize;
     cmd.s.CALCR2 = 1;
     BA414E__PKCONFIGbits cfg = {{0}};
     cfg.s.OPPTRA = BA414E_ECCP_SLOT_P1X;
@@ -724,31 +569,31 @@ void DRV_BA414E_PrimEccPointDouble(DRV_BA414E_ClientData * cd)
     PKCONFIG = cfg.v;
     PKCOMMAND = cmd.v;
     
-    DRV_BA414E_copyToScm4(cd->eccPointDoubleParams.domain->primeField, len, BA414E_ECCP_SLOT_P, 0, 0, 0);    
-    DRV_BA414E_copyToScm4(cd->eccPointDoubleParams.domain->order, len, BA414E_ECCP_SLOT_N, 0, 0, 0);    
-    DRV_BA414E_copyToScm4(cd->eccPointDoubleParams.domain->generatorX, len, BA414E_ECCP_SLOT_GX, 0, 0, 0);    
-    DRV_BA414E_copyToScm4(cd->eccPointDoubleParams.domain->generatorY, len, BA414E_ECCP_SLOT_GY, 0, 0, 0);    
-    DRV_BA414E_copyToScm4(cd->eccPointDoubleParams.domain->a, len, BA414E_ECCP_SLOT_A, 0, 0, 0);    
-    DRV_BA414E_copyToScm4(cd->eccPointDoubleParams.domain->b, len, BA414E_ECCP_SLOT_B, 0, 0, 0);    
+    DRV_BA414E_copyToScm4(req->eccPointDoubleParams.domain->primeField, len, BA414E_ECCP_SLOT_P, 0, 0, 0);    
+    DRV_BA414E_copyToScm4(req->eccPointDoubleParams.domain->order, len, BA414E_ECCP_SLOT_N, 0, 0, 0);    
+    DRV_BA414E_copyToScm4(req->eccPointDoubleParams.domain->generatorX, len, BA414E_ECCP_SLOT_GX, 0, 0, 0);    
+    DRV_BA414E_copyToScm4(req->eccPointDoubleParams.domain->generatorY, len, BA414E_ECCP_SLOT_GY, 0, 0, 0);    
+    DRV_BA414E_copyToScm4(req->eccPointDoubleParams.domain->a, len, BA414E_ECCP_SLOT_A, 0, 0, 0);    
+    DRV_BA414E_copyToScm4(req->eccPointDoubleParams.domain->b, len, BA414E_ECCP_SLOT_B, 0, 0, 0);    
     
-    DRV_BA414E_copyToScm4(cd->eccPointDoubleParams.p1X, len, BA414E_ECCP_SLOT_P1X, 0, 0, 0);    
-    DRV_BA414E_copyToScm4(cd->eccPointDoubleParams.p1Y, len, BA414E_ECCP_SLOT_P1Y, 0, 0, 0);    
+    DRV_BA414E_copyToScm4(req->eccPointDoubleParams.p1X, len, BA414E_ECCP_SLOT_P1X, 0, 0, 0);    
+    DRV_BA414E_copyToScm4(req->eccPointDoubleParams.p1Y, len, BA414E_ECCP_SLOT_P1Y, 0, 0, 0);    
     
-    opData.doneInterrupt = 0;
-    opData.errorInterrupt = 0;    
+    hwData.doneInterrupt = 0;
+    hwData.errorInterrupt = 0;    
     SYS_INT_SourceEnable(INT_SOURCE_CRYPTO1_FAULT);
     SYS_INT_SourceEnable(INT_SOURCE_CRYPTO1);    
     PKCONTROL = 1;    
 }
 
-void DRV_BA414E_PrimEccPointAddition(DRV_BA414E_ClientData * cd)
+void DRV_BA414E_PrimEccPointAddition(const DRV_BA414E_JOB_REQUEST * req)
 {
-    uint32_t len = cd->eccPointDoubleParams.domain->keySize;
+    uint32_t len = req->eccPointDoubleParams.domain->keySize;
 
     DRV_BA414E_scmClear();
     BA414E_PKCOMMANDbits cmd = {{0}};
     cmd.s.OPERATION = BA414E_OPC_PRIM_ECC_POINT_ADDITION;
-    cmd.s.OPSIZE = cd->eccPointAdditionParams.domain->opSize;
+    cmd.s.OPSIZE = req->eccPointAdditionParams.domain->opSize;
     cmd.s.CALCR2 = 1;
     BA414E__PKCONFIGbits cfg = {{0}};
     cfg.s.OPPTRA = BA414E_ECCP_SLOT_P1X;
@@ -757,33 +602,33 @@ void DRV_BA414E_PrimEccPointAddition(DRV_BA414E_ClientData * cd)
     PKCONFIG = cfg.v;
     PKCOMMAND = cmd.v;
     
-    DRV_BA414E_copyToScm4(cd->eccPointAdditionParams.domain->primeField, len, BA414E_ECCP_SLOT_P, 0, 0, 0);    
-    DRV_BA414E_copyToScm4(cd->eccPointAdditionParams.domain->order, len, BA414E_ECCP_SLOT_N, 0, 0, 0);    
-    DRV_BA414E_copyToScm4(cd->eccPointAdditionParams.domain->generatorX, len, BA414E_ECCP_SLOT_GX, 0, 0, 0);    
-    DRV_BA414E_copyToScm4(cd->eccPointAdditionParams.domain->generatorY, len, BA414E_ECCP_SLOT_GY, 0, 0, 0);    
-    DRV_BA414E_copyToScm4(cd->eccPointAdditionParams.domain->a, len, BA414E_ECCP_SLOT_A, 0, 0, 0);    
-    DRV_BA414E_copyToScm4(cd->eccPointAdditionParams.domain->b, len, BA414E_ECCP_SLOT_B, 0, 0, 0);    
+    DRV_BA414E_copyToScm4(req->eccPointAdditionParams.domain->primeField, len, BA414E_ECCP_SLOT_P, 0, 0, 0);    
+    DRV_BA414E_copyToScm4(req->eccPointAdditionParams.domain->order, len, BA414E_ECCP_SLOT_N, 0, 0, 0);    
+    DRV_BA414E_copyToScm4(req->eccPointAdditionParams.domain->generatorX, len, BA414E_ECCP_SLOT_GX, 0, 0, 0);    
+    DRV_BA414E_copyToScm4(req->eccPointAdditionParams.domain->generatorY, len, BA414E_ECCP_SLOT_GY, 0, 0, 0);    
+    DRV_BA414E_copyToScm4(req->eccPointAdditionParams.domain->a, len, BA414E_ECCP_SLOT_A, 0, 0, 0);    
+    DRV_BA414E_copyToScm4(req->eccPointAdditionParams.domain->b, len, BA414E_ECCP_SLOT_B, 0, 0, 0);    
     
-    DRV_BA414E_copyToScm4(cd->eccPointAdditionParams.p1X, len, BA414E_ECCP_SLOT_P1X, 0, 0, 0);    
-    DRV_BA414E_copyToScm4(cd->eccPointAdditionParams.p1Y, len, BA414E_ECCP_SLOT_P1Y, 0, 0, 0);    
-    DRV_BA414E_copyToScm4(cd->eccPointAdditionParams.p2X, len, BA414E_ECCP_SLOT_P2X, 0, 0, 0);    
-    DRV_BA414E_copyToScm4(cd->eccPointAdditionParams.p2Y, len, BA414E_ECCP_SLOT_P2Y, 0, 0, 0);    
+    DRV_BA414E_copyToScm4(req->eccPointAdditionParams.p1X, len, BA414E_ECCP_SLOT_P1X, 0, 0, 0);    
+    DRV_BA414E_copyToScm4(req->eccPointAdditionParams.p1Y, len, BA414E_ECCP_SLOT_P1Y, 0, 0, 0);    
+    DRV_BA414E_copyToScm4(req->eccPointAdditionParams.p2X, len, BA414E_ECCP_SLOT_P2X, 0, 0, 0);    
+    DRV_BA414E_copyToScm4(req->eccPointAdditionParams.p2Y, len, BA414E_ECCP_SLOT_P2Y, 0, 0, 0);    
     
-    opData.doneInterrupt = 0;
-    opData.errorInterrupt = 0;    
+    hwData.doneInterrupt = 0;
+    hwData.errorInterrupt = 0;    
     SYS_INT_SourceEnable(INT_SOURCE_CRYPTO1_FAULT);
     SYS_INT_SourceEnable(INT_SOURCE_CRYPTO1);    
     PKCONTROL = 1;    
 }
 
-void DRV_BA414E_PrimEccPointMultiplication(DRV_BA414E_ClientData * cd)
+void DRV_BA414E_PrimEccPointMultiplication(const DRV_BA414E_JOB_REQUEST * req)
 {
-    uint32_t len = cd->eccPointDoubleParams.domain->keySize;
+    uint32_t len = req->eccPointDoubleParams.domain->keySize;
 
     DRV_BA414E_scmClear();
     BA414E_PKCOMMANDbits cmd = {{0}};
     cmd.s.OPERATION = BA414E_OPC_PRIM_ECC_POINT_MULTI;
-    cmd.s.OPSIZE = cd->eccPointAdditionParams.domain->opSize;
+    cmd.s.OPSIZE = req->eccPointAdditionParams.domain->opSize;
     cmd.s.CALCR2 = 1;
     BA414E__PKCONFIGbits cfg = {{0}};
     cfg.s.OPPTRA = BA414E_ECCP_SLOT_P1X;
@@ -792,64 +637,64 @@ void DRV_BA414E_PrimEccPointMultiplication(DRV_BA414E_ClientData * cd)
     PKCONFIG = cfg.v;
     PKCOMMAND = cmd.v;
     
-    DRV_BA414E_copyToScm4(cd->eccPointMultiplicationParams.domain->primeField, len, BA414E_ECCP_SLOT_P, 0, 0, 0);    
-    DRV_BA414E_copyToScm4(cd->eccPointMultiplicationParams.domain->order, len, BA414E_ECCP_SLOT_N, 0, 0, 0);    
-    DRV_BA414E_copyToScm4(cd->eccPointMultiplicationParams.domain->generatorX, len, BA414E_ECCP_SLOT_GX, 0, 0, 0);    
-    DRV_BA414E_copyToScm4(cd->eccPointMultiplicationParams.domain->generatorY, len, BA414E_ECCP_SLOT_GY, 0, 0, 0);    
-    DRV_BA414E_copyToScm4(cd->eccPointMultiplicationParams.domain->a, len, BA414E_ECCP_SLOT_A, 0, 0, 0);    
-    DRV_BA414E_copyToScm4(cd->eccPointMultiplicationParams.domain->b, len, BA414E_ECCP_SLOT_B, 0, 0, 0);    
+    DRV_BA414E_copyToScm4(req->eccPointMultiplicationParams.domain->primeField, len, BA414E_ECCP_SLOT_P, 0, 0, 0);    
+    DRV_BA414E_copyToScm4(req->eccPointMultiplicationParams.domain->order, len, BA414E_ECCP_SLOT_N, 0, 0, 0);    
+    DRV_BA414E_copyToScm4(req->eccPointMultiplicationParams.domain->generatorX, len, BA414E_ECCP_SLOT_GX, 0, 0, 0);    
+    DRV_BA414E_copyToScm4(req->eccPointMultiplicationParams.domain->generatorY, len, BA414E_ECCP_SLOT_GY, 0, 0, 0);    
+    DRV_BA414E_copyToScm4(req->eccPointMultiplicationParams.domain->a, len, BA414E_ECCP_SLOT_A, 0, 0, 0);    
+    DRV_BA414E_copyToScm4(req->eccPointMultiplicationParams.domain->b, len, BA414E_ECCP_SLOT_B, 0, 0, 0);    
     
-    DRV_BA414E_copyToScm4(cd->eccPointMultiplicationParams.p1X, len, BA414E_ECCP_SLOT_P1X, 0, 0, 0);    
-    DRV_BA414E_copyToScm4(cd->eccPointMultiplicationParams.p1Y, len, BA414E_ECCP_SLOT_P1Y, 0, 0, 0);    
-    DRV_BA414E_copyToScm4(cd->eccPointMultiplicationParams.k, len, BA414E_ECCP_SLOT_K, 0, 0, 0);    
+    DRV_BA414E_copyToScm4(req->eccPointMultiplicationParams.p1X, len, BA414E_ECCP_SLOT_P1X, 0, 0, 0);    
+    DRV_BA414E_copyToScm4(req->eccPointMultiplicationParams.p1Y, len, BA414E_ECCP_SLOT_P1Y, 0, 0, 0);    
+    DRV_BA414E_copyToScm4(req->eccPointMultiplicationParams.k, len, BA414E_ECCP_SLOT_K, 0, 0, 0);    
     
-    opData.doneInterrupt = 0;
-    opData.errorInterrupt = 0;    
+    hwData.doneInterrupt = 0;
+    hwData.errorInterrupt = 0;    
     SYS_INT_SourceEnable(INT_SOURCE_CRYPTO1_FAULT);
     SYS_INT_SourceEnable(INT_SOURCE_CRYPTO1);    
     PKCONTROL = 1;    
 }
 
 
-void DRV_BA414E_PrimEccCheckPointOnCurve(DRV_BA414E_ClientData * cd)
+void DRV_BA414E_PrimEccCheckPointOnCurve(const DRV_BA414E_JOB_REQUEST * req)
 {
-    uint32_t len = cd->eccPointDoubleParams.domain->keySize;
+    uint32_t len = req->eccPointDoubleParams.domain->keySize;
 
     DRV_BA414E_scmClear();
     BA414E_PKCOMMANDbits cmd = {{0}};
     cmd.s.OPERATION = BA414E_OPC_PRIM_ECC_POINT_CHECK_POINT_ON_CURVE;
-    cmd.s.OPSIZE = cd->eccPointAdditionParams.domain->opSize;
+    cmd.s.OPSIZE = req->eccPointAdditionParams.domain->opSize;
     cmd.s.CALCR2 = 1;
     BA414E__PKCONFIGbits cfg = {{0}};
     cfg.s.OPPTRA = BA414E_ECCP_SLOT_P1X;
     PKCONFIG = cfg.v;
     PKCOMMAND = cmd.v;
     
-    DRV_BA414E_copyToScm4(cd->eccCheckPointOnCurveParams.domain->primeField, len, BA414E_ECCP_SLOT_P, 0, 0, 0);    
-    DRV_BA414E_copyToScm4(cd->eccCheckPointOnCurveParams.domain->order, len, BA414E_ECCP_SLOT_N, 0, 0, 0);    
-    DRV_BA414E_copyToScm4(cd->eccCheckPointOnCurveParams.domain->generatorX, len, BA414E_ECCP_SLOT_GX, 0, 0, 0);    
-    DRV_BA414E_copyToScm4(cd->eccCheckPointOnCurveParams.domain->generatorY, len, BA414E_ECCP_SLOT_GY, 0, 0, 0);    
-    DRV_BA414E_copyToScm4(cd->eccCheckPointOnCurveParams.domain->a, len, BA414E_ECCP_SLOT_A, 0, 0, 0);    
-    DRV_BA414E_copyToScm4(cd->eccCheckPointOnCurveParams.domain->b, len, BA414E_ECCP_SLOT_B, 0, 0, 0);    
+    DRV_BA414E_copyToScm4(req->eccCheckPointOnCurveParams.domain->primeField, len, BA414E_ECCP_SLOT_P, 0, 0, 0);    
+    DRV_BA414E_copyToScm4(req->eccCheckPointOnCurveParams.domain->order, len, BA414E_ECCP_SLOT_N, 0, 0, 0);    
+    DRV_BA414E_copyToScm4(req->eccCheckPointOnCurveParams.domain->generatorX, len, BA414E_ECCP_SLOT_GX, 0, 0, 0);    
+    DRV_BA414E_copyToScm4(req->eccCheckPointOnCurveParams.domain->generatorY, len, BA414E_ECCP_SLOT_GY, 0, 0, 0);    
+    DRV_BA414E_copyToScm4(req->eccCheckPointOnCurveParams.domain->a, len, BA414E_ECCP_SLOT_A, 0, 0, 0);    
+    DRV_BA414E_copyToScm4(req->eccCheckPointOnCurveParams.domain->b, len, BA414E_ECCP_SLOT_B, 0, 0, 0);    
     
-    DRV_BA414E_copyToScm4(cd->eccCheckPointOnCurveParams.p1X, len, BA414E_ECCP_SLOT_P1X, 0, 0, 0);    
-    DRV_BA414E_copyToScm4(cd->eccCheckPointOnCurveParams.p1Y, len, BA414E_ECCP_SLOT_P1Y, 0, 0, 0);    
+    DRV_BA414E_copyToScm4(req->eccCheckPointOnCurveParams.p1X, len, BA414E_ECCP_SLOT_P1X, 0, 0, 0);    
+    DRV_BA414E_copyToScm4(req->eccCheckPointOnCurveParams.p1Y, len, BA414E_ECCP_SLOT_P1Y, 0, 0, 0);    
     
-    opData.doneInterrupt = 0;
-    opData.errorInterrupt = 0;    
+    hwData.doneInterrupt = 0;
+    hwData.errorInterrupt = 0;    
     SYS_INT_SourceEnable(INT_SOURCE_CRYPTO1_FAULT);
     SYS_INT_SourceEnable(INT_SOURCE_CRYPTO1);    
     PKCONTROL = 1;    
 }
 
-void DRV_BA414E_PrimModAddition(DRV_BA414E_ClientData * cd, BA414E_OP_CODES op)
+void DRV_BA414E_PrimModAddition(const DRV_BA414E_JOB_REQUEST * req, BA414E_OP_CODES op)
 {
-    uint32_t len = cd->modOperationParams.opSize * 8;
+    uint32_t len = req->modOperationParams.opSize * 8;
 
     DRV_BA414E_scmClear();
     BA414E_PKCOMMANDbits cmd = {{0}};
     cmd.s.OPERATION = op;
-    cmd.s.OPSIZE = cd->modOperationParams.opSize;
+    cmd.s.OPSIZE = req->modOperationParams.opSize;
     cmd.s.CALCR2 = 1;
     BA414E__PKCONFIGbits cfg = {{0}};
     cfg.s.OPPTRA = BA414E_MODP_SLOT_A;
@@ -857,21 +702,21 @@ void DRV_BA414E_PrimModAddition(DRV_BA414E_ClientData * cd, BA414E_OP_CODES op)
     cfg.s.OPPTRC = BA414E_MODP_SLOT_C;
     PKCONFIG = cfg.v;
     PKCOMMAND = cmd.v;
-    DRV_BA414E_copyToScm4(cd->modOperationParams.p, len, BA414E_MODP_SLOT_P, 0, 0, 0);    
-    DRV_BA414E_copyToScm4(cd->modOperationParams.a, len, BA414E_MODP_SLOT_A, 0, 0, 0);    
-    DRV_BA414E_copyToScm4(cd->modOperationParams.b, len, BA414E_MODP_SLOT_B, 0, 0, 0);    
+    DRV_BA414E_copyToScm4(req->modOperationParams.p, len, BA414E_MODP_SLOT_P, 0, 0, 0);    
+    DRV_BA414E_copyToScm4(req->modOperationParams.a, len, BA414E_MODP_SLOT_A, 0, 0, 0);    
+    DRV_BA414E_copyToScm4(req->modOperationParams.b, len, BA414E_MODP_SLOT_B, 0, 0, 0);    
 
     DRV_BA414E_StartOp();
 }
 
-void DRV_BA414E_PrimModExp(DRV_BA414E_ClientData * cd)
+void DRV_BA414E_PrimModExp(const DRV_BA414E_JOB_REQUEST * req)
 {
-    uint32_t len = cd->modExpParams.opSize * 8;
+    uint32_t len = req->modExpParams.opSize * 8;
 
     DRV_BA414E_scmClear();
     BA414E_PKCOMMANDbits cmd = {{0}};
     cmd.s.OPERATION = BA414E_OPC_RSA_MOD_EXP;
-    cmd.s.OPSIZE = cd->modExpParams.opSize;
+    cmd.s.OPSIZE = req->modExpParams.opSize;
     cmd.s.CALCR2 = 1;
     BA414E__PKCONFIGbits cfg = {{0}};
     cfg.s.OPPTRA = BA414E_RSA_MODEXP_M;
@@ -880,852 +725,275 @@ void DRV_BA414E_PrimModExp(DRV_BA414E_ClientData * cd)
     PKCONFIG = cfg.v;
     PKCOMMAND = cmd.v;
     
-    DRV_BA414E_copyToScm4(cd->modExpParams.n, len, BA414E_RSA_MODEXP_n, 0, 0, 0);    
-    DRV_BA414E_copyToScm4(cd->modExpParams.M, len, BA414E_RSA_MODEXP_M, 0, 0, 0);    
-    DRV_BA414E_copyToScm4(cd->modExpParams.e, len, BA414E_RSA_MODEXP_e, 0, 0, 0);    
+    DRV_BA414E_copyToScm4(req->modExpParams.n, len, BA414E_RSA_MODEXP_n, 0, 0, 0);    
+    DRV_BA414E_copyToScm4(req->modExpParams.M, len, BA414E_RSA_MODEXP_M, 0, 0, 0);    
+    DRV_BA414E_copyToScm4(req->modExpParams.e, len, BA414E_RSA_MODEXP_e, 0, 0, 0);    
     
     DRV_BA414E_StartOp();   
 }
 
 
-void DRV_BA414E_Prepare(DRV_BA414E_ClientData * cd)
+void DRV_BA414E_BackendStart(const DRV_BA414E_JOB_REQUEST * req)
 {
     PKCONTROL = 0;   
     SYS_INT_SourceDisable(INT_SOURCE_CRYPTO1);
     SYS_INT_SourceDisable(INT_SOURCE_CRYPTO1_FAULT);
     SYS_INT_SourceStatusClear(INT_SOURCE_CRYPTO1);
     SYS_INT_SourceStatusClear(INT_SOURCE_CRYPTO1_FAULT);
-    opData.doneInterrupt = 0;
-    opData.errorInterrupt = 0;    
-    switch(cd->currentOp)
+    hwData.doneInterrupt = 0;
+    hwData.errorInterrupt = 0;    
+    switch(req->operation)
     {
         case DRV_BA414E_OP_ECDSA_SIGN:
-            DRV_BA414E_PrepareEcdsaSign(cd);
+            DRV_BA414E_PrepareEcdsaSign(req);
             break;            
         case DRV_BA414E_OP_ECDSA_VERIFY:
-            DRV_BA414E_PrepareEcdsaVerify(cd);
+            DRV_BA414E_PrepareEcdsaVerify(req);
             break;            
         case DRV_BA414E_OP_PRIM_ECC_POINT_DOUBLE:
-            DRV_BA414E_PrimEccPointDouble(cd);
+            DRV_BA414E_PrimEccPointDouble(req);
             break;            
         case DRV_BA414E_OP_PRIM_ECC_POINT_ADDITION:
-            DRV_BA414E_PrimEccPointAddition(cd);
+            DRV_BA414E_PrimEccPointAddition(req);
             break;            
         case DRV_BA414E_OP_PRIM_ECC_POINT_MULTIPLICATION:
-            DRV_BA414E_PrimEccPointMultiplication(cd);
+            DRV_BA414E_PrimEccPointMultiplication(req);
             break;            
         case DRV_BA414E_OP_PRIM_ECC_CHECK_POINT_ON_CURVE:
-            DRV_BA414E_PrimEccCheckPointOnCurve(cd);
+            DRV_BA414E_PrimEccCheckPointOnCurve(req);
             break;            
         case DRV_BA414E_OP_PRIM_MOD_ADDITION:
-            DRV_BA414E_PrimModAddition(cd, BA414E_OPC_PRIM_MOD_ADD);
+            DRV_BA414E_PrimModAddition(req, BA414E_OPC_PRIM_MOD_ADD);
             break;            
         case DRV_BA414E_OP_PRIM_MOD_SUBTRACTION:
-            DRV_BA414E_PrimModAddition(cd, BA414E_OPC_PRIM_MOD_SUB);
+            DRV_BA414E_PrimModAddition(req, BA414E_OPC_PRIM_MOD_SUB);
             break;            
         case DRV_BA414E_OP_PRIM_MOD_MULTIPLICATION:
-            DRV_BA414E_PrimModAddition(cd, BA414E_OPC_PRIM_MOD_MULT);
+            DRV_BA414E_PrimModAddition(req, BA414E_OPC_PRIM_MOD_MULT);
             break;
         case DRV_BA414E_OP_PRIM_MOD_EXP:
-            DRV_BA414E_PrimModExp(cd);
+            DRV_BA414E_PrimModExp(req);
             break;
         case DRV_BA414E_OP_NONE:
         default:
             break;
     }
 }
-void DRV_BA414E_ProcessEcdsaSign(DRV_BA414E_ClientData * cd)
+DRV_BA414E_OP_RESULT DRV_BA414E_ProcessEcdsaSign(const DRV_BA414E_JOB_REQUEST * req)
 {
+    DRV_BA414E_OP_RESULT ret = DRV_BA414E_OP_ERROR;
     BA414E__PKSTATUSbits currentStatus;
-    uint32_t len = cd->ecdsaSignParams.domain->keySize;
-    currentStatus.v = opData.lastStatus;
+    uint32_t len = req->ecdsaSignParams.domain->keySize;
+    currentStatus.v = hwData.lastStatus;
     
-    cd->currentOp = DRV_BA414E_OP_NONE;
-    if ((opData.errorInterrupt == 1) || (currentStatus.s.SIGINVAL == 1))
+    if ((hwData.errorInterrupt == 1) || (currentStatus.s.SIGINVAL == 1))
     {
-        if (cd->callback != 0)
-        {            
-            (cd->callback)(DRV_BA414E_OP_ERROR, cd->context);
-        }
+        ret = DRV_BA414E_OP_ERROR;
     }
-    else if (opData.doneInterrupt == 1)
+    else if (hwData.doneInterrupt == 1)
     {
-        DRV_BA414E_copyFromScm2(cd->ecdsaSignParams.R, len, BA414E_ECDSA_SLOT_R, 0, 0, 0);
-        DRV_BA414E_copyFromScm2(cd->ecdsaSignParams.S, len, BA414E_ECDSA_SLOT_S, 0, 0, 0);
+        DRV_BA414E_copyFromScm2(req->ecdsaSignParams.R, len, BA414E_ECDSA_SLOT_R, 0, 0, 0);
+        DRV_BA414E_copyFromScm2(req->ecdsaSignParams.S, len, BA414E_ECDSA_SLOT_S, 0, 0, 0);
         
-        if (cd->callback != 0)
-        {            
-            (cd->callback)(DRV_BA414E_OP_SUCCESS, cd->context);
-        }
+        ret = DRV_BA414E_OP_SUCCESS;
     }
+    return ret;
 }
 
-void DRV_BA414E_ProcessEcdsaVerify(DRV_BA414E_ClientData * cd)
+DRV_BA414E_OP_RESULT DRV_BA414E_ProcessEcdsaVerify(const DRV_BA414E_JOB_REQUEST * req)
 {
+    DRV_BA414E_OP_RESULT ret = DRV_BA414E_OP_ERROR;
     BA414E__PKSTATUSbits currentStatus;
-    currentStatus.v = opData.lastStatus;
+    currentStatus.v = hwData.lastStatus;
     
-    cd->currentOp = DRV_BA414E_OP_NONE;
     if ((currentStatus.s.SIGINVAL == 1))
     {
-        if (cd->callback != 0)
-        {            
-            (cd->callback)(DRV_BA414E_OP_SIGN_VERIFY_FAIL, cd->context);
-        }        
+        ret = DRV_BA414E_OP_SIGN_VERIFY_FAIL;
     }
-    else if ((opData.errorInterrupt == 1))
+    else if ((hwData.errorInterrupt == 1))
     {
-        if (cd->callback != 0)
-        {            
-            (cd->callback)(DRV_BA414E_OP_ERROR, cd->context);
-        }
+        ret = DRV_BA414E_OP_ERROR;
     }
-    else if (opData.doneInterrupt == 1)
+    else if (hwData.doneInterrupt == 1)
     {
-        if (cd->callback != 0)
-        {            
-            (cd->callback)(DRV_BA414E_OP_SUCCESS, cd->context);
-        }
+        ret = DRV_BA414E_OP_SUCCESS;
     }
+    return ret;
 }
 
-void DRV_BA414E_ProcessPrimEccPointDouble(DRV_BA414E_ClientData * cd)
+DRV_BA414E_OP_RESULT DRV_BA414E_ProcessPrimEccPointDouble(const DRV_BA414E_JOB_REQUEST * req)
 {
+    DRV_BA414E_OP_RESULT ret = DRV_BA414E_OP_ERROR;
 
     BA414E__PKSTATUSbits currentStatus;
-    currentStatus.v = opData.lastStatus;
-    uint32_t len = cd->eccPointDoubleParams.domain->keySize;
+    currentStatus.v = hwData.lastStatus;
+    uint32_t len = req->eccPointDoubleParams.domain->keySize;
     
-    cd->currentOp = DRV_BA414E_OP_NONE;
-    if ((opData.errorInterrupt == 1))
+    if ((hwData.errorInterrupt == 1))
     {
-        DRV_BA414E_OP_RESULT opRes = (currentStatus.s.PXINF == 0) ? DRV_BA414E_OP_ERROR : DRV_BA414E_OP_ERROR_POINT_AT_INFINITY;
-        if (cd->callback != 0)
-        {            
-            (cd->callback)(opRes, cd->context);
-        }
+        ret = (currentStatus.s.PXINF == 0) ? DRV_BA414E_OP_ERROR : DRV_BA414E_OP_ERROR_POINT_AT_INFINITY;
     }
-    else if (opData.doneInterrupt == 1)
+    else if (hwData.doneInterrupt == 1)
     {
-        DRV_BA414E_OP_RESULT opRes = (currentStatus.s.PXINF == 0) ? DRV_BA414E_OP_SUCCESS : DRV_BA414E_OP_POINT_AT_INFINITY;
-        DRV_BA414E_copyFromScm2(cd->eccPointDoubleParams.outX, len, BA414E_ECCP_SLOT_P3X, 0, 0, 0);
-        DRV_BA414E_copyFromScm2(cd->eccPointDoubleParams.outY, len, BA414E_ECCP_SLOT_P3Y, 0, 0, 0);
-        
-        if (cd->callback != 0)
-        {            
-            (cd->callback)(opRes, cd->context);
-        }
-    }  
+        ret = (currentStatus.s.PXINF == 0) ? DRV_BA414E_OP_SUCCESS : DRV_BA414E_OP_POINT_AT_INFINITY;
+        DRV_BA414E_copyFromScm2(req->eccPointDoubleParams.outX, len, BA414E_ECCP_SLOT_P3X, 0, 0, 0);
+        DRV_BA414E_copyFromScm2(req->eccPointDoubleParams.outY, len, BA414E_ECCP_SLOT_P3Y, 0, 0, 0);
+    }
+    return ret;
 }
 
-void DRV_BA414E_ProcessPrimEccPointAddition(DRV_BA414E_ClientData * cd)
+DRV_BA414E_OP_RESULT DRV_BA414E_ProcessPrimEccPointAddition(const DRV_BA414E_JOB_REQUEST * req)
 {
+    DRV_BA414E_OP_RESULT ret = DRV_BA414E_OP_ERROR;
 
-    uint32_t len = cd->eccPointAdditionParams.domain->keySize;
+    uint32_t len = req->eccPointAdditionParams.domain->keySize;
     BA414E__PKSTATUSbits currentStatus;
-    currentStatus.v = opData.lastStatus;
+    currentStatus.v = hwData.lastStatus;
     
-    cd->currentOp = DRV_BA414E_OP_NONE;
-    if ((opData.errorInterrupt == 1))
+    if ((hwData.errorInterrupt == 1))
     {
-        DRV_BA414E_OP_RESULT opRes = (currentStatus.s.PXINF == 0) ? DRV_BA414E_OP_ERROR : DRV_BA414E_OP_ERROR_POINT_AT_INFINITY;
-        if (cd->callback != 0)
-        {            
-            (cd->callback)(opRes, cd->context);
-        }
+        ret = (currentStatus.s.PXINF == 0) ? DRV_BA414E_OP_ERROR : DRV_BA414E_OP_ERROR_POINT_AT_INFINITY;
     }
-    else if (opData.doneInterrupt == 1)
+    else if (hwData.doneInterrupt == 1)
     {
-        DRV_BA414E_OP_RESULT opRes = (currentStatus.s.PXINF == 0) ? DRV_BA414E_OP_SUCCESS : DRV_BA414E_OP_POINT_AT_INFINITY;
-        DRV_BA414E_copyFromScm2(cd->eccPointAdditionParams.outX, len, BA414E_ECCP_SLOT_P3X, 0, 0, 0);
-        DRV_BA414E_copyFromScm2(cd->eccPointAdditionParams.outY, len, BA414E_ECCP_SLOT_P3Y, 0, 0, 0);
-        
-        if (cd->callback != 0)
-        {            
-            (cd->callback)(opRes, cd->context);
-        }
-    }  
+        ret = (currentStatus.s.PXINF == 0) ? DRV_BA414E_OP_SUCCESS : DRV_BA414E_OP_POINT_AT_INFINITY;
+        DRV_BA414E_copyFromScm2(req->eccPointAdditionParams.outX, len, BA414E_ECCP_SLOT_P3X, 0, 0, 0);
+        DRV_BA414E_copyFromScm2(req->eccPointAdditionParams.outY, len, BA414E_ECCP_SLOT_P3Y, 0, 0, 0);
+    }
+    return ret;
 }
 
-void DRV_BA414E_ProcessPrimEccPointMultiplication(DRV_BA414E_ClientData * cd)
+DRV_BA414E_OP_RESULT DRV_BA414E_ProcessPrimEccPointMultiplication(const DRV_BA414E_JOB_REQUEST * req)
 {
+    DRV_BA414E_OP_RESULT ret = DRV_BA414E_OP_ERROR;
 
-    uint32_t len = cd->eccPointMultiplicationParams.domain->keySize;
+    uint32_t len = req->eccPointMultiplicationParams.domain->keySize;
     BA414E__PKSTATUSbits currentStatus;
-    currentStatus.v = opData.lastStatus;
+    currentStatus.v = hwData.lastStatus;
     
-    cd->currentOp = DRV_BA414E_OP_NONE;
-    if ((opData.errorInterrupt == 1))
+    if ((hwData.errorInterrupt == 1))
     {
         BA414E__PKSTATUSbits currentStatus;
-        currentStatus.v = opData.lastStatus;
-        DRV_BA414E_OP_RESULT opRes = (currentStatus.s.PXINF == 0) ? DRV_BA414E_OP_ERROR : DRV_BA414E_OP_ERROR_POINT_AT_INFINITY;
-        if (cd->callback != 0)
-        {            
-            (cd->callback)(opRes, cd->context);
-        }
+        currentStatus.v = hwData.lastStatus;
+        ret = (currentStatus.s.PXINF == 0) ? DRV_BA414E_OP_ERROR : DRV_BA414E_OP_ERROR_POINT_AT_INFINITY;
     }
-    else if (opData.doneInterrupt == 1)
+    else if (hwData.doneInterrupt == 1)
     {
-        DRV_BA414E_OP_RESULT opRes = (currentStatus.s.PXINF == 0) ? DRV_BA414E_OP_SUCCESS : DRV_BA414E_OP_POINT_AT_INFINITY;
-        DRV_BA414E_copyFromScm2(cd->eccPointMultiplicationParams.outX, len, BA414E_ECCP_SLOT_P3X, 0, 0, 0);
-        DRV_BA414E_copyFromScm2(cd->eccPointMultiplicationParams.outY, len, BA414E_ECCP_SLOT_P3Y, 0, 0, 0);
-        
-        if (cd->callback != 0)
-        {            
-            (cd->callback)(opRes, cd->context);
-        }
-    }  
+        ret = (currentStatus.s.PXINF == 0) ? DRV_BA414E_OP_SUCCESS : DRV_BA414E_OP_POINT_AT_INFINITY;
+        DRV_BA414E_copyFromScm2(req->eccPointMultiplicationParams.outX, len, BA414E_ECCP_SLOT_P3X, 0, 0, 0);
+        DRV_BA414E_copyFromScm2(req->eccPointMultiplicationParams.outY, len, BA414E_ECCP_SLOT_P3Y, 0, 0, 0);
+    }
+    return ret;
 }
 
-void DRV_BA414E_ProcessEccCheckPointOnCurve(DRV_BA414E_ClientData * cd)
+DRV_BA414E_OP_RESULT DRV_BA414E_ProcessEccCheckPointOnCurve(const DRV_BA414E_JOB_REQUEST * req)
 {
+    DRV_BA414E_OP_RESULT ret = DRV_BA414E_OP_ERROR;
     BA414E__PKSTATUSbits currentStatus;
-    currentStatus.v = opData.lastStatus;
+    currentStatus.v = hwData.lastStatus;
     
-    cd->currentOp = DRV_BA414E_OP_NONE;
     if ((currentStatus.s.PXNOC == 1))
     {
-        if (cd->callback != 0)
-        {            
-            (cd->callback)(DRV_BA414E_OP_POINT_NOT_ON_CURVE, cd->context);
-        }        
+        ret = DRV_BA414E_OP_POINT_NOT_ON_CURVE;
     }
-    else if ((opData.errorInterrupt == 1))
+    else if ((hwData.errorInterrupt == 1))
     {
-        if (cd->callback != 0)
-        {            
-            (cd->callback)(DRV_BA414E_OP_ERROR, cd->context);
-        }
+        ret = DRV_BA414E_OP_ERROR;
     }
-    else if (opData.doneInterrupt == 1)
+    else if (hwData.doneInterrupt == 1)
     {
-        if (cd->callback != 0)
-        {            
-            (cd->callback)(DRV_BA414E_OP_SUCCESS, cd->context);
-        }
+        ret = DRV_BA414E_OP_SUCCESS;
     }
+    return ret;
 }
 
-void DRV_BA414E_ProcessPrimModOp(DRV_BA414E_ClientData * cd)
+DRV_BA414E_OP_RESULT DRV_BA414E_ProcessPrimModOp(const DRV_BA414E_JOB_REQUEST * req)
 {
+    DRV_BA414E_OP_RESULT ret = DRV_BA414E_OP_ERROR;
 
-    uint32_t len = cd->modOperationParams.opSize * 8;
+    uint32_t len = req->modOperationParams.opSize * 8;
 //     bytesToString(domain.a, domain.keySize, 4, 16);
 //    snprintf(dbgBufferPtr, debugBufferSize, "%s\r\n%s: A: \n\r%s", dbgBufferPtr, __FUNCTION__, byteString);    
-    //snprintf(dbgBufferPtr, debugBufferSize, "%s\r\n%s: PKSTATUS %08X Done %d Error %d\r\n", dbgBufferPtr, __FUNCTION__, PKSTATUS, opData.doneInterrupt, opData.errorInterrupt);
-    cd->currentOp = DRV_BA414E_OP_NONE;
-    if ((opData.errorInterrupt == 1))
+    //snprintf(dbgBufferPtr, debugBufferSize, "%s\r\n%s: PKSTATUS %08X Done %d Error %d\r\n", dbgBufferPtr, __FUNCTION__, PKSTATUS, hwData.doneInterrupt, hwData.errorInterrupt);
+    if ((hwData.errorInterrupt == 1))
     {
-        if (cd->callback != 0)
-        {            
-            (cd->callback)(DRV_BA414E_OP_ERROR, cd->context);
-        }
+        ret = DRV_BA414E_OP_ERROR;
     }
-    else if (opData.doneInterrupt == 1)
+    else if (hwData.doneInterrupt == 1)
     {
-        DRV_BA414E_copyFromScm2(cd->modOperationParams.c, len, BA414E_MODP_SLOT_C, 0, 0, 0);
+        DRV_BA414E_copyFromScm2(req->modOperationParams.c, len, BA414E_MODP_SLOT_C, 0, 0, 0);
         
-        if (cd->callback != 0)
-        {            
-            (cd->callback)(DRV_BA414E_OP_SUCCESS, cd->context);
-        }
-    }  
+        ret = DRV_BA414E_OP_SUCCESS;
+    }
+    return ret;
 }
 
-void DRV_BA414E_ProcessRsaModExp(DRV_BA414E_ClientData * cd)
+DRV_BA414E_OP_RESULT DRV_BA414E_ProcessRsaModExp(const DRV_BA414E_JOB_REQUEST * req)
 {
+    DRV_BA414E_OP_RESULT ret = DRV_BA414E_OP_ERROR;
 
-    uint32_t len = cd->modExpParams.opSize * 8;
+    uint32_t len = req->modExpParams.opSize * 8;
     
-    cd->currentOp = DRV_BA414E_OP_NONE;
-    if ((opData.errorInterrupt == 1))
+    if ((hwData.errorInterrupt == 1))
     {
-        if (cd->callback != 0)
-        {            
-            (cd->callback)(DRV_BA414E_OP_ERROR, cd->context);
-        }
+        ret = DRV_BA414E_OP_ERROR;
     }
-    else if (opData.doneInterrupt == 1)
+    else if (hwData.doneInterrupt == 1)
     {
-        DRV_BA414E_copyFromScm2(cd->modExpParams.C, len, BA414E_RSA_MODEXP_C, 0, 0, 0);
+        DRV_BA414E_copyFromScm2(req->modExpParams.C, len, BA414E_RSA_MODEXP_C, 0, 0, 0);
         
-        if (cd->callback != 0)
-        {            
-            (cd->callback)(DRV_BA414E_OP_SUCCESS, cd->context);
-        }
-    }  
+        ret = DRV_BA414E_OP_SUCCESS;
+    }
+    return ret;
 }
 
-void DRV_BA414E_Process(DRV_BA414E_ClientData * cd)
+DRV_BA414E_OP_RESULT DRV_BA414E_BackendFinish(const DRV_BA414E_JOB_REQUEST * req)
 {
+    DRV_BA414E_OP_RESULT ret = DRV_BA414E_OP_ERROR;
+
     PKCONTROL = 0;    
     SYS_INT_SourceDisable(INT_SOURCE_CRYPTO1);
     SYS_INT_SourceDisable(INT_SOURCE_CRYPTO1_FAULT);
     SYS_INT_SourceStatusClear(INT_SOURCE_CRYPTO1);
     SYS_INT_SourceStatusClear(INT_SOURCE_CRYPTO1_FAULT);
-    switch(cd->currentOp)
+    switch(req->operation)
     {
         case DRV_BA414E_OP_ECDSA_SIGN:
-            DRV_BA414E_ProcessEcdsaSign(cd);
+            ret = DRV_BA414E_ProcessEcdsaSign(req);
             break;            
         case DRV_BA414E_OP_ECDSA_VERIFY:
-            DRV_BA414E_ProcessEcdsaVerify(cd);
+            ret = DRV_BA414E_ProcessEcdsaVerify(req);
             break;
         case DRV_BA414E_OP_PRIM_ECC_POINT_DOUBLE:
-            DRV_BA414E_ProcessPrimEccPointDouble(cd);
+            ret = DRV_BA414E_ProcessPrimEccPointDouble(req);
             break;
         case DRV_BA414E_OP_PRIM_ECC_POINT_ADDITION:
-            DRV_BA414E_ProcessPrimEccPointAddition(cd);
+            ret = DRV_BA414E_ProcessPrimEccPointAddition(req);
             break;
         case DRV_BA414E_OP_PRIM_ECC_POINT_MULTIPLICATION:
-            DRV_BA414E_ProcessPrimEccPointMultiplication(cd);
+            ret = DRV_BA414E_ProcessPrimEccPointMultiplication(req);
             break;
         case DRV_BA414E_OP_PRIM_ECC_CHECK_POINT_ON_CURVE:
-            DRV_BA414E_ProcessEccCheckPointOnCurve(cd);
+            ret = DRV_BA414E_ProcessEccCheckPointOnCurve(req);
             break;
         case DRV_BA414E_OP_PRIM_MOD_ADDITION:
         case DRV_BA414E_OP_PRIM_MOD_SUBTRACTION:
         case DRV_BA414E_OP_PRIM_MOD_MULTIPLICATION:
-            DRV_BA414E_ProcessPrimModOp(cd);
+            ret = DRV_BA414E_ProcessPrimModOp(req);
             break;
         case DRV_BA414E_OP_PRIM_MOD_EXP:
-            DRV_BA414E_ProcessRsaModExp(cd);
+            ret = DRV_BA414E_ProcessRsaModExp(req);
             break;
         case DRV_BA414E_OP_NONE:
         default:
             break;
     }
-
-}
-
-void DRV_BA414E_Tasks(SYS_MODULE_OBJ obj)
-{
-    if (obj == (SYS_MODULE_OBJ)&opData)
-    {
-        switch (opData.state)
-        {
-            case DRV_BA414E_INITIALIZE:
-                DRV_BA414E_InitialStateHandler();
-                opData.state = DRV_BA414E_READY;
-                break;
-            case DRV_BA414E_READY:
-            {
-#if defined(DRV_BA414E_RTOS_STACK_SIZE)
-                OSAL_SEM_Pend(&opData.clientAction, OSAL_WAIT_FOREVER);
-#endif
-                int counter;
-                for (counter = 0; counter < DRV_BA414E_NUM_CLIENTS; counter++)
-                {
-                    if (clientData[counter].currentOp != DRV_BA414E_OP_NONE)
-                    {                        
-                        opData.state = DRV_BA414E_PREPARING;
-                        opData.currentClient = &clientData[counter];
-                        break;
-                    }
-                }
-            }
-            break;
-            case DRV_BA414E_PREPARING:
-            {
-                int counter;
-                for (counter = 0; counter < DRV_BA414E_NUM_CLIENTS; counter++)
-                {
-                    if (clientData[counter].currentOp != DRV_BA414E_OP_NONE)
-                    {
-                        opData.state = DRV_BA414E_WAITING;
-                        DRV_BA414E_Prepare(&clientData[counter]);
-                        break;
-                    }
-                }                
-            }   
-            break;
-            case DRV_BA414E_WAITING:
-#if defined(DRV_BA414E_RTOS_STACK_SIZE)
-                OSAL_SEM_Pend(&opData.wfi, OSAL_WAIT_FOREVER);
-#endif
-                if ((opData.doneInterrupt == 1) || (opData.errorInterrupt == 1))
-                {
-                    opData.state = DRV_BA414E_PROCESSING;
-                }
-                break;
-            case DRV_BA414E_PROCESSING:
-                DRV_BA414E_Process(opData.currentClient);
-                opData.state = DRV_BA414E_READY;                
-                break;
-            default:
-                break;
-        }
-    }
-}
-
-void DRV_BA414_BlockingCallback(DRV_BA414E_OP_RESULT result, uintptr_t context)
-{
-    DRV_BA414E_ClientData * cd = (DRV_BA414E_ClientData*)context;
-    cd->blockingResult = result;
-#if defined(DRV_BA414E_RTOS_STACK_SIZE)
-    OSAL_SEM_Post(&cd->clientBlock);
-#endif
-}
-
-DRV_BA414E_OP_RESULT DRV_BA414_BlockingHelper(DRV_BA414E_ClientData * cd)
-{
-    cd->context = (uintptr_t)cd;
-    cd->callback = DRV_BA414_BlockingCallback;
-#if defined(DRV_BA414E_RTOS_STACK_SIZE)
-    OSAL_SEM_Post(&opData.clientAction);
-    OSAL_SEM_Pend(&cd->clientBlock, OSAL_WAIT_FOREVER);
-#endif
-    return cd->blockingResult;
-}
-
-DRV_BA414E_OP_RESULT DRV_BA414E_ECDSA_Sign(
-    const DRV_HANDLE handle,
-    const DRV_BA414E_ECC_DOMAIN * domain,
-    uint8_t * R,
-    uint8_t * S,
-    const uint8_t * privateKey,
-    const uint8_t * k,
-    const uint8_t * msgHash,
-    int msgHashSz,
-    DRV_BA414E_CALLBACK callback,
-    uintptr_t context  
-)
-{
-    DRV_BA414E_RESULT ret = DRV_BA414E_OP_ERROR;
-    
-    if (handle != DRV_HANDLE_INVALID)    
-    {
-        DRV_BA414E_ClientData * cd = (DRV_BA414E_ClientData *)handle;
-        if (cd->currentOp == DRV_BA414E_OP_NONE)
-        {
-            memset(&cd->ecdsaSignParams, 0, sizeof(DRV_BA414E_ecdsaSignOpParams));
-            cd->ecdsaSignParams.domain = domain;
-            cd->ecdsaSignParams.R = R;
-            cd->ecdsaSignParams.S = S;
-            cd->ecdsaSignParams.privateKey = privateKey;
-            cd->ecdsaSignParams.k = k;
-            cd->ecdsaSignParams.msgHash = msgHash;
-            cd->ecdsaSignParams.msgHashSz = msgHashSz;
-            cd->currentOp = DRV_BA414E_OP_ECDSA_SIGN;
-            if ((cd->ioIntent & DRV_IO_INTENT_NONBLOCKING) == DRV_IO_INTENT_NONBLOCKING)
-            {
-                cd->callback = callback;
-                cd->context = context;
-#if defined(DRV_BA414E_RTOS_STACK_SIZE)
-                OSAL_SEM_Post(&opData.clientAction);
-#endif
-                ret = DRV_BA414E_OP_PENDING;
-            }
-            else
-            {
-                ret = DRV_BA414_BlockingHelper(cd);
-            }
-        }
-    }
-    return ret;
-}
-
-
-
-
-DRV_BA414E_OP_RESULT DRV_BA414E_ECDSA_Verify(
-    const DRV_HANDLE handle,
-    const DRV_BA414E_ECC_DOMAIN * domain,
-    const uint8_t * publicKeyX,
-    const uint8_t * publicKeyY,
-    uint8_t * R,
-    uint8_t * S,
-    const uint8_t * msgHash,
-    int msgHashSz,
-    DRV_BA414E_CALLBACK callback,
-    uintptr_t context  
-)
-{
-    DRV_BA414E_RESULT ret = DRV_BA414E_OP_ERROR;
-    
-    if (handle != DRV_HANDLE_INVALID)    
-    {
-        DRV_BA414E_ClientData * cd = (DRV_BA414E_ClientData *)handle;
-        if (cd->currentOp == DRV_BA414E_OP_NONE)
-        {
-            memset(&cd->ecdsaVerifyParams, 0, sizeof(DRV_BA414E_ecdsaVerifyOpParams));
-            cd->ecdsaVerifyParams.domain = domain;
-            cd->ecdsaVerifyParams.R = R;
-            cd->ecdsaVerifyParams.S = S;
-            cd->ecdsaVerifyParams.publicKeyX = publicKeyX;
-            cd->ecdsaVerifyParams.publicKeyY = publicKeyY;
-            cd->ecdsaVerifyParams.msgHash = msgHash;
-            cd->ecdsaVerifyParams.msgHashSz = msgHashSz;
-            cd->currentOp = DRV_BA414E_OP_ECDSA_VERIFY;
-            if ((cd->ioIntent & DRV_IO_INTENT_NONBLOCKING) == DRV_IO_INTENT_NONBLOCKING)
-            {
-                cd->callback = callback;
-                cd->context = context;
-#if defined(DRV_BA414E_RTOS_STACK_SIZE)
-                OSAL_SEM_Post(&opData.clientAction);
-#endif
-                ret = DRV_BA414E_OP_PENDING;
-            }
-            else
-            {
-                ret = DRV_BA414_BlockingHelper(cd);
-            }
-        }
-    }
     return ret;
-    
 }
 
-
-DRV_BA414E_OP_RESULT DRV_BA414E_PRIM_EccPointDouble(
-    const DRV_HANDLE handle,
-    const DRV_BA414E_ECC_DOMAIN * domain,
-    uint8_t * outX,
-    uint8_t * outY,
-    const uint8_t * p1X,
-    const uint8_t * p1Y,
-    DRV_BA414E_CALLBACK callback,
-    uintptr_t context          
-)
+bool DRV_BA414E_BackendIsDone(void)
 {
-    DRV_BA414E_RESULT ret = DRV_BA414E_OP_ERROR;
-    
-    if (handle != DRV_HANDLE_INVALID)    
-    {
-        DRV_BA414E_ClientData * cd = (DRV_BA414E_ClientData *)handle;
-        if (cd->currentOp == DRV_BA414E_OP_NONE)
-        {
-            memset(&cd->eccPointDoubleParams, 0, sizeof(DRV_BA414E_primEccPointDoubleOpParams));
-            cd->eccPointDoubleParams.domain = domain;
-            cd->eccPointDoubleParams.outX = outX;
-            cd->eccPointDoubleParams.outY = outY;
-            cd->eccPointDoubleParams.p1X = p1X;
-            cd->eccPointDoubleParams.p1Y = p1Y;
-            cd->currentOp = DRV_BA414E_OP_PRIM_ECC_POINT_DOUBLE;
-            if ((cd->ioIntent & DRV_IO_INTENT_NONBLOCKING) == DRV_IO_INTENT_NONBLOCKING)
-            {
-                cd->callback = callback;
-                cd->context = context;
-#if defined(DRV_BA414E_RTOS_STACK_SIZE)
-                OSAL_SEM_Post(&opData.clientAction);
-#endif
-                ret = DRV_BA414E_OP_PENDING;
-            }
-            else
-            {
-                ret = DRV_BA414_BlockingHelper(cd);
-            }
-        }
-    }   
-    return ret;
-
+    return (hwData.doneInterrupt == 1) || (hwData.errorInterrupt == 1);
 }
 
-DRV_BA414E_OP_RESULT DRV_BA414E_PRIM_EccPointAddition(
-    const DRV_HANDLE handle,
-    const DRV_BA414E_ECC_DOMAIN * domain,
-    uint8_t * outX,
-    uint8_t * outY,
-    const uint8_t * p1X,
-    const uint8_t * p1Y,
-    const uint8_t * p2X,
-    const uint8_t * p2Y,
-    DRV_BA414E_CALLBACK callback,
-    uintptr_t context          
-)
-{
-    DRV_BA414E_RESULT ret = DRV_BA414E_OP_ERROR;
-    
-    if (handle != DRV_HANDLE_INVALID)    
-    {
-        DRV_BA414E_ClientData * cd = (DRV_BA414E_ClientData *)handle;
-        if (cd->currentOp == DRV_BA414E_OP_NONE)
-        {
-            memset(&cd->eccPointAdditionParams, 0, sizeof(DRV_BA414E_primEccPointAdditionOpParams));
-            cd->eccPointAdditionParams.domain = domain;
-            cd->eccPointAdditionParams.outX = outX;
-            cd->eccPointAdditionParams.outY = outY;
-            cd->eccPointAdditionParams.p1X = p1X;
-            cd->eccPointAdditionParams.p1Y = p1Y;
-            cd->eccPointAdditionParams.p2X = p2X;
-            cd->eccPointAdditionParams.p2Y = p2Y;
-            cd->currentOp = DRV_BA414E_OP_PRIM_ECC_POINT_ADDITION;
-            if ((cd->ioIntent & DRV_IO_INTENT_NONBLOCKING) == DRV_IO_INTENT_NONBLOCKING)
-            {
-                cd->callback = callback;
-                cd->context = context;
-#if defined(DRV_BA414E_RTOS_STACK_SIZE)
-                OSAL_SEM_Post(&opData.clientAction);
-#endif
-                ret = DRV_BA414E_OP_PENDING;
-            }
-            else
-            {
-                ret = DRV_BA414_BlockingHelper(cd);
-            }
-        }
-    }   
-    return ret;    
-}
-
-DRV_BA414E_OP_RESULT DRV_BA414E_PRIM_EccPointMultiplication(
-    const DRV_HANDLE handle,
-    const DRV_BA414E_ECC_DOMAIN * domain,
-    uint8_t * outX,
-    uint8_t * outY,
-    const uint8_t * p1X,
-    const uint8_t * p1Y,
-    const uint8_t * k,
-    DRV_BA414E_CALLBACK callback,
-    uintptr_t context          
-)
-{
-    DRV_BA414E_RESULT ret = DRV_BA414E_OP_ERROR;
-    
-    if (handle != DRV_HANDLE_INVALID)    
-    {
-        DRV_BA414E_ClientData * cd = (DRV_BA414E_ClientData *)handle;
-        if (cd->currentOp == DRV_BA414E_OP_NONE)
-        {
-            memset(&cd->eccPointMultiplicationParams, 0, sizeof(DRV_BA414E_primEccPointMultiplicationOpParams));
-            cd->eccPointMultiplicationParams.domain = domain;
-            cd->eccPointMultiplicationParams.outX = outX;
-            cd->eccPointMultiplicationParams.outY = outY;
-            cd->eccPointMultiplicationParams.p1X = p1X;
-            cd->eccPointMultiplicationParams.p1Y = p1Y;
-            cd->eccPointMultiplicationParams.k = k;
-            cd->currentOp = DRV_BA414E_OP_PRIM_ECC_POINT_MULTIPLICATION;
-            if ((cd->ioIntent & DRV_IO_INTENT_NONBLOCKING) == DRV_IO_INTENT_NONBLOCKING)
-            {
-                cd->callback = callback;
-                cd->context = context;
-#if defined(DRV_BA414E_RTOS_STACK_SIZE)
-                OSAL_SEM_Post(&opData.clientAction);
-#endif
-                ret = DRV_BA414E_OP_PENDING;
-            }
-            else
-            {
-                ret = DRV_BA414_BlockingHelper(cd);
-            }
-        }
-    }   
-    return ret;
-    
-}
-
-DRV_BA414E_OP_RESULT DRV_BA414E_PRIM_EccCheckPointOnCurve(
-    const DRV_HANDLE handle,
-    const DRV_BA414E_ECC_DOMAIN * domain,
-    const uint8_t * p1X,
-    const uint8_t * p1Y,
-    DRV_BA414E_CALLBACK callback,
-    uintptr_t context          
-)
-{
-    DRV_BA414E_RESULT ret = DRV_BA414E_OP_ERROR;
-    
-    if (handle != DRV_HANDLE_INVALID)    
-    {
-        DRV_BA414E_ClientData * cd = (DRV_BA414E_ClientData *)handle;
-        if (cd->currentOp == DRV_BA414E_OP_NONE)
-        {
-            memset(&cd->eccCheckPointOnCurveParams, 0, sizeof(DRV_BA414E_primEccCheckPointOnCurveOpParams));
-            cd->eccCheckPointOnCurveParams.domain = domain;
-            cd->eccCheckPointOnCurveParams.p1X = p1X;
-            cd->eccCheckPointOnCurveParams.p1Y = p1Y;
-            cd->currentOp = DRV_BA414E_OP_PRIM_ECC_CHECK_POINT_ON_CURVE;
-            if ((cd->ioIntent & DRV_IO_INTENT_NONBLOCKING) == DRV_IO_INTENT_NONBLOCKING)
-            {
-                cd->callback = callback;
-                cd->context = context;
-#if defined(DRV_BA414E_RTOS_STACK_SIZE)
-                OSAL_SEM_Post(&opData.clientAction);
-#endif
-                ret = DRV_BA414E_OP_PENDING;
-            }
-            else
-            {
-                ret = DRV_BA414_BlockingHelper(cd);
-            }
-        }
-    }   
-    return ret;
-    
-}
-
-DRV_BA414E_OP_RESULT DRV_BA414E_PRIM_ModAddition(
-    const DRV_HANDLE handle,
-    DRV_BA414E_OPERAND_SIZE opSize,    // Hardware operand size
-    uint8_t * c,
-    const uint8_t * p,
-    const uint8_t * a,
-    const uint8_t * b,
-    DRV_BA414E_CALLBACK callback,
-    uintptr_t context          
-)
-{
-    DRV_BA414E_RESULT ret = DRV_BA414E_OP_ERROR;
-    
-    if (handle != DRV_HANDLE_INVALID)    
-    {
-        DRV_BA414E_ClientData * cd = (DRV_BA414E_ClientData *)handle;
-        if (cd->currentOp == DRV_BA414E_OP_NONE)
-        {
-            memset(&cd->modOperationParams, 0, sizeof(DRV_BA414E_primModOperationParams));
-            cd->modOperationParams.opSize = opSize;
-            cd->modOperationParams.c = c;
-            cd->modOperationParams.p = p;
-            cd->modOperationParams.a = a;
-            cd->modOperationParams.b = b;
-            cd->currentOp = DRV_BA414E_OP_PRIM_MOD_ADDITION;
-            if ((cd->ioIntent & DRV_IO_INTENT_NONBLOCKING) == DRV_IO_INTENT_NONBLOCKING)
-            {
-                cd->callback = callback;
-                cd->context = context;
-#if defined(DRV_BA414E_RTOS_STACK_SIZE)
-                OSAL_SEM_Post(&opData.clientAction);
-#endif
-                ret = DRV_BA414E_OP_PENDING;
-            }
-            else
-            {
-                ret = DRV_BA414_BlockingHelper(cd);
-            }
-        }
-    }   
-    return ret;
-    
-}
-
-DRV_BA414E_OP_RESULT DRV_BA414E_PRIM_ModSubtraction(
-    const DRV_HANDLE handle,
-    DRV_BA414E_OPERAND_SIZE opSize,    // Hardware operand size
-    uint8_t * c,
-    const uint8_t * p,
-    const uint8_t * a,
-    const uint8_t * b,
-    DRV_BA414E_CALLBACK callback,
-    uintptr_t context          
-)
-{
-    DRV_BA414E_RESULT ret = DRV_BA414E_OP_ERROR;
-    
-    if (handle != DRV_HANDLE_INVALID)    
-    {
-        DRV_BA414E_ClientData * cd = (DRV_BA414E_ClientData *)handle;
-        if (cd->currentOp == DRV_BA414E_OP_NONE)
-        {
-            memset(&cd->modOperationParams, 0, sizeof(DRV_BA414E_primModOperationParams));
-            cd->modOperationParams.opSize = opSize;
-            cd->modOperationParams.c = c;
-            cd->modOperationParams.p = p;
-            cd->modOperationParams.a = a;
-            cd->modOperationParams.b = b;
-            cd->currentOp = DRV_BA414E_OP_PRIM_MOD_SUBTRACTION;
-            if ((cd->ioIntent & DRV_IO_INTENT_NONBLOCKING) == DRV_IO_INTENT_NONBLOCKING)
-            {
-                cd->callback = callback;
-                cd->context = context;
-#if defined(DRV_BA414E_RTOS_STACK_SIZE)
-                OSAL_SEM_Post(&opData.clientAction);
-#endif
-                ret = DRV_BA414E_OP_PENDING;
-            }
-            else
-            {
-                ret = DRV_BA414_BlockingHelper(cd);
-            }
-        }
-    }   
-    return ret;
-    
-}
-
-DRV_BA414E_OP_RESULT DRV_BA414E_PRIM_ModMultiplication(
-    const DRV_HANDLE handle,
-    DRV_BA414E_OPERAND_SIZE opSize,    // Hardware operand size
-    uint8_t * c,
-    const uint8_t * p,
-    const uint8_t * a,
-    const uint8_t * b,
-    DRV_BA414E_CALLBACK callback,
-    uintptr_t context          
-)
-{
-    DRV_BA414E_RESULT ret = DRV_BA414E_OP_ERROR;
-    
-    if (handle != DRV_HANDLE_INVALID)    
-    {
-        DRV_BA414E_ClientData * cd = (DRV_BA414E_ClientData *)handle;
-        if (cd->currentOp == DRV_BA414E_OP_NONE)
-        {
-            memset(&cd->modOperationParams, 0, sizeof(DRV_BA414E_primModOperationParams));
-            cd->modOperationParams.opSize = opSize;
-            cd->modOperationParams.c = c;
-            cd->modOperationParams.p = p;
-            cd->modOperationParams.a = a;
-            cd->modOperationParams.b = b;
-            cd->currentOp = DRV_BA414E_OP_PRIM_MOD_MULTIPLICATION;
-            if ((cd->ioIntent & DRV_IO_INTENT_NONBLOCKING) == DRV_IO_INTENT_NONBLOCKING)
-            {
-                cd->callback = callback;
-                cd->context = context;
-#if defined(DRV_BA414E_RTOS_STACK_SIZE)
-                OSAL_SEM_Post(&opData.clientAction);
-#endif
-                ret = DRV_BA414E_OP_PENDING;
-            }
-            else
-            {
-                ret = DRV_BA414_BlockingHelper(cd);
-            }
-        }
-    }   
-    return ret;  
-}
-
-DRV_BA414E_OP_RESULT DRV_BA414E_PRIM_ModExponentiation(
-    const DRV_HANDLE handle,
-    DRV_BA414E_OPERAND_SIZE opSize,    // Hardware operand size
-    uint8_t * C,
-    const uint8_t * n,
-    const uint8_t * M,
-    const uint8_t * e,
-    DRV_BA414E_CALLBACK callback,
-    uintptr_t context          
-)
-{
-    DRV_BA414E_RESULT ret = DRV_BA414E_OP_ERROR;
-    
-    if (handle != DRV_HANDLE_INVALID)    
-    {
-        DRV_BA414E_ClientData * cd = (DRV_BA414E_ClientData *)handle;
-        if (cd->currentOp == DRV_BA414E_OP_NONE)
-        {
-            memset(&cd->modExpParams, 0, sizeof(DRV_BA414E_primModExpOpParams));
-            cd->modExpParams.opSize = opSize;
-            cd->modExpParams.C = C;
-            cd->modExpParams.n = n;
-            cd->modExpParams.M = M;
-            cd->modExpParams.e = e;
-            cd->currentOp = DRV_BA414E_OP_PRIM_MOD_EXP;
-            if ((cd->ioIntent & DRV_IO_INTENT_NONBLOCKING) == DRV_IO_INTENT_NONBLOCKING)
-            {
-                cd->callback = callback;
-                cd->context = context;
-#if defined(DRV_BA414E_RTOS_STACK_SIZE)
-                OSAL_SEM_Post(&opData.clientAction);
-#endif
-                ret = DRV_BA414E_OP_PENDING;
-            }
-            else
-            {
-                ret = DRV_BA414_BlockingHelper(cd);
-            }
-        }
-    }   
-    return ret;  
-    
-}
+#endif // !DRV_BA414E_SOFTWARE_BACKEND
@@ -79,6 +79,10 @@ SUBSTITUTE  GOODS,  TECHNOLOGY,  SERVICES,  OR  ANY  CLAIMS  BY  THIRD   PARTIES
 #define DRV_BA414E_ALIGNMENT_MASK          0x3
 // Microcode memory size
 #define DRV_BA414E_MAX_uCODE_SIZE          1432
+// Number of jobs that can be queued or running at once
+#if !defined(DRV_BA414E_QUEUE_SIZE)
+#define DRV_BA414E_QUEUE_SIZE              (DRV_BA414E_NUM_CLIENTS * 2)
+#endif
         
         
         
@@ -99,126 +103,33 @@ typedef enum
         
 typedef enum
 {
-    DRV_BA414E_OP_NONE = 0,
-    DRV_BA414E_OP_ECDSA_SIGN,
-    DRV_BA414E_OP_ECDSA_VERIFY,
-    DRV_BA414E_OP_PRIM_ECC_POINT_DOUBLE,
-    DRV_BA414E_OP_PRIM_ECC_POINT_ADDITION,
-    DRV_BA414E_OP_PRIM_ECC_POINT_MULTIPLICATION,
-    DRV_BA414E_OP_PRIM_ECC_CHECK_POINT_ON_CURVE,
-    DRV_BA414E_OP_PRIM_MOD_ADDITION,
-    DRV_BA414E_OP_PRIM_MOD_SUBTRACTION,
-    DRV_BA414E_OP_PRIM_MOD_MULTIPLICATION,
-    DRV_BA414E_OP_PRIM_MOD_EXP,            
-            
-}DRV_BA414E_OPERATIONS;
-
-typedef struct
-{
-    const DRV_BA414E_ECC_DOMAIN * domain;
-    uint8_t * R;
-    uint8_t * S;
-    const uint8_t * privateKey;
-    const uint8_t * k;
-    const uint8_t * msgHash;
-    int msgHashSz;    
-}DRV_BA414E_ecdsaSignOpParams;
-
-typedef struct
-{
-    const DRV_BA414E_ECC_DOMAIN * domain;
-    uint8_t * R;
-    uint8_t * S;
-    const uint8_t * publicKeyX;
-    const uint8_t * publicKeyY;
-    const uint8_t * msgHash;
-    int msgHashSz;    
-}DRV_BA414E_ecdsaVerifyOpParams;
+    DRV_BA414E_JOB_FREE = 0,
+    DRV_BA414E_JOB_QUEUED,
+    DRV_BA414E_JOB_ACTIVE,
+    DRV_BA414E_JOB_DONE
+}DRV_BA414E_JOB_STATEs;
 
 typedef struct
 {
-    const DRV_BA414E_ECC_DOMAIN * domain;
-    uint8_t * outX;
-    uint8_t * outY;
-    const uint8_t * p1X;
-    const uint8_t * p1Y;
-
-}DRV_BA414E_primEccPointDoubleOpParams;
-
-typedef struct
-{
-    const DRV_BA414E_ECC_DOMAIN * domain;
-    uint8_t * outX;
-    uint8_t * outY;
-    const uint8_t * p1X;
-    const uint8_t * p1Y;
-    const uint8_t * p2X;
-    const uint8_t * p2Y;
-
-}DRV_BA414E_primEccPointAdditionOpParams;
-
-typedef struct
-{
-    const DRV_BA414E_ECC_DOMAIN * domain;
-    uint8_t * outX;
-    uint8_t * outY;
-    const uint8_t * p1X;
-    const uint8_t * p1Y;
-    const uint8_t * k;
-
-}DRV_BA414E_primEccPointMultiplicationOpParams;
-
-typedef struct
-{
-    const DRV_BA414E_ECC_DOMAIN * domain;
-    const uint8_t * p1X;
-    const uint8_t * p1Y;
-
-}DRV_BA414E_primEccCheckPointOnCurveOpParams;
-
-typedef struct
-{
-    DRV_BA414E_OPERAND_SIZE opSize;    // Hardware operand size
-    uint8_t * c;
-    const uint8_t * p;
-    const uint8_t * a;
-    const uint8_t * b;
-}DRV_BA414E_primModOperationParams;
-
-typedef struct
-{
-    DRV_BA414E_OPERAND_SIZE opSize;    // Hardware operand size
-    uint8_t * C;
-    const uint8_t * n;
-    const uint8_t * M;
-    const uint8_t * e;
-}DRV_BA414E_primModExpOpParams;
-
+    DRV_IO_INTENT ioIntent;
+    uint8_t inUse;
+    DRV_BA414E_PRIORITY priority : 8;       // Default priority of this client's operations
+}DRV_BA414E_ClientData;
 
-typedef struct
+typedef struct DRV_BA414E_JobData
 {
 #if defined(DRV_BA414E_RTOS_STACK_SIZE)
-    OSAL_SEM_DECLARE(clientBlock);
+    OSAL_SEM_DECLARE(jobDone);              // Posted when a blocking client's job completes
 #endif
-    union {
-        DRV_BA414E_ecdsaSignOpParams ecdsaSignParams;
-        DRV_BA414E_ecdsaVerifyOpParams ecdsaVerifyParams;
-        DRV_BA414E_primEccPointDoubleOpParams eccPointDoubleParams;
-        DRV_BA414E_primEccPointAdditionOpParams eccPointAdditionParams;
-        DRV_BA414E_primEccPointMultiplicationOpParams eccPointMultiplicationParams;
-        DRV_BA414E_primEccCheckPointOnCurveOpParams eccCheckPointOnCurveParams;
-        DRV_BA414E_primModOperationParams modOperationParams;
-        DRV_BA414E_primModExpOpParams modExpParams;        
-    };
+    DRV_BA414E_JOB_REQUEST request;
+    struct DRV_BA414E_JobData * next;       // Next job in the queue
+    DRV_BA414E_ClientData * client;
     DRV_BA414E_CALLBACK callback;
     uintptr_t context;
-    DRV_BA414E_OP_RESULT blockingResult;
-
-    
-    DRV_IO_INTENT ioIntent;
-    DRV_BA414E_OPERATIONS currentOp : 8;
-    uint8_t inUse;
-}DRV_BA414E_ClientData;
+    DRV_BA414E_OP_RESULT result;
+    DRV_BA414E_JOB_STATEs state : 8;
+    DRV_BA414E_PRIORITY priority : 8;
+}DRV_BA414E_JobData;
         
 typedef struct 
 {
@@ -227,16 +138,38 @@ typedef struct
     OSAL_SEM_DECLARE(clientAction);
     OSAL_SEM_DECLARE(wfi);
 #endif
-    DRV_BA414E_ClientData * currentClient;
+    DRV_BA414E_JobData * queueHead;         // Queued jobs by priority, then submission
+    DRV_BA414E_JobData * currentJob;
     SYS_STATUS status : 8;
     DRV_BA414E_STATEs state : 8;
     uint8_t inited;
-    uint8_t doneInterrupt;
-    uint8_t errorInterrupt;
-    uint32_t lastStatus;
 }DRV_BA414E_OperationalData;
-        
 
+// *****************************************************************************
+// *****************************************************************************
+// Section: Backend Interface
+// *****************************************************************************
+// *****************************************************************************
+
+// The job queue (drv_ba414e_queue.c) runs one job at a time through a
+// backend: the BA414E hardware (drv_ba414e.c), or the NetX Crypto software
+// implementation (drv_ba414e_sw.c) when DRV_BA414E_SOFTWARE_BACKEND is
+// defined.
+
+// Prepares the backend when the driver task first runs.
+void DRV_BA414E_BackendInitialize(void);
+// Starts an operation.  The backend calls DRV_BA414E_OperationDone or
+// DRV_BA414E_OperationDoneISR when it has finished.
+void DRV_BA414E_BackendStart(const DRV_BA414E_JOB_REQUEST * request);
+// Returns true once the operation started last has finished.
+bool DRV_BA414E_BackendIsDone(void);
+// Returns the result of the operation and writes its outputs.
+DRV_BA414E_OP_RESULT DRV_BA414E_BackendFinish(const DRV_BA414E_JOB_REQUEST * request);
+
+void DRV_BA414E_OperationDone(void);
+void DRV_BA414E_OperationDoneISR(void);
+
+#if !defined(DRV_BA414E_SOFTWARE_BACKEND)
 
 typedef enum
 {
@@ -360,6 +293,15 @@ typedef union {
     uint32_t v;
 }BA414E__PKCONFIGbits;
 
+typedef struct
+{
+    uint8_t doneInterrupt;
+    uint8_t errorInterrupt;
+    uint32_t lastStatus;
+}DRV_BA414E_HardwareData;
+
+#endif // !DRV_BA414E_SOFTWARE_BACKEND
+
 //DOM-IGNORE-BEGIN
 #ifdef __cplusplus
 }
@@ -0,0 +1,813 @@
+/********************************************************************************
+  BA414E Crypto Driver Job Queue implementation.
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    drv_ba414e_queue.c
+
+  Summary:
+    Source code for the BA414E Crypto driver client interface and job queue.
+
+  Description:
+    This file contains the client interface of the BA414E Crypto driver and
+    the job queue that feeds operations to the backend, one at a time.  The
+    backend is the BA414E hardware (drv_ba414e.c) or, when
+    DRV_BA414E_SOFTWARE_BACKEND is defined, the NetX Crypto software
+    implementation (drv_ba414e_sw.c).
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*******************************************************************************
+Copyright (c) 2018 released Microchip Technology Inc.  All rights reserved.
+
+Microchip licenses to you the right to use, modify, copy and distribute Software
+only when embedded on a Microchip microcontroller or digital  signal  controller
+that is integrated into your product or third party  product  (pursuant  to  the
+sublicense terms in the accompanying license agreement).
+
+You should refer to the license agreement accompanying this Software for
+additional information regarding your rights and obligations.
+
+SOFTWARE AND DOCUMENTATION ARE PROVIDED AS IS  WITHOUT  WARRANTY  OF  ANY  KIND,
+EITHER EXPRESS  OR  IMPLIED,  INCLUDING  WITHOUT  LIMITATION,  ANY  WARRANTY  OF
+MERCHANTABILITY, TITLE, NON-INFRINGEMENT AND FITNESS FOR A  PARTICULAR  PURPOSE.
+IN NO EVENT SHALL MICROCHIP OR  ITS  LICENSORS  BE  LIABLE  OR  OBLIGATED  UNDER
+CONTRACT, NEGLIGENCE, STRICT LIABILITY, CONTRIBUTION,  BREACH  OF  WARRANTY,  OR
+OTHER LEGAL  EQUITABLE  THEORY  ANY  DIRECT  OR  INDIRECT  DAMAGES  OR  EXPENSES
+INCLUDING BUT NOT LIMITED TO ANY  INCIDENTAL,  SPECIAL,  INDIRECT,  PUNITIVE  OR
+CONSEQUENTIAL DAMAGES, LOST  PROFITS  OR  LOST  DATA,  COST  OF  PROCUREMENT  OF
+SUBSTITUTE  GOODS,  TECHNOLOGY,  SERVICES,  OR  ANY  CLAIMS  BY  THIRD   PARTIES
+(INCLUDING BUT NOT LIMITED TO ANY DEFENSE  THEREOF),  OR  OTHER  SIMILAR  COSTS.
+*******************************************************************************/
+//DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+#include <string.h>
+
+#include "configuration.h"
+#include "driver/ba414e/drv_ba414e.h"
+#include "drv_ba414e_local.h"
+#include "osal/osal.h"
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Global Data
+// *****************************************************************************
+// *****************************************************************************
+
+static DRV_BA414E_OperationalData opData = {0};
+static DRV_BA414E_ClientData clientData[DRV_BA414E_NUM_CLIENTS];
+static DRV_BA414E_JobData jobData[DRV_BA414E_QUEUE_SIZE];
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Static functions
+// *****************************************************************************
+// *****************************************************************************
+
+static inline void DRV_BA414E_Lock(void)
+{
+#if defined(DRV_BA414E_RTOS_STACK_SIZE)
+    OSAL_SEM_Pend(&opData.clientListSema, OSAL_WAIT_FOREVER);
+#endif
+}
+
+static inline void DRV_BA414E_Unlock(void)
+{
+#if defined(DRV_BA414E_RTOS_STACK_SIZE)
+    OSAL_SEM_Post(&opData.clientListSema);
+#endif
+}
+
+static DRV_BA414E_ClientData * DRV_BA414E_ClientGet(const DRV_HANDLE handle)
+{
+    uintptr_t offset = handle - (uintptr_t)&clientData[0];
+    DRV_BA414E_ClientData * cd = NULL;
+    if ((handle != DRV_HANDLE_INVALID) &&
+        (handle >= (uintptr_t)&clientData[0]) &&
+        (handle < (uintptr_t)&clientData[DRV_BA414E_NUM_CLIENTS]) &&
+        ((offset % sizeof(DRV_BA414E_ClientData)) == 0))
+    {
+        cd = (DRV_BA414E_ClientData *)handle;
+        if (cd->inUse == 0)
+        {
+            cd = NULL;
+        }
+    }
+    return cd;
+}
+
+// Returns the job a handle refers to, or NULL when the handle is not a live
+// job of the client.  Must be called with the lock held.
+static DRV_BA414E_JobData * DRV_BA414E_JobGet(DRV_BA414E_ClientData * cd,
+        DRV_BA414E_JOB_HANDLE job)
+{
+    uintptr_t offset = job - (uintptr_t)&jobData[0];
+    DRV_BA414E_JobData * jd = NULL;
+    if ((job >= (uintptr_t)&jobData[0]) &&
+        (job < (uintptr_t)&jobData[DRV_BA414E_QUEUE_SIZE]) &&
+        ((offset % sizeof(DRV_BA414E_JobData)) == 0))
+    {
+        jd = (DRV_BA414E_JobData *)job;
+        if ((jd->client != cd) || (jd->state == DRV_BA414E_JOB_FREE))
+        {
+            jd = NULL;
+        }
+    }
+    return jd;
+}
+
+// Inserts a job after the queued jobs of the same or higher priority, so that
+// jobs of equal priority run in submission order.  Must be called with the
+// lock held.
+static void DRV_BA414E_JobEnqueue(DRV_BA414E_JobData * jd)
+{
+    DRV_BA414E_JobData ** link = &opData.queueHead;
+    while ((*link != NULL) && ((*link)->priority >= jd->priority))
+    {
+        link = &(*link)->next;
+    }
+    jd->next = *link;
+    *link = jd;
+}
+
+// Removes the queued jobs of a client.  Must be called with the lock held.
+static void DRV_BA414E_JobDropClient(DRV_BA414E_ClientData * cd)
+{
+    DRV_BA414E_JobData ** link = &opData.queueHead;
+    while (*link != NULL)
+    {
+        if ((*link)->client == cd)
+        {
+            DRV_BA414E_JobData * jd = *link;
+            *link = jd->next;
+            jd->next = NULL;
+            jd->state = DRV_BA414E_JOB_FREE;
+        }
+        else
+        {
+            link = &(*link)->next;
+        }
+    }
+}
+
+static void DRV_BA414E_JobFinished(DRV_BA414E_JobData * jd, DRV_BA414E_OP_RESULT result)
+{
+    if (jd->callback != NULL)
+    {
+        // The callback may close the handle or submit another job, so it is
+        // called without the lock.
+        (jd->callback)(result, jd->context);
+        DRV_BA414E_Lock();
+        jd->state = DRV_BA414E_JOB_FREE;
+        DRV_BA414E_Unlock();
+    }
+    else
+    {
+        DRV_BA414E_Lock();
+        if (jd->client == NULL)
+        {
+            // The client closed while the job was running.
+            jd->state = DRV_BA414E_JOB_FREE;
+        }
+        else
+        {
+            jd->result = result;
+            jd->state = DRV_BA414E_JOB_DONE;
+#if defined(DRV_BA414E_RTOS_STACK_SIZE)
+            if ((jd->client->ioIntent & DRV_IO_INTENT_NONBLOCKING) != DRV_IO_INTENT_NONBLOCKING)
+            {
+                OSAL_SEM_Post(&jd->jobDone);
+            }
+#endif
+        }
+        DRV_BA414E_Unlock();
+    }
+}
+
+// Used by the operation routines when a non-blocking client gives no
+// callback, so that the job is still released when it completes.
+static void DRV_BA414E_DiscardResult(DRV_BA414E_OP_RESULT result, uintptr_t context)
+{
+    (void)result;
+    (void)context;
+}
+
+static DRV_BA414E_OP_RESULT DRV_BA414E_Run(const DRV_HANDLE handle,
+        const DRV_BA414E_JOB_REQUEST * request,
+        DRV_BA414E_CALLBACK callback,
+        uintptr_t context)
+{
+    DRV_BA414E_OP_RESULT ret = DRV_BA414E_OP_ERROR;
+    DRV_BA414E_ClientData * cd = DRV_BA414E_ClientGet(handle);
+
+    if (cd != NULL)
+    {
+        if ((cd->ioIntent & DRV_IO_INTENT_NONBLOCKING) == DRV_IO_INTENT_NONBLOCKING)
+        {
+            if (callback == NULL)
+            {
+                callback = DRV_BA414E_DiscardResult;
+            }
+            ret = DRV_BA414E_JobSubmit(handle, request, cd->priority, callback, context, NULL);
+        }
+        else
+        {
+            DRV_BA414E_JOB_HANDLE job;
+            ret = DRV_BA414E_JobSubmit(handle, request, cd->priority, NULL, 0, &job);
+            if (ret == DRV_BA414E_OP_PENDING)
+            {
+                ret = DRV_BA414E_JobComplete(handle, job);
+            }
+        }
+    }
+    return ret;
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: BA414E Driver Interface Implementations
+// *****************************************************************************
+// *****************************************************************************
+
+SYS_MODULE_OBJ DRV_BA414E_Initialize
+(
+    const SYS_MODULE_INDEX index,
+    const SYS_MODULE_INIT * const init
+)
+{
+    SYS_MODULE_OBJ ret = 0;
+    (void)init;
+    if ((index != 0) || (opData.inited == 1))
+    {
+        ret = SYS_MODULE_OBJ_INVALID;
+    }
+    else
+    {
+        memset(&opData, 0, sizeof(DRV_BA414E_OperationalData));
+        opData.inited = 1;
+        opData.state = DRV_BA414E_INITIALIZE;
+        opData.status = SYS_STATUS_UNINITIALIZED;
+#if defined(DRV_BA414E_RTOS_STACK_SIZE)
+        OSAL_SEM_Create(&opData.clientListSema, OSAL_SEM_TYPE_BINARY, 1, 1);
+        OSAL_SEM_Create(&opData.wfi, OSAL_SEM_TYPE_BINARY, DRV_BA414E_NUM_CLIENTS, 0);
+    #if !defined(DRV_BA414_RTOS_TASK_DELAY)
+        OSAL_SEM_Create(&opData.clientAction, OSAL_SEM_TYPE_COUNTING, DRV_BA414E_QUEUE_SIZE, 0);
+    #endif
+#endif
+        memset(&clientData, 0, sizeof(clientData));
+        memset(&jobData, 0, sizeof(jobData));
+        int counter;
+        for (counter = 0; counter < DRV_BA414E_QUEUE_SIZE; counter++)
+        {
+#if defined(DRV_BA414E_RTOS_STACK_SIZE)
+            OSAL_SEM_Create(&(jobData[counter].jobDone), OSAL_SEM_TYPE_BINARY, 1, 0);
+#endif
+        }
+
+        ret = (SYS_MODULE_OBJ)&opData;
+    }
+    return ret;
+}
+
+void DRV_BA414E_Deinitialize( SYS_MODULE_OBJ object)
+{
+    if (object == (SYS_MODULE_OBJ)&opData)
+    {
+#if defined(DRV_BA414E_RTOS_STACK_SIZE)
+        OSAL_SEM_Delete(&opData.clientListSema);
+        OSAL_SEM_Delete(&opData.wfi);
+    #if !defined(DRV_BA414_RTOS_TASK_DELAY)
+        OSAL_SEM_Delete(&opData.clientAction);
+    #endif
+#endif
+        int counter;
+        for (counter = 0; counter < DRV_BA414E_QUEUE_SIZE; counter++)
+        {
+#if defined(DRV_BA414E_RTOS_STACK_SIZE)
+            OSAL_SEM_Delete(&(jobData[counter].jobDone));
+#endif
+        }
+        memset(&jobData, 0, sizeof(jobData));
+        memset(&clientData, 0, sizeof(clientData));
+        memset(&opData, 0, sizeof(DRV_BA414E_OperationalData));
+    }
+}
+
+DRV_HANDLE DRV_BA414E_Open( const SYS_MODULE_INDEX index,
+        const DRV_IO_INTENT ioIntent)
+{
+    DRV_HANDLE ret = DRV_HANDLE_INVALID;
+    if (index == 0)
+    {
+#if !defined(DRV_BA414E_RTOS_STACK_SIZE)
+        if ((ioIntent & DRV_IO_INTENT_NONBLOCKING) == DRV_IO_INTENT_NONBLOCKING)
+#endif
+        {
+            if ((ioIntent & DRV_IO_INTENT_WRITE) == DRV_IO_INTENT_WRITE)
+            {
+                uint8_t lookingForExclusive = 0;
+                if ((ioIntent & DRV_IO_INTENT_EXCLUSIVE) == DRV_IO_INTENT_EXCLUSIVE)
+                {
+                    lookingForExclusive = 1;
+                }
+                int found = -1;
+                DRV_BA414E_Lock();
+                int counter;
+                for (counter = 0; counter < DRV_BA414E_NUM_CLIENTS; counter++)
+                {
+                    if (clientData[counter].inUse == 0)
+                    {
+                        found = counter;
+                    }
+                    else
+                    {
+                        if (lookingForExclusive == 1 || ((clientData[counter].ioIntent & DRV_IO_INTENT_EXCLUSIVE) == DRV_IO_INTENT_EXCLUSIVE))
+                        {
+                            found = -1;
+                            break;
+                        }
+                    }
+                }
+                if (found != -1)
+                {
+                    clientData[found].inUse = 1;
+                    clientData[found].ioIntent = ioIntent;
+                    clientData[found].priority = DRV_BA414E_PRIORITY_NORMAL;
+                    ret = (DRV_HANDLE)&(clientData[found]);
+                }
+                DRV_BA414E_Unlock();
+            }
+        }
+
+    }
+
+    return ret;
+}
+
+void DRV_BA414E_Close( const DRV_HANDLE handle)
+{
+    DRV_BA414E_ClientData * cd = DRV_BA414E_ClientGet(handle);
+    if (cd != NULL)
+    {
+        DRV_BA414E_Lock();
+        DRV_BA414E_JobDropClient(cd);
+        int counter;
+        for (counter = 0; counter < DRV_BA414E_QUEUE_SIZE; counter++)
+        {
+            DRV_BA414E_JobData * jd = &jobData[counter];
+            if (jd->client != cd)
+            {
+                continue;
+            }
+            if (jd->state == DRV_BA414E_JOB_DONE)
+            {
+                jd->state = DRV_BA414E_JOB_FREE;
+            }
+            // A running job completes, but its result is no longer kept.
+            jd->client = NULL;
+        }
+        cd->ioIntent = 0;
+        cd->priority = DRV_BA414E_PRIORITY_NORMAL;
+        cd->inUse = 0;
+        DRV_BA414E_Unlock();
+    }
+}
+
+void DRV_BA414E_PrioritySet( const DRV_HANDLE handle,
+        DRV_BA414E_PRIORITY priority)
+{
+    DRV_BA414E_ClientData * cd = DRV_BA414E_ClientGet(handle);
+    if (cd != NULL)
+    {
+        cd->priority = priority;
+    }
+}
+
+DRV_BA414E_OP_RESULT DRV_BA414E_JobSubmit( const DRV_HANDLE handle,
+        const DRV_BA414E_JOB_REQUEST * request,
+        DRV_BA414E_PRIORITY priority,
+        DRV_BA414E_CALLBACK callback,
+        uintptr_t context,
+        DRV_BA414E_JOB_HANDLE * job)
+{
+    DRV_BA414E_OP_RESULT ret = DRV_BA414E_OP_ERROR;
+    DRV_BA414E_ClientData * cd = DRV_BA414E_ClientGet(handle);
+
+    if (job != NULL)
+    {
+        *job = DRV_BA414E_JOB_HANDLE_INVALID;
+    }
+    if ((cd == NULL) || (request == NULL) ||
+        (request->operation == DRV_BA414E_OP_NONE) ||
+        (request->operation > DRV_BA414E_OP_PRIM_MOD_EXP) ||
+        ((callback == NULL) && (job == NULL)))
+    {
+        return ret;
+    }
+
+    ret = DRV_BA414E_OP_BUSY;
+    DRV_BA414E_Lock();
+    int counter;
+    for (counter = 0; counter < DRV_BA414E_QUEUE_SIZE; counter++)
+    {
+        DRV_BA414E_JobData * jd = &jobData[counter];
+        if (jd->state == DRV_BA414E_JOB_FREE)
+        {
+            jd->request = *request;
+            jd->client = cd;
+            jd->callback = callback;
+            jd->context = context;
+            jd->result = DRV_BA414E_OP_PENDING;
+            jd->priority = priority;
+            jd->state = DRV_BA414E_JOB_QUEUED;
+            DRV_BA414E_JobEnqueue(jd);
+            if (job != NULL)
+            {
+                *job = (DRV_BA414E_JOB_HANDLE)jd;
+            }
+            ret = DRV_BA414E_OP_PENDING;
+            break;
+        }
+    }
+    DRV_BA414E_Unlock();
+
+#if defined(DRV_BA414E_RTOS_STACK_SIZE)
+    if (ret == DRV_BA414E_OP_PENDING)
+    {
+        OSAL_SEM_Post(&opData.clientAction);
+    }
+#endif
+    return ret;
+}
+
+DRV_BA414E_OP_RESULT DRV_BA414E_JobComplete( const DRV_HANDLE handle,
+        DRV_BA414E_JOB_HANDLE job)
+{
+    DRV_BA414E_OP_RESULT ret = DRV_BA414E_OP_ERROR;
+    DRV_BA414E_ClientData * cd = DRV_BA414E_ClientGet(handle);
+
+    while (cd != NULL)
+    {
+        DRV_BA414E_Lock();
+        DRV_BA414E_JobData * jd = DRV_BA414E_JobGet(cd, job);
+        if ((jd == NULL) || (jd->callback != NULL))
+        {
+            ret = DRV_BA414E_OP_ERROR;
+        }
+        else if (jd->state == DRV_BA414E_JOB_DONE)
+        {
+            ret = jd->result;
+            jd->client = NULL;
+            jd->state = DRV_BA414E_JOB_FREE;
+        }
+        else
+        {
+            ret = DRV_BA414E_OP_PENDING;
+        }
+        DRV_BA414E_Unlock();
+
+#if defined(DRV_BA414E_RTOS_STACK_SIZE)
+        if ((ret == DRV_BA414E_OP_PENDING) &&
+            ((cd->ioIntent & DRV_IO_INTENT_NONBLOCKING) != DRV_IO_INTENT_NONBLOCKING))
+        {
+            // The semaphore may hold a post left over from an earlier use
+            // of the job, so the state is checked again after each wake up.
+            OSAL_SEM_Pend(&jd->jobDone, OSAL_WAIT_FOREVER);
+            continue;
+        }
+#endif
+        break;
+    }
+    return ret;
+}
+
+SYS_STATUS DRV_BA414E_Status( SYS_MODULE_OBJ object)
+{
+    SYS_STATUS ret = SYS_STATUS_ERROR;
+    if (object == (SYS_MODULE_OBJ)&opData)
+    {
+        ret = opData.status;
+    }
+    return ret;
+}
+
+void DRV_BA414E_OperationDone(void)
+{
+#if defined(DRV_BA414E_RTOS_STACK_SIZE)
+    OSAL_SEM_Post(&opData.wfi);
+#endif
+}
+
+void DRV_BA414E_OperationDoneISR(void)
+{
+#if defined(DRV_BA414E_RTOS_STACK_SIZE)
+    OSAL_SEM_PostISR(&opData.wfi);
+#endif
+}
+
+void DRV_BA414E_Tasks(SYS_MODULE_OBJ obj)
+{
+    if (obj == (SYS_MODULE_OBJ)&opData)
+    {
+        switch (opData.state)
+        {
+            case DRV_BA414E_INITIALIZE:
+                DRV_BA414E_BackendInitialize();
+                opData.state = DRV_BA414E_READY;
+                break;
+            case DRV_BA414E_READY:
+            {
+#if defined(DRV_BA414E_RTOS_STACK_SIZE)
+                OSAL_SEM_Pend(&opData.clientAction, OSAL_WAIT_FOREVER);
+#endif
+                DRV_BA414E_Lock();
+                opData.currentJob = opData.queueHead;
+                if (opData.currentJob != NULL)
+                {
+                    opData.queueHead = opData.currentJob->next;
+                    opData.currentJob->next = NULL;
+                    opData.currentJob->state = DRV_BA414E_JOB_ACTIVE;
+                    opData.state = DRV_BA414E_PREPARING;
+                }
+                DRV_BA414E_Unlock();
+            }
+            break;
+            case DRV_BA414E_PREPARING:
+                opData.state = DRV_BA414E_WAITING;
+                DRV_BA414E_BackendStart(&opData.currentJob->request);
+            break;
+            case DRV_BA414E_WAITING:
+#if defined(DRV_BA414E_RTOS_STACK_SIZE)
+                OSAL_SEM_Pend(&opData.wfi, OSAL_WAIT_FOREVER);
+#endif
+                if (DRV_BA414E_BackendIsDone())
+                {
+                    opData.state = DRV_BA414E_PROCESSING;
+                }
+                break;
+            case DRV_BA414E_PROCESSING:
+            {
+                DRV_BA414E_JobData * jd = opData.currentJob;
+                opData.currentJob = NULL;
+                opData.state = DRV_BA414E_READY;
+                DRV_BA414E_JobFinished(jd, DRV_BA414E_BackendFinish(&jd->request));
+            }
+            break;
+            default:
+                break;
+        }
+    }
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: BA414E Driver Operations
+// *****************************************************************************
+// *****************************************************************************
+
+DRV_BA414E_OP_RESULT DRV_BA414E_ECDSA_Sign(
+    const DRV_HANDLE handle,
+    const DRV_BA414E_ECC_DOMAIN * domain,
+    uint8_t * R,
+    uint8_t * S,
+    const uint8_t * privateKey,
+    const uint8_t * k,
+    const uint8_t * msgHash,
+    int msgHashSz,
+    DRV_BA414E_CALLBACK callback,
+    uintptr_t context
+)
+{
+    DRV_BA414E_JOB_REQUEST request;
+
+    memset(&request, 0, sizeof(request));
+    request.operation = DRV_BA414E_OP_ECDSA_SIGN;
+    request.ecdsaSignParams.domain = domain;
+    request.ecdsaSignParams.R = R;
+    request.ecdsaSignParams.S = S;
+    request.ecdsaSignParams.privateKey = privateKey;
+    request.ecdsaSignParams.k = k;
+    request.ecdsaSignParams.msgHash = msgHash;
+    request.ecdsaSignParams.msgHashSz = msgHashSz;
+    return DRV_BA414E_Run(handle, &request, callback, context);
+}
+
+DRV_BA414E_OP_RESULT DRV_BA414E_ECDSA_Verify(
+    const DRV_HANDLE handle,
+    const DRV_BA414E_ECC_DOMAIN * domain,
+    const uint8_t * publicKeyX,
+    const uint8_t * publicKeyY,
+    uint8_t * R,
+    uint8_t * S,
+    const uint8_t * msgHash,
+    int msgHashSz,
+    DRV_BA414E_CALLBACK callback,
+    uintptr_t context
+)
+{
+    DRV_BA414E_JOB_REQUEST request;
+
+    memset(&request, 0, sizeof(request));
+    request.operation = DRV_BA414E_OP_ECDSA_VERIFY;
+    request.ecdsaVerifyParams.domain = domain;
+    request.ecdsaVerifyParams.R = R;
+    request.ecdsaVerifyParams.S = S;
+    request.ecdsaVerifyParams.publicKeyX = publicKeyX;
+    request.ecdsaVerifyParams.publicKeyY = publicKeyY;
+    request.ecdsaVerifyParams.msgHash = msgHash;
+    request.ecdsaVerifyParams.msgHashSz = msgHashSz;
+    return DRV_BA414E_Run(handle, &request, callback, context);
+}
+
+DRV_BA414E_OP_RESULT DRV_BA414E_PRIM_EccPointDouble(
+    const DRV_HANDLE handle,
+    const DRV_BA414E_ECC_DOMAIN * domain,
+    uint8_t * outX,
+    uint8_t * outY,
+    const uint8_t * p1X,
+    const uint8_t * p1Y,
+    DRV_BA414E_CALLBACK callback,
+    uintptr_t context
+)
+{
+    DRV_BA414E_JOB_REQUEST request;
+
+    memset(&request, 0, sizeof(request));
+    request.operation = DRV_BA414E_OP_PRIM_ECC_POINT_DOUBLE;
+    request.eccPointDoubleParams.domain = domain;
+    request.eccPointDoubleParams.outX = outX;
+    request.eccPointDoubleParams.outY = outY;
+    request.eccPointDoubleParams.p1X = p1X;
+    request.eccPointDoubleParams.p1Y = p1Y;
+    return DRV_BA414E_Run(handle, &request, callback, context);
+}
+
+DRV_BA414E_OP_RESULT DRV_BA414E_PRIM_EccPointAddition(
+    const DRV_HANDLE handle,
+    const DRV_BA414E_ECC_DOMAIN * domain,
+    uint8_t * outX,
+    uint8_t * outY,
+    const uint8_t * p1X,
+    const uint8_t * p1Y,
+    const uint8_t * p2X,
+    const uint8_t * p2Y,
+    DRV_BA414E_CALLBACK callback,
+    uintptr_t context
+)
+{
+    DRV_BA414E_JOB_REQUEST request;
+
+    memset(&request, 0, sizeof(request));
+    request.operation = DRV_BA414E_OP_PRIM_ECC_POINT_ADDITION;
+    request.eccPointAdditionParams.domain = domain;
+    request.eccPointAdditionParams.outX = outX;
+    request.eccPointAdditionParams.outY = outY;
+    request.eccPointAdditionParams.p1X = p1X;
+    request.eccPointAdditionParams.p1Y = p1Y;
+    request.eccPointAdditionParams.p2X = p2X;
+    request.eccPointAdditionParams.p2Y = p2Y;
+    return DRV_BA414E_Run(handle, &request, callback, context);
+}
+
+DRV_BA414E_OP_RESULT DRV_BA414E_PRIM_EccPointMultiplication(
+    const DRV_HANDLE handle,
+    const DRV_BA414E_ECC_DOMAIN * domain,
+    uint8_t * outX,
+    uint8_t * outY,
+    const uint8_t * p1X,
+    const uint8_t * p1Y,
+    const uint8_t * k,
+    DRV_BA414E_CALLBACK callback,
+    uintptr_t context
+)
+{
+    DRV_BA414E_JOB_REQUEST request;
+
+    memset(&request, 0, sizeof(request));
+    request.operation = DRV_BA414E_OP_PRIM_ECC_POINT_MULTIPLICATION;
+    request.eccPointMultiplicationParams.domain = domain;
+    request.eccPointMultiplicationParams.outX = outX;
+    request.eccPointMultiplicationParams.outY = outY;
+    request.eccPointMultiplicationParams.p1X = p1X;
+    request.eccPointMultiplicationParams.p1Y = p1Y;
+    request.eccPointMultiplicationParams.k = k;
+    return DRV_BA414E_Run(handle, &request, callback, context);
+}
+
+DRV_BA414E_OP_RESULT DRV_BA414E_PRIM_EccCheckPointOnCurve(
+    const DRV_HANDLE handle,
+    const DRV_BA414E_ECC_DOMAIN * domain,
+    const uint8_t * p1X,
+    const uint8_t * p1Y,
+    DRV_BA414E_CALLBACK callback,
+    uintptr_t context
+)
+{
+    DRV_BA414E_JOB_REQUEST request;
+
+    memset(&request, 0, sizeof(request));
+    request.operation = DRV_BA414E_OP_PRIM_ECC_CHECK_POINT_ON_CURVE;
+    request.eccCheckPointOnCurveParams.domain = domain;
+    request.eccCheckPointOnCurveParams.p1X = p1X;
+    request.eccCheckPointOnCurveParams.p1Y = p1Y;
+    return DRV_BA414E_Run(handle, &request, callback, context);
+}
+
+DRV_BA414E_OP_RESULT DRV_BA414E_PRIM_ModAddition(
+    const DRV_HANDLE handle,
+    DRV_BA414E_OPERAND_SIZE opSize,    // Hardware operand size
+    uint8_t * c,
+    const uint8_t * p,
+    const uint8_t * a,
+    const uint8_t * b,
+    DRV_BA414E_CALLBACK callback,
+    uintptr_t context
+)
+{
+    DRV_BA414E_JOB_REQUEST request;
+
+    memset(&request, 0, sizeof(request));
+    request.operation = DRV_BA414E_OP_PRIM_MOD_ADDITION;
+    request.modOperationParams.opSize = opSize;
+    request.modOperationParams.c = c;
+    request.modOperationParams.p = p;
+    request.modOperationParams.a = a;
+    request.modOperationParams.b = b;
+    return DRV_BA414E_Run(handle, &request, callback, context);
+}
+
+DRV_BA414E_OP_RESULT DRV_BA414E_PRIM_ModSubtraction(
+    const DRV_HANDLE handle,
+    DRV_BA414E_OPERAND_SIZE opSize,    // Hardware operand size
+    uint8_t * c,
+    const uint8_t * p,
+    const uint8_t * a,
+    const uint8_t * b,
+    DRV_BA414E_CALLBACK callback,
+    uintptr_t context
+)
+{
+    DRV_BA414E_JOB_REQUEST request;
+
+    memset(&request, 0, sizeof(request));
+    request.operation = DRV_BA414E_OP_PRIM_MOD_SUBTRACTION;
+    request.modOperationParams.opSize = opSize;
+    request.modOperationParams.c = c;
+    request.modOperationParams.p = p;
+    request.modOperationParams.a = a;
+    request.modOperationParams.b = b;
+    return DRV_BA414E_Run(handle, &request, callback, context);
+}
+
+DRV_BA414E_OP_RESULT DRV_BA414E_PRIM_ModMultiplication(
+    const DRV_HANDLE handle,
+    DRV_BA414E_OPERAND_SIZE opSize,    // Hardware operand size
+    uint8_t * c,
+    const uint8_t * p,
+    const uint8_t * a,
+    const uint8_t * b,
+    DRV_BA414E_CALLBACK callback,
+    uintptr_t context
+)
+{
+    DRV_BA414E_JOB_REQUEST request;
+
+    memset(&request, 0, sizeof(request));
+    request.operation = DRV_BA414E_OP_PRIM_MOD_MULTIPLICATION;
+    request.modOperationParams.opSize = opSize;
+    request.modOperationParams.c = c;
+    request.modOperationParams.p = p;
+    request.modOperationParams.a = a;
+    request.modOperationParams.b = b;
+    return DRV_BA414E_Run(handle, &request, callback, context);
+}
+
+DRV_BA414E_OP_RESULT DRV_BA414E_PRIM_ModExponentiation(
+    const DRV_HANDLE handle,
+    DRV_BA414E_OPERAND_SIZE opSize,    // Hardware operand size
+    uint8_t * C,
+    const uint8_t * n,
+    const uint8_t * M,
+    const uint8_t * e,
+    DRV_BA414E_CALLBACK callback,
+    uintptr_t context
+)
+{
+    DRV_BA414E_JOB_REQUEST request;
+
+    memset(&request, 0, sizeof(request));
+    request.operation = DRV_BA414E_OP_PRIM_MOD_EXP;
+    request.modExpParams.opSize = opSize;
+    request.modExpParams.C = C;
+    request.modExpParams.n = n;
+    request.modExpParams.M = M;
+    request.modExpParams.e = e;
+    return DRV_BA414E_Run(handle, &request, callback, context);
+}
@@ -0,0 +1,664 @@
+/********************************************************************************
+  BA414E Crypto Driver Software Backend implementation.
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    drv_ba414e_sw.c
+
+  Summary:
+    Source code for the BA414E Crypto driver software backend.
+
+  Description:
+    This file contains a software implementation of the BA414E operations on
+    the NetX Crypto elliptic curve and huge number routines.  It is built in
+    place of the hardware backend when DRV_BA414E_SOFTWARE_BACKEND is defined,
+    so that the job queue and its clients can be run and measured without the
+    public key engine, for example on a host.
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*******************************************************************************
+Copyright (c) 2018 released Microchip Technology Inc.  All rights reserved.
+
+Microchip licenses to you the right to use, modify, copy and distribute Software
+only when embedded on a Microchip microcontroller or digital  signal  controller
+that is integrated into your product or third party  product  (pursuant  to  the
+sublicense terms in the accompanying license agreement).
+
+You should refer to the license agreement accompanying this Software for
+additional information regarding your rights and obligations.
+
+SOFTWARE AND DOCUMENTATION ARE PROVIDED AS IS  WITHOUT  WARRANTY  OF  ANY  KIND,
+EITHER EXPRESS  OR  IMPLIED,  INCLUDING  WITHOUT  LIMITATION,  ANY  WARRANTY  OF
+MERCHANTABILITY, TITLE, NON-INFRINGEMENT AND FITNESS FOR A  PARTICULAR  PURPOSE.
+IN NO EVENT SHALL MICROCHIP OR  ITS  LICENSORS  BE  LIABLE  OR  OBLIGATED  UNDER
+CONTRACT, NEGLIGENCE, STRICT LIABILITY, CONTRIBUTION,  BREACH  OF  WARRANTY,  OR
+OTHER LEGAL  EQUITABLE  THEORY  ANY  DIRECT  OR  INDIRECT  DAMAGES  OR  EXPENSES
+INCLUDING BUT NOT LIMITED TO ANY  INCIDENTAL,  SPECIAL,  INDIRECT,  PUNITIVE  OR
+CONSEQUENTIAL DAMAGES, LOST  PROFITS  OR  LOST  DATA,  COST  OF  PROCUREMENT  OF
+SUBSTITUTE  GOODS,  TECHNOLOGY,  SERVICES,  OR  ANY  CLAIMS  BY  THIRD   PARTIES
+(INCLUDING BUT NOT LIMITED TO ANY DEFENSE  THEREOF),  OR  OTHER  SIMILAR  COSTS.
+*******************************************************************************/
+//DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+#include <string.h>
+
+#include "configuration.h"
+#include "driver/ba414e/drv_ba414e.h"
+#include "drv_ba414e_local.h"
+
+#if defined(DRV_BA414E_SOFTWARE_BACKEND)
+
+#include "nx_crypto_ec.h"
+
+// Scratch memory for one operation, in bytes.  The default covers the
+// largest operands the BA414E takes (DRV_BA414E_MAX_KEY_SIZE).
+#if !defined(DRV_BA414E_SW_SCRATCH_SIZE)
+#define DRV_BA414E_SW_SCRATCH_SIZE         8192
+#endif
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Global Data
+// *****************************************************************************
+// *****************************************************************************
+
+static HN_UBASE swScratch[DRV_BA414E_SW_SCRATCH_SIZE / sizeof(HN_UBASE)];
+static DRV_BA414E_OP_RESULT swResult = DRV_BA414E_OP_ERROR;
+static bool swDone = false;
+
+static const NX_CRYPTO_EC * const swNamedCurves[] =
+{
+    &_nx_crypto_ec_secp192r1,
+    &_nx_crypto_ec_secp224r1,
+    &_nx_crypto_ec_secp256r1,
+    &_nx_crypto_ec_secp384r1,
+};
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Static functions
+// *****************************************************************************
+// *****************************************************************************
+
+// BA414E operands are little-endian and NetX Crypto works on big-endian byte
+// streams, so every operand is reversed on the way in and out.
+static UINT DRV_BA414E_SwLoad(NX_CRYPTO_HUGE_NUMBER * hn, const uint8_t * src, uint32_t len)
+{
+    uint8_t be[DRV_BA414E_MAX_KEY_SIZE];
+    uint32_t i;
+
+    if ((len == 0) || (len > sizeof(be)))
+    {
+        return NX_CRYPTO_SIZE_ERROR;
+    }
+    for (i = 0; i < len; i++)
+    {
+        be[i] = src[len - 1 - i];
+    }
+    return _nx_crypto_huge_number_setup(hn, be, len);
+}
+
+static void DRV_BA414E_SwStore(NX_CRYPTO_HUGE_NUMBER * hn, uint8_t * dst, uint32_t len)
+{
+    uint8_t be[DRV_BA414E_MAX_KEY_SIZE];
+    uint32_t i;
+
+    memset(be, 0, sizeof(be));
+    _nx_crypto_huge_number_extract_fixed_size(hn, be, len);
+    for (i = 0; i < len; i++)
+    {
+        dst[i] = be[len - 1 - i];
+    }
+}
+
+static UINT DRV_BA414E_SwLoadPoint(NX_CRYPTO_EC_POINT * pt, const uint8_t * x, const uint8_t * y, uint32_t len)
+{
+    UINT status = DRV_BA414E_SwLoad(&pt->nx_crypto_ec_point_x, x, len);
+    if (status == NX_CRYPTO_SUCCESS)
+    {
+        status = DRV_BA414E_SwLoad(&pt->nx_crypto_ec_point_y, y, len);
+    }
+    return status;
+}
+
+static DRV_BA414E_OP_RESULT DRV_BA414E_SwStorePoint(NX_CRYPTO_EC_POINT * pt, uint8_t * x, uint8_t * y, uint32_t len)
+{
+    // The point at infinity is returned as (0, 0), as the engine does.
+    if (_nx_crypto_ec_point_is_infinite(pt))
+    {
+        memset(x, 0, len);
+        memset(y, 0, len);
+        return DRV_BA414E_OP_POINT_AT_INFINITY;
+    }
+    DRV_BA414E_SwStore(&pt->nx_crypto_ec_point_x, x, len);
+    DRV_BA414E_SwStore(&pt->nx_crypto_ec_point_y, y, len);
+    return DRV_BA414E_OP_SUCCESS;
+}
+
+static UINT DRV_BA414E_SwBitLength(NX_CRYPTO_HUGE_NUMBER * hn)
+{
+    UINT bits;
+    HN_UBASE top;
+
+    _nx_crypto_huge_number_adjust_size(hn);
+    bits = (hn->nx_crypto_huge_number_size - 1) * NX_CRYPTO_HUGE_NUMBER_BITS;
+    for (top = hn->nx_crypto_huge_number_data[hn->nx_crypto_huge_number_size - 1]; top != 0; top >>= 1)
+    {
+        bits++;
+    }
+    return bits;
+}
+
+// Sets up the curve of a domain.  A domain that matches one of the NetX named
+// curves uses that curve, with its fast reduction and fixed points; any other
+// domain runs on the generic prime field routines, which like the named
+// curves require a = p - 3.
+static DRV_BA414E_OP_RESULT DRV_BA414E_SwCurveSetup(const DRV_BA414E_ECC_DOMAIN * domain,
+        NX_CRYPTO_EC * generic, NX_CRYPTO_EC ** curve, HN_UBASE ** scratch)
+{
+    NX_CRYPTO_HUGE_NUMBER temp;
+    uint32_t len = domain->keySize;
+    uint32_t i;
+
+    if ((len == 0) || (len > DRV_BA414E_MAX_KEY_SIZE) || (domain->cofactor <= 0))
+    {
+        return DRV_BA414E_OP_ERROR;
+    }
+
+    memset(generic, 0, sizeof(NX_CRYPTO_EC));
+    NX_CRYPTO_HUGE_NUMBER_INITIALIZE(&generic->nx_crypto_ec_field.fp, *scratch, len);
+    NX_CRYPTO_HUGE_NUMBER_INITIALIZE(&generic->nx_crypto_ec_a, *scratch, len);
+    NX_CRYPTO_HUGE_NUMBER_INITIALIZE(&generic->nx_crypto_ec_b, *scratch, len);
+    NX_CRYPTO_EC_POINT_INITIALIZE(&generic->nx_crypto_ec_g, NX_CRYPTO_EC_POINT_AFFINE, *scratch, len);
+    NX_CRYPTO_HUGE_NUMBER_INITIALIZE(&generic->nx_crypto_ec_n, *scratch, len);
+    NX_CRYPTO_HUGE_NUMBER_INITIALIZE(&generic->nx_crypto_ec_h, *scratch, sizeof(HN_UBASE));
+    NX_CRYPTO_HUGE_NUMBER_INITIALIZE(&temp, *scratch, len);
+    if ((DRV_BA414E_SwLoad(&generic->nx_crypto_ec_field.fp, domain->primeField, len) != NX_CRYPTO_SUCCESS) ||
+        (DRV_BA414E_SwLoad(&generic->nx_crypto_ec_a, domain->a, len) != NX_CRYPTO_SUCCESS) ||
+        (DRV_BA414E_SwLoad(&generic->nx_crypto_ec_b, domain->b, len) != NX_CRYPTO_SUCCESS) ||
+        (DRV_BA414E_SwLoadPoint(&generic->nx_crypto_ec_g, domain->generatorX, domain->generatorY, len) != NX_CRYPTO_SUCCESS) ||
+        (DRV_BA414E_SwLoad(&generic->nx_crypto_ec_n, domain->order, len) != NX_CRYPTO_SUCCESS))
+    {
+        return DRV_BA414E_OP_ERROR;
+    }
+    NX_CRYPTO_HUGE_NUMBER_SET_DIGIT(&generic->nx_crypto_ec_h, (HN_UBASE)domain->cofactor);
+
+    // The point formulas of NetX Crypto assume a = -3.
+    NX_CRYPTO_HUGE_NUMBER_COPY(&temp, &generic->nx_crypto_ec_field.fp);
+    _nx_crypto_huge_number_subtract_digit_unsigned(&temp, 3);
+    if (_nx_crypto_huge_number_compare_unsigned(&temp, &generic->nx_crypto_ec_a) != NX_CRYPTO_HUGE_NUMBER_EQUAL)
+    {
+        return DRV_BA414E_OP_ERROR;
+    }
+
+    for (i = 0; i < sizeof(swNamedCurves) / sizeof(swNamedCurves[0]); i++)
+    {
+        NX_CRYPTO_EC * named = (NX_CRYPTO_EC *)swNamedCurves[i];
+        if ((named->nx_crypto_ec_bits == (len << 3)) &&
+            (_nx_crypto_huge_number_compare_unsigned(&named->nx_crypto_ec_field.fp, &generic->nx_crypto_ec_field.fp) == NX_CRYPTO_HUGE_NUMBER_EQUAL) &&
+            (_nx_crypto_huge_number_compare_unsigned(&named->nx_crypto_ec_b, &generic->nx_crypto_ec_b) == NX_CRYPTO_HUGE_NUMBER_EQUAL) &&
+            (_nx_crypto_huge_number_compare_unsigned(&named->nx_crypto_ec_n, &generic->nx_crypto_ec_n) == NX_CRYPTO_HUGE_NUMBER_EQUAL) &&
+            (_nx_crypto_huge_number_compare_unsigned(&named->nx_crypto_ec_g.nx_crypto_ec_point_x, &generic->nx_crypto_ec_g.nx_crypto_ec_point_x) == NX_CRYPTO_HUGE_NUMBER_EQUAL) &&
+            (_nx_crypto_huge_number_compare_unsigned(&named->nx_crypto_ec_g.nx_crypto_ec_point_y, &generic->nx_crypto_ec_g.nx_crypto_ec_point_y) == NX_CRYPTO_HUGE_NUMBER_EQUAL))
+        {
+            *curve = named;
+            return DRV_BA414E_OP_SUCCESS;
+        }
+    }
+
+    generic->nx_crypto_ec_name = "ba414e";
+    generic->nx_crypto_ec_bits = DRV_BA414E_SwBitLength(&generic->nx_crypto_ec_n);
+    generic->nx_crypto_ec_add = _nx_crypto_ec_fp_affine_add;
+    generic->nx_crypto_ec_subtract = _nx_crypto_ec_fp_affine_subtract;
+    generic->nx_crypto_ec_multiple = _nx_crypto_ec_fp_projective_multiple;
+    generic->nx_crypto_ec_reduce = _nx_crypto_ec_fp_reduce;
+    *curve = generic;
+    return DRV_BA414E_OP_SUCCESS;
+}
+
+// Returns the generator of the curve when pt is the generator, so that the
+// multiplication can use the fixed points of a named curve.
+static NX_CRYPTO_EC_POINT * DRV_BA414E_SwBasePoint(NX_CRYPTO_EC * curve, NX_CRYPTO_EC_POINT * pt)
+{
+    if ((_nx_crypto_huge_number_compare_unsigned(&pt->nx_crypto_ec_point_x, &curve->nx_crypto_ec_g.nx_crypto_ec_point_x) == NX_CRYPTO_HUGE_NUMBER_EQUAL) &&
+        (_nx_crypto_huge_number_compare_unsigned(&pt->nx_crypto_ec_point_y, &curve->nx_crypto_ec_g.nx_crypto_ec_point_y) == NX_CRYPTO_HUGE_NUMBER_EQUAL))
+    {
+        return &curve->nx_crypto_ec_g;
+    }
+    return pt;
+}
+
+// Loads the leftmost bits of a big-endian hash, as many as the order has.
+static void DRV_BA414E_SwLoadHash(NX_CRYPTO_EC * curve, NX_CRYPTO_HUGE_NUMBER * z,
+        const uint8_t * msgHash, int msgHashSz, uint32_t len)
+{
+    uint32_t hashLen = (msgHashSz > 0) ? (uint32_t)msgHashSz : 0;
+
+    if (hashLen > len)
+    {
+        hashLen = len;
+    }
+    _nx_crypto_huge_number_setup(z, msgHash, hashLen);
+    if (curve->nx_crypto_ec_bits < (hashLen << 3))
+    {
+        _nx_crypto_huge_number_shift_right(z, (hashLen << 3) - curve->nx_crypto_ec_bits);
+    }
+}
+
+static DRV_BA414E_OP_RESULT DRV_BA414E_SwEcdsaSign(const DRV_BA414E_JOB_REQUEST * req)
+{
+    HN_UBASE * scratch = swScratch;
+    NX_CRYPTO_EC generic;
+    NX_CRYPTO_EC * curve;
+    NX_CRYPTO_HUGE_NUMBER d, k, z, r, s, t, kInv;
+    NX_CRYPTO_EC_POINT pt;
+    uint32_t len = req->ecdsaSignParams.domain->keySize;
+
+    if (DRV_BA414E_SwCurveSetup(req->ecdsaSignParams.domain, &generic, &curve, &scratch) != DRV_BA414E_OP_SUCCESS)
+    {
+        return DRV_BA414E_OP_ERROR;
+    }
+    NX_CRYPTO_HUGE_NUMBER_INITIALIZE(&d, scratch, len);
+    NX_CRYPTO_HUGE_NUMBER_INITIALIZE(&k, scratch, len);
+    NX_CRYPTO_HUGE_NUMBER_INITIALIZE(&z, scratch, len);
+    NX_CRYPTO_HUGE_NUMBER_INITIALIZE(&r, scratch, len << 1);
+    NX_CRYPTO_HUGE_NUMBER_INITIALIZE(&s, scratch, (len << 1) + sizeof(HN_UBASE));
+    NX_CRYPTO_HUGE_NUMBER_INITIALIZE(&t, scratch, len);
+    NX_CRYPTO_HUGE_NUMBER_INITIALIZE(&kInv, scratch, len);
+    NX_CRYPTO_EC_POINT_INITIALIZE(&pt, NX_CRYPTO_EC_POINT_AFFINE, scratch, len);
+    if ((DRV_BA414E_SwLoad(&d, req->ecdsaSignParams.privateKey, len) != NX_CRYPTO_SUCCESS) ||
+        (DRV_BA414E_SwLoad(&k, req->ecdsaSignParams.k, len) != NX_CRYPTO_SUCCESS))
+    {
+        return DRV_BA414E_OP_ERROR;
+    }
+    DRV_BA414E_SwLoadHash(curve, &z, req->ecdsaSignParams.msgHash, req->ecdsaSignParams.msgHashSz, len);
+    _nx_crypto_huge_number_modulus(&k, &curve->nx_crypto_ec_n);
+    if (_nx_crypto_huge_number_is_zero(&k))
+    {
+        return DRV_BA414E_OP_ERROR;
+    }
+
+    // r = (kG).x mod n
+    curve->nx_crypto_ec_multiple(curve, &curve->nx_crypto_ec_g, &k, &pt, scratch);
+    NX_CRYPTO_HUGE_NUMBER_COPY(&r, &pt.nx_crypto_ec_point_x);
+    _nx_crypto_huge_number_modulus(&r, &curve->nx_crypto_ec_n);
+    if (_nx_crypto_huge_number_is_zero(&r))
+    {
+        return DRV_BA414E_OP_ERROR;
+    }
+
+    // s = k^-1 (z + rd) mod n
+    _nx_crypto_huge_number_inverse_modulus(&k, &curve->nx_crypto_ec_n, &kInv, scratch);
+    _nx_crypto_huge_number_multiply(&r, &d, &s);
+    _nx_crypto_huge_number_add_unsigned(&s, &z);
+    _nx_crypto_huge_number_modulus(&s, &curve->nx_crypto_ec_n);
+    NX_CRYPTO_HUGE_NUMBER_COPY(&t, &s);
+    _nx_crypto_huge_number_multiply(&t, &kInv, &s);
+    _nx_crypto_huge_number_modulus(&s, &curve->nx_crypto_ec_n);
+    if (_nx_crypto_huge_number_is_zero(&s))
+    {
+        return DRV_BA414E_OP_ERROR;
+    }
+
+    DRV_BA414E_SwStore(&r, req->ecdsaSignParams.R, len);
+    DRV_BA414E_SwStore(&s, req->ecdsaSignParams.S, len);
+    return DRV_BA414E_OP_SUCCESS;
+}
+
+static DRV_BA414E_OP_RESULT DRV_BA414E_SwEcdsaVerify(const DRV_BA414E_JOB_REQUEST * req)
+{
+    HN_UBASE * scratch = swScratch;
+    NX_CRYPTO_EC generic;
+    NX_CRYPTO_EC * curve;
+    NX_CRYPTO_HUGE_NUMBER z, r, s, w, u1, u2;
+    NX_CRYPTO_EC_POINT q, pt;
+    uint32_t len = req->ecdsaVerifyParams.domain->keySize;
+
+    if (DRV_BA414E_SwCurveSetup(req->ecdsaVerifyParams.domain, &generic, &curve, &scratch) != DRV_BA414E_OP_SUCCESS)
+    {
+        return DRV_BA414E_OP_ERROR;
+    }
+    NX_CRYPTO_HUGE_NUMBER_INITIALIZE(&z, scratch, len);
+    NX_CRYPTO_HUGE_NUMBER_INITIALIZE(&r, scratch, len);
+    NX_CRYPTO_HUGE_NUMBER_INITIALIZE(&s, scratch, len);
+    NX_CRYPTO_HUGE_NUMBER_INITIALIZE(&w, scratch, len);
+    NX_CRYPTO_HUGE_NUMBER_INITIALIZE(&u1, scratch, len << 1);
+    NX_CRYPTO_HUGE_NUMBER_INITIALIZE(&u2, scratch, len << 1);
+    NX_CRYPTO_EC_POINT_INITIALIZE(&q, NX_CRYPTO_EC_POINT_AFFINE, scratch, len);
+    NX_CRYPTO_EC_POINT_INITIALIZE(&pt, NX_CRYPTO_EC_POINT_AFFINE, scratch, len);
+    if ((DRV_BA414E_SwLoadPoint(&q, req->ecdsaVerifyParams.publicKeyX, req->ecdsaVerifyParams.publicKeyY, len) != NX_CRYPTO_SUCCESS) ||
+        (DRV_BA414E_SwLoad(&r, req->ecdsaVerifyParams.R, len) != NX_CRYPTO_SUCCESS) ||
+        (DRV_BA414E_SwLoad(&s, req->ecdsaVerifyParams.S, len) != NX_CRYPTO_SUCCESS))
+    {
+        return DRV_BA414E_OP_ERROR;
+    }
+    DRV_BA414E_SwLoadHash(curve, &z, req->ecdsaVerifyParams.msgHash, req->ecdsaVerifyParams.msgHashSz, len);
+
+    // r and s must be in [1, n - 1]
+    if (_nx_crypto_huge_number_is_zero(&r) || _nx_crypto_huge_number_is_zero(&s) ||
+        (_nx_crypto_huge_number_compare_unsigned(&r, &curve->nx_crypto_ec_n) != NX_CRYPTO_HUGE_NUMBER_LESS) ||
+        (_nx_crypto_huge_number_compare_unsigned(&s, &curve->nx_crypto_ec_n) != NX_CRYPTO_HUGE_NUMBER_LESS))
+    {
+        return DRV_BA414E_OP_SIGN_VERIFY_FAIL;
+    }
+
+    // w = s^-1, u1 = zw, u2 = rw mod n, then (u1G + u2Q).x mod n must be r
+    _nx_crypto_huge_number_inverse_modulus(&s, &curve->nx_crypto_ec_n, &w, scratch);
+    _nx_crypto_huge_number_multiply(&z, &w, &u1);
+    _nx_crypto_huge_number_modulus(&u1, &curve->nx_crypto_ec_n);
+    _nx_crypto_huge_number_multiply(&r, &w, &u2);
+    _nx_crypto_huge_number_modulus(&u2, &curve->nx_crypto_ec_n);
+    _nx_crypto_ec_fp_joint_multiple(curve, &curve->nx_crypto_ec_g, &u1, &q, &u2, &pt, scratch);
+    if (_nx_crypto_ec_point_is_infinite(&pt))
+    {
+        return DRV_BA414E_OP_SIGN_VERIFY_FAIL;
+    }
+    _nx_crypto_huge_number_modulus(&pt.nx_crypto_ec_point_x, &curve->nx_crypto_ec_n);
+    if (_nx_crypto_huge_number_compare_unsigned(&pt.nx_crypto_ec_point_x, &r) != NX_CRYPTO_HUGE_NUMBER_EQUAL)
+    {
+        return DRV_BA414E_OP_SIGN_VERIFY_FAIL;
+    }
+    return DRV_BA414E_OP_SUCCESS;
+}
+
+// Adds p2 to p1 in place.  The NetX affine addition does not handle
+// P + (-P), nor doubling a point with y = 0, which both give infinity.
+static void DRV_BA414E_SwPointAdd(NX_CRYPTO_EC * curve, NX_CRYPTO_EC_POINT * p1,
+        NX_CRYPTO_EC_POINT * p2, HN_UBASE * scratch)
+{
+    if ((!_nx_crypto_ec_point_is_infinite(p1)) && (!_nx_crypto_ec_point_is_infinite(p2)) &&
+        (_nx_crypto_huge_number_compare_unsigned(&p1->nx_crypto_ec_point_x, &p2->nx_crypto_ec_point_x) == NX_CRYPTO_HUGE_NUMBER_EQUAL))
+    {
+        if ((_nx_crypto_huge_number_compare_unsigned(&p1->nx_crypto_ec_point_y, &p2->nx_crypto_ec_point_y) != NX_CRYPTO_HUGE_NUMBER_EQUAL) ||
+            _nx_crypto_huge_number_is_zero(&p1->nx_crypto_ec_point_y))
+        {
+            _nx_crypto_ec_point_set_infinite(p1);
+            return;
+        }
+    }
+    curve->nx_crypto_ec_add(curve, p1, p2, scratch);
+}
+
+static DRV_BA414E_OP_RESULT DRV_BA414E_SwEccPointDouble(const DRV_BA414E_JOB_REQUEST * req)
+{
+    HN_UBASE * scratch = swScratch;
+    NX_CRYPTO_EC generic;
+    NX_CRYPTO_EC * curve;
+    NX_CRYPTO_EC_POINT p1, p3;
+    uint32_t len = req->eccPointDoubleParams.domain->keySize;
+
+    if (DRV_BA414E_SwCurveSetup(req->eccPointDoubleParams.domain, &generic, &curve, &scratch) != DRV_BA414E_OP_SUCCESS)
+    {
+        return DRV_BA414E_OP_ERROR;
+    }
+    NX_CRYPTO_EC_POINT_INITIALIZE(&p1, NX_CRYPTO_EC_POINT_AFFINE, scratch, len);
+    NX_CRYPTO_EC_POINT_INITIALIZE(&p3, NX_CRYPTO_EC_POINT_AFFINE, scratch, len);
+    if (DRV_BA414E_SwLoadPoint(&p1, req->eccPointDoubleParams.p1X, req->eccPointDoubleParams.p1Y, len) != NX_CRYPTO_SUCCESS)
+    {
+        return DRV_BA414E_OP_ERROR;
+    }
+    NX_CRYPTO_HUGE_NUMBER_COPY(&p3.nx_crypto_ec_point_x, &p1.nx_crypto_ec_point_x);
+    NX_CRYPTO_HUGE_NUMBER_COPY(&p3.nx_crypto_ec_point_y, &p1.nx_crypto_ec_point_y);
+    DRV_BA414E_SwPointAdd(curve, &p3, &p1, scratch);
+    return DRV_BA414E_SwStorePoint(&p3, req->eccPointDoubleParams.outX, req->eccPointDoubleParams.outY, len);
+}
+
+static DRV_BA414E_OP_RESULT DRV_BA414E_SwEccPointAddition(const DRV_BA414E_JOB_REQUEST * req)
+{
+    HN_UBASE * scratch = swScratch;
+    NX_CRYPTO_EC generic;
+    NX_CRYPTO_EC * curve;
+    NX_CRYPTO_EC_POINT p1, p2;
+    uint32_t len = req->eccPointAdditionParams.domain->keySize;
+
+    if (DRV_BA414E_SwCurveSetup(req->eccPointAdditionParams.domain, &generic, &curve, &scratch) != DRV_BA414E_OP_SUCCESS)
+    {
+        return DRV_BA414E_OP_ERROR;
+    }
+    NX_CRYPTO_EC_POINT_INITIALIZE(&p1, NX_CRYPTO_EC_POINT_AFFINE, scratch, len);
+    NX_CRYPTO_EC_POINT_INITIALIZE(&p2, NX_CRYPTO_EC_POINT_AFFINE, scratch, len);
+    if ((DRV_BA414E_SwLoadPoint(&p1, req->eccPointAdditionParams.p1X, req->eccPointAdditionParams.p1Y, len) != NX_CRYPTO_SUCCESS) ||
+        (DRV_BA414E_SwLoadPoint(&p2, req->eccPointAdditionParams.p2X, req->eccPointAdditionParams.p2Y, len) != NX_CRYPTO_SUCCESS))
+    {
+        return DRV_BA414E_OP_ERROR;
+    }
+    DRV_BA414E_SwPointAdd(curve, &p1, &p2, scratch);
+    return DRV_BA414E_SwStorePoint(&p1, req->eccPointAdditionParams.outX, req->eccPointAdditionParams.outY, len);
+}
+
+static DRV_BA414E_OP_RESULT DRV_BA414E_SwEccPointMultiplication(const DRV_BA414E_JOB_REQUEST * req)
+{
+    HN_UBASE * scratch = swScratch;
+    NX_CRYPTO_EC generic;
+    NX_CRYPTO_EC * curve;
+    NX_CRYPTO_EC_POINT p1, p3;
+    NX_CRYPTO_HUGE_NUMBER k;
+    uint32_t len = req->eccPointMultiplicationParams.domain->keySize;
+
+    if (DRV_BA414E_SwCurveSetup(req->eccPointMultiplicationParams.domain, &generic, &curve, &scratch) != DRV_BA414E_OP_SUCCESS)
+    {
+        return DRV_BA414E_OP_ERROR;
+    }
+    NX_CRYPTO_EC_POINT_INITIALIZE(&p1, NX_CRYPTO_EC_POINT_AFFINE, scratch, len);
+    NX_CRYPTO_EC_POINT_INITIALIZE(&p3, NX_CRYPTO_EC_POINT_AFFINE, scratch, len);
+    NX_CRYPTO_HUGE_NUMBER_INITIALIZE(&k, scratch, len);
+    if ((DRV_BA414E_SwLoadPoint(&p1, req->eccPointMultiplicationParams.p1X, req->eccPointMultiplicationParams.p1Y, len) != NX_CRYPTO_SUCCESS) ||
+        (DRV_BA414E_SwLoad(&k, req->eccPointMultiplicationParams.k, len) != NX_CRYPTO_SUCCESS))
+    {
+        return DRV_BA414E_OP_ERROR;
+    }
+    _nx_crypto_huge_number_modulus(&k, &curve->nx_crypto_ec_n);
+    if (_nx_crypto_huge_number_is_zero(&k) || _nx_crypto_ec_point_is_infinite(&p1))
+    {
+        _nx_crypto_ec_point_set_infinite(&p3);
+    }
+    else
+    {
+        curve->nx_crypto_ec_multiple(curve, DRV_BA414E_SwBasePoint(curve, &p1), &k, &p3, scratch);
+    }
+    return DRV_BA414E_SwStorePoint(&p3, req->eccPointMultiplicationParams.outX, req->eccPointMultiplicationParams.outY, len);
+}
+
+static DRV_BA414E_OP_RESULT DRV_BA414E_SwEccCheckPointOnCurve(const DRV_BA414E_JOB_REQUEST * req)
+{
+    HN_UBASE * scratch = swScratch;
+    NX_CRYPTO_EC generic;
+    NX_CRYPTO_EC * curve;
+    NX_CRYPTO_EC_POINT p1;
+    NX_CRYPTO_HUGE_NUMBER lhs, rhs, temp;
+    uint32_t len = req->eccCheckPointOnCurveParams.domain->keySize;
+
+    if (DRV_BA414E_SwCurveSetup(req->eccCheckPointOnCurveParams.domain, &generic, &curve, &scratch) != DRV_BA414E_OP_SUCCESS)
+    {
+        return DRV_BA414E_OP_ERROR;
+    }
+    NX_CRYPTO_EC_POINT_INITIALIZE(&p1, NX_CRYPTO_EC_POINT_AFFINE, scratch, len);
+    NX_CRYPTO_HUGE_NUMBER_INITIALIZE(&lhs, scratch, len << 1);
+    NX_CRYPTO_HUGE_NUMBER_INITIALIZE(&rhs, scratch, (len << 1) + sizeof(HN_UBASE));
+    NX_CRYPTO_HUGE_NUMBER_INITIALIZE(&temp, scratch, len << 1);
+    if (DRV_BA414E_SwLoadPoint(&p1, req->eccCheckPointOnCurveParams.p1X, req->eccCheckPointOnCurveParams.p1Y, len) != NX_CRYPTO_SUCCESS)
+    {
+        return DRV_BA414E_OP_ERROR;
+    }
+    if ((_nx_crypto_huge_number_compare_unsigned(&p1.nx_crypto_ec_point_x, &curve->nx_crypto_ec_field.fp) != NX_CRYPTO_HUGE_NUMBER_LESS) ||
+        (_nx_crypto_huge_number_compare_unsigned(&p1.nx_crypto_ec_point_y, &curve->nx_crypto_ec_field.fp) != NX_CRYPTO_HUGE_NUMBER_LESS))
+    {
+        return DRV_BA414E_OP_POINT_NOT_ON_CURVE;
+    }
+
+    // y^2 = x^3 + ax + b mod p
+    _nx_crypto_huge_number_square(&p1.nx_crypto_ec_point_y, &lhs);
+    _nx_crypto_huge_number_modulus(&lhs, &curve->nx_crypto_ec_field.fp);
+    _nx_crypto_huge_number_square(&p1.nx_crypto_ec_point_x, &temp);
+    _nx_crypto_huge_number_modulus(&temp, &curve->nx_crypto_ec_field.fp);
+    _nx_crypto_huge_number_add_unsigned(&temp, &curve->nx_crypto_ec_a);
+    _nx_crypto_huge_number_modulus(&temp, &curve->nx_crypto_ec_field.fp);
+    _nx_crypto_huge_number_multiply(&temp, &p1.nx_crypto_ec_point_x, &rhs);
+    _nx_crypto_huge_number_add_unsigned(&rhs, &curve->nx_crypto_ec_b);
+    _nx_crypto_huge_number_modulus(&rhs, &curve->nx_crypto_ec_field.fp);
+    if (_nx_crypto_huge_number_compare_unsigned(&lhs, &rhs) != NX_CRYPTO_HUGE_NUMBER_EQUAL)
+    {
+        return DRV_BA414E_OP_POINT_NOT_ON_CURVE;
+    }
+    return DRV_BA414E_OP_SUCCESS;
+}
+
+static DRV_BA414E_OP_RESULT DRV_BA414E_SwModOp(const DRV_BA414E_JOB_REQUEST * req)
+{
+    HN_UBASE * scratch = swScratch;
+    NX_CRYPTO_HUGE_NUMBER p, a, b, c;
+    uint32_t len = req->modOperationParams.opSize * 8;
+
+    if ((req->modOperationParams.opSize < DRV_BA414E_OPSZ_128) || (len > DRV_BA414E_MAX_KEY_SIZE))
+    {
+        return DRV_BA414E_OP_ERROR;
+    }
+    NX_CRYPTO_HUGE_NUMBER_INITIALIZE(&p, scratch, len);
+    NX_CRYPTO_HUGE_NUMBER_INITIALIZE(&a, scratch, len << 1);
+    NX_CRYPTO_HUGE_NUMBER_INITIALIZE(&b, scratch, len);
+    NX_CRYPTO_HUGE_NUMBER_INITIALIZE(&c, scratch, len << 1);
+    if ((DRV_BA414E_SwLoad(&p, req->modOperationParams.p, len) != NX_CRYPTO_SUCCESS) ||
+        (DRV_BA414E_SwLoad(&a, req->modOperationParams.a, len) != NX_CRYPTO_SUCCESS) ||
+        (DRV_BA414E_SwLoad(&b, req->modOperationParams.b, len) != NX_CRYPTO_SUCCESS) ||
+        _nx_crypto_huge_number_is_zero(&p))
+    {
+        return DRV_BA414E_OP_ERROR;
+    }
+    _nx_crypto_huge_number_modulus(&a, &p);
+    _nx_crypto_huge_number_modulus(&b, &p);
+    switch (req->operation)
+    {
+        case DRV_BA414E_OP_PRIM_MOD_ADDITION:
+            _nx_crypto_huge_number_add_unsigned(&a, &b);
+            NX_CRYPTO_HUGE_NUMBER_COPY(&c, &a);
+            break;
+        case DRV_BA414E_OP_PRIM_MOD_SUBTRACTION:
+            if (_nx_crypto_huge_number_compare_unsigned(&a, &b) == NX_CRYPTO_HUGE_NUMBER_LESS)
+            {
+                _nx_crypto_huge_number_add_unsigned(&a, &p);
+            }
+            _nx_crypto_huge_number_subtract_unsigned(&a, &b, &c);
+            break;
+        case DRV_BA414E_OP_PRIM_MOD_MULTIPLICATION:
+        default:
+            _nx_crypto_huge_number_multiply(&a, &b, &c);
+            break;
+    }
+    _nx_crypto_huge_number_modulus(&c, &p);
+    DRV_BA414E_SwStore(&c, req->modOperationParams.c, len);
+    return DRV_BA414E_OP_SUCCESS;
+}
+
+static DRV_BA414E_OP_RESULT DRV_BA414E_SwModExp(const DRV_BA414E_JOB_REQUEST * req)
+{
+    HN_UBASE * scratch = swScratch;
+    NX_CRYPTO_HUGE_NUMBER n, m, e, c;
+    uint32_t len = req->modExpParams.opSize * 8;
+
+    if ((req->modExpParams.opSize < DRV_BA414E_OPSZ_128) || (len > DRV_BA414E_MAX_KEY_SIZE))
+    {
+        return DRV_BA414E_OP_ERROR;
+    }
+    NX_CRYPTO_HUGE_NUMBER_INITIALIZE(&n, scratch, len);
+    NX_CRYPTO_HUGE_NUMBER_INITIALIZE(&m, scratch, len << 1);
+    NX_CRYPTO_HUGE_NUMBER_INITIALIZE(&e, scratch, len);
+    NX_CRYPTO_HUGE_NUMBER_INITIALIZE(&c, scratch, len << 1);
+    if ((DRV_BA414E_SwLoad(&n, req->modExpParams.n, len) != NX_CRYPTO_SUCCESS) ||
+        (DRV_BA414E_SwLoad(&m, req->modExpParams.M, len) != NX_CRYPTO_SUCCESS) ||
+        (DRV_BA414E_SwLoad(&e, req->modExpParams.e, len) != NX_CRYPTO_SUCCESS) ||
+        _nx_crypto_huge_number_is_zero(&n))
+    {
+        return DRV_BA414E_OP_ERROR;
+    }
+    _nx_crypto_huge_number_modulus(&m, &n);
+    if (_nx_crypto_huge_number_is_zero(&e))
+    {
+        NX_CRYPTO_HUGE_NUMBER_SET_DIGIT(&c, 1);
+    }
+    else if (NX_CRYPTO_HUGE_NUMBER_IS_EVEN(&n))
+    {
+        // Montgomery reduction needs an odd modulus.
+        _nx_crypto_huge_number_power_modulus(&m, &e, &n, &c, scratch);
+    }
+    else
+    {
+        _nx_crypto_huge_number_mont_power_modulus(&m, &e, &n, &c, scratch);
+    }
+    _nx_crypto_huge_number_modulus(&c, &n);
+    DRV_BA414E_SwStore(&c, req->modExpParams.C, len);
+    return DRV_BA414E_OP_SUCCESS;
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: BA414E Driver Backend Implementation
+// *****************************************************************************
+// *****************************************************************************
+
+void DRV_BA414E_BackendInitialize(void)
+{
+    swDone = false;
+}
+
+// Runs the operation to completion; the driver task picks up the result in
+// its next state.
+void DRV_BA414E_BackendStart(const DRV_BA414E_JOB_REQUEST * req)
+{
+    switch(req->operation)
+    {
+        case DRV_BA414E_OP_ECDSA_SIGN:
+            swResult = DRV_BA414E_SwEcdsaSign(req);
+            break;
+        case DRV_BA414E_OP_ECDSA_VERIFY:
+            swResult = DRV_BA414E_SwEcdsaVerify(req);
+            break;
+        case DRV_BA414E_OP_PRIM_ECC_POINT_DOUBLE:
+            swResult = DRV_BA414E_SwEccPointDouble(req);
+            break;
+        case DRV_BA414E_OP_PRIM_ECC_POINT_ADDITION:
+            swResult = DRV_BA414E_SwEccPointAddition(req);
+            break;
+        case DRV_BA414E_OP_PRIM_ECC_POINT_MULTIPLICATION:
+            swResult = DRV_BA414E_SwEccPointMultiplication(req);
+            break;
+        case DRV_BA414E_OP_PRIM_ECC_CHECK_POINT_ON_CURVE:
+            swResult = DRV_BA414E_SwEccCheckPointOnCurve(req);
+            break;
+        case DRV_BA414E_OP_PRIM_MOD_ADDITION:
+        case DRV_BA414E_OP_PRIM_MOD_SUBTRACTION:
+        case DRV_BA414E_OP_PRIM_MOD_MULTIPLICATION:
+            swResult = DRV_BA414E_SwModOp(req);
+            break;
+        case DRV_BA414E_OP_PRIM_MOD_EXP:
+            swResult = DRV_BA414E_SwModExp(req);
+            break;
+        case DRV_BA414E_OP_NONE:
+        default:
+            swResult = DRV_BA414E_OP_ERROR;
+            break;
+    }
+    swDone = true;
+    DRV_BA414E_OperationDone();
+}
+
+bool DRV_BA414E_BackendIsDone(void)
+{
+    return swDone;
+}
+
+DRV_BA414E_OP_RESULT DRV_BA414E_BackendFinish(const DRV_BA414E_JOB_REQUEST * req)
+{
+    (void)req;
+    swDone = false;
+    return swResult;
+}
+
+#endif // DRV_BA414E_SOFTWARE_BACKEND
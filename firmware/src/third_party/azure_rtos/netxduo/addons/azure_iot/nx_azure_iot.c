@@ -37,6 +37,7 @@ static VOID(*_nx_azure_iot_log_callback)(az_log_classification classification, U
 
 extern UINT _nxd_mqtt_client_publish_packet_send(NXD_MQTT_CLIENT *client_ptr, NX_PACKET *packet_ptr,
                                                  USHORT packet_id, UINT QoS, ULONG wait_option);
+extern UINT _nxd_mqtt_client_publish_packet_flush(NXD_MQTT_CLIENT *client_ptr, ULONG wait_option);
 
 static VOID nx_azure_iot_event_process(VOID *nx_azure_iot, ULONG common_events, ULONG module_own_events)
 {
@@ -251,6 +252,9 @@ UINT status;
     nx_azure_iot_ptr -> nx_azure_iot_dns_ptr = dns_ptr;
     nx_azure_iot_ptr -> nx_azure_iot_pool_ptr = pool_ptr;
     nx_azure_iot_ptr -> nx_azure_iot_unix_time_get = unix_time_callback;
+#ifdef NX_SECURE_TLS_ENABLE_CLIENT_SESSION_CACHE
+    nx_azure_iot_ptr -> nx_azure_iot_tls_session_cache = NX_NULL;
+#endif /* NX_SECURE_TLS_ENABLE_CLIENT_SESSION_CACHE */
 
     status = nx_cloud_create(&nx_azure_iot_ptr -> nx_azure_iot_cloud, (CHAR *)name_ptr, stack_memory_ptr,
                              stack_memory_size, priority);
@@ -405,6 +409,15 @@ USHORT id = 0;
         return(status);
     }
 
+    /* Send the message now rather than wait for more data. The packet has been sent and callers
+       release it on failure, so a failure here is not returned. The MQTT client handles it as a
+       network disconnect.  */
+    status = _nxd_mqtt_client_publish_packet_flush(client_ptr, wait_option);
+    if (status)
+    {
+        LogError(LogLiteralArgs("Mqtt client send fail: PUBLISH FLUSH FAIL status: %d"), status);
+    }
+
     return(NX_AZURE_IOT_SUCCESS);
 }
 
@@ -693,6 +706,22 @@ NX_AZURE_IOT_RESOURCE *resource_ptr;
     nx_secure_tls_session_time_function_set(tls_session, nx_azure_iot_tls_time_function);
 #endif /* NX_AZURE_IOT_DISABLE_CERTIFICATE_DATE */
 
+#ifdef NX_SECURE_TLS_ENABLE_CLIENT_SESSION_CACHE
+    /* Attach the session cache so a reconnect to the same endpoint can resume.  */
+    if (_nx_azure_iot_created_ptr -> nx_azure_iot_tls_session_cache != NX_NULL)
+    {
+        status = nx_secure_tls_session_cache_set(tls_session,
+                                                 _nx_azure_iot_created_ptr -> nx_azure_iot_tls_session_cache,
+                                                 resource_ptr -> resource_hostname,
+                                                 resource_ptr -> resource_hostname_length);
+        if (status)
+        {
+            LogError(LogLiteralArgs("Failed to set the session cache: status: %d"), status);
+            return(status);
+        }
+    }
+#endif /* NX_SECURE_TLS_ENABLE_CLIENT_SESSION_CACHE */
+
     return(NX_AZURE_IOT_SUCCESS);
 }
 
@@ -710,6 +739,22 @@ UINT nx_azure_iot_unix_time_get(NX_AZURE_IOT *nx_azure_iot_ptr, ULONG *unix_time
     return(nx_azure_iot_ptr -> nx_azure_iot_unix_time_get(unix_time));
 }
 
+#ifdef NX_SECURE_TLS_ENABLE_CLIENT_SESSION_CACHE
+UINT nx_azure_iot_tls_session_cache_set(NX_AZURE_IOT *nx_azure_iot_ptr, NX_SECURE_TLS_SESSION_CACHE *cache_ptr)
+{
+
+    if (nx_azure_iot_ptr == NX_NULL)
+    {
+        LogError(LogLiteralArgs("IoT session cache set fail: INVALID POINTER"));
+        return(NX_AZURE_IOT_INVALID_PARAMETER);
+    }
+
+    nx_azure_iot_ptr -> nx_azure_iot_tls_session_cache = cache_ptr;
+
+    return(NX_AZURE_IOT_SUCCESS);
+}
+#endif /* NX_SECURE_TLS_ENABLE_CLIENT_SESSION_CACHE */
+
 /* HMAC-SHA256(master key, message ) */
 static UINT nx_azure_iot_hmac_sha256_calculate(NX_AZURE_IOT_RESOURCE *resource_ptr, UCHAR *key, UINT key_size,
                                                const UCHAR *message, UINT message_size, UCHAR *output)
@@ -214,6 +214,9 @@ typedef struct NX_AZURE_IOT_STRUCT
                                           ULONG common_events, ULONG module_own_events);
     struct NX_AZURE_IOT_RESOURCE_STRUCT   *nx_azure_iot_resource_list_header;
     UINT                                 (*nx_azure_iot_unix_time_get)(ULONG *unix_time);
+#ifdef NX_SECURE_TLS_ENABLE_CLIENT_SESSION_CACHE
+    NX_SECURE_TLS_SESSION_CACHE           *nx_azure_iot_tls_session_cache;
+#endif /* NX_SECURE_TLS_ENABLE_CLIENT_SESSION_CACHE */
 } NX_AZURE_IOT;
 
 typedef struct NX_AZURE_IOT_THREAD_STRUCT
@@ -287,6 +290,24 @@ UINT nx_azure_iot_delete(NX_AZURE_IOT *nx_azure_iot_ptr);
  */
 UINT nx_azure_iot_unix_time_get(NX_AZURE_IOT *nx_azure_iot_ptr, ULONG *unix_time);
 
+#ifdef NX_SECURE_TLS_ENABLE_CLIENT_SESSION_CACHE
+/**
+ * @brief Set the TLS session cache used to resume connections
+ *
+ * @details Every TLS session set up by this instance is attached to the given cache, keyed by
+ *          the endpoint hostname, so that a reconnect can resume the previous session with an
+ *          abbreviated handshake. The cache must be created with nx_secure_tls_session_cache_create
+ *          and must outlive the instance. Pass NX_NULL to stop resuming sessions.
+ *
+ * @param[in] nx_azure_iot_ptr A pointer to a #NX_AZURE_IOT.
+ * @param[in] cache_ptr A pointer to a `NX_SECURE_TLS_SESSION_CACHE`.
+ * @return A `UINT` with the result of the API.
+ *   @retval #NX_AZURE_IOT_SUCCESS Successfully set the session cache.
+ *   @retval #NX_AZURE_IOT_INVALID_PARAMETER Fail to set the session cache due to invalid parameter.
+ */
+UINT nx_azure_iot_tls_session_cache_set(NX_AZURE_IOT *nx_azure_iot_ptr, NX_SECURE_TLS_SESSION_CACHE *cache_ptr);
+#endif /* NX_SECURE_TLS_ENABLE_CLIENT_SESSION_CACHE */
+
 /**
  * @brief Initialize logging
  *
@@ -59,6 +59,9 @@ static VOID _nxd_mqtt_release_transmit_packet(NXD_MQTT_CLIENT *client_ptr, NX_PA
 static VOID _nxd_mqtt_release_receive_packet(NXD_MQTT_CLIENT *client_ptr, NX_PACKET *packet_ptr, NX_PACKET *previous_packet_ptr);
 static UINT _nxd_mqtt_client_retransmit_message(NXD_MQTT_CLIENT *client_ptr, ULONG wait_option);
 static UINT _nxd_mqtt_client_connect_packet_send(NXD_MQTT_CLIENT *client_ptr, ULONG wait_option);
+#if defined(NX_SECURE_ENABLE) && defined(NX_SECURE_TLS_ENABLE_SEND_COALESCING)
+static UINT _nxd_mqtt_client_tls_flush(NXD_MQTT_CLIENT *client_ptr, ULONG wait_option);
+#endif /* NX_SECURE_ENABLE && NX_SECURE_TLS_ENABLE_SEND_COALESCING */
 
 /**************************************************************************/
 /*                                                                        */
@@ -284,6 +287,7 @@ ULONG  bytes_copied;
 /*    tx_mutex_put                                                        */
 /*    nx_tcp_socket_send                                                  */
 /*    nx_secure_tls_session_send                                          */
+/*    _nxd_mqtt_client_tls_flush                                          */
 /*    nx_packet_release                                                   */
 /*    _nxd_mqtt_copy_transmit_packet                                      */
 /*                                                                        */
@@ -482,6 +486,14 @@ UCHAR               temp_data[2];
 
         ret = NXD_MQTT_COMMUNICATION_FAILURE;
     }
+#if defined(NX_SECURE_ENABLE) && defined(NX_SECURE_TLS_ENABLE_SEND_COALESCING)
+    else
+    {
+
+        /* Send the request now rather than wait for more data. */
+        ret = _nxd_mqtt_client_tls_flush(client_ptr, NX_WAIT_FOREVER);
+    }
+#endif /* NX_SECURE_ENABLE && NX_SECURE_TLS_ENABLE_SEND_COALESCING */
 
     return(ret);
 }
@@ -578,6 +590,60 @@ UINT status = NXD_MQTT_SUCCESS;
     return(NXD_MQTT_SUCCESS);
 }
 
+#if defined(NX_SECURE_ENABLE) && defined(NX_SECURE_TLS_ENABLE_SEND_COALESCING)
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nxd_mqtt_client_tls_flush                          PORTABLE C      */
+/*                                                           6.1          */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This internal function sends the data TLS has held back for         */
+/*    coalescing, so that MQTT control packets are not delayed. It does   */
+/*    nothing if the client is not using TLS.                             */
+/*                                                                        */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    client_ptr                            Pointer to MQTT Client        */
+/*    wait_option                           Timeout value                 */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    nx_secure_tls_session_send_flush      Send held TLS data            */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nxd_mqtt_client_sub_unsub                                          */
+/*    _nxd_mqtt_packet_receive_process                                    */
+/*    _nxd_mqtt_client_connect_packet_send                                */
+/*    _nxd_mqtt_client_publish_packet_flush                               */
+/*    _nxd_mqtt_send_simple_message                                       */
+/*                                                                        */
+/**************************************************************************/
+static UINT _nxd_mqtt_client_tls_flush(NXD_MQTT_CLIENT *client_ptr, ULONG wait_option)
+{
+
+    if (!client_ptr -> nxd_mqtt_client_use_tls)
+    {
+        return(NXD_MQTT_SUCCESS);
+    }
+
+    if (nx_secure_tls_session_send_flush(&(client_ptr -> nxd_mqtt_tls_session), wait_option))
+    {
+        return(NXD_MQTT_COMMUNICATION_FAILURE);
+    }
+
+    return(NXD_MQTT_SUCCESS);
+}
+#endif /* NX_SECURE_ENABLE && NX_SECURE_TLS_ENABLE_SEND_COALESCING */
+
 /**************************************************************************/
 /*                                                                        */
 /*  FUNCTION                                               RELEASE        */
@@ -2030,6 +2096,7 @@ UCHAR       fixed_header;
 /*  CALLS                                                                 */
 /*                                                                        */
 /*    nx_secure_tls_session_receive                                       */
+/*    _nxd_mqtt_client_tls_flush                                          */
 /*    nx_tcp_socket_receive                                               */
 /*    _nxd_mqtt_process_publish                                           */
 /*    _nxd_mqtt_process_publish_response                                  */
@@ -2083,6 +2150,18 @@ ULONG      packet_length;
         status = nx_tcp_socket_receive(&client_ptr -> nxd_mqtt_client_socket, &packet_ptr, NX_NO_WAIT);
 #endif /* NX_SECURE_ENABLE */
 
+#if defined(NX_SECURE_ENABLE) && defined(NX_SECURE_TLS_ENABLE_SEND_COALESCING)
+        if (status == NX_NO_PACKET)
+        {
+
+            /* Send the acknowledgements for the packets just processed together. */
+            if (_nxd_mqtt_client_tls_flush(client_ptr, NX_WAIT_FOREVER))
+            {
+                status = NXD_MQTT_COMMUNICATION_FAILURE;
+            }
+        }
+#endif /* NX_SECURE_ENABLE && NX_SECURE_TLS_ENABLE_SEND_COALESCING */
+
         if (status != NX_SUCCESS)
         {
             if (status != NX_NO_PACKET)
@@ -4071,6 +4150,7 @@ UINT                 old_priority;
 /*    nx_packet_release                                                   */
 /*    nx_tcp_socket_send                                                  */
 /*    nx_secure_tls_session_send                                          */
+/*    _nxd_mqtt_client_tls_flush                                          */
 /*    _nxd_mqtt_packet_allocate                                           */
 /*    _nxd_mqtt_release_transmit_packet                                   */
 /*    _nxd_mqtt_client_connection_end                                     */
@@ -4283,6 +4363,14 @@ UINT                 keepalive = (client_ptr -> nxd_mqtt_keepalive/NX_IP_PERIODI
         /* Release the packet. */
         nx_packet_release(packet_ptr);
     }
+#if defined(NX_SECURE_ENABLE) && defined(NX_SECURE_TLS_ENABLE_SEND_COALESCING)
+    else
+    {
+
+        /* Send the connect message now rather than wait for more data. */
+        status = _nxd_mqtt_client_tls_flush(client_ptr, wait_option);
+    }
+#endif /* NX_SECURE_ENABLE && NX_SECURE_TLS_ENABLE_SEND_COALESCING */
 
     /* Update the timeout value. */
     client_ptr -> nxd_mqtt_timeout = tx_time_get() + client_ptr -> nxd_mqtt_keepalive;
@@ -4593,6 +4681,67 @@ UINT       ret = NXD_MQTT_SUCCESS;
     return(ret);
 }
 
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nxd_mqtt_client_publish_packet_flush               PORTABLE C      */
+/*                                                           6.1          */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function sends a publish packet that TLS has held back for     */
+/*    coalescing, after _nxd_mqtt_client_publish_packet_send succeeded.   */
+/*    The packet belongs to TLS at this point, so the caller must not     */
+/*    release it if this function fails. A failure is also reported as a  */
+/*    network disconnect. Without TLS send coalescing nothing is held     */
+/*    back and this function does nothing.                                */
+/*                                                                        */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    client_ptr                            Pointer to MQTT Client        */
+/*    wait_option                           Suspension option             */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nxd_mqtt_client_tls_flush                                          */
+/*    tx_event_flags_set                                                  */
+/*    nx_cloud_module_event_set                                           */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nxd_mqtt_client_publish                                            */
+/*                                                                        */
+/**************************************************************************/
+UINT _nxd_mqtt_client_publish_packet_flush(NXD_MQTT_CLIENT *client_ptr, ULONG wait_option)
+{
+
+#if defined(NX_SECURE_ENABLE) && defined(NX_SECURE_TLS_ENABLE_SEND_COALESCING)
+    if (_nxd_mqtt_client_tls_flush(client_ptr, wait_option))
+    {
+
+        /* Network issue. Close the MQTT session. */
+#ifndef NXD_MQTT_CLOUD_ENABLE
+        tx_event_flags_set(&client_ptr -> nxd_mqtt_events, MQTT_NETWORK_DISCONNECT_EVENT, TX_OR);
+#else
+        nx_cloud_module_event_set(&(client_ptr -> nxd_mqtt_client_cloud_module), MQTT_NETWORK_DISCONNECT_EVENT);
+#endif /* NXD_MQTT_CLOUD_ENABLE */
+
+        return(NXD_MQTT_COMMUNICATION_FAILURE);
+    }
+#else
+    NX_PARAMETER_NOT_USED(client_ptr);
+    NX_PARAMETER_NOT_USED(wait_option);
+#endif /* NX_SECURE_ENABLE && NX_SECURE_TLS_ENABLE_SEND_COALESCING */
+
+    return(NXD_MQTT_SUCCESS);
+}
+
 /**************************************************************************/
 /*                                                                        */
 /*  FUNCTION                                               RELEASE        */
@@ -4635,6 +4784,7 @@ UINT       ret = NXD_MQTT_SUCCESS;
 /*    tx_mutex_put                                                        */
 /*    nx_packet_release                                                   */
 /*    _nxd_mqtt_client_publish_packet_send                                */
+/*    _nxd_mqtt_client_publish_packet_flush                               */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -4799,6 +4949,13 @@ UINT       ret = NXD_MQTT_SUCCESS;
         /* Release the packet. */
         nx_packet_release(packet_ptr);
     }
+    else
+    {
+
+        /* Send the message now rather than wait for more data. The packet has been sent, so it
+           is not released if this fails. */
+        ret = _nxd_mqtt_client_publish_packet_flush(client_ptr, wait_option);
+    }
     return(ret);
 }
 
@@ -4953,6 +5110,7 @@ UINT _nxd_mqtt_client_unsubscribe(NXD_MQTT_CLIENT *client_ptr, CHAR *topic_name,
 /*    tx_mutex_put                                                        */
 /*    nx_tcp_socket_send                                                  */
 /*    nx_secure_tls_session_send                                          */
+/*    _nxd_mqtt_client_tls_flush                                          */
 /*    nx_packet_release                                                   */
 /*                                                                        */
 /*  CALLED BY                                                             */
@@ -4975,6 +5133,9 @@ static UINT _nxd_mqtt_send_simple_message(NXD_MQTT_CLIENT *client_ptr, UCHAR hea
 NX_PACKET *packet_ptr;
 UINT       status;
 UINT       status_mutex;
+#if defined(NX_SECURE_ENABLE) && defined(NX_SECURE_TLS_ENABLE_SEND_COALESCING)
+UINT       status_flush = NXD_MQTT_SUCCESS;
+#endif /* NX_SECURE_ENABLE && NX_SECURE_TLS_ENABLE_SEND_COALESCING */
 UCHAR     *byte;
 
     status = _nxd_mqtt_packet_allocate(client_ptr, &packet_ptr);
@@ -5017,6 +5178,15 @@ UCHAR     *byte;
 
 #endif /* NX_SECURE_ENABLE */
 
+#if defined(NX_SECURE_ENABLE) && defined(NX_SECURE_TLS_ENABLE_SEND_COALESCING)
+    if (status == NX_SUCCESS)
+    {
+
+        /* Send the message now rather than wait for more data. */
+        status_flush = _nxd_mqtt_client_tls_flush(client_ptr, NX_WAIT_FOREVER);
+    }
+#endif /* NX_SECURE_ENABLE && NX_SECURE_TLS_ENABLE_SEND_COALESCING */
+
     status_mutex = tx_mutex_get(client_ptr -> nxd_mqtt_client_mutex_ptr, NX_WAIT_FOREVER);
     if (status)
     {
@@ -5026,6 +5196,14 @@ UCHAR     *byte;
 
         status = NXD_MQTT_COMMUNICATION_FAILURE;
     }
+#if defined(NX_SECURE_ENABLE) && defined(NX_SECURE_TLS_ENABLE_SEND_COALESCING)
+    else if (status_flush)
+    {
+
+        /* The packet has been sent, so it is not released. */
+        status = NXD_MQTT_COMMUNICATION_FAILURE;
+    }
+#endif /* NX_SECURE_ENABLE && NX_SECURE_TLS_ENABLE_SEND_COALESCING */
     if (status_mutex)
     {
         return(NXD_MQTT_MUTEX_FAILURE);
@@ -463,6 +463,7 @@ UINT _nxd_mqtt_client_message_get(NXD_MQTT_CLIENT *client_ptr, UCHAR *topic_buff
                                   UCHAR *message_buffer, UINT message_buffer_size, UINT *actual_message_length);
 UINT _nxd_mqtt_client_publish_packet_send(NXD_MQTT_CLIENT *client_ptr, NX_PACKET *packet_ptr,
                                           USHORT packet_id, UINT QoS, ULONG wait_option);
+UINT _nxd_mqtt_client_publish_packet_flush(NXD_MQTT_CLIENT *client_ptr, ULONG wait_option);
 UINT _nxd_mqtt_client_publish(NXD_MQTT_CLIENT *client_ptr, CHAR *topic_name, UINT topic_name_length,
                               CHAR *message, UINT message_length, UINT retain, UINT QoS, ULONG timeout);
 UINT _nxd_mqtt_client_receive_notify_set(NXD_MQTT_CLIENT *client_ptr,
@@ -77,6 +77,12 @@ extern   "C" {
 #include "nx_api.h"
 #else
 #include "nx_crypto_port.h"
+
+/* Define the integer type used for pointer arithmetic and alignment checks, as nx_api.h does.
+   It must be large enough to hold a pointer.  */
+#ifndef ALIGN_TYPE_DEFINED
+#define ALIGN_TYPE      ULONG
+#endif
 #endif
 
 #ifdef NX_LITTLE_ENDIAN
@@ -117,6 +117,17 @@ extern   "C" {
 #define NX_CRYPTO_AES_TABLE                      static const
 #endif
 
+/* Define NX_CRYPTO_AES_USE_TTABLE_ROUNDS to encrypt and decrypt each block with the
+   state held in local 32-bit words across all rounds, instead of passing it through
+   nx_crypto_aes_state between the round steps. All AES modes use it. */
+
+/* Define NX_CRYPTO_AES_USE_BITSLICE to replace the table based AES core with a
+   bitsliced one that uses no data dependent table lookups or branches, for
+   deployments exposed to cache timing attacks. It processes two blocks at a time,
+   so CTR and GCM, which hand it several counter blocks at once, lose the least
+   throughput. The key schedule then holds the bitsliced round keys for both
+   directions. This option takes precedence over NX_CRYPTO_AES_USE_TTABLE_ROUNDS. */
+
 /* Define the control block structure for backward compatibility. */
 #define NX_AES                                   NX_CRYPTO_AES
 
@@ -152,6 +163,7 @@ typedef struct NX_CRYPTO_AES_STRUCT
 
 UINT _nx_crypto_aes_encrypt(NX_CRYPTO_AES *aes_ptr, UCHAR *input, UCHAR *output, UINT length);
 UINT _nx_crypto_aes_decrypt(NX_CRYPTO_AES *aes_ptr, UCHAR *input, UCHAR *output, UINT length);
+UINT _nx_crypto_aes_encrypt_blocks(NX_CRYPTO_AES *aes_ptr, UCHAR *input, UCHAR *output, UINT length);
 
 UINT _nx_crypto_aes_key_set(NX_CRYPTO_AES *aes_ptr, UCHAR *key, UINT key_size);
 
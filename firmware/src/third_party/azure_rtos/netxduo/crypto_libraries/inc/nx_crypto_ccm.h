@@ -73,6 +73,11 @@ typedef struct NX_CRYPTO_CCM_STRUCT
     UCHAR nx_crypto_ccm_A[NX_CRYPTO_CCM_BLOCK_SIZE];
     UCHAR nx_crypto_ccm_X[NX_CRYPTO_CCM_BLOCK_SIZE];
 
+    /* Key stream of a block that an update ended in the middle of, and the
+       number of its bytes already processed. */
+    UCHAR nx_crypto_ccm_key_stream[NX_CRYPTO_CCM_BLOCK_SIZE];
+    UINT nx_crypto_ccm_partial_length;
+
     /* Pointer of additional data. */
     VOID *nx_crypto_ccm_additional_data;
 
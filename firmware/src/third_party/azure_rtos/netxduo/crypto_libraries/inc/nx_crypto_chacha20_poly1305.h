@@ -0,0 +1,145 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Crypto Component                                                 */
+/**                                                                       */
+/**   ChaCha20-Poly1305 AEAD                                              */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  APPLICATION INTERFACE DEFINITION                       RELEASE        */
+/*                                                                        */
+/*    nx_crypto_chacha20_poly1305.h                       PORTABLE C      */
+/*                                                           6.1          */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This file defines the basic Application Interface (API) to the      */
+/*    NetX Crypto ChaCha20-Poly1305 module (RFC 8439).                    */
+/*                                                                        */
+/*                                                                        */
+/**************************************************************************/
+
+#ifndef NX_CRYPTO_CHACHA20_POLY1305_H
+#define NX_CRYPTO_CHACHA20_POLY1305_H
+
+/* Determine if a C++ compiler is being used.  If so, ensure that standard
+   C is used to process the API information.  */
+#ifdef __cplusplus
+
+/* Yes, C++ compiler is present.  Use standard C.  */
+extern   "C" {
+
+#endif
+
+/* Include the ThreadX and port-specific data type file.  */
+
+#include "nx_crypto.h"
+
+#ifndef ULONG64_DEFINED
+#define ULONG64_DEFINED
+#define ULONG64                                      unsigned long long
+#endif /* ULONG64 */
+
+
+#define NX_CRYPTO_CHACHA20_KEY_LEN_IN_BITS           (256)
+#define NX_CRYPTO_CHACHA20_BLOCK_SIZE                (64)
+#define NX_CRYPTO_CHACHA20_NONCE_SIZE                (12)
+#define NX_CRYPTO_POLY1305_BLOCK_SIZE                (16)
+#define NX_CRYPTO_CHACHA20_POLY1305_ICV_LEN_IN_BITS  (128)
+
+/* ChaCha20 is a stream cipher, so update operations accept any length. The block size
+   reported to callers is the Poly1305 block size, which only decides how the TLS record
+   layer splits data across packet boundaries. */
+#define NX_CRYPTO_CHACHA20_POLY1305_BLOCK_SIZE       (NX_CRYPTO_POLY1305_BLOCK_SIZE)
+
+/* The TLS 1.2 key block carries a full 12-byte write IV for this cipher (RFC 7905). */
+#define NX_CRYPTO_CHACHA20_POLY1305_IV_LEN_IN_BITS   (NX_CRYPTO_CHACHA20_NONCE_SIZE << 3)
+
+typedef struct NX_CRYPTO_CHACHA20_POLY1305_STRUCT
+{
+
+    /* ChaCha20 input block: constants, key, block counter and nonce. */
+    UINT nx_crypto_chacha20_state[16];
+
+    /* Key stream of the current block, and the number of its bytes already used. */
+    UCHAR nx_crypto_chacha20_keystream[NX_CRYPTO_CHACHA20_BLOCK_SIZE];
+    UINT nx_crypto_chacha20_keystream_used;
+
+    /* Poly1305 key r, accumulator h (both as 26-bit limbs) and final pad s. */
+    UINT nx_crypto_poly1305_r[5];
+    UINT nx_crypto_poly1305_h[5];
+    UINT nx_crypto_poly1305_s[4];
+
+    /* Partial Poly1305 block waiting for more data. */
+    UCHAR nx_crypto_poly1305_buffer[NX_CRYPTO_POLY1305_BLOCK_SIZE];
+    UINT nx_crypto_poly1305_buffer_length;
+
+    /* Lengths of the additional data and the text, for the final Poly1305 block. */
+    ULONG nx_crypto_chacha20_poly1305_aad_length;
+    ULONG nx_crypto_chacha20_poly1305_text_length;
+
+    /* Pointer of additional data. */
+    VOID *nx_crypto_chacha20_poly1305_additional_data;
+
+    /* Length of additional data. */
+    UINT nx_crypto_chacha20_poly1305_additional_data_len;
+} NX_CRYPTO_CHACHA20_POLY1305;
+
+
+UINT _nx_crypto_chacha20_poly1305_start(NX_CRYPTO_CHACHA20_POLY1305 *ctx, UCHAR *nonce,
+                                        UCHAR *additional_data, UINT additional_len);
+UINT _nx_crypto_chacha20_poly1305_encrypt_update(NX_CRYPTO_CHACHA20_POLY1305 *ctx,
+                                                 UCHAR *input, UCHAR *output, UINT length);
+UINT _nx_crypto_chacha20_poly1305_decrypt_update(NX_CRYPTO_CHACHA20_POLY1305 *ctx,
+                                                 UCHAR *input, UCHAR *output, UINT length);
+UINT _nx_crypto_chacha20_poly1305_encrypt_calculate(NX_CRYPTO_CHACHA20_POLY1305 *ctx,
+                                                    UCHAR *output, UINT icv_len);
+UINT _nx_crypto_chacha20_poly1305_decrypt_calculate(NX_CRYPTO_CHACHA20_POLY1305 *ctx,
+                                                    UCHAR *input, UINT icv_len);
+
+UINT _nx_crypto_method_chacha20_poly1305_init(struct NX_CRYPTO_METHOD_STRUCT *method,
+                                              UCHAR *key, NX_CRYPTO_KEY_SIZE key_size_in_bits,
+                                              VOID **handle,
+                                              VOID *crypto_metadata,
+                                              ULONG crypto_metadata_size);
+
+UINT _nx_crypto_method_chacha20_poly1305_cleanup(VOID *crypto_metadata);
+
+UINT _nx_crypto_method_chacha20_poly1305_operation(UINT op,      /* Encrypt, Decrypt, Authenticate */
+                                                   VOID *handle, /* Crypto handler */
+                                                   struct NX_CRYPTO_METHOD_STRUCT *method,
+                                                   UCHAR *key,
+                                                   NX_CRYPTO_KEY_SIZE key_size_in_bits,
+                                                   UCHAR *input,
+                                                   ULONG input_length_in_byte,
+                                                   UCHAR *iv_ptr,
+                                                   UCHAR *output,
+                                                   ULONG output_length_in_byte,
+                                                   VOID *crypto_metadata,
+                                                   ULONG crypto_metadata_size,
+                                                   VOID *packet_ptr,
+                                                   VOID (*nx_crypto_hw_process_callback)(VOID *packet_ptr, UINT status));
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif /* NX_CRYPTO_CHACHA20_POLY1305_H */
+
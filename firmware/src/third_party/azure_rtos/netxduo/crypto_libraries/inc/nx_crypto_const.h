@@ -195,6 +195,7 @@ extern   "C" {
 #define NX_CRYPTO_EC_BRAINPOOLP256r1             0x0006001A
 #define NX_CRYPTO_EC_BRAINPOOLP384r1             0x0006001B
 #define NX_CRYPTO_EC_BRAINPOOLP512r1             0x0006001C
+#define NX_CRYPTO_EC_X25519                      0x0006001D
 #define NX_CRYPTO_EC_FFDHE2048                   0x00060100
 #define NX_CRYPTO_EC_FFDHE3072                   0x00060101
 #define NX_CRYPTO_EC_FFDHE4096                   0x00060102
@@ -287,12 +288,13 @@ extern   "C" {
 #define NX_CRYPTO_HKDF_SET_PRK                   72   /* Set the Pseudo-Random Key for an HKDF-expand operation. */
 #define NX_CRYPTO_HKDF_SET_HMAC                  73   /* Set the generic HMAC routine to be used for HKDF. */
 #define NX_CRYPTO_HMAC_SET_HASH                  74   /* Set the generic hash routine to be used for HMAC operations. */
+#define NX_CRYPTO_HMAC_CACHED_AUTHENTICATE       75   /* Authenticate with the key state saved by the last NX_CRYPTO_HASH_INITIALIZE. */
 
 /* Define align MACRO to a byte boundry. */
 #define NX_CRYPTO_ALIGN8(len)                    (((len) + 7) & ~7)
 
 /* Find the offset of a structure. */
-#define NX_CRYPTO_OFFSET(a, b)                   ((ULONG)(&(((a *)(0)) -> b)))
+#define NX_CRYPTO_OFFSET(a, b)                   ((ULONG)(ALIGN_TYPE)(&(((a *)(0)) -> b)))
 
 
 typedef UINT NX_CRYPTO_KEY_SIZE;
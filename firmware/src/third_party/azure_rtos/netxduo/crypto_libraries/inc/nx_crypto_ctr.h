@@ -64,6 +64,12 @@ extern   "C" {
 
 #define NX_CRYPTO_CTR_BLOCK_SIZE 16
 
+/* Number of counter blocks encrypted in one call to the crypto function.
+   Each block costs 32 bytes of stack. */
+#ifndef NX_CRYPTO_CTR_PIPELINE_BLOCKS
+#define NX_CRYPTO_CTR_PIPELINE_BLOCKS 4
+#endif
+
 typedef struct NX_CRYPTO_CTR_STRUCT
 {
 
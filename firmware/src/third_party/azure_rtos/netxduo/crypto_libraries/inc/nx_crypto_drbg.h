@@ -114,6 +114,20 @@ extern NX_CRYPTO_METHOD crypto_method_aes_cbc_128;
 #define NX_CRYPTO_DRBG_ENTROPY_INPUT_FUNC _nx_crypto_drbg_rnd_entropy_input
 #endif
 
+/* Define NX_CRYPTO_DRBG_OUTPUT_BUFFER_SIZE to let _nx_crypto_drbg serve small
+   requests from a batch of keystream instead of running a complete generate
+   and update sequence for each of them. The batch is produced by one
+   generate request of this many bytes, which counts once against the
+   reseed counter, and every byte is cleared from the buffer as it is handed
+   out. Requests larger than the buffer are generated directly.
+   Prediction resistance requires a reseed for every request, so the buffer
+   is bypassed while NX_CRYPTO_DRBG_PREDICTION_RESISTANCE is enabled. */
+#ifdef NX_CRYPTO_DRBG_OUTPUT_BUFFER_SIZE
+#if (NX_CRYPTO_DRBG_OUTPUT_BUFFER_SIZE < NX_CRYPTO_DRBG_BLOCK_LENGTH_AES) || (NX_CRYPTO_DRBG_OUTPUT_BUFFER_SIZE > 65536)
+#error "NX_CRYPTO_DRBG_OUTPUT_BUFFER_SIZE must be between 16 and 65536."
+#endif
+#endif
+
 
 
 /* DRBG control structure. */
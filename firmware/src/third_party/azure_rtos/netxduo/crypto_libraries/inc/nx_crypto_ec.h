@@ -71,6 +71,47 @@ extern   "C" {
 #define NX_CRYPTO_EC_FP               0
 #define NX_CRYPTO_EC_F2M              1
 
+/* Window width w of the NAF used to multiply a point that has no precomputed
+   fixed points, such as a peer public key. Each multiplication builds a table
+   of the 2 ^ (w - 2) odd multiples g, 3g, ..., (2 ^ (w - 1) - 1)g in affine
+   coordinates, with a single inversion, and then adds one entry per nonzero
+   digit, about one addition every w + 1 bits. Valid values are 3 to 6.
+
+   The table and the recoding state of the factor are kept in the scratch
+   buffer passed to the multiplication. Peak scratch usage in bytes:
+
+                   w = 3    w = 4    w = 5    w = 6
+     secp256r1       784      976     1404     2428
+     secp384r1      1172     1460     2096     3632
+     secp521r1      1648     2056     2956     5132
+
+   The default of 4 fits all curves in the default ECDH and ECDSA scratch
+   buffers. A larger width with secp521r1 requires
+   NX_CRYPTO_ECDH_SCRATCH_BUFFER_SIZE and NX_CRYPTO_ECDSA_SCRATCH_BUFFER_SIZE
+   to be raised by the increase over w = 4. */
+#ifndef NX_CRYPTO_EC_WNAF_WINDOW_WIDTH
+#define NX_CRYPTO_EC_WNAF_WINDOW_WIDTH 4
+#endif
+
+#if (NX_CRYPTO_EC_WNAF_WINDOW_WIDTH < 3) || (NX_CRYPTO_EC_WNAF_WINDOW_WIDTH > 6)
+#error "NX_CRYPTO_EC_WNAF_WINDOW_WIDTH must be between 3 and 6."
+#endif
+
+/* Number of odd multiples in the table, including g itself. */
+#define NX_CRYPTO_EC_WNAF_TABLE_SIZE  (1 << (NX_CRYPTO_EC_WNAF_WINDOW_WIDTH - 2))
+
+/* With 32-bit huge number digits, point arithmetic on secp256r1 uses a
+   dedicated field layer on fixed arrays of 8 words: unrolled multiply and
+   square, the fast reduction of the secp256r1 prime and an addition chain
+   for inversion. Define NX_CRYPTO_EC_SECP256R1_USE_GENERIC to use the
+   generic huge number arithmetic instead. */
+#if (NX_CRYPTO_HUGE_NUMBER_BITS == 32) && !defined(NX_CRYPTO_EC_SECP256R1_USE_GENERIC)
+#define NX_CRYPTO_EC_SECP256R1_FIELD_ENABLE
+#endif
+
+/* Number of words in a secp256r1 field element. */
+#define NX_CRYPTO_EC_SECP256R1_FIELD_SIZE 8
+
 /* Define Elliptic Curve point. */
 typedef struct
 {
@@ -86,7 +127,29 @@ typedef struct
     UINT    nx_crypto_ec_polynomial_size;
 } NX_CRYPTO_EC_POLYNOMIAL;
 
-/* Define fixed points */
+/* Define fixed points of the base point, used by _nx_crypto_ec_fp_fixed_multiple
+   for key generation and signing. The factor is split into w rows of d bits and
+   read one column of w bits at a time from two halves of e columns, so that a
+   multiplication takes e doublings and at most 2e additions of a table entry.
+   Each curve is linked with the table in nx_crypto_ec_<curve>_fixed_points.c.
+   utility/nx_crypto_ec_fixed_points_generator.c regenerates that file with
+   another width; the multiplication reads w, d and e from the table, so no
+   other change is needed. Doublings, average additions and table size in bytes
+   with 32-bit pointers:
+
+                      w = 2    w = 3    w = 4    w = 5    w = 6    w = 7    w = 8
+     secp256r1          64       43       32       26       22       19       16
+                        96       75       60       50       42       37       32
+                       580     1508     3364     7076    14500    29348    59044
+     secp384r1          96       64       48       39       32       28       24
+                       144      112       90       75       63       55       48
+                       740     1924     4292     9028    18500    37444    75332
+     secp521r1         131       87       66       53       44       38       33
+                       196      152      123      102       86       74       66
+                       940     2444     5452    11468    23500    47564    95692
+
+   The shipped tables use w = 4 for secp192r1, secp224r1 and secp256r1 and
+   w = 5 for secp384r1 and secp521r1. */
 typedef struct
 {
 
@@ -532,8 +595,34 @@ VOID _nx_crypto_ec_fp_fixed_multiple(NX_CRYPTO_EC *curve,
                                      NX_CRYPTO_HUGE_NUMBER *d,
                                      NX_CRYPTO_EC_POINT *r,
                                      HN_UBASE *scratch);
+VOID _nx_crypto_ec_fp_joint_multiple(NX_CRYPTO_EC *curve,
+                                     NX_CRYPTO_EC_POINT *g,
+                                     NX_CRYPTO_HUGE_NUMBER *d,
+                                     NX_CRYPTO_EC_POINT *q,
+                                     NX_CRYPTO_HUGE_NUMBER *e,
+                                     NX_CRYPTO_EC_POINT *r,
+                                     HN_UBASE *scratch);
 
 VOID _nx_crypto_ec_naf_compute(NX_CRYPTO_HUGE_NUMBER *d, HN_UBASE *naf_data, UINT *naf_size);
+VOID _nx_crypto_ec_wnaf_compute(NX_CRYPTO_HUGE_NUMBER *d, UINT word_index,
+                                UINT *carry, UINT *skip, CHAR *wnaf_data);
+VOID _nx_crypto_ec_fp_odd_multiples(NX_CRYPTO_EC *curve,
+                                    NX_CRYPTO_EC_POINT *g,
+                                    NX_CRYPTO_EC_POINT *table,
+                                    HN_UBASE **scratch_pptr);
+
+#ifdef NX_CRYPTO_EC_SECP256R1_FIELD_ENABLE
+VOID _nx_crypto_ec_secp256r1_field_multiply(HN_UBASE *r, HN_UBASE *a, HN_UBASE *b);
+VOID _nx_crypto_ec_secp256r1_field_square(HN_UBASE *r, HN_UBASE *a);
+VOID _nx_crypto_ec_secp256r1_field_add(HN_UBASE *r, HN_UBASE *a, HN_UBASE *b);
+VOID _nx_crypto_ec_secp256r1_field_subtract(HN_UBASE *r, HN_UBASE *a, HN_UBASE *b);
+VOID _nx_crypto_ec_secp256r1_field_inverse(HN_UBASE *r, HN_UBASE *a);
+VOID _nx_crypto_ec_secp256r1_projective_add(NX_CRYPTO_EC_POINT *projective_point,
+                                            NX_CRYPTO_EC_POINT *affine_point);
+VOID _nx_crypto_ec_secp256r1_projective_double(NX_CRYPTO_EC_POINT *projective_point);
+VOID _nx_crypto_ec_secp256r1_projective_to_affine(NX_CRYPTO_EC_POINT *point);
+#endif
+
 VOID _nx_crypto_ec_add_digit_reduce(NX_CRYPTO_EC *curve,
                                     NX_CRYPTO_HUGE_NUMBER *value,
                                     HN_UBASE digit,
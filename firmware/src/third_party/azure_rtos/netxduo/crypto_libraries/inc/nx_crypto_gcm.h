@@ -68,6 +68,19 @@ extern   "C" {
 #define NX_CRYPTO_GCM_BLOCK_SIZE_INT 4
 #define NX_CRYPTO_GCM_BLOCK_SIZE_SHIFT 4
 
+/* Number of entries in the 4-bit multiplication table of the hash key. */
+#define NX_CRYPTO_GCM_HTABLE_SIZE 16
+
+/* Number of counter blocks encrypted ahead of the combined GCTR and GHASH loop.
+   Each block costs 16 bytes of stack. */
+#ifndef NX_CRYPTO_GCM_PIPELINE_BLOCKS
+#define NX_CRYPTO_GCM_PIPELINE_BLOCKS 4
+#endif
+
+/* Define NX_CRYPTO_GCM_ENABLE_CONSTANT_TIME to make GHASH read every entry of the
+   multiplication table for each nibble, so the memory access pattern does not
+   depend on the hashed data. This is slower than the default table lookup. */
+
 typedef struct NX_CRYPTO_GCM_STRUCT
 {
 
@@ -76,10 +89,21 @@ typedef struct NX_CRYPTO_GCM_STRUCT
 
     /* Internal context of GCM mode. */
     UCHAR nx_crypto_gcm_hkey[NX_CRYPTO_GCM_BLOCK_SIZE];
+
+    /* Multiples of the hash key by all 4-bit values, as big endian 32-bit words. */
+    UINT nx_crypto_gcm_htable[NX_CRYPTO_GCM_HTABLE_SIZE][NX_CRYPTO_GCM_BLOCK_SIZE_INT];
+
+    /* Set once the hash key and its table are computed for the current key. */
+    UINT nx_crypto_gcm_htable_ready;
     UCHAR nx_crypto_gcm_j0[NX_CRYPTO_GCM_BLOCK_SIZE];
     UCHAR nx_crypto_gcm_s[NX_CRYPTO_GCM_BLOCK_SIZE];
     UCHAR nx_crypto_gcm_counter[NX_CRYPTO_GCM_BLOCK_SIZE];
 
+    /* Key stream of a block that an update ended in the middle of, and the
+       number of its bytes already processed. */
+    UCHAR nx_crypto_gcm_key_stream[NX_CRYPTO_GCM_BLOCK_SIZE];
+    UINT nx_crypto_gcm_partial_length;
+
     /* Pointer of additional data. */
     VOID *nx_crypto_gcm_additional_data;
 
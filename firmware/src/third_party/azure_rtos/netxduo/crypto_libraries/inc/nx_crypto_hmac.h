@@ -79,6 +79,17 @@ typedef struct NX_CRYPTO_HMAC_STRUCT
     UINT   (*crypto_digest_calculate)(VOID *, UCHAR *, UINT);
     NX_CRYPTO_METHOD *hash_method;
     VOID *hash_context;
+
+    /* Once a key is set, the hash states after the ipad and opad blocks are
+       saved so every further message with that key starts from them instead
+       of hashing the padded key again. state is the part of the hash context
+       that is saved; state_size is zero when the state cannot be saved, in
+       which case the padded keys are hashed for every message. */
+    VOID  *state;
+    UCHAR *inner_state;
+    UCHAR *outer_state;
+    UINT   state_size;
+    UINT   key_cached;
 } NX_CRYPTO_HMAC;
 
 UINT _nx_crypto_hmac(NX_CRYPTO_HMAC *crypto_matadata,
@@ -88,13 +99,15 @@ UINT _nx_crypto_hmac(NX_CRYPTO_HMAC *crypto_matadata,
 
 UINT _nx_crypto_hmac_initialize(NX_CRYPTO_HMAC *crypto_matadata, UCHAR *key_ptr, UINT key_length);
 
+UINT _nx_crypto_hmac_reset(NX_CRYPTO_HMAC *crypto_matadata);
+
 UINT _nx_crypto_hmac_update(NX_CRYPTO_HMAC *crypto_matadata, UCHAR *input_ptr, UINT input_length);
 
 UINT _nx_crypto_hmac_digest_calculate(NX_CRYPTO_HMAC *crypto_matadata, UCHAR *digest_ptr, UINT digest_length);
 
 VOID _nx_crypto_hmac_metadata_set(NX_CRYPTO_HMAC *hmac_metadata,
                                   VOID *context,
-                                  UINT algorithm, UINT block_size, UINT output_length,
+                                  UINT algorithm, UINT block_size, UINT output_length, UINT state_size,
                                   UINT (*crypto_initialize)(VOID *, UINT),
                                   UINT (*crypto_update)(VOID *, UCHAR *, UINT),
                                   UINT (*crypto_digest_calculate)(VOID *, UCHAR *, UINT));
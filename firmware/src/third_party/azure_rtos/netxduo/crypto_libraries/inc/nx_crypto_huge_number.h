@@ -162,6 +162,37 @@ typedef struct NX_CRYPTO_HUGE_NUMBER_STRUCT
            (src) -> nx_crypto_huge_number_data,                                              \
            (src) -> nx_crypto_huge_number_size << HN_SIZE_SHIFT);
 
+/* Get bit b of a huge number. */
+#define NX_CRYPTO_HUGE_NUMBER_BIT(hn, b)                                                        \
+    (((hn) -> nx_crypto_huge_number_data[(b) / NX_CRYPTO_HUGE_NUMBER_BITS] >>                   \
+      ((b) % NX_CRYPTO_HUGE_NUMBER_BITS)) & 1)
+
+/* Largest window used by _nx_crypto_huge_number_mont_power_modulus. The window grows with the
+   length of the exponent, and the table of odd powers holds 2 ^ (window - 1) numbers the size
+   of the modulus. Exponents up to 23 bits, such as 65537, are processed bit by bit without a
+   table. Valid values are 1 to 4. The default keeps the RSA scratch buffer close to its
+   previous size; a 1024-bit exponent needs about 1280 Montgomery products with a window of 3,
+   against 1536 bit by bit, and 1240 with a window of 4. The table is part of NX_CRYPTO_RSA,
+   which grows from 5976 bytes with a window of 3 to 7248 bytes with 4 and 11376 bytes with 5.
+   Larger windows do not fit in the 10 KB metadata buffer of the method self-test. */
+#ifndef NX_CRYPTO_HUGE_NUMBER_MONT_WINDOW_MAX
+#define NX_CRYPTO_HUGE_NUMBER_MONT_WINDOW_MAX 3
+#endif
+
+#if (NX_CRYPTO_HUGE_NUMBER_MONT_WINDOW_MAX < 1) || (NX_CRYPTO_HUGE_NUMBER_MONT_WINDOW_MAX > 4)
+#error "NX_CRYPTO_HUGE_NUMBER_MONT_WINDOW_MAX must be between 1 and 4."
+#endif
+
+/* Scratch size in bytes required by _nx_crypto_huge_number_mont_power_modulus for a modulus
+   buffer of m bytes: the table of odd powers plus one temporary number. */
+#define NX_CRYPTO_HUGE_NUMBER_MONT_POWER_MODULUS_SCRATCH_SIZE(m) \
+    (((1 << (NX_CRYPTO_HUGE_NUMBER_MONT_WINDOW_MAX - 1)) + 1) * ((m) + sizeof(HN_UBASE)))
+
+/* Scratch size in bytes required by _nx_crypto_huge_number_crt_power_modulus for a modulus
+   buffer of m bytes, with primes p and q of m / 2 bytes. */
+#define NX_CRYPTO_HUGE_NUMBER_CRT_POWER_MODULUS_SCRATCH_SIZE(m) \
+    ((3 * (m)) + 24 + NX_CRYPTO_HUGE_NUMBER_MONT_POWER_MODULUS_SCRATCH_SIZE((m) >> 1))
+
 
 /* Function prototypes */
 
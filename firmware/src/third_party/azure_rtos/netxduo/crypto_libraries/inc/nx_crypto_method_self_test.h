@@ -62,6 +62,10 @@ UINT _nx_crypto_method_self_test_pkcs1(NX_CRYPTO_METHOD *crypto_method_pkcs1,
                                        VOID *metadata, UINT metadata_size);
 UINT _nx_crypto_method_self_test_ecdh(NX_CRYPTO_METHOD *crypto_method_ecdh,
                                       VOID *metadata, UINT metadata_size);
+UINT _nx_crypto_method_self_test_chacha20_poly1305(NX_CRYPTO_METHOD *crypto_method_chacha20_poly1305,
+                                                   VOID *metadata, UINT metadata_size);
+UINT _nx_crypto_method_self_test_x25519(NX_CRYPTO_METHOD *crypto_method_ecdh,
+                                        VOID *metadata, UINT metadata_size);
 
 #endif
 #endif /* NX_CRYPTO_METHOD_SELF_TEST_H  */
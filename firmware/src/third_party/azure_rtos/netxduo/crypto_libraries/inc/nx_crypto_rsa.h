@@ -61,6 +61,7 @@ extern   "C" {
 /* Include the ThreadX and port-specific data type file.  */
 
 #include "nx_crypto.h"
+#include "nx_crypto_huge_number.h"
 
 /* Define the maximum size of an RSA modulus supported in bits. */
 #ifndef NX_CRYPTO_MAX_RSA_MODULUS_SIZE
@@ -68,10 +69,23 @@ extern   "C" {
 #endif
 
 
-/* Scratch buffer for RSA calculations.
-    Size must be no less than 10 * sizeof(modulus) + 24. 2584 bytes for 2048 bits cryption.
-    If CRT algorithm is not used, size must be no less than (7 * sizeof(modulus) + 8). 1800 bytes for 2048 bits cryption. */
-#define NX_CRYPTO_RSA_SCRATCH_BUFFER_SIZE (((10 * (NX_CRYPTO_MAX_RSA_MODULUS_SIZE / 8)) + 24) / sizeof(USHORT))
+/* Scratch size in bytes for RSA calculations with a modulus of m bytes.
+    With CRT algorithm, size must be no less than 6 * sizeof(modulus) plus
+    NX_CRYPTO_HUGE_NUMBER_CRT_POWER_MODULUS_SCRATCH_SIZE(sizeof(modulus)).
+    If CRT algorithm is not used, size must be no less than 5 * sizeof(modulus) plus
+    NX_CRYPTO_HUGE_NUMBER_MONT_POWER_MODULUS_SCRATCH_SIZE(sizeof(modulus)).
+    With the default NX_CRYPTO_HUGE_NUMBER_MONT_WINDOW_MAX of 3, this is 2988 bytes for 2048 bits cryption. */
+#define NX_CRYPTO_RSA_CRT_SCRATCH_SIZE(m) \
+    ((6 * (m)) + NX_CRYPTO_HUGE_NUMBER_CRT_POWER_MODULUS_SCRATCH_SIZE(m))
+#define NX_CRYPTO_RSA_MONT_SCRATCH_SIZE(m) \
+    ((5 * (m)) + NX_CRYPTO_HUGE_NUMBER_MONT_POWER_MODULUS_SCRATCH_SIZE(m))
+#define NX_CRYPTO_RSA_SCRATCH_SIZE(m)                                   \
+    ((NX_CRYPTO_RSA_CRT_SCRATCH_SIZE(m) > NX_CRYPTO_RSA_MONT_SCRATCH_SIZE(m)) ? \
+     NX_CRYPTO_RSA_CRT_SCRATCH_SIZE(m) : NX_CRYPTO_RSA_MONT_SCRATCH_SIZE(m))
+
+/* Scratch buffer for RSA calculations, in number of USHORT. */
+#define NX_CRYPTO_RSA_SCRATCH_BUFFER_SIZE \
+    ((NX_CRYPTO_RSA_SCRATCH_SIZE(NX_CRYPTO_MAX_RSA_MODULUS_SIZE / 8) + 1) / sizeof(USHORT))
 
 /* Control block for RSA cryptographic operations. */
 typedef struct NX_CRYPTO_RSA_STRUCT
@@ -0,0 +1,88 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Crypto Component                                                 */
+/**                                                                       */
+/**   X25519 Elliptic Curve Diffie-Hellman                                */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  APPLICATION INTERFACE DEFINITION                       RELEASE        */
+/*                                                                        */
+/*    nx_crypto_x25519.h                                  PORTABLE C      */
+/*                                                           6.1          */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This file defines the NetX Crypto X25519 (RFC 7748) function. The   */
+/*    curve object defined here only carries the curve ID and size; the   */
+/*    ECDH method checks the ID and uses the Montgomery ladder instead of */
+/*    the generic point arithmetic.                                       */
+/*                                                                        */
+/*                                                                        */
+/**************************************************************************/
+
+#ifndef NX_CRYPTO_X25519_H
+#define NX_CRYPTO_X25519_H
+
+/* Determine if a C++ compiler is being used.  If so, ensure that standard
+   C is used to process the API information.  */
+#ifdef __cplusplus
+
+/* Yes, C++ compiler is present.  Use standard C.  */
+extern   "C" {
+
+#endif
+
+#include "nx_crypto_ec.h"
+
+/* The field arithmetic needs 64-bit products whatever NX_CRYPTO_HUGE_NUMBER_BITS is. */
+#ifndef ULONG64_DEFINED
+#define ULONG64_DEFINED
+#define ULONG64                                      unsigned long long
+#endif /* ULONG64 */
+
+
+/* Size in bytes of X25519 scalars, u-coordinates and shared secrets. */
+#define NX_CRYPTO_X25519_KEY_SIZE                    (32)
+
+/* Number of limbs in a field element. Limbs alternate between 26 and 25 bits. */
+#define NX_CRYPTO_X25519_LIMBS                       (10)
+
+extern NX_CRYPTO_CONST NX_CRYPTO_EC _nx_crypto_ec_x25519;
+
+UINT _nx_crypto_x25519_scalar_multiply(UCHAR *output, UCHAR *scalar, UCHAR *u);
+UINT _nx_crypto_x25519_base_multiply(UCHAR *output, UCHAR *scalar);
+
+UINT _nx_crypto_method_ec_x25519_operation(UINT op,
+                                           VOID *handle,
+                                           struct NX_CRYPTO_METHOD_STRUCT *method,
+                                           UCHAR *key, NX_CRYPTO_KEY_SIZE key_size_in_bits,
+                                           UCHAR *input, ULONG input_length_in_byte,
+                                           UCHAR *iv_ptr,
+                                           UCHAR *output, ULONG output_length_in_byte,
+                                           VOID *crypto_metadata, ULONG crypto_metadata_size,
+                                           VOID *packet_ptr,
+                                           VOID (*nx_crypto_hw_process_callback)(VOID *, UINT));
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif /* NX_CRYPTO_X25519_H */
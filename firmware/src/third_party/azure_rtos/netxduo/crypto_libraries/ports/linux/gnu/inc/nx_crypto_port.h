@@ -69,8 +69,19 @@ typedef char                                      CHAR;
 typedef unsigned char                             UCHAR;
 typedef int                                       INT;
 typedef unsigned int                              UINT;
+#if defined(__LP64__)
+/* The huge number and hash code rely on 32-bit LONG and ULONG, so keep
+   them at 32 bits on 64-bit hosts as the ThreadX Linux port does.  */
+typedef int                                       LONG;
+typedef unsigned int                              ULONG;
+
+/* A pointer does not fit in ULONG, so pointer arithmetic uses a 64-bit ALIGN_TYPE.  */
+#define ALIGN_TYPE_DEFINED
+#define ALIGN_TYPE                                unsigned long
+#else
 typedef long                                      LONG;
 typedef unsigned long                             ULONG;
+#endif
 typedef short                                     SHORT;
 typedef unsigned short                            USHORT;
 #endif
@@ -270,7 +270,7 @@ NX_CRYPTO_3DES *triple_des_context_ptr;
     }
 
     /* Verify the metadata addrsss is 4-byte aligned. */
-    if((((ULONG)crypto_metadata) & 0x3) != 0)
+    if((((ALIGN_TYPE)crypto_metadata) & 0x3) != 0)
     {
         return(NX_CRYPTO_PTR_ERROR);
     }
@@ -446,7 +446,7 @@ NX_CRYPTO_3DES *context;
     }
 
     /* Verify the metadata addrsss is 4-byte aligned. */
-    if((((ULONG)crypto_metadata) & 0x3) != 0)
+    if((((ALIGN_TYPE)crypto_metadata) & 0x3) != 0)
     {
         return(NX_CRYPTO_PTR_ERROR);
     }
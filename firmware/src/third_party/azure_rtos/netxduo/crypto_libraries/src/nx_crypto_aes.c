@@ -26,6 +26,8 @@
 #include "nx_crypto_aes.h"
 #include "nx_crypto_xcbc_mac.h"
 
+/* The bitsliced core computes the S-box and MixColumns, and needs no lookup table. */
+#ifndef NX_CRYPTO_AES_USE_BITSLICE
 #if !defined(NX_CRYPTO_LITTLE_ENDIAN)
 /*
     Encryption table for BIG ENDIAN architecture.
@@ -353,6 +355,7 @@ NX_CRYPTO_AES_TABLE UCHAR inverse_sub_bytes_sbox[] =
     0x17, 0x2b, 0x04, 0x7e, 0xba, 0x77, 0xd6, 0x26, 0xe1, 0x69, 0x14, 0x63, 0x55, 0x21, 0x0c, 0x7d
 };
 
+#endif /* NX_CRYPTO_AES_USE_BITSLICE */
 
 /* Rcon array, used for key expansion.  Refer to Appendix A on page 27,  AES specification(Pub 197) */
 NX_CRYPTO_AES_TABLE UCHAR aes_rcon_array[] = {0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x1b, 0x36};
@@ -404,6 +407,877 @@ extern UINT _nx_crypto_library_state;
 /* Utility routines                                                       */
 /**************************************************************************/
 
+#if defined(NX_CRYPTO_AES_USE_BITSLICE)
+
+/* In the bitsliced representation, two blocks are processed at once. Each of the
+   eight state words holds one bit position of all 32 state bytes, so SubBytes is
+   evaluated as a logic circuit and no table is indexed by secret data. */
+
+/* Little endian load and store, independent of the host byte order. */
+#define NX_CRYPTO_AES_BITSLICE_LOAD32(p)        ((UINT)(p)[0] | ((UINT)(p)[1] << 8) | \
+                                                 ((UINT)(p)[2] << 16) | ((UINT)(p)[3] << 24))
+#define NX_CRYPTO_AES_BITSLICE_STORE32(p, val)  (p)[0] = (UCHAR)(val); \
+                                                (p)[1] = (UCHAR)((val) >> 8); \
+                                                (p)[2] = (UCHAR)((val) >> 16); \
+                                                (p)[3] = (UCHAR)((val) >> 24)
+#define NX_CRYPTO_AES_BITSLICE_ROTATE8(val)     (((val) >> 8) | ((val) << 24))
+#define NX_CRYPTO_AES_BITSLICE_ROTATE16(val)    (((val) << 16) | ((val) >> 16))
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_aes_bitslice_sbox                        PORTABLE C      */
+/*                                                           6.1          */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function applies the AES S-box to all bytes of a bitsliced     */
+/*    state with a fixed sequence of 113 logic gates (Boyar and Peralta). */
+/*    No memory access depends on the data.                               */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    q                                     Bitsliced state, 8 words      */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_crypto_aes_bitslice_inv_sbox      Apply inverse S-box           */
+/*    _nx_crypto_aes_bitslice_subword       Key schedule substitution     */
+/*    _nx_crypto_aes_bitslice_encrypt       Bitsliced AES encryption      */
+/*                                                                        */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP static VOID _nx_crypto_aes_bitslice_sbox(UINT *q)
+{
+UINT x0, x1, x2, x3, x4, x5, x6, x7;
+UINT y1, y2, y3, y4, y5, y6, y7, y8, y9;
+UINT y10, y11, y12, y13, y14, y15, y16, y17, y18, y19;
+UINT y20, y21;
+UINT z0, z1, z2, z3, z4, z5, z6, z7, z8, z9;
+UINT z10, z11, z12, z13, z14, z15, z16, z17;
+UINT t0, t1, t2, t3, t4, t5, t6, t7, t8, t9;
+UINT t10, t11, t12, t13, t14, t15, t16, t17, t18, t19;
+UINT t20, t21, t22, t23, t24, t25, t26, t27, t28, t29;
+UINT t30, t31, t32, t33, t34, t35, t36, t37, t38, t39;
+UINT t40, t41, t42, t43, t44, t45, t46, t47, t48, t49;
+UINT t50, t51, t52, t53, t54, t55, t56, t57, t58, t59;
+UINT t60, t61, t62, t63, t64, t65, t66, t67;
+UINT s0, s1, s2, s3, s4, s5, s6, s7;
+
+    x0 = q[7]; x1 = q[6]; x2 = q[5]; x3 = q[4];
+    x4 = q[3]; x5 = q[2]; x6 = q[1]; x7 = q[0];
+
+    /* Top linear transformation. */
+    y14 = x3 ^ x5;
+    y13 = x0 ^ x6;
+    y9 = x0 ^ x3;
+    y8 = x0 ^ x5;
+    t0 = x1 ^ x2;
+    y1 = t0 ^ x7;
+    y4 = y1 ^ x3;
+    y12 = y13 ^ y14;
+    y2 = y1 ^ x0;
+    y5 = y1 ^ x6;
+    y3 = y5 ^ y8;
+    t1 = x4 ^ y12;
+    y15 = t1 ^ x5;
+    y20 = t1 ^ x1;
+    y6 = y15 ^ x7;
+    y10 = y15 ^ t0;
+    y11 = y20 ^ y9;
+    y7 = x7 ^ y11;
+    y17 = y10 ^ y11;
+    y19 = y10 ^ y8;
+    y16 = t0 ^ y11;
+    y21 = y13 ^ y16;
+    y18 = x0 ^ y16;
+
+    /* Non-linear section. */
+    t2 = y12 & y15;
+    t3 = y3 & y6;
+    t4 = t3 ^ t2;
+    t5 = y4 & x7;
+    t6 = t5 ^ t2;
+    t7 = y13 & y16;
+    t8 = y5 & y1;
+    t9 = t8 ^ t7;
+    t10 = y2 & y7;
+    t11 = t10 ^ t7;
+    t12 = y9 & y11;
+    t13 = y14 & y17;
+    t14 = t13 ^ t12;
+    t15 = y8 & y10;
+    t16 = t15 ^ t12;
+    t17 = t4 ^ t14;
+    t18 = t6 ^ t16;
+    t19 = t9 ^ t14;
+    t20 = t11 ^ t16;
+    t21 = t17 ^ y20;
+    t22 = t18 ^ y19;
+    t23 = t19 ^ y21;
+    t24 = t20 ^ y18;
+
+    t25 = t21 ^ t22;
+    t26 = t21 & t23;
+    t27 = t24 ^ t26;
+    t28 = t25 & t27;
+    t29 = t28 ^ t22;
+    t30 = t23 ^ t24;
+    t31 = t22 ^ t26;
+    t32 = t31 & t30;
+    t33 = t32 ^ t24;
+    t34 = t23 ^ t33;
+    t35 = t27 ^ t33;
+    t36 = t24 & t35;
+    t37 = t36 ^ t34;
+    t38 = t27 ^ t36;
+    t39 = t29 & t38;
+    t40 = t25 ^ t39;
+
+    t41 = t40 ^ t37;
+    t42 = t29 ^ t33;
+    t43 = t29 ^ t40;
+    t44 = t33 ^ t37;
+    t45 = t42 ^ t41;
+    z0 = t44 & y15;
+    z1 = t37 & y6;
+    z2 = t33 & x7;
+    z3 = t43 & y16;
+    z4 = t40 & y1;
+    z5 = t29 & y7;
+    z6 = t42 & y11;
+    z7 = t45 & y17;
+    z8 = t41 & y10;
+    z9 = t44 & y12;
+    z10 = t37 & y3;
+    z11 = t33 & y4;
+    z12 = t43 & y13;
+    z13 = t40 & y5;
+    z14 = t29 & y2;
+    z15 = t42 & y9;
+    z16 = t45 & y14;
+    z17 = t41 & y8;
+
+    /* Bottom linear transformation. */
+    t46 = z15 ^ z16;
+    t47 = z10 ^ z11;
+    t48 = z5 ^ z13;
+    t49 = z9 ^ z10;
+    t50 = z2 ^ z12;
+    t51 = z2 ^ z5;
+    t52 = z7 ^ z8;
+    t53 = z0 ^ z3;
+    t54 = z6 ^ z7;
+    t55 = z16 ^ z17;
+    t56 = z12 ^ t48;
+    t57 = t50 ^ t53;
+    t58 = z4 ^ t46;
+    t59 = z3 ^ t54;
+    t60 = t46 ^ t57;
+    t61 = z14 ^ t57;
+    t62 = t52 ^ t58;
+    t63 = t49 ^ t58;
+    t64 = z4 ^ t59;
+    t65 = t61 ^ t62;
+    t66 = z1 ^ t63;
+    s0 = t59 ^ t63;
+    s6 = t56 ^ ~t62;
+    s7 = t48 ^ ~t60;
+    t67 = t64 ^ t65;
+    s3 = t53 ^ t66;
+    s4 = t51 ^ t66;
+    s5 = t47 ^ t65;
+    s1 = t64 ^ ~s3;
+    s2 = t55 ^ ~t67;
+
+    q[7] = s0; q[6] = s1; q[5] = s2; q[4] = s3;
+    q[3] = s4; q[2] = s5; q[1] = s6; q[0] = s7;
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_aes_bitslice_inv_sbox                    PORTABLE C      */
+/*                                                           6.1          */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function applies the inverse AES S-box to a bitsliced state.   */
+/*    The S-box is an inversion in GF(2^8) followed by an affine map, so  */
+/*    the inverse is the forward circuit between two inverse affine maps. */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    q                                     Bitsliced state, 8 words      */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_crypto_aes_bitslice_sbox          Apply S-box                   */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_crypto_aes_bitslice_decrypt       Bitsliced AES decryption      */
+/*                                                                        */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP static VOID _nx_crypto_aes_bitslice_inv_sbox(UINT *q)
+{
+UINT q0, q1, q2, q3, q4, q5, q6, q7;
+
+    /* Undo the affine map, so that the S-box computes only the inversion. */
+    q0 = ~q[0]; q1 = ~q[1]; q2 = q[2]; q3 = q[3];
+    q4 = q[4]; q5 = ~q[5]; q6 = ~q[6]; q7 = q[7];
+    q[7] = q1 ^ q4 ^ q6;
+    q[6] = q0 ^ q3 ^ q5;
+    q[5] = q7 ^ q2 ^ q4;
+    q[4] = q6 ^ q1 ^ q3;
+    q[3] = q5 ^ q0 ^ q2;
+    q[2] = q4 ^ q7 ^ q1;
+    q[1] = q3 ^ q6 ^ q0;
+    q[0] = q2 ^ q5 ^ q7;
+
+    _nx_crypto_aes_bitslice_sbox(q);
+
+    /* Apply the inverse affine map to the result. */
+    q0 = ~q[0]; q1 = ~q[1]; q2 = q[2]; q3 = q[3];
+    q4 = q[4]; q5 = ~q[5]; q6 = ~q[6]; q7 = q[7];
+    q[7] = q1 ^ q4 ^ q6;
+    q[6] = q0 ^ q3 ^ q5;
+    q[5] = q7 ^ q2 ^ q4;
+    q[4] = q6 ^ q1 ^ q3;
+    q[3] = q5 ^ q0 ^ q2;
+    q[2] = q4 ^ q7 ^ q1;
+    q[1] = q3 ^ q6 ^ q0;
+    q[0] = q2 ^ q5 ^ q7;
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_aes_bitslice_ortho                       PORTABLE C      */
+/*                                                           6.1          */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function converts between the normal and the bitsliced         */
+/*    representation of two blocks. The transform is its own inverse.     */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    q                                     State, 8 words                */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_crypto_aes_bitslice_subword       Key schedule substitution     */
+/*    _nx_crypto_aes_bitslice_key_expansion Bitsliced key expansion       */
+/*    _nx_crypto_aes_bitslice_blocks        Process blocks in pairs       */
+/*                                                                        */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP static VOID _nx_crypto_aes_bitslice_ortho(UINT *q)
+{
+UINT a, b;
+
+#define NX_CRYPTO_AES_BITSLICE_SWAP(cl, ch, s, x, y) \
+    a = (x); b = (y);                                  \
+    (x) = (a & (cl)) | ((b & (cl)) << (s));            \
+    (y) = ((a & (ch)) >> (s)) | (b & (ch))
+
+    NX_CRYPTO_AES_BITSLICE_SWAP(0x55555555, 0xAAAAAAAA, 1, q[0], q[1]);
+    NX_CRYPTO_AES_BITSLICE_SWAP(0x55555555, 0xAAAAAAAA, 1, q[2], q[3]);
+    NX_CRYPTO_AES_BITSLICE_SWAP(0x55555555, 0xAAAAAAAA, 1, q[4], q[5]);
+    NX_CRYPTO_AES_BITSLICE_SWAP(0x55555555, 0xAAAAAAAA, 1, q[6], q[7]);
+
+    NX_CRYPTO_AES_BITSLICE_SWAP(0x33333333, 0xCCCCCCCC, 2, q[0], q[2]);
+    NX_CRYPTO_AES_BITSLICE_SWAP(0x33333333, 0xCCCCCCCC, 2, q[1], q[3]);
+    NX_CRYPTO_AES_BITSLICE_SWAP(0x33333333, 0xCCCCCCCC, 2, q[4], q[6]);
+    NX_CRYPTO_AES_BITSLICE_SWAP(0x33333333, 0xCCCCCCCC, 2, q[5], q[7]);
+
+    NX_CRYPTO_AES_BITSLICE_SWAP(0x0F0F0F0F, 0xF0F0F0F0, 4, q[0], q[4]);
+    NX_CRYPTO_AES_BITSLICE_SWAP(0x0F0F0F0F, 0xF0F0F0F0, 4, q[1], q[5]);
+    NX_CRYPTO_AES_BITSLICE_SWAP(0x0F0F0F0F, 0xF0F0F0F0, 4, q[2], q[6]);
+    NX_CRYPTO_AES_BITSLICE_SWAP(0x0F0F0F0F, 0xF0F0F0F0, 4, q[3], q[7]);
+
+#undef NX_CRYPTO_AES_BITSLICE_SWAP
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_aes_bitslice_add_round_key               PORTABLE C      */
+/*                                                           6.1          */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function performs AddRoundKey on a bitsliced state. The round  */
+/*    key is stored compressed, 4 words per round, and is expanded to the */
+/*    8 words of the state here.                                          */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    q                                     Bitsliced state, 8 words      */
+/*    round_key                             Compressed round key          */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_crypto_aes_bitslice_encrypt       Bitsliced AES encryption      */
+/*    _nx_crypto_aes_bitslice_decrypt       Bitsliced AES decryption      */
+/*                                                                        */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP static VOID _nx_crypto_aes_bitslice_add_round_key(UINT *q, UINT *round_key)
+{
+UINT i;
+UINT x;
+
+    for (i = 0; i < 4; i++)
+    {
+        x = round_key[i] & 0x55555555;
+        q[i << 1] ^= x | (x << 1);
+        x = round_key[i] & 0xAAAAAAAA;
+        q[(i << 1) + 1] ^= x | (x >> 1);
+    }
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_aes_bitslice_shift_rows                  PORTABLE C      */
+/*                                                           6.1          */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function performs ShiftRows on a bitsliced state, or           */
+/*    InvShiftRows if inverse is set.                                     */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    q                                     Bitsliced state, 8 words      */
+/*    inverse                               Non-zero for InvShiftRows     */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_crypto_aes_bitslice_encrypt       Bitsliced AES encryption      */
+/*    _nx_crypto_aes_bitslice_decrypt       Bitsliced AES decryption      */
+/*                                                                        */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP static VOID _nx_crypto_aes_bitslice_shift_rows(UINT *q, UINT inverse)
+{
+UINT i;
+UINT x;
+
+    for (i = 0; i < 8; i++)
+    {
+        x = q[i];
+        if (inverse)
+        {
+            q[i] = (x & 0x000000FF) |
+                   ((x & 0x00003F00) << 2) | ((x & 0x0000C000) >> 6) |
+                   ((x & 0x000F0000) << 4) | ((x & 0x00F00000) >> 4) |
+                   ((x & 0x03000000) << 6) | ((x & 0xFC000000) >> 2);
+        }
+        else
+        {
+            q[i] = (x & 0x000000FF) |
+                   ((x & 0x0000FC00) >> 2) | ((x & 0x00000300) << 6) |
+                   ((x & 0x00F00000) >> 4) | ((x & 0x000F0000) << 4) |
+                   ((x & 0xC0000000) >> 6) | ((x & 0x3F000000) << 2);
+        }
+    }
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_aes_bitslice_mix_columns                 PORTABLE C      */
+/*                                                           6.1          */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function performs MixColumns on a bitsliced state.             */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    q                                     Bitsliced state, 8 words      */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_crypto_aes_bitslice_encrypt       Bitsliced AES encryption      */
+/*                                                                        */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP static VOID _nx_crypto_aes_bitslice_mix_columns(UINT *q)
+{
+UINT q0, q1, q2, q3, q4, q5, q6, q7;
+UINT r0, r1, r2, r3, r4, r5, r6, r7;
+
+    q0 = q[0]; q1 = q[1]; q2 = q[2]; q3 = q[3];
+    q4 = q[4]; q5 = q[5]; q6 = q[6]; q7 = q[7];
+    r0 = NX_CRYPTO_AES_BITSLICE_ROTATE8(q0);
+    r1 = NX_CRYPTO_AES_BITSLICE_ROTATE8(q1);
+    r2 = NX_CRYPTO_AES_BITSLICE_ROTATE8(q2);
+    r3 = NX_CRYPTO_AES_BITSLICE_ROTATE8(q3);
+    r4 = NX_CRYPTO_AES_BITSLICE_ROTATE8(q4);
+    r5 = NX_CRYPTO_AES_BITSLICE_ROTATE8(q5);
+    r6 = NX_CRYPTO_AES_BITSLICE_ROTATE8(q6);
+    r7 = NX_CRYPTO_AES_BITSLICE_ROTATE8(q7);
+
+    q[0] = q7 ^ r7 ^ r0 ^ NX_CRYPTO_AES_BITSLICE_ROTATE16(q0 ^ r0);
+    q[1] = q0 ^ r0 ^ q7 ^ r7 ^ r1 ^ NX_CRYPTO_AES_BITSLICE_ROTATE16(q1 ^ r1);
+    q[2] = q1 ^ r1 ^ r2 ^ NX_CRYPTO_AES_BITSLICE_ROTATE16(q2 ^ r2);
+    q[3] = q2 ^ r2 ^ q7 ^ r7 ^ r3 ^ NX_CRYPTO_AES_BITSLICE_ROTATE16(q3 ^ r3);
+    q[4] = q3 ^ r3 ^ q7 ^ r7 ^ r4 ^ NX_CRYPTO_AES_BITSLICE_ROTATE16(q4 ^ r4);
+    q[5] = q4 ^ r4 ^ r5 ^ NX_CRYPTO_AES_BITSLICE_ROTATE16(q5 ^ r5);
+    q[6] = q5 ^ r5 ^ r6 ^ NX_CRYPTO_AES_BITSLICE_ROTATE16(q6 ^ r6);
+    q[7] = q6 ^ r6 ^ r7 ^ NX_CRYPTO_AES_BITSLICE_ROTATE16(q7 ^ r7);
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_aes_bitslice_inv_mix_columns             PORTABLE C      */
+/*                                                           6.1          */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function performs InvMixColumns on a bitsliced state.          */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    q                                     Bitsliced state, 8 words      */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_crypto_aes_bitslice_decrypt       Bitsliced AES decryption      */
+/*                                                                        */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP static VOID _nx_crypto_aes_bitslice_inv_mix_columns(UINT *q)
+{
+UINT q0, q1, q2, q3, q4, q5, q6, q7;
+UINT r0, r1, r2, r3, r4, r5, r6, r7;
+
+    q0 = q[0]; q1 = q[1]; q2 = q[2]; q3 = q[3];
+    q4 = q[4]; q5 = q[5]; q6 = q[6]; q7 = q[7];
+    r0 = NX_CRYPTO_AES_BITSLICE_ROTATE8(q0);
+    r1 = NX_CRYPTO_AES_BITSLICE_ROTATE8(q1);
+    r2 = NX_CRYPTO_AES_BITSLICE_ROTATE8(q2);
+    r3 = NX_CRYPTO_AES_BITSLICE_ROTATE8(q3);
+    r4 = NX_CRYPTO_AES_BITSLICE_ROTATE8(q4);
+    r5 = NX_CRYPTO_AES_BITSLICE_ROTATE8(q5);
+    r6 = NX_CRYPTO_AES_BITSLICE_ROTATE8(q6);
+    r7 = NX_CRYPTO_AES_BITSLICE_ROTATE8(q7);
+
+    q[0] = q5 ^ q6 ^ q7 ^ r0 ^ r5 ^ r7 ^ NX_CRYPTO_AES_BITSLICE_ROTATE16(q0 ^ q5 ^ q6 ^ r0 ^ r5);
+    q[1] = q0 ^ q5 ^ r0 ^ r1 ^ r5 ^ r6 ^ r7 ^ NX_CRYPTO_AES_BITSLICE_ROTATE16(q1 ^ q5 ^ q7 ^ r1 ^ r5 ^ r6);
+    q[2] = q0 ^ q1 ^ q6 ^ r1 ^ r2 ^ r6 ^ r7 ^ NX_CRYPTO_AES_BITSLICE_ROTATE16(q0 ^ q2 ^ q6 ^ r2 ^ r6 ^ r7);
+    q[3] = q0 ^ q1 ^ q2 ^ q5 ^ q6 ^ r0 ^ r2 ^ r3 ^ r5 ^ NX_CRYPTO_AES_BITSLICE_ROTATE16(q0 ^ q1 ^ q3 ^ q5 ^ q6 ^ q7 ^ r0 ^ r3 ^ r5 ^ r7);
+    q[4] = q1 ^ q2 ^ q3 ^ q5 ^ r1 ^ r3 ^ r4 ^ r5 ^ r6 ^ r7 ^ NX_CRYPTO_AES_BITSLICE_ROTATE16(q1 ^ q2 ^ q4 ^ q5 ^ q7 ^ r1 ^ r4 ^ r5 ^ r6);
+    q[5] = q2 ^ q3 ^ q4 ^ q6 ^ r2 ^ r4 ^ r5 ^ r6 ^ r7 ^ NX_CRYPTO_AES_BITSLICE_ROTATE16(q2 ^ q3 ^ q5 ^ q6 ^ r2 ^ r5 ^ r6 ^ r7);
+    q[6] = q3 ^ q4 ^ q5 ^ q7 ^ r3 ^ r5 ^ r6 ^ r7 ^ NX_CRYPTO_AES_BITSLICE_ROTATE16(q3 ^ q4 ^ q6 ^ q7 ^ r3 ^ r6 ^ r7);
+    q[7] = q4 ^ q5 ^ q6 ^ r4 ^ r6 ^ r7 ^ NX_CRYPTO_AES_BITSLICE_ROTATE16(q4 ^ q5 ^ q7 ^ r4 ^ r7);
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_aes_bitslice_encrypt                     PORTABLE C      */
+/*                                                           6.1          */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function encrypts the two blocks of a bitsliced state.         */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    round_key                             Compressed key schedule       */
+/*    num_rounds                            Number of rounds (10/12/14)   */
+/*    q                                     Bitsliced state, 8 words      */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_crypto_aes_bitslice_sbox          Apply S-box                   */
+/*    _nx_crypto_aes_bitslice_shift_rows    Perform ShiftRows             */
+/*    _nx_crypto_aes_bitslice_mix_columns   Perform MixColumns            */
+/*    _nx_crypto_aes_bitslice_add_round_key Perform AddRoundKey           */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_crypto_aes_bitslice_blocks        Process blocks in pairs       */
+/*                                                                        */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP static VOID _nx_crypto_aes_bitslice_encrypt(UINT *round_key, UINT num_rounds, UINT *q)
+{
+UINT round;
+
+    _nx_crypto_aes_bitslice_add_round_key(q, round_key);
+    for (round = 1; round < num_rounds; round++)
+    {
+        _nx_crypto_aes_bitslice_sbox(q);
+        _nx_crypto_aes_bitslice_shift_rows(q, NX_CRYPTO_FALSE);
+        _nx_crypto_aes_bitslice_mix_columns(q);
+        _nx_crypto_aes_bitslice_add_round_key(q, round_key + (round << 2));
+    }
+    _nx_crypto_aes_bitslice_sbox(q);
+    _nx_crypto_aes_bitslice_shift_rows(q, NX_CRYPTO_FALSE);
+    _nx_crypto_aes_bitslice_add_round_key(q, round_key + (num_rounds << 2));
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_aes_bitslice_decrypt                     PORTABLE C      */
+/*                                                           6.1          */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function decrypts the two blocks of a bitsliced state. It uses */
+/*    the same key schedule as encryption.                                */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    round_key                             Compressed key schedule       */
+/*    num_rounds                            Number of rounds (10/12/14)   */
+/*    q                                     Bitsliced state, 8 words      */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_crypto_aes_bitslice_inv_sbox      Apply inverse S-box           */
+/*    _nx_crypto_aes_bitslice_shift_rows    Perform InvShiftRows          */
+/*    _nx_crypto_aes_bitslice_inv_mix_columns                             */
+/*                                          Perform InvMixColumns         */
+/*    _nx_crypto_aes_bitslice_add_round_key Perform AddRoundKey           */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_crypto_aes_bitslice_blocks        Process blocks in pairs       */
+/*                                                                        */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP static VOID _nx_crypto_aes_bitslice_decrypt(UINT *round_key, UINT num_rounds, UINT *q)
+{
+UINT round;
+
+    _nx_crypto_aes_bitslice_add_round_key(q, round_key + (num_rounds << 2));
+    for (round = num_rounds - 1; round > 0; round--)
+    {
+        _nx_crypto_aes_bitslice_shift_rows(q, NX_CRYPTO_TRUE);
+        _nx_crypto_aes_bitslice_inv_sbox(q);
+        _nx_crypto_aes_bitslice_add_round_key(q, round_key + (round << 2));
+        _nx_crypto_aes_bitslice_inv_mix_columns(q);
+    }
+    _nx_crypto_aes_bitslice_shift_rows(q, NX_CRYPTO_TRUE);
+    _nx_crypto_aes_bitslice_inv_sbox(q);
+    _nx_crypto_aes_bitslice_add_round_key(q, round_key);
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_aes_bitslice_blocks                      PORTABLE C      */
+/*                                                           6.1          */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function encrypts or decrypts consecutive 16 byte blocks, two  */
+/*    at a time. An odd last block is processed alone. Input and output   */
+/*    may point to the same buffer.                                       */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    round_key                             Compressed key schedule       */
+/*    num_rounds                            Number of rounds (10/12/14)   */
+/*    input                                 Pointer to input blocks       */
+/*    output                                Pointer to output blocks      */
+/*    length                                Length of input, a multiple   */
+/*                                            of 16 bytes                 */
+/*    op                                    NX_CRYPTO_ENCRYPT or          */
+/*                                            NX_CRYPTO_DECRYPT           */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_crypto_aes_bitslice_ortho         Convert to and from bitsliced */
+/*    _nx_crypto_aes_bitslice_encrypt       Bitsliced AES encryption      */
+/*    _nx_crypto_aes_bitslice_decrypt       Bitsliced AES decryption      */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_crypto_aes_encrypt                Perform AES mode encryption   */
+/*    _nx_crypto_aes_encrypt_blocks         Encrypt consecutive blocks    */
+/*    _nx_crypto_aes_decrypt                Perform AES mode decryption   */
+/*                                                                        */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP static VOID _nx_crypto_aes_bitslice_blocks(UINT *round_key, UINT num_rounds, UCHAR *input, UCHAR *output,
+                                                          UINT length, UINT op)
+{
+UINT   q[8];
+UCHAR *second;
+
+    do
+    {
+
+        /* Without a second block, the first one fills both slots. */
+        if (length >= (NX_CRYPTO_AES_BLOCK_SIZE << 1))
+        {
+            second = input + NX_CRYPTO_AES_BLOCK_SIZE;
+        }
+        else
+        {
+            second = input;
+        }
+
+        q[0] = NX_CRYPTO_AES_BITSLICE_LOAD32(input);
+        q[2] = NX_CRYPTO_AES_BITSLICE_LOAD32(input + 4);
+        q[4] = NX_CRYPTO_AES_BITSLICE_LOAD32(input + 8);
+        q[6] = NX_CRYPTO_AES_BITSLICE_LOAD32(input + 12);
+        q[1] = NX_CRYPTO_AES_BITSLICE_LOAD32(second);
+        q[3] = NX_CRYPTO_AES_BITSLICE_LOAD32(second + 4);
+        q[5] = NX_CRYPTO_AES_BITSLICE_LOAD32(second + 8);
+        q[7] = NX_CRYPTO_AES_BITSLICE_LOAD32(second + 12);
+
+        _nx_crypto_aes_bitslice_ortho(q);
+        if (op == NX_CRYPTO_ENCRYPT)
+        {
+            _nx_crypto_aes_bitslice_encrypt(round_key, num_rounds, q);
+        }
+        else
+        {
+            _nx_crypto_aes_bitslice_decrypt(round_key, num_rounds, q);
+        }
+        _nx_crypto_aes_bitslice_ortho(q);
+
+        NX_CRYPTO_AES_BITSLICE_STORE32(output, q[0]);
+        NX_CRYPTO_AES_BITSLICE_STORE32(output + 4, q[2]);
+        NX_CRYPTO_AES_BITSLICE_STORE32(output + 8, q[4]);
+        NX_CRYPTO_AES_BITSLICE_STORE32(output + 12, q[6]);
+        output += NX_CRYPTO_AES_BLOCK_SIZE;
+
+        if (second == input)
+        {
+            break;
+        }
+
+        NX_CRYPTO_AES_BITSLICE_STORE32(output, q[1]);
+        NX_CRYPTO_AES_BITSLICE_STORE32(output + 4, q[3]);
+        NX_CRYPTO_AES_BITSLICE_STORE32(output + 8, q[5]);
+        NX_CRYPTO_AES_BITSLICE_STORE32(output + 12, q[7]);
+        output += NX_CRYPTO_AES_BLOCK_SIZE;
+
+        input += NX_CRYPTO_AES_BLOCK_SIZE << 1;
+        length -= NX_CRYPTO_AES_BLOCK_SIZE << 1;
+    } while (length >= NX_CRYPTO_AES_BLOCK_SIZE);
+
+#ifdef NX_SECURE_KEY_CLEAR
+    NX_CRYPTO_MEMSET(q, 0, sizeof(q));
+#endif /* NX_SECURE_KEY_CLEAR  */
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_aes_bitslice_subword                     PORTABLE C      */
+/*                                                           6.1          */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function performs SubWord for the key expansion with the       */
+/*    bitsliced S-box.                                                    */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    word                                  The input 4-byte word         */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    UINT word                             The value after being         */
+/*                                            substituted.                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_crypto_aes_bitslice_ortho         Convert to and from bitsliced */
+/*    _nx_crypto_aes_bitslice_sbox          Apply S-box                   */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_crypto_aes_bitslice_key_expansion Bitsliced key expansion       */
+/*                                                                        */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP static UINT _nx_crypto_aes_bitslice_subword(UINT word)
+{
+UINT q[8];
+
+    NX_CRYPTO_MEMSET(q, 0, sizeof(q));
+    q[0] = word;
+    _nx_crypto_aes_bitslice_ortho(q);
+    _nx_crypto_aes_bitslice_sbox(q);
+    _nx_crypto_aes_bitslice_ortho(q);
+    return(q[0]);
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_aes_bitslice_key_expansion               PORTABLE C      */
+/*                                                           6.1          */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This routine performs AES Key Expansion as outlined in section 5.2  */
+/*    of the AES specification (Pub 197), then converts each round key to */
+/*    the compressed bitsliced form used by both encryption and           */
+/*    decryption. The key is read from the start of the key schedule and  */
+/*    the decrypt key schedule is used as scratch, as the Equivalent      */
+/*    Inverse Cipher is not needed.                                       */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    aes_ptr                               Pointer to AES control block  */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_crypto_aes_bitslice_subword       Apply sbox substitution       */
+/*    _nx_crypto_aes_bitslice_ortho         Convert to bitsliced          */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_crypto_aes_key_set                Set AES crypto key            */
+/*                                                                        */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP static VOID _nx_crypto_aes_bitslice_key_expansion(NX_CRYPTO_AES *aes_ptr)
+{
+UINT   q[8];
+UINT  *expanded_key = aes_ptr -> nx_crypto_aes_decrypt_key_schedule;
+UINT  *round_key = aes_ptr -> nx_crypto_aes_key_schedule;
+UCHAR *key = (UCHAR *)aes_ptr -> nx_crypto_aes_key_schedule;
+UINT   key_size = aes_ptr -> nx_crypto_aes_key_size;
+UINT   total = ((UINT)aes_ptr -> nx_crypto_aes_rounds + 1) << 2;
+UINT   temp = 0;
+UINT   i, j, k;
+
+    for (i = 0; i < key_size; i++)
+    {
+        temp = NX_CRYPTO_AES_BITSLICE_LOAD32(key + (i << 2));
+        expanded_key[i] = temp;
+    }
+
+    for (i = key_size, j = 0, k = 0; i < total; i++)
+    {
+        if (j == 0)
+        {
+            temp = (temp << 24) | (temp >> 8);
+            temp = _nx_crypto_aes_bitslice_subword(temp) ^ aes_rcon_array[k];
+        }
+        else if ((key_size > NX_CRYPTO_AES_KEY_SIZE_192_BITS) && (j == 4))
+        {
+            temp = _nx_crypto_aes_bitslice_subword(temp);
+        }
+        temp ^= expanded_key[i - key_size];
+        expanded_key[i] = temp;
+
+        if (++j == key_size)
+        {
+            j = 0;
+            k++;
+        }
+    }
+
+    /* Convert each round key. Both slots of the state hold the same key, so
+       alternate bits of the two halves carry the whole bitsliced round key. */
+    for (i = 0; i < total; i += 4)
+    {
+        q[0] = q[1] = expanded_key[i];
+        q[2] = q[3] = expanded_key[i + 1];
+        q[4] = q[5] = expanded_key[i + 2];
+        q[6] = q[7] = expanded_key[i + 3];
+        _nx_crypto_aes_bitslice_ortho(q);
+        round_key[i]     = (q[0] & 0x55555555) | (q[1] & 0xAAAAAAAA);
+        round_key[i + 1] = (q[2] & 0x55555555) | (q[3] & 0xAAAAAAAA);
+        round_key[i + 2] = (q[4] & 0x55555555) | (q[5] & 0xAAAAAAAA);
+        round_key[i + 3] = (q[6] & 0x55555555) | (q[7] & 0xAAAAAAAA);
+    }
+
+    NX_CRYPTO_MEMSET(expanded_key, 0, total << 2);
+
+#ifdef NX_SECURE_KEY_CLEAR
+    NX_CRYPTO_MEMSET(q, 0, sizeof(q));
+    temp = 0;
+#endif /* NX_SECURE_KEY_CLEAR  */
+}
+
+#elif !defined(NX_CRYPTO_AES_USE_TTABLE_ROUNDS)
 
 
 /**************************************************************************/
@@ -991,6 +1865,214 @@ ULONG  val;
 #endif /* NX_SECURE_KEY_CLEAR  */
 }
 
+#else /* NX_CRYPTO_AES_USE_TTABLE_ROUNDS */
+
+/* Load and store one column of the state in the word order of the key schedule. */
+#ifndef NX_CRYPTO_ENABLE_UNALIGNED_ACCESS
+#define NX_CRYPTO_AES_LOAD_COLUMN(p)        (SET_MSB_BYTE((UINT)(p)[0]) | SET_2ND_BYTE((UINT)(p)[1]) | \
+                                             SET_3RD_BYTE((UINT)(p)[2]) | SET_LSB_BYTE((UINT)(p)[3]))
+#define NX_CRYPTO_AES_STORE_COLUMN(p, val)  (p)[0] = (UCHAR)EXTRACT_MSB_BYTE(val); \
+                                            (p)[1] = (UCHAR)EXTRACT_2ND_BYTE(val); \
+                                            (p)[2] = (UCHAR)EXTRACT_3RD_BYTE(val); \
+                                            (p)[3] = (UCHAR)EXTRACT_LSB_BYTE(val)
+#else
+#define NX_CRYPTO_AES_LOAD_COLUMN(p)        (*(UINT *)(p))
+#define NX_CRYPTO_AES_STORE_COLUMN(p, val)  *(UINT *)(p) = (val)
+#endif
+
+/* One column of a full round. The byte order of a, b, c and d picks up ShiftRows. */
+#define NX_CRYPTO_AES_ENCRYPT_COLUMN(a, b, c, d, key)                      \
+    ((UINT)aes_encryption_table[EXTRACT_MSB_BYTE(a)] ^                     \
+     LEFT_ROTATE24((UINT)aes_encryption_table[EXTRACT_2ND_BYTE(b)]) ^      \
+     LEFT_ROTATE16((UINT)aes_encryption_table[EXTRACT_3RD_BYTE(c)]) ^      \
+     LEFT_ROTATE8((UINT)aes_encryption_table[EXTRACT_LSB_BYTE(d)]) ^ (key))
+
+#define NX_CRYPTO_AES_DECRYPT_COLUMN(a, b, c, d, key)                      \
+    ((UINT)aes_decryption_table[EXTRACT_MSB_BYTE(a)] ^                     \
+     LEFT_ROTATE24((UINT)aes_decryption_table[EXTRACT_2ND_BYTE(b)]) ^      \
+     LEFT_ROTATE16((UINT)aes_decryption_table[EXTRACT_3RD_BYTE(c)]) ^      \
+     LEFT_ROTATE8((UINT)aes_decryption_table[EXTRACT_LSB_BYTE(d)]) ^ (key))
+
+#define NX_CRYPTO_AES_ENCRYPT_ROUND(t, s, w)                                 \
+    t##0 = NX_CRYPTO_AES_ENCRYPT_COLUMN(s##0, s##1, s##2, s##3, (w)[0]);    \
+    t##1 = NX_CRYPTO_AES_ENCRYPT_COLUMN(s##1, s##2, s##3, s##0, (w)[1]);    \
+    t##2 = NX_CRYPTO_AES_ENCRYPT_COLUMN(s##2, s##3, s##0, s##1, (w)[2]);    \
+    t##3 = NX_CRYPTO_AES_ENCRYPT_COLUMN(s##3, s##0, s##1, s##2, (w)[3])
+
+#define NX_CRYPTO_AES_DECRYPT_ROUND(t, s, w)                                 \
+    t##0 = NX_CRYPTO_AES_DECRYPT_COLUMN(s##0, s##3, s##2, s##1, (w)[0]);    \
+    t##1 = NX_CRYPTO_AES_DECRYPT_COLUMN(s##1, s##0, s##3, s##2, (w)[1]);    \
+    t##2 = NX_CRYPTO_AES_DECRYPT_COLUMN(s##2, s##1, s##0, s##3, (w)[2]);    \
+    t##3 = NX_CRYPTO_AES_DECRYPT_COLUMN(s##3, s##2, s##1, s##0, (w)[3])
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_aes_encrypt_block                        PORTABLE C      */
+/*                                                           6.1          */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function encrypts one 16 byte block with the 32-bit T-table    */
+/*    round.  The state is kept in local words for all rounds, two rounds */
+/*    are unrolled per loop iteration, and the final round is taken from  */
+/*    the S-box directly.  Input and output may overlap.                  */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    w                                     Encryption key schedule       */
+/*    num_rounds                            Number of rounds (10/12/14)   */
+/*    input                                 Pointer to input block        */
+/*    output                                Pointer to output block       */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_crypto_aes_encrypt                Perform AES mode encryption   */
+/*                                                                        */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP static VOID _nx_crypto_aes_encrypt_block(UINT *w, UINT num_rounds, UCHAR *input, UCHAR *output)
+{
+UINT  s0, s1, s2, s3;
+UINT  t0, t1, t2, t3;
+UINT *end;
+
+    s0 = NX_CRYPTO_AES_LOAD_COLUMN(input) ^ w[0];
+    s1 = NX_CRYPTO_AES_LOAD_COLUMN(input + 4) ^ w[1];
+    s2 = NX_CRYPTO_AES_LOAD_COLUMN(input + 8) ^ w[2];
+    s3 = NX_CRYPTO_AES_LOAD_COLUMN(input + 12) ^ w[3];
+
+    /* Rounds 1 to num_rounds - 1, an odd number for every key size. */
+    end = w + (num_rounds - 1) * 4;
+    for (w += 4; w < end; w += 8)
+    {
+        NX_CRYPTO_AES_ENCRYPT_ROUND(t, s, w);
+        NX_CRYPTO_AES_ENCRYPT_ROUND(s, t, w + 4);
+    }
+    NX_CRYPTO_AES_ENCRYPT_ROUND(t, s, w);
+    w += 4;
+
+    /* Final round: SubBytes, ShiftRows and AddRoundKey. */
+    s0 = (SET_MSB_BYTE((UINT)sub_bytes_sbox[EXTRACT_MSB_BYTE(t0)]) |
+          SET_2ND_BYTE((UINT)sub_bytes_sbox[EXTRACT_2ND_BYTE(t1)]) |
+          SET_3RD_BYTE((UINT)sub_bytes_sbox[EXTRACT_3RD_BYTE(t2)]) |
+          SET_LSB_BYTE((UINT)sub_bytes_sbox[EXTRACT_LSB_BYTE(t3)])) ^ w[0];
+    s1 = (SET_MSB_BYTE((UINT)sub_bytes_sbox[EXTRACT_MSB_BYTE(t1)]) |
+          SET_2ND_BYTE((UINT)sub_bytes_sbox[EXTRACT_2ND_BYTE(t2)]) |
+          SET_3RD_BYTE((UINT)sub_bytes_sbox[EXTRACT_3RD_BYTE(t3)]) |
+          SET_LSB_BYTE((UINT)sub_bytes_sbox[EXTRACT_LSB_BYTE(t0)])) ^ w[1];
+    s2 = (SET_MSB_BYTE((UINT)sub_bytes_sbox[EXTRACT_MSB_BYTE(t2)]) |
+          SET_2ND_BYTE((UINT)sub_bytes_sbox[EXTRACT_2ND_BYTE(t3)]) |
+          SET_3RD_BYTE((UINT)sub_bytes_sbox[EXTRACT_3RD_BYTE(t0)]) |
+          SET_LSB_BYTE((UINT)sub_bytes_sbox[EXTRACT_LSB_BYTE(t1)])) ^ w[2];
+    s3 = (SET_MSB_BYTE((UINT)sub_bytes_sbox[EXTRACT_MSB_BYTE(t3)]) |
+          SET_2ND_BYTE((UINT)sub_bytes_sbox[EXTRACT_2ND_BYTE(t0)]) |
+          SET_3RD_BYTE((UINT)sub_bytes_sbox[EXTRACT_3RD_BYTE(t1)]) |
+          SET_LSB_BYTE((UINT)sub_bytes_sbox[EXTRACT_LSB_BYTE(t2)])) ^ w[3];
+
+    NX_CRYPTO_AES_STORE_COLUMN(output, s0);
+    NX_CRYPTO_AES_STORE_COLUMN(output + 4, s1);
+    NX_CRYPTO_AES_STORE_COLUMN(output + 8, s2);
+    NX_CRYPTO_AES_STORE_COLUMN(output + 12, s3);
+
+#ifdef NX_SECURE_KEY_CLEAR
+    s0 = 0; s1 = 0; s2 = 0; s3 = 0;
+    t0 = 0; t1 = 0; t2 = 0; t3 = 0;
+#endif /* NX_SECURE_KEY_CLEAR  */
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_aes_decrypt_block                        PORTABLE C      */
+/*                                                           6.1          */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function decrypts one 16 byte block with the 32-bit T-table    */
+/*    round of the Equivalent Inverse Cipher.  The state is kept in local */
+/*    words for all rounds.  Input and output may overlap.                */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    w                                     Decryption key schedule       */
+/*    v                                     Encryption key schedule       */
+/*    num_rounds                            Number of rounds (10/12/14)   */
+/*    input                                 Pointer to input block        */
+/*    output                                Pointer to output block       */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_crypto_aes_decrypt                Perform AES mode decryption   */
+/*                                                                        */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP static VOID _nx_crypto_aes_decrypt_block(UINT *w, UINT *v, UINT num_rounds, UCHAR *input, UCHAR *output)
+{
+UINT  s0, s1, s2, s3;
+UINT  t0, t1, t2, t3;
+UINT *rk;
+
+    rk = v + num_rounds * 4;
+    s0 = NX_CRYPTO_AES_LOAD_COLUMN(input) ^ rk[0];
+    s1 = NX_CRYPTO_AES_LOAD_COLUMN(input + 4) ^ rk[1];
+    s2 = NX_CRYPTO_AES_LOAD_COLUMN(input + 8) ^ rk[2];
+    s3 = NX_CRYPTO_AES_LOAD_COLUMN(input + 12) ^ rk[3];
+
+    /* Rounds num_rounds - 1 down to 1, an odd number for every key size. */
+    for (rk = w + (num_rounds - 1) * 4; rk > w + 4; rk -= 8)
+    {
+        NX_CRYPTO_AES_DECRYPT_ROUND(t, s, rk);
+        NX_CRYPTO_AES_DECRYPT_ROUND(s, t, rk - 4);
+    }
+    NX_CRYPTO_AES_DECRYPT_ROUND(t, s, rk);
+
+    /* Final round: InvSubBytes, InvShiftRows and AddRoundKey. */
+    s0 = (SET_MSB_BYTE((UINT)inverse_sub_bytes_sbox[EXTRACT_MSB_BYTE(t0)]) |
+          SET_2ND_BYTE((UINT)inverse_sub_bytes_sbox[EXTRACT_2ND_BYTE(t3)]) |
+          SET_3RD_BYTE((UINT)inverse_sub_bytes_sbox[EXTRACT_3RD_BYTE(t2)]) |
+          SET_LSB_BYTE((UINT)inverse_sub_bytes_sbox[EXTRACT_LSB_BYTE(t1)])) ^ w[0];
+    s1 = (SET_MSB_BYTE((UINT)inverse_sub_bytes_sbox[EXTRACT_MSB_BYTE(t1)]) |
+          SET_2ND_BYTE((UINT)inverse_sub_bytes_sbox[EXTRACT_2ND_BYTE(t0)]) |
+          SET_3RD_BYTE((UINT)inverse_sub_bytes_sbox[EXTRACT_3RD_BYTE(t3)]) |
+          SET_LSB_BYTE((UINT)inverse_sub_bytes_sbox[EXTRACT_LSB_BYTE(t2)])) ^ w[1];
+    s2 = (SET_MSB_BYTE((UINT)inverse_sub_bytes_sbox[EXTRACT_MSB_BYTE(t2)]) |
+          SET_2ND_BYTE((UINT)inverse_sub_bytes_sbox[EXTRACT_2ND_BYTE(t1)]) |
+          SET_3RD_BYTE((UINT)inverse_sub_bytes_sbox[EXTRACT_3RD_BYTE(t0)]) |
+          SET_LSB_BYTE((UINT)inverse_sub_bytes_sbox[EXTRACT_LSB_BYTE(t3)])) ^ w[2];
+    s3 = (SET_MSB_BYTE((UINT)inverse_sub_bytes_sbox[EXTRACT_MSB_BYTE(t3)]) |
+          SET_2ND_BYTE((UINT)inverse_sub_bytes_sbox[EXTRACT_2ND_BYTE(t2)]) |
+          SET_3RD_BYTE((UINT)inverse_sub_bytes_sbox[EXTRACT_3RD_BYTE(t1)]) |
+          SET_LSB_BYTE((UINT)inverse_sub_bytes_sbox[EXTRACT_LSB_BYTE(t0)])) ^ w[3];
+
+    NX_CRYPTO_AES_STORE_COLUMN(output, s0);
+    NX_CRYPTO_AES_STORE_COLUMN(output + 4, s1);
+    NX_CRYPTO_AES_STORE_COLUMN(output + 8, s2);
+    NX_CRYPTO_AES_STORE_COLUMN(output + 12, s3);
+
+#ifdef NX_SECURE_KEY_CLEAR
+    s0 = 0; s1 = 0; s2 = 0; s3 = 0;
+    t0 = 0; t1 = 0; t2 = 0; t3 = 0;
+#endif /* NX_SECURE_KEY_CLEAR  */
+}
+#endif /* NX_CRYPTO_AES_USE_BITSLICE */
+
 
 /**************************************************************************/
 /*                                                                        */
@@ -1033,6 +2115,8 @@ ULONG  val;
 /*                                            encryption                  */
 /*    _nx_crypto_aes_sub_shift_roundkey     Perform the last step in AES  */
 /*                                            encryption operation        */
+/*    _nx_crypto_aes_encrypt_block          T-table AES encryption        */
+/*    _nx_crypto_aes_bitslice_blocks        Bitsliced AES encryption      */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -1052,10 +2136,12 @@ NX_CRYPTO_KEEP UINT _nx_crypto_aes_encrypt(NX_CRYPTO_AES *aes_ptr, UCHAR *input,
 {
 UINT  num_rounds;
 UINT *w;
+#if !defined(NX_CRYPTO_AES_USE_BITSLICE) && !defined(NX_CRYPTO_AES_USE_TTABLE_ROUNDS)
 #ifndef NX_CRYPTO_ENABLE_UNALIGNED_ACCESS
 UCHAR *aes_state;
 #else
 UINT *buf;
+#endif
 #endif
 
 
@@ -1070,6 +2156,11 @@ UINT *buf;
         return(NX_CRYPTO_INVALID_PARAMETER);
     }
 
+#if defined(NX_CRYPTO_AES_USE_BITSLICE)
+    _nx_crypto_aes_bitslice_blocks(w, num_rounds, input, output, NX_CRYPTO_AES_BLOCK_SIZE, NX_CRYPTO_ENCRYPT);
+#elif defined(NX_CRYPTO_AES_USE_TTABLE_ROUNDS)
+    _nx_crypto_aes_encrypt_block(w, num_rounds, input, output);
+#else
 #ifndef NX_CRYPTO_ENABLE_UNALIGNED_ACCESS
     aes_state = (UCHAR *)aes_ptr -> nx_crypto_aes_state;
     aes_state[0] = input[0];
@@ -1127,6 +2218,79 @@ UINT *buf;
     buf[2] = aes_ptr -> nx_crypto_aes_state[2];
     buf[3] = aes_ptr -> nx_crypto_aes_state[3];
 #endif
+#endif /* NX_CRYPTO_AES_USE_BITSLICE */
+
+    return(NX_CRYPTO_SUCCESS);
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_aes_encrypt_blocks                       PORTABLE C      */
+/*                                                           6.1          */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function performs AES encryption on consecutive 16 byte blocks,*/
+/*    each independently of the others. It lets modes such as CTR, GCM    */
+/*    and CCM hand several blocks to the bitsliced core at once. Without  */
+/*    NX_CRYPTO_AES_USE_BITSLICE, the blocks are encrypted one by one. The*/
+/*    output buffer may point to the same input buffer.                   */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    aes_ptr                               Pointer to AES control block  */
+/*    input                                 Pointer to input blocks       */
+/*    output                                Pointer to output buffer      */
+/*    length                                Length of input, a multiple   */
+/*                                            of 16 bytes                 */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_crypto_aes_bitslice_blocks        Process blocks in pairs       */
+/*    _nx_crypto_aes_encrypt                Perform AES mode encryption   */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_crypto_method_aes_ccm_operation   Handle AES CCM operation      */
+/*    _nx_crypto_method_aes_gcm_operation   Handle AES GCM operation      */
+/*    _nx_crypto_method_aes_ctr_operation   Handle AES CTR operation      */
+/*                                                                        */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP UINT _nx_crypto_aes_encrypt_blocks(NX_CRYPTO_AES *aes_ptr, UCHAR *input, UCHAR *output, UINT length)
+{
+#ifndef NX_CRYPTO_AES_USE_BITSLICE
+UINT status;
+#endif /* NX_CRYPTO_AES_USE_BITSLICE */
+
+    if ((aes_ptr -> nx_crypto_aes_rounds < 10) || (aes_ptr -> nx_crypto_aes_rounds > 14))
+    {
+        return(NX_CRYPTO_INVALID_PARAMETER);
+    }
+
+#ifdef NX_CRYPTO_AES_USE_BITSLICE
+    _nx_crypto_aes_bitslice_blocks(aes_ptr -> nx_crypto_aes_key_schedule, aes_ptr -> nx_crypto_aes_rounds,
+                                   input, output, length, NX_CRYPTO_ENCRYPT);
+#else
+    do
+    {
+        status = _nx_crypto_aes_encrypt(aes_ptr, input, output, NX_CRYPTO_AES_BLOCK_SIZE);
+        if (status)
+        {
+            return(status);
+        }
+
+        input += NX_CRYPTO_AES_BLOCK_SIZE;
+        output += NX_CRYPTO_AES_BLOCK_SIZE;
+        length -= (length > NX_CRYPTO_AES_BLOCK_SIZE) ? NX_CRYPTO_AES_BLOCK_SIZE : length;
+    } while (length >= NX_CRYPTO_AES_BLOCK_SIZE);
+#endif /* NX_CRYPTO_AES_USE_BITSLICE */
 
     return(NX_CRYPTO_SUCCESS);
 }
@@ -1135,6 +2299,7 @@ UINT *buf;
 /**************************************************************************/
 /* Key expansion routines                                                 */
 /**************************************************************************/
+#ifndef NX_CRYPTO_AES_USE_BITSLICE
 /**************************************************************************/
 /*                                                                        */
 /*  FUNCTION                                               RELEASE        */
@@ -1420,6 +2585,7 @@ ULONG key;
 
     return;
 }
+#endif /* NX_CRYPTO_AES_USE_BITSLICE */
 
 
 /**************************************************************************/
@@ -1489,6 +2655,8 @@ ULONG key;
 /*                                            decryption                  */
 /*    _nx_crypto_aes_inv_sub_shift_roundkey Perform the last step in AES  */
 /*                                            decryption operation        */
+/*    _nx_crypto_aes_decrypt_block          T-table AES decryption        */
+/*    _nx_crypto_aes_bitslice_blocks        Bitsliced AES decryption      */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -1509,18 +2677,25 @@ ULONG key;
 NX_CRYPTO_KEEP UINT _nx_crypto_aes_decrypt(NX_CRYPTO_AES *aes_ptr, UCHAR *input, UCHAR *output, UINT length)
 {
 UINT  num_rounds;
+#if !defined(NX_CRYPTO_AES_USE_BITSLICE) && !defined(NX_CRYPTO_AES_USE_TTABLE_ROUNDS)
 UINT  round;
+#endif
+#ifndef NX_CRYPTO_AES_USE_BITSLICE
 UINT *w;
+#endif /* NX_CRYPTO_AES_USE_BITSLICE */
 UINT *v;
+#if !defined(NX_CRYPTO_AES_USE_BITSLICE) && !defined(NX_CRYPTO_AES_USE_TTABLE_ROUNDS)
 #ifndef NX_CRYPTO_ENABLE_UNALIGNED_ACCESS
 UCHAR *aes_state;
 #else
 UINT *buf;
+#endif
 #endif
 
 
     NX_CRYPTO_PARAMETER_NOT_USED(length);
 
+#ifndef NX_CRYPTO_AES_USE_BITSLICE
     /* If the flag is not set, we assume the inverse key expansion 
        table is not created yet. Call the routine to create one. */
     if(aes_ptr -> nx_crypto_aes_inverse_key_expanded == 0)
@@ -1530,8 +2705,10 @@ UINT *buf;
 
 
     w = aes_ptr -> nx_crypto_aes_decrypt_key_schedule;
+#endif /* NX_CRYPTO_AES_USE_BITSLICE */
     v = aes_ptr -> nx_crypto_aes_key_schedule;
 
+#if !defined(NX_CRYPTO_AES_USE_BITSLICE) && !defined(NX_CRYPTO_AES_USE_TTABLE_ROUNDS)
 #ifndef NX_CRYPTO_ENABLE_UNALIGNED_ACCESS
     aes_state = (UCHAR *)aes_ptr -> nx_crypto_aes_state;
     aes_state[0] = input[0];
@@ -1557,6 +2734,7 @@ UINT *buf;
     aes_ptr -> nx_crypto_aes_state[2] = buf[2];
     aes_ptr -> nx_crypto_aes_state[3] = buf[3];
 #endif
+#endif
 
 
     num_rounds = aes_ptr -> nx_crypto_aes_rounds;
@@ -1566,6 +2744,11 @@ UINT *buf;
         return(NX_CRYPTO_INVALID_PARAMETER);
     }
 
+#if defined(NX_CRYPTO_AES_USE_BITSLICE)
+    _nx_crypto_aes_bitslice_blocks(v, num_rounds, input, output, NX_CRYPTO_AES_BLOCK_SIZE, NX_CRYPTO_DECRYPT);
+#elif defined(NX_CRYPTO_AES_USE_TTABLE_ROUNDS)
+    _nx_crypto_aes_decrypt_block(w, v, num_rounds, input, output);
+#else
     _nx_crypto_aes_add_round_key(aes_ptr, &v[num_rounds * 4]);
 
     for (round = num_rounds - 1; round >= 1; --round)
@@ -1601,6 +2784,7 @@ UINT *buf;
     buf[2] = aes_ptr -> nx_crypto_aes_state[2];
     buf[3] = aes_ptr -> nx_crypto_aes_state[3];
 #endif
+#endif /* NX_CRYPTO_AES_USE_BITSLICE */
 
     return(NX_CRYPTO_SUCCESS);
 }
@@ -1638,6 +2822,9 @@ UINT *buf;
 /*                                                                        */
 /*    _nx_crypto_aes_key_expansion          Key expansion for encryption  */
 /*    _nx_crypto_aes_key_expansion_inverse  Key expansion for decryption  */
+/*    _nx_crypto_aes_bitslice_key_expansion                               */
+/*                                          Key expansion for bitsliced   */
+/*                                            encryption and decryption   */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -1687,7 +2874,11 @@ UINT   i;
     }
 
 
+#ifdef NX_CRYPTO_AES_USE_BITSLICE
+    _nx_crypto_aes_bitslice_key_expansion(aes_ptr);
+#else
     _nx_crypto_aes_key_expansion(aes_ptr);
+#endif /* NX_CRYPTO_AES_USE_BITSLICE */
 
     /* Move key_expansion_inverse into the decrypt logic. 
        No reason to build the inverse table if the application doesn't do decryption. */
@@ -1759,7 +2950,7 @@ NX_CRYPTO_KEEP UINT  _nx_crypto_method_aes_init(struct NX_CRYPTO_METHOD_STRUCT *
     }
 
     /* Verify the metadata addrsss is 4-byte aligned. */
-    if((((ULONG)crypto_metadata) & 0x3) != 0)
+    if((((ALIGN_TYPE)crypto_metadata) & 0x3) != 0)
     {
         return(NX_CRYPTO_PTR_ERROR);
     }
@@ -1918,7 +3109,7 @@ UINT    status;
     NX_CRYPTO_STATE_CHECK
 
     /* Verify the metadata addrsss is 4-byte aligned. */
-    if((method == NX_CRYPTO_NULL) || (crypto_metadata == NX_CRYPTO_NULL) || ((((ULONG)crypto_metadata) & 0x3) != 0))
+    if((method == NX_CRYPTO_NULL) || (crypto_metadata == NX_CRYPTO_NULL) || ((((ALIGN_TYPE)crypto_metadata) & 0x3) != 0))
     {
         return(NX_CRYPTO_PTR_ERROR);
     }
@@ -2072,7 +3263,7 @@ UINT    status;
     NX_CRYPTO_STATE_CHECK
 
     /* Verify the metadata addrsss is 4-byte aligned. */
-    if((method == NX_CRYPTO_NULL) || (crypto_metadata == NX_CRYPTO_NULL) || ((((ULONG)crypto_metadata) & 0x3) != 0))
+    if((method == NX_CRYPTO_NULL) || (crypto_metadata == NX_CRYPTO_NULL) || ((((ALIGN_TYPE)crypto_metadata) & 0x3) != 0))
     {
         return(NX_CRYPTO_PTR_ERROR);
     }
@@ -2246,7 +3437,7 @@ UINT    status;
     NX_CRYPTO_STATE_CHECK
 
     /* Verify the metadata addrsss is 4-byte aligned. */
-    if((method == NX_CRYPTO_NULL) || (crypto_metadata == NX_CRYPTO_NULL) || ((((ULONG)crypto_metadata) & 0x3) != 0))
+    if((method == NX_CRYPTO_NULL) || (crypto_metadata == NX_CRYPTO_NULL) || ((((ALIGN_TYPE)crypto_metadata) & 0x3) != 0))
     {
         return(NX_CRYPTO_PTR_ERROR);
     }
@@ -2300,7 +3491,7 @@ UINT    status;
 
             status = _nx_crypto_ccm_decrypt_update(NX_CRYPTO_DECRYPT_UPDATE,
                                                    ctx, &(ctx -> nx_crypto_aes_mode_context.ccm),
-                                                   (UINT (*)(VOID *, UCHAR *, UCHAR *, UINT))_nx_crypto_aes_encrypt,
+                                                   (UINT (*)(VOID *, UCHAR *, UCHAR *, UINT))_nx_crypto_aes_encrypt_blocks,
                                                    input, output, input_length_in_byte - (method -> nx_crypto_ICV_size_in_bits >> 3),
                                                    NX_CRYPTO_AES_BLOCK_SIZE);
             if (status)
@@ -2349,7 +3540,7 @@ UINT    status;
 
             status = _nx_crypto_ccm_encrypt_update(NX_CRYPTO_ENCRYPT_UPDATE,
                                                    ctx, &(ctx -> nx_crypto_aes_mode_context.ccm),
-                                                   (UINT (*)(VOID *, UCHAR *, UCHAR *, UINT))_nx_crypto_aes_encrypt,
+                                                   (UINT (*)(VOID *, UCHAR *, UCHAR *, UINT))_nx_crypto_aes_encrypt_blocks,
                                                    input, output, input_length_in_byte,
                                                    NX_CRYPTO_AES_BLOCK_SIZE);
             if (status)
@@ -2401,7 +3592,7 @@ UINT    status;
         {
             status = _nx_crypto_ccm_decrypt_update(NX_CRYPTO_DECRYPT_UPDATE,
                                                    ctx, &(ctx -> nx_crypto_aes_mode_context.ccm),
-                                                   (UINT (*)(VOID *, UCHAR *, UCHAR *, UINT))_nx_crypto_aes_encrypt,
+                                                   (UINT (*)(VOID *, UCHAR *, UCHAR *, UINT))_nx_crypto_aes_encrypt_blocks,
                                                    input, output, input_length_in_byte,
                                                    NX_CRYPTO_AES_BLOCK_SIZE);
 
@@ -2437,7 +3628,7 @@ UINT    status;
 
             status = _nx_crypto_ccm_encrypt_update(NX_CRYPTO_ENCRYPT_UPDATE,
                                                    ctx, &(ctx -> nx_crypto_aes_mode_context.ccm),
-                                                   (UINT (*)(VOID *, UCHAR *, UCHAR *, UINT))_nx_crypto_aes_encrypt,
+                                                   (UINT (*)(VOID *, UCHAR *, UCHAR *, UINT))_nx_crypto_aes_encrypt_blocks,
                                                    input, output, input_length_in_byte,
                                                    NX_CRYPTO_AES_BLOCK_SIZE);
         } break;
@@ -2545,7 +3736,7 @@ UINT    status;
     NX_CRYPTO_STATE_CHECK
 
     /* Verify the metadata addrsss is 4-byte aligned. */
-    if((method == NX_CRYPTO_NULL) || (crypto_metadata == NX_CRYPTO_NULL) || ((((ULONG)crypto_metadata) & 0x3) != 0))
+    if((method == NX_CRYPTO_NULL) || (crypto_metadata == NX_CRYPTO_NULL) || ((((ALIGN_TYPE)crypto_metadata) & 0x3) != 0))
     {
         return(NX_CRYPTO_PTR_ERROR);
     }
@@ -2598,7 +3789,7 @@ UINT    status;
             }
 
             status = _nx_crypto_gcm_decrypt_update(ctx, &(ctx -> nx_crypto_aes_mode_context.gcm),
-                                                   (UINT (*)(VOID *, UCHAR *, UCHAR *, UINT))_nx_crypto_aes_encrypt,
+                                                   (UINT (*)(VOID *, UCHAR *, UCHAR *, UINT))_nx_crypto_aes_encrypt_blocks,
                                                    input, output, message_len,
                                                    NX_CRYPTO_AES_BLOCK_SIZE);
 
@@ -2643,7 +3834,7 @@ UINT    status;
             }
 
             status = _nx_crypto_gcm_encrypt_update(ctx, &(ctx -> nx_crypto_aes_mode_context.gcm),
-                                                   (UINT (*)(VOID *, UCHAR *, UCHAR *, UINT))_nx_crypto_aes_encrypt,
+                                                   (UINT (*)(VOID *, UCHAR *, UCHAR *, UINT))_nx_crypto_aes_encrypt_blocks,
                                                    input, output, input_length_in_byte,
                                                    NX_CRYPTO_AES_BLOCK_SIZE);
 
@@ -2676,7 +3867,7 @@ UINT    status;
         case NX_CRYPTO_DECRYPT_UPDATE:
         {
             status = _nx_crypto_gcm_decrypt_update(ctx, &(ctx -> nx_crypto_aes_mode_context.gcm),
-                                                   (UINT (*)(VOID *, UCHAR *, UCHAR *, UINT))_nx_crypto_aes_encrypt,
+                                                   (UINT (*)(VOID *, UCHAR *, UCHAR *, UINT))_nx_crypto_aes_encrypt_blocks,
                                                    input, output, input_length_in_byte,
                                                    NX_CRYPTO_AES_BLOCK_SIZE);
         } break;
@@ -2714,7 +3905,7 @@ UINT    status;
         case NX_CRYPTO_ENCRYPT_UPDATE:
         {
             status = _nx_crypto_gcm_encrypt_update(ctx, &(ctx -> nx_crypto_aes_mode_context.gcm),
-                                                   (UINT (*)(VOID *, UCHAR *, UCHAR *, UINT))_nx_crypto_aes_encrypt,
+                                                   (UINT (*)(VOID *, UCHAR *, UCHAR *, UINT))_nx_crypto_aes_encrypt_blocks,
                                                    input, output, input_length_in_byte,
                                                    NX_CRYPTO_AES_BLOCK_SIZE);
         } break;
@@ -2837,7 +4028,7 @@ UINT                status;
     NX_CRYPTO_STATE_CHECK
 
     /* Verify the metadata addrsss is 4-byte aligned. */
-    if((method == NX_CRYPTO_NULL) || (crypto_metadata == NX_CRYPTO_NULL) || ((((ULONG)crypto_metadata) & 0x3) != 0))
+    if((method == NX_CRYPTO_NULL) || (crypto_metadata == NX_CRYPTO_NULL) || ((((ALIGN_TYPE)crypto_metadata) & 0x3) != 0))
     {
         return(NX_CRYPTO_PTR_ERROR);
     }
@@ -2863,7 +4054,7 @@ UINT                status;
             }
 
             status = _nx_crypto_ctr_encrypt(ctx, &(ctx -> nx_crypto_aes_mode_context.ctr),
-                                            (UINT (*)(VOID *, UCHAR *, UCHAR *, UINT))_nx_crypto_aes_encrypt,
+                                            (UINT (*)(VOID *, UCHAR *, UCHAR *, UINT))_nx_crypto_aes_encrypt_blocks,
                                             input, output, input_length_in_byte,
                                             NX_CRYPTO_AES_BLOCK_SIZE);
         } break;
@@ -2882,7 +4073,7 @@ UINT                status;
         case NX_CRYPTO_DECRYPT_UPDATE:
         {
             status = _nx_crypto_ctr_encrypt(ctx, &(ctx -> nx_crypto_aes_mode_context.ctr),
-                                            (UINT (*)(VOID *, UCHAR *, UCHAR *, UINT))_nx_crypto_aes_encrypt,
+                                            (UINT (*)(VOID *, UCHAR *, UCHAR *, UINT))_nx_crypto_aes_encrypt_blocks,
                                             input, output, input_length_in_byte,
                                             NX_CRYPTO_AES_BLOCK_SIZE);
         } break;
@@ -2988,7 +4179,7 @@ UINT            status;
     NX_CRYPTO_STATE_CHECK
 
     /* Verify the metadata addrsss is 4-byte aligned. */
-    if((method == NX_CRYPTO_NULL) || (key == NX_CRYPTO_NULL) || (crypto_metadata == NX_CRYPTO_NULL) || ((((ULONG)crypto_metadata) & 0x3) != 0))
+    if((method == NX_CRYPTO_NULL) || (key == NX_CRYPTO_NULL) || (crypto_metadata == NX_CRYPTO_NULL) || ((((ALIGN_TYPE)crypto_metadata) & 0x3) != 0))
     {
         return(NX_CRYPTO_PTR_ERROR);
     }
@@ -181,6 +181,50 @@ UCHAR last_cipher[NX_CRYPTO_CCM_BLOCK_SIZE];
 #endif /* NX_SECURE_KEY_CLEAR  */
 }
 
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_ccm_counter_increment                    PORTABLE C      */
+/*                                                           6.1          */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function increments the counter field of the counter block     */
+/*    A(i), which is the last L bytes of the block. L is one more than    */
+/*    the flags in the first byte of the block.                           */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    A                                     Pointer to counter block      */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_crypto_ccm_encrypt_update         Update data for CCM mode      */
+/*                                                                        */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP static VOID _nx_crypto_ccm_counter_increment(UCHAR *A)
+{
+UINT i;
+
+    for (i = NX_CRYPTO_CCM_BLOCK_SIZE - 1; i >= (UINT)(NX_CRYPTO_CCM_BLOCK_SIZE - 1 - A[0]); i--)
+    {
+        A[i] = (UCHAR)(A[i] + 1);
+        if (A[i] != 0)
+        {
+            break;
+        }
+    }
+}
+
 NX_CRYPTO_KEEP static VOID _nx_crypto_ccm_authentication_init(VOID *crypto_metadata,
                                                               UINT (*crypto_function)(VOID *, UCHAR *, UCHAR *, UINT),
                                                               UCHAR *a_data, UINT a_len, UINT m_len,
@@ -217,8 +261,10 @@ UCHAR temp_len = 0;
     /* B(0) = Flags||Nonce||l(m)  */
     B[0] = Flags;
     NX_CRYPTO_MEMCPY(B + 1, Nonce, (UINT)15 - L); /* Use case of memcpy is verified. */
-    B[14] = (UCHAR)(m_len >> 8);
-    B[15] = (UCHAR)(m_len);
+    for (temp_len = 0; (temp_len < L) && (temp_len < sizeof(m_len)); temp_len++)
+    {
+        B[15 - temp_len] = (UCHAR)(m_len >> (temp_len << 3));
+    }
 
     /* Get the CBC-MAC value X(1).  */
     _nx_crypto_ccm_cbc_pad(crypto_metadata, crypto_function, B, X, block_size, X, block_size);
@@ -316,6 +362,7 @@ UCHAR *A = ccm_metadata -> nx_crypto_ccm_A;
     }
 
     ccm_metadata -> nx_crypto_ccm_icv_length = icv_len;
+    ccm_metadata -> nx_crypto_ccm_partial_length = 0;
 
     /* Data authentication.  */
     if (icv_len > 0)
@@ -350,7 +397,14 @@ UCHAR *A = ccm_metadata -> nx_crypto_ccm_A;
 /*                                                                        */
 /*  DESCRIPTION                                                           */
 /*                                                                        */
-/*    This function updates data for GCM encryption or decryption.        */
+/*    This function updates data for CCM encryption or decryption. The    */
+/*    CTR key stream and the CBC-MAC are computed in the same pass over   */
+/*    the data, and the two block cipher inputs of each step are handed   */
+/*    to crypto_function in one call of two consecutive blocks, so it     */
+/*    must accept more than one block, as _nx_crypto_aes_encrypt_blocks   */
+/*    does. The length of the data does not need to be a multiple of the */
+/*    block size. A block left unfinished is continued by the next        */
+/*    update.                                                             */
 /*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
@@ -368,7 +422,8 @@ UCHAR *A = ccm_metadata -> nx_crypto_ccm_A;
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
-/*    _nx_crypto_ccm_cbc_pad                Update data for CCM mode      */
+/*    _nx_crypto_ccm_counter_increment      Increment counter block       */
+/*    _nx_crypto_ccm_xor                    Perform CCM XOR operation     */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -388,7 +443,18 @@ NX_CRYPTO_KEEP UINT _nx_crypto_ccm_encrypt_update(UINT op, VOID *crypto_metadata
                                                   UCHAR *input, UCHAR *output, UINT length, UINT block_size)
 {
 UCHAR *A = ccm_metadata -> nx_crypto_ccm_A;
-UCHAR  X[NX_CRYPTO_CCM_BLOCK_SIZE];
+UCHAR *X = ccm_metadata -> nx_crypto_ccm_X;
+UCHAR *partial_key_stream = ccm_metadata -> nx_crypto_ccm_key_stream;
+UINT   partial_length = ccm_metadata -> nx_crypto_ccm_partial_length;
+UCHAR  blocks[NX_CRYPTO_CCM_BLOCK_SIZE << 1];
+UCHAR *key_stream = blocks;
+UCHAR *mac_block = blocks + NX_CRYPTO_CCM_BLOCK_SIZE;
+UCHAR *message;
+UCHAR  in_byte;
+UCHAR  out_byte;
+UINT   authenticate;
+UINT   key_stream_ahead;
+UINT   remaining;
 UINT   i = 0, k = 0;
 
     /* Check the block size.  */
@@ -397,54 +463,130 @@ UINT   i = 0, k = 0;
         return(NX_CRYPTO_PTR_ERROR);
     }
 
-    if (op == NX_CRYPTO_ENCRYPT_UPDATE)
+    /* The CBC-MAC covers the plain text, which is the input when encrypting
+       and the output when decrypting.  */
+    authenticate = (ccm_metadata -> nx_crypto_ccm_icv_length > 0) &&
+                   ((op == NX_CRYPTO_ENCRYPT_UPDATE) || (op == NX_CRYPTO_DECRYPT_UPDATE));
+
+    /* Finish the block left unfinished by the previous call. Its plain text is
+       XOR'ed into X as it arrives, and X is encrypted once the block is full.  */
+    while ((partial_length > 0) && (length > 0))
     {
-        
-        /* Data authentication.  */
-        if (ccm_metadata -> nx_crypto_ccm_icv_length > 0)
+        in_byte = *input++;
+        out_byte = (UCHAR)(in_byte ^ partial_key_stream[partial_length]);
+        *output++ = out_byte;
+        if (authenticate)
         {
+            X[partial_length] ^= (op == NX_CRYPTO_DECRYPT_UPDATE) ? out_byte : in_byte;
+        }
+        length--;
 
-            /* Compute authentication tag T.  */
-            _nx_crypto_ccm_cbc_pad(crypto_metadata, crypto_function, input,
-                                   ccm_metadata -> nx_crypto_ccm_X, length,
-                                   ccm_metadata -> nx_crypto_ccm_X, block_size);
+        partial_length++;
+        if (partial_length == block_size)
+        {
+            if (authenticate)
+            {
+                crypto_function(crypto_metadata, X, X, block_size);
+            }
+            partial_length = 0;
         }
     }
 
-    /* Data encryption.  */
-    if (length > 0)
+    message = (op == NX_CRYPTO_DECRYPT_UPDATE) ? output : input;
+
+    /* When decrypting, M(i) is only known once E(Key, A(i)) is, so the key stream
+       runs one block ahead and is encrypted with the CBC-MAC input of the
+       previous block.  */
+    key_stream_ahead = authenticate && (op == NX_CRYPTO_DECRYPT_UPDATE);
+    if (key_stream_ahead && (length > 0))
+    {
+        _nx_crypto_ccm_counter_increment(A);
+        NX_CRYPTO_MEMCPY(key_stream, A, block_size); /* Use case of memcpy is verified. */
+        crypto_function(crypto_metadata, key_stream, key_stream, block_size);
+    }
+
+    /* Parse the message as M(1)||M(2)||..., where the block M(i) is a 16-byte string.  */
+    /* Cipher text block: C(i) = E(Key, A(i)) ^ M(i).  */
+    /* CBC-MAC value: X(i + 1) = E(Key, X(i) ^ M(i)), with M(i) padded with zero.  */
+    /* Both block cipher inputs of a step are encrypted in one call, and each block
+       of the message is read and written once.  */
+    for (i = 0; i < length; i += block_size)
     {
+        remaining = ((length - i) < block_size) ? (length - i) : block_size;
 
-        /* Parse the plain text as M(1)||M(2)||..., where the block M(i) is a 16-byte string.  */
-        /* Cipher text block: C(i) = E(Key, A(i)) ^ M(i)   */
-        for (i = 0; i < length; i += block_size)
+        if (remaining < block_size)
         {
-            A[15] = (UCHAR)(A[15] + 1);
-            crypto_function(crypto_metadata, A, X, block_size);
 
-            for (k = 0; (k < block_size) && ((i + k) < length); k++)
+            /* The message ends in the middle of a block. Keep its key stream for
+               the next call, and fold its plain text into X, which is encrypted
+               when the block is complete or the tag is calculated.  */
+            if (!key_stream_ahead)
+            {
+                _nx_crypto_ccm_counter_increment(A);
+                NX_CRYPTO_MEMCPY(key_stream, A, block_size); /* Use case of memcpy is verified. */
+                crypto_function(crypto_metadata, key_stream, key_stream, block_size);
+            }
+
+            for (k = 0; k < remaining; k++)
             {
-                output[i + k] = X[k] ^ input[i + k];
+                in_byte = input[i + k];
+                out_byte = (UCHAR)(in_byte ^ key_stream[k]);
+                output[i + k] = out_byte;
+                if (authenticate)
+                {
+                    X[k] ^= (op == NX_CRYPTO_DECRYPT_UPDATE) ? out_byte : in_byte;
+                }
             }
+
+            NX_CRYPTO_MEMCPY(partial_key_stream, key_stream, block_size); /* Use case of memcpy is verified. */
+            partial_length = remaining;
+            break;
         }
-    }
 
-    if (op == NX_CRYPTO_DECRYPT_UPDATE)
-    {
-        
-        /* Data authentication.  */
-        if (ccm_metadata -> nx_crypto_ccm_icv_length > 0)
+        if (key_stream_ahead)
         {
+            for (k = 0; k < block_size; k++)
+            {
+                output[i + k] = key_stream[k] ^ input[i + k];
+            }
+        }
 
-            /* Compute authentication tag T.  */
-            _nx_crypto_ccm_cbc_pad(crypto_metadata, crypto_function, output,
-                                   ccm_metadata -> nx_crypto_ccm_X, length,
-                                   ccm_metadata -> nx_crypto_ccm_X, block_size);
+        if (authenticate)
+        {
+            _nx_crypto_ccm_xor(message + i, X, mac_block);
+        }
+
+        if (key_stream_ahead && ((length - i) == block_size))
+        {
+
+            /* Last block, no more key stream is needed.  */
+            crypto_function(crypto_metadata, mac_block, mac_block, block_size);
+        }
+        else
+        {
+            _nx_crypto_ccm_counter_increment(A);
+            NX_CRYPTO_MEMCPY(key_stream, A, block_size); /* Use case of memcpy is verified. */
+            crypto_function(crypto_metadata, blocks, blocks, authenticate ? (block_size << 1) : block_size);
+        }
+
+        if (authenticate)
+        {
+            NX_CRYPTO_MEMCPY(X, mac_block, block_size); /* Use case of memcpy is verified. */
+        }
+
+        if (!key_stream_ahead)
+        {
+            for (k = 0; k < block_size; k++)
+            {
+                output[i + k] = key_stream[k] ^ input[i + k];
+            }
         }
     }
 
+    ccm_metadata -> nx_crypto_ccm_partial_length = partial_length;
+
 #ifdef NX_SECURE_KEY_CLEAR
-    NX_CRYPTO_MEMSET(X, 0, sizeof(X));
+    NX_CRYPTO_MEMSET(blocks, 0, sizeof(blocks));
 #endif
 
     return(NX_CRYPTO_SUCCESS);
@@ -511,11 +653,18 @@ UINT i;
     if (ccm_metadata -> nx_crypto_ccm_icv_length > 0)
     {
 
+        /* The last block of the message is padded with zero, which leaves X as it is.  */
+        if (ccm_metadata -> nx_crypto_ccm_partial_length > 0)
+        {
+            crypto_function(crypto_metadata, ccm_metadata -> nx_crypto_ccm_X, ccm_metadata -> nx_crypto_ccm_X, block_size);
+            ccm_metadata -> nx_crypto_ccm_partial_length = 0;
+        }
+
         /* The authentication tag T is the leftmost M bytes of the CBC-MAC value X(t + 1).  */
         NX_CRYPTO_MEMCPY(icv, ccm_metadata -> nx_crypto_ccm_X, ccm_metadata -> nx_crypto_ccm_icv_length); /* Use case of memcpy is verified. */
 
-        /* Get encryption block X.  */
-        A[15] = 0;
+        /* Get encryption block X with A(0), whose counter field is zero.  */
+        NX_CRYPTO_MEMSET(A + NX_CRYPTO_CCM_BLOCK_SIZE - 1 - A[0], 0, (UINT)A[0] + 1);
         crypto_function(crypto_metadata, A, A, block_size);
 
         /* Encrypt authentication tag.  */
@@ -593,8 +742,15 @@ UINT i;
     if (ccm_metadata -> nx_crypto_ccm_icv_length > 0)
     {
 
+        /* The last block of the message is padded with zero, which leaves X as it is.  */
+        if (ccm_metadata -> nx_crypto_ccm_partial_length > 0)
+        {
+            crypto_function(crypto_metadata, ccm_metadata -> nx_crypto_ccm_X, ccm_metadata -> nx_crypto_ccm_X, block_size);
+            ccm_metadata -> nx_crypto_ccm_partial_length = 0;
+        }
+
         NX_CRYPTO_MEMCPY(temp, ccm_metadata -> nx_crypto_ccm_A, block_size); /* Use case of memcpy is verified. */
-        temp[15] = 0;
+        NX_CRYPTO_MEMSET(temp + NX_CRYPTO_CCM_BLOCK_SIZE - 1 - temp[0], 0, (UINT)temp[0] + 1);
         crypto_function(crypto_metadata, temp, temp, block_size);
 
         /* Encrypt authentication tag.  */
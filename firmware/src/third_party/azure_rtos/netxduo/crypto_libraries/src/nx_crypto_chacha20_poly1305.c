@@ -0,0 +1,1212 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Crypto Component                                                 */
+/**                                                                       */
+/**   ChaCha20-Poly1305 AEAD                                              */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#include "nx_crypto_chacha20_poly1305.h"
+
+/* Read and write 32-bit little endian words byte by byte, so buffers need no alignment. */
+#define NX_CRYPTO_CHACHA20_LOAD32(p)      ((UINT)(p)[0] | ((UINT)(p)[1] << 8) | \
+                                           ((UINT)(p)[2] << 16) | ((UINT)(p)[3] << 24))
+#define NX_CRYPTO_CHACHA20_STORE32(p, v)  {(p)[0] = (UCHAR)(v); (p)[1] = (UCHAR)((v) >> 8); \
+                                           (p)[2] = (UCHAR)((v) >> 16); (p)[3] = (UCHAR)((v) >> 24);}
+
+#define NX_CRYPTO_CHACHA20_ROTL(x, n)     (((x) << (n)) | ((x) >> (32 - (n))))
+
+#define NX_CRYPTO_CHACHA20_QUARTER_ROUND(a, b, c, d)                    \
+    a += b; d ^= a; d = NX_CRYPTO_CHACHA20_ROTL(d, 16);                 \
+    c += d; b ^= c; b = NX_CRYPTO_CHACHA20_ROTL(b, 12);                 \
+    a += b; d ^= a; d = NX_CRYPTO_CHACHA20_ROTL(d, 8);                  \
+    c += d; b ^= c; b = NX_CRYPTO_CHACHA20_ROTL(b, 7);
+
+#define NX_CRYPTO_POLY1305_LIMB_MASK      0x3FFFFFF
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_chacha20_block                           PORTABLE C      */
+/*                                                           6.1          */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function runs the ChaCha20 block function on the current       */
+/*    state, stores the 64-byte key stream block in the context and       */
+/*    advances the block counter.                                         */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    ctx                                   ChaCha20-Poly1305 context     */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_crypto_chacha20_poly1305_start    Start AEAD operation          */
+/*    _nx_crypto_chacha20_xor               Apply ChaCha20 key stream     */
+/*                                                                        */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP static VOID _nx_crypto_chacha20_block(NX_CRYPTO_CHACHA20_POLY1305 *ctx)
+{
+UINT *state = ctx -> nx_crypto_chacha20_state;
+UINT  x0 = state[0], x1 = state[1], x2 = state[2], x3 = state[3];
+UINT  x4 = state[4], x5 = state[5], x6 = state[6], x7 = state[7];
+UINT  x8 = state[8], x9 = state[9], x10 = state[10], x11 = state[11];
+UINT  x12 = state[12], x13 = state[13], x14 = state[14], x15 = state[15];
+UCHAR *keystream = ctx -> nx_crypto_chacha20_keystream;
+UINT  i;
+
+    /* 20 rounds, as 10 pairs of column and diagonal rounds. */
+    for (i = 0; i < 10; i++)
+    {
+        NX_CRYPTO_CHACHA20_QUARTER_ROUND(x0, x4,  x8, x12)
+        NX_CRYPTO_CHACHA20_QUARTER_ROUND(x1, x5,  x9, x13)
+        NX_CRYPTO_CHACHA20_QUARTER_ROUND(x2, x6, x10, x14)
+        NX_CRYPTO_CHACHA20_QUARTER_ROUND(x3, x7, x11, x15)
+        NX_CRYPTO_CHACHA20_QUARTER_ROUND(x0, x5, x10, x15)
+        NX_CRYPTO_CHACHA20_QUARTER_ROUND(x1, x6, x11, x12)
+        NX_CRYPTO_CHACHA20_QUARTER_ROUND(x2, x7,  x8, x13)
+        NX_CRYPTO_CHACHA20_QUARTER_ROUND(x3, x4,  x9, x14)
+    }
+
+    /* Add the input block and serialize. */
+    x0 += state[0];
+    x1 += state[1];
+    x2 += state[2];
+    x3 += state[3];
+    x4 += state[4];
+    x5 += state[5];
+    x6 += state[6];
+    x7 += state[7];
+    x8 += state[8];
+    x9 += state[9];
+    x10 += state[10];
+    x11 += state[11];
+    x12 += state[12];
+    x13 += state[13];
+    x14 += state[14];
+    x15 += state[15];
+
+    NX_CRYPTO_CHACHA20_STORE32(keystream,      x0);
+    NX_CRYPTO_CHACHA20_STORE32(keystream + 4,  x1);
+    NX_CRYPTO_CHACHA20_STORE32(keystream + 8,  x2);
+    NX_CRYPTO_CHACHA20_STORE32(keystream + 12, x3);
+    NX_CRYPTO_CHACHA20_STORE32(keystream + 16, x4);
+    NX_CRYPTO_CHACHA20_STORE32(keystream + 20, x5);
+    NX_CRYPTO_CHACHA20_STORE32(keystream + 24, x6);
+    NX_CRYPTO_CHACHA20_STORE32(keystream + 28, x7);
+    NX_CRYPTO_CHACHA20_STORE32(keystream + 32, x8);
+    NX_CRYPTO_CHACHA20_STORE32(keystream + 36, x9);
+    NX_CRYPTO_CHACHA20_STORE32(keystream + 40, x10);
+    NX_CRYPTO_CHACHA20_STORE32(keystream + 44, x11);
+    NX_CRYPTO_CHACHA20_STORE32(keystream + 48, x12);
+    NX_CRYPTO_CHACHA20_STORE32(keystream + 52, x13);
+    NX_CRYPTO_CHACHA20_STORE32(keystream + 56, x14);
+    NX_CRYPTO_CHACHA20_STORE32(keystream + 60, x15);
+
+    /* Advance the block counter. */
+    state[12]++;
+    ctx -> nx_crypto_chacha20_keystream_used = 0;
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_chacha20_xor                             PORTABLE C      */
+/*                                                           6.1          */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function XORs the ChaCha20 key stream into the data. Unused    */
+/*    key stream bytes of the current block are kept for the next call,   */
+/*    so the data may be split at any byte boundary.                      */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    ctx                                   ChaCha20-Poly1305 context     */
+/*    input                                 Pointer to input data         */
+/*    output                                Pointer to output buffer      */
+/*    length                                Length of data                */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_crypto_chacha20_block             Generate key stream block     */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_crypto_chacha20_poly1305_encrypt_update                         */
+/*                                          Encrypt data                  */
+/*    _nx_crypto_chacha20_poly1305_decrypt_update                         */
+/*                                          Decrypt data                  */
+/*                                                                        */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP static VOID _nx_crypto_chacha20_xor(NX_CRYPTO_CHACHA20_POLY1305 *ctx,
+                                                   UCHAR *input, UCHAR *output, UINT length)
+{
+UCHAR *keystream = ctx -> nx_crypto_chacha20_keystream;
+UINT   used = ctx -> nx_crypto_chacha20_keystream_used;
+UINT   i;
+
+    while (length)
+    {
+        if (used == NX_CRYPTO_CHACHA20_BLOCK_SIZE)
+        {
+            _nx_crypto_chacha20_block(ctx);
+            used = 0;
+        }
+
+        if ((used == 0) && (length >= NX_CRYPTO_CHACHA20_BLOCK_SIZE))
+        {
+
+            /* Whole block. */
+            for (i = 0; i < NX_CRYPTO_CHACHA20_BLOCK_SIZE; i++)
+            {
+                output[i] = input[i] ^ keystream[i];
+            }
+            used = NX_CRYPTO_CHACHA20_BLOCK_SIZE;
+            input += NX_CRYPTO_CHACHA20_BLOCK_SIZE;
+            output += NX_CRYPTO_CHACHA20_BLOCK_SIZE;
+            length -= NX_CRYPTO_CHACHA20_BLOCK_SIZE;
+        }
+        else
+        {
+            *output++ = *input++ ^ keystream[used++];
+            length--;
+        }
+    }
+
+    ctx -> nx_crypto_chacha20_keystream_used = used;
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_poly1305_blocks                          PORTABLE C      */
+/*                                                           6.1          */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function absorbs full 16-byte blocks into the Poly1305         */
+/*    accumulator, h = (h + block) * r mod 2^130 - 5, using 26-bit limbs  */
+/*    so every product fits in 64 bits.                                   */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    ctx                                   ChaCha20-Poly1305 context     */
+/*    input                                 Pointer to input data         */
+/*    length                                Length of data, a multiple    */
+/*                                            of 16 bytes                 */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_crypto_poly1305_update            Update Poly1305 with data     */
+/*    _nx_crypto_poly1305_pad               Pad Poly1305 input            */
+/*    _nx_crypto_poly1305_finish            Compute Poly1305 tag          */
+/*                                                                        */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP static VOID _nx_crypto_poly1305_blocks(NX_CRYPTO_CHACHA20_POLY1305 *ctx,
+                                                      UCHAR *input, UINT length)
+{
+UINT    r0 = ctx -> nx_crypto_poly1305_r[0];
+UINT    r1 = ctx -> nx_crypto_poly1305_r[1];
+UINT    r2 = ctx -> nx_crypto_poly1305_r[2];
+UINT    r3 = ctx -> nx_crypto_poly1305_r[3];
+UINT    r4 = ctx -> nx_crypto_poly1305_r[4];
+UINT    s1 = r1 * 5;
+UINT    s2 = r2 * 5;
+UINT    s3 = r3 * 5;
+UINT    s4 = r4 * 5;
+UINT    h0 = ctx -> nx_crypto_poly1305_h[0];
+UINT    h1 = ctx -> nx_crypto_poly1305_h[1];
+UINT    h2 = ctx -> nx_crypto_poly1305_h[2];
+UINT    h3 = ctx -> nx_crypto_poly1305_h[3];
+UINT    h4 = ctx -> nx_crypto_poly1305_h[4];
+ULONG64 d0, d1, d2, d3, d4;
+UINT    c;
+
+    while (length >= NX_CRYPTO_POLY1305_BLOCK_SIZE)
+    {
+
+        /* h += m, with the 2^128 bit set for a full block. */
+        h0 += (NX_CRYPTO_CHACHA20_LOAD32(input)) & NX_CRYPTO_POLY1305_LIMB_MASK;
+        h1 += (NX_CRYPTO_CHACHA20_LOAD32(input + 3) >> 2) & NX_CRYPTO_POLY1305_LIMB_MASK;
+        h2 += (NX_CRYPTO_CHACHA20_LOAD32(input + 6) >> 4) & NX_CRYPTO_POLY1305_LIMB_MASK;
+        h3 += (NX_CRYPTO_CHACHA20_LOAD32(input + 9) >> 6) & NX_CRYPTO_POLY1305_LIMB_MASK;
+        h4 += (NX_CRYPTO_CHACHA20_LOAD32(input + 12) >> 8) | (1 << 24);
+
+        /* h *= r, folding the limbs above 2^130 back in times 5. */
+        d0 = ((ULONG64)h0 * r0) + ((ULONG64)h1 * s4) + ((ULONG64)h2 * s3) + ((ULONG64)h3 * s2) + ((ULONG64)h4 * s1);
+        d1 = ((ULONG64)h0 * r1) + ((ULONG64)h1 * r0) + ((ULONG64)h2 * s4) + ((ULONG64)h3 * s3) + ((ULONG64)h4 * s2);
+        d2 = ((ULONG64)h0 * r2) + ((ULONG64)h1 * r1) + ((ULONG64)h2 * r0) + ((ULONG64)h3 * s4) + ((ULONG64)h4 * s3);
+        d3 = ((ULONG64)h0 * r3) + ((ULONG64)h1 * r2) + ((ULONG64)h2 * r1) + ((ULONG64)h3 * r0) + ((ULONG64)h4 * s4);
+        d4 = ((ULONG64)h0 * r4) + ((ULONG64)h1 * r3) + ((ULONG64)h2 * r2) + ((ULONG64)h3 * r1) + ((ULONG64)h4 * r0);
+
+        /* Partial reduction mod 2^130 - 5. */
+        c = (UINT)(d0 >> 26);
+        h0 = (UINT)d0 & NX_CRYPTO_POLY1305_LIMB_MASK;
+        d1 += c;
+        c = (UINT)(d1 >> 26);
+        h1 = (UINT)d1 & NX_CRYPTO_POLY1305_LIMB_MASK;
+        d2 += c;
+        c = (UINT)(d2 >> 26);
+        h2 = (UINT)d2 & NX_CRYPTO_POLY1305_LIMB_MASK;
+        d3 += c;
+        c = (UINT)(d3 >> 26);
+        h3 = (UINT)d3 & NX_CRYPTO_POLY1305_LIMB_MASK;
+        d4 += c;
+        c = (UINT)(d4 >> 26);
+        h4 = (UINT)d4 & NX_CRYPTO_POLY1305_LIMB_MASK;
+        h0 += c * 5;
+        c = h0 >> 26;
+        h0 &= NX_CRYPTO_POLY1305_LIMB_MASK;
+        h1 += c;
+
+        input += NX_CRYPTO_POLY1305_BLOCK_SIZE;
+        length -= NX_CRYPTO_POLY1305_BLOCK_SIZE;
+    }
+
+    ctx -> nx_crypto_poly1305_h[0] = h0;
+    ctx -> nx_crypto_poly1305_h[1] = h1;
+    ctx -> nx_crypto_poly1305_h[2] = h2;
+    ctx -> nx_crypto_poly1305_h[3] = h3;
+    ctx -> nx_crypto_poly1305_h[4] = h4;
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_poly1305_update                          PORTABLE C      */
+/*                                                           6.1          */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function adds data of any length to the Poly1305 input,        */
+/*    holding back a trailing partial block until more data arrives.      */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    ctx                                   ChaCha20-Poly1305 context     */
+/*    input                                 Pointer to input data         */
+/*    length                                Length of data                */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_crypto_poly1305_blocks            Absorb Poly1305 blocks        */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_crypto_chacha20_poly1305_start    Start AEAD operation          */
+/*    _nx_crypto_chacha20_poly1305_encrypt_update                         */
+/*                                          Encrypt data                  */
+/*    _nx_crypto_chacha20_poly1305_decrypt_update                         */
+/*                                          Decrypt data                  */
+/*                                                                        */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP static VOID _nx_crypto_poly1305_update(NX_CRYPTO_CHACHA20_POLY1305 *ctx,
+                                                      UCHAR *input, UINT length)
+{
+UCHAR *buffer = ctx -> nx_crypto_poly1305_buffer;
+UINT   buffered = ctx -> nx_crypto_poly1305_buffer_length;
+UINT   copy_length;
+UINT   block_length;
+
+    if (buffered)
+    {
+
+        /* Complete the pending block first. */
+        copy_length = NX_CRYPTO_POLY1305_BLOCK_SIZE - buffered;
+        if (copy_length > length)
+        {
+            copy_length = length;
+        }
+        NX_CRYPTO_MEMCPY(buffer + buffered, input, copy_length); /* Use case of memcpy is verified. */
+        buffered += copy_length;
+        input += copy_length;
+        length -= copy_length;
+
+        if (buffered < NX_CRYPTO_POLY1305_BLOCK_SIZE)
+        {
+            ctx -> nx_crypto_poly1305_buffer_length = buffered;
+            return;
+        }
+
+        _nx_crypto_poly1305_blocks(ctx, buffer, NX_CRYPTO_POLY1305_BLOCK_SIZE);
+        buffered = 0;
+    }
+
+    /* Process full blocks directly from the input. */
+    block_length = length & ~(UINT)(NX_CRYPTO_POLY1305_BLOCK_SIZE - 1);
+    if (block_length)
+    {
+        _nx_crypto_poly1305_blocks(ctx, input, block_length);
+        input += block_length;
+        length -= block_length;
+    }
+
+    if (length)
+    {
+        NX_CRYPTO_MEMCPY(buffer, input, length); /* Use case of memcpy is verified. */
+        buffered = length;
+    }
+
+    ctx -> nx_crypto_poly1305_buffer_length = buffered;
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_poly1305_pad                             PORTABLE C      */
+/*                                                           6.1          */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function pads the Poly1305 input with zeros to a multiple of   */
+/*    16 bytes, as the AEAD construction requires after the additional    */
+/*    data and after the ciphertext.                                      */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    ctx                                   ChaCha20-Poly1305 context     */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_crypto_poly1305_blocks            Absorb Poly1305 blocks        */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_crypto_chacha20_poly1305_start    Start AEAD operation          */
+/*    _nx_crypto_poly1305_finish            Compute Poly1305 tag          */
+/*                                                                        */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP static VOID _nx_crypto_poly1305_pad(NX_CRYPTO_CHACHA20_POLY1305 *ctx)
+{
+UINT buffered = ctx -> nx_crypto_poly1305_buffer_length;
+
+    if (buffered)
+    {
+        NX_CRYPTO_MEMSET(ctx -> nx_crypto_poly1305_buffer + buffered, 0,
+                         NX_CRYPTO_POLY1305_BLOCK_SIZE - buffered);
+        _nx_crypto_poly1305_blocks(ctx, ctx -> nx_crypto_poly1305_buffer, NX_CRYPTO_POLY1305_BLOCK_SIZE);
+        ctx -> nx_crypto_poly1305_buffer_length = 0;
+    }
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_poly1305_finish                          PORTABLE C      */
+/*                                                           6.1          */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function pads the ciphertext, absorbs the length block, fully  */
+/*    reduces the accumulator and adds s to produce the 16-byte tag.      */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    ctx                                   ChaCha20-Poly1305 context     */
+/*    tag                                   Output buffer of 16 bytes     */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_crypto_poly1305_pad               Pad Poly1305 input            */
+/*    _nx_crypto_poly1305_blocks            Absorb Poly1305 blocks        */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_crypto_chacha20_poly1305_encrypt_calculate                      */
+/*                                          Calculate tag                 */
+/*    _nx_crypto_chacha20_poly1305_decrypt_calculate                      */
+/*                                          Verify tag                    */
+/*                                                                        */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP static VOID _nx_crypto_poly1305_finish(NX_CRYPTO_CHACHA20_POLY1305 *ctx, UCHAR *tag)
+{
+UCHAR   length_block[NX_CRYPTO_POLY1305_BLOCK_SIZE];
+UINT    h0, h1, h2, h3, h4;
+UINT    g0, g1, g2, g3, g4;
+UINT    c;
+UINT    mask;
+ULONG64 f;
+
+    /* Pad the ciphertext and append le64(aad length) || le64(ciphertext length). */
+    _nx_crypto_poly1305_pad(ctx);
+    NX_CRYPTO_MEMSET(length_block, 0, sizeof(length_block));
+    NX_CRYPTO_CHACHA20_STORE32(length_block, ctx -> nx_crypto_chacha20_poly1305_aad_length);
+    NX_CRYPTO_CHACHA20_STORE32(length_block + 8, ctx -> nx_crypto_chacha20_poly1305_text_length);
+    _nx_crypto_poly1305_blocks(ctx, length_block, NX_CRYPTO_POLY1305_BLOCK_SIZE);
+
+    h0 = ctx -> nx_crypto_poly1305_h[0];
+    h1 = ctx -> nx_crypto_poly1305_h[1];
+    h2 = ctx -> nx_crypto_poly1305_h[2];
+    h3 = ctx -> nx_crypto_poly1305_h[3];
+    h4 = ctx -> nx_crypto_poly1305_h[4];
+
+    /* Fully carry h. */
+    c = h1 >> 26;
+    h1 &= NX_CRYPTO_POLY1305_LIMB_MASK;
+    h2 += c;
+    c = h2 >> 26;
+    h2 &= NX_CRYPTO_POLY1305_LIMB_MASK;
+    h3 += c;
+    c = h3 >> 26;
+    h3 &= NX_CRYPTO_POLY1305_LIMB_MASK;
+    h4 += c;
+    c = h4 >> 26;
+    h4 &= NX_CRYPTO_POLY1305_LIMB_MASK;
+    h0 += c * 5;
+    c = h0 >> 26;
+    h0 &= NX_CRYPTO_POLY1305_LIMB_MASK;
+    h1 += c;
+
+    /* Compute g = h + 5 - 2^130 and select it without branching if h >= 2^130 - 5. */
+    g0 = h0 + 5;
+    c = g0 >> 26;
+    g0 &= NX_CRYPTO_POLY1305_LIMB_MASK;
+    g1 = h1 + c;
+    c = g1 >> 26;
+    g1 &= NX_CRYPTO_POLY1305_LIMB_MASK;
+    g2 = h2 + c;
+    c = g2 >> 26;
+    g2 &= NX_CRYPTO_POLY1305_LIMB_MASK;
+    g3 = h3 + c;
+    c = g3 >> 26;
+    g3 &= NX_CRYPTO_POLY1305_LIMB_MASK;
+    g4 = h4 + c - (1 << 26);
+
+    mask = (g4 >> 31) - 1;
+    g0 &= mask;
+    g1 &= mask;
+    g2 &= mask;
+    g3 &= mask;
+    g4 &= mask;
+    mask = ~mask;
+    h0 = (h0 & mask) | g0;
+    h1 = (h1 & mask) | g1;
+    h2 = (h2 & mask) | g2;
+    h3 = (h3 & mask) | g3;
+    h4 = (h4 & mask) | g4;
+
+    /* h = (h + s) mod 2^128. */
+    h0 = h0 | (h1 << 26);
+    h1 = (h1 >> 6) | (h2 << 20);
+    h2 = (h2 >> 12) | (h3 << 14);
+    h3 = (h3 >> 18) | (h4 << 8);
+
+    f = (ULONG64)h0 + ctx -> nx_crypto_poly1305_s[0];
+    h0 = (UINT)f;
+    f = (ULONG64)h1 + ctx -> nx_crypto_poly1305_s[1] + (f >> 32);
+    h1 = (UINT)f;
+    f = (ULONG64)h2 + ctx -> nx_crypto_poly1305_s[2] + (f >> 32);
+    h2 = (UINT)f;
+    f = (ULONG64)h3 + ctx -> nx_crypto_poly1305_s[3] + (f >> 32);
+    h3 = (UINT)f;
+
+    NX_CRYPTO_CHACHA20_STORE32(tag,      h0);
+    NX_CRYPTO_CHACHA20_STORE32(tag + 4,  h1);
+    NX_CRYPTO_CHACHA20_STORE32(tag + 8,  h2);
+    NX_CRYPTO_CHACHA20_STORE32(tag + 12, h3);
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_chacha20_poly1305_start                  PORTABLE C      */
+/*                                                           6.1          */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function starts an AEAD operation for one nonce. Block 0 of    */
+/*    the key stream becomes the Poly1305 key, the additional data is     */
+/*    authenticated, and the cipher continues from block 1.               */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    ctx                                   ChaCha20-Poly1305 context     */
+/*    nonce                                 Pointer to 12-byte nonce      */
+/*    additional_data                       Pointer to additional data    */
+/*    additional_len                        Length of additional data     */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_crypto_chacha20_block             Generate key stream block     */
+/*    _nx_crypto_poly1305_update            Update Poly1305 with data     */
+/*    _nx_crypto_poly1305_pad               Pad Poly1305 input            */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_crypto_method_chacha20_poly1305_operation                       */
+/*                                          Handle ChaCha20-Poly1305      */
+/*                                            operation                   */
+/*                                                                        */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP UINT _nx_crypto_chacha20_poly1305_start(NX_CRYPTO_CHACHA20_POLY1305 *ctx, UCHAR *nonce,
+                                                       UCHAR *additional_data, UINT additional_len)
+{
+UCHAR *otk = ctx -> nx_crypto_chacha20_keystream;
+
+    if ((additional_len > 0) && (additional_data == NX_CRYPTO_NULL))
+    {
+        return(NX_CRYPTO_PTR_ERROR);
+    }
+
+    /* Block counter 0 and the nonce. */
+    ctx -> nx_crypto_chacha20_state[12] = 0;
+    ctx -> nx_crypto_chacha20_state[13] = NX_CRYPTO_CHACHA20_LOAD32(nonce);
+    ctx -> nx_crypto_chacha20_state[14] = NX_CRYPTO_CHACHA20_LOAD32(nonce + 4);
+    ctx -> nx_crypto_chacha20_state[15] = NX_CRYPTO_CHACHA20_LOAD32(nonce + 8);
+
+    /* Derive the one-time Poly1305 key from block 0 and clamp r. */
+    _nx_crypto_chacha20_block(ctx);
+    ctx -> nx_crypto_poly1305_r[0] = (NX_CRYPTO_CHACHA20_LOAD32(otk)) & 0x3FFFFFF;
+    ctx -> nx_crypto_poly1305_r[1] = (NX_CRYPTO_CHACHA20_LOAD32(otk + 3) >> 2) & 0x3FFFF03;
+    ctx -> nx_crypto_poly1305_r[2] = (NX_CRYPTO_CHACHA20_LOAD32(otk + 6) >> 4) & 0x3FFC0FF;
+    ctx -> nx_crypto_poly1305_r[3] = (NX_CRYPTO_CHACHA20_LOAD32(otk + 9) >> 6) & 0x3F03FFF;
+    ctx -> nx_crypto_poly1305_r[4] = (NX_CRYPTO_CHACHA20_LOAD32(otk + 12) >> 8) & 0x00FFFFF;
+    ctx -> nx_crypto_poly1305_s[0] = NX_CRYPTO_CHACHA20_LOAD32(otk + 16);
+    ctx -> nx_crypto_poly1305_s[1] = NX_CRYPTO_CHACHA20_LOAD32(otk + 20);
+    ctx -> nx_crypto_poly1305_s[2] = NX_CRYPTO_CHACHA20_LOAD32(otk + 24);
+    ctx -> nx_crypto_poly1305_s[3] = NX_CRYPTO_CHACHA20_LOAD32(otk + 28);
+    NX_CRYPTO_MEMSET(ctx -> nx_crypto_poly1305_h, 0, sizeof(ctx -> nx_crypto_poly1305_h));
+    ctx -> nx_crypto_poly1305_buffer_length = 0;
+
+    /* The rest of block 0 is discarded; encryption starts with block 1. */
+    ctx -> nx_crypto_chacha20_keystream_used = NX_CRYPTO_CHACHA20_BLOCK_SIZE;
+
+    ctx -> nx_crypto_chacha20_poly1305_aad_length = additional_len;
+    ctx -> nx_crypto_chacha20_poly1305_text_length = 0;
+
+    if (additional_len)
+    {
+        _nx_crypto_poly1305_update(ctx, additional_data, additional_len);
+        _nx_crypto_poly1305_pad(ctx);
+    }
+
+    return(NX_CRYPTO_SUCCESS);
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_chacha20_poly1305_encrypt_update         PORTABLE C      */
+/*                                                           6.1          */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function encrypts part of the message and authenticates the    */
+/*    resulting ciphertext. Input and output may overlap exactly.         */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    ctx                                   ChaCha20-Poly1305 context     */
+/*    input                                 Pointer to plaintext          */
+/*    output                                Pointer to ciphertext buffer  */
+/*    length                                Length of data                */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_crypto_chacha20_xor               Apply ChaCha20 key stream     */
+/*    _nx_crypto_poly1305_update            Update Poly1305 with data     */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_crypto_method_chacha20_poly1305_operation                       */
+/*                                          Handle ChaCha20-Poly1305      */
+/*                                            operation                   */
+/*                                                                        */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP UINT _nx_crypto_chacha20_poly1305_encrypt_update(NX_CRYPTO_CHACHA20_POLY1305 *ctx,
+                                                                UCHAR *input, UCHAR *output, UINT length)
+{
+
+    _nx_crypto_chacha20_xor(ctx, input, output, length);
+    _nx_crypto_poly1305_update(ctx, output, length);
+    ctx -> nx_crypto_chacha20_poly1305_text_length += length;
+
+    return(NX_CRYPTO_SUCCESS);
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_chacha20_poly1305_decrypt_update         PORTABLE C      */
+/*                                                           6.1          */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function authenticates part of the ciphertext and decrypts     */
+/*    it. Input and output may overlap exactly.                           */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    ctx                                   ChaCha20-Poly1305 context     */
+/*    input                                 Pointer to ciphertext         */
+/*    output                                Pointer to plaintext buffer   */
+/*    length                                Length of data                */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_crypto_poly1305_update            Update Poly1305 with data     */
+/*    _nx_crypto_chacha20_xor               Apply ChaCha20 key stream     */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_crypto_method_chacha20_poly1305_operation                       */
+/*                                          Handle ChaCha20-Poly1305      */
+/*                                            operation                   */
+/*                                                                        */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP UINT _nx_crypto_chacha20_poly1305_decrypt_update(NX_CRYPTO_CHACHA20_POLY1305 *ctx,
+                                                                UCHAR *input, UCHAR *output, UINT length)
+{
+
+    /* Authenticate before the ciphertext is overwritten by in-place decryption. */
+    _nx_crypto_poly1305_update(ctx, input, length);
+    _nx_crypto_chacha20_xor(ctx, input, output, length);
+    ctx -> nx_crypto_chacha20_poly1305_text_length += length;
+
+    return(NX_CRYPTO_SUCCESS);
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_chacha20_poly1305_encrypt_calculate      PORTABLE C      */
+/*                                                           6.1          */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function finishes encryption and outputs the authentication    */
+/*    tag.                                                                */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    ctx                                   ChaCha20-Poly1305 context     */
+/*    output                                Pointer to tag buffer         */
+/*    icv_len                               Length of tag                 */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_crypto_poly1305_finish            Compute Poly1305 tag          */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_crypto_method_chacha20_poly1305_operation                       */
+/*                                          Handle ChaCha20-Poly1305      */
+/*                                            operation                   */
+/*                                                                        */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP UINT _nx_crypto_chacha20_poly1305_encrypt_calculate(NX_CRYPTO_CHACHA20_POLY1305 *ctx,
+                                                                   UCHAR *output, UINT icv_len)
+{
+UCHAR tag[NX_CRYPTO_POLY1305_BLOCK_SIZE];
+
+    if (icv_len > NX_CRYPTO_POLY1305_BLOCK_SIZE)
+    {
+        return(NX_CRYPTO_INVALID_BUFFER_SIZE);
+    }
+
+    _nx_crypto_poly1305_finish(ctx, tag);
+    NX_CRYPTO_MEMCPY(output, tag, icv_len); /* Use case of memcpy is verified. */
+
+#ifdef NX_SECURE_KEY_CLEAR
+    NX_CRYPTO_MEMSET(tag, 0, sizeof(tag));
+#endif
+
+    return(NX_CRYPTO_SUCCESS);
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_chacha20_poly1305_decrypt_calculate      PORTABLE C      */
+/*                                                           6.1          */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function finishes decryption and compares the computed tag     */
+/*    with the received one in constant time.                             */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    ctx                                   ChaCha20-Poly1305 context     */
+/*    input                                 Pointer to received tag       */
+/*    icv_len                               Length of tag                 */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_crypto_poly1305_finish            Compute Poly1305 tag          */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_crypto_method_chacha20_poly1305_operation                       */
+/*                                          Handle ChaCha20-Poly1305      */
+/*                                            operation                   */
+/*                                                                        */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP UINT _nx_crypto_chacha20_poly1305_decrypt_calculate(NX_CRYPTO_CHACHA20_POLY1305 *ctx,
+                                                                   UCHAR *input, UINT icv_len)
+{
+UCHAR tag[NX_CRYPTO_POLY1305_BLOCK_SIZE];
+UCHAR diff = 0;
+UINT  i;
+
+    if (icv_len > NX_CRYPTO_POLY1305_BLOCK_SIZE)
+    {
+        return(NX_CRYPTO_INVALID_BUFFER_SIZE);
+    }
+
+    _nx_crypto_poly1305_finish(ctx, tag);
+
+    for (i = 0; i < icv_len; i++)
+    {
+        diff |= (UCHAR)(input[i] ^ tag[i]);
+    }
+
+#ifdef NX_SECURE_KEY_CLEAR
+    NX_CRYPTO_MEMSET(tag, 0, sizeof(tag));
+#endif
+
+    if (diff)
+    {
+
+        /* Authentication failed. */
+        return(NX_CRYPTO_AUTHENTICATION_FAILED);
+    }
+
+    return(NX_CRYPTO_SUCCESS);
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_method_chacha20_poly1305_init            PORTABLE C      */
+/*                                                           6.1          */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function initializes the ChaCha20-Poly1305 crypto module with  */
+/*    a 256-bit key.                                                      */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    method                                Crypto Method Object          */
+/*    key                                   Key                           */
+/*    key_size_in_bits                      Size of the key, in bits      */
+/*    handle                                Handle, specified by user     */
+/*    crypto_metadata                       Metadata area                 */
+/*    crypto_metadata_size                  Size of the metadata area     */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP UINT  _nx_crypto_method_chacha20_poly1305_init(struct NX_CRYPTO_METHOD_STRUCT *method,
+                                                              UCHAR *key, NX_CRYPTO_KEY_SIZE key_size_in_bits,
+                                                              VOID **handle,
+                                                              VOID *crypto_metadata,
+                                                              ULONG crypto_metadata_size)
+{
+NX_CRYPTO_CHACHA20_POLY1305 *ctx;
+UINT                         i;
+
+    NX_CRYPTO_PARAMETER_NOT_USED(handle);
+
+    NX_CRYPTO_STATE_CHECK
+
+    if ((method == NX_CRYPTO_NULL) || (key == NX_CRYPTO_NULL) || (crypto_metadata == NX_CRYPTO_NULL))
+    {
+        return(NX_CRYPTO_PTR_ERROR);
+    }
+
+    /* Verify the metadata addrsss is 4-byte aligned. */
+    if((((ALIGN_TYPE)crypto_metadata) & 0x3) != 0)
+    {
+        return(NX_CRYPTO_PTR_ERROR);
+    }
+
+    if(crypto_metadata_size < sizeof(NX_CRYPTO_CHACHA20_POLY1305))
+    {
+        return(NX_CRYPTO_PTR_ERROR);
+    }
+
+    if (key_size_in_bits != NX_CRYPTO_CHACHA20_KEY_LEN_IN_BITS)
+    {
+        return(NX_CRYPTO_UNSUPPORTED_KEY_SIZE);
+    }
+
+    ctx = (NX_CRYPTO_CHACHA20_POLY1305 *)crypto_metadata;
+    NX_CRYPTO_MEMSET(ctx, 0, sizeof(NX_CRYPTO_CHACHA20_POLY1305));
+
+    /* "expand 32-byte k" followed by the key. */
+    ctx -> nx_crypto_chacha20_state[0] = 0x61707865;
+    ctx -> nx_crypto_chacha20_state[1] = 0x3320646E;
+    ctx -> nx_crypto_chacha20_state[2] = 0x79622D32;
+    ctx -> nx_crypto_chacha20_state[3] = 0x6B206574;
+    for (i = 0; i < 8; i++)
+    {
+        ctx -> nx_crypto_chacha20_state[4 + i] = NX_CRYPTO_CHACHA20_LOAD32(key + (i << 2));
+    }
+
+    return(NX_CRYPTO_SUCCESS);
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_method_chacha20_poly1305_cleanup         PORTABLE C      */
+/*                                                           6.1          */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function cleans up the crypto metadata.                        */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    crypto_metadata                       Crypto metadata               */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    NX_CRYPTO_MEMSET                      Set the memory                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP UINT  _nx_crypto_method_chacha20_poly1305_cleanup(VOID *crypto_metadata)
+{
+
+    NX_CRYPTO_STATE_CHECK
+
+#ifdef NX_SECURE_KEY_CLEAR
+    if (!crypto_metadata)
+        return (NX_CRYPTO_SUCCESS);
+
+    /* Clean up the crypto metadata.  */
+    NX_CRYPTO_MEMSET(crypto_metadata, 0, sizeof(NX_CRYPTO_CHACHA20_POLY1305));
+#else
+    NX_CRYPTO_PARAMETER_NOT_USED(crypto_metadata);
+#endif /* NX_SECURE_KEY_CLEAR  */
+
+    return(NX_CRYPTO_SUCCESS);
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_method_chacha20_poly1305_operation       PORTABLE C      */
+/*                                                           6.1          */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function encrypts and decrypts a message using the             */
+/*    ChaCha20-Poly1305 AEAD algorithm. The operations and their          */
+/*    arguments follow the AES-GCM method, including the nonce format     */
+/*    of one length byte followed by the 12-byte nonce.                   */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    op                                    Operation                     */
+/*    handle                                Crypto handle                 */
+/*    method                                Cryption Method Object        */
+/*    key                                   Encryption Key                */
+/*    key_size_in_bits                      Key size in bits              */
+/*    input                                 Input data                    */
+/*    input_length_in_byte                  Input data size               */
+/*    iv_ptr                                Initial vector                */
+/*    output                                Output buffer                 */
+/*    output_length_in_byte                 Output buffer size            */
+/*    crypto_metadata                       Metadata area                 */
+/*    crypto_metadata_size                  Metadata area size            */
+/*    packet_ptr                            Pointer to packet             */
+/*    nx_crypto_hw_process_callback         Callback function pointer     */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_crypto_chacha20_poly1305_start    Start AEAD operation          */
+/*    _nx_crypto_chacha20_poly1305_encrypt_update                         */
+/*                                          Encrypt data                  */
+/*    _nx_crypto_chacha20_poly1305_decrypt_update                         */
+/*                                          Decrypt data                  */
+/*    _nx_crypto_chacha20_poly1305_encrypt_calculate                      */
+/*                                          Calculate tag                 */
+/*    _nx_crypto_chacha20_poly1305_decrypt_calculate                      */
+/*                                          Verify tag                    */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP UINT  _nx_crypto_method_chacha20_poly1305_operation(UINT op,      /* Encrypt, Decrypt, Authenticate */
+                                                                   VOID *handle, /* Crypto handler */
+                                                                   struct NX_CRYPTO_METHOD_STRUCT *method,
+                                                                   UCHAR *key,
+                                                                   NX_CRYPTO_KEY_SIZE key_size_in_bits,
+                                                                   UCHAR *input,
+                                                                   ULONG input_length_in_byte,
+                                                                   UCHAR *iv_ptr,
+                                                                   UCHAR *output,
+                                                                   ULONG output_length_in_byte,
+                                                                   VOID *crypto_metadata,
+                                                                   ULONG crypto_metadata_size,
+                                                                   VOID *packet_ptr,
+                                                                   VOID (*nx_crypto_hw_process_callback)(VOID *packet_ptr, UINT status))
+{
+
+NX_CRYPTO_CHACHA20_POLY1305 *ctx;
+UINT icv_len;
+UINT message_len;
+UINT status;
+
+    NX_CRYPTO_PARAMETER_NOT_USED(handle);
+    NX_CRYPTO_PARAMETER_NOT_USED(key);
+    NX_CRYPTO_PARAMETER_NOT_USED(key_size_in_bits);
+    NX_CRYPTO_PARAMETER_NOT_USED(packet_ptr);
+    NX_CRYPTO_PARAMETER_NOT_USED(nx_crypto_hw_process_callback);
+
+    NX_CRYPTO_STATE_CHECK
+
+    /* Verify the metadata addrsss is 4-byte aligned. */
+    if((method == NX_CRYPTO_NULL) || (crypto_metadata == NX_CRYPTO_NULL) || ((((ALIGN_TYPE)crypto_metadata) & 0x3) != 0))
+    {
+        return(NX_CRYPTO_PTR_ERROR);
+    }
+
+    if(crypto_metadata_size < sizeof(NX_CRYPTO_CHACHA20_POLY1305))
+    {
+        return(NX_CRYPTO_PTR_ERROR);
+    }
+
+    if (method -> nx_crypto_algorithm != NX_CRYPTO_ENCRYPTION_CHACHA20_POLY1305)
+    {
+        return(NX_CRYPTO_INVALID_ALGORITHM);
+    }
+
+    ctx = (NX_CRYPTO_CHACHA20_POLY1305 *)crypto_metadata;
+    icv_len = (method -> nx_crypto_ICV_size_in_bits >> 3);
+
+    /* Nonce must be given as length byte followed by 12 bytes. */
+    if (((op == NX_CRYPTO_ENCRYPT) || (op == NX_CRYPTO_DECRYPT) ||
+         (op == NX_CRYPTO_ENCRYPT_INITIALIZE) || (op == NX_CRYPTO_DECRYPT_INITIALIZE)) &&
+        ((iv_ptr == NX_CRYPTO_NULL) || (iv_ptr[0] != NX_CRYPTO_CHACHA20_NONCE_SIZE)))
+    {
+        return(NX_CRYPTO_PTR_ERROR);
+    }
+
+    switch (op)
+    {
+        case NX_CRYPTO_DECRYPT:
+        {
+            if (input_length_in_byte < icv_len || output_length_in_byte < input_length_in_byte - icv_len)
+            {
+                status = NX_CRYPTO_INVALID_BUFFER_SIZE;
+                break;
+            }
+
+            message_len = input_length_in_byte - icv_len;
+            status = _nx_crypto_chacha20_poly1305_start(ctx, iv_ptr + 1,
+                                                        ctx -> nx_crypto_chacha20_poly1305_additional_data,
+                                                        ctx -> nx_crypto_chacha20_poly1305_additional_data_len);
+            if (status)
+            {
+                break;
+            }
+
+            _nx_crypto_chacha20_poly1305_decrypt_update(ctx, input, output, message_len);
+            status = _nx_crypto_chacha20_poly1305_decrypt_calculate(ctx, input + message_len, icv_len);
+        } break;
+
+        case NX_CRYPTO_ENCRYPT:
+        {
+            if (output_length_in_byte < input_length_in_byte + icv_len)
+            {
+                status = NX_CRYPTO_INVALID_BUFFER_SIZE;
+                break;
+            }
+
+            status = _nx_crypto_chacha20_poly1305_start(ctx, iv_ptr + 1,
+                                                        ctx -> nx_crypto_chacha20_poly1305_additional_data,
+                                                        ctx -> nx_crypto_chacha20_poly1305_additional_data_len);
+            if (status)
+            {
+                break;
+            }
+
+            _nx_crypto_chacha20_poly1305_encrypt_update(ctx, input, output, input_length_in_byte);
+            status = _nx_crypto_chacha20_poly1305_encrypt_calculate(ctx, output + input_length_in_byte, icv_len);
+        } break;
+
+        case NX_CRYPTO_DECRYPT_INITIALIZE:
+        /* fallthrough */
+        case NX_CRYPTO_ENCRYPT_INITIALIZE:
+        {
+            status = _nx_crypto_chacha20_poly1305_start(ctx, iv_ptr + 1,
+                                                        input, /* pointers to AAD */
+                                                        input_length_in_byte /* length of AAD */);
+        } break;
+
+        case NX_CRYPTO_DECRYPT_UPDATE:
+        {
+            status = _nx_crypto_chacha20_poly1305_decrypt_update(ctx, input, output, input_length_in_byte);
+        } break;
+
+        case NX_CRYPTO_ENCRYPT_UPDATE:
+        {
+            status = _nx_crypto_chacha20_poly1305_encrypt_update(ctx, input, output, input_length_in_byte);
+        } break;
+
+        case NX_CRYPTO_DECRYPT_CALCULATE:
+        {
+            if (input_length_in_byte < icv_len)
+            {
+                status = NX_CRYPTO_INVALID_BUFFER_SIZE;
+                break;
+            }
+
+            status = _nx_crypto_chacha20_poly1305_decrypt_calculate(ctx, input, icv_len);
+        } break;
+
+        case NX_CRYPTO_ENCRYPT_CALCULATE:
+        {
+            if (output_length_in_byte < icv_len)
+            {
+                status = NX_CRYPTO_INVALID_BUFFER_SIZE;
+                break;
+            }
+
+            status = _nx_crypto_chacha20_poly1305_encrypt_calculate(ctx, output, icv_len);
+        } break;
+
+        case NX_CRYPTO_SET_ADDITIONAL_DATA:
+        {
+
+            /* Set additonal data pointer.  */
+            ctx -> nx_crypto_chacha20_poly1305_additional_data = (VOID *)input;
+
+            /* Set additional data length.  */
+            ctx -> nx_crypto_chacha20_poly1305_additional_data_len = input_length_in_byte;
+
+            status = NX_CRYPTO_SUCCESS;
+        } break;
+
+        default:
+        {
+            status = NX_CRYPTO_INVALID_ALGORITHM;
+        } break;
+    }
+
+    return(status);
+}
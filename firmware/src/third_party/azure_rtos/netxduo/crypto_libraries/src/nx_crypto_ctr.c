@@ -166,6 +166,10 @@ USHORT result;
 /*    This function performs CTR mode encryption, only support block of   */
 /*    16 bytes.                                                           */
 /*                                                                        */
+/*    Up to NX_CRYPTO_CTR_PIPELINE_BLOCKS counter blocks are encrypted in */
+/*    one call to crypto_function, which must accept a multiple of the    */
+/*    block size.                                                         */
+/*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
 /*    crypto_metadata                       Pointer to crypto metadata    */
@@ -212,8 +216,11 @@ NX_CRYPTO_KEEP UINT _nx_crypto_ctr_encrypt(VOID *crypto_metadata, NX_CRYPTO_CTR
                                            UCHAR *input, UCHAR *output, UINT length, UINT block_size)
 {
 UCHAR  *control_block = ctr_metadata -> nx_crypto_ctr_counter_block;
-UCHAR  aes_output[NX_CRYPTO_CTR_BLOCK_SIZE];
+UCHAR  counter_blocks[NX_CRYPTO_CTR_PIPELINE_BLOCKS * NX_CRYPTO_CTR_BLOCK_SIZE];
+UCHAR  aes_output[NX_CRYPTO_CTR_PIPELINE_BLOCKS * NX_CRYPTO_CTR_BLOCK_SIZE];
 UINT   i;
+UINT   j;
+UINT   blocks = 0;
 
     /* Check the block size.  */
     if (block_size != NX_CRYPTO_CTR_BLOCK_SIZE)
@@ -221,15 +228,31 @@ UINT   i;
         return(NX_CRYPTO_PTR_ERROR);
     }
 
-    for (i = 0; i < length; i += block_size)
+    for (i = 0; i < length; i += blocks * block_size)
     {
         if (length - i < block_size)
         {
             break;
         }
-        crypto_function(crypto_metadata, control_block, aes_output, block_size);
-        _nx_crypto_ctr_xor(&input[i], aes_output, &output[i]);
-        _nx_crypto_ctr_add_one(control_block);
+
+        blocks = (length - i) / block_size;
+        if (blocks > NX_CRYPTO_CTR_PIPELINE_BLOCKS)
+        {
+            blocks = NX_CRYPTO_CTR_PIPELINE_BLOCKS;
+        }
+
+        /* Encrypt a batch of consecutive counter blocks in one call. */
+        for (j = 0; j < blocks; j++)
+        {
+            NX_CRYPTO_MEMCPY(&counter_blocks[j * block_size], control_block, block_size); /* Use case of memcpy is verified. */
+            _nx_crypto_ctr_add_one(control_block);
+        }
+        crypto_function(crypto_metadata, counter_blocks, aes_output, blocks * block_size);
+
+        for (j = 0; j < blocks; j++)
+        {
+            _nx_crypto_ctr_xor(&input[i + j * block_size], &aes_output[j * block_size], &output[i + j * block_size]);
+        }
     }
 
     /* If the input is not an even multiple of 16 bytes, we need to truncate and xor the remainder. */
@@ -241,6 +264,7 @@ UINT   i;
     }
 
 #ifdef NX_SECURE_KEY_CLEAR
+    NX_CRYPTO_MEMSET(counter_blocks, 0, sizeof(counter_blocks));
     NX_CRYPTO_MEMSET(aes_output, 0, sizeof(aes_output));
 #endif /* NX_SECURE_KEY_CLEAR  */
 
@@ -629,7 +629,7 @@ NX_CRYPTO_DES *des_context_ptr;
     }
 
     /* Verify the metadata addrsss is 4-byte aligned. */
-    if((((ULONG)crypto_metadata) & 0x3) != 0)
+    if((((ALIGN_TYPE)crypto_metadata) & 0x3) != 0)
     {
         return(NX_CRYPTO_PTR_ERROR);
     }
@@ -793,7 +793,7 @@ NX_CRYPTO_DES *context;
     }
 
     /* Verify the metadata addrsss is 4-byte aligned. */
-    if((((ULONG)crypto_metadata) & 0x3) != 0)
+    if((((ALIGN_TYPE)crypto_metadata) & 0x3) != 0)
     {
         return(NX_CRYPTO_PTR_ERROR);
     }
@@ -34,6 +34,12 @@ static UCHAR _nx_crypto_ctr_metadata[NX_CRYPTO_DRBG_CTR_METADATA_SIZE];
 
 static NX_CRYPTO_DRBG _nx_crypto_drbg_ctx;
 
+#ifdef NX_CRYPTO_DRBG_OUTPUT_BUFFER_SIZE
+/* Keystream of the last batch; the unused bytes are at the end. */
+static UCHAR _nx_crypto_drbg_output_buffer[NX_CRYPTO_DRBG_OUTPUT_BUFFER_SIZE];
+static UINT _nx_crypto_drbg_output_remaining;
+#endif
+
 static const UCHAR zeroiv[16] = { 0 };
 static const UCHAR _nx_crypto_drbg_df_key[] = {
     0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
@@ -980,7 +986,7 @@ NX_CRYPTO_KEEP UINT  _nx_crypto_method_drbg_init(struct  NX_CRYPTO_METHOD_STRUCT
     }
 
     /* Verify the metadata addrsss is 4-byte aligned. */
-    if((((ULONG)crypto_metadata) & 0x3) != 0)
+    if((((ALIGN_TYPE)crypto_metadata) & 0x3) != 0)
     {
         return(NX_CRYPTO_PTR_ERROR);
     }
@@ -1125,7 +1131,7 @@ UINT            status = NX_CRYPTO_SUCCESS;
     NX_CRYPTO_STATE_CHECK
 
     /* Verify the metadata addrsss is 4-byte aligned. */
-    if((method == NX_CRYPTO_NULL) || (crypto_metadata == NX_CRYPTO_NULL) || ((((ULONG)crypto_metadata) & 0x3) != 0))
+    if((method == NX_CRYPTO_NULL) || (crypto_metadata == NX_CRYPTO_NULL) || ((((ALIGN_TYPE)crypto_metadata) & 0x3) != 0))
     {
         return(NX_CRYPTO_PTR_ERROR);
     }
@@ -1239,6 +1245,37 @@ UINT status;
     return(status);
 }
 
+#ifdef NX_CRYPTO_DRBG_OUTPUT_BUFFER_SIZE
+NX_CRYPTO_KEEP static UINT _nx_crypto_drbg_buffered_generate(UCHAR *output, UINT output_length_in_byte)
+{
+UCHAR *buffer_ptr;
+UINT status;
+
+    if (output_length_in_byte > _nx_crypto_drbg_output_remaining)
+    {
+
+        /* Generate a new batch, overwriting the unused tail of the previous one. */
+        _nx_crypto_drbg_output_remaining = 0;
+        status = _nx_crypto_drbg_generate(&_nx_crypto_drbg_ctx, _nx_crypto_drbg_output_buffer,
+                                          NX_CRYPTO_DRBG_OUTPUT_BUFFER_SIZE, NX_CRYPTO_NULL, 0);
+        if (status != NX_CRYPTO_SUCCESS)
+        {
+            NX_CRYPTO_MEMSET(_nx_crypto_drbg_output_buffer, 0, sizeof(_nx_crypto_drbg_output_buffer));
+            return(status);
+        }
+        _nx_crypto_drbg_output_remaining = NX_CRYPTO_DRBG_OUTPUT_BUFFER_SIZE;
+    }
+
+    /* Hand out the next bytes and clear them so they can not be returned again. */
+    buffer_ptr = &_nx_crypto_drbg_output_buffer[NX_CRYPTO_DRBG_OUTPUT_BUFFER_SIZE - _nx_crypto_drbg_output_remaining];
+    NX_CRYPTO_MEMCPY(output, buffer_ptr, output_length_in_byte); /* Use case of memcpy is verified. */
+    NX_CRYPTO_MEMSET(buffer_ptr, 0, output_length_in_byte);
+    _nx_crypto_drbg_output_remaining -= output_length_in_byte;
+
+    return(NX_CRYPTO_SUCCESS);
+}
+#endif
+
 NX_CRYPTO_KEEP UINT _nx_crypto_drbg(UINT bits, UCHAR *result)
 {
 UINT bytes;
@@ -1254,7 +1291,16 @@ UINT status;
         _nx_crypto_drbg_initialize();
     }
 
-    status = _nx_crypto_drbg_generate(&_nx_crypto_drbg_ctx, result, bytes, NX_CRYPTO_NULL, 0);
+#ifdef NX_CRYPTO_DRBG_OUTPUT_BUFFER_SIZE
+    if (!_nx_crypto_drbg_ctx.nx_crypto_drbg_prediction_resistance && (bytes <= NX_CRYPTO_DRBG_OUTPUT_BUFFER_SIZE))
+    {
+        status = _nx_crypto_drbg_buffered_generate(result, bytes);
+    }
+    else
+#endif
+    {
+        status = _nx_crypto_drbg_generate(&_nx_crypto_drbg_ctx, result, bytes, NX_CRYPTO_NULL, 0);
+    }
     if (status)
     {
         return(status);
@@ -724,6 +724,10 @@ static NX_CRYPTO_CONST NX_CRYPTO_EC *_nx_crypto_ec_named_curves[] =
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
+/*    _nx_crypto_ec_fp_joint_multiple       Calculate the joint           */
+/*                                            multiplication              */
+/*    _nx_crypto_ec_fp_projective_multiple  Calculate the projective      */
+/*                                            multiplication              */
 /*    _nx_crypto_ec_point_fp_projective_to_affine                         */
 /*                                          Convert point from projective */
 /*                                            to affine                   */
@@ -790,6 +794,8 @@ NX_CRYPTO_KEEP UINT _nx_crypto_ec_point_is_infinite(NX_CRYPTO_EC_POINT *point)
 /*                                                                        */
 /*    _nx_crypto_ec_fp_fixed_multiple       Calculate the fixed           */
 /*                                            multiplication              */
+/*    _nx_crypto_ec_fp_joint_multiple       Calculate the joint           */
+/*                                            multiplication              */
 /*    _nx_crypto_ec_fp_projective_multiple  Calculate the projective      */
 /*                                            multiplication              */
 /*    _nx_crypto_ec_point_fp_projective_to_affine                         */
@@ -1010,6 +1016,8 @@ UINT clen;
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
+/*    _nx_crypto_ec_fp_odd_multiples        Compute the odd multiples of  */
+/*                                            point                       */
 /*    _nx_crypto_ec_fp_projective_add       Perform addition for points of*/
 /*                                            projective and affine       */
 /*                                                                        */
@@ -1057,6 +1065,9 @@ NX_CRYPTO_KEEP VOID _nx_crypto_ec_point_fp_affine_to_projective(NX_CRYPTO_EC_POI
 /*  CALLS                                                                 */
 /*                                                                        */
 /*    _nx_crypto_ec_point_is_infinite       Check if the point is infinite*/
+/*    _nx_crypto_ec_secp256r1_projective_to_affine                        */
+/*                                          Convert secp256r1 point from  */
+/*                                            projective to affine        */
 /*    _nx_crypto_huge_number_inverse_modulus_prime                        */
 /*                                          Perform an inverse modulus    */
 /*                                            operation for prime number  */
@@ -1070,6 +1081,8 @@ NX_CRYPTO_KEEP VOID _nx_crypto_ec_point_fp_affine_to_projective(NX_CRYPTO_EC_POI
 /*                                                                        */
 /*    _nx_crypto_ec_fp_fixed_multiple       Calculate the fixed           */
 /*                                            multiplication              */
+/*    _nx_crypto_ec_fp_joint_multiple       Calculate the joint           */
+/*                                            multiplication              */
 /*    _nx_crypto_ec_fp_projective_multiple  Calculate the projective      */
 /*                                            multiplication              */
 /*                                                                        */
@@ -1090,6 +1103,14 @@ NX_CRYPTO_HUGE_NUMBER  temp1, temp2, zi;
 NX_CRYPTO_HUGE_NUMBER *p;
 UINT                   buffer_size;
 
+#ifdef NX_CRYPTO_EC_SECP256R1_FIELD_ENABLE
+    if (curve -> nx_crypto_ec_id == NX_CRYPTO_EC_SECP256R1)
+    {
+        _nx_crypto_ec_secp256r1_projective_to_affine(point);
+        return;
+    }
+#endif
+
     p = &curve -> nx_crypto_ec_field.fp;
 
     if (_nx_crypto_ec_point_is_infinite(point))
@@ -1204,7 +1225,7 @@ UINT                  compare_value;
 
     NX_CRYPTO_HUGE_NUMBER_INITIALIZE(&temp, scratch, 36);
 
-    data = (UINT *)(((ULONG)scratch + 3) & (ULONG) ~3);
+    data = (UINT *)(((ALIGN_TYPE)scratch + 3) & (ALIGN_TYPE) ~3);
 
     /* c= (c5,...,c2,c1,c0), ci is a 64-bit word */
     _nx_crypto_huge_number_extract(value, (UCHAR *)data, 48, &size);
@@ -1341,7 +1362,7 @@ UINT                  compare_value;
 
     NX_CRYPTO_HUGE_NUMBER_INITIALIZE(&temp, scratch, 36);
 
-    data = (UINT *)(((ULONG)scratch + 3) & (ULONG) ~3);
+    data = (UINT *)(((ALIGN_TYPE)scratch + 3) & (ALIGN_TYPE) ~3);
 
     /* c= (c13,...,c2,c1,c0), ci is a 32-bit word */
     _nx_crypto_huge_number_extract(value, (UCHAR *)data, 56, &size);
@@ -1485,7 +1506,7 @@ UINT                  compare_value;
 
     NX_CRYPTO_HUGE_NUMBER_INITIALIZE(&temp, scratch, 36);
 
-    data = (UINT *)(((ULONG)scratch + 3) & (ULONG) ~3);
+    data = (UINT *)(((ALIGN_TYPE)scratch + 3) & (ALIGN_TYPE) ~3);
 
     /* c= (c15,...,c2,c1,c0), ci is a 32-bit word */
     _nx_crypto_huge_number_extract(value, (UCHAR *)data, 64, &size);
@@ -1650,7 +1671,7 @@ UINT                  compare_value;
 
     NX_CRYPTO_HUGE_NUMBER_INITIALIZE(&temp, scratch, 52);
 
-    data = (UINT *)(((ULONG)scratch + 3) & (ULONG) ~3);
+    data = (UINT *)(((ALIGN_TYPE)scratch + 3) & (ALIGN_TYPE) ~3);
 
     /* c= (c23,...,c2,c1,c0), ci is a 32-bit word */
     _nx_crypto_huge_number_extract(value, (UCHAR *)data, 96, &size);
@@ -1821,7 +1842,7 @@ UINT                  compare_value;
 
     NX_CRYPTO_HUGE_NUMBER_INITIALIZE(&temp, scratch, 66);
 
-    data = (UCHAR *)(((ULONG)scratch + 3) & (ULONG) ~3);
+    data = (UCHAR *)(((ALIGN_TYPE)scratch + 3) & (ALIGN_TYPE) ~3);
 
 
     /* c= (c1041,...,c2,c1,c0) */
@@ -2166,7 +2187,7 @@ NX_CRYPTO_KEEP VOID _nx_crypto_ec_add_reduce(NX_CRYPTO_EC *curve,
 /*                                            projective and affine       */
 /*    _nx_crypto_ec_fp_projective_double    Perform doubling for points of*/
 /*                                            projective                  */
-/*    _nx_crypto_ec_fp_projective_multiple  Calculate the projective      */
+/*    _nx_crypto_ec_fp_joint_multiple       Calculate the joint           */
 /*                                            multiplication              */
 /*                                                                        */
 /*  RELEASE HISTORY                                                       */
@@ -2228,17 +2249,28 @@ NX_CRYPTO_KEEP VOID _nx_crypto_ec_subtract_reduce(NX_CRYPTO_EC *curve,
 /*                                            huge number                 */
 /*    _nx_crypto_ec_add_reduce              Perform addition between      */
 /*                                            two huge numbers            */
+/*    _nx_crypto_ec_fp_projective_double    Perform doubling for points of*/
+/*                                            projective                  */
 /*    _nx_crypto_ec_point_is_infinite       Check if the point is infinite*/
+/*    _nx_crypto_ec_point_set_infinite      Set the point to infinite     */
 /*    _nx_crypto_ec_point_fp_affine_to_projective                         */
 /*                                          Convert point from affine to  */
 /*                                            projective                  */
+/*    _nx_crypto_ec_secp256r1_projective_add                              */
+/*                                          Perform addition for          */
+/*                                            secp256r1 points            */
 /*    _nx_crypto_ec_subtract_reduce         Perform subtraction between   */
 /*                                            two huge numbers            */
+/*    _nx_crypto_huge_number_is_zero        Check if number is zero or not*/
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
 /*    _nx_crypto_ec_fp_fixed_multiple       Calculate the fixed           */
 /*                                            multiplication              */
+/*    _nx_crypto_ec_fp_joint_multiple       Calculate the joint           */
+/*                                            multiplication              */
+/*    _nx_crypto_ec_fp_odd_multiples        Compute the odd multiples of  */
+/*                                            point                       */
 /*    _nx_crypto_ec_fp_projective_multiple  Calculate the projective      */
 /*                                            multiplication              */
 /*                                                                        */
@@ -2270,6 +2302,14 @@ UINT                  buffer_size;
         Z3 = Z1 * C
      */
 
+#ifdef NX_CRYPTO_EC_SECP256R1_FIELD_ENABLE
+    if (curve -> nx_crypto_ec_id == NX_CRYPTO_EC_SECP256R1)
+    {
+        _nx_crypto_ec_secp256r1_projective_add(projective_point, affine_point);
+        return;
+    }
+#endif
+
     if (_nx_crypto_ec_point_is_infinite(projective_point))
     {
         NX_CRYPTO_HUGE_NUMBER_COPY(&projective_point -> nx_crypto_ec_point_x,
@@ -2311,6 +2351,21 @@ UINT                  buffer_size;
     _nx_crypto_ec_subtract_reduce(curve, &temp1, &projective_point -> nx_crypto_ec_point_y,
                                   scratch);
 
+    /* C = 0 when the points are equal or opposite, which the formulas above do not cover.
+       It can happen in a joint multiplication when one point is a small multiple of the other. */
+    if (_nx_crypto_huge_number_is_zero(&temp2))
+    {
+        if (_nx_crypto_huge_number_is_zero(&temp1))
+        {
+            _nx_crypto_ec_fp_projective_double(curve, projective_point, scratch);
+        }
+        else
+        {
+            _nx_crypto_ec_point_set_infinite(projective_point);
+        }
+        return;
+    }
+
     /* temp2 = C */
     /* Z3 = Z1 * C */
     NX_CRYPTO_EC_MULTIPLE_REDUCE(curve, &projective_point -> nx_crypto_ec_point_z,
@@ -2381,6 +2436,9 @@ UINT                  buffer_size;
 /*                                            huge number                 */
 /*    _nx_crypto_ec_add_reduce              Perform addition between      */
 /*                                            two huge numbers            */
+/*    _nx_crypto_ec_secp256r1_projective_double                           */
+/*                                          Perform doubling for          */
+/*                                            secp256r1 points            */
 /*    _nx_crypto_ec_subtract_reduce         Perform subtraction between   */
 /*                                            two huge numbers            */
 /*    _nx_crypto_ec_point_is_infinite       Check if the point is infinite*/
@@ -2389,6 +2447,10 @@ UINT                  buffer_size;
 /*                                                                        */
 /*    _nx_crypto_ec_fp_fixed_multiple       Calculate the fixed           */
 /*                                            multiplication              */
+/*    _nx_crypto_ec_fp_joint_multiple       Calculate the joint           */
+/*                                            multiplication              */
+/*    _nx_crypto_ec_fp_odd_multiples        Compute the odd multiples of  */
+/*                                            point                       */
 /*    _nx_crypto_ec_fp_projective_multiple  Calculate the projective      */
 /*                                            multiplication              */
 /*                                                                        */
@@ -2419,6 +2481,14 @@ UINT                  buffer_size;
         Z3 = 2 * Y1 * Z1
      */
 
+#ifdef NX_CRYPTO_EC_SECP256R1_FIELD_ENABLE
+    if (curve -> nx_crypto_ec_id == NX_CRYPTO_EC_SECP256R1)
+    {
+        _nx_crypto_ec_secp256r1_projective_double(projective_point);
+        return;
+    }
+#endif
+
     if (_nx_crypto_ec_point_is_infinite(projective_point))
     {
         return;
@@ -2708,7 +2778,7 @@ NX_CRYPTO_EC_POINT point;
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
-/*    _nx_crypto_ec_fp_projective_multiple  Calculate the projective      */
+/*    _nx_crypto_ec_fp_joint_multiple       Calculate the joint           */
 /*                                            multiplication              */
 /*                                                                        */
 /*  RELEASE HISTORY                                                       */
@@ -2797,13 +2867,291 @@ UINT      i, j;
         }
     }
 
-    *naf_size = ((ULONG)ptr - (ULONG)naf_data) >> HN_SIZE_SHIFT;
+    *naf_size = ((ALIGN_TYPE)ptr - (ALIGN_TYPE)naf_data) >> HN_SIZE_SHIFT;
     if (shift != 0)
     {
         *naf_size = *naf_size + 1;
     }
 }
 
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_ec_wnaf_compute                          PORTABLE C      */
+/*                                                           6.1          */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function computes the width-w non-adjacent form of one word of */
+/*    huge number, w being NX_CRYPTO_EC_WNAF_WINDOW_WIDTH. Each nonzero   */
+/*    digit is odd and below 2 ^ (w - 1) in magnitude, and is followed by */
+/*    at least w - 1 zero digits.                                         */
+/*                                                                        */
+/*    The words are recoded from the least significant one. The carry and */
+/*    the count of zero digits still to skip are passed from one word to  */
+/*    the next, so that a caller saving them at each word can regenerate  */
+/*    the digits of any word later. The word after the most significant   */
+/*    word of d must be recoded too to consume the final carry.           */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    d                                     Pointer to huge number        */
+/*    word_index                            Index of the word to recode   */
+/*    carry                                 Carry in and out              */
+/*    skip                                  Zero digits to skip, in & out */
+/*    wnaf_data                             HN_SHIFT digits for output,   */
+/*                                            or NX_CRYPTO_NULL           */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_crypto_ec_fp_joint_multiple       Calculate the joint           */
+/*                                            multiplication              */
+/*    _nx_crypto_ec_fp_projective_multiple  Calculate the projective      */
+/*                                            multiplication              */
+/*                                                                        */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP VOID _nx_crypto_ec_wnaf_compute(NX_CRYPTO_HUGE_NUMBER *d, UINT word_index,
+                                               UINT *carry, UINT *skip, CHAR *wnaf_data)
+{
+HN_UBASE2 window;
+UINT      bit_index;
+UINT      word;
+INT       digit;
+UINT      i;
+
+    for (i = 0; i < HN_SHIFT; i++)
+    {
+        digit = 0;
+
+        if (*skip)
+        {
+            (*skip)--;
+        }
+        else
+        {
+
+            /* Get w bits of d starting from the current one. */
+            bit_index = (word_index << (HN_SIZE_SHIFT + 3)) + i;
+            word = bit_index >> (HN_SIZE_SHIFT + 3);
+            window = 0;
+            if (word + 1 < d -> nx_crypto_huge_number_size)
+            {
+                window = d -> nx_crypto_huge_number_data[word + 1];
+                window <<= HN_SHIFT;
+            }
+            if (word < d -> nx_crypto_huge_number_size)
+            {
+                window |= d -> nx_crypto_huge_number_data[word];
+            }
+            window = (window >> (bit_index & (HN_SHIFT - 1))) &
+                ((1 << NX_CRYPTO_EC_WNAF_WINDOW_WIDTH) - 1);
+
+            if (((window + *carry) & 1) == 0)
+            {
+                *carry &= (UINT)window;
+            }
+            else
+            {
+
+                /* The window plus carry is odd and at most 2 ^ w - 1. */
+                digit = (INT)(window + *carry);
+                *carry = 0;
+                if (digit >= (1 << (NX_CRYPTO_EC_WNAF_WINDOW_WIDTH - 1)))
+                {
+                    digit -= (1 << NX_CRYPTO_EC_WNAF_WINDOW_WIDTH);
+                    *carry = 1;
+                }
+                *skip = NX_CRYPTO_EC_WNAF_WINDOW_WIDTH - 1;
+            }
+        }
+
+        if (wnaf_data)
+        {
+            wnaf_data[i] = (CHAR)digit;
+        }
+    }
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_ec_fp_odd_multiples                      PORTABLE C      */
+/*                                                           6.1          */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function computes the odd multiples g, 3g, 5g, ... of point g  */
+/*    in affine coordinates for the width-w NAF multiplication. The table */
+/*    has NX_CRYPTO_EC_WNAF_TABLE_SIZE entries. Entry 0 shares the buffers*/
+/*    of g, the others are allocated from the scratch buffer, and the     */
+/*    scratch pointer is advanced past them.                              */
+/*                                                                        */
+/*    2g is computed in projective coordinates as (X, Y, Z). On the curve */
+/*    isomorphic to the original one by Z, 2g is the affine point (X, Y)  */
+/*    and g is (x * Z ^ 2, y * Z ^ 3). The formulas of point addition do  */
+/*    not use the curve coefficients, so the odd multiples are chained    */
+/*    there with mixed additions. All of them are then converted to affine*/
+/*    with a single inversion, using Montgomery's trick.                  */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    curve                                 Pointer to curve              */
+/*    g                                     Point g, not infinite         */
+/*    table                                 Odd multiples for output      */
+/*    scratch_pptr                          Pointer to scratch buffer     */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    NX_CRYPTO_EC_MULTIPLE_REDUCE          Multiply two huge numbers     */
+/*    NX_CRYPTO_EC_POINT_INITIALIZE         Initialize EC point           */
+/*    NX_CRYPTO_EC_SQUARE_REDUCE            Compute the square of a value */
+/*    NX_CRYPTO_HUGE_NUMBER_COPY            Copy huge number              */
+/*    NX_CRYPTO_HUGE_NUMBER_INITIALIZE      Initialize the buffer of      */
+/*                                            huge number                 */
+/*    NX_CRYPTO_HUGE_NUMBER_SET_DIGIT       Set value of huge number      */
+/*                                            between 0 and (HN_RADIX - 1)*/
+/*    _nx_crypto_ec_fp_projective_add       Perform addition for points of*/
+/*                                            projective and affine       */
+/*    _nx_crypto_ec_fp_projective_double    Perform doubling for points of*/
+/*                                            projective                  */
+/*    _nx_crypto_ec_point_fp_affine_to_projective                         */
+/*                                          Convert point from affine to  */
+/*                                            projective                  */
+/*    _nx_crypto_huge_number_inverse_modulus_prime                        */
+/*                                          Perform an inverse modulus    */
+/*                                            operation for prime number  */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_crypto_ec_fp_joint_multiple       Calculate the joint           */
+/*                                            multiplication              */
+/*    _nx_crypto_ec_fp_projective_multiple  Calculate the projective      */
+/*                                            multiplication              */
+/*                                                                        */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP VOID _nx_crypto_ec_fp_odd_multiples(NX_CRYPTO_EC *curve,
+                                                   NX_CRYPTO_EC_POINT *g,
+                                                   NX_CRYPTO_EC_POINT *table,
+                                                   HN_UBASE **scratch_pptr)
+{
+NX_CRYPTO_EC_POINT     projective_point;
+NX_CRYPTO_EC_POINT     double_g;
+NX_CRYPTO_HUGE_NUMBER  z[NX_CRYPTO_EC_WNAF_TABLE_SIZE];
+NX_CRYPTO_HUGE_NUMBER  c[NX_CRYPTO_EC_WNAF_TABLE_SIZE];
+NX_CRYPTO_HUGE_NUMBER  lambda, temp1, temp2, zi, inverse;
+NX_CRYPTO_HUGE_NUMBER *p;
+HN_UBASE              *scratch;
+HN_UBASE              *temp_ptr;
+UINT                   buffer_size;
+UINT                   i;
+
+    scratch = *scratch_pptr;
+    buffer_size = g -> nx_crypto_ec_point_x.nx_crypto_huge_buffer_size;
+
+    table[0] = *g;
+    for (i = 1; i < NX_CRYPTO_EC_WNAF_TABLE_SIZE; i++)
+    {
+        NX_CRYPTO_EC_POINT_INITIALIZE(&table[i], NX_CRYPTO_EC_POINT_AFFINE, scratch, buffer_size);
+    }
+    *scratch_pptr = scratch;
+
+    p = &curve -> nx_crypto_ec_field.fp;
+    NX_CRYPTO_EC_POINT_INITIALIZE(&projective_point, NX_CRYPTO_EC_POINT_PROJECTIVE, scratch, buffer_size);
+    NX_CRYPTO_EC_POINT_INITIALIZE(&double_g, NX_CRYPTO_EC_POINT_AFFINE, scratch, buffer_size);
+    NX_CRYPTO_HUGE_NUMBER_INITIALIZE(&lambda, scratch, buffer_size);
+    NX_CRYPTO_HUGE_NUMBER_INITIALIZE(&temp1, scratch, buffer_size << 1);
+    for (i = 1; i < NX_CRYPTO_EC_WNAF_TABLE_SIZE; i++)
+    {
+        NX_CRYPTO_HUGE_NUMBER_INITIALIZE(&z[i], scratch, buffer_size);
+    }
+
+    /* 2g = (X, Y, lambda) */
+    NX_CRYPTO_HUGE_NUMBER_COPY(&projective_point.nx_crypto_ec_point_x, &g -> nx_crypto_ec_point_x);
+    NX_CRYPTO_HUGE_NUMBER_COPY(&projective_point.nx_crypto_ec_point_y, &g -> nx_crypto_ec_point_y);
+    _nx_crypto_ec_point_fp_affine_to_projective(&projective_point);
+    _nx_crypto_ec_fp_projective_double(curve, &projective_point, scratch);
+    NX_CRYPTO_HUGE_NUMBER_COPY(&double_g.nx_crypto_ec_point_x, &projective_point.nx_crypto_ec_point_x);
+    NX_CRYPTO_HUGE_NUMBER_COPY(&double_g.nx_crypto_ec_point_y, &projective_point.nx_crypto_ec_point_y);
+    NX_CRYPTO_HUGE_NUMBER_COPY(&lambda, &projective_point.nx_crypto_ec_point_z);
+
+    /* g on the isomorphic curve: (x * lambda ^ 2, y * lambda ^ 3, 1).
+       temp2 is only needed here, so it is placed in the scratch used by the additions. */
+    temp_ptr = scratch;
+    NX_CRYPTO_HUGE_NUMBER_INITIALIZE(&temp2, temp_ptr, buffer_size << 1);
+    NX_CRYPTO_EC_SQUARE_REDUCE(curve, &lambda, &temp1, temp_ptr);
+    NX_CRYPTO_EC_MULTIPLE_REDUCE(curve, &g -> nx_crypto_ec_point_x, &temp1, &temp2, temp_ptr);
+    NX_CRYPTO_HUGE_NUMBER_COPY(&projective_point.nx_crypto_ec_point_x, &temp2);
+    NX_CRYPTO_EC_MULTIPLE_REDUCE(curve, &temp1, &lambda, &temp2, temp_ptr);
+    NX_CRYPTO_EC_MULTIPLE_REDUCE(curve, &g -> nx_crypto_ec_point_y, &temp2, &temp1, temp_ptr);
+    NX_CRYPTO_HUGE_NUMBER_COPY(&projective_point.nx_crypto_ec_point_y, &temp1);
+    NX_CRYPTO_HUGE_NUMBER_SET_DIGIT(&projective_point.nx_crypto_ec_point_z, 1);
+
+    /* (2i + 1)g = (X, Y, Z * lambda) where (X, Y, Z) is on the isomorphic curve. */
+    for (i = 1; i < NX_CRYPTO_EC_WNAF_TABLE_SIZE; i++)
+    {
+        _nx_crypto_ec_fp_projective_add(curve, &projective_point, &double_g, scratch);
+        NX_CRYPTO_HUGE_NUMBER_COPY(&table[i].nx_crypto_ec_point_x, &projective_point.nx_crypto_ec_point_x);
+        NX_CRYPTO_HUGE_NUMBER_COPY(&table[i].nx_crypto_ec_point_y, &projective_point.nx_crypto_ec_point_y);
+        NX_CRYPTO_EC_MULTIPLE_REDUCE(curve, &projective_point.nx_crypto_ec_point_z, &lambda, &temp1, scratch);
+        NX_CRYPTO_HUGE_NUMBER_COPY(&z[i], &temp1);
+    }
+
+    /* c[i] = z[1] * ... * z[i] */
+    NX_CRYPTO_HUGE_NUMBER_INITIALIZE(&temp2, scratch, buffer_size << 1);
+    NX_CRYPTO_HUGE_NUMBER_INITIALIZE(&zi, scratch, buffer_size);
+    NX_CRYPTO_HUGE_NUMBER_INITIALIZE(&inverse, scratch, buffer_size);
+    c[1] = z[1];
+    for (i = 2; i < NX_CRYPTO_EC_WNAF_TABLE_SIZE; i++)
+    {
+        NX_CRYPTO_HUGE_NUMBER_INITIALIZE(&c[i], scratch, buffer_size);
+        NX_CRYPTO_EC_MULTIPLE_REDUCE(curve, &c[i - 1], &z[i], &temp1, scratch);
+        NX_CRYPTO_HUGE_NUMBER_COPY(&c[i], &temp1);
+    }
+
+    /* inverse = (z[1] * ... * z[i]) ^ -1 mod p */
+    _nx_crypto_huge_number_inverse_modulus_prime(&c[NX_CRYPTO_EC_WNAF_TABLE_SIZE - 1],
+                                                 p, &inverse, scratch);
+
+    for (i = NX_CRYPTO_EC_WNAF_TABLE_SIZE - 1; i >= 1; i--)
+    {
+
+        /* zi = z[i] ^ -1 mod p */
+        if (i > 1)
+        {
+            NX_CRYPTO_EC_MULTIPLE_REDUCE(curve, &inverse, &c[i - 1], &temp1, scratch);
+            NX_CRYPTO_HUGE_NUMBER_COPY(&zi, &temp1);
+            NX_CRYPTO_EC_MULTIPLE_REDUCE(curve, &inverse, &z[i], &temp1, scratch);
+            NX_CRYPTO_HUGE_NUMBER_COPY(&inverse, &temp1);
+        }
+        else
+        {
+            NX_CRYPTO_HUGE_NUMBER_COPY(&zi, &inverse);
+        }
+
+        /* x = X * zi ^ 2, y = Y * zi ^ 3 */
+        NX_CRYPTO_EC_SQUARE_REDUCE(curve, &zi, &temp1, scratch);
+        NX_CRYPTO_EC_MULTIPLE_REDUCE(curve, &table[i].nx_crypto_ec_point_x, &temp1, &temp2, scratch);
+        NX_CRYPTO_HUGE_NUMBER_COPY(&table[i].nx_crypto_ec_point_x, &temp2);
+        NX_CRYPTO_EC_MULTIPLE_REDUCE(curve, &zi, &temp1, &temp2, scratch);
+        NX_CRYPTO_EC_MULTIPLE_REDUCE(curve, &table[i].nx_crypto_ec_point_y, &temp2, &temp1, scratch);
+        NX_CRYPTO_HUGE_NUMBER_COPY(&table[i].nx_crypto_ec_point_y, &temp1);
+    }
+}
+
 /* r and g are allowed to be the same pointer. */
 /**************************************************************************/
 /*                                                                        */
@@ -2820,6 +3168,11 @@ UINT      i, j;
 /*    This function calculates the multiplication in prime field. The     */
 /*    point g is unknown. r = g * d.                                      */
 /*                                                                        */
+/*    d is processed in width-w NAF from the most significant digit, w    */
+/*    being NX_CRYPTO_EC_WNAF_WINDOW_WIDTH. A table of the odd multiples  */
+/*    of g is built first, and each nonzero digit adds or subtracts one   */
+/*    of them with a mixed addition.                                      */
+/*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
 /*    curve                                 Pointer to curve              */
@@ -2838,18 +3191,22 @@ UINT      i, j;
 /*    NX_CRYPTO_HUGE_NUMBER_COPY            Copy huge number              */
 /*    _nx_crypto_ec_fp_fixed_multiple       Calculate the fixed           */
 /*                                            multiplication              */
+/*    _nx_crypto_ec_fp_odd_multiples        Compute the odd multiples of  */
+/*                                            point                       */
 /*    _nx_crypto_ec_fp_projective_add       Perform addition for points of*/
 /*                                            projective and affine       */
 /*    _nx_crypto_ec_fp_projective_double    Perform doubling for points of*/
 /*                                            projective                  */
-/*    _nx_crypto_ec_naf_compute             Compute the non-adjacent form */
-/*                                            of huge number              */
+/*    _nx_crypto_ec_wnaf_compute            Compute the width-w NAF of a  */
+/*                                            word of huge number         */
 /*    _nx_crypto_ec_point_fp_projective_to_affine                         */
 /*                                          Convert point from projective */
 /*                                            to affine                   */
+/*    _nx_crypto_ec_point_is_infinite       Check if the point is infinite*/
 /*    _nx_crypto_ec_point_set_infinite      Set the point to infinite     */
-/*    _nx_crypto_ec_subtract_reduce         Perform subtraction between   */
-/*                                            two huge numbers            */
+/*    _nx_crypto_huge_number_subtract_unsigned                            */
+/*                                          Calculate subtraction for     */
+/*                                            unsigned huge numbers       */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -2870,14 +3227,15 @@ NX_CRYPTO_KEEP VOID _nx_crypto_ec_fp_projective_multiple(NX_CRYPTO_EC *curve,
                                                          NX_CRYPTO_EC_POINT *r,
                                                          HN_UBASE *scratch)
 {
-NX_CRYPTO_EC_POINT projective_point;
-NX_CRYPTO_EC_POINT negative_g;
-HN_UBASE          *naf_data;
-UINT               naf_size;
-HN_UBASE           digit;
-HN_UBASE           value;
-HN_UBASE          *ptr;
-UINT               bit;
+NX_CRYPTO_EC_POINT     projective_point;
+NX_CRYPTO_EC_POINT     table[NX_CRYPTO_EC_WNAF_TABLE_SIZE];
+NX_CRYPTO_HUGE_NUMBER *p;
+UCHAR                 *wnaf_state;
+CHAR                   wnaf_data[HN_SHIFT];
+UINT                   carry;
+UINT                   skip;
+INT                    digit;
+INT                    i, j;
 
     if ((curve -> nx_crypto_ec_fixed_points) && (&curve -> nx_crypto_ec_g == g))
     {
@@ -2885,53 +3243,58 @@ UINT               bit;
         return;
     }
 
+    if (_nx_crypto_ec_point_is_infinite(g))
+    {
+        _nx_crypto_ec_point_set_infinite(r);
+        return;
+    }
+
+    p = &curve -> nx_crypto_ec_field.fp;
+
+    /* Save the state of the recoding at each word of d, so that the digits
+       can be regenerated one word at a time from the most significant one. */
+    wnaf_state = (UCHAR *)scratch;
+    scratch += (d -> nx_crypto_huge_number_size + 1 + HN_SIZE_ROUND) >> HN_SIZE_SHIFT;
+    carry = 0;
+    skip = 0;
+    for (i = 0; i <= (INT)d -> nx_crypto_huge_number_size; i++)
+    {
+        wnaf_state[i] = (UCHAR)(carry | (skip << 1));
+        _nx_crypto_ec_wnaf_compute(d, (UINT)i, &carry, &skip, NX_CRYPTO_NULL);
+    }
+
+    _nx_crypto_ec_fp_odd_multiples(curve, g, table, &scratch);
+
     NX_CRYPTO_EC_POINT_INITIALIZE(&projective_point, NX_CRYPTO_EC_POINT_PROJECTIVE, scratch,
                                   g -> nx_crypto_ec_point_x.nx_crypto_huge_buffer_size);
-    NX_CRYPTO_EC_POINT_INITIALIZE(&negative_g, NX_CRYPTO_EC_POINT_AFFINE, scratch,
-                                  g -> nx_crypto_ec_point_x.nx_crypto_huge_buffer_size);
-
     _nx_crypto_ec_point_set_infinite(&projective_point);
-    NX_CRYPTO_HUGE_NUMBER_COPY(&negative_g.nx_crypto_ec_point_x, &g -> nx_crypto_ec_point_x);
-    NX_CRYPTO_HUGE_NUMBER_COPY(&negative_g.nx_crypto_ec_point_y, &curve -> nx_crypto_ec_field.fp);
-    _nx_crypto_ec_subtract_reduce(curve, &negative_g.nx_crypto_ec_point_y,
-                                  &g -> nx_crypto_ec_point_y, scratch);
-
-    naf_data = scratch;
-    _nx_crypto_ec_naf_compute(d, naf_data, &naf_size);
-    scratch += naf_size;
-
-    /* Trim zero bit from the highest significant bit. */
-    ptr = naf_data + naf_size - 1;
-    digit = *ptr;
-    for (bit = 0; bit < HN_SHIFT - 1; bit += 2)
-    {
-        value = (digit >> (HN_SHIFT - bit - 2)) & 3;
-        if (value != 0)
-        {
-            break;
-        }
-    }
 
-    for (; (ULONG)ptr >= (ULONG)naf_data; ptr--)
+    for (i = (INT)d -> nx_crypto_huge_number_size; i >= 0; i--)
     {
-        digit = *ptr;
+        carry = wnaf_state[i] & 1;
+        skip = (UINT)(wnaf_state[i] >> 1);
+        _nx_crypto_ec_wnaf_compute(d, (UINT)i, &carry, &skip, wnaf_data);
 
-        for (; bit < HN_SHIFT - 1; bit += 2)
+        for (j = HN_SHIFT - 1; j >= 0; j--)
         {
             _nx_crypto_ec_fp_projective_double(curve, &projective_point, scratch);
 
-            value = (digit >> (HN_SHIFT - bit - 2)) & 3;
-
-            if (value == 1)
+            digit = wnaf_data[j];
+            if (digit > 0)
             {
-                _nx_crypto_ec_fp_projective_add(curve, &projective_point, g, scratch);
+                _nx_crypto_ec_fp_projective_add(curve, &projective_point, &table[digit >> 1], scratch);
             }
-            else if (value == 3)
+            else if (digit < 0)
             {
-                _nx_crypto_ec_fp_projective_add(curve, &projective_point, &negative_g, scratch);
+
+                /* P - T = -(-P + T), so that no negated table entries are needed. */
+                _nx_crypto_huge_number_subtract_unsigned(p, &projective_point.nx_crypto_ec_point_y,
+                                                         &projective_point.nx_crypto_ec_point_y);
+                _nx_crypto_ec_fp_projective_add(curve, &projective_point, &table[(-digit) >> 1], scratch);
+                _nx_crypto_huge_number_subtract_unsigned(p, &projective_point.nx_crypto_ec_point_y,
+                                                         &projective_point.nx_crypto_ec_point_y);
             }
         }
-        bit = 0;
     }
 
     _nx_crypto_ec_point_fp_projective_to_affine(curve, &projective_point, scratch);
@@ -3085,6 +3448,276 @@ UINT                       j;
                                &projective_point.nx_crypto_ec_point_y);
 }
 
+/* r, g and q are allowed to be the same pointer. */
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_ec_fp_joint_multiple                     PORTABLE C      */
+/*                                                           6.1          */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function calculates the sum of two multiplications in prime    */
+/*    field. r = g * d + q * e.                                           */
+/*                                                                        */
+/*    Both products are accumulated in one projective point so that each */
+/*    doubling is shared by the two factors. The digits of e are taken    */
+/*    from its width-w NAF with a table of the odd multiples of q, as in  */
+/*    _nx_crypto_ec_fp_projective_multiple. When g is the base point of   */
+/*    the curve and fixed points are available, the digits of d are taken */
+/*    from the same columns as in _nx_crypto_ec_fp_fixed_multiple.        */
+/*    Otherwise the NAF of d is used.                                     */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    curve                                 Pointer to curve              */
+/*    g                                     First point g                 */
+/*    d                                     Factor d                      */
+/*    q                                     Second point q                */
+/*    e                                     Factor e                      */
+/*    r                                     Result r                      */
+/*    scratch                               Pointer to scratch buffer     */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    NX_CRYPTO_EC_POINT_INITIALIZE         Initialize EC point           */
+/*    NX_CRYPTO_HUGE_NUMBER_COPY            Copy huge number              */
+/*    NX_CRYPTO_HUGE_NUMBER_INITIALIZE      Initialize the buffer of      */
+/*                                            huge number                 */
+/*    _nx_crypto_ec_fp_odd_multiples        Compute the odd multiples of  */
+/*                                            point                       */
+/*    _nx_crypto_ec_fp_projective_add       Perform addition for points of*/
+/*                                            projective and affine       */
+/*    _nx_crypto_ec_fp_projective_double    Perform doubling for points of*/
+/*                                            projective                  */
+/*    _nx_crypto_ec_naf_compute             Compute the non-adjacent form */
+/*                                            of huge number              */
+/*    _nx_crypto_ec_wnaf_compute            Compute the width-w NAF of a  */
+/*                                            word of huge number         */
+/*    _nx_crypto_ec_point_fp_projective_to_affine                         */
+/*                                          Convert point from projective */
+/*                                            to affine                   */
+/*    _nx_crypto_ec_point_is_infinite       Check if the point is infinite*/
+/*    _nx_crypto_ec_point_set_infinite      Set the point to infinite     */
+/*    _nx_crypto_ec_subtract_reduce         Perform subtraction between   */
+/*                                            two huge numbers            */
+/*    _nx_crypto_huge_number_is_zero        Check if number is zero or not*/
+/*    _nx_crypto_huge_number_subtract_unsigned                            */
+/*                                          Calculate subtraction for     */
+/*                                            unsigned huge numbers       */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_crypto_ecdsa_verify               Verify ECDSA signature        */
+/*                                                                        */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP VOID _nx_crypto_ec_fp_joint_multiple(NX_CRYPTO_EC *curve,
+                                                    NX_CRYPTO_EC_POINT *g,
+                                                    NX_CRYPTO_HUGE_NUMBER *d,
+                                                    NX_CRYPTO_EC_POINT *q,
+                                                    NX_CRYPTO_HUGE_NUMBER *e,
+                                                    NX_CRYPTO_EC_POINT *r,
+                                                    HN_UBASE *scratch)
+{
+NX_CRYPTO_EC_POINT         projective_point;
+NX_CRYPTO_EC_POINT         negative_g;
+NX_CRYPTO_EC_POINT         table[NX_CRYPTO_EC_WNAF_TABLE_SIZE];
+NX_CRYPTO_EC_FIXED_POINTS *fixed_points;
+NX_CRYPTO_HUGE_NUMBER     *p;
+NX_CRYPTO_HUGE_NUMBER      expanded_d;
+UINT                       expanded_size;
+ULONG                      transpose_d;
+HN_UBASE                  *naf_d = NX_CRYPTO_NULL;
+UINT                       naf_size;
+UCHAR                     *wnaf_state = NX_CRYPTO_NULL;
+CHAR                       wnaf_data[HN_SHIFT];
+UINT                       carry;
+UINT                       skip;
+INT                        digit;
+UINT                       d_steps = 0;
+UINT                       e_steps = 0;
+HN_UBASE                   value;
+UINT                       bit_index;
+UINT                       buffer_size;
+INT                        i;
+UINT                       j;
+
+    fixed_points = curve -> nx_crypto_ec_fixed_points;
+    if (&curve -> nx_crypto_ec_g != g)
+    {
+        fixed_points = NX_CRYPTO_NULL;
+    }
+
+    buffer_size = q -> nx_crypto_ec_point_x.nx_crypto_huge_buffer_size;
+    if (buffer_size < g -> nx_crypto_ec_point_x.nx_crypto_huge_buffer_size)
+    {
+        buffer_size = g -> nx_crypto_ec_point_x.nx_crypto_huge_buffer_size;
+    }
+
+    p = &curve -> nx_crypto_ec_field.fp;
+
+    /* expanded_d is only set up with fixed points, and naf_d only without them. */
+    expanded_d.nx_crypto_huge_number_data = NX_CRYPTO_NULL;
+
+    /* The digits of e are regenerated one word at a time, as in
+       _nx_crypto_ec_fp_projective_multiple. */
+    if ((!_nx_crypto_huge_number_is_zero(e)) && (!_nx_crypto_ec_point_is_infinite(q)))
+    {
+        wnaf_state = (UCHAR *)scratch;
+        scratch += (e -> nx_crypto_huge_number_size + 1 + HN_SIZE_ROUND) >> HN_SIZE_SHIFT;
+        carry = 0;
+        skip = 0;
+        for (i = 0; i <= (INT)e -> nx_crypto_huge_number_size; i++)
+        {
+            wnaf_state[i] = (UCHAR)(carry | (skip << 1));
+            _nx_crypto_ec_wnaf_compute(e, (UINT)i, &carry, &skip, NX_CRYPTO_NULL);
+        }
+        e_steps = (e -> nx_crypto_huge_number_size + 1) << (HN_SIZE_SHIFT + 3);
+
+        _nx_crypto_ec_fp_odd_multiples(curve, q, table, &scratch);
+    }
+
+    NX_CRYPTO_EC_POINT_INITIALIZE(&projective_point, NX_CRYPTO_EC_POINT_PROJECTIVE, scratch, buffer_size);
+    _nx_crypto_ec_point_set_infinite(&projective_point);
+
+    if (fixed_points)
+    {
+
+        /* Spread d over the columns of the fixed points. */
+        expanded_size = fixed_points -> nx_crypto_ec_fixed_points_window_width *
+            (fixed_points -> nx_crypto_ec_fixed_points_e << 1);
+        expanded_size = (expanded_size + 7) >> 3;
+        expanded_size = (expanded_size + 3) & (ULONG) ~3;
+
+        NX_CRYPTO_HUGE_NUMBER_INITIALIZE(&expanded_d, scratch, expanded_size);
+        NX_CRYPTO_HUGE_NUMBER_COPY(&expanded_d, d);
+        NX_CRYPTO_MEMSET(&expanded_d.nx_crypto_huge_number_data[expanded_d.nx_crypto_huge_number_size], 0,
+               expanded_size - (d -> nx_crypto_huge_number_size << HN_SIZE_SHIFT));
+        expanded_d.nx_crypto_huge_number_size = expanded_size >> HN_SIZE_SHIFT;
+        d_steps = fixed_points -> nx_crypto_ec_fixed_points_e;
+    }
+    else
+    {
+        NX_CRYPTO_EC_POINT_INITIALIZE(&negative_g, NX_CRYPTO_EC_POINT_AFFINE, scratch, buffer_size);
+        NX_CRYPTO_HUGE_NUMBER_COPY(&negative_g.nx_crypto_ec_point_x, &g -> nx_crypto_ec_point_x);
+        NX_CRYPTO_HUGE_NUMBER_COPY(&negative_g.nx_crypto_ec_point_y, &curve -> nx_crypto_ec_field.fp);
+        _nx_crypto_ec_subtract_reduce(curve, &negative_g.nx_crypto_ec_point_y,
+                                      &g -> nx_crypto_ec_point_y, scratch);
+
+        if (!_nx_crypto_huge_number_is_zero(d))
+        {
+            naf_d = scratch;
+            _nx_crypto_ec_naf_compute(d, naf_d, &naf_size);
+            scratch += naf_size + 1;
+            d_steps = naf_size * (HN_SHIFT >> 1);
+        }
+    }
+
+    /* Process the digits of both factors from the most significant one. */
+    for (i = (INT)((d_steps > e_steps) ? d_steps : e_steps) - 1; i >= 0; i--)
+    {
+        _nx_crypto_ec_fp_projective_double(curve, &projective_point, scratch);
+
+        if ((UINT)i < e_steps)
+        {
+            if (((UINT)i & (HN_SHIFT - 1)) == (HN_SHIFT - 1))
+            {
+                carry = wnaf_state[(UINT)i >> (HN_SIZE_SHIFT + 3)] & 1;
+                skip = (UINT)(wnaf_state[(UINT)i >> (HN_SIZE_SHIFT + 3)] >> 1);
+                _nx_crypto_ec_wnaf_compute(e, (UINT)i >> (HN_SIZE_SHIFT + 3), &carry, &skip, wnaf_data);
+            }
+
+            digit = wnaf_data[(UINT)i & (HN_SHIFT - 1)];
+            if (digit > 0)
+            {
+                _nx_crypto_ec_fp_projective_add(curve, &projective_point, &table[digit >> 1], scratch);
+            }
+            else if (digit < 0)
+            {
+
+                /* P - T = -(-P + T), so that no negated table entries are needed. */
+                _nx_crypto_huge_number_subtract_unsigned(p, &projective_point.nx_crypto_ec_point_y,
+                                                         &projective_point.nx_crypto_ec_point_y);
+                _nx_crypto_ec_fp_projective_add(curve, &projective_point, &table[(-digit) >> 1], scratch);
+                _nx_crypto_huge_number_subtract_unsigned(p, &projective_point.nx_crypto_ec_point_y,
+                                                         &projective_point.nx_crypto_ec_point_y);
+            }
+        }
+
+        if ((UINT)i >= d_steps)
+        {
+            continue;
+        }
+
+        if (fixed_points == NX_CRYPTO_NULL)
+        {
+            value = (naf_d[(UINT)i / (HN_SHIFT >> 1)] >> (((UINT)i & ((HN_SHIFT >> 1) - 1)) << 1)) & 3;
+
+            if (value == 1)
+            {
+                _nx_crypto_ec_fp_projective_add(curve, &projective_point, g, scratch);
+            }
+            else if (value == 3)
+            {
+                _nx_crypto_ec_fp_projective_add(curve, &projective_point, &negative_g, scratch);
+            }
+            continue;
+        }
+
+        transpose_d = 0;
+        bit_index = (UINT)i;
+        for (j = 0; j < fixed_points -> nx_crypto_ec_fixed_points_window_width; j++)
+        {
+            value = expanded_d.nx_crypto_huge_number_data[bit_index >> (HN_SIZE_SHIFT + 3)];
+            transpose_d |= (((value >> (bit_index & (NX_CRYPTO_HUGE_NUMBER_BITS - 1))) & 1) << j);
+            bit_index += fixed_points -> nx_crypto_ec_fixed_points_d;
+        }
+
+        if (transpose_d == 1)
+        {
+            _nx_crypto_ec_fp_projective_add(curve, &projective_point, g, scratch);
+        }
+        else if (transpose_d > 0)
+        {
+            _nx_crypto_ec_fp_projective_add(curve, &projective_point,
+                                            &fixed_points -> nx_crypto_ec_fixed_points_array[transpose_d - 2],
+                                            scratch);
+        }
+        if ((fixed_points -> nx_crypto_ec_fixed_points_d & 1) &&
+            (i == (INT)(fixed_points -> nx_crypto_ec_fixed_points_e - 1)))
+        {
+            continue;
+        }
+
+        transpose_d = 0;
+        bit_index = (UINT)(i + (INT)fixed_points -> nx_crypto_ec_fixed_points_e);
+        for (j = 0; j < fixed_points -> nx_crypto_ec_fixed_points_window_width; j++)
+        {
+            value = expanded_d.nx_crypto_huge_number_data[bit_index >> (HN_SIZE_SHIFT + 3)];
+            transpose_d |= (((value >> (bit_index & (NX_CRYPTO_HUGE_NUMBER_BITS - 1))) & 1) << j);
+            bit_index += fixed_points -> nx_crypto_ec_fixed_points_d;
+        }
+
+        if (transpose_d > 0)
+        {
+            _nx_crypto_ec_fp_projective_add(curve, &projective_point,
+                                            &fixed_points -> nx_crypto_ec_fixed_points_array_2e[transpose_d - 1],
+                                            scratch);
+        }
+    }
+
+    _nx_crypto_ec_point_fp_projective_to_affine(curve, &projective_point, scratch);
+    NX_CRYPTO_HUGE_NUMBER_COPY(&r -> nx_crypto_ec_point_x,
+                               &projective_point.nx_crypto_ec_point_x);
+    NX_CRYPTO_HUGE_NUMBER_COPY(&r -> nx_crypto_ec_point_y,
+                               &projective_point.nx_crypto_ec_point_y);
+}
+
 /* nist.fips.186-4 APPENDIX B.4.1 */
 /**************************************************************************/
 /*                                                                        */
@@ -3576,7 +4209,7 @@ const CHAR                *array_name[] = {"", "_2e"};
             array_size = (1u << window_width) - 1;
             points = fixed_points -> nx_crypto_ec_fixed_points_array_2e;
         }
-        output("static NX_CRYPTO_CONST HN_UBASE %s_fixed_points%s_data[][%u >> HN_SIZE_SHIFT] =%s",
+        output("static NX_CRYPTO_CONST HN_UBASE           %s_fixed_points%s_data[][%u >> HN_SIZE_SHIFT] =%s",
                curve -> nx_crypto_ec_name,
                array_name[array_index],
                curve -> nx_crypto_ec_g.nx_crypto_ec_point_x.nx_crypto_huge_buffer_size,
@@ -3623,21 +4256,31 @@ const CHAR                *array_name[] = {"", "_2e"};
 
                     if (k != ((value -> nx_crypto_huge_buffer_size) >> HN_SIZE_SHIFT) - 1)
                     {
-                        output(", ");
+                        output(",");
                     }
                     if (((k + 1) & 0x1) == 0)
                     {
                         output("%s", line_ending);
                     }
+                    else if (k != ((value -> nx_crypto_huge_buffer_size) >> HN_SIZE_SHIFT) - 1)
+                    {
+                        output(" ");
+                    }
+                }
+
+                /* End the last line if it holds a single word. */
+                if (k & 0x1)
+                {
+                    output("%s", line_ending);
                 }
 
                 if ((j == 1) && (i == (array_size - 1)))
                 {
-                    output("%s%s}%s", line_ending, tab, line_ending);
+                    output("%s}%s", tab, line_ending);
                 }
                 else
                 {
-                    output("%s%s},%s", line_ending, tab, line_ending);
+                    output("%s},%s", tab, line_ending);
                 }
             }
         }
@@ -0,0 +1,1070 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Crypto Component                                                 */
+/**                                                                       */
+/**   Elliptical Curve Cryptography                                       */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#include "nx_crypto_ec.h"
+
+#ifdef NX_CRYPTO_EC_SECP256R1_FIELD_ENABLE
+
+/* Field elements of secp256r1 are 8 words of 32 bits, least significant first,
+   fully reduced modulo p = 2^256 - 2^224 + 2^192 + 2^96 - 1. */
+static NX_CRYPTO_CONST HN_UBASE _nx_crypto_ec_secp256r1_field_p[NX_CRYPTO_EC_SECP256R1_FIELD_SIZE] =
+{
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x00000000,
+    0x00000000, 0x00000000, 0x00000001, 0xFFFFFFFF
+};
+
+/* Column-wise multiplication. The sum of a column is kept in acc and its
+   carries beyond 64 bits in hi. */
+#define NX_CRYPTO_EC_SECP256R1_MULTIPLY_ADD(i, j) \
+    product = (HN_UBASE2)a[i] * b[j];             \
+    acc += product;                               \
+    hi += (HN_UBASE)(acc < product);
+
+#define NX_CRYPTO_EC_SECP256R1_MULTIPLY_ADD2(i, j) \
+    product = (HN_UBASE2)a[i] * a[j];              \
+    acc += product;                                \
+    hi += (HN_UBASE)(acc < product);               \
+    acc += product;                                \
+    hi += (HN_UBASE)(acc < product);
+
+#define NX_CRYPTO_EC_SECP256R1_COLUMN(k)                    \
+    t[k] = (HN_UBASE)acc;                                   \
+    acc = (acc >> HN_SHIFT) | ((HN_UBASE2)hi << HN_SHIFT);  \
+    hi = 0;
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_ec_secp256r1_field_reduce                PORTABLE C      */
+/*                                                           6.1          */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function reduces a 512-bit product modulo the secp256r1 prime  */
+/*    with the fast reduction of FIPS 186-4 D.2.3. The 16 words of the    */
+/*    product are combined into 8 words with signed carries, and the      */
+/*    final carry is folded back using                                    */
+/*    2 ^ 256 = 2 ^ 224 - 2 ^ 192 - 2 ^ 96 + 1 (mod p).                   */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    r                                     Reduced result                */
+/*    t                                     16-word product               */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_crypto_ec_secp256r1_field_multiply                              */
+/*                                          Multiply two field elements   */
+/*    _nx_crypto_ec_secp256r1_field_square                                */
+/*                                          Square a field element        */
+/*                                                                        */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP static VOID _nx_crypto_ec_secp256r1_field_reduce(HN_UBASE *r, HN_UBASE *t)
+{
+HN_BASE2 acc;
+HN_BASE2 carry;
+HN_UBASE diff[NX_CRYPTO_EC_SECP256R1_FIELD_SIZE];
+HN_UBASE2 borrow;
+UINT     i;
+
+    /* r = T + 2 * S1 + 2 * S2 + S3 + S4 - D1 - D2 - D3 - D4 */
+    acc = (HN_BASE2)t[0] + t[8] + t[9] - t[11] - t[12] - t[13] - t[14];
+    r[0] = (HN_UBASE)acc;
+    acc >>= HN_SHIFT;
+    acc += (HN_BASE2)t[1] + t[9] + t[10] - t[12] - t[13] - t[14] - t[15];
+    r[1] = (HN_UBASE)acc;
+    acc >>= HN_SHIFT;
+    acc += (HN_BASE2)t[2] + t[10] + t[11] - t[13] - t[14] - t[15];
+    r[2] = (HN_UBASE)acc;
+    acc >>= HN_SHIFT;
+    acc += (HN_BASE2)t[3] + 2 * (HN_BASE2)t[11] + 2 * (HN_BASE2)t[12] + t[13] - t[15] - t[8] - t[9];
+    r[3] = (HN_UBASE)acc;
+    acc >>= HN_SHIFT;
+    acc += (HN_BASE2)t[4] + 2 * (HN_BASE2)t[12] + 2 * (HN_BASE2)t[13] + t[14] - t[9] - t[10];
+    r[4] = (HN_UBASE)acc;
+    acc >>= HN_SHIFT;
+    acc += (HN_BASE2)t[5] + 2 * (HN_BASE2)t[13] + 2 * (HN_BASE2)t[14] + t[15] - t[10] - t[11];
+    r[5] = (HN_UBASE)acc;
+    acc >>= HN_SHIFT;
+    acc += (HN_BASE2)t[6] + 3 * (HN_BASE2)t[14] + 2 * (HN_BASE2)t[15] + t[13] - t[8] - t[9];
+    r[6] = (HN_UBASE)acc;
+    acc >>= HN_SHIFT;
+    acc += (HN_BASE2)t[7] + 3 * (HN_BASE2)t[15] + t[8] - t[10] - t[11] - t[12] - t[13];
+    r[7] = (HN_UBASE)acc;
+    carry = acc >> HN_SHIFT;
+
+    /* Fold the carry back until r fits in 256 bits. */
+    while (carry != 0)
+    {
+        acc = (HN_BASE2)r[0] + carry;
+        r[0] = (HN_UBASE)acc;
+        acc >>= HN_SHIFT;
+        acc += r[1];
+        r[1] = (HN_UBASE)acc;
+        acc >>= HN_SHIFT;
+        acc += r[2];
+        r[2] = (HN_UBASE)acc;
+        acc >>= HN_SHIFT;
+        acc += (HN_BASE2)r[3] - carry;
+        r[3] = (HN_UBASE)acc;
+        acc >>= HN_SHIFT;
+        acc += r[4];
+        r[4] = (HN_UBASE)acc;
+        acc >>= HN_SHIFT;
+        acc += r[5];
+        r[5] = (HN_UBASE)acc;
+        acc >>= HN_SHIFT;
+        acc += (HN_BASE2)r[6] - carry;
+        r[6] = (HN_UBASE)acc;
+        acc >>= HN_SHIFT;
+        acc += (HN_BASE2)r[7] + carry;
+        r[7] = (HN_UBASE)acc;
+        carry = acc >> HN_SHIFT;
+    }
+
+    /* r < 2 ^ 256 < 2 * p, so one subtraction is enough. */
+    borrow = 0;
+    for (i = 0; i < NX_CRYPTO_EC_SECP256R1_FIELD_SIZE; i++)
+    {
+        borrow = (HN_UBASE2)r[i] - _nx_crypto_ec_secp256r1_field_p[i] - borrow;
+        diff[i] = (HN_UBASE)borrow;
+        borrow = (borrow >> HN_SHIFT) & 1;
+    }
+    if (borrow == 0)
+    {
+        NX_CRYPTO_MEMCPY(r, diff, sizeof(diff)); /* Use case of memcpy is verified. */
+    }
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_ec_secp256r1_field_multiply              PORTABLE C      */
+/*                                                           6.1          */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function multiplies two field elements of secp256r1 with an    */
+/*    unrolled column-wise multiplication and reduces the product.        */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    r                                     Result, may alias a or b      */
+/*    a                                     First element                 */
+/*    b                                     Second element                */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_crypto_ec_secp256r1_field_reduce                                */
+/*                                          Reduce a product modulo p     */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_crypto_ec_secp256r1_field_inverse                               */
+/*                                          Invert a field element        */
+/*    _nx_crypto_ec_secp256r1_projective_double                           */
+/*                                          Perform doubling for points of*/
+/*                                            projective                  */
+/*    _nx_crypto_ec_secp256r1_projective_add                              */
+/*                                          Perform addition for points of*/
+/*                                            projective and affine       */
+/*    _nx_crypto_ec_secp256r1_projective_to_affine                        */
+/*                                          Convert point from projective */
+/*                                            to affine                   */
+/*                                                                        */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP VOID _nx_crypto_ec_secp256r1_field_multiply(HN_UBASE *r, HN_UBASE *a, HN_UBASE *b)
+{
+HN_UBASE  t[NX_CRYPTO_EC_SECP256R1_FIELD_SIZE << 1];
+HN_UBASE2 product;
+HN_UBASE2 acc = 0;
+HN_UBASE  hi = 0;
+
+    NX_CRYPTO_EC_SECP256R1_MULTIPLY_ADD(0, 0);
+    NX_CRYPTO_EC_SECP256R1_COLUMN(0);
+    NX_CRYPTO_EC_SECP256R1_MULTIPLY_ADD(0, 1); NX_CRYPTO_EC_SECP256R1_MULTIPLY_ADD(1, 0);
+    NX_CRYPTO_EC_SECP256R1_COLUMN(1);
+    NX_CRYPTO_EC_SECP256R1_MULTIPLY_ADD(0, 2); NX_CRYPTO_EC_SECP256R1_MULTIPLY_ADD(1, 1);
+    NX_CRYPTO_EC_SECP256R1_MULTIPLY_ADD(2, 0);
+    NX_CRYPTO_EC_SECP256R1_COLUMN(2);
+    NX_CRYPTO_EC_SECP256R1_MULTIPLY_ADD(0, 3); NX_CRYPTO_EC_SECP256R1_MULTIPLY_ADD(1, 2);
+    NX_CRYPTO_EC_SECP256R1_MULTIPLY_ADD(2, 1); NX_CRYPTO_EC_SECP256R1_MULTIPLY_ADD(3, 0);
+    NX_CRYPTO_EC_SECP256R1_COLUMN(3);
+    NX_CRYPTO_EC_SECP256R1_MULTIPLY_ADD(0, 4); NX_CRYPTO_EC_SECP256R1_MULTIPLY_ADD(1, 3);
+    NX_CRYPTO_EC_SECP256R1_MULTIPLY_ADD(2, 2); NX_CRYPTO_EC_SECP256R1_MULTIPLY_ADD(3, 1);
+    NX_CRYPTO_EC_SECP256R1_MULTIPLY_ADD(4, 0);
+    NX_CRYPTO_EC_SECP256R1_COLUMN(4);
+    NX_CRYPTO_EC_SECP256R1_MULTIPLY_ADD(0, 5); NX_CRYPTO_EC_SECP256R1_MULTIPLY_ADD(1, 4);
+    NX_CRYPTO_EC_SECP256R1_MULTIPLY_ADD(2, 3); NX_CRYPTO_EC_SECP256R1_MULTIPLY_ADD(3, 2);
+    NX_CRYPTO_EC_SECP256R1_MULTIPLY_ADD(4, 1); NX_CRYPTO_EC_SECP256R1_MULTIPLY_ADD(5, 0);
+    NX_CRYPTO_EC_SECP256R1_COLUMN(5);
+    NX_CRYPTO_EC_SECP256R1_MULTIPLY_ADD(0, 6); NX_CRYPTO_EC_SECP256R1_MULTIPLY_ADD(1, 5);
+    NX_CRYPTO_EC_SECP256R1_MULTIPLY_ADD(2, 4); NX_CRYPTO_EC_SECP256R1_MULTIPLY_ADD(3, 3);
+    NX_CRYPTO_EC_SECP256R1_MULTIPLY_ADD(4, 2); NX_CRYPTO_EC_SECP256R1_MULTIPLY_ADD(5, 1);
+    NX_CRYPTO_EC_SECP256R1_MULTIPLY_ADD(6, 0);
+    NX_CRYPTO_EC_SECP256R1_COLUMN(6);
+    NX_CRYPTO_EC_SECP256R1_MULTIPLY_ADD(0, 7); NX_CRYPTO_EC_SECP256R1_MULTIPLY_ADD(1, 6);
+    NX_CRYPTO_EC_SECP256R1_MULTIPLY_ADD(2, 5); NX_CRYPTO_EC_SECP256R1_MULTIPLY_ADD(3, 4);
+    NX_CRYPTO_EC_SECP256R1_MULTIPLY_ADD(4, 3); NX_CRYPTO_EC_SECP256R1_MULTIPLY_ADD(5, 2);
+    NX_CRYPTO_EC_SECP256R1_MULTIPLY_ADD(6, 1); NX_CRYPTO_EC_SECP256R1_MULTIPLY_ADD(7, 0);
+    NX_CRYPTO_EC_SECP256R1_COLUMN(7);
+    NX_CRYPTO_EC_SECP256R1_MULTIPLY_ADD(1, 7); NX_CRYPTO_EC_SECP256R1_MULTIPLY_ADD(2, 6);
+    NX_CRYPTO_EC_SECP256R1_MULTIPLY_ADD(3, 5); NX_CRYPTO_EC_SECP256R1_MULTIPLY_ADD(4, 4);
+    NX_CRYPTO_EC_SECP256R1_MULTIPLY_ADD(5, 3); NX_CRYPTO_EC_SECP256R1_MULTIPLY_ADD(6, 2);
+    NX_CRYPTO_EC_SECP256R1_MULTIPLY_ADD(7, 1);
+    NX_CRYPTO_EC_SECP256R1_COLUMN(8);
+    NX_CRYPTO_EC_SECP256R1_MULTIPLY_ADD(2, 7); NX_CRYPTO_EC_SECP256R1_MULTIPLY_ADD(3, 6);
+    NX_CRYPTO_EC_SECP256R1_MULTIPLY_ADD(4, 5); NX_CRYPTO_EC_SECP256R1_MULTIPLY_ADD(5, 4);
+    NX_CRYPTO_EC_SECP256R1_MULTIPLY_ADD(6, 3); NX_CRYPTO_EC_SECP256R1_MULTIPLY_ADD(7, 2);
+    NX_CRYPTO_EC_SECP256R1_COLUMN(9);
+    NX_CRYPTO_EC_SECP256R1_MULTIPLY_ADD(3, 7); NX_CRYPTO_EC_SECP256R1_MULTIPLY_ADD(4, 6);
+    NX_CRYPTO_EC_SECP256R1_MULTIPLY_ADD(5, 5); NX_CRYPTO_EC_SECP256R1_MULTIPLY_ADD(6, 4);
+    NX_CRYPTO_EC_SECP256R1_MULTIPLY_ADD(7, 3);
+    NX_CRYPTO_EC_SECP256R1_COLUMN(10);
+    NX_CRYPTO_EC_SECP256R1_MULTIPLY_ADD(4, 7); NX_CRYPTO_EC_SECP256R1_MULTIPLY_ADD(5, 6);
+    NX_CRYPTO_EC_SECP256R1_MULTIPLY_ADD(6, 5); NX_CRYPTO_EC_SECP256R1_MULTIPLY_ADD(7, 4);
+    NX_CRYPTO_EC_SECP256R1_COLUMN(11);
+    NX_CRYPTO_EC_SECP256R1_MULTIPLY_ADD(5, 7); NX_CRYPTO_EC_SECP256R1_MULTIPLY_ADD(6, 6);
+    NX_CRYPTO_EC_SECP256R1_MULTIPLY_ADD(7, 5);
+    NX_CRYPTO_EC_SECP256R1_COLUMN(12);
+    NX_CRYPTO_EC_SECP256R1_MULTIPLY_ADD(6, 7); NX_CRYPTO_EC_SECP256R1_MULTIPLY_ADD(7, 6);
+    NX_CRYPTO_EC_SECP256R1_COLUMN(13);
+    NX_CRYPTO_EC_SECP256R1_MULTIPLY_ADD(7, 7);
+    NX_CRYPTO_EC_SECP256R1_COLUMN(14);
+    t[15] = (HN_UBASE)acc;
+
+    _nx_crypto_ec_secp256r1_field_reduce(r, t);
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_ec_secp256r1_field_square                PORTABLE C      */
+/*                                                           6.1          */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function squares a field element of secp256r1. The products of */
+/*    different words are computed once and doubled.                      */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    r                                     Result, may alias a           */
+/*    a                                     Element                       */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_crypto_ec_secp256r1_field_reduce                                */
+/*                                          Reduce a product modulo p     */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_crypto_ec_secp256r1_field_inverse                               */
+/*                                          Invert a field element        */
+/*    _nx_crypto_ec_secp256r1_projective_double                           */
+/*                                          Perform doubling for points of*/
+/*                                            projective                  */
+/*    _nx_crypto_ec_secp256r1_projective_add                              */
+/*                                          Perform addition for points of*/
+/*                                            projective and affine       */
+/*    _nx_crypto_ec_secp256r1_projective_to_affine                        */
+/*                                          Convert point from projective */
+/*                                            to affine                   */
+/*                                                                        */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP VOID _nx_crypto_ec_secp256r1_field_square(HN_UBASE *r, HN_UBASE *a)
+{
+HN_UBASE  t[NX_CRYPTO_EC_SECP256R1_FIELD_SIZE << 1];
+HN_UBASE *b = a;
+HN_UBASE2 product;
+HN_UBASE2 acc = 0;
+HN_UBASE  hi = 0;
+
+    NX_CRYPTO_EC_SECP256R1_MULTIPLY_ADD(0, 0);
+    NX_CRYPTO_EC_SECP256R1_COLUMN(0);
+    NX_CRYPTO_EC_SECP256R1_MULTIPLY_ADD2(0, 1);
+    NX_CRYPTO_EC_SECP256R1_COLUMN(1);
+    NX_CRYPTO_EC_SECP256R1_MULTIPLY_ADD2(0, 2); NX_CRYPTO_EC_SECP256R1_MULTIPLY_ADD(1, 1);
+    NX_CRYPTO_EC_SECP256R1_COLUMN(2);
+    NX_CRYPTO_EC_SECP256R1_MULTIPLY_ADD2(0, 3); NX_CRYPTO_EC_SECP256R1_MULTIPLY_ADD2(1, 2);
+    NX_CRYPTO_EC_SECP256R1_COLUMN(3);
+    NX_CRYPTO_EC_SECP256R1_MULTIPLY_ADD2(0, 4); NX_CRYPTO_EC_SECP256R1_MULTIPLY_ADD2(1, 3);
+    NX_CRYPTO_EC_SECP256R1_MULTIPLY_ADD(2, 2);
+    NX_CRYPTO_EC_SECP256R1_COLUMN(4);
+    NX_CRYPTO_EC_SECP256R1_MULTIPLY_ADD2(0, 5); NX_CRYPTO_EC_SECP256R1_MULTIPLY_ADD2(1, 4);
+    NX_CRYPTO_EC_SECP256R1_MULTIPLY_ADD2(2, 3);
+    NX_CRYPTO_EC_SECP256R1_COLUMN(5);
+    NX_CRYPTO_EC_SECP256R1_MULTIPLY_ADD2(0, 6); NX_CRYPTO_EC_SECP256R1_MULTIPLY_ADD2(1, 5);
+    NX_CRYPTO_EC_SECP256R1_MULTIPLY_ADD2(2, 4); NX_CRYPTO_EC_SECP256R1_MULTIPLY_ADD(3, 3);
+    NX_CRYPTO_EC_SECP256R1_COLUMN(6);
+    NX_CRYPTO_EC_SECP256R1_MULTIPLY_ADD2(0, 7); NX_CRYPTO_EC_SECP256R1_MULTIPLY_ADD2(1, 6);
+    NX_CRYPTO_EC_SECP256R1_MULTIPLY_ADD2(2, 5); NX_CRYPTO_EC_SECP256R1_MULTIPLY_ADD2(3, 4);
+    NX_CRYPTO_EC_SECP256R1_COLUMN(7);
+    NX_CRYPTO_EC_SECP256R1_MULTIPLY_ADD2(1, 7); NX_CRYPTO_EC_SECP256R1_MULTIPLY_ADD2(2, 6);
+    NX_CRYPTO_EC_SECP256R1_MULTIPLY_ADD2(3, 5); NX_CRYPTO_EC_SECP256R1_MULTIPLY_ADD(4, 4);
+    NX_CRYPTO_EC_SECP256R1_COLUMN(8);
+    NX_CRYPTO_EC_SECP256R1_MULTIPLY_ADD2(2, 7); NX_CRYPTO_EC_SECP256R1_MULTIPLY_ADD2(3, 6);
+    NX_CRYPTO_EC_SECP256R1_MULTIPLY_ADD2(4, 5);
+    NX_CRYPTO_EC_SECP256R1_COLUMN(9);
+    NX_CRYPTO_EC_SECP256R1_MULTIPLY_ADD2(3, 7); NX_CRYPTO_EC_SECP256R1_MULTIPLY_ADD2(4, 6);
+    NX_CRYPTO_EC_SECP256R1_MULTIPLY_ADD(5, 5);
+    NX_CRYPTO_EC_SECP256R1_COLUMN(10);
+    NX_CRYPTO_EC_SECP256R1_MULTIPLY_ADD2(4, 7); NX_CRYPTO_EC_SECP256R1_MULTIPLY_ADD2(5, 6);
+    NX_CRYPTO_EC_SECP256R1_COLUMN(11);
+    NX_CRYPTO_EC_SECP256R1_MULTIPLY_ADD2(5, 7); NX_CRYPTO_EC_SECP256R1_MULTIPLY_ADD(6, 6);
+    NX_CRYPTO_EC_SECP256R1_COLUMN(12);
+    NX_CRYPTO_EC_SECP256R1_MULTIPLY_ADD2(6, 7);
+    NX_CRYPTO_EC_SECP256R1_COLUMN(13);
+    NX_CRYPTO_EC_SECP256R1_MULTIPLY_ADD(7, 7);
+    NX_CRYPTO_EC_SECP256R1_COLUMN(14);
+    t[15] = (HN_UBASE)acc;
+
+    _nx_crypto_ec_secp256r1_field_reduce(r, t);
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_ec_secp256r1_field_add                   PORTABLE C      */
+/*                                                           6.1          */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function adds two field elements of secp256r1.                 */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    r                                     Result, may alias a or b      */
+/*    a                                     First element                 */
+/*    b                                     Second element                */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_crypto_ec_secp256r1_projective_double                           */
+/*                                          Perform doubling for points of*/
+/*                                            projective                  */
+/*    _nx_crypto_ec_secp256r1_projective_add                              */
+/*                                          Perform addition for points of*/
+/*                                            projective and affine       */
+/*                                                                        */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP VOID _nx_crypto_ec_secp256r1_field_add(HN_UBASE *r, HN_UBASE *a, HN_UBASE *b)
+{
+HN_UBASE  diff[NX_CRYPTO_EC_SECP256R1_FIELD_SIZE];
+HN_UBASE2 carry = 0;
+HN_UBASE2 borrow = 0;
+UINT      i;
+
+    for (i = 0; i < NX_CRYPTO_EC_SECP256R1_FIELD_SIZE; i++)
+    {
+        carry = (HN_UBASE2)a[i] + b[i] + carry;
+        r[i] = (HN_UBASE)carry;
+        carry >>= HN_SHIFT;
+    }
+
+    for (i = 0; i < NX_CRYPTO_EC_SECP256R1_FIELD_SIZE; i++)
+    {
+        borrow = (HN_UBASE2)r[i] - _nx_crypto_ec_secp256r1_field_p[i] - borrow;
+        diff[i] = (HN_UBASE)borrow;
+        borrow = (borrow >> HN_SHIFT) & 1;
+    }
+
+    /* Subtract p if the sum is at least p. */
+    if (carry || (borrow == 0))
+    {
+        NX_CRYPTO_MEMCPY(r, diff, sizeof(diff)); /* Use case of memcpy is verified. */
+    }
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_ec_secp256r1_field_subtract              PORTABLE C      */
+/*                                                           6.1          */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function subtracts two field elements of secp256r1.            */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    r                                     Result, may alias a or b      */
+/*    a                                     First element                 */
+/*    b                                     Second element                */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_crypto_ec_secp256r1_projective_double                           */
+/*                                          Perform doubling for points of*/
+/*                                            projective                  */
+/*    _nx_crypto_ec_secp256r1_projective_add                              */
+/*                                          Perform addition for points of*/
+/*                                            projective and affine       */
+/*                                                                        */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP VOID _nx_crypto_ec_secp256r1_field_subtract(HN_UBASE *r, HN_UBASE *a, HN_UBASE *b)
+{
+HN_UBASE2 borrow = 0;
+HN_UBASE2 carry = 0;
+UINT      i;
+
+    for (i = 0; i < NX_CRYPTO_EC_SECP256R1_FIELD_SIZE; i++)
+    {
+        borrow = (HN_UBASE2)a[i] - b[i] - borrow;
+        r[i] = (HN_UBASE)borrow;
+        borrow = (borrow >> HN_SHIFT) & 1;
+    }
+
+    /* Add p back if the difference is negative. */
+    if (borrow)
+    {
+        for (i = 0; i < NX_CRYPTO_EC_SECP256R1_FIELD_SIZE; i++)
+        {
+            carry = (HN_UBASE2)r[i] + _nx_crypto_ec_secp256r1_field_p[i] + carry;
+            r[i] = (HN_UBASE)carry;
+            carry >>= HN_SHIFT;
+        }
+    }
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_ec_secp256r1_field_inverse               PORTABLE C      */
+/*                                                           6.1          */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function computes the inverse of a nonzero field element of    */
+/*    secp256r1 as a ^ (p - 2), with an addition chain of 255 squarings   */
+/*    and 12 multiplications.                                             */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    r                                     Result, may alias a           */
+/*    a                                     Element                       */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_crypto_ec_secp256r1_field_multiply                              */
+/*                                          Multiply two field elements   */
+/*    _nx_crypto_ec_secp256r1_field_square                                */
+/*                                          Square a field element        */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_crypto_ec_secp256r1_projective_to_affine                        */
+/*                                          Convert point from projective */
+/*                                            to affine                   */
+/*                                                                        */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP VOID _nx_crypto_ec_secp256r1_field_inverse(HN_UBASE *r, HN_UBASE *a)
+{
+HN_UBASE x2[NX_CRYPTO_EC_SECP256R1_FIELD_SIZE];
+HN_UBASE x3[NX_CRYPTO_EC_SECP256R1_FIELD_SIZE];
+HN_UBASE x15[NX_CRYPTO_EC_SECP256R1_FIELD_SIZE];
+HN_UBASE x30[NX_CRYPTO_EC_SECP256R1_FIELD_SIZE];
+HN_UBASE x32[NX_CRYPTO_EC_SECP256R1_FIELD_SIZE];
+HN_UBASE t[NX_CRYPTO_EC_SECP256R1_FIELD_SIZE];
+UINT     i;
+
+    /* xn = a ^ (2 ^ n - 1) */
+    _nx_crypto_ec_secp256r1_field_square(x2, a);
+    _nx_crypto_ec_secp256r1_field_multiply(x2, x2, a);
+    _nx_crypto_ec_secp256r1_field_square(x3, x2);
+    _nx_crypto_ec_secp256r1_field_multiply(x3, x3, a);
+
+    /* x6 and x12 are kept in t. */
+    _nx_crypto_ec_secp256r1_field_square(t, x3);
+    for (i = 1; i < 3; i++)
+    {
+        _nx_crypto_ec_secp256r1_field_square(t, t);
+    }
+    _nx_crypto_ec_secp256r1_field_multiply(t, t, x3);
+    _nx_crypto_ec_secp256r1_field_square(x15, t);
+    for (i = 1; i < 6; i++)
+    {
+        _nx_crypto_ec_secp256r1_field_square(x15, x15);
+    }
+    _nx_crypto_ec_secp256r1_field_multiply(x15, x15, t);
+    for (i = 0; i < 3; i++)
+    {
+        _nx_crypto_ec_secp256r1_field_square(x15, x15);
+    }
+    _nx_crypto_ec_secp256r1_field_multiply(x15, x15, x3);
+
+    _nx_crypto_ec_secp256r1_field_square(x30, x15);
+    for (i = 1; i < 15; i++)
+    {
+        _nx_crypto_ec_secp256r1_field_square(x30, x30);
+    }
+    _nx_crypto_ec_secp256r1_field_multiply(x30, x30, x15);
+    _nx_crypto_ec_secp256r1_field_square(x32, x30);
+    _nx_crypto_ec_secp256r1_field_square(x32, x32);
+    _nx_crypto_ec_secp256r1_field_multiply(x32, x32, x2);
+
+    /* p - 2 = FFFFFFFF 00000001 00000000 00000000 00000000 FFFFFFFF FFFFFFFF FFFFFFFD */
+    _nx_crypto_ec_secp256r1_field_square(t, x32);
+    for (i = 1; i < 32; i++)
+    {
+        _nx_crypto_ec_secp256r1_field_square(t, t);
+    }
+    _nx_crypto_ec_secp256r1_field_multiply(t, t, a);
+    for (i = 0; i < 128; i++)
+    {
+        _nx_crypto_ec_secp256r1_field_square(t, t);
+    }
+    _nx_crypto_ec_secp256r1_field_multiply(t, t, x32);
+    for (i = 0; i < 32; i++)
+    {
+        _nx_crypto_ec_secp256r1_field_square(t, t);
+    }
+    _nx_crypto_ec_secp256r1_field_multiply(t, t, x32);
+    for (i = 0; i < 30; i++)
+    {
+        _nx_crypto_ec_secp256r1_field_square(t, t);
+    }
+    _nx_crypto_ec_secp256r1_field_multiply(t, t, x30);
+    _nx_crypto_ec_secp256r1_field_square(t, t);
+    _nx_crypto_ec_secp256r1_field_square(t, t);
+    _nx_crypto_ec_secp256r1_field_multiply(r, t, a);
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_ec_secp256r1_field_load                  PORTABLE C      */
+/*                                                           6.1          */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function loads a huge number below p into a field element.     */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    r                                     Field element                 */
+/*    value                                 Huge number                   */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_crypto_ec_secp256r1_projective_add                              */
+/*                                          Perform addition for points of*/
+/*                                            projective and affine       */
+/*    _nx_crypto_ec_secp256r1_projective_double                           */
+/*                                          Perform doubling for points of*/
+/*                                            projective                  */
+/*    _nx_crypto_ec_secp256r1_projective_to_affine                        */
+/*                                          Convert point from projective */
+/*                                            to affine                   */
+/*                                                                        */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP static VOID _nx_crypto_ec_secp256r1_field_load(HN_UBASE *r, NX_CRYPTO_HUGE_NUMBER *value)
+{
+UINT i;
+
+    for (i = 0; i < NX_CRYPTO_EC_SECP256R1_FIELD_SIZE; i++)
+    {
+        if (i < value -> nx_crypto_huge_number_size)
+        {
+            r[i] = value -> nx_crypto_huge_number_data[i];
+        }
+        else
+        {
+            r[i] = 0;
+        }
+    }
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_ec_secp256r1_field_store                 PORTABLE C      */
+/*                                                           6.1          */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function stores a field element into a huge number.            */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    value                                 Huge number                   */
+/*    a                                     Field element                 */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_crypto_huge_number_adjust_size                                  */
+/*                                          Adjust the size of a huge     */
+/*                                            number to remove leading    */
+/*                                            zeroes                      */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_crypto_ec_secp256r1_projective_add                              */
+/*                                          Perform addition for points of*/
+/*                                            projective and affine       */
+/*    _nx_crypto_ec_secp256r1_projective_double                           */
+/*                                          Perform doubling for points of*/
+/*                                            projective                  */
+/*    _nx_crypto_ec_secp256r1_projective_to_affine                        */
+/*                                          Convert point from projective */
+/*                                            to affine                   */
+/*                                                                        */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP static VOID _nx_crypto_ec_secp256r1_field_store(NX_CRYPTO_HUGE_NUMBER *value, HN_UBASE *a)
+{
+    NX_CRYPTO_MEMCPY(value -> nx_crypto_huge_number_data, a,
+                     NX_CRYPTO_EC_SECP256R1_FIELD_SIZE << HN_SIZE_SHIFT); /* Use case of memcpy is verified. */
+    value -> nx_crypto_huge_number_size = NX_CRYPTO_EC_SECP256R1_FIELD_SIZE;
+    value -> nx_crypto_huge_number_is_negative = NX_CRYPTO_FALSE;
+    _nx_crypto_huge_number_adjust_size(value);
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_ec_secp256r1_field_is_zero               PORTABLE C      */
+/*                                                           6.1          */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function checks if a field element is zero.                    */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    a                                     Field element                 */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    NX_CRYPTO_TRUE                        Element is zero               */
+/*    NX_CRYPTO_FALSE                       Element is not zero           */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_crypto_ec_secp256r1_projective_add                              */
+/*                                          Perform addition for points of*/
+/*                                            projective and affine       */
+/*                                                                        */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP static UINT _nx_crypto_ec_secp256r1_field_is_zero(HN_UBASE *a)
+{
+HN_UBASE value = 0;
+UINT     i;
+
+    for (i = 0; i < NX_CRYPTO_EC_SECP256R1_FIELD_SIZE; i++)
+    {
+        value |= a[i];
+    }
+
+    if (value == 0)
+    {
+        return(NX_CRYPTO_TRUE);
+    }
+    return(NX_CRYPTO_FALSE);
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_ec_secp256r1_projective_double           PORTABLE C      */
+/*                                                           6.1          */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function performs doubling for point of projective coordinate  */
+/*    on secp256r1 with the field arithmetic of this file. The formulas   */
+/*    use a = -3 and cost 3 multiplications and 5 squarings.              */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    projective_point                      Point in projective coordinate*/
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_crypto_ec_secp256r1_field_add     Add two field elements        */
+/*    _nx_crypto_ec_secp256r1_field_subtract                              */
+/*                                          Subtract two field elements   */
+/*    _nx_crypto_ec_secp256r1_field_load                                  */
+/*                                          Load a field element          */
+/*    _nx_crypto_ec_secp256r1_field_multiply                              */
+/*                                          Multiply two field elements   */
+/*    _nx_crypto_ec_secp256r1_field_square                                */
+/*                                          Square a field element        */
+/*    _nx_crypto_ec_secp256r1_field_store                                 */
+/*                                          Store a field element         */
+/*    _nx_crypto_ec_point_is_infinite       Check if the point is infinite*/
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_crypto_ec_fp_projective_double                                  */
+/*                                          Perform doubling for points of*/
+/*                                            projective                  */
+/*    _nx_crypto_ec_secp256r1_projective_add                              */
+/*                                          Perform addition for points of*/
+/*                                            projective and affine       */
+/*                                                                        */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP VOID _nx_crypto_ec_secp256r1_projective_double(NX_CRYPTO_EC_POINT *projective_point)
+{
+HN_UBASE x[NX_CRYPTO_EC_SECP256R1_FIELD_SIZE];
+HN_UBASE y[NX_CRYPTO_EC_SECP256R1_FIELD_SIZE];
+HN_UBASE z[NX_CRYPTO_EC_SECP256R1_FIELD_SIZE];
+HN_UBASE delta[NX_CRYPTO_EC_SECP256R1_FIELD_SIZE];
+HN_UBASE gamma[NX_CRYPTO_EC_SECP256R1_FIELD_SIZE];
+HN_UBASE beta[NX_CRYPTO_EC_SECP256R1_FIELD_SIZE];
+HN_UBASE alpha[NX_CRYPTO_EC_SECP256R1_FIELD_SIZE];
+
+    /*
+        delta = Z1 ^ 2
+        gamma = Y1 ^ 2
+        beta = X1 * gamma
+        alpha = 3 * (X1 - delta) * (X1 + delta)
+        X3 = alpha ^ 2 - 8 * beta
+        Z3 = (Y1 + Z1) ^ 2 - gamma - delta
+        Y3 = alpha * (4 * beta - X3) - 8 * gamma ^ 2
+     */
+
+    if (_nx_crypto_ec_point_is_infinite(projective_point))
+    {
+        return;
+    }
+
+    _nx_crypto_ec_secp256r1_field_load(x, &projective_point -> nx_crypto_ec_point_x);
+    _nx_crypto_ec_secp256r1_field_load(y, &projective_point -> nx_crypto_ec_point_y);
+    _nx_crypto_ec_secp256r1_field_load(z, &projective_point -> nx_crypto_ec_point_z);
+
+    _nx_crypto_ec_secp256r1_field_square(delta, z);
+    _nx_crypto_ec_secp256r1_field_square(gamma, y);
+    _nx_crypto_ec_secp256r1_field_multiply(beta, x, gamma);
+
+    _nx_crypto_ec_secp256r1_field_subtract(alpha, x, delta);
+    _nx_crypto_ec_secp256r1_field_add(x, x, delta);
+    _nx_crypto_ec_secp256r1_field_multiply(alpha, alpha, x);
+    _nx_crypto_ec_secp256r1_field_add(x, alpha, alpha);
+    _nx_crypto_ec_secp256r1_field_add(alpha, alpha, x);
+
+    /* Z3 */
+    _nx_crypto_ec_secp256r1_field_add(z, y, z);
+    _nx_crypto_ec_secp256r1_field_square(z, z);
+    _nx_crypto_ec_secp256r1_field_subtract(z, z, gamma);
+    _nx_crypto_ec_secp256r1_field_subtract(z, z, delta);
+
+    /* X3, beta = 4 * beta */
+    _nx_crypto_ec_secp256r1_field_add(beta, beta, beta);
+    _nx_crypto_ec_secp256r1_field_add(beta, beta, beta);
+    _nx_crypto_ec_secp256r1_field_square(x, alpha);
+    _nx_crypto_ec_secp256r1_field_subtract(x, x, beta);
+    _nx_crypto_ec_secp256r1_field_subtract(x, x, beta);
+
+    /* Y3, gamma = 8 * gamma ^ 2 */
+    _nx_crypto_ec_secp256r1_field_square(gamma, gamma);
+    _nx_crypto_ec_secp256r1_field_add(gamma, gamma, gamma);
+    _nx_crypto_ec_secp256r1_field_add(gamma, gamma, gamma);
+    _nx_crypto_ec_secp256r1_field_add(gamma, gamma, gamma);
+    _nx_crypto_ec_secp256r1_field_subtract(y, beta, x);
+    _nx_crypto_ec_secp256r1_field_multiply(y, y, alpha);
+    _nx_crypto_ec_secp256r1_field_subtract(y, y, gamma);
+
+    _nx_crypto_ec_secp256r1_field_store(&projective_point -> nx_crypto_ec_point_x, x);
+    _nx_crypto_ec_secp256r1_field_store(&projective_point -> nx_crypto_ec_point_y, y);
+    _nx_crypto_ec_secp256r1_field_store(&projective_point -> nx_crypto_ec_point_z, z);
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_ec_secp256r1_projective_add              PORTABLE C      */
+/*                                                           6.1          */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function performs addition for points of projective and affine */
+/*    coordinates on secp256r1 with the field arithmetic of this file. The*/
+/*    formulas and special cases are the same as in                       */
+/*    _nx_crypto_ec_fp_projective_add.                                    */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    projective_point                      Point in projective coordinate*/
+/*    affine_point                          Point in affine coordinate    */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_crypto_ec_point_fp_affine_to_projective                         */
+/*                                          Convert point from affine to  */
+/*                                            projective                  */
+/*    _nx_crypto_ec_secp256r1_field_is_zero                               */
+/*                                          Check if element is zero      */
+/*    _nx_crypto_ec_secp256r1_field_load                                  */
+/*                                          Load a field element          */
+/*    _nx_crypto_ec_secp256r1_field_multiply                              */
+/*                                          Multiply two field elements   */
+/*    _nx_crypto_ec_secp256r1_projective_double                           */
+/*                                          Perform doubling for points of*/
+/*                                            projective                  */
+/*    _nx_crypto_ec_secp256r1_field_square                                */
+/*                                          Square a field element        */
+/*    _nx_crypto_ec_secp256r1_field_store                                 */
+/*                                          Store a field element         */
+/*    _nx_crypto_ec_secp256r1_field_subtract                              */
+/*                                          Subtract two field elements   */
+/*    _nx_crypto_ec_point_is_infinite       Check if the point is infinite*/
+/*    _nx_crypto_ec_point_set_infinite      Set the point to infinite     */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_crypto_ec_fp_projective_add       Perform addition for points of*/
+/*                                            projective and affine       */
+/*                                                                        */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP VOID _nx_crypto_ec_secp256r1_projective_add(NX_CRYPTO_EC_POINT *projective_point,
+                                                          NX_CRYPTO_EC_POINT *affine_point)
+{
+HN_UBASE x[NX_CRYPTO_EC_SECP256R1_FIELD_SIZE];
+HN_UBASE y[NX_CRYPTO_EC_SECP256R1_FIELD_SIZE];
+HN_UBASE z[NX_CRYPTO_EC_SECP256R1_FIELD_SIZE];
+HN_UBASE c[NX_CRYPTO_EC_SECP256R1_FIELD_SIZE];
+HN_UBASE d[NX_CRYPTO_EC_SECP256R1_FIELD_SIZE];
+HN_UBASE temp1[NX_CRYPTO_EC_SECP256R1_FIELD_SIZE];
+HN_UBASE temp2[NX_CRYPTO_EC_SECP256R1_FIELD_SIZE];
+
+    /*
+        A = X2 * Z1 ^ 2
+        B = Y2 * Z1 ^ 3
+        C = A - X1
+        D = B - Y1
+        X3 = D ^ 2 - (C ^ 3 + 2 * X1 * C ^ 2)
+        Y3 = D * (X1 * C ^ 2 - X3) - Y1 * C ^ 3
+        Z3 = Z1 * C
+     */
+
+    if (_nx_crypto_ec_point_is_infinite(projective_point))
+    {
+        NX_CRYPTO_HUGE_NUMBER_COPY(&projective_point -> nx_crypto_ec_point_x,
+                                   &affine_point -> nx_crypto_ec_point_x);
+        NX_CRYPTO_HUGE_NUMBER_COPY(&projective_point -> nx_crypto_ec_point_y,
+                                   &affine_point -> nx_crypto_ec_point_y);
+        _nx_crypto_ec_point_fp_affine_to_projective(projective_point);
+        return;
+    }
+
+    if (_nx_crypto_ec_point_is_infinite(affine_point))
+    {
+        return;
+    }
+
+    _nx_crypto_ec_secp256r1_field_load(x, &projective_point -> nx_crypto_ec_point_x);
+    _nx_crypto_ec_secp256r1_field_load(y, &projective_point -> nx_crypto_ec_point_y);
+    _nx_crypto_ec_secp256r1_field_load(z, &projective_point -> nx_crypto_ec_point_z);
+
+    /* C = X2 * Z1 ^ 2 - X1 */
+    _nx_crypto_ec_secp256r1_field_square(temp1, z);
+    _nx_crypto_ec_secp256r1_field_load(temp2, &affine_point -> nx_crypto_ec_point_x);
+    _nx_crypto_ec_secp256r1_field_multiply(c, temp2, temp1);
+    _nx_crypto_ec_secp256r1_field_subtract(c, c, x);
+
+    /* D = Y2 * Z1 ^ 3 - Y1 */
+    _nx_crypto_ec_secp256r1_field_multiply(temp1, temp1, z);
+    _nx_crypto_ec_secp256r1_field_load(temp2, &affine_point -> nx_crypto_ec_point_y);
+    _nx_crypto_ec_secp256r1_field_multiply(d, temp2, temp1);
+    _nx_crypto_ec_secp256r1_field_subtract(d, d, y);
+
+    /* The points are equal or opposite. */
+    if (_nx_crypto_ec_secp256r1_field_is_zero(c))
+    {
+        if (_nx_crypto_ec_secp256r1_field_is_zero(d))
+        {
+            _nx_crypto_ec_secp256r1_projective_double(projective_point);
+        }
+        else
+        {
+            _nx_crypto_ec_point_set_infinite(projective_point);
+        }
+        return;
+    }
+
+    /* Z3 = Z1 * C */
+    _nx_crypto_ec_secp256r1_field_multiply(z, z, c);
+
+    /* temp1 = C ^ 3, temp2 = X1 * C ^ 2 */
+    _nx_crypto_ec_secp256r1_field_square(temp2, c);
+    _nx_crypto_ec_secp256r1_field_multiply(temp1, temp2, c);
+    _nx_crypto_ec_secp256r1_field_multiply(temp2, temp2, x);
+
+    /* X3 = D ^ 2 - C ^ 3 - 2 * X1 * C ^ 2 */
+    _nx_crypto_ec_secp256r1_field_square(x, d);
+    _nx_crypto_ec_secp256r1_field_subtract(x, x, temp1);
+    _nx_crypto_ec_secp256r1_field_subtract(x, x, temp2);
+    _nx_crypto_ec_secp256r1_field_subtract(x, x, temp2);
+
+    /* Y3 = D * (X1 * C ^ 2 - X3) - Y1 * C ^ 3 */
+    _nx_crypto_ec_secp256r1_field_subtract(temp2, temp2, x);
+    _nx_crypto_ec_secp256r1_field_multiply(temp2, temp2, d);
+    _nx_crypto_ec_secp256r1_field_multiply(y, y, temp1);
+    _nx_crypto_ec_secp256r1_field_subtract(y, temp2, y);
+
+    _nx_crypto_ec_secp256r1_field_store(&projective_point -> nx_crypto_ec_point_x, x);
+    _nx_crypto_ec_secp256r1_field_store(&projective_point -> nx_crypto_ec_point_y, y);
+    _nx_crypto_ec_secp256r1_field_store(&projective_point -> nx_crypto_ec_point_z, z);
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_ec_secp256r1_projective_to_affine        PORTABLE C      */
+/*                                                           6.1          */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function converts point from projective coordinate to affine   */
+/*    coordinate on secp256r1 with the field arithmetic of this file.     */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    point                                 Pointer to point              */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_crypto_ec_secp256r1_field_inverse                               */
+/*                                          Invert a field element        */
+/*    _nx_crypto_ec_secp256r1_field_load                                  */
+/*                                          Load a field element          */
+/*    _nx_crypto_ec_secp256r1_field_multiply                              */
+/*                                          Multiply two field elements   */
+/*    _nx_crypto_ec_secp256r1_field_square                                */
+/*                                          Square a field element        */
+/*    _nx_crypto_ec_secp256r1_field_store                                 */
+/*                                          Store a field element         */
+/*    _nx_crypto_ec_point_is_infinite       Check if the point is infinite*/
+/*    _nx_crypto_ec_point_set_infinite      Set the point to infinite     */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_crypto_ec_point_fp_projective_to_affine                         */
+/*                                          Convert point from projective */
+/*                                            to affine                   */
+/*                                                                        */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP VOID _nx_crypto_ec_secp256r1_projective_to_affine(NX_CRYPTO_EC_POINT *point)
+{
+HN_UBASE x[NX_CRYPTO_EC_SECP256R1_FIELD_SIZE];
+HN_UBASE y[NX_CRYPTO_EC_SECP256R1_FIELD_SIZE];
+HN_UBASE zi[NX_CRYPTO_EC_SECP256R1_FIELD_SIZE];
+HN_UBASE temp[NX_CRYPTO_EC_SECP256R1_FIELD_SIZE];
+
+    if (_nx_crypto_ec_point_is_infinite(point))
+    {
+        point -> nx_crypto_ec_point_type = NX_CRYPTO_EC_POINT_AFFINE;
+        _nx_crypto_ec_point_set_infinite(point);
+        return;
+    }
+
+    _nx_crypto_ec_secp256r1_field_load(x, &point -> nx_crypto_ec_point_x);
+    _nx_crypto_ec_secp256r1_field_load(y, &point -> nx_crypto_ec_point_y);
+    _nx_crypto_ec_secp256r1_field_load(temp, &point -> nx_crypto_ec_point_z);
+
+    /* X = X * Z ^ -2, Y = Y * Z ^ -3 */
+    _nx_crypto_ec_secp256r1_field_inverse(zi, temp);
+    _nx_crypto_ec_secp256r1_field_square(temp, zi);
+    _nx_crypto_ec_secp256r1_field_multiply(x, x, temp);
+    _nx_crypto_ec_secp256r1_field_multiply(temp, temp, zi);
+    _nx_crypto_ec_secp256r1_field_multiply(y, y, temp);
+
+    _nx_crypto_ec_secp256r1_field_store(&point -> nx_crypto_ec_point_x, x);
+    _nx_crypto_ec_secp256r1_field_store(&point -> nx_crypto_ec_point_y, y);
+}
+#endif /* NX_CRYPTO_EC_SECP256R1_FIELD_ENABLE */
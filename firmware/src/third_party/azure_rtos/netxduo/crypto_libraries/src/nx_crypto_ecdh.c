@@ -26,6 +26,7 @@
 /* Include necessary system files.  */
 
 #include "nx_crypto_ecdh.h"
+#include "nx_crypto_x25519.h"
 
 
 /**************************************************************************/
@@ -41,7 +42,8 @@
 /*  DESCRIPTION                                                           */
 /*                                                                        */
 /*    This function sets up a Elliptic-curve Diffie-Hellman context by    */
-/*    importing a local key pair.                                         */
+/*    importing a local key pair. For X25519 the private key is the raw   */
+/*    32-byte scalar.                                                     */
 /*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
@@ -90,6 +92,22 @@ NX_CRYPTO_HUGE_NUMBER private_key;
         return(NX_CRYPTO_SIZE_ERROR);
     }
 
+    if (curve -> nx_crypto_ec_id == NX_CRYPTO_EC_X25519)
+    {
+        if ((local_private_key_len != NX_CRYPTO_X25519_KEY_SIZE) ||
+            (local_public_key_len > NX_CRYPTO_X25519_KEY_SIZE))
+        {
+            return(NX_CRYPTO_SIZE_ERROR);
+        }
+
+        /* The scalar is stored as is; clamping happens in every scalar multiplication. */
+        ecdh_ptr -> nx_crypto_ecdh_key_size = NX_CRYPTO_X25519_KEY_SIZE;
+        NX_CRYPTO_MEMCPY(ecdh_ptr -> nx_crypto_ecdh_private_key_buffer, local_private_key_ptr,
+                         NX_CRYPTO_X25519_KEY_SIZE); /* Use case of memcpy is verified. */
+
+        return(NX_CRYPTO_SUCCESS);
+    }
+
     public_key_len = 1 + (((curve -> nx_crypto_ec_bits + 7) >> 3) << 1);
     if (local_public_key_len > public_key_len)
     {
@@ -184,6 +202,16 @@ NX_CRYPTO_HUGE_NUMBER private_key;
         return(NX_CRYPTO_SIZE_ERROR);
     }
 
+    if (curve -> nx_crypto_ec_id == NX_CRYPTO_EC_X25519)
+    {
+
+        /* X25519 private keys are byte strings, not big endian integers. */
+        NX_CRYPTO_MEMCPY(local_private_key_ptr, ecdh_ptr -> nx_crypto_ecdh_private_key_buffer, clen); /* Use case of memcpy is verified. */
+        *actual_local_private_key_len = clen;
+
+        return(NX_CRYPTO_SUCCESS);
+    }
+
     /* Private key buffer - note that no scratch is required for the private key, but we set it in case
        it is needed in the future. */
     private_key.nx_crypto_huge_number_data = (HN_UBASE *)ecdh_ptr -> nx_crypto_ecdh_private_key_buffer;
@@ -212,7 +240,8 @@ NX_CRYPTO_HUGE_NUMBER private_key;
 /*  DESCRIPTION                                                           */
 /*                                                                        */
 /*    This function sets up a Elliptic-curve Diffie-Hellman context by    */
-/*    generating a local key pair.                                        */
+/*    generating a local key pair. For X25519 the public key is the       */
+/*    32-byte u-coordinate without a format byte.                         */
 /*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
@@ -237,6 +266,8 @@ NX_CRYPTO_HUGE_NUMBER private_key;
 /*                                                                        */
 /*    _nx_crypto_ec_key_pair_generation_extra                             */
 /*                                          Generate EC Key Pair          */
+/*    _nx_crypto_x25519_base_multiply       Generate X25519 public key    */
+/*    [NX_CRYPTO_RBG]                       Generate X25519 private key   */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -258,11 +289,41 @@ NX_CRYPTO_KEEP UINT _nx_crypto_ecdh_setup(NX_CRYPTO_ECDH  *ecdh_ptr,
                                           NX_CRYPTO_EC *curve,
                                           HN_UBASE *scratch_buf_ptr)
 {
+UINT status;
 UINT public_key_len;
 /* Actual huge numbers used in calculations */
 NX_CRYPTO_HUGE_NUMBER private_key;
 NX_CRYPTO_EC_POINT    public_key;
 
+    if (curve -> nx_crypto_ec_id == NX_CRYPTO_EC_X25519)
+    {
+        if (local_public_key_len < NX_CRYPTO_X25519_KEY_SIZE)
+        {
+            return(NX_CRYPTO_SIZE_ERROR);
+        }
+
+        ecdh_ptr -> nx_crypto_ecdh_curve = curve;
+        ecdh_ptr -> nx_crypto_ecdh_key_size = NX_CRYPTO_X25519_KEY_SIZE;
+
+        /* Any 32 random bytes are a valid private key, and the public key is the bare
+           u-coordinate of the private key times the base point. */
+        status = NX_CRYPTO_RBG(NX_CRYPTO_X25519_KEY_SIZE << 3, (UCHAR *)ecdh_ptr -> nx_crypto_ecdh_private_key_buffer);
+        if (status)
+        {
+            return(status);
+        }
+
+        status = _nx_crypto_x25519_base_multiply(local_public_key_ptr,
+                                                 (UCHAR *)ecdh_ptr -> nx_crypto_ecdh_private_key_buffer);
+        if (status)
+        {
+            return(status);
+        }
+        *actual_local_public_key_len = NX_CRYPTO_X25519_KEY_SIZE;
+
+        return(NX_CRYPTO_SUCCESS);
+    }
+
     public_key_len = 1 + (((curve -> nx_crypto_ec_bits + 7) >> 3) << 1);
     if (local_public_key_len < public_key_len)
     {
@@ -320,7 +381,9 @@ NX_CRYPTO_EC_POINT    public_key;
 /*                                                                        */
 /*    This function computes the Elliptic-curve Diffie-Hellman shared     */
 /*    secret using an existing Elliptic-curve Diffie-Hellman context      */
-/*    and a public key received from a remote entity.                     */
+/*    and a public key received from a remote entity. For X25519 the      */
+/*    remote public key is the 32-byte u-coordinate, and an all-zero      */
+/*    shared secret is rejected.                                          */
 /*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
@@ -345,6 +408,7 @@ NX_CRYPTO_EC_POINT    public_key;
 /*                                                                        */
 /*    _nx_crypto_huge_number_extract        Extract huge number           */
 /*    _nx_crypto_huge_number_setup          Setup huge number             */
+/*    _nx_crypto_x25519_scalar_multiply     Compute X25519 shared secret  */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -371,6 +435,8 @@ NX_CRYPTO_KEEP UINT _nx_crypto_ecdh_compute_secret(NX_CRYPTO_ECDH  *ecdh_ptr,
 UINT                  status;
 UINT                  key_size;
 UINT                  clen;
+UINT                  i;
+UCHAR                 nonzero;
 NX_CRYPTO_EC         *curve;
 /* Actual huge numbers used in calculations */
 NX_CRYPTO_HUGE_NUMBER private_key;
@@ -388,6 +454,38 @@ NX_CRYPTO_EC_POINT    public_key, shared_secret;
     /* Figure out the sizes of our keys and buffers. We need 4X the key size for our buffer space. */
     key_size = ecdh_ptr -> nx_crypto_ecdh_key_size;
 
+    if (curve -> nx_crypto_ec_id == NX_CRYPTO_EC_X25519)
+    {
+        if ((remote_public_key_len != NX_CRYPTO_X25519_KEY_SIZE) ||
+            (share_secret_key_len_ptr < NX_CRYPTO_X25519_KEY_SIZE))
+        {
+            return(NX_CRYPTO_SIZE_ERROR);
+        }
+
+        status = _nx_crypto_x25519_scalar_multiply(share_secret_key_ptr,
+                                                   (UCHAR *)ecdh_ptr -> nx_crypto_ecdh_private_key_buffer,
+                                                   remote_public_key);
+        if (status)
+        {
+            return(status);
+        }
+
+        /* A small-order remote public key forces an all-zero secret, which RFC 7748 section 6.1
+           requires us to reject. Check without an early exit. */
+        nonzero = 0;
+        for (i = 0; i < NX_CRYPTO_X25519_KEY_SIZE; i++)
+        {
+            nonzero |= share_secret_key_ptr[i];
+        }
+        if (nonzero == 0)
+        {
+            return(NX_CRYPTO_NOT_SUCCESSFUL);
+        }
+        *actual_share_secret_key_len = NX_CRYPTO_X25519_KEY_SIZE;
+
+        return(NX_CRYPTO_SUCCESS);
+    }
+
     /* Make sure the remote public key is small enough to fit into the huge number buffer. */
     if (remote_public_key_len > 1 + 2 * key_size)
     {
@@ -506,7 +604,7 @@ NX_CRYPTO_KEEP UINT  _nx_crypto_method_ecdh_init(struct  NX_CRYPTO_METHOD_STRUCT
     }
 
     /* Verify the metadata addrsss is 4-byte aligned. */
-    if((((ULONG)crypto_metadata) & 0x3) != 0)
+    if((((ALIGN_TYPE)crypto_metadata) & 0x3) != 0)
     {
         return(NX_CRYPTO_PTR_ERROR);
     }
@@ -656,7 +754,7 @@ NX_CRYPTO_EXTENDED_OUTPUT
     NX_CRYPTO_STATE_CHECK
 
     /* Verify the metadata addrsss is 4-byte aligned. */
-    if((method == NX_CRYPTO_NULL) || (crypto_metadata == NX_CRYPTO_NULL) || ((((ULONG)crypto_metadata) & 0x3) != 0))
+    if((method == NX_CRYPTO_NULL) || (crypto_metadata == NX_CRYPTO_NULL) || ((((ALIGN_TYPE)crypto_metadata) & 0x3) != 0))
     {
         return(NX_CRYPTO_PTR_ERROR);
     }
@@ -691,6 +789,33 @@ NX_CRYPTO_EXTENDED_OUTPUT
         }
 
         extended_output = (NX_CRYPTO_EXTENDED_OUTPUT *)output;
+        if (ecdh -> nx_crypto_ecdh_curve -> nx_crypto_ec_id == NX_CRYPTO_EC_X25519)
+        {
+
+            /* Output private_key || public_key, both 32 bytes. */
+            if (extended_output -> nx_crypto_extended_output_length_in_byte < (NX_CRYPTO_X25519_KEY_SIZE << 1))
+            {
+                return(NX_CRYPTO_SIZE_ERROR);
+            }
+
+            status = _nx_crypto_ecdh_setup(ecdh,
+                                           extended_output -> nx_crypto_extended_output_data + NX_CRYPTO_X25519_KEY_SIZE,
+                                           NX_CRYPTO_X25519_KEY_SIZE,
+                                           &extended_output -> nx_crypto_extended_output_actual_size,
+                                           ecdh -> nx_crypto_ecdh_curve,
+                                           ecdh -> nx_crypto_ecdh_scratch_buffer);
+            if (status)
+            {
+                return(status);
+            }
+
+            NX_CRYPTO_MEMCPY(extended_output -> nx_crypto_extended_output_data,
+                             ecdh -> nx_crypto_ecdh_private_key_buffer, NX_CRYPTO_X25519_KEY_SIZE); /* Use case of memcpy is verified. */
+            extended_output -> nx_crypto_extended_output_actual_size = NX_CRYPTO_X25519_KEY_SIZE << 1;
+
+            return(NX_CRYPTO_SUCCESS);
+        }
+
         status = _nx_crypto_ec_key_pair_stream_generate(ecdh -> nx_crypto_ecdh_curve,
                                                         extended_output -> nx_crypto_extended_output_data,
                                                         extended_output -> nx_crypto_extended_output_length_in_byte,
@@ -297,6 +297,8 @@ UCHAR                *signature_s;
 /*  CALLS                                                                 */
 /*                                                                        */
 /*    _nx_crypto_huge_number_setup          Generate private key          */
+/*    _nx_crypto_ec_fp_joint_multiple       Calculate the joint           */
+/*                                            multiplication              */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -373,7 +375,6 @@ UINT                  buffer_size = curve -> nx_crypto_ec_n.nx_crypto_huge_buffe
     NX_CRYPTO_HUGE_NUMBER_INITIALIZE(&u2, scratch, buffer_size << 1);
     NX_CRYPTO_EC_POINT_INITIALIZE(&pubkey, NX_CRYPTO_EC_POINT_AFFINE, scratch, buffer_size);
     NX_CRYPTO_EC_POINT_INITIALIZE(&pt, NX_CRYPTO_EC_POINT_AFFINE, scratch, buffer_size);
-    NX_CRYPTO_EC_POINT_INITIALIZE(&pt2, NX_CRYPTO_EC_POINT_AFFINE, scratch, buffer_size);
 
     /* Copy the public key from the caller's buffer. */
     status = _nx_crypto_ec_point_setup(&pubkey, public_key, public_key_length);
@@ -461,10 +462,20 @@ UINT                  buffer_size = curve -> nx_crypto_ec_n.nx_crypto_huge_buffe
     _nx_crypto_huge_number_modulus(&u2, &curve -> nx_crypto_ec_n);
 
     /* Calculate (x1,y1) = u1*G + u2*public_key */
-    curve -> nx_crypto_ec_multiple(curve, &curve -> nx_crypto_ec_g, &u1, &pt, scratch);
-    curve -> nx_crypto_ec_multiple(curve, &pubkey, &u2, &pt2, scratch);
+    if (curve -> nx_crypto_ec_multiple == _nx_crypto_ec_fp_projective_multiple)
+    {
+
+        /* Compute both products together so they share the point doublings. */
+        _nx_crypto_ec_fp_joint_multiple(curve, &curve -> nx_crypto_ec_g, &u1, &pubkey, &u2, &pt, scratch);
+    }
+    else
+    {
+        NX_CRYPTO_EC_POINT_INITIALIZE(&pt2, NX_CRYPTO_EC_POINT_AFFINE, scratch, buffer_size);
+        curve -> nx_crypto_ec_multiple(curve, &curve -> nx_crypto_ec_g, &u1, &pt, scratch);
+        curve -> nx_crypto_ec_multiple(curve, &pubkey, &u2, &pt2, scratch);
 
-    curve -> nx_crypto_ec_add(curve, &pt, &pt2, scratch);
+        curve -> nx_crypto_ec_add(curve, &pt, &pt2, scratch);
+    }
 
     _nx_crypto_huge_number_modulus(&pt.nx_crypto_ec_point_x, &curve -> nx_crypto_ec_n);
 
@@ -541,7 +552,7 @@ NX_CRYPTO_ECDSA *ecdsa;
     }
 
     /* Verify the metadata addrsss is 4-byte aligned. */
-    if((((ULONG)crypto_metadata) & 0x3) != 0)
+    if((((ALIGN_TYPE)crypto_metadata) & 0x3) != 0)
     {
         return(NX_CRYPTO_PTR_ERROR);
     }
@@ -699,7 +710,7 @@ UCHAR           *hash_output = NX_CRYPTO_NULL;
     NX_CRYPTO_STATE_CHECK
 
     /* Verify the metadata addrsss is 4-byte aligned. */
-    if((method == NX_CRYPTO_NULL) || (crypto_metadata == NX_CRYPTO_NULL) || ((((ULONG)crypto_metadata) & 0x3) != 0))
+    if((method == NX_CRYPTO_NULL) || (crypto_metadata == NX_CRYPTO_NULL) || ((((ALIGN_TYPE)crypto_metadata) & 0x3) != 0))
     {
         return(NX_CRYPTO_PTR_ERROR);
     }
@@ -53,7 +53,6 @@
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
-/*    _nx_crypto_gcm_multi                  Compute multilication in GF   */
 /*    _nx_crypto_gcm_ghash_update           Compute GHASH                 */
 /*    _nx_crypto_gcm_gctr                   Perform GCTR operation        */
 /*                                                                        */
@@ -157,6 +156,94 @@ USHORT result;
     counter_block[12] = (UCHAR)(result & 0xFF);
 }
 
+#ifndef NX_CRYPTO_GCM_ENABLE_CONSTANT_TIME
+/* Reduction of the four bits shifted out of a block, pre-multiplied by R. */
+static const USHORT _nx_crypto_gcm_last4[NX_CRYPTO_GCM_HTABLE_SIZE] =
+{
+    0x0000, 0x1c20, 0x3840, 0x2460, 0x7080, 0x6ca0, 0x48c0, 0x54e0,
+    0xe100, 0xfd20, 0xd940, 0xc560, 0x9180, 0x8da0, 0xa9c0, 0xb5e0
+};
+#endif
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_gcm_htable_init                          PORTABLE C      */
+/*                                                           6.1          */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function builds the 4-bit multiplication table of the hash     */
+/*    key. Entry i of the table holds i * H in GF(2^128), where the bits  */
+/*    of i are taken in the GCM bit order.                                */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    gcm_metadata                          Pointer to GCM metadata       */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_crypto_gcm_encrypt_init           Initialize GCM mode           */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP static VOID _nx_crypto_gcm_htable_init(NX_CRYPTO_GCM *gcm_metadata)
+{
+UCHAR *hkey = gcm_metadata -> nx_crypto_gcm_hkey;
+UINT (*htable)[NX_CRYPTO_GCM_BLOCK_SIZE_INT] = gcm_metadata -> nx_crypto_gcm_htable;
+UINT v[NX_CRYPTO_GCM_BLOCK_SIZE_INT];
+UINT i, j, k;
+UINT lsb;
+
+    /* Load H as big endian words. */
+    for (k = 0; k < NX_CRYPTO_GCM_BLOCK_SIZE_INT; k++)
+    {
+        v[k] = ((UINT)hkey[k << 2] << 24) | ((UINT)hkey[(k << 2) + 1] << 16) |
+               ((UINT)hkey[(k << 2) + 2] << 8) | (UINT)hkey[(k << 2) + 3];
+    }
+
+    /* 0 * H = 0, and the highest bit of the index is the coefficient of x^0. */
+    NX_CRYPTO_MEMSET(htable[0], 0, sizeof(htable[0]));
+    NX_CRYPTO_MEMCPY(htable[8], v, sizeof(v)); /* Use case of memcpy is verified. */
+
+    /* Entries 4, 2 and 1 are H * x, H * x^2 and H * x^3. */
+    for (i = 4; i > 0; i >>= 1)
+    {
+
+        /* v = v >> 1, xor R when LSB of v is set. */
+        lsb = v[3] & 1;
+        v[3] = (v[3] >> 1) | (v[2] << 31);
+        v[2] = (v[2] >> 1) | (v[1] << 31);
+        v[1] = (v[1] >> 1) | (v[0] << 31);
+        v[0] = (v[0] >> 1) ^ ((0 - lsb) & 0xe1000000);
+        NX_CRYPTO_MEMCPY(htable[i], v, sizeof(v)); /* Use case of memcpy is verified. */
+    }
+
+    /* The remaining entries are sums of the entries above. */
+    for (i = 2; i < NX_CRYPTO_GCM_HTABLE_SIZE; i <<= 1)
+    {
+        for (j = 1; j < i; j++)
+        {
+            for (k = 0; k < NX_CRYPTO_GCM_BLOCK_SIZE_INT; k++)
+            {
+                htable[i + j][k] = htable[i][k] ^ htable[j][k];
+            }
+        }
+    }
+
+#ifdef NX_SECURE_KEY_CLEAR
+    NX_CRYPTO_MEMSET(v, 0, sizeof(v));
+#endif
+}
+
 /**************************************************************************/
 /*                                                                        */
 /*  FUNCTION                                               RELEASE        */
@@ -169,12 +256,17 @@ USHORT result;
 /*                                                                        */
 /*  DESCRIPTION                                                           */
 /*                                                                        */
-/*    This function performs multiplication in GF(2^128).                 */
+/*    This function performs multiplication in GF(2^128) of a block by    */
+/*    the hash key, four bits at a time using the precomputed table.      */
+/*                                                                        */
+/*    When NX_CRYPTO_GCM_ENABLE_CONSTANT_TIME is defined, every table     */
+/*    entry is read for each nibble and the reduction is computed without */
+/*    a lookup, so the memory access pattern is independent of the data.  */
 /*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
+/*    htable                                Multiplication table of H     */
 /*    x                                     Pointer to X block            */
-/*    y                                     Pointer to Y block            */
 /*    output                                Pointer to result block       */
 /*                                                                        */
 /*  OUTPUT                                                                */
@@ -183,7 +275,7 @@ USHORT result;
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
-/*    _nx_crypto_gcm_xor                    Perform XOR operation         */
+/*    None                                                                */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -199,51 +291,78 @@ USHORT result;
 /*                                            resulting in version 6.1    */
 /*                                                                        */
 /**************************************************************************/
-NX_CRYPTO_KEEP static VOID _nx_crypto_gcm_multi(UCHAR *x, UCHAR *y, UCHAR *output)
+NX_CRYPTO_KEEP static VOID _nx_crypto_gcm_multi(UINT (*htable)[NX_CRYPTO_GCM_BLOCK_SIZE_INT],
+                                                UCHAR *x, UCHAR *output)
 {
-UINT i;
-INT j;
-UCHAR v[NX_CRYPTO_GCM_BLOCK_SIZE];
-UCHAR lsb;
-UCHAR mask;
+UINT z0, z1, z2, z3;
+UINT rem;
+UINT nibble;
+INT  i;
+#ifdef NX_CRYPTO_GCM_ENABLE_CONSTANT_TIME
+UINT j;
+UINT mask;
+#endif
 
-    NX_CRYPTO_MEMSET(output, 0, NX_CRYPTO_GCM_BLOCK_SIZE);
-    NX_CRYPTO_MEMCPY(v, y, NX_CRYPTO_GCM_BLOCK_SIZE); /* Use case of memcpy is verified. */
+    z0 = 0;
+    z1 = 0;
+    z2 = 0;
+    z3 = 0;
 
-    mask = 0x80;
-    for (i = 0; i < NX_CRYPTO_GCM_BLOCK_SIZE_BITS; i++)
+    /* Horner's rule from the last nibble of X to the first one:
+       Z = (Z * x^4) xor (nibble * H). */
+    for (i = (NX_CRYPTO_GCM_BLOCK_SIZE << 1) - 1; i >= 0; i--)
     {
+        nibble = (i & 1) ? (UINT)(x[i >> 1] & 0x0F) : (UINT)(x[i >> 1] >> 4);
+
+        /* Z = Z * x^4, reducing the four bits shifted out. */
+        rem = z3 & 0x0F;
+        z3 = (z3 >> 4) | (z2 << 28);
+        z2 = (z2 >> 4) | (z1 << 28);
+        z1 = (z1 >> 4) | (z0 << 28);
+        z0 = z0 >> 4;
+
+#ifndef NX_CRYPTO_GCM_ENABLE_CONSTANT_TIME
+        z0 ^= (UINT)_nx_crypto_gcm_last4[rem] << 16;
+
+        z0 ^= htable[nibble][0];
+        z1 ^= htable[nibble][1];
+        z2 ^= htable[nibble][2];
+        z3 ^= htable[nibble][3];
+#else
+        z0 ^= (((0 - (rem & 1)) & 0x1c20) ^
+               ((0 - ((rem >> 1) & 1)) & 0x3840) ^
+               ((0 - ((rem >> 2) & 1)) & 0x7080) ^
+               ((0 - ((rem >> 3) & 1)) & 0xe100)) << 16;
 
-        /* output = output xor v when the ith bit of x is set. */
-        if (*x & mask)
-        {
-            _nx_crypto_gcm_xor(output, v, output);
-        }
-
-        /* Store the LSB before shift right. */
-        j = NX_CRYPTO_GCM_BLOCK_SIZE - 1;
-        lsb = v[j];
-
-        /* v = v >> 1 */
-        for (; j > 0; j--)
-        {
-            v[j] = (UCHAR)((v[j] >> 1) | (v[j - 1] << 7));
-        }
-        v[0] = v[0] >> 1;
-
-        /* v = v xor R when LSB of v is set. */
-        if (lsb & 1)
+        for (j = 0; j < NX_CRYPTO_GCM_HTABLE_SIZE; j++)
         {
-            v[0] = v[0] ^ 0xe1;
-        }
 
-        mask = mask >> 1;
-        if (!mask)
-        {
-            mask = 0x80;
-            x++;
+            /* mask is all ones only when j equals the nibble. */
+            mask = 0 - (((j ^ nibble) - 1) >> 31);
+            z0 ^= htable[j][0] & mask;
+            z1 ^= htable[j][1] & mask;
+            z2 ^= htable[j][2] & mask;
+            z3 ^= htable[j][3] & mask;
         }
+#endif
     }
+
+    output[0] = (UCHAR)(z0 >> 24);
+    output[1] = (UCHAR)(z0 >> 16);
+    output[2] = (UCHAR)(z0 >> 8);
+    output[3] = (UCHAR)z0;
+    output[4] = (UCHAR)(z1 >> 24);
+    output[5] = (UCHAR)(z1 >> 16);
+    output[6] = (UCHAR)(z1 >> 8);
+    output[7] = (UCHAR)z1;
+    output[8] = (UCHAR)(z2 >> 24);
+    output[9] = (UCHAR)(z2 >> 16);
+    output[10] = (UCHAR)(z2 >> 8);
+    output[11] = (UCHAR)z2;
+    output[12] = (UCHAR)(z3 >> 24);
+    output[13] = (UCHAR)(z3 >> 16);
+    output[14] = (UCHAR)(z3 >> 8);
+    output[15] = (UCHAR)z3;
 }
 
 /**************************************************************************/
@@ -263,7 +382,7 @@ UCHAR mask;
 /*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
-/*    hkey                                  Pointer to hash key           */
+/*    htable                                Multiplication table of H     */
 /*    input                                 Pointer to bytes of input     */
 /*    input_length                          Length of bytes of input      */
 /*    output                                Pointer to updated hash       */
@@ -291,7 +410,8 @@ UCHAR mask;
 /*                                            resulting in version 6.1    */
 /*                                                                        */
 /**************************************************************************/
-NX_CRYPTO_KEEP static VOID _nx_crypto_gcm_ghash_update(UCHAR *hkey, UCHAR *input, UINT input_length, UCHAR *output)
+NX_CRYPTO_KEEP static VOID _nx_crypto_gcm_ghash_update(UINT (*htable)[NX_CRYPTO_GCM_BLOCK_SIZE_INT],
+                                                       UCHAR *input, UINT input_length, UCHAR *output)
 {
 UCHAR tmp_block[NX_CRYPTO_GCM_BLOCK_SIZE];
 UINT i, n;
@@ -302,7 +422,7 @@ UINT i, n;
 
         /* output = (output xor input) multi hkey */
         _nx_crypto_gcm_xor(output, input, tmp_block);
-        _nx_crypto_gcm_multi(tmp_block, hkey, output);
+        _nx_crypto_gcm_multi(htable, tmp_block, output);
         input += NX_CRYPTO_GCM_BLOCK_SIZE;
     }
 
@@ -315,7 +435,7 @@ UINT i, n;
         NX_CRYPTO_MEMCPY(tmp_block, input, input_length); /* Use case of memcpy is verified. */
         NX_CRYPTO_MEMSET(&tmp_block[input_length], 0, sizeof(tmp_block) - input_length);
         _nx_crypto_gcm_xor(output, tmp_block, tmp_block);
-        _nx_crypto_gcm_multi(tmp_block, hkey, output);
+        _nx_crypto_gcm_multi(htable, tmp_block, output);
     }
 }
 
@@ -404,6 +524,155 @@ UINT i, n;
 
 }
 
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_gcm_gctr_ghash                           PORTABLE C      */
+/*                                                           6.1          */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function performs GCTR and GHASH over the input in one pass.   */
+/*    Key stream is generated for up to NX_CRYPTO_GCM_PIPELINE_BLOCKS     */
+/*    counter blocks in one call to crypto_function, which must accept    */
+/*    a multiple of the block size. Each block is then XOR'ed with key    */
+/*    stream and its cipher text is folded into GHASH while it is still   */
+/*    at hand. The input may end in the middle of a block: the key stream */
+/*    of that block is saved in the GCM metadata and its cipher text is   */
+/*    XOR'ed into the GHASH state, and the next call continues the block  */
+/*    before taking whole blocks again. The GHASH multiplication of a     */
+/*    block that is still unfinished when the tag is computed is done by  */
+/*    the calculate functions. The counter block is updated after calling */
+/*    this function.                                                      */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    crypto_metadata                       Pointer to crypto metadata    */
+/*    gcm_metadata                          Pointer to GCM metadata       */
+/*    crypto_function                       Pointer to crypto function    */
+/*    input                                 Pointer to bytes of input     */
+/*    output                                Pointer to output buffer      */
+/*    length                                Length of bytes of input      */
+/*    op                                    NX_CRYPTO_ENCRYPT or          */
+/*                                            NX_CRYPTO_DECRYPT           */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_crypto_gcm_inc32                  Increase the counter by one   */
+/*    _nx_crypto_gcm_multi                  Perform multiplication in GF  */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_crypto_gcm_encrypt_update         Update data for encryption    */
+/*    _nx_crypto_gcm_decrypt_update         Update data for decryption    */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP static VOID _nx_crypto_gcm_gctr_ghash(VOID *crypto_metadata, NX_CRYPTO_GCM *gcm_metadata,
+                                                     UINT (*crypto_function)(VOID *, UCHAR *, UCHAR *, UINT),
+                                                     UCHAR *input, UCHAR *output, UINT length, UINT op)
+{
+UINT (*htable)[NX_CRYPTO_GCM_BLOCK_SIZE_INT] = gcm_metadata -> nx_crypto_gcm_htable;
+UCHAR *s = gcm_metadata -> nx_crypto_gcm_s;
+UCHAR *counter = gcm_metadata -> nx_crypto_gcm_counter;
+UCHAR counter_blocks[NX_CRYPTO_GCM_PIPELINE_BLOCKS * NX_CRYPTO_GCM_BLOCK_SIZE];
+UCHAR key_stream[NX_CRYPTO_GCM_PIPELINE_BLOCKS * NX_CRYPTO_GCM_BLOCK_SIZE];
+UCHAR *partial_key_stream = gcm_metadata -> nx_crypto_gcm_key_stream;
+UINT partial_length = gcm_metadata -> nx_crypto_gcm_partial_length;
+UCHAR tmp_block[NX_CRYPTO_GCM_BLOCK_SIZE];
+UCHAR *k;
+UCHAR in_byte;
+UCHAR out_byte;
+UINT blocks, i, j;
+
+    /* Finish the block left unfinished by the previous call. */
+    while ((partial_length > 0) && (length > 0))
+    {
+        in_byte = *input++;
+        out_byte = in_byte ^ partial_key_stream[partial_length];
+        *output++ = out_byte;
+        s[partial_length] ^= (op == NX_CRYPTO_ENCRYPT) ? out_byte : in_byte;
+        length--;
+
+        partial_length++;
+        if (partial_length == NX_CRYPTO_GCM_BLOCK_SIZE)
+        {
+            _nx_crypto_gcm_multi(htable, s, s);
+            partial_length = 0;
+        }
+    }
+
+    while (length >= NX_CRYPTO_GCM_BLOCK_SIZE)
+    {
+        blocks = length >> NX_CRYPTO_GCM_BLOCK_SIZE_SHIFT;
+        if (blocks > NX_CRYPTO_GCM_PIPELINE_BLOCKS)
+        {
+            blocks = NX_CRYPTO_GCM_PIPELINE_BLOCKS;
+        }
+
+        /* Generate key stream for the next batch of counter blocks in one call. */
+        k = counter_blocks;
+        for (i = 0; i < blocks; i++)
+        {
+            NX_CRYPTO_MEMCPY(k, counter, NX_CRYPTO_GCM_BLOCK_SIZE); /* Use case of memcpy is verified. */
+            _nx_crypto_gcm_inc32(counter);
+            k += NX_CRYPTO_GCM_BLOCK_SIZE;
+        }
+        crypto_function(crypto_metadata, counter_blocks, key_stream, blocks << NX_CRYPTO_GCM_BLOCK_SIZE_SHIFT);
+
+        k = key_stream;
+        for (i = 0; i < blocks; i++)
+        {
+
+            /* output = input xor key stream, and fold the cipher text into GHASH.
+               input may be the same buffer as output, so read it first. */
+            for (j = 0; j < NX_CRYPTO_GCM_BLOCK_SIZE; j++)
+            {
+                in_byte = input[j];
+                out_byte = in_byte ^ k[j];
+                output[j] = out_byte;
+                tmp_block[j] = s[j] ^ ((op == NX_CRYPTO_ENCRYPT) ? out_byte : in_byte);
+            }
+            _nx_crypto_gcm_multi(htable, tmp_block, s);
+
+            input += NX_CRYPTO_GCM_BLOCK_SIZE;
+            output += NX_CRYPTO_GCM_BLOCK_SIZE;
+            k += NX_CRYPTO_GCM_BLOCK_SIZE;
+        }
+
+        length -= blocks << NX_CRYPTO_GCM_BLOCK_SIZE_SHIFT;
+    }
+
+    if (length > 0)
+    {
+
+        /* Start a new block and keep its key stream for the rest of it. */
+        crypto_function(crypto_metadata, counter, partial_key_stream, NX_CRYPTO_GCM_BLOCK_SIZE);
+        _nx_crypto_gcm_inc32(counter);
+
+        for (j = 0; j < length; j++)
+        {
+            in_byte = input[j];
+            out_byte = in_byte ^ partial_key_stream[j];
+            output[j] = out_byte;
+            s[j] ^= (op == NX_CRYPTO_ENCRYPT) ? out_byte : in_byte;
+        }
+        partial_length = length;
+    }
+
+    gcm_metadata -> nx_crypto_gcm_partial_length = partial_length;
+
+#ifdef NX_SECURE_KEY_CLEAR
+    NX_CRYPTO_MEMSET(counter_blocks, 0, sizeof(counter_blocks));
+    NX_CRYPTO_MEMSET(key_stream, 0, sizeof(key_stream));
+    NX_CRYPTO_MEMSET(tmp_block, 0, sizeof(tmp_block));
+#endif
+}
+
 /**************************************************************************/
 /*                                                                        */
 /*  FUNCTION                                               RELEASE        */
@@ -438,6 +707,7 @@ UINT i, n;
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
+/*    _nx_crypto_gcm_htable_init            Build multiplication table    */
 /*    _nx_crypto_gcm_ghash_update           Update GHASH                  */
 /*    _nx_crypto_gcm_inc32                  Increase the counter by one   */
 /*                                                                        */
@@ -461,6 +731,7 @@ NX_CRYPTO_KEEP UINT _nx_crypto_gcm_encrypt_init(VOID *crypto_metadata, NX_CRYPTO
                                                 UCHAR *iv, UINT block_size)
 {
 UCHAR *hkey = gcm_metadata -> nx_crypto_gcm_hkey;
+UINT (*htable)[NX_CRYPTO_GCM_BLOCK_SIZE_INT] = gcm_metadata -> nx_crypto_gcm_htable;
 UCHAR *j0 = gcm_metadata -> nx_crypto_gcm_j0;
 UCHAR *s = gcm_metadata -> nx_crypto_gcm_s;
 UCHAR *counter = gcm_metadata -> nx_crypto_gcm_counter;
@@ -473,9 +744,17 @@ UCHAR iv_len;
         return(NX_CRYPTO_PTR_ERROR);
     }
 
-    /* Generate hash key by encrypt the zero block. */
-    NX_CRYPTO_MEMSET(hkey, 0, NX_CRYPTO_GCM_BLOCK_SIZE);
-    crypto_function(crypto_metadata, hkey, hkey, NX_CRYPTO_GCM_BLOCK_SIZE);
+    /* The hash key and its table only depend on the cipher key, which resets
+       the GCM context when it is set. Build them once per key. */
+    if (!gcm_metadata -> nx_crypto_gcm_htable_ready)
+    {
+
+        /* Generate hash key by encrypt the zero block. */
+        NX_CRYPTO_MEMSET(hkey, 0, NX_CRYPTO_GCM_BLOCK_SIZE);
+        crypto_function(crypto_metadata, hkey, hkey, NX_CRYPTO_GCM_BLOCK_SIZE);
+        _nx_crypto_gcm_htable_init(gcm_metadata);
+        gcm_metadata -> nx_crypto_gcm_htable_ready = 1;
+    }
 
     /* Generate the pre-counter block j0. */
     iv_len = iv[0];
@@ -496,18 +775,18 @@ UCHAR iv_len;
 
         /* When the length of IV is not 12 then apply GHASH to the IV. */
         NX_CRYPTO_MEMSET(j0, 0, NX_CRYPTO_GCM_BLOCK_SIZE);
-        _nx_crypto_gcm_ghash_update(hkey, iv, iv_len, j0);
+        _nx_crypto_gcm_ghash_update(htable, iv, iv_len, j0);
 
         /* Apply GHASH to the length of IV to form j0.*/
         NX_CRYPTO_MEMSET(tmp_block, 0, NX_CRYPTO_GCM_BLOCK_SIZE);
         tmp_block[NX_CRYPTO_GCM_BLOCK_SIZE - 2] = (UCHAR)(((iv_len << 3) & 0xFF00) >> 8);
         tmp_block[NX_CRYPTO_GCM_BLOCK_SIZE - 1] = (UCHAR)((iv_len << 3) & 0x00FF);
-        _nx_crypto_gcm_ghash_update(hkey, tmp_block, NX_CRYPTO_GCM_BLOCK_SIZE, j0);
+        _nx_crypto_gcm_ghash_update(htable, tmp_block, NX_CRYPTO_GCM_BLOCK_SIZE, j0);
     }
 
     /* Apply GHASH to the additional authenticated data. */
     NX_CRYPTO_MEMSET(s, 0, NX_CRYPTO_GCM_BLOCK_SIZE);
-    _nx_crypto_gcm_ghash_update(hkey, additional_data, additional_len, s);
+    _nx_crypto_gcm_ghash_update(htable, additional_data, additional_len, s);
 
     /* Initial counter block for GCTR is j0 + 1. */
     NX_CRYPTO_MEMCPY(counter, j0, NX_CRYPTO_GCM_BLOCK_SIZE); /* Use case of memcpy is verified. */
@@ -515,6 +794,7 @@ UCHAR iv_len;
 
     gcm_metadata -> nx_crypto_gcm_additional_data_len = additional_len;
     gcm_metadata -> nx_crypto_gcm_input_total_length = 0;
+    gcm_metadata -> nx_crypto_gcm_partial_length = 0;
 
 #ifdef NX_SECURE_KEY_CLEAR
     NX_CRYPTO_MEMSET(tmp_block, 0, sizeof(tmp_block));
@@ -536,6 +816,8 @@ UCHAR iv_len;
 /*  DESCRIPTION                                                           */
 /*                                                                        */
 /*    This function updates data for GCM encryption.                      */
+/*    The length of the data does not need to be a multiple of the block */
+/*    size. A block left unfinished is continued by the next update.      */
 /*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
@@ -553,8 +835,7 @@ UCHAR iv_len;
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
-/*    _nx_crypto_gcm_gctr                   Update data for GCM mode      */
-/*    _nx_crypto_gcm_ghash_update           Update GHASH                  */
+/*    _nx_crypto_gcm_gctr_ghash             Perform GCTR and GHASH        */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -574,9 +855,6 @@ NX_CRYPTO_KEEP UINT _nx_crypto_gcm_encrypt_update(VOID *crypto_metadata, NX_CRYP
                                                   UCHAR *input, UCHAR *output, UINT length,
                                                   UINT block_size)
 {
-UCHAR *hkey = gcm_metadata -> nx_crypto_gcm_hkey;
-UCHAR *s = gcm_metadata -> nx_crypto_gcm_s;
-UCHAR *counter = gcm_metadata -> nx_crypto_gcm_counter;
 
     /* Check the block size.  */
     if (block_size != NX_CRYPTO_GCM_BLOCK_SIZE)
@@ -584,11 +862,9 @@ UCHAR *counter = gcm_metadata -> nx_crypto_gcm_counter;
         return(NX_CRYPTO_PTR_ERROR);
     }
 
-    /* Invoke GCTR function to encrypt or decrypt the input message. */
-    _nx_crypto_gcm_gctr(crypto_metadata, crypto_function, input, output, length, counter);
-
-    /* Apply GHASH to the cipher text. */
-    _nx_crypto_gcm_ghash_update(hkey, output, length, s);
+    /* Encrypt the input message and apply GHASH to the cipher text. */
+    _nx_crypto_gcm_gctr_ghash(crypto_metadata, gcm_metadata, crypto_function,
+                              input, output, length, NX_CRYPTO_ENCRYPT);
 
     gcm_metadata -> nx_crypto_gcm_input_total_length += length;
 
@@ -624,6 +900,7 @@ UCHAR *counter = gcm_metadata -> nx_crypto_gcm_counter;
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
+/*    _nx_crypto_gcm_multi                  Perform multiplication in GF  */
 /*    _nx_crypto_gcm_gctr                   Update data for GCM mode      */
 /*    _nx_crypto_gcm_ghash_update           Update GHASH                  */
 /*                                                                        */
@@ -645,7 +922,7 @@ NX_CRYPTO_KEEP UINT _nx_crypto_gcm_encrypt_calculate(VOID *crypto_metadata, NX_C
                                                      UINT (*crypto_function)(VOID *, UCHAR *, UCHAR *, UINT),
                                                      UCHAR *output, UINT icv_len, UINT block_size)
 {
-UCHAR *hkey = gcm_metadata -> nx_crypto_gcm_hkey;
+UINT (*htable)[NX_CRYPTO_GCM_BLOCK_SIZE_INT] = gcm_metadata -> nx_crypto_gcm_htable;
 UCHAR *j0 = gcm_metadata -> nx_crypto_gcm_j0;
 UCHAR *s = gcm_metadata -> nx_crypto_gcm_s;
 UCHAR tmp_block[NX_CRYPTO_GCM_BLOCK_SIZE];
@@ -658,6 +935,13 @@ UINT length;
         return(NX_CRYPTO_PTR_ERROR);
     }
 
+    /* The last block of cipher text is zero padded for GHASH. */
+    if (gcm_metadata -> nx_crypto_gcm_partial_length > 0)
+    {
+        _nx_crypto_gcm_multi(htable, s, s);
+        gcm_metadata -> nx_crypto_gcm_partial_length = 0;
+    }
+
     /* Apply GHASH to the length of additional authenticated data and the length of cipher text. */
     length = gcm_metadata -> nx_crypto_gcm_input_total_length;
     tmp_block[0] = 0;
@@ -676,7 +960,7 @@ UINT length;
     tmp_block[13] = (UCHAR)(((length << 3) & 0x00FF0000) >> 16);
     tmp_block[14] = (UCHAR)(((length << 3) & 0x0000FF00) >> 8);
     tmp_block[15] = (UCHAR)((length << 3) & 0x000000FF);
-    _nx_crypto_gcm_ghash_update(hkey, tmp_block, NX_CRYPTO_GCM_BLOCK_SIZE, s);
+    _nx_crypto_gcm_ghash_update(htable, tmp_block, NX_CRYPTO_GCM_BLOCK_SIZE, s);
 
     /* Encrypt the GHASH result using GCTR with j0 as initial counter block.
         The result is the authentication tag. */
@@ -705,6 +989,8 @@ UINT length;
 /*  DESCRIPTION                                                           */
 /*                                                                        */
 /*    This function updates data for GCM decryption.                      */
+/*    The length of the data does not need to be a multiple of the block */
+/*    size. A block left unfinished is continued by the next update.      */
 /*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
@@ -722,8 +1008,7 @@ UINT length;
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
-/*    _nx_crypto_gcm_gctr                   Update data for GCM mode      */
-/*    _nx_crypto_gcm_ghash_update           Update GHASH                  */
+/*    _nx_crypto_gcm_gctr_ghash             Perform GCTR and GHASH        */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -743,9 +1028,6 @@ NX_CRYPTO_KEEP UINT _nx_crypto_gcm_decrypt_update(VOID *crypto_metadata, NX_CRYP
                                                   UCHAR *input, UCHAR *output, UINT length,
                                                   UINT block_size)
 {
-UCHAR *hkey = gcm_metadata -> nx_crypto_gcm_hkey;
-UCHAR *s = gcm_metadata -> nx_crypto_gcm_s;
-UCHAR *counter = gcm_metadata -> nx_crypto_gcm_counter;
 
     /* Check the block size.  */
     if (block_size != NX_CRYPTO_GCM_BLOCK_SIZE)
@@ -753,11 +1035,9 @@ UCHAR *counter = gcm_metadata -> nx_crypto_gcm_counter;
         return(NX_CRYPTO_PTR_ERROR);
     }
 
-    /* Apply GHASH to the cipher text. */
-    _nx_crypto_gcm_ghash_update(hkey, input, length, s);
-
-    /* Invoke GCTR function to encrypt or decrypt the input message. */
-    _nx_crypto_gcm_gctr(crypto_metadata, crypto_function, input, output, length, counter);
+    /* Apply GHASH to the cipher text and decrypt it. */
+    _nx_crypto_gcm_gctr_ghash(crypto_metadata, gcm_metadata, crypto_function,
+                              input, output, length, NX_CRYPTO_DECRYPT);
 
     gcm_metadata -> nx_crypto_gcm_input_total_length += length;
 
@@ -793,6 +1073,7 @@ UCHAR *counter = gcm_metadata -> nx_crypto_gcm_counter;
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
+/*    _nx_crypto_gcm_multi                  Perform multiplication in GF  */
 /*    _nx_crypto_gcm_gctr                   Update data for GCM mode      */
 /*    _nx_crypto_gcm_ghash_update           Update GHASH                  */
 /*                                                                        */
@@ -813,7 +1094,7 @@ NX_CRYPTO_KEEP UINT _nx_crypto_gcm_decrypt_calculate(VOID *crypto_metadata, NX_C
                                                      UINT (*crypto_function)(VOID *, UCHAR *, UCHAR *, UINT),
                                                      UCHAR *input, UINT icv_len, UINT block_size)
 {
-UCHAR *hkey = gcm_metadata -> nx_crypto_gcm_hkey;
+UINT (*htable)[NX_CRYPTO_GCM_BLOCK_SIZE_INT] = gcm_metadata -> nx_crypto_gcm_htable;
 UCHAR *j0 = gcm_metadata -> nx_crypto_gcm_j0;
 UCHAR *s = gcm_metadata -> nx_crypto_gcm_s;
 UCHAR tmp_block[NX_CRYPTO_GCM_BLOCK_SIZE];
@@ -827,6 +1108,13 @@ UINT i;
         return(NX_CRYPTO_PTR_ERROR);
     }
 
+    /* The last block of cipher text is zero padded for GHASH. */
+    if (gcm_metadata -> nx_crypto_gcm_partial_length > 0)
+    {
+        _nx_crypto_gcm_multi(htable, s, s);
+        gcm_metadata -> nx_crypto_gcm_partial_length = 0;
+    }
+
     /* Apply GHASH to the length of additional authenticated data and the length of cipher text. */
     length = gcm_metadata -> nx_crypto_gcm_input_total_length;
     tmp_block[0] = 0;
@@ -845,7 +1133,7 @@ UINT i;
     tmp_block[13] = (UCHAR)(((length << 3) & 0x00FF0000) >> 16);
     tmp_block[14] = (UCHAR)(((length << 3) & 0x0000FF00) >> 8);
     tmp_block[15] = (UCHAR)((length << 3) & 0x000000FF);
-    _nx_crypto_gcm_ghash_update(hkey, tmp_block, NX_CRYPTO_GCM_BLOCK_SIZE, s);
+    _nx_crypto_gcm_ghash_update(htable, tmp_block, NX_CRYPTO_GCM_BLOCK_SIZE, s);
 
 #ifdef NX_SECURE_KEY_CLEAR
     NX_CRYPTO_MEMSET(tmp_block, 0, sizeof(tmp_block));
@@ -88,7 +88,7 @@ NX_CRYPTO_KEEP UINT  _nx_crypto_method_hkdf_init(struct  NX_CRYPTO_METHOD_STRUCT
     }
 
     /* Verify the metadata addrsss is 4-byte aligned. */
-    if((((ULONG)crypto_metadata) & 0x3) != 0)
+    if((((ALIGN_TYPE)crypto_metadata) & 0x3) != 0)
     {
         return(NX_CRYPTO_METADATA_UNALIGNED);
     }
@@ -270,7 +270,7 @@ UINT                 status;
     NX_CRYPTO_STATE_CHECK
 
     /* Verify the metadata addrsss is 4-byte aligned. */
-    if((method == NX_CRYPTO_NULL) || (crypto_metadata == NX_CRYPTO_NULL) || ((((ULONG)crypto_metadata) & 0x3) != 0))
+    if((method == NX_CRYPTO_NULL) || (crypto_metadata == NX_CRYPTO_NULL) || ((((ALIGN_TYPE)crypto_metadata) & 0x3) != 0))
     {
         return(NX_CRYPTO_POINTER_ERROR);
     }
@@ -543,7 +543,8 @@ NX_CRYPTO_METHOD *hmac_method = hkdf -> nx_crypto_hmac_method;
 /*                                                                        */
 /*    This function performs the HKDF-expand operation detailed in RFC    */
 /*    5869. The hdkf parameter contains the input key (PRK) and other     */
-/*    parameters needed to generate the desired output data.              */
+/*    parameters needed to generate the desired output data. The PRK is   */
+/*    set as HMAC key once and its hash state is reused for every T(i).   */
 /*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
@@ -662,6 +663,43 @@ NX_CRYPTO_METHOD *hmac_method = hkdf -> nx_crypto_hmac_method;
     /* Get our L count for our loop. */
     N_count = 1 + ((desired_length) / hash_size);
 
+    /* Initialize hash method and set the PRK as HMAC key once, every T(i) below
+       then starts from the hash states saved for the padded PRK. */
+    if (hmac_method -> nx_crypto_init)
+    {
+        status = hmac_method -> nx_crypto_init(hmac_method,
+                                               prk,
+                                               (NX_CRYPTO_KEY_SIZE)(prk_len << 3),
+                                               &handler,
+                                               metadata,
+                                               metadata_size);
+
+        if (status != NX_CRYPTO_SUCCESS)
+        {
+            return(status);
+        }
+    }
+
+    status = hmac_method -> nx_crypto_operation(NX_CRYPTO_HASH_INITIALIZE,
+                                                handler,
+                                                hmac_method,
+                                                prk,
+                                                (NX_CRYPTO_KEY_SIZE)(prk_len << 3),
+                                                NX_CRYPTO_NULL,
+                                                0,
+                                                NX_CRYPTO_NULL,
+                                                NX_CRYPTO_NULL,
+                                                0,
+                                                metadata,
+                                                metadata_size,
+                                                NX_CRYPTO_NULL,
+                                                NX_CRYPTO_NULL);
+
+    if (status != NX_CRYPTO_SUCCESS)
+    {
+        return(status);
+    }
+
     /* Loop through T(i) to calculate output material (OKM).
      * NOTE: We start at 1 so the counter is correct. Add one
      * to N_count to get the full amount of data. */
@@ -678,28 +716,12 @@ NX_CRYPTO_METHOD *hmac_method = hkdf -> nx_crypto_hmac_method;
         /* Concatenate counter octet. */
         temp_T[T_len + info_len] = (UCHAR)(i & 0xFF);
 
-        /* Initialize hash method. */
-        if (hmac_method -> nx_crypto_init)
-        {
-            status = hmac_method -> nx_crypto_init(hmac_method,
-                                                   prk,
-                                                   (NX_CRYPTO_KEY_SIZE)(prk_len << 3),
-                                                   &handler,
-                                                   metadata,
-                                                   metadata_size);
-
-            if (status != NX_CRYPTO_SUCCESS)
-            {
-                return(status);
-            }
-        }
-
         /* The number of bytes we want to hash is a combination of T_len (0 or <hash size>)
            the length of "info", and add 1 for the counter octet. */
         T_bytes_to_hash = T_len + info_len + 1;
 
         /* Calculate T(i) = HMAC(PRK, T(i-1) | info | i) */
-        status = hmac_method -> nx_crypto_operation(NX_CRYPTO_AUTHENTICATE,
+        status = hmac_method -> nx_crypto_operation(NX_CRYPTO_HMAC_CACHED_AUTHENTICATE,
                                                     handler,
                                                     hmac_method,
                                                     prk,
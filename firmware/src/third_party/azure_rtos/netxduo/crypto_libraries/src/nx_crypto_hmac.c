@@ -101,7 +101,9 @@ NX_CRYPTO_KEEP UINT _nx_crypto_hmac(NX_CRYPTO_HMAC *hmac_metadata,
 /*                                                                        */
 /*  DESCRIPTION                                                           */
 /*                                                                        */
-/*    This function performs HMAC initialization.                         */
+/*    This function performs HMAC initialization. When the metadata has   */
+/*    room for the hash state, the states after the ipad and opad blocks  */
+/*    are saved so later messages with the same key start from them.      */
 /*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
@@ -118,6 +120,7 @@ NX_CRYPTO_KEEP UINT _nx_crypto_hmac(NX_CRYPTO_HMAC *hmac_metadata,
 /*    [crypto_digest_calculate]             Calculate crypto digest       */
 /*    [crypto_initialize]                   Perform crypto initialization */
 /*    [crypto_update]                       Perform crypto update         */
+/*    NX_CRYPTO_MEMCPY                      Copy the saved hash state     */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -158,8 +161,6 @@ UINT  i;
         key_length = hmac_metadata -> output_length;
     }
 
-    hmac_metadata -> crypto_initialize(hmac_metadata -> context, hmac_metadata -> algorithm);
-
     /* The HMAC_CRYPTO transform looks like:
 
        CRYPTO(K XOR opad, CRYPTO(K XOR ipad, text))
@@ -185,9 +186,34 @@ UINT  i;
         hmac_metadata -> k_opad[i] ^= 0x5c;
     }
 
+    hmac_metadata -> key_cached = NX_CRYPTO_FALSE;
+
+    if (hmac_metadata -> state_size != 0)
+    {
+
+        /* Hash the outer padded key now and save the state, so the digest
+           calculation of every message with this key can start from it. */
+        hmac_metadata -> crypto_initialize(hmac_metadata -> context, hmac_metadata -> algorithm);
+
+        hmac_metadata -> crypto_update(hmac_metadata -> context, hmac_metadata -> k_opad, hmac_metadata -> block_size);
+
+        NX_CRYPTO_MEMCPY(hmac_metadata -> outer_state, hmac_metadata -> state, hmac_metadata -> state_size); /* Use case of memcpy is verified. */
+    }
+
+    hmac_metadata -> crypto_initialize(hmac_metadata -> context, hmac_metadata -> algorithm);
+
     /* Kick off the inner hash with our padded key. */
     hmac_metadata -> crypto_update(hmac_metadata -> context, hmac_metadata -> k_ipad, hmac_metadata -> block_size);
 
+    if (hmac_metadata -> state_size != 0)
+    {
+
+        /* Save the inner state for _nx_crypto_hmac_reset.  */
+        NX_CRYPTO_MEMCPY(hmac_metadata -> inner_state, hmac_metadata -> state, hmac_metadata -> state_size); /* Use case of memcpy is verified. */
+
+        hmac_metadata -> key_cached = NX_CRYPTO_TRUE;
+    }
+
 #ifdef NX_SECURE_KEY_CLEAR
     NX_CRYPTO_MEMSET(temp_key, 0, sizeof(temp_key));
 #endif /* NX_SECURE_KEY_CLEAR  */
@@ -197,6 +223,67 @@ UINT  i;
 }
 
 
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_hmac_reset                               PORTABLE C      */
+/*                                                           6.1          */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function starts a new HMAC with the key set by the last call   */
+/*    to _nx_crypto_hmac_initialize. The inner hash state saved for that  */
+/*    key is restored, so the padded key is not hashed again.             */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    hmac_metadata                         pointer to HMAC metadata      */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    [crypto_initialize]                   Perform crypto initialization */
+/*    [crypto_update]                       Perform crypto update         */
+/*    NX_CRYPTO_MEMCPY                      Copy the saved hash state     */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*    _nx_crypto_method_hmac_operation      Handle HMAC operation         */
+/*    _nx_crypto_method_hmac_md5_operation  Handle HMAC-MD5 operation     */
+/*    _nx_crypto_method_hmac_sha1_operation Handle HMAC-SHA1 operation    */
+/*    _nx_crypto_method_hmac_sha256_operation Handle HMAC-SHA256 operation*/
+/*    _nx_crypto_method_hmac_sha512_operation Handle HMAC-SHA512 operation*/
+/*                                                                        */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP UINT _nx_crypto_hmac_reset(NX_CRYPTO_HMAC *hmac_metadata)
+{
+
+    if (hmac_metadata -> key_cached)
+    {
+
+        /* Restore the state after the inner padded key. */
+        NX_CRYPTO_MEMCPY(hmac_metadata -> state, hmac_metadata -> inner_state, hmac_metadata -> state_size); /* Use case of memcpy is verified. */
+    }
+    else
+    {
+
+        /* No saved state, hash the inner padded key again. */
+        hmac_metadata -> crypto_initialize(hmac_metadata -> context, hmac_metadata -> algorithm);
+
+        hmac_metadata -> crypto_update(hmac_metadata -> context, hmac_metadata -> k_ipad, hmac_metadata -> block_size);
+    }
+
+    /* Return success.  */
+    return(NX_CRYPTO_SUCCESS);
+}
+
+
 /**************************************************************************/
 /*                                                                        */
 /*  FUNCTION                                               RELEASE        */
@@ -264,7 +351,9 @@ NX_CRYPTO_KEEP UINT _nx_crypto_hmac_update(NX_CRYPTO_HMAC *hmac_metadata, UCHAR
 /*                                                                        */
 /*  DESCRIPTION                                                           */
 /*                                                                        */
-/*    This function performs HMAC digest calculation.                     */
+/*    This function performs HMAC digest calculation. The outer hash      */
+/*    starts from the state saved by _nx_crypto_hmac_initialize when one  */
+/*    is available.                                                       */
 /*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
@@ -280,6 +369,7 @@ NX_CRYPTO_KEEP UINT _nx_crypto_hmac_update(NX_CRYPTO_HMAC *hmac_metadata, UCHAR
 /*    [crypto_digest_calculate]             Calculate crypto digest       */
 /*    [crypto_initialize]                   Perform crypto initialization */
 /*    [crypto_update]                       Perform crypto update         */
+/*    NX_CRYPTO_MEMCPY                      Copy the saved hash state     */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -304,9 +394,18 @@ UCHAR icv_ptr[64];
 
     hmac_metadata -> crypto_digest_calculate(hmac_metadata -> context, icv_ptr, hmac_metadata -> algorithm);
 
-    hmac_metadata -> crypto_initialize(hmac_metadata -> context, hmac_metadata -> algorithm);
+    if (hmac_metadata -> key_cached)
+    {
 
-    hmac_metadata -> crypto_update(hmac_metadata -> context, hmac_metadata -> k_opad, hmac_metadata -> block_size);
+        /* Start from the state saved after the outer padded key. */
+        NX_CRYPTO_MEMCPY(hmac_metadata -> state, hmac_metadata -> outer_state, hmac_metadata -> state_size); /* Use case of memcpy is verified. */
+    }
+    else
+    {
+        hmac_metadata -> crypto_initialize(hmac_metadata -> context, hmac_metadata -> algorithm);
+
+        hmac_metadata -> crypto_update(hmac_metadata -> context, hmac_metadata -> k_opad, hmac_metadata -> block_size);
+    }
 
     hmac_metadata -> crypto_update(hmac_metadata -> context, icv_ptr, hmac_metadata -> output_length);
 
@@ -347,6 +446,8 @@ UCHAR icv_ptr[64];
 /*    algorithm                             algorithm                     */
 /*    block_size                            block size                    */
 /*    output_length                         output length                 */
+/*    state_size                            size of the hash state at the */
+/*                                            start of the context        */
 /*    crypto_intitialize                    initializtion function        */
 /*    crypto_update                         update function               */
 /*    crypto_digest_calculate               digest calculation function   */
@@ -378,7 +479,7 @@ UCHAR icv_ptr[64];
 /**************************************************************************/
 NX_CRYPTO_KEEP VOID _nx_crypto_hmac_metadata_set(NX_CRYPTO_HMAC *hmac_metadata,
                                                  VOID *context,
-                                                 UINT algorithm, UINT block_size, UINT output_length,
+                                                 UINT algorithm, UINT block_size, UINT output_length, UINT state_size,
                                                  UINT (*crypto_initialize)(VOID *, UINT),
                                                  UINT (*crypto_update)(VOID *, UCHAR *, UINT),
                                                  UINT (*crypto_digest_calculate)(VOID *, UCHAR *, UINT))
@@ -388,6 +489,13 @@ NX_CRYPTO_KEEP VOID _nx_crypto_hmac_metadata_set(NX_CRYPTO_HMAC *hmac_metadata,
     hmac_metadata -> algorithm = algorithm;
     hmac_metadata -> block_size = block_size;
     hmac_metadata -> output_length = output_length;
+
+    /* The saved states are kept in the padded key buffers, which are not
+       needed once the padded keys have been hashed. */
+    hmac_metadata -> state = context;
+    hmac_metadata -> inner_state = hmac_metadata -> k_ipad;
+    hmac_metadata -> outer_state = hmac_metadata -> k_opad;
+    hmac_metadata -> state_size = state_size;
     hmac_metadata -> crypto_initialize = crypto_initialize;
     hmac_metadata -> crypto_update = crypto_update;
     hmac_metadata -> crypto_digest_calculate = crypto_digest_calculate;
@@ -689,7 +797,7 @@ NX_CRYPTO_KEEP UINT  _nx_crypto_method_hmac_init(struct  NX_CRYPTO_METHOD_STRUCT
     }
 
     /* Verify the metadata addrsss is 4-byte aligned. */
-    if((((ULONG)crypto_metadata) & 0x3) != 0)
+    if((((ALIGN_TYPE)crypto_metadata) & 0x3) != 0)
     {
         return(NX_CRYPTO_PTR_ERROR);
     }
@@ -787,7 +895,9 @@ NX_CRYPTO_KEEP UINT  _nx_crypto_method_hmac_cleanup(VOID *crypto_metadata)
 /*    This function is the generic operation for HMAC. HMAC does not care */
 /*    what hash is used as long as the hash size is known. Therefore, this*/
 /*    method may be used with an arbitrary hash routine as long as the    */
-/*    hash has an NX_CRYPTO_METHOD instance properly filled out.          */
+/*    hash has an NX_CRYPTO_METHOD instance properly filled out. When the */
+/*    metadata area holds two more copies of the hash metadata, they are  */
+/*    used to save the hash state after the padded keys.                  */
 /*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
@@ -840,6 +950,7 @@ NX_CRYPTO_KEEP UINT _nx_crypto_method_hmac_operation(UINT op,      /* Encrypt, D
 {
 NX_CRYPTO_HMAC       *hmac;
 UINT                 status;
+UINT                 metadata_size;
 
     NX_CRYPTO_PARAMETER_NOT_USED(handle);
     NX_CRYPTO_PARAMETER_NOT_USED(iv_ptr);
@@ -849,7 +960,7 @@ UINT                 status;
     NX_CRYPTO_STATE_CHECK
 
     /* Verify the metadata addrsss is 4-byte aligned. */
-    if((method == NX_CRYPTO_NULL) || (crypto_metadata == NX_CRYPTO_NULL) || ((((ULONG)crypto_metadata) & 0x3) != 0))
+    if((method == NX_CRYPTO_NULL) || (crypto_metadata == NX_CRYPTO_NULL) || ((((ALIGN_TYPE)crypto_metadata) & 0x3) != 0))
     {
         return(NX_CRYPTO_PTR_ERROR);
     }
@@ -866,17 +977,38 @@ UINT                 status;
     hmac->context = hmac;
     hmac->hash_context = ((UCHAR*)(crypto_metadata)) + sizeof(NX_CRYPTO_HMAC);
 
+    if (op != NX_CRYPTO_HMAC_SET_HASH)
+    {
+
+        /* The saved hash states are copies of the whole hash metadata, placed right after it. */
+        hmac->state = hmac->hash_context;
+        hmac->inner_state = ((UCHAR*)(hmac->hash_context)) + hmac->state_size;
+        hmac->outer_state = hmac->inner_state + hmac->state_size;
+    }
+
     status = NX_CRYPTO_SUCCESS;
     switch (op)
     {
     case NX_CRYPTO_HMAC_SET_HASH:
         hmac->hash_method = method;
 
+        /* The layout of the hash metadata is unknown here, so the whole of it is saved as the hash state.
+         * Do so only if the caller's metadata area has room for the two saved copies. */
+        if (crypto_metadata_size >= sizeof(NX_CRYPTO_HMAC) + 3 * method->nx_crypto_metadata_area_size)
+        {
+            metadata_size = method->nx_crypto_metadata_area_size;
+        }
+        else
+        {
+            metadata_size = 0;
+        }
+
         /* Set up the HMAC metadata using the HMAC context for the hash context - this is because our built-in routines
          * (_nx_crypto_hmac_hash_initialize/update/digest_calculate) need the full HMAC context, unlike when HMAC routines
          * are built around HMAC (as opposed to when HMAC is used as a hash wrapper). */
         _nx_crypto_hmac_metadata_set(hmac, hmac,
                                      method->nx_crypto_algorithm, method->nx_crypto_block_size_in_bytes, method->nx_crypto_ICV_size_in_bits >> 3,
+                                     metadata_size,
                                      _nx_crypto_hmac_hash_initialize,
                                      _nx_crypto_hmac_hash_update,
                                      _nx_crypto_hmac_hash_digest_calculate);
@@ -895,6 +1027,19 @@ UINT                 status;
         status = _nx_crypto_hmac_initialize(hmac, key, key_size_in_bits >> 3);
         break;
 
+    case NX_CRYPTO_HMAC_CACHED_AUTHENTICATE:
+        /* Do an entire HMAC operation with the key set by NX_CRYPTO_HASH_INITIALIZE. */
+        if(output_length_in_byte == 0)
+        {
+            return(NX_CRYPTO_INVALID_BUFFER_SIZE);
+        }
+        _nx_crypto_hmac_reset(hmac);
+        _nx_crypto_hmac_update(hmac, input, input_length_in_byte);
+        status = _nx_crypto_hmac_digest_calculate(hmac, output,
+                                                  (output_length_in_byte > (ULONG)((hmac-> hash_method -> nx_crypto_ICV_size_in_bits) >> 3) ?
+                                                  ((hmac-> hash_method -> nx_crypto_ICV_size_in_bits) >> 3) : output_length_in_byte));
+        break;
+
     case NX_CRYPTO_HASH_UPDATE:
         status = _nx_crypto_hmac_update(hmac, input, input_length_in_byte);
         break;
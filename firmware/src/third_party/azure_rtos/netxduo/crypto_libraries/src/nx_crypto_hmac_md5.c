@@ -88,7 +88,7 @@ NX_CRYPTO_KEEP UINT  _nx_crypto_method_hmac_md5_init(struct  NX_CRYPTO_METHOD_ST
     }
   
     /* Verify the metadata addrsss is 4-byte aligned. */
-    if((((ULONG)crypto_metadata) & 0x3) != 0)
+    if((((ALIGN_TYPE)crypto_metadata) & 0x3) != 0)
     {
         return(NX_CRYPTO_PTR_ERROR);
     }
@@ -201,6 +201,7 @@ NX_CRYPTO_KEEP UINT  _nx_crypto_method_hmac_md5_cleanup(VOID *crypto_metadata)
 /*    _nx_crypto_hmac                       Calculate the HMAC            */
 /*    _nx_crypto_hmac_metadata_set          Set HMAC metadata             */
 /*    _nx_crypto_hmac_initialize            Perform HMAC initialization   */
+/*    _nx_crypto_hmac_reset                 Restart HMAC with cached key  */
 /*    _nx_crypto_hmac_update                Perform HMAC update           */
 /*    _nx_crypto_hmac_digest_calculate      Calculate HMAC digest         */
 /*                                                                        */
@@ -243,7 +244,7 @@ NX_CRYPTO_HMAC     *hmac_metadata;
     NX_CRYPTO_STATE_CHECK
 
     /* Verify the metadata addrsss is 4-byte aligned. */
-    if((method == NX_CRYPTO_NULL) || (crypto_metadata == NX_CRYPTO_NULL) || ((((ULONG)crypto_metadata) & 0x3) != 0))
+    if((method == NX_CRYPTO_NULL) || (crypto_metadata == NX_CRYPTO_NULL) || ((((ALIGN_TYPE)crypto_metadata) & 0x3) != 0))
     {
         return(NX_CRYPTO_PTR_ERROR);
     }
@@ -261,6 +262,7 @@ NX_CRYPTO_HMAC     *hmac_metadata;
                                  method -> nx_crypto_algorithm,
                                  NX_CRYPTO_MD5_BLOCK_SIZE_IN_BYTES,
                                  NX_CRYPTO_HMAC_MD5_ICV_FULL_LEN_IN_BITS >> 3,
+                                 (UINT)NX_CRYPTO_OFFSET(NX_CRYPTO_MD5, nx_md5_buffer),
                                  (UINT (*)(VOID *, UINT))_nx_crypto_md5_initialize,
                                  (UINT (*)(VOID *, UCHAR *, UINT))_nx_crypto_md5_update,
                                  (UINT (*)(VOID *, UCHAR *, UINT))_nx_crypto_md5_digest_calculate);
@@ -276,6 +278,19 @@ NX_CRYPTO_HMAC     *hmac_metadata;
         _nx_crypto_hmac_initialize(hmac_metadata, key, key_size_in_bits >> 3);
         break;
 
+    case NX_CRYPTO_HMAC_CACHED_AUTHENTICATE:
+        if(output_length_in_byte == 0)
+        {
+            return(NX_CRYPTO_INVALID_BUFFER_SIZE);
+        }
+
+        _nx_crypto_hmac_reset(hmac_metadata);
+        _nx_crypto_hmac_update(hmac_metadata, input, input_length_in_byte);
+        _nx_crypto_hmac_digest_calculate(hmac_metadata, output,
+                                         (output_length_in_byte > (ULONG)((method -> nx_crypto_ICV_size_in_bits) >> 3) ? 
+                                         ((method -> nx_crypto_ICV_size_in_bits) >> 3) : output_length_in_byte));
+        break;
+
     case NX_CRYPTO_HASH_UPDATE:
         _nx_crypto_hmac_update(hmac_metadata, input, input_length_in_byte);
         break;
@@ -88,7 +88,7 @@ NX_CRYPTO_KEEP UINT  _nx_crypto_method_hmac_sha512_init(struct  NX_CRYPTO_METHOD
     }
 
     /* Verify the metadata addrsss is 4-byte aligned. */
-    if((((ULONG)crypto_metadata) & 0x3) != 0)
+    if((((ALIGN_TYPE)crypto_metadata) & 0x3) != 0)
     {
         return(NX_CRYPTO_PTR_ERROR);
     }
@@ -200,6 +200,7 @@ NX_CRYPTO_KEEP UINT  _nx_crypto_method_hmac_sha512_cleanup(VOID *crypto_metadata
 /*    _nx_crypto_hmac                       Calculate the HMAC            */
 /*    _nx_crypto_hmac_metadata_set          Set HMAC metadata             */
 /*    _nx_crypto_hmac_initialize            Perform HMAC initialization   */
+/*    _nx_crypto_hmac_reset                 Restart HMAC with cached key  */
 /*    _nx_crypto_hmac_update                Perform HMAC update           */
 /*    _nx_crypto_hmac_digest_calculate      Calculate HMAC digest         */
 /*                                                                        */
@@ -245,7 +246,7 @@ UINT                    icv_full_length;
     NX_CRYPTO_STATE_CHECK
 
     /* Verify the metadata addrsss is 4-byte aligned. */
-    if((method == NX_CRYPTO_NULL) || (crypto_metadata == NX_CRYPTO_NULL) || ((((ULONG)crypto_metadata) & 0x3) != 0))
+    if((method == NX_CRYPTO_NULL) || (crypto_metadata == NX_CRYPTO_NULL) || ((((ALIGN_TYPE)crypto_metadata) & 0x3) != 0))
     {
         return(NX_CRYPTO_PTR_ERROR);
     }
@@ -256,7 +257,7 @@ UINT                    icv_full_length;
     }
 
     if (op != NX_CRYPTO_AUTHENTICATE && op != NX_CRYPTO_VERIFY && op != NX_CRYPTO_HASH_INITIALIZE &&
-        op != NX_CRYPTO_HASH_UPDATE && op != NX_CRYPTO_HASH_CALCULATE)
+        op != NX_CRYPTO_HASH_UPDATE && op != NX_CRYPTO_HASH_CALCULATE && op != NX_CRYPTO_HMAC_CACHED_AUTHENTICATE)
     {
         /* Incorrect Operation. */
         return status;
@@ -291,6 +292,7 @@ UINT                    icv_full_length;
                                  method -> nx_crypto_algorithm,
                                  NX_CRYPTO_SHA512_BLOCK_SIZE_IN_BYTES,
                                  icv_full_length >> 3,
+                                 (UINT)NX_CRYPTO_OFFSET(NX_CRYPTO_SHA512, nx_sha512_buffer),
                                  (UINT (*)(VOID *, UINT))_nx_crypto_sha512_initialize,
                                  (UINT (*)(VOID *, UCHAR *, UINT))_nx_crypto_sha512_update,
                                  (UINT (*)(VOID *, UCHAR *, UINT))_nx_crypto_sha512_digest_calculate);
@@ -307,6 +309,14 @@ UINT                    icv_full_length;
         _nx_crypto_hmac_initialize(hmac_metadata, key, key_size_in_bits >> 3);
         break;
 
+    case NX_CRYPTO_HMAC_CACHED_AUTHENTICATE:
+        _nx_crypto_hmac_reset(hmac_metadata);
+        _nx_crypto_hmac_update(hmac_metadata, input, input_length_in_byte);
+        _nx_crypto_hmac_digest_calculate(hmac_metadata, output,
+                                         (output_length_in_byte > (ULONG)((method -> nx_crypto_ICV_size_in_bits) >> 3) ?
+                                         ((method -> nx_crypto_ICV_size_in_bits) >> 3) : output_length_in_byte));
+        break;
+
     case NX_CRYPTO_HASH_UPDATE:
         _nx_crypto_hmac_update(hmac_metadata, input, input_length_in_byte);
         break;
@@ -438,6 +438,10 @@ UINT      right_size;
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
+/*    _nx_crypto_ec_fp_joint_multiple       Calculate the joint           */
+/*                                            multiplication              */
+/*    _nx_crypto_ec_fp_projective_multiple  Calculate the projective      */
+/*                                            multiplication              */
 /*    _nx_crypto_huge_number_add            Calculate addition for        */
 /*                                            huge numbers                */
 /*    _nx_crypto_huge_number_subtract       Calculate subtraction for     */
@@ -1046,7 +1050,9 @@ UINT right_size;
 /*                                                                        */
 /*    This function multiplies two huge numbers and places the result     */
 /*    in the result buffer which must be large enough to hold the         */
-/*    resulting value.                                                    */
+/*    resulting value. The product is computed column by column           */
+/*    (Comba), so each digit of the result is stored once. The result     */
+/*    must not overlap either operand.                                    */
 /*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
@@ -1088,53 +1094,48 @@ NX_CRYPTO_KEEP VOID _nx_crypto_huge_number_multiply(NX_CRYPTO_HUGE_NUMBER *left,
                                                     NX_CRYPTO_HUGE_NUMBER *result)
 {
 
-UINT      index, right_index; /* Loop variables */
+UINT      index, column;     /* Loop variables */
+UINT      last_index;
 HN_UBASE *left_buffer, *right_buffer;
 HN_UBASE2 product;
+HN_UBASE2 accumulator;
+HN_UBASE  accumulator_high;
 UINT      left_size, right_size;
 HN_UBASE *result_buffer;
-HN_UBASE *temp_ptr;
 
     left_size = left -> nx_crypto_huge_number_size;
     right_size = right -> nx_crypto_huge_number_size;
     left_buffer = left -> nx_crypto_huge_number_data;
     right_buffer = right -> nx_crypto_huge_number_data;
 
-    /* The temp buffer serves as "buckets".  During each itegration, the products of two digits are accumucated into
-       this buckets.  Since each "digit" is 16-bit, by using 32-bit buckets, the carry can be accumulated in to the
-       top 16-bits of the bucket.  Therefore, we don't need to worry about "carry" bit during each iteration.  */
+    /* The product is computed one column at a time. All "digit" products that belong to a column are summed
+       in a three-digit accumulator: two digits in accumulator and the carries out of them in accumulator_high.
+       The low digit is stored once the column is complete, so each result "digit" is written exactly once.  */
 
     result_buffer = result -> nx_crypto_huge_number_data;
     result -> nx_crypto_huge_number_size = (left_size + right_size);
 
-    /* Zero out the buckets since we are going to accumulate "digits" there. */
-    NX_CRYPTO_MEMSET(result_buffer, 0, (left_size + right_size) << HN_SIZE_SHIFT);
-
-    /* Loop over the operands, grabbing a "digit" at a time and calculating the product accounting for carry. */
-    for (index = 0; index < left_size; ++index)
+    accumulator = 0;
+    accumulator_high = 0;
+    for (column = 0; column < (left_size + right_size - 1); column++)
     {
 
-        /* If the "digit" on the left is zero, there is no need to loop through the "digits" on the right. */
-        if (left_buffer[index] == 0)
+        /* Column "column" holds left[index] * right[column - index]. */
+        index = (column < right_size) ? 0 : (column - right_size + 1);
+        last_index = (column < left_size) ? column : (left_size - 1);
+        for (; index <= last_index; index++)
         {
-            /* Yes the digit ont he left is zero.  Continue to the next iteration. */
-            continue;
+            product = (HN_UBASE2)left_buffer[index] * (HN_UBASE2)right_buffer[column - index];
+            accumulator += product;
+            accumulator_high = (HN_UBASE)(accumulator_high + (accumulator < product));
         }
 
-        product = 0;
-        temp_ptr = result_buffer + index;
-        for (right_index = 0; right_index < right_size; ++right_index, ++temp_ptr)
-        {
-            /* Multiple "digit" from the left with the one the left. */
-            product >>= HN_SHIFT;
-            product += (HN_UBASE2)left_buffer[index] * (HN_UBASE2)right_buffer[right_index] + *temp_ptr;
-
-            /* The result (in product) could be two parts: the top digit the the lower digit. */
-            /* Accumulate the lower digit into the "bucket" and the top digit to the next "bucket". */
-            *temp_ptr = (product & HN_MASK);
-        }
-        *temp_ptr = (HN_UBASE)((product >> HN_SHIFT));
+        /* Store the low digit and move the remaining two digits down for the next column. */
+        result_buffer[column] = (HN_UBASE)(accumulator & HN_MASK);
+        accumulator = (accumulator >> HN_SHIFT) | ((HN_UBASE2)accumulator_high << HN_SHIFT);
+        accumulator_high = 0;
     }
+    result_buffer[column] = (HN_UBASE)(accumulator & HN_MASK);
 
     /* Set is_negative. */
     if (left -> nx_crypto_huge_number_is_negative == right -> nx_crypto_huge_number_is_negative)
@@ -1253,7 +1254,8 @@ HN_UBASE *result_buffer;
 /*                                                                        */
 /*    This function computes the square of a value, and places the        */
 /*    result in the result buffer. The value buffer must be large enough  */
-/*    to hold the computed result.                                        */
+/*    to hold the computed result. The square is computed column by       */
+/*    column, and each cross product is calculated only once.             */
 /*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
@@ -1289,49 +1291,62 @@ HN_UBASE *result_buffer;
 NX_CRYPTO_KEEP VOID _nx_crypto_huge_number_square(NX_CRYPTO_HUGE_NUMBER *value, NX_CRYPTO_HUGE_NUMBER *result)
 {
 HN_UBASE2 product;
+HN_UBASE2 accumulator;
+HN_UBASE2 cross;
+HN_UBASE  accumulator_high;
+HN_UBASE  cross_high;
 UINT      value_size;
 UINT      result_size;
 HN_UBASE *value_buffer;
 HN_UBASE *result_buffer;
+UINT      column;
 UINT      i, j;
 
-    /* Using Yang et al.'s squaring algorithm. */
+    /* Column-wise squaring. In each column, the products value[i] * value[j] with i < j appear twice,
+       so they are summed once in cross and doubled before the square term value[i] ^ 2 is added.  */
     value_size = value -> nx_crypto_huge_number_size;
     result_size = (value_size << 1);
     result -> nx_crypto_huge_number_size = result_size;
     value_buffer = value -> nx_crypto_huge_number_data;
     result_buffer = result -> nx_crypto_huge_number_data;
 
-    NX_CRYPTO_MEMSET(result_buffer, 0, result_size << HN_SIZE_SHIFT);
-
-    for (i = 0; i < value_size; i++)
+    accumulator = 0;
+    accumulator_high = 0;
+    for (column = 0; column < (result_size - 1); column++)
     {
-        product = 0;
-        for (j = i + 1; j < value_size; j++)
+        i = (column < value_size) ? 0 : (column - value_size + 1);
+        j = column - i;
+
+        /* Sum the cross products of this column. */
+        cross = 0;
+        cross_high = 0;
+        for (; i < j; i++, j--)
         {
-            product >>= HN_SHIFT;
-            product += result_buffer[i + j] + (HN_UBASE2)value_buffer[i] * value_buffer[j];
-            result_buffer[i + j] = product & HN_MASK;
+            product = (HN_UBASE2)value_buffer[i] * value_buffer[j];
+            cross += product;
+            cross_high = (HN_UBASE)(cross_high + (cross < product));
         }
-        result_buffer[i + j] = (HN_UBASE)(product >> HN_SHIFT);
-    }
 
-    for (i = result_size - 1; i > 0; i--)
-    {
-        result_buffer[i] = (result_buffer[i] << 1) | (result_buffer[i - 1] >> (HN_SHIFT - 1));
-    }
-    result_buffer[0] <<= 1;
+        /* Double them. */
+        cross_high = (HN_UBASE)((cross_high << 1) | (HN_UBASE)(cross >> ((HN_SHIFT << 1) - 1)));
+        cross <<= 1;
 
-    product = 0;
-    for (i = 0; i < value_size; i++)
-    {
-        product >>= HN_SHIFT;
-        product += result_buffer[i << 1] + (HN_UBASE2)value_buffer[i] * value_buffer[i];
-        result_buffer[i << 1] = product & HN_MASK;
-        product >>= HN_SHIFT;
-        product += result_buffer[(i << 1) + 1];
-        result_buffer[(i << 1) + 1] = product & HN_MASK;
+        /* Add the square term of even columns. */
+        if (i == j)
+        {
+            product = (HN_UBASE2)value_buffer[i] * value_buffer[i];
+            cross += product;
+            cross_high = (HN_UBASE)(cross_high + (cross < product));
+        }
+
+        accumulator += cross;
+        accumulator_high = (HN_UBASE)(accumulator_high + cross_high + (accumulator < cross));
+
+        result_buffer[column] = (HN_UBASE)(accumulator & HN_MASK);
+        accumulator = (accumulator >> HN_SHIFT) | ((HN_UBASE2)accumulator_high << HN_SHIFT);
+        accumulator_high = 0;
     }
+    result_buffer[column] = (HN_UBASE)(accumulator & HN_MASK);
 
     result -> nx_crypto_huge_number_is_negative = NX_CRYPTO_FALSE;
     _nx_crypto_huge_number_adjust_size(result);
@@ -1520,7 +1535,8 @@ NX_CRYPTO_HUGE_NUMBER *result;
         }
         else
         {
-            scale = result_buffer[result_length] / (divisor_buffer[divisor_length] + 1);
+            /* Widen before adding one, or an all-ones top digit wraps to zero.  */
+            scale = result_buffer[result_length] / ((HN_UBASE2)divisor_buffer[divisor_length] + 1);
             if (scale == 0)
             {
                 scale = 1;
@@ -2139,6 +2155,8 @@ UINT      num_size_adjusted;
 /*                                                                        */
 /*    _nx_crypto_ec_fp_affine_add           Perform addition for points of*/
 /*                                            affine                      */
+/*    _nx_crypto_ec_fp_odd_multiples        Compute the odd multiples of  */
+/*                                            point                       */
 /*    _nx_crypto_ec_point_fp_projective_to_affine                         */
 /*                                          Convert point from projective */
 /*                                            to affine                   */
@@ -2413,6 +2431,9 @@ UINT                  buffer_size;
 /*                                                                        */
 /*    This function performs Montgomery reduction for multiplication.     */
 /*                  r = (x * y) * R ^ (-1) mod m                          */
+/*    The multiplication and the reduction are interleaved column by      */
+/*    column (product scanning). x and y must not be longer than m, and   */
+/*    the result must not overlap x or y.                                 */
 /*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
@@ -2456,9 +2477,12 @@ NX_CRYPTO_KEEP VOID _nx_crypto_huge_number_mont(NX_CRYPTO_HUGE_NUMBER *m, UINT m
                                                 NX_CRYPTO_HUGE_NUMBER *result)
 {
 UINT      i, j;
+UINT      column;
+UINT      last;
 HN_UBASE  u;
-HN_UBASE  xi;
 HN_UBASE2 product;
+HN_UBASE2 accumulator;
+HN_UBASE  accumulator_high;
 UINT      m_len = m -> nx_crypto_huge_number_size;
 UINT      x_len = x -> nx_crypto_huge_number_size;
 UINT      y_len = y -> nx_crypto_huge_number_size;
@@ -2467,63 +2491,56 @@ HN_UBASE *x_buffer = x -> nx_crypto_huge_number_data;
 HN_UBASE *y_buffer = y -> nx_crypto_huge_number_data;
 HN_UBASE *result_buffer = result -> nx_crypto_huge_number_data;
 
-    NX_CRYPTO_MEMSET(result -> nx_crypto_huge_number_data, 0, (m_len + 1) * sizeof(HN_UBASE));
-
-    for (i = 0; i < x_len; i++)
+    /* r = (x * y + u * m) / radix ^ m_len, computed one column at a time (product scanning).
+       Column k sums x[i] * y[k - i] and u[i] * m[k - i] in a three-digit accumulator. In the first m_len
+       columns, u[k] is chosen to clear the low digit of the column, and it is kept in result[k] until
+       the last column that uses it. The following columns produce the digits of r.  */
+    accumulator = 0;
+    accumulator_high = 0;
+    for (column = 0; column < (m_len << 1); column++)
     {
 
-        xi = x_buffer[i];
-
-        /* r = (r + x[i] * y + u * m) / radix */
-        product = 0;
-        for (j = 0; j < y_len; j++)
-        {
-            product >>= HN_SHIFT;
-            product += result_buffer[j] + (HN_UBASE2)xi * y_buffer[j];
-            result_buffer[j] = (product & HN_MASK);
-        }
-        for (; j < (m_len + 1); j++)
+        /* x[i] * y[column - i] */
+        i = (column < y_len) ? 0 : (column - y_len + 1);
+        last = (column < x_len) ? column : (x_len - 1);
+        for (; i <= last; i++)
         {
-            product >>= HN_SHIFT;
-            product += result_buffer[j];
-            result_buffer[j] = (product & HN_MASK);
+            product = (HN_UBASE2)x_buffer[i] * y_buffer[column - i];
+            accumulator += product;
+            accumulator_high = (HN_UBASE)(accumulator_high + (accumulator < product));
         }
 
-        /* u = (r[0] + x[i] * y[0]) * mi mod radix */
-        u = result_buffer[0] * mi;
-
-        product = result_buffer[0] + (HN_UBASE2)u * m_buffer[0];
-        for (j = 1; j < m_len; j++)
+        /* u[j] * m[column - j], for the u digits already known. */
+        j = (column < m_len) ? 0 : (column - m_len + 1);
+        last = (column < m_len) ? column : m_len;
+        for (; j < last; j++)
         {
-            product >>= HN_SHIFT;
-            product += result_buffer[j] + (HN_UBASE2)u * m_buffer[j];
-            result_buffer[j - 1] = (product & HN_MASK);
+            product = (HN_UBASE2)result_buffer[j] * m_buffer[column - j];
+            accumulator += product;
+            accumulator_high = (HN_UBASE)(accumulator_high + (accumulator < product));
         }
-        product >>= HN_SHIFT;
-        product += result_buffer[j];
-        result_buffer[j - 1] = (product & HN_MASK);
-        result_buffer[j] = (HN_UBASE)(product >> HN_SHIFT);
-    }
 
-    for (; i < m_len; i++)
-    {
-
-        /* u = (r[0] + x[i] * y[0]) * mi mod radix */
-        u = ((result_buffer[0] * mi) & HN_MASK);
+        if (column < m_len)
+        {
 
-        /* r = (r + x[i] * y + u * m) / radix */
-        product = result_buffer[0] + (HN_UBASE2)u * m_buffer[0];
-        for (j = 1; j < m_len; j++)
+            /* u = r[0] * mi mod radix, which makes the low digit of the column zero. */
+            u = (HN_UBASE)(((HN_UBASE)accumulator * mi) & HN_MASK);
+            result_buffer[column] = u;
+            product = (HN_UBASE2)u * m_buffer[0];
+            accumulator += product;
+            accumulator_high = (HN_UBASE)(accumulator_high + (accumulator < product));
+        }
+        else
         {
-            product >>= HN_SHIFT;
-            product += result_buffer[j] + (HN_UBASE2)u * m_buffer[j];
-            result_buffer[j - 1] = (product & HN_MASK);
+
+            /* u[column - m_len] is no longer needed. */
+            result_buffer[column - m_len] = (HN_UBASE)(accumulator & HN_MASK);
         }
-        product >>= HN_SHIFT;
-        product += result_buffer[j];
-        result_buffer[j - 1] = (product & HN_MASK);
-        result_buffer[j] = (HN_UBASE)(product >> HN_SHIFT);
+
+        accumulator = (accumulator >> HN_SHIFT) | ((HN_UBASE2)accumulator_high << HN_SHIFT);
+        accumulator_high = 0;
     }
+    result_buffer[m_len] = (HN_UBASE)(accumulator & HN_MASK);
 
     /* Set result size. */
     result -> nx_crypto_huge_number_size = m_len + 1;
@@ -2552,8 +2569,12 @@ HN_UBASE *result_buffer = result -> nx_crypto_huge_number_data;
 /*    This function raises a huge number to the power of a second huge    */
 /*    number using a third huge number as a modulus. The result is placed */
 /*    in a fourth huge number. Montgomery reduction is used.              */
-/*    scratch is required to be larger than twice of buffer size of m     */
-/*    plus 8 bytes.                                                       */
+/*    The exponent is scanned with a sliding window sized by its length,  */
+/*    up to NX_CRYPTO_HUGE_NUMBER_MONT_WINDOW_MAX bits. Exponents of at   */
+/*    most 23 bits are processed bit by bit without a table. scratch is   */
+/*    required to be no less than                                         */
+/*    NX_CRYPTO_HUGE_NUMBER_MONT_POWER_MODULUS_SCRATCH_SIZE of the buffer */
+/*    size of m.                                                          */
 /*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
@@ -2570,6 +2591,7 @@ HN_UBASE *result_buffer = result -> nx_crypto_huge_number_data;
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
+/*    NX_CRYPTO_HUGE_NUMBER_BIT             Get bit of huge number        */
 /*    NX_CRYPTO_HUGE_NUMBER_COPY            Copy huge number              */
 /*    NX_CRYPTO_HUGE_NUMBER_INITIALIZE      Initialize the buffer of      */
 /*                                            huge number                 */
@@ -2613,7 +2635,7 @@ NX_CRYPTO_KEEP VOID _nx_crypto_huge_number_mont_power_modulus(NX_CRYPTO_HUGE_NUM
                                                               HN_UBASE *scratch)
 {
 UINT                   m_len;
-NX_CRYPTO_HUGE_NUMBER  xx;
+NX_CRYPTO_HUGE_NUMBER  table[1 << (NX_CRYPTO_HUGE_NUMBER_MONT_WINDOW_MAX - 1)];
 NX_CRYPTO_HUGE_NUMBER  temp;
 NX_CRYPTO_HUGE_NUMBER  digit;
 NX_CRYPTO_HUGE_NUMBER  radix;
@@ -2624,7 +2646,13 @@ HN_UBASE              *val;
 HN_UBASE               radix_buffer[2] = {0, 1};
 HN_UBASE               mm_buffer[2];
 HN_UBASE               cur_block;
-UINT                   bit, exp_size;
+UINT                   exp_bits;
+UINT                   window_size;
+UINT                   table_size;
+UINT                   window;
+UINT                   first;
+UINT                   i;
+INT                    bit, low_bit;
 NX_CRYPTO_HUGE_NUMBER *operand, *temp_result, *temp_swap;
 
     /* Adjust sizes before performing the calculation. */
@@ -2648,10 +2676,50 @@ NX_CRYPTO_HUGE_NUMBER *operand, *temp_result, *temp_swap;
     _nx_crypto_huge_number_inverse_modulus(&m0, &radix, &mi, scratch);
     mm_buffer[0] = (HN_UBASE)(HN_RADIX - mm_buffer[0]);
 
+    /* Number of bits in the exponent. */
+    exp_bits = (e -> nx_crypto_huge_number_size - 1) * NX_CRYPTO_HUGE_NUMBER_BITS;
+    for (cur_block = e -> nx_crypto_huge_number_data[e -> nx_crypto_huge_number_size - 1];
+         cur_block != 0; cur_block >>= 1)
+    {
+        exp_bits++;
+    }
+
+    /* Choose the window by the length of the exponent. Short exponents such as 65537
+       are processed one bit at a time, which needs no table of odd powers. */
+    if (exp_bits > 671)
+    {
+        window_size = 6;
+    }
+    else if (exp_bits > 239)
+    {
+        window_size = 5;
+    }
+    else if (exp_bits > 79)
+    {
+        window_size = 4;
+    }
+    else if (exp_bits > 23)
+    {
+        window_size = 3;
+    }
+    else
+    {
+        window_size = 1;
+    }
+
+    if (window_size > NX_CRYPTO_HUGE_NUMBER_MONT_WINDOW_MAX)
+    {
+        window_size = NX_CRYPTO_HUGE_NUMBER_MONT_WINDOW_MAX;
+    }
+    table_size = 1u << (window_size - 1);
+
     /* Set buffers. */
-    /* Buffer usage: 2 * buffer_size of m + 8 */
-    NX_CRYPTO_HUGE_NUMBER_INITIALIZE(&xx, scratch, m -> nx_crypto_huge_buffer_size + sizeof(HN_UBASE));
+    /* Buffer usage: (table_size + 1) * (buffer_size of m + 4) */
     NX_CRYPTO_HUGE_NUMBER_INITIALIZE(&temp, scratch, m -> nx_crypto_huge_buffer_size + sizeof(HN_UBASE));
+    for (i = 0; i < table_size; i++)
+    {
+        NX_CRYPTO_HUGE_NUMBER_INITIALIZE(&table[i], scratch, m -> nx_crypto_huge_buffer_size + sizeof(HN_UBASE));
+    }
     NX_CRYPTO_HUGE_NUMBER_INITIALIZE_DIGIT(&digit, &digit_value, 1);
 
 
@@ -2663,43 +2731,74 @@ NX_CRYPTO_HUGE_NUMBER *operand, *temp_result, *temp_swap;
     val[m_len] = 1;
     _nx_crypto_huge_number_modulus(&temp, m);
 
-    /* xx = mont(x, radix ^ (2 * m_len) mod m)*/
+    /* table[0] = mont(x, radix ^ (2 * m_len) mod m) */
     _nx_crypto_huge_number_square(&temp, result);
     _nx_crypto_huge_number_modulus(result, m);
-    _nx_crypto_huge_number_mont(m, mm_buffer[0], x, result, &xx);
+    _nx_crypto_huge_number_mont(m, mm_buffer[0], x, result, &table[0]);
+
+    /* table[i] = x ^ (2 * i + 1) in Montgomery form. */
+    if (table_size > 1)
+    {
+
+        /* result = x ^ 2 */
+        _nx_crypto_huge_number_mont(m, mm_buffer[0], &table[0], &table[0], result);
+        for (i = 1; i < table_size; i++)
+        {
+            _nx_crypto_huge_number_mont(m, mm_buffer[0], &table[i - 1], result, &table[i]);
+        }
+    }
 
     /* result = x' */
     NX_CRYPTO_HUGE_NUMBER_COPY(result, &temp);
 
-    /* Clear out the result since we need it to start with a simple value. */
-
     operand = result;
     temp_result = &temp;
 
-    exp_size = e -> nx_crypto_huge_number_size;
-    val = e -> nx_crypto_huge_number_data + (exp_size - 1);
-
-    /* Loop through the bits of the exponent. For each bit set, multiply the result by the running square. */
-    for (; (ULONG)val >= (ULONG)(e -> nx_crypto_huge_number_data); val--)
+    /* Scan the exponent from the most significant bit. Each window starts and ends with a set bit,
+       and is applied as one multiplication by the odd power in the table. */
+    first = NX_CRYPTO_TRUE;
+    bit = (INT)exp_bits - 1;
+    while (bit >= 0)
     {
-        /* Current byte in the exponent determines whether we multiply or not. */
-        cur_block = *val;
+        if (NX_CRYPTO_HUGE_NUMBER_BIT(e, (UINT)bit) == 0)
+        {
+
+            /* result = mont(result, result) */
+            _nx_crypto_huge_number_mont(m, mm_buffer[0], operand, operand, temp_result);
+            temp_swap = temp_result;
+            temp_result = operand;
+            operand = temp_swap;
+            bit--;
+            continue;
+        }
 
-        /* Loop over the bits in the current byte to see whether we add or not. */
-        for (bit = 0; bit < HN_SHIFT; bit++)
+        /* Find the lowest set bit within the window. */
+        low_bit = bit - (INT)window_size + 1;
+        if (low_bit < 0)
         {
+            low_bit = 0;
+        }
+        while (NX_CRYPTO_HUGE_NUMBER_BIT(e, (UINT)low_bit) == 0)
+        {
+            low_bit++;
+        }
 
-            /* A non-zero bit means we need to multiply. */
-            if (cur_block & (1u << (NX_CRYPTO_HUGE_NUMBER_BITS - (1 + bit))))
-            {
+        window = 0;
+        for (i = (UINT)bit + 1; i > (UINT)low_bit; i--)
+        {
+            window = (window << 1) | (UINT)NX_CRYPTO_HUGE_NUMBER_BIT(e, i - 1);
+        }
 
-                /* result = mont(result, result) */
-                _nx_crypto_huge_number_mont(m, mm_buffer[0], operand, operand, temp_result);
+        if (first)
+        {
 
-                /* result = mont(result, xx) */
-                _nx_crypto_huge_number_mont(m, mm_buffer[0], temp_result, &xx, operand);
-            }
-            else
+            /* The leading window needs no squaring. */
+            NX_CRYPTO_HUGE_NUMBER_COPY(operand, &table[window >> 1]);
+            first = NX_CRYPTO_FALSE;
+        }
+        else
+        {
+            for (i = (UINT)low_bit; i <= (UINT)bit; i++)
             {
 
                 /* result = mont(result, result) */
@@ -2708,7 +2807,15 @@ NX_CRYPTO_HUGE_NUMBER *operand, *temp_result, *temp_swap;
                 temp_result = operand;
                 operand = temp_swap;
             }
+
+            /* result = mont(result, x ^ window) */
+            _nx_crypto_huge_number_mont(m, mm_buffer[0], operand, &table[window >> 1], temp_result);
+            temp_swap = temp_result;
+            temp_result = operand;
+            operand = temp_swap;
         }
+
+        bit = low_bit - 1;
     }
 
     /* result = mont(result, 1) */
@@ -2739,8 +2846,9 @@ NX_CRYPTO_HUGE_NUMBER *operand, *temp_result, *temp_swap;
 /*    Requirement:                                                        */
 /*      1. m = p * q                                                      */
 /*      2. p and q are primes                                             */
-/*      3. scratch is required to be no less than 4 times of buffer size  */
-/*    of m plus 24 bytes.                                                 */
+/*      3. scratch is required to be no less than                         */
+/*    NX_CRYPTO_HUGE_NUMBER_CRT_POWER_MODULUS_SCRATCH_SIZE of the buffer  */
+/*    size of m.                                                          */
 /*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
@@ -2852,7 +2960,7 @@ HN_UBASE               digit_value;
     /* m1 = xp ^ ep mod p */
     m1 = &temp1;
 
-    /* Buffer usage: 1 * buffer_size of m + 8 bytes */
+    /* Buffer usage: NX_CRYPTO_HUGE_NUMBER_MONT_POWER_MODULUS_SCRATCH_SIZE of buffer_size of p */
     _nx_crypto_huge_number_mont_power_modulus(xp, ep, p, m1, scratch);
 
     /* m1 * qi * q */
@@ -2876,7 +2984,7 @@ HN_UBASE               digit_value;
     /* m2 = xq ^ eq mod q */
     m2 = &temp1;
 
-    /* Buffer usage: 1 * buffer_size of m + 8 bytes */
+    /* Buffer usage: NX_CRYPTO_HUGE_NUMBER_MONT_POWER_MODULUS_SCRATCH_SIZE of buffer_size of q */
     _nx_crypto_huge_number_mont_power_modulus(xq, eq, q, m2, scratch);
 
     /* pi * p * m2 */
@@ -275,14 +275,14 @@ NX_CRYPTO_KEEP void* _nx_crypto_self_test_memmove(void *dest, const void *src, s
     from = (char*)src;
     to = (char*)dest;
 
-    if((ULONG)dest < (ULONG)src)
+    if((ALIGN_TYPE)dest < (ALIGN_TYPE)src)
     {
         for(i = 0; i < size; i++)
         {
             to[i] = from[i];
         }
     }
-    else if((ULONG)dest > (ULONG)src)
+    else if((ALIGN_TYPE)dest > (ALIGN_TYPE)src)
     {
 
         for(i = size; i != 0; i--)
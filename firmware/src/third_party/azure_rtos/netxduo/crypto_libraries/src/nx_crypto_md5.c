@@ -618,7 +618,7 @@ NX_CRYPTO_KEEP UINT  _nx_crypto_method_md5_init(struct  NX_CRYPTO_METHOD_STRUCT
         return(NX_CRYPTO_PTR_ERROR);
 #endif
     }
-    else if (((((ULONG)crypto_metadata) & 0x3) != 0) || (crypto_metadata_size < sizeof(NX_CRYPTO_MD5)))
+    else if (((((ALIGN_TYPE)crypto_metadata) & 0x3) != 0) || (crypto_metadata_size < sizeof(NX_CRYPTO_MD5)))
     {
         return(NX_CRYPTO_PTR_ERROR);
     }
@@ -786,7 +786,7 @@ NX_CRYPTO_MD5 metadata;
         return(NX_CRYPTO_PTR_ERROR);
 #endif
     }
-    else if (((((ULONG)crypto_metadata) & 0x3) != 0) || (crypto_metadata_size < sizeof(NX_CRYPTO_MD5)))
+    else if (((((ALIGN_TYPE)crypto_metadata) & 0x3) != 0) || (crypto_metadata_size < sizeof(NX_CRYPTO_MD5)))
     {
         return(NX_CRYPTO_PTR_ERROR);
     }
@@ -60,6 +60,7 @@ extern NX_CRYPTO_METHOD crypto_method_ecdsa;
 extern NX_CRYPTO_METHOD crypto_method_pkcs1;
 extern NX_CRYPTO_METHOD crypto_method_ecdh;
 extern NX_CRYPTO_METHOD crypto_method_ecdhe;
+extern NX_CRYPTO_METHOD crypto_method_chacha20_poly1305;
 
 const CHAR nx_crypto_hash_key[] = "EL_CRYPTO_VERSION_5.12   _FOR_FIPS";
 const UINT nx_crypto_hash_key_size = sizeof(nx_crypto_hash_key) << 3;
@@ -218,6 +219,12 @@ UINT status;
     status = _nx_crypto_method_self_test_ecdh(&crypto_method_ecdhe, metadata, metadata_size);
     NX_CRYPTO_FUNCTIONAL_TEST_CHECK(status)
 
+    status = _nx_crypto_method_self_test_x25519(&crypto_method_ecdhe, metadata, metadata_size);
+    NX_CRYPTO_FUNCTIONAL_TEST_CHECK(status)
+
+    status = _nx_crypto_method_self_test_chacha20_poly1305(&crypto_method_chacha20_poly1305, metadata, metadata_size);
+    NX_CRYPTO_FUNCTIONAL_TEST_CHECK(status)
+
     /* Clear the POST-inprogress flag */
     _nx_crypto_library_state = _nx_crypto_library_state & (~NX_CRYPTO_LIBRARY_STATE_POST_IN_PROGRESS);
 
@@ -0,0 +1,391 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Crypto Component                                                 */
+/**                                                                       */
+/**   Crypto Self Test                                                    */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_CRYPTO_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+#include "nx_crypto_method_self_test.h"
+
+
+#ifdef NX_CRYPTO_SELF_TEST
+
+/* Test vector from RFC 8439, section 2.8.2.  */
+/* 808182838485868788898A8B8C8D8E8F909192939495969798999A9B9C9D9E9F */
+static UCHAR key_1[] = {
+0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D, 0x8E, 0x8F, 
+0x90, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9A, 0x9B, 0x9C, 0x9D, 0x9E, 0x9F, 
+};
+
+/* Nonce length followed by the 12-byte nonce. */
+static UCHAR iv_1[] = {
+0x0C, 0x07, 0x00, 0x00, 0x00, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 
+};
+
+/* 50515253C0C1C2C3C4C5C6C7 */
+static UCHAR aad_1[] = {
+0x50, 0x51, 0x52, 0x53, 0xC0, 0xC1, 0xC2, 0xC3, 0xC4, 0xC5, 0xC6, 0xC7, 
+};
+
+/* 4C616469657320616E642047656E746C656D656E206F662074686520636C617373206F66202739393A204966204920636F756C64206F6666657220796F75206F6E6C79206F6E652074697020666F7220746865206675747572652C2073756E73637265656E20776F756C642062652069742E */
+static UCHAR plain_1[] = {
+0x4C, 0x61, 0x64, 0x69, 0x65, 0x73, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x47, 0x65, 0x6E, 0x74, 0x6C, 
+0x65, 0x6D, 0x65, 0x6E, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6C, 0x61, 0x73, 
+0x73, 0x20, 0x6F, 0x66, 0x20, 0x27, 0x39, 0x39, 0x3A, 0x20, 0x49, 0x66, 0x20, 0x49, 0x20, 0x63, 
+0x6F, 0x75, 0x6C, 0x64, 0x20, 0x6F, 0x66, 0x66, 0x65, 0x72, 0x20, 0x79, 0x6F, 0x75, 0x20, 0x6F, 
+0x6E, 0x6C, 0x79, 0x20, 0x6F, 0x6E, 0x65, 0x20, 0x74, 0x69, 0x70, 0x20, 0x66, 0x6F, 0x72, 0x20, 
+0x74, 0x68, 0x65, 0x20, 0x66, 0x75, 0x74, 0x75, 0x72, 0x65, 0x2C, 0x20, 0x73, 0x75, 0x6E, 0x73, 
+0x63, 0x72, 0x65, 0x65, 0x6E, 0x20, 0x77, 0x6F, 0x75, 0x6C, 0x64, 0x20, 0x62, 0x65, 0x20, 0x69, 
+0x74, 0x2E, 
+};
+
+/* D31A8D34648E60DB7B86AFBC53EF7EC2A4ADED51296E08FEA9E2B5A736EE62D63DBEA45E8CA9671282FAFB69DA92728B1A71DE0A9E060B2905D6A5B67ECD3B3692DDBD7F2D778B8C9803AEE328091B58FAB324E4FAD675945585808B4831D7BC3FF4DEF08E4B7A9DE576D26586CEC64B61161AE10B594F09E26A7E902ECBD0600691 */
+static UCHAR secret_1[] = {
+0xD3, 0x1A, 0x8D, 0x34, 0x64, 0x8E, 0x60, 0xDB, 0x7B, 0x86, 0xAF, 0xBC, 0x53, 0xEF, 0x7E, 0xC2, 
+0xA4, 0xAD, 0xED, 0x51, 0x29, 0x6E, 0x08, 0xFE, 0xA9, 0xE2, 0xB5, 0xA7, 0x36, 0xEE, 0x62, 0xD6, 
+0x3D, 0xBE, 0xA4, 0x5E, 0x8C, 0xA9, 0x67, 0x12, 0x82, 0xFA, 0xFB, 0x69, 0xDA, 0x92, 0x72, 0x8B, 
+0x1A, 0x71, 0xDE, 0x0A, 0x9E, 0x06, 0x0B, 0x29, 0x05, 0xD6, 0xA5, 0xB6, 0x7E, 0xCD, 0x3B, 0x36, 
+0x92, 0xDD, 0xBD, 0x7F, 0x2D, 0x77, 0x8B, 0x8C, 0x98, 0x03, 0xAE, 0xE3, 0x28, 0x09, 0x1B, 0x58, 
+0xFA, 0xB3, 0x24, 0xE4, 0xFA, 0xD6, 0x75, 0x94, 0x55, 0x85, 0x80, 0x8B, 0x48, 0x31, 0xD7, 0xBC, 
+0x3F, 0xF4, 0xDE, 0xF0, 0x8E, 0x4B, 0x7A, 0x9D, 0xE5, 0x76, 0xD2, 0x65, 0x86, 0xCE, 0xC6, 0x4B, 
+0x61, 0x16, 0x1A, 0xE1, 0x0B, 0x59, 0x4F, 0x09, 0xE2, 0x6A, 0x7E, 0x90, 0x2E, 0xCB, 0xD0, 0x60, 
+0x06, 0x91, 
+};
+
+/* Output buffer, large enough for the ciphertext and the tag.  */
+static UCHAR output[sizeof(secret_1)];
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    nx_crypto_method_self_test_chacha20_poly1305        PORTABLE C      */
+/*                                                           6.1          */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function performs the Known Answer Test for ChaCha20-Poly1305  */
+/*    crypto method.                                                      */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    method_ptr                            Pointer to the crypto method  */
+/*                                            to be tested.               */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP UINT _nx_crypto_method_self_test_chacha20_poly1305(NX_CRYPTO_METHOD *crypto_method_chacha20_poly1305,
+                                                                  VOID *metadata, UINT metadata_size)
+{
+UINT    status;
+UINT    icv_len;
+VOID   *handler = NX_CRYPTO_NULL;
+
+
+    /* Validate the crypto method */
+    if(crypto_method_chacha20_poly1305 == NX_CRYPTO_NULL)
+        return(NX_CRYPTO_PTR_ERROR);
+
+    icv_len = (crypto_method_chacha20_poly1305 -> nx_crypto_ICV_size_in_bits >> 3);
+
+    if (crypto_method_chacha20_poly1305 -> nx_crypto_init)
+    {
+        status = crypto_method_chacha20_poly1305 -> nx_crypto_init(crypto_method_chacha20_poly1305,
+                                                                   key_1,
+                                                                   (NX_CRYPTO_KEY_SIZE)(sizeof(key_1) << 3),
+                                                                   &handler,
+                                                                   metadata,
+                                                                   metadata_size);
+
+        if (status != NX_CRYPTO_SUCCESS)
+        {
+            return(status);
+        }
+    }
+
+    if (crypto_method_chacha20_poly1305 -> nx_crypto_operation == NX_CRYPTO_NULL)
+    {
+        return(NX_CRYPTO_PTR_ERROR);
+    }
+
+    /* Set the additional data used by the Encrypt and Decrypt operations.  */
+    status = crypto_method_chacha20_poly1305 -> nx_crypto_operation(NX_CRYPTO_SET_ADDITIONAL_DATA,
+                                                                    handler,
+                                                                    crypto_method_chacha20_poly1305,
+                                                                    NX_CRYPTO_NULL,
+                                                                    0,
+                                                                    aad_1,
+                                                                    sizeof(aad_1),
+                                                                    NX_CRYPTO_NULL,
+                                                                    NX_CRYPTO_NULL,
+                                                                    0,
+                                                                    metadata,
+                                                                    metadata_size,
+                                                                    NX_CRYPTO_NULL, NX_CRYPTO_NULL);
+
+    /* Check the status.  */
+    if(status != NX_CRYPTO_SUCCESS)
+    {
+        return(status);
+    }
+
+    /* Reset the output buffer.  */
+    NX_CRYPTO_MEMSET(output, 0xFF, sizeof(output));
+
+    /* Test ChaCha20-Poly1305 with Encrypt operation.  */
+    status = crypto_method_chacha20_poly1305 -> nx_crypto_operation(NX_CRYPTO_ENCRYPT,
+                                                                    handler,
+                                                                    crypto_method_chacha20_poly1305,
+                                                                    key_1,
+                                                                    (sizeof(key_1) << 3),
+                                                                    plain_1,
+                                                                    sizeof(plain_1),
+                                                                    iv_1,
+                                                                    output,
+                                                                    sizeof(output),
+                                                                    metadata,
+                                                                    metadata_size,
+                                                                    NX_CRYPTO_NULL, NX_CRYPTO_NULL);
+
+    /* Check the status.  */
+    if(status != NX_CRYPTO_SUCCESS)
+    {
+        return(status);
+    }
+
+    /* Validate the output.  */
+    if(NX_CRYPTO_MEMCMP(output, secret_1, sizeof(secret_1)) != 0)
+    {
+        return(NX_CRYPTO_NOT_SUCCESSFUL);
+    }
+
+    /* Reset the output buffer.  */
+    NX_CRYPTO_MEMSET(output, 0xFF, sizeof(output));
+
+    /* Test ChaCha20-Poly1305 with Decrypt operation.  */
+    status = crypto_method_chacha20_poly1305 -> nx_crypto_operation(NX_CRYPTO_DECRYPT,
+                                                                    handler,
+                                                                    crypto_method_chacha20_poly1305,
+                                                                    key_1,
+                                                                    (sizeof(key_1) << 3),
+                                                                    secret_1,
+                                                                    sizeof(secret_1),
+                                                                    iv_1,
+                                                                    output,
+                                                                    sizeof(output),
+                                                                    metadata,
+                                                                    metadata_size,
+                                                                    NX_CRYPTO_NULL, NX_CRYPTO_NULL);
+
+    /* Check the status.  */
+    if(status != NX_CRYPTO_SUCCESS)
+    {
+        return(status);
+    }
+
+    /* Validate the output.  */
+    if(NX_CRYPTO_MEMCMP(output, plain_1, sizeof(plain_1)) != 0)
+    {
+        return(NX_CRYPTO_NOT_SUCCESSFUL);
+    }
+
+    /* Reset the output buffer.  */
+    NX_CRYPTO_MEMSET(output, 0xFF, sizeof(output));
+
+    /* Test ChaCha20-Poly1305 with Initialize, Update and Calculate operation.
+       The first update is not a multiple of the block size, to cover the key
+       stream and Poly1305 carry between updates.  */
+    status = crypto_method_chacha20_poly1305 -> nx_crypto_operation(NX_CRYPTO_ENCRYPT_INITIALIZE,
+                                                                    handler,
+                                                                    crypto_method_chacha20_poly1305,
+                                                                    key_1,
+                                                                    (sizeof(key_1) << 3),
+                                                                    aad_1,
+                                                                    sizeof(aad_1),
+                                                                    iv_1,
+                                                                    NX_CRYPTO_NULL,
+                                                                    sizeof(plain_1),
+                                                                    metadata,
+                                                                    metadata_size,
+                                                                    NX_CRYPTO_NULL, NX_CRYPTO_NULL);
+
+    /* Check the status.  */
+    if(status != NX_CRYPTO_SUCCESS)
+    {
+        return(status);
+    }
+
+    status = crypto_method_chacha20_poly1305 -> nx_crypto_operation(NX_CRYPTO_ENCRYPT_UPDATE,
+                                                                    handler,
+                                                                    crypto_method_chacha20_poly1305,
+                                                                    NX_CRYPTO_NULL,
+                                                                    0,
+                                                                    plain_1,
+                                                                    37,
+                                                                    NX_CRYPTO_NULL,
+                                                                    output,
+                                                                    37,
+                                                                    metadata,
+                                                                    metadata_size,
+                                                                    NX_CRYPTO_NULL, NX_CRYPTO_NULL);
+
+    /* Check the status.  */
+    if(status != NX_CRYPTO_SUCCESS)
+    {
+        return(status);
+    }
+
+    status = crypto_method_chacha20_poly1305 -> nx_crypto_operation(NX_CRYPTO_ENCRYPT_UPDATE,
+                                                                    handler,
+                                                                    crypto_method_chacha20_poly1305,
+                                                                    NX_CRYPTO_NULL,
+                                                                    0,
+                                                                    plain_1 + 37,
+                                                                    sizeof(plain_1) - 37,
+                                                                    NX_CRYPTO_NULL,
+                                                                    output + 37,
+                                                                    sizeof(plain_1) - 37,
+                                                                    metadata,
+                                                                    metadata_size,
+                                                                    NX_CRYPTO_NULL, NX_CRYPTO_NULL);
+
+    /* Check the status.  */
+    if(status != NX_CRYPTO_SUCCESS)
+    {
+        return(status);
+    }
+
+    status = crypto_method_chacha20_poly1305 -> nx_crypto_operation(NX_CRYPTO_ENCRYPT_CALCULATE,
+                                                                    handler,
+                                                                    crypto_method_chacha20_poly1305,
+                                                                    NX_CRYPTO_NULL,
+                                                                    0,
+                                                                    NX_CRYPTO_NULL,
+                                                                    0,
+                                                                    NX_CRYPTO_NULL,
+                                                                    output + sizeof(plain_1),
+                                                                    icv_len,
+                                                                    metadata,
+                                                                    metadata_size,
+                                                                    NX_CRYPTO_NULL, NX_CRYPTO_NULL);
+
+    /* Check the status.  */
+    if(status != NX_CRYPTO_SUCCESS)
+    {
+        return(status);
+    }
+
+    /* Validate the output.  */
+    if(NX_CRYPTO_MEMCMP(output, secret_1, sizeof(secret_1)) != 0)
+    {
+        return(NX_CRYPTO_NOT_SUCCESSFUL);
+    }
+
+    /* Reset the output buffer.  */
+    NX_CRYPTO_MEMSET(output, 0xFF, sizeof(output));
+
+    /* Test ChaCha20-Poly1305 with Initialize, Update and Calculate operation for decryption.  */
+    status = crypto_method_chacha20_poly1305 -> nx_crypto_operation(NX_CRYPTO_DECRYPT_INITIALIZE,
+                                                                    handler,
+                                                                    crypto_method_chacha20_poly1305,
+                                                                    key_1,
+                                                                    (sizeof(key_1) << 3),
+                                                                    aad_1,
+                                                                    sizeof(aad_1),
+                                                                    iv_1,
+                                                                    NX_CRYPTO_NULL,
+                                                                    sizeof(plain_1),
+                                                                    metadata,
+                                                                    metadata_size,
+                                                                    NX_CRYPTO_NULL, NX_CRYPTO_NULL);
+
+    /* Check the status.  */
+    if(status != NX_CRYPTO_SUCCESS)
+    {
+        return(status);
+    }
+
+    status = crypto_method_chacha20_poly1305 -> nx_crypto_operation(NX_CRYPTO_DECRYPT_UPDATE,
+                                                                    handler,
+                                                                    crypto_method_chacha20_poly1305,
+                                                                    NX_CRYPTO_NULL,
+                                                                    0,
+                                                                    secret_1,
+                                                                    sizeof(plain_1),
+                                                                    NX_CRYPTO_NULL,
+                                                                    output,
+                                                                    sizeof(plain_1),
+                                                                    metadata,
+                                                                    metadata_size,
+                                                                    NX_CRYPTO_NULL, NX_CRYPTO_NULL);
+
+    /* Check the status.  */
+    if(status != NX_CRYPTO_SUCCESS)
+    {
+        return(status);
+    }
+
+    status = crypto_method_chacha20_poly1305 -> nx_crypto_operation(NX_CRYPTO_DECRYPT_CALCULATE,
+                                                                    handler,
+                                                                    crypto_method_chacha20_poly1305,
+                                                                    NX_CRYPTO_NULL,
+                                                                    0,
+                                                                    secret_1 + sizeof(plain_1),
+                                                                    icv_len,
+                                                                    NX_CRYPTO_NULL,
+                                                                    NX_CRYPTO_NULL,
+                                                                    0,
+                                                                    metadata,
+                                                                    metadata_size,
+                                                                    NX_CRYPTO_NULL, NX_CRYPTO_NULL);
+
+    /* Check the status.  */
+    if(status != NX_CRYPTO_SUCCESS)
+    {
+        return(status);
+    }
+
+    /* Validate the output.  */
+    if(NX_CRYPTO_MEMCMP(output, plain_1, sizeof(plain_1)) != 0)
+    {
+        return(NX_CRYPTO_NOT_SUCCESSFUL);
+    }
+
+    if (crypto_method_chacha20_poly1305 -> nx_crypto_cleanup)
+    {
+        status = crypto_method_chacha20_poly1305 -> nx_crypto_cleanup(metadata);
+    }
+
+    return(status);
+}
+#endif
@@ -0,0 +1,290 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Crypto Component                                                 */
+/**                                                                       */
+/**   Crypto Self Test                                                    */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_CRYPTO_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+#include "nx_crypto_method_self_test.h"
+
+
+#ifdef NX_CRYPTO_SELF_TEST
+
+/* RFC 7748, section 6.1. */
+/* Alice's private key, a. */
+static UCHAR alice_private_key[] = {
+0x77, 0x07, 0x6d, 0x0a, 0x73, 0x18, 0xa5, 0x7d, 0x3c, 0x16, 0xc1, 0x72, 0x51, 0xb2, 0x66, 0x45,
+0xdf, 0x4c, 0x2f, 0x87, 0xeb, 0xc0, 0x99, 0x2a, 0xb1, 0x77, 0xfb, 0xa5, 0x1d, 0xb9, 0x2c, 0x2a,
+};
+
+/* Alice's public key, X25519(a, 9). */
+static UCHAR alice_public_key[] = {
+0x85, 0x20, 0xf0, 0x09, 0x89, 0x30, 0xa7, 0x54, 0x74, 0x8b, 0x7d, 0xdc, 0xb4, 0x3e, 0xf7, 0x5a,
+0x0d, 0xbf, 0x3a, 0x0d, 0x26, 0x38, 0x1a, 0xf4, 0xeb, 0xa4, 0xa9, 0x8e, 0xaa, 0x9b, 0x4e, 0x6a,
+};
+
+/* Bob's private key, b. */
+static UCHAR bob_private_key[] = {
+0x5d, 0xab, 0x08, 0x7e, 0x62, 0x4a, 0x8a, 0x4b, 0x79, 0xe1, 0x7f, 0x8b, 0x83, 0x80, 0x0e, 0xe6,
+0x6f, 0x3b, 0xb1, 0x29, 0x26, 0x18, 0xb6, 0xfd, 0x1c, 0x2f, 0x8b, 0x27, 0xff, 0x88, 0xe0, 0xeb,
+};
+
+/* Bob's public key, X25519(b, 9). */
+static UCHAR bob_public_key[] = {
+0xde, 0x9e, 0xdb, 0x7d, 0x7b, 0x7d, 0xc1, 0xb4, 0xd3, 0x5b, 0x61, 0xc2, 0xec, 0xe4, 0x35, 0x37,
+0x3f, 0x83, 0x43, 0xc8, 0x5b, 0x78, 0x67, 0x4d, 0xad, 0xfc, 0x7e, 0x14, 0x6f, 0x88, 0x2b, 0x4f,
+};
+
+/* Their shared secret, K. */
+static UCHAR shared_secret[] = {
+0x4a, 0x5d, 0x9d, 0x5b, 0xa4, 0xce, 0x2d, 0xe1, 0x72, 0x8e, 0x3b, 0xf4, 0x80, 0x35, 0x0f, 0x25,
+0xe0, 0x7e, 0x21, 0xc9, 0x47, 0xd1, 0x9e, 0x33, 0x76, 0xf0, 0x9b, 0x3c, 0x1e, 0x16, 0x17, 0x42,
+};
+
+/* A point of small order; any shared secret computed with it is zero and must be rejected. */
+static UCHAR zero_public_key[32];
+
+static UCHAR output[32];
+
+extern NX_CRYPTO_METHOD crypto_method_ec_x25519;
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_method_self_test_x25519_calculate        PORTABLE C      */
+/*                                                           6.1          */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function imports a private key into the ECDH method, computes  */
+/*    the shared secret with the given remote public key and stores it    */
+/*    in the output buffer.                                               */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    crypto_method_ecdh                    Pointer to the ECDH method    */
+/*    private_key                           Local private key             */
+/*    public_key                            Remote public key             */
+/*    metadata                              Metadata area                 */
+/*    metadata_size                         Metadata area size            */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_crypto_method_self_test_x25519    X25519 Known Answer Test      */
+/*                                                                        */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP static UINT _nx_crypto_method_self_test_x25519_calculate(NX_CRYPTO_METHOD *crypto_method_ecdh,
+                                                                         UCHAR *private_key, UCHAR *public_key,
+                                                                         VOID *metadata, UINT metadata_size)
+{
+UINT status;
+NX_CRYPTO_EXTENDED_OUTPUT extended_output;
+
+    /* Call the crypto initialization function.  */
+    if (crypto_method_ecdh -> nx_crypto_init)
+    {
+        status = crypto_method_ecdh -> nx_crypto_init(crypto_method_ecdh,
+                                                      NX_CRYPTO_NULL,
+                                                      0,
+                                                      NX_CRYPTO_NULL,
+                                                      metadata,
+                                                      metadata_size);
+
+        if (status != NX_CRYPTO_SUCCESS)
+        {
+            return(status);
+        }
+    }
+
+    if (crypto_method_ecdh -> nx_crypto_operation == NX_CRYPTO_NULL)
+    {
+        return(NX_CRYPTO_PTR_ERROR);
+    }
+
+    /* Set EC curve.  */
+    status = crypto_method_ecdh -> nx_crypto_operation(NX_CRYPTO_EC_CURVE_SET,
+                                                       NX_CRYPTO_NULL,
+                                                       crypto_method_ecdh,
+                                                       NX_CRYPTO_NULL,
+                                                       0,
+                                                       (UCHAR *)&crypto_method_ec_x25519,
+                                                       sizeof(NX_CRYPTO_METHOD *),
+                                                       NX_CRYPTO_NULL,
+                                                       NX_CRYPTO_NULL,
+                                                       0,
+                                                       metadata,
+                                                       metadata_size,
+                                                       NX_CRYPTO_NULL, NX_CRYPTO_NULL);
+    if (status != NX_CRYPTO_SUCCESS)
+    {
+        return(status);
+    }
+
+    /* Import the test private key.  */
+    status = crypto_method_ecdh -> nx_crypto_operation(NX_CRYPTO_DH_KEY_PAIR_IMPORT,
+                                                       NX_CRYPTO_NULL,
+                                                       crypto_method_ecdh,
+                                                       private_key,
+                                                       (NX_CRYPTO_KEY_SIZE)(sizeof(alice_private_key) << 3),
+                                                       NX_CRYPTO_NULL,
+                                                       0,
+                                                       NX_CRYPTO_NULL,
+                                                       NX_CRYPTO_NULL,
+                                                       0,
+                                                       metadata,
+                                                       metadata_size,
+                                                       NX_CRYPTO_NULL, NX_CRYPTO_NULL);
+    if (status != NX_CRYPTO_SUCCESS)
+    {
+        return(status);
+    }
+
+    /* Calculate the shared secret.  */
+    NX_CRYPTO_MEMSET(output, 0xFF, sizeof(output));
+    extended_output.nx_crypto_extended_output_data = output;
+    extended_output.nx_crypto_extended_output_length_in_byte = sizeof(output);
+    status = crypto_method_ecdh -> nx_crypto_operation(NX_CRYPTO_DH_CALCULATE,
+                                                       NX_CRYPTO_NULL,
+                                                       crypto_method_ecdh,
+                                                       NX_CRYPTO_NULL,
+                                                       0,
+                                                       public_key,
+                                                       sizeof(alice_public_key),
+                                                       NX_CRYPTO_NULL,
+                                                       (UCHAR *)&extended_output,
+                                                       sizeof(extended_output),
+                                                       metadata,
+                                                       metadata_size,
+                                                       NX_CRYPTO_NULL, NX_CRYPTO_NULL);
+    if (status != NX_CRYPTO_SUCCESS)
+    {
+        return(status);
+    }
+
+    if (extended_output.nx_crypto_extended_output_actual_size != sizeof(shared_secret))
+    {
+        return(NX_CRYPTO_NOT_SUCCESSFUL);
+    }
+
+    if (crypto_method_ecdh -> nx_crypto_cleanup)
+    {
+        status = crypto_method_ecdh -> nx_crypto_cleanup(metadata);
+    }
+
+    return(status);
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    nx_crypto_method_self_test_x25519                   PORTABLE C      */
+/*                                                           6.1          */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function performs the Known Answer Test for X25519 key         */
+/*    exchange through the ECDH crypto method, using the test vectors of  */
+/*    RFC 7748, section 6.1. It also checks that a small-order remote     */
+/*    public key is rejected.                                             */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    method_ptr                            Pointer to the crypto method  */
+/*                                            to be tested.               */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_crypto_method_self_test_x25519_calculate                        */
+/*                                          Compute shared secret         */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP UINT _nx_crypto_method_self_test_x25519(NX_CRYPTO_METHOD *crypto_method_ecdh,
+                                                        VOID *metadata, UINT metadata_size)
+{
+UINT status;
+
+
+    /* Validate the crypto method */
+    if(crypto_method_ecdh == NX_CRYPTO_NULL)
+        return(NX_CRYPTO_PTR_ERROR);
+
+    /* Alice's side.  */
+    status = _nx_crypto_method_self_test_x25519_calculate(crypto_method_ecdh, alice_private_key, bob_public_key,
+                                                          metadata, metadata_size);
+    if (status != NX_CRYPTO_SUCCESS)
+    {
+        return(status);
+    }
+
+    if (NX_CRYPTO_MEMCMP(output, shared_secret, sizeof(shared_secret)) != 0)
+    {
+        return(NX_CRYPTO_NOT_SUCCESSFUL);
+    }
+
+    /* Bob's side.  */
+    status = _nx_crypto_method_self_test_x25519_calculate(crypto_method_ecdh, bob_private_key, alice_public_key,
+                                                          metadata, metadata_size);
+    if (status != NX_CRYPTO_SUCCESS)
+    {
+        return(status);
+    }
+
+    if (NX_CRYPTO_MEMCMP(output, shared_secret, sizeof(shared_secret)) != 0)
+    {
+        return(NX_CRYPTO_NOT_SUCCESSFUL);
+    }
+
+    /* An all-zero shared secret must not be accepted.  */
+    status = _nx_crypto_method_self_test_x25519_calculate(crypto_method_ecdh, alice_private_key, zero_public_key,
+                                                          metadata, metadata_size);
+    if (status == NX_CRYPTO_SUCCESS)
+    {
+        return(NX_CRYPTO_NOT_SUCCESSFUL);
+    }
+
+    if (crypto_method_ecdh -> nx_crypto_cleanup)
+    {
+        status = crypto_method_ecdh -> nx_crypto_cleanup(metadata);
+    }
+
+    return(status);
+}
+#endif
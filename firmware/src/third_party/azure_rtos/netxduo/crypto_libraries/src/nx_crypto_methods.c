@@ -38,11 +38,13 @@
 #include "nx_crypto_hmac_sha5.h"
 #include "nx_crypto_hmac_md5.h"
 #include "nx_crypto_aes.h"
+#include "nx_crypto_chacha20_poly1305.h"
 #include "nx_crypto_rsa.h"
 #include "nx_crypto_null.h"
 #include "nx_crypto_ecjpake.h"
 #include "nx_crypto_ecdsa.h"
 #include "nx_crypto_ecdh.h"
+#include "nx_crypto_x25519.h"
 #include "nx_crypto_drbg.h"
 #include "nx_crypto_pkcs1_v1.5.h"
 
@@ -219,6 +221,20 @@ NX_CRYPTO_METHOD crypto_method_aes_256_gcm_16 =
     _nx_crypto_method_aes_gcm_operation,         /* AES-GCM operation                      */
 };
 
+/* Declare the ChaCha20-Poly1305 encrytion method. */
+NX_CRYPTO_METHOD crypto_method_chacha20_poly1305 =
+{
+    NX_CRYPTO_ENCRYPTION_CHACHA20_POLY1305,      /* ChaCha20-Poly1305 crypto algorithm     */
+    NX_CRYPTO_CHACHA20_KEY_LEN_IN_BITS,          /* Key size in bits                       */
+    NX_CRYPTO_CHACHA20_POLY1305_IV_LEN_IN_BITS,  /* IV size in bits                        */
+    NX_CRYPTO_CHACHA20_POLY1305_ICV_LEN_IN_BITS, /* ICV size in bits                       */
+    NX_CRYPTO_CHACHA20_POLY1305_BLOCK_SIZE,      /* Block size in bytes.                   */
+    sizeof(NX_CRYPTO_CHACHA20_POLY1305),         /* Metadata size in bytes                 */
+    _nx_crypto_method_chacha20_poly1305_init,    /* ChaCha20-Poly1305 initialization.      */
+    _nx_crypto_method_chacha20_poly1305_cleanup, /* ChaCha20-Poly1305 cleanup routine.     */
+    _nx_crypto_method_chacha20_poly1305_operation /* ChaCha20-Poly1305 operation           */
+};
+
 /* Declare the AES-XCBC-MAC encrytion method. */
 NX_CRYPTO_METHOD crypto_method_aes_xcbc_mac_96 =
 {
@@ -513,6 +529,20 @@ NX_CRYPTO_METHOD crypto_method_ec_secp521 =
     _nx_crypto_method_ec_secp521r1_operation, /* Operation                              */
 };
 
+/* Declare a placeholder for X25519. */
+NX_CRYPTO_METHOD crypto_method_ec_x25519 =
+{
+    NX_CRYPTO_EC_X25519,                      /* EC placeholder                         */
+    255,                                      /* Key size in bits                       */
+    0,                                        /* IV size in bits                        */
+    0,                                        /* ICV size in bits, not used.            */
+    0,                                        /* Block size in bytes.                   */
+    0,                                        /* Metadata size in bytes                 */
+    NX_CRYPTO_NULL,                           /* Initialization routine.                */
+    NX_CRYPTO_NULL,                           /* Cleanup routine, not used.             */
+    _nx_crypto_method_ec_x25519_operation,    /* Operation                              */
+};
+
 /* Declare the public NULL cipher (not to be confused with the NULL methods above). This
  * is used as a placeholder in ciphersuites that do not use a cipher method for a
  * particular operation (e.g. some PSK ciphersuites don't use a public-key algorithm
@@ -35,7 +35,8 @@
 /*                                                                        */
 /*  DESCRIPTION                                                           */
 /*                                                                        */
-/*    This function implements phash for the crypto module.               */
+/*    This function implements phash for the crypto module. The HMAC key  */
+/*    is set once and every HMAC reuses the hash state saved for it.      */
 /*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
@@ -132,26 +133,48 @@ NX_CRYPTO_METHOD *hash_method = phash -> nx_crypto_hmac_method;
     NX_CRYPTO_MEMCPY(temp_A, seed, seed_len); /* Use case of memcpy is verified. */
     A_len = phash -> nx_crypto_phash_seed_length;
 
-    remaining_len = desired_length;
-    for (offset = 0; offset < desired_length; offset += hash_size)
+    /* Initialize the HMAC with the secret once. The padded secret is hashed here only,
+       each HMAC below starts from the hash states saved for it. */
+    if (hash_method -> nx_crypto_init)
     {
-        /* Calculate A(i) */
-        if (hash_method -> nx_crypto_init)
+        status = hash_method -> nx_crypto_init(hash_method,
+                                      secret,
+                                      (NX_CRYPTO_KEY_SIZE)(secret_len << 3),
+                                      &handler,
+                                      metadata,
+                                      metadata_size);
+
+        if(status != NX_CRYPTO_SUCCESS)
         {
-            status = hash_method -> nx_crypto_init(hash_method,
-                                          secret,
-                                          (NX_CRYPTO_KEY_SIZE)(secret_len << 3),
-                                          &handler,
-                                          metadata,
-                                          metadata_size);
-
-            if(status != NX_CRYPTO_SUCCESS)
-            {
-                return(status);
-            }                                                     
+            return(status);
         }
+    }
+
+    status = hash_method -> nx_crypto_operation(NX_CRYPTO_HASH_INITIALIZE,
+                                       handler,
+                                       hash_method,
+                                       secret,
+                                       (NX_CRYPTO_KEY_SIZE)(secret_len << 3),
+                                       NX_CRYPTO_NULL,
+                                       0,
+                                       NX_CRYPTO_NULL,
+                                       NX_CRYPTO_NULL,
+                                       0,
+                                       metadata,
+                                       metadata_size,
+                                       NX_CRYPTO_NULL,
+                                       NX_CRYPTO_NULL);
+
+    if(status != NX_CRYPTO_SUCCESS)
+    {
+        return(status);
+    }
 
-        status = hash_method -> nx_crypto_operation(NX_CRYPTO_AUTHENTICATE,
+    remaining_len = desired_length;
+    for (offset = 0; offset < desired_length; offset += hash_size)
+    {
+        /* Calculate A(i) */
+        status = hash_method -> nx_crypto_operation(NX_CRYPTO_HMAC_CACHED_AUTHENTICATE,
                                            handler,
                                            hash_method,
                                            secret,
@@ -194,7 +217,7 @@ NX_CRYPTO_METHOD *hash_method = phash -> nx_crypto_hmac_method;
         }
 
         /* Calculate p-hash block, store in output. */
-        status = hash_method -> nx_crypto_operation(NX_CRYPTO_AUTHENTICATE,
+        status = hash_method -> nx_crypto_operation(NX_CRYPTO_HMAC_CACHED_AUTHENTICATE,
                                            handler,
                                            hash_method,
                                            secret,
@@ -222,13 +245,13 @@ NX_CRYPTO_METHOD *hash_method = phash -> nx_crypto_hmac_method;
 
         /* Adjust our remaining length by the number of bytes written. */
         remaining_len -= hash_size;
+    }
 
-        status = hash_method -> nx_crypto_cleanup(metadata);
+    status = hash_method -> nx_crypto_cleanup(metadata);
 
-        if(status != NX_CRYPTO_SUCCESS)
-        {
-            return(status);
-        }                                                     
+    if(status != NX_CRYPTO_SUCCESS)
+    {
+        return(status);
     }
 
     return(NX_CRYPTO_SUCCESS);
@@ -44,6 +44,9 @@
 /*     If NULL is passed for the scratch buffer pointer, an internal      */
 /*     scratch buffer is used.                                            */
 /*                                                                        */
+/*     The scratch buffer must hold at least                              */
+/*     NX_CRYPTO_RSA_SCRATCH_SIZE(modulus_length) bytes.                  */
+/*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
 /*    exponent                              RSA exponent                  */
@@ -58,7 +61,8 @@
 /*    input_length                          Length of input in bytes      */
 /*    output                                Output buffer                 */
 /*    scratch_buf_ptr                       Pointer to scratch buffer     */
-/*    scratch_buf_length                    Length of scratch buffer      */
+/*    scratch_buf_length                    Length of scratch buffer in   */
+/*                                            number of USHORT            */
 /*                                                                        */
 /*  OUTPUT                                                                */
 /*                                                                        */
@@ -96,7 +100,11 @@ UCHAR                *scratch;
 UINT                  mod_length;
 NX_CRYPTO_HUGE_NUMBER modulus_hn, exponent_hn, input_hn, output_hn, p_hn, q_hn;
 
-    NX_CRYPTO_PARAMETER_NOT_USED(scratch_buf_length);
+    /* Check the scratch buffer against the modulus, for both CRT and non-CRT operations. */
+    if ((scratch_buf_length * sizeof(USHORT)) < NX_CRYPTO_RSA_SCRATCH_SIZE(modulus_length))
+    {
+        return(NX_CRYPTO_INVALID_BUFFER_SIZE);
+    }
 
     /* The RSA operation is reversible so both encryption and decryption can be done with the same operation. */
     /* Local pointer for pointer arithmetic. */
@@ -231,7 +239,7 @@ NX_CRYPTO_RSA *ctx;
     }
 
     /* Verify the metadata addrsss is 4-byte aligned. */
-    if((((ULONG)crypto_metadata) & 0x3) != 0)
+    if((((ALIGN_TYPE)crypto_metadata) & 0x3) != 0)
     {
         return(NX_CRYPTO_PTR_ERROR);
     }
@@ -395,7 +403,7 @@ UINT           return_value = NX_CRYPTO_SUCCESS;
     NX_CRYPTO_STATE_CHECK
 
     /* Verify the metadata addrsss is 4-byte aligned. */
-    if((method == NX_CRYPTO_NULL) || (crypto_metadata == NX_CRYPTO_NULL) || ((((ULONG)crypto_metadata) & 0x3) != 0))
+    if((method == NX_CRYPTO_NULL) || (crypto_metadata == NX_CRYPTO_NULL) || ((((ALIGN_TYPE)crypto_metadata) & 0x3) != 0))
     {
         return(NX_CRYPTO_PTR_ERROR);
     }
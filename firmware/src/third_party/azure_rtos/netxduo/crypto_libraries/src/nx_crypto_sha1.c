@@ -595,7 +595,7 @@ NX_CRYPTO_KEEP UINT  _nx_crypto_method_sha1_init(struct  NX_CRYPTO_METHOD_STRUCT
         return(NX_CRYPTO_PTR_ERROR);
 #endif
     }
-    else if (((((ULONG)crypto_metadata) & 0x3) != 0) || (crypto_metadata_size < sizeof(NX_CRYPTO_SHA1)))
+    else if (((((ALIGN_TYPE)crypto_metadata) & 0x3) != 0) || (crypto_metadata_size < sizeof(NX_CRYPTO_SHA1)))
     {
         return(NX_CRYPTO_PTR_ERROR);
     }
@@ -763,7 +763,7 @@ NX_CRYPTO_SHA1  metadata;
         return(NX_CRYPTO_PTR_ERROR);
 #endif
     }
-    else if (((((ULONG)crypto_metadata) & 0x3) != 0) || (crypto_metadata_size < sizeof(NX_CRYPTO_SHA1)))
+    else if (((((ALIGN_TYPE)crypto_metadata) & 0x3) != 0) || (crypto_metadata_size < sizeof(NX_CRYPTO_SHA1)))
     {
         return(NX_CRYPTO_PTR_ERROR);
     }
@@ -47,7 +47,18 @@ const ULONG _sha2_round_constants[64] =
 #define SMALL_SIGMA_1(x)           (RIGHT_SHIFT_CIRCULAR((x), 17) ^ RIGHT_SHIFT_CIRCULAR((x), 19) ^ ((x) >> 10))
 
 #define W0(t) ((((ULONG)buffer[(t) * 4]) << 24) | (((ULONG)buffer[((t) * 4) + 1]) << 16) | (((ULONG)buffer[((t) * 4) + 2]) << 8) | ((ULONG)buffer[((t) * 4) + 3]))
-#define W16(t) (SMALL_SIGMA_1(w[(t) - 2]) + w[(t) - 7] + SMALL_SIGMA_0(w[(t) - 15]) + w[(t) - 16])
+
+/* Expand the message schedule in a window of 16 words, where w[t] holds W(t - 16)
+   and is replaced by W(t).  */
+#define W16(t) (w[(t)] += SMALL_SIGMA_1(w[((t) + 14) & 15]) + w[((t) + 9) & 15] + SMALL_SIGMA_0(w[((t) + 1) & 15]))
+
+/* One round of SHA-256. Rather than shifting the eight state variables by one
+   position, each round is given them in rotated order.  */
+#define ROUND(a, b, c, d, e, f, g, h, t)                                                    \
+    temp1 = (h) + LARGE_SIGMA_1(e) + CH_FUNC((e), (f), (g)) + k[(t)] + w[(t)];             \
+    temp2 = LARGE_SIGMA_0(a) + MAJ_FUNC((a), (b), (c));                                     \
+    (d) += temp1;                                                                           \
+    (h) = temp1 + temp2;
 
 /* Define the padding array.  This is used to pad the message such that its length is
    64 bits shy of being a multiple of 512 bits long.  */
@@ -170,6 +181,8 @@ NX_CRYPTO_KEEP UINT  _nx_crypto_sha256_initialize(NX_CRYPTO_SHA256 *context, UIN
 /*                                                                        */
 /*    _nx_crypto_sha256_process_buffer      Process complete buffer       */
 /*                                            using SHA256                */
+/*    _nx_crypto_sha256_process_blocks      Process complete blocks of    */
+/*                                            input using SHA256          */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -244,16 +257,16 @@ ULONG needed_fill_bytes;
         current_bytes =  0;
     }
 
-    /* Process any and all whole blocks of input.  */
-    while (input_length >= 64)
+    /* Process any and all whole blocks of input directly from the caller's buffer.  */
+    if (input_length >= 64)
     {
 
-        /* Process this 64-byte (512 bit) buffer.  */
-        _nx_crypto_sha256_process_buffer(context, input_ptr);
+        /* Process these 64-byte (512 bit) buffers.  */
+        _nx_crypto_sha256_process_blocks(context, input_ptr, input_length >> 6);
 
         /* Adjust the pointers and length accordingly.  */
-        input_length =  input_length - 64;
-        input_ptr =     input_ptr + 64;
+        input_ptr =     input_ptr + (input_length & ~0x3Fu);
+        input_length =  input_length & 0x3F;
     }
 
     /* Determine if there is anything left.  */
@@ -415,7 +428,8 @@ ULONG padding_bytes;
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
-/*    None                                                                */
+/*    _nx_crypto_sha256_process_blocks      Process complete blocks of    */
+/*                                            input using SHA256          */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -436,13 +450,60 @@ ULONG padding_bytes;
 /**************************************************************************/
 NX_CRYPTO_KEEP VOID _nx_crypto_sha256_process_buffer(NX_CRYPTO_SHA256 *context, UCHAR buffer[64])
 {
-ULONG *w;
-UINT   t;
-ULONG  temp1, temp2;
-ULONG  a, b, c, d, e, f, g, h;
+
+    /* Process the single block.  */
+    _nx_crypto_sha256_process_blocks(context, buffer, 1);
+}
 
 
-    /* Setup pointers to the word array.  */
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_sha256_process_blocks                    PORTABLE C      */
+/*                                                           6.1          */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function runs the SHA256 compression function over a number   */
+/*    of consecutive 64-byte (512-bit) blocks. The state variables stay   */
+/*    in registers from one block to the next, the rounds are unrolled    */
+/*    16 at a time and the message schedule is kept in a window of 16     */
+/*    words. Word aligned input is loaded 32 bits at a time.              */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    context                               SHA256 context pointer        */
+/*    buffer                                Pointer to the blocks         */
+/*    block_count                           Number of 64-byte blocks      */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_crypto_sha256_update              Update the digest             */
+/*    _nx_crypto_sha256_process_buffer      Process complete buffer       */
+/*                                            using SHA256                */
+/*                                                                        */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP VOID _nx_crypto_sha256_process_blocks(NX_CRYPTO_SHA256 *context, UCHAR *buffer, UINT block_count)
+{
+ULONG       *w;
+const ULONG *k;
+ULONG       *word_ptr;
+UINT         t;
+ULONG        temp1, temp2;
+ULONG        a, b, c, d, e, f, g, h;
+
+
+    /* Setup pointers to the word array. Only the first 16 words are used.  */
     w =  context -> nx_sha256_word_array;
 
     /* Initialize the state variables.  */
@@ -455,126 +516,87 @@ ULONG  a, b, c, d, e, f, g, h;
     g =  context -> nx_sha256_states[6];
     h =  context -> nx_sha256_states[7];
 
-    /* Now, perform Round operations.  */
-    for (t = 0; t < 16; t += 8)
+    while (block_count)
     {
 
-        /* Setup each entry.  */
-        w[t] =  W0(t);
-        temp1 = h + LARGE_SIGMA_1(e) + CH_FUNC(e, f, g) + _sha2_round_constants[t] + w[t];
-        temp2 = LARGE_SIGMA_0(a) + MAJ_FUNC(a, b, c);
-        d = d + temp1;
-        h = temp1 + temp2;
-
-        w[t + 1] =  W0(t + 1);
-        temp1 = g + LARGE_SIGMA_1(d) + CH_FUNC(d, e, f) + _sha2_round_constants[t + 1] + w[t + 1];
-        temp2 = LARGE_SIGMA_0(h) + MAJ_FUNC(h, a, b);
-        c = c + temp1;
-        g = temp1 + temp2;
-
-        w[t + 2] =  W0(t + 2);
-        temp1 = f + LARGE_SIGMA_1(c) + CH_FUNC(c, d, e) + _sha2_round_constants[t + 2] + w[t + 2];
-        temp2 = LARGE_SIGMA_0(g) + MAJ_FUNC(g, h, a);
-        b = b + temp1;
-        f = temp1 + temp2;
-
-        w[t + 3] =  W0(t + 3);
-        temp1 = e + LARGE_SIGMA_1(b) + CH_FUNC(b, c, d) + _sha2_round_constants[t + 3] + w[t + 3];
-        temp2 = LARGE_SIGMA_0(f) + MAJ_FUNC(f, g, h);
-        a = a + temp1;
-        e = temp1 + temp2;
-
-        w[t + 4] =  W0(t + 4);
-        temp1 = d + LARGE_SIGMA_1(a) + CH_FUNC(a, b, c) + _sha2_round_constants[t + 4] + w[t + 4];
-        temp2 = LARGE_SIGMA_0(e) + MAJ_FUNC(e, f, g);
-        h = h + temp1;
-        d = temp1 + temp2;
-
-
-        w[t + 5] =  W0(t + 5);
-        temp1 = c + LARGE_SIGMA_1(h) + CH_FUNC(h, a, b) + _sha2_round_constants[t + 5] + w[t + 5];
-        temp2 = LARGE_SIGMA_0(d) + MAJ_FUNC(d, e, f);
-        g = g + temp1;
-        c = temp1 + temp2;
-
-        w[t + 6] =  W0(t + 6);
-        temp1 = b + LARGE_SIGMA_1(g) + CH_FUNC(g, h, a) + _sha2_round_constants[t + 6] + w[t + 6];
-        temp2 = LARGE_SIGMA_0(c) + MAJ_FUNC(c, d, e);
-        f = f + temp1;
-        b = temp1 + temp2;
-
-        w[t + 7] =  W0(t + 7);
-        temp1 = a + LARGE_SIGMA_1(f) + CH_FUNC(f, g, h) + _sha2_round_constants[t + 7] + w[t + 7];
-        temp2 = LARGE_SIGMA_0(b) + MAJ_FUNC(b, c, d);
-        e = e + temp1;
-        a = temp1 + temp2;
-    }
+        /* Initialize the 16 words of the message block, taking care of the
+           endian issues at the same time.  */
+        if (((ALIGN_TYPE)buffer & 3) == 0)
+        {
 
-    for (; t < 64; t += 8)
-    {
+            /* The block is word aligned, so load it a word at a time.  */
+            word_ptr = (ULONG *)buffer;
+            for (t = 0; t < 16; t++)
+            {
+                w[t] = word_ptr[t];
+                NX_CRYPTO_CHANGE_ULONG_ENDIAN(w[t]);
+            }
+        }
+        else
+        {
+            for (t = 0; t < 16; t++)
+            {
+                w[t] =  W0(t);
+            }
+        }
 
-        /* Setup each entry.  */
-        w[t] =  W16(t);
-        temp1 = h + LARGE_SIGMA_1(e) + CH_FUNC(e, f, g) + _sha2_round_constants[t] + w[t];
-        temp2 = LARGE_SIGMA_0(a) + MAJ_FUNC(a, b, c);
-        d = d + temp1;
-        h = temp1 + temp2;
-
-        w[t + 1] =  W16(t + 1);
-        temp1 = g + LARGE_SIGMA_1(d) + CH_FUNC(d, e, f) + _sha2_round_constants[t + 1] + w[t + 1];
-        temp2 = LARGE_SIGMA_0(h) + MAJ_FUNC(h, a, b);
-        c = c + temp1;
-        g = temp1 + temp2;
-
-        w[t + 2] =  W16(t + 2);
-        temp1 = f + LARGE_SIGMA_1(c) + CH_FUNC(c, d, e) + _sha2_round_constants[t + 2] + w[t + 2];
-        temp2 = LARGE_SIGMA_0(g) + MAJ_FUNC(g, h, a);
-        b = b + temp1;
-        f = temp1 + temp2;
-
-        w[t + 3] =  W16(t + 3);
-        temp1 = e + LARGE_SIGMA_1(b) + CH_FUNC(b, c, d) + _sha2_round_constants[t + 3] + w[t + 3];
-        temp2 = LARGE_SIGMA_0(f) + MAJ_FUNC(f, g, h);
-        a = a + temp1;
-        e = temp1 + temp2;
-
-        w[t + 4] =  W16(t + 4);
-        temp1 = d + LARGE_SIGMA_1(a) + CH_FUNC(a, b, c) + _sha2_round_constants[t + 4] + w[t + 4];
-        temp2 = LARGE_SIGMA_0(e) + MAJ_FUNC(e, f, g);
-        h = h + temp1;
-        d = temp1 + temp2;
-
-
-        w[t + 5] =  W16(t + 5);
-        temp1 = c + LARGE_SIGMA_1(h) + CH_FUNC(h, a, b) + _sha2_round_constants[t + 5] + w[t + 5];
-        temp2 = LARGE_SIGMA_0(d) + MAJ_FUNC(d, e, f);
-        g = g + temp1;
-        c = temp1 + temp2;
-
-        w[t + 6] =  W16(t + 6);
-        temp1 = b + LARGE_SIGMA_1(g) + CH_FUNC(g, h, a) + _sha2_round_constants[t + 6] + w[t + 6];
-        temp2 = LARGE_SIGMA_0(c) + MAJ_FUNC(c, d, e);
-        f = f + temp1;
-        b = temp1 + temp2;
-
-        w[t + 7] =  W16(t + 7);
-        temp1 = a + LARGE_SIGMA_1(f) + CH_FUNC(f, g, h) + _sha2_round_constants[t + 7] + w[t + 7];
-        temp2 = LARGE_SIGMA_0(b) + MAJ_FUNC(b, c, d);
-        e = e + temp1;
-        a = temp1 + temp2;
+        /* Now, perform Round operations, 16 rounds at a time.  */
+        for (t = 0; t < 64; t += 16)
+        {
+            k = &_sha2_round_constants[t];
+
+            if (t != 0)
+            {
+
+                /* Expand the next 16 words of the message schedule.  */
+                W16(0);  W16(1);  W16(2);  W16(3);
+                W16(4);  W16(5);  W16(6);  W16(7);
+                W16(8);  W16(9);  W16(10); W16(11);
+                W16(12); W16(13); W16(14); W16(15);
+            }
+
+            ROUND(a, b, c, d, e, f, g, h, 0);
+            ROUND(h, a, b, c, d, e, f, g, 1);
+            ROUND(g, h, a, b, c, d, e, f, 2);
+            ROUND(f, g, h, a, b, c, d, e, 3);
+            ROUND(e, f, g, h, a, b, c, d, 4);
+            ROUND(d, e, f, g, h, a, b, c, 5);
+            ROUND(c, d, e, f, g, h, a, b, 6);
+            ROUND(b, c, d, e, f, g, h, a, 7);
+            ROUND(a, b, c, d, e, f, g, h, 8);
+            ROUND(h, a, b, c, d, e, f, g, 9);
+            ROUND(g, h, a, b, c, d, e, f, 10);
+            ROUND(f, g, h, a, b, c, d, e, 11);
+            ROUND(e, f, g, h, a, b, c, d, 12);
+            ROUND(d, e, f, g, h, a, b, c, 13);
+            ROUND(c, d, e, f, g, h, a, b, 14);
+            ROUND(b, c, d, e, f, g, h, a, 15);
+        }
 
+        /* Add this block's result to the chaining state.  */
+        a +=  context -> nx_sha256_states[0];
+        b +=  context -> nx_sha256_states[1];
+        c +=  context -> nx_sha256_states[2];
+        d +=  context -> nx_sha256_states[3];
+        e +=  context -> nx_sha256_states[4];
+        f +=  context -> nx_sha256_states[5];
+        g +=  context -> nx_sha256_states[6];
+        h +=  context -> nx_sha256_states[7];
+
+        /* Save the resulting in this SHA256 context.  */
+        context -> nx_sha256_states[0] =  a;
+        context -> nx_sha256_states[1] =  b;
+        context -> nx_sha256_states[2] =  c;
+        context -> nx_sha256_states[3] =  d;
+        context -> nx_sha256_states[4] =  e;
+        context -> nx_sha256_states[5] =  f;
+        context -> nx_sha256_states[6] =  g;
+        context -> nx_sha256_states[7] =  h;
+
+        buffer += 64;
+        block_count--;
     }
 
-    /* Save the resulting in this SHA256 context.  */
-    context -> nx_sha256_states[0] +=  a;
-    context -> nx_sha256_states[1] +=  b;
-    context -> nx_sha256_states[2] +=  c;
-    context -> nx_sha256_states[3] +=  d;
-    context -> nx_sha256_states[4] +=  e;
-    context -> nx_sha256_states[5] +=  f;
-    context -> nx_sha256_states[6] +=  g;
-    context -> nx_sha256_states[7] +=  h;
-
 #ifdef NX_SECURE_KEY_CLEAR
     a = 0; b = 0; c = 0; d = 0;
     e = 0; f = 0; g = 0; h = 0;
@@ -647,7 +669,7 @@ NX_CRYPTO_KEEP UINT  _nx_crypto_method_sha256_init(struct  NX_CRYPTO_METHOD_STRU
     }
 
     /* Verify the metadata addrsss is 4-byte aligned. */
-    if((((ULONG)crypto_metadata) & 0x3) != 0)
+    if((((ALIGN_TYPE)crypto_metadata) & 0x3) != 0)
     {
         return(NX_CRYPTO_PTR_ERROR);
     }
@@ -807,7 +829,7 @@ NX_CRYPTO_SHA256 *ctx;
     }
 
     /* Verify the metadata addrsss is 4-byte aligned. */
-    if((crypto_metadata == NX_CRYPTO_NULL) || ((((ULONG)crypto_metadata) & 0x3) != 0))
+    if((crypto_metadata == NX_CRYPTO_NULL) || ((((ALIGN_TYPE)crypto_metadata) & 0x3) != 0))
     {
         return(NX_CRYPTO_PTR_ERROR);
     }
@@ -58,6 +58,24 @@ const ULONG64 _sha5_round_constants[] =
 #define SMALL_SIGMA_0(x)           (RIGHT_SHIFT_CIRCULAR((x),  1) ^ RIGHT_SHIFT_CIRCULAR((x), 8) ^ ((x) >> 7))
 #define SMALL_SIGMA_1(x)           (RIGHT_SHIFT_CIRCULAR((x), 19) ^ RIGHT_SHIFT_CIRCULAR((x), 61) ^ ((x) >> 6))
 
+/* Load one big endian word of the message block.  */
+#define W0_BYTES(t) ((((ULONG64)buffer[(t) * 8]) << 56) | (((ULONG64)buffer[((t) * 8) + 1]) << 48) |   \
+                     (((ULONG64)buffer[((t) * 8) + 2]) << 40) | (((ULONG64)buffer[((t) * 8) + 3]) << 32) | \
+                     (((ULONG64)buffer[((t) * 8) + 4]) << 24) | (((ULONG64)buffer[((t) * 8) + 5]) << 16) | \
+                     (((ULONG64)buffer[((t) * 8) + 6]) << 8) | ((ULONG64)buffer[((t) * 8) + 7]))
+
+/* Expand the message schedule in a window of 16 words, where w[t] holds W(t - 16)
+   and is replaced by W(t).  */
+#define W16(t) (w[(t)] += SMALL_SIGMA_1(w[((t) + 14) & 15]) + w[((t) + 9) & 15] + SMALL_SIGMA_0(w[((t) + 1) & 15]))
+
+/* One round of SHA-512. Rather than shifting the eight state variables by one
+   position, each round is given them in rotated order.  */
+#define ROUND(a, b, c, d, e, f, g, h, t)                                                    \
+    temp1 = (h) + LARGE_SIGMA_1(e) + CH_FUNC((e), (f), (g)) + k[(t)] + w[(t)];             \
+    temp2 = LARGE_SIGMA_0(a) + MAJ_FUNC((a), (b), (c));                                     \
+    (d) += temp1;                                                                           \
+    (h) = temp1 + temp2;
+
 /* Define the padding array.  This is used to pad the message such that its length is
    64 bits shy of being a multiple of 512 bits long.  */
 const UCHAR   _nx_crypto_sha512_padding[] =
@@ -469,7 +487,9 @@ UINT  loop;
 /*  DESCRIPTION                                                           */
 /*                                                                        */
 /*    This function implements the SHA512 algorithm which works on        */
-/*    128-byte (1024-bit) blocks of data.                                 */
+/*    128-byte (1024-bit) blocks of data. The rounds are unrolled 16 at   */
+/*    a time and the message schedule is kept in a window of 16 words.    */
+/*    A word aligned block is loaded 32 bits at a time.                   */
 /*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
@@ -500,36 +520,41 @@ UINT  loop;
 /**************************************************************************/
 NX_CRYPTO_KEEP VOID _nx_crypto_sha512_process_buffer(NX_CRYPTO_SHA512 *context, UCHAR *buffer)
 {
-ULONG64 *w;
-UINT     t;
-ULONG64  temp1, temp2;
-ULONG64  a, b, c, d, e, f, g, h;
+ULONG64       *w;
+const ULONG64 *k;
+ULONG         *word_ptr;
+ULONG          high, low;
+UINT           t;
+ULONG64        temp1, temp2;
+ULONG64        a, b, c, d, e, f, g, h;
 
 
-    /* Setup pointers to the word array.  */
+    /* Setup pointers to the word array. Only the first 16 words are used.  */
     w =  context -> nx_sha512_word_array;
 
-    /* Initialize the first 16 words of the word array, taking care of the
+    /* Initialize the 16 words of the message block, taking care of the
        endian issues at the same time.  */
-    for (t = 0; t < 16; t++)
+    if (((ALIGN_TYPE)buffer & 3) == 0)
     {
-        /* Setup each entry.  */
-        w[t] =  (((ULONG64)buffer[0]) << 56) |
-            (((ULONG64)buffer[1]) << 48) |
-            (((ULONG64)buffer[2]) << 40) |
-            (((ULONG64)buffer[3]) << 32) |
-            (((ULONG64)buffer[4]) << 24) |
-            (((ULONG64)buffer[5]) << 16) |
-            (((ULONG64)buffer[6]) << 8) |
-            ((ULONG64)buffer[7]);
-        buffer += 8;
-    }
 
-    /* Setup the remaining entries of the word array.  */
-    for (t = 16; t < 80; t++)
+        /* The block is word aligned, so load each 64-bit word as two 32-bit words.  */
+        word_ptr = (ULONG *)buffer;
+        for (t = 0; t < 16; t++)
+        {
+            high = word_ptr[0];
+            low = word_ptr[1];
+            NX_CRYPTO_CHANGE_ULONG_ENDIAN(high);
+            NX_CRYPTO_CHANGE_ULONG_ENDIAN(low);
+            w[t] = (((ULONG64)high) << 32) | low;
+            word_ptr += 2;
+        }
+    }
+    else
     {
-        /* Setup each entry.  */
-        w[t] =  SMALL_SIGMA_1(w[t - 2]) + w[t - 7] + SMALL_SIGMA_0(w[t - 15]) + w[t - 16];
+        for (t = 0; t < 16; t++)
+        {
+            w[t] =  W0_BYTES(t);
+        }
     }
 
     /* Initialize the state variables.  */
@@ -542,19 +567,37 @@ ULONG64  a, b, c, d, e, f, g, h;
     g =  context -> nx_sha512_states[6];
     h =  context -> nx_sha512_states[7];
 
-    /* Now, perform Round operations.  */
-    for (t = 0; t < 80; t++)
+    /* Now, perform Round operations, 16 rounds at a time.  */
+    for (t = 0; t < 80; t += 16)
     {
-        temp1 = h + LARGE_SIGMA_1(e) + CH_FUNC(e, f, g) + _sha5_round_constants[t] + w[t];
-        temp2 = LARGE_SIGMA_0(a) + MAJ_FUNC(a, b, c);
-        h = g;
-        g = f;
-        f = e;
-        e = d + temp1;
-        d = c;
-        c = b;
-        b = a;
-        a = temp1 + temp2;
+        k = &_sha5_round_constants[t];
+
+        if (t != 0)
+        {
+
+            /* Expand the next 16 words of the message schedule.  */
+            W16(0);  W16(1);  W16(2);  W16(3);
+            W16(4);  W16(5);  W16(6);  W16(7);
+            W16(8);  W16(9);  W16(10); W16(11);
+            W16(12); W16(13); W16(14); W16(15);
+        }
+
+        ROUND(a, b, c, d, e, f, g, h, 0);
+        ROUND(h, a, b, c, d, e, f, g, 1);
+        ROUND(g, h, a, b, c, d, e, f, 2);
+        ROUND(f, g, h, a, b, c, d, e, 3);
+        ROUND(e, f, g, h, a, b, c, d, 4);
+        ROUND(d, e, f, g, h, a, b, c, 5);
+        ROUND(c, d, e, f, g, h, a, b, 6);
+        ROUND(b, c, d, e, f, g, h, a, 7);
+        ROUND(a, b, c, d, e, f, g, h, 8);
+        ROUND(h, a, b, c, d, e, f, g, 9);
+        ROUND(g, h, a, b, c, d, e, f, 10);
+        ROUND(f, g, h, a, b, c, d, e, 11);
+        ROUND(e, f, g, h, a, b, c, d, 12);
+        ROUND(d, e, f, g, h, a, b, c, 13);
+        ROUND(c, d, e, f, g, h, a, b, 14);
+        ROUND(b, c, d, e, f, g, h, a, 15);
     }
 
     /* Save the resulting in this SHA512 context.  */
@@ -571,6 +614,7 @@ ULONG64  a, b, c, d, e, f, g, h;
     a = 0; b = 0; c = 0; d = 0;
     e = 0; f = 0; g = 0; h = 0;
     temp1 = 0; temp2 = 0;
+    high = 0; low = 0;
 #endif /* NX_SECURE_KEY_CLEAR  */
 }
 
@@ -639,7 +683,7 @@ NX_CRYPTO_KEEP UINT  _nx_crypto_method_sha512_init(struct  NX_CRYPTO_METHOD_STRU
     }
 
     /* Verify the metadata addrsss is 4-byte aligned. */
-    if((((ULONG)crypto_metadata) & 0x3) != 0)
+    if((((ALIGN_TYPE)crypto_metadata) & 0x3) != 0)
     {
         return(NX_CRYPTO_PTR_ERROR);
     }
@@ -800,7 +844,7 @@ NX_CRYPTO_SHA512   *ctx;
     }
 
     /* Verify the metadata addrsss is 4-byte aligned. */
-    if((crypto_metadata == NX_CRYPTO_NULL) || ((((ULONG)crypto_metadata) & 0x3) != 0))
+    if((crypto_metadata == NX_CRYPTO_NULL) || ((((ALIGN_TYPE)crypto_metadata) & 0x3) != 0))
     {
         return(NX_CRYPTO_PTR_ERROR);
     }
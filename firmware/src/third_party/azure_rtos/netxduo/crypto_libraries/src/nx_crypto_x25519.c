@@ -0,0 +1,946 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Crypto Component                                                 */
+/**                                                                       */
+/**   X25519 Elliptic Curve Diffie-Hellman                                */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#include "nx_crypto_x25519.h"
+
+/* Field elements are integers modulo p = 2^255 - 19 held in ten unsigned limbs of alternately 26
+   and 25 bits, so limb i has weight 2^ceil(25.5 * i). Additions and subtractions leave the limbs
+   unreduced; every multiplication carries its result back to (almost) canonical limb sizes, which
+   keeps all products of one unreduced and one reduced operand within 64 bits. */
+#define NX_CRYPTO_X25519_MASK26           0x3FFFFFF
+#define NX_CRYPTO_X25519_MASK25           0x1FFFFFF
+
+/* (A - 2) / 4 for the Montgomery curve v^2 = u^3 + A*u^2 + u with A = 486662. */
+#define NX_CRYPTO_X25519_A24              121665
+
+/* Only the name, ID and size are used. The key exchange works on u-coordinates in its own field
+   representation, so the generic curve parameters and point operations are left empty. */
+NX_CRYPTO_CONST NX_CRYPTO_EC _nx_crypto_ec_x25519 =
+{
+    "x25519",
+    NX_CRYPTO_EC_X25519,
+    0,
+    255,
+    {
+        .fp = {(HN_UBASE *)NX_CRYPTO_NULL, 0u, 0u, 0u}
+    },
+    {(HN_UBASE *)NX_CRYPTO_NULL, 0u, 0u, 0u},
+    {(HN_UBASE *)NX_CRYPTO_NULL, 0u, 0u, 0u},
+    {
+        NX_CRYPTO_EC_POINT_AFFINE,
+        {(HN_UBASE *)NX_CRYPTO_NULL, 0u, 0u, 0u},
+        {(HN_UBASE *)NX_CRYPTO_NULL, 0u, 0u, 0u},
+        {(HN_UBASE *)NX_CRYPTO_NULL, 0u, 0u, 0u}
+    },
+    {(HN_UBASE *)NX_CRYPTO_NULL, 0u, 0u, 0u},
+    {(HN_UBASE *)NX_CRYPTO_NULL, 0u, 0u, 0u},
+    NX_CRYPTO_NULL,
+    NX_CRYPTO_NULL,
+    NX_CRYPTO_NULL,
+    NX_CRYPTO_NULL,
+    NX_CRYPTO_NULL
+};
+
+static const UCHAR _nx_crypto_x25519_base_point[NX_CRYPTO_X25519_KEY_SIZE] = {9};
+
+/* Bit offset of every limb in the 255-bit little endian encoding. */
+static const UCHAR _nx_crypto_x25519_limb_offset[NX_CRYPTO_X25519_LIMBS] =
+{
+    0, 26, 51, 77, 102, 128, 153, 179, 204, 230
+};
+
+/* Limbs of 2 * p, added before subtracting a reduced element so no limb goes negative. */
+static const UINT _nx_crypto_x25519_two_p[NX_CRYPTO_X25519_LIMBS] =
+{
+    0x7FFFFDA, 0x3FFFFFE, 0x7FFFFFE, 0x3FFFFFE, 0x7FFFFFE,
+    0x3FFFFFE, 0x7FFFFFE, 0x3FFFFFE, 0x7FFFFFE, 0x3FFFFFE
+};
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_x25519_carry                             PORTABLE C      */
+/*                                                           6.1          */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function carries a field element held in 64-bit accumulators   */
+/*    into 26/25-bit limbs. The carry out of the top limb is folded back  */
+/*    into the bottom limb times 19, since 2^255 = 19 modulo p.           */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    h                                     Field element accumulators    */
+/*    r                                     Carried field element         */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_crypto_x25519_multiply            Field multiplication          */
+/*    _nx_crypto_x25519_multiply_a24        Multiply by (A - 2) / 4       */
+/*    _nx_crypto_x25519_square              Field squaring                */
+/*                                                                        */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP static VOID _nx_crypto_x25519_carry(ULONG64 *h, UINT *r)
+{
+UINT i;
+
+    for (i = 0; i < NX_CRYPTO_X25519_LIMBS; i += 2)
+    {
+        h[i + 1] += h[i] >> 26;
+        h[i] &= NX_CRYPTO_X25519_MASK26;
+        if (i + 2 < NX_CRYPTO_X25519_LIMBS)
+        {
+            h[i + 2] += h[i + 1] >> 25;
+        }
+        else
+        {
+            h[0] += (h[i + 1] >> 25) * 19;
+        }
+        h[i + 1] &= NX_CRYPTO_X25519_MASK25;
+    }
+
+    /* One more carry out of limb 0 bounds every limb except limb 1, which may exceed 25 bits
+       by a few bits. */
+    h[1] += h[0] >> 26;
+    h[0] &= NX_CRYPTO_X25519_MASK26;
+
+    for (i = 0; i < NX_CRYPTO_X25519_LIMBS; i++)
+    {
+        r[i] = (UINT)h[i];
+    }
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_x25519_multiply                          PORTABLE C      */
+/*                                                           6.1          */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function computes r = a * b modulo p. Products that land at    */
+/*    or above 2^255 are multiplied by 19 and folded into the low limbs,  */
+/*    and products of two odd (25-bit) limbs are doubled because their    */
+/*    weights add up to one bit more than the weight of the target limb.  */
+/*    The output may alias either input.                                  */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    r                                     Product                       */
+/*    a                                     Multiplicand                  */
+/*    b                                     Multiplier                    */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_crypto_x25519_carry               Carry field element           */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_crypto_x25519_invert              Field inversion               */
+/*    _nx_crypto_x25519_scalar_multiply     X25519 function               */
+/*                                                                        */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP static VOID _nx_crypto_x25519_multiply(UINT *r, UINT *a, UINT *b)
+{
+ULONG64 h[NX_CRYPTO_X25519_LIMBS];
+UINT    a2[NX_CRYPTO_X25519_LIMBS];
+UINT    b19[NX_CRYPTO_X25519_LIMBS];
+UINT    i;
+
+    for (i = 0; i < NX_CRYPTO_X25519_LIMBS; i++)
+    {
+        a2[i] = a[i] << 1;
+        b19[i] = b[i] * 19;
+    }
+
+    h[0] = (ULONG64)a[0] * b[0] + (ULONG64)a2[1] * b19[9] + (ULONG64)a[2] * b19[8] +
+           (ULONG64)a2[3] * b19[7] + (ULONG64)a[4] * b19[6] + (ULONG64)a2[5] * b19[5] +
+           (ULONG64)a[6] * b19[4] + (ULONG64)a2[7] * b19[3] + (ULONG64)a[8] * b19[2] +
+           (ULONG64)a2[9] * b19[1];
+    h[1] = (ULONG64)a[0] * b[1] + (ULONG64)a[1] * b[0] + (ULONG64)a[2] * b19[9] +
+           (ULONG64)a[3] * b19[8] + (ULONG64)a[4] * b19[7] + (ULONG64)a[5] * b19[6] +
+           (ULONG64)a[6] * b19[5] + (ULONG64)a[7] * b19[4] + (ULONG64)a[8] * b19[3] +
+           (ULONG64)a[9] * b19[2];
+    h[2] = (ULONG64)a[0] * b[2] + (ULONG64)a2[1] * b[1] + (ULONG64)a[2] * b[0] +
+           (ULONG64)a2[3] * b19[9] + (ULONG64)a[4] * b19[8] + (ULONG64)a2[5] * b19[7] +
+           (ULONG64)a[6] * b19[6] + (ULONG64)a2[7] * b19[5] + (ULONG64)a[8] * b19[4] +
+           (ULONG64)a2[9] * b19[3];
+    h[3] = (ULONG64)a[0] * b[3] + (ULONG64)a[1] * b[2] + (ULONG64)a[2] * b[1] + (ULONG64)a[3] * b[0] +
+           (ULONG64)a[4] * b19[9] + (ULONG64)a[5] * b19[8] + (ULONG64)a[6] * b19[7] +
+           (ULONG64)a[7] * b19[6] + (ULONG64)a[8] * b19[5] + (ULONG64)a[9] * b19[4];
+    h[4] = (ULONG64)a[0] * b[4] + (ULONG64)a2[1] * b[3] + (ULONG64)a[2] * b[2] + (ULONG64)a2[3] * b[1] +
+           (ULONG64)a[4] * b[0] + (ULONG64)a2[5] * b19[9] + (ULONG64)a[6] * b19[8] +
+           (ULONG64)a2[7] * b19[7] + (ULONG64)a[8] * b19[6] + (ULONG64)a2[9] * b19[5];
+    h[5] = (ULONG64)a[0] * b[5] + (ULONG64)a[1] * b[4] + (ULONG64)a[2] * b[3] + (ULONG64)a[3] * b[2] +
+           (ULONG64)a[4] * b[1] + (ULONG64)a[5] * b[0] + (ULONG64)a[6] * b19[9] +
+           (ULONG64)a[7] * b19[8] + (ULONG64)a[8] * b19[7] + (ULONG64)a[9] * b19[6];
+    h[6] = (ULONG64)a[0] * b[6] + (ULONG64)a2[1] * b[5] + (ULONG64)a[2] * b[4] + (ULONG64)a2[3] * b[3] +
+           (ULONG64)a[4] * b[2] + (ULONG64)a2[5] * b[1] + (ULONG64)a[6] * b[0] +
+           (ULONG64)a2[7] * b19[9] + (ULONG64)a[8] * b19[8] + (ULONG64)a2[9] * b19[7];
+    h[7] = (ULONG64)a[0] * b[7] + (ULONG64)a[1] * b[6] + (ULONG64)a[2] * b[5] + (ULONG64)a[3] * b[4] +
+           (ULONG64)a[4] * b[3] + (ULONG64)a[5] * b[2] + (ULONG64)a[6] * b[1] + (ULONG64)a[7] * b[0] +
+           (ULONG64)a[8] * b19[9] + (ULONG64)a[9] * b19[8];
+    h[8] = (ULONG64)a[0] * b[8] + (ULONG64)a2[1] * b[7] + (ULONG64)a[2] * b[6] + (ULONG64)a2[3] * b[5] +
+           (ULONG64)a[4] * b[4] + (ULONG64)a2[5] * b[3] + (ULONG64)a[6] * b[2] + (ULONG64)a2[7] * b[1] +
+           (ULONG64)a[8] * b[0] + (ULONG64)a2[9] * b19[9];
+    h[9] = (ULONG64)a[0] * b[9] + (ULONG64)a[1] * b[8] + (ULONG64)a[2] * b[7] + (ULONG64)a[3] * b[6] +
+           (ULONG64)a[4] * b[5] + (ULONG64)a[5] * b[4] + (ULONG64)a[6] * b[3] + (ULONG64)a[7] * b[2] +
+           (ULONG64)a[8] * b[1] + (ULONG64)a[9] * b[0];
+
+    _nx_crypto_x25519_carry(h, r);
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_x25519_square                            PORTABLE C      */
+/*                                                           6.1          */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function computes r = a * a modulo p. It is the                */
+/*    multiplication with the two symmetric products of every pair of     */
+/*    limbs merged into one, which saves 45 of the 100 limb products.     */
+/*    The output may alias the input.                                     */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    r                                     Square                        */
+/*    a                                     Field element                 */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_crypto_x25519_carry               Carry field element           */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_crypto_x25519_square_n            Repeated squaring             */
+/*    _nx_crypto_x25519_scalar_multiply     X25519 function               */
+/*                                                                        */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP static VOID _nx_crypto_x25519_square(UINT *r, UINT *a)
+{
+ULONG64 h[NX_CRYPTO_X25519_LIMBS];
+UINT    a2[NX_CRYPTO_X25519_LIMBS];
+UINT    a4[NX_CRYPTO_X25519_LIMBS];
+UINT    a19[NX_CRYPTO_X25519_LIMBS];
+UINT    i;
+
+    for (i = 0; i < NX_CRYPTO_X25519_LIMBS; i++)
+    {
+        a2[i] = a[i] << 1;
+        a4[i] = a[i] << 2;
+        a19[i] = a[i] * 19;
+    }
+
+    h[0] = (ULONG64)a[0] * a[0] + (ULONG64)a4[1] * a19[9] + (ULONG64)a2[2] * a19[8] +
+           (ULONG64)a4[3] * a19[7] + (ULONG64)a2[4] * a19[6] + (ULONG64)a2[5] * a19[5];
+    h[1] = (ULONG64)a2[0] * a[1] + (ULONG64)a2[2] * a19[9] + (ULONG64)a2[3] * a19[8] +
+           (ULONG64)a2[4] * a19[7] + (ULONG64)a2[5] * a19[6];
+    h[2] = (ULONG64)a2[0] * a[2] + (ULONG64)a2[1] * a[1] + (ULONG64)a4[3] * a19[9] +
+           (ULONG64)a2[4] * a19[8] + (ULONG64)a4[5] * a19[7] + (ULONG64)a[6] * a19[6];
+    h[3] = (ULONG64)a2[0] * a[3] + (ULONG64)a2[1] * a[2] + (ULONG64)a2[4] * a19[9] +
+           (ULONG64)a2[5] * a19[8] + (ULONG64)a2[6] * a19[7];
+    h[4] = (ULONG64)a2[0] * a[4] + (ULONG64)a4[1] * a[3] + (ULONG64)a[2] * a[2] +
+           (ULONG64)a4[5] * a19[9] + (ULONG64)a2[6] * a19[8] + (ULONG64)a2[7] * a19[7];
+    h[5] = (ULONG64)a2[0] * a[5] + (ULONG64)a2[1] * a[4] + (ULONG64)a2[2] * a[3] +
+           (ULONG64)a2[6] * a19[9] + (ULONG64)a2[7] * a19[8];
+    h[6] = (ULONG64)a2[0] * a[6] + (ULONG64)a4[1] * a[5] + (ULONG64)a2[2] * a[4] +
+           (ULONG64)a2[3] * a[3] + (ULONG64)a4[7] * a19[9] + (ULONG64)a[8] * a19[8];
+    h[7] = (ULONG64)a2[0] * a[7] + (ULONG64)a2[1] * a[6] + (ULONG64)a2[2] * a[5] +
+           (ULONG64)a2[3] * a[4] + (ULONG64)a2[8] * a19[9];
+    h[8] = (ULONG64)a2[0] * a[8] + (ULONG64)a4[1] * a[7] + (ULONG64)a2[2] * a[6] +
+           (ULONG64)a4[3] * a[5] + (ULONG64)a[4] * a[4] + (ULONG64)a2[9] * a19[9];
+    h[9] = (ULONG64)a2[0] * a[9] + (ULONG64)a2[1] * a[8] + (ULONG64)a2[2] * a[7] +
+           (ULONG64)a2[3] * a[6] + (ULONG64)a2[4] * a[5];
+
+    _nx_crypto_x25519_carry(h, r);
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_x25519_multiply_a24                      PORTABLE C      */
+/*                                                           6.1          */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function computes r = a * 121665 modulo p.                     */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    r                                     Product                       */
+/*    a                                     Multiplicand                  */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_crypto_x25519_carry               Carry field element           */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_crypto_x25519_scalar_multiply     X25519 function               */
+/*                                                                        */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP static VOID _nx_crypto_x25519_multiply_a24(UINT *r, UINT *a)
+{
+ULONG64 h[NX_CRYPTO_X25519_LIMBS];
+UINT    i;
+
+    for (i = 0; i < NX_CRYPTO_X25519_LIMBS; i++)
+    {
+        h[i] = (ULONG64)a[i] * NX_CRYPTO_X25519_A24;
+    }
+
+    _nx_crypto_x25519_carry(h, r);
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_x25519_add                               PORTABLE C      */
+/*                                                           6.1          */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function computes r = a + b without carrying. Both inputs      */
+/*    must be reduced field elements.                                     */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    r                                     Sum                           */
+/*    a                                     Augend                        */
+/*    b                                     Addend                        */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_crypto_x25519_scalar_multiply     X25519 function               */
+/*                                                                        */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP static VOID _nx_crypto_x25519_add(UINT *r, UINT *a, UINT *b)
+{
+UINT i;
+
+    for (i = 0; i < NX_CRYPTO_X25519_LIMBS; i++)
+    {
+        r[i] = a[i] + b[i];
+    }
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_x25519_subtract                          PORTABLE C      */
+/*                                                           6.1          */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function computes r = a - b + 2p without carrying. Both        */
+/*    inputs must be reduced field elements, so every limb of the result  */
+/*    stays positive.                                                     */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    r                                     Difference                    */
+/*    a                                     Minuend                       */
+/*    b                                     Subtrahend                    */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_crypto_x25519_scalar_multiply     X25519 function               */
+/*                                                                        */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP static VOID _nx_crypto_x25519_subtract(UINT *r, UINT *a, UINT *b)
+{
+UINT i;
+
+    for (i = 0; i < NX_CRYPTO_X25519_LIMBS; i++)
+    {
+        r[i] = (a[i] + _nx_crypto_x25519_two_p[i]) - b[i];
+    }
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_x25519_swap                              PORTABLE C      */
+/*                                                           6.1          */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function swaps a and b when swap is 1 and leaves them alone    */
+/*    when swap is 0, without a data-dependent branch or memory access.   */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    a                                     First field element           */
+/*    b                                     Second field element          */
+/*    swap                                  Swap flag, 0 or 1             */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_crypto_x25519_scalar_multiply     X25519 function               */
+/*                                                                        */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP static VOID _nx_crypto_x25519_swap(UINT *a, UINT *b, UINT swap)
+{
+UINT mask = 0u - swap;
+UINT t;
+UINT i;
+
+    for (i = 0; i < NX_CRYPTO_X25519_LIMBS; i++)
+    {
+        t = mask & (a[i] ^ b[i]);
+        a[i] ^= t;
+        b[i] ^= t;
+    }
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_x25519_square_n                          PORTABLE C      */
+/*                                                           6.1          */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function squares a field element n times in a row.             */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    r                                     Result                        */
+/*    a                                     Field element                 */
+/*    n                                     Number of squarings           */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_crypto_x25519_square              Field squaring                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_crypto_x25519_invert              Field inversion               */
+/*                                                                        */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP static VOID _nx_crypto_x25519_square_n(UINT *r, UINT *a, UINT n)
+{
+UINT i;
+
+    _nx_crypto_x25519_square(r, a);
+    for (i = 1; i < n; i++)
+    {
+        _nx_crypto_x25519_square(r, r);
+    }
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_x25519_invert                            PORTABLE C      */
+/*                                                           6.1          */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function computes r = a^(p - 2) = 1 / a modulo p with the      */
+/*    usual addition chain of 254 squarings and 11 multiplications. An    */
+/*    input of zero gives zero.                                           */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    r                                     Inverse                       */
+/*    a                                     Field element                 */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_crypto_x25519_multiply            Field multiplication          */
+/*    _nx_crypto_x25519_square              Field squaring                */
+/*    _nx_crypto_x25519_square_n            Repeated squaring             */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_crypto_x25519_scalar_multiply     X25519 function               */
+/*                                                                        */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP static VOID _nx_crypto_x25519_invert(UINT *r, UINT *a)
+{
+UINT a2[NX_CRYPTO_X25519_LIMBS];
+UINT a11[NX_CRYPTO_X25519_LIMBS];
+UINT e5[NX_CRYPTO_X25519_LIMBS];
+UINT e10[NX_CRYPTO_X25519_LIMBS];
+UINT e50[NX_CRYPTO_X25519_LIMBS];
+UINT t[NX_CRYPTO_X25519_LIMBS];
+
+    /* Names give the exponent: eN = a^(2^N - 1). */
+    _nx_crypto_x25519_square(a2, a);
+    _nx_crypto_x25519_square_n(t, a2, 2);
+    _nx_crypto_x25519_multiply(t, t, a);          /* a^9 */
+    _nx_crypto_x25519_multiply(a11, t, a2);
+    _nx_crypto_x25519_square(e5, a11);            /* a^22 */
+    _nx_crypto_x25519_multiply(e5, e5, t);
+    _nx_crypto_x25519_square_n(t, e5, 5);
+    _nx_crypto_x25519_multiply(e10, t, e5);
+    _nx_crypto_x25519_square_n(t, e10, 10);
+    _nx_crypto_x25519_multiply(t, t, e10);        /* e20 */
+    _nx_crypto_x25519_square_n(e50, t, 20);
+    _nx_crypto_x25519_multiply(e50, e50, t);      /* e40 */
+    _nx_crypto_x25519_square_n(t, e50, 10);
+    _nx_crypto_x25519_multiply(e50, t, e10);
+    _nx_crypto_x25519_square_n(t, e50, 50);
+    _nx_crypto_x25519_multiply(e10, t, e50);      /* e100 */
+    _nx_crypto_x25519_square_n(t, e10, 100);
+    _nx_crypto_x25519_multiply(t, t, e10);        /* e200 */
+    _nx_crypto_x25519_square_n(t, t, 50);
+    _nx_crypto_x25519_multiply(t, t, e50);        /* e250 */
+    _nx_crypto_x25519_square_n(t, t, 5);
+    _nx_crypto_x25519_multiply(r, t, a11);        /* a^(2^255 - 21) */
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_x25519_decode                            PORTABLE C      */
+/*                                                           6.1          */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function loads a 32-byte little endian u-coordinate into a     */
+/*    field element. The most significant bit is ignored as RFC 7748      */
+/*    requires; values between p and 2^255 - 1 are accepted unreduced.    */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    r                                     Field element                 */
+/*    s                                     Encoded u-coordinate          */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_crypto_x25519_scalar_multiply     X25519 function               */
+/*                                                                        */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP static VOID _nx_crypto_x25519_decode(UINT *r, UCHAR *s)
+{
+UINT   i;
+UINT   offset;
+UCHAR *p;
+
+    for (i = 0; i < NX_CRYPTO_X25519_LIMBS; i++)
+    {
+
+        /* Every limb fits in the 32 bits starting at the byte that holds its lowest bit. */
+        offset = _nx_crypto_x25519_limb_offset[i];
+        p = s + (offset >> 3);
+        r[i] = ((UINT)p[0] | ((UINT)p[1] << 8) | ((UINT)p[2] << 16) | ((UINT)p[3] << 24)) >> (offset & 7);
+        r[i] &= (i & 1) ? NX_CRYPTO_X25519_MASK25 : NX_CRYPTO_X25519_MASK26;
+    }
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_x25519_encode                            PORTABLE C      */
+/*                                                           6.1          */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function reduces a field element to its unique value below p   */
+/*    and stores it as 32 little endian bytes.                            */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    s                                     Encoded output                */
+/*    a                                     Field element                 */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_crypto_x25519_scalar_multiply     X25519 function               */
+/*                                                                        */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP static VOID _nx_crypto_x25519_encode(UCHAR *s, UINT *a)
+{
+UINT    h[NX_CRYPTO_X25519_LIMBS];
+UINT    q;
+UINT    i;
+UINT    bits;
+UINT    offset;
+ULONG64 acc;
+
+    /* The input is below 2p. q = floor((a + 19) / 2^255) is 1 exactly when a >= p. */
+    q = (a[0] + 19) >> 26;
+    for (i = 1; i < NX_CRYPTO_X25519_LIMBS; i++)
+    {
+        q = (a[i] + q) >> ((i & 1) ? 25 : 26);
+    }
+
+    /* Compute a + 19q and carry it, dropping the 2^255 bit. That leaves a - qp. */
+    h[0] = a[0] + 19 * q;
+    for (i = 0; i < NX_CRYPTO_X25519_LIMBS; i++)
+    {
+        bits = (i & 1) ? 25 : 26;
+        if (i + 1 < NX_CRYPTO_X25519_LIMBS)
+        {
+            h[i + 1] = a[i + 1] + (h[i] >> bits);
+        }
+        h[i] &= (1u << bits) - 1;
+    }
+
+    /* Pack the limbs. */
+    acc = 0;
+    offset = 0;
+    bits = 0;
+    for (i = 0; i < NX_CRYPTO_X25519_KEY_SIZE; i++)
+    {
+        while ((bits < 8) && (offset < NX_CRYPTO_X25519_LIMBS))
+        {
+            acc |= (ULONG64)h[offset] << bits;
+            bits += (offset & 1) ? 25 : 26;
+            offset++;
+        }
+        s[i] = (UCHAR)acc;
+        acc >>= 8;
+        bits -= 8;
+    }
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_x25519_scalar_multiply                   PORTABLE C      */
+/*                                                           6.1          */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function computes the X25519 function of RFC 7748: the scalar  */
+/*    is clamped and multiplied with the point of the given u-coordinate  */
+/*    by a constant-time Montgomery ladder. The caller must reject an     */
+/*    all-zero output when it is used as a Diffie-Hellman shared secret.  */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    output                                32-byte output u-coordinate   */
+/*    scalar                                32-byte scalar                */
+/*    u                                     32-byte input u-coordinate    */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_crypto_x25519_add                 Field addition                */
+/*    _nx_crypto_x25519_decode              Load u-coordinate             */
+/*    _nx_crypto_x25519_encode              Store u-coordinate            */
+/*    _nx_crypto_x25519_invert              Field inversion               */
+/*    _nx_crypto_x25519_multiply            Field multiplication          */
+/*    _nx_crypto_x25519_multiply_a24        Multiply by (A - 2) / 4       */
+/*    _nx_crypto_x25519_square              Field squaring                */
+/*    _nx_crypto_x25519_subtract            Field subtraction             */
+/*    _nx_crypto_x25519_swap                Conditional swap              */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_crypto_x25519_base_multiply       Multiply base point           */
+/*    _nx_crypto_ecdh_compute_secret        Compute ECDH shared secret    */
+/*                                                                        */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP UINT _nx_crypto_x25519_scalar_multiply(UCHAR *output, UCHAR *scalar, UCHAR *u)
+{
+UCHAR k[NX_CRYPTO_X25519_KEY_SIZE];
+UINT  x1[NX_CRYPTO_X25519_LIMBS];
+UINT  x2[NX_CRYPTO_X25519_LIMBS];
+UINT  z2[NX_CRYPTO_X25519_LIMBS];
+UINT  x3[NX_CRYPTO_X25519_LIMBS];
+UINT  z3[NX_CRYPTO_X25519_LIMBS];
+UINT  a[NX_CRYPTO_X25519_LIMBS];
+UINT  b[NX_CRYPTO_X25519_LIMBS];
+UINT  c[NX_CRYPTO_X25519_LIMBS];
+UINT  d[NX_CRYPTO_X25519_LIMBS];
+UINT  swap;
+UINT  bit;
+INT   t;
+
+    if ((output == NX_CRYPTO_NULL) || (scalar == NX_CRYPTO_NULL) || (u == NX_CRYPTO_NULL))
+    {
+        return(NX_CRYPTO_PTR_ERROR);
+    }
+
+    /* Clamp the scalar. */
+    NX_CRYPTO_MEMCPY(k, scalar, NX_CRYPTO_X25519_KEY_SIZE); /* Use case of memcpy is verified. */
+    k[0] &= 248;
+    k[31] &= 127;
+    k[31] |= 64;
+
+    _nx_crypto_x25519_decode(x1, u);
+    NX_CRYPTO_MEMSET(x2, 0, sizeof(x2));
+    NX_CRYPTO_MEMSET(z2, 0, sizeof(z2));
+    NX_CRYPTO_MEMCPY(x3, x1, sizeof(x3)); /* Use case of memcpy is verified. */
+    NX_CRYPTO_MEMCPY(z3, z2, sizeof(z3)); /* Use case of memcpy is verified. */
+    x2[0] = 1;
+    z3[0] = 1;
+
+    /* Ladder over bits 254 down to 0, keeping (x2:z2) = k' * P and (x3:z3) = (k' + 1) * P for the
+       scalar prefix k' processed so far. */
+    swap = 0;
+    for (t = 254; t >= 0; t--)
+    {
+        bit = (UINT)(k[t >> 3] >> (t & 7)) & 1;
+        swap ^= bit;
+        _nx_crypto_x25519_swap(x2, x3, swap);
+        _nx_crypto_x25519_swap(z2, z3, swap);
+        swap = bit;
+
+        _nx_crypto_x25519_add(a, x2, z2);          /* A = x2 + z2 */
+        _nx_crypto_x25519_subtract(b, x2, z2);     /* B = x2 - z2 */
+        _nx_crypto_x25519_add(c, x3, z3);          /* C = x3 + z3 */
+        _nx_crypto_x25519_subtract(d, x3, z3);     /* D = x3 - z3 */
+        _nx_crypto_x25519_multiply(d, d, a);       /* DA */
+        _nx_crypto_x25519_multiply(c, c, b);       /* CB */
+        _nx_crypto_x25519_square(a, a);            /* AA */
+        _nx_crypto_x25519_square(b, b);            /* BB */
+        _nx_crypto_x25519_add(x3, d, c);
+        _nx_crypto_x25519_square(x3, x3);          /* x3 = (DA + CB)^2 */
+        _nx_crypto_x25519_subtract(z3, d, c);
+        _nx_crypto_x25519_square(z3, z3);
+        _nx_crypto_x25519_multiply(z3, z3, x1);    /* z3 = x1 * (DA - CB)^2 */
+        _nx_crypto_x25519_multiply(x2, a, b);      /* x2 = AA * BB */
+        _nx_crypto_x25519_subtract(c, a, b);       /* E = AA - BB */
+        _nx_crypto_x25519_multiply_a24(d, c);
+        _nx_crypto_x25519_add(d, d, a);
+        _nx_crypto_x25519_multiply(z2, c, d);      /* z2 = E * (AA + a24 * E) */
+    }
+    _nx_crypto_x25519_swap(x2, x3, swap);
+    _nx_crypto_x25519_swap(z2, z3, swap);
+
+    _nx_crypto_x25519_invert(z2, z2);
+    _nx_crypto_x25519_multiply(x2, x2, z2);
+    _nx_crypto_x25519_encode(output, x2);
+
+#ifdef NX_SECURE_KEY_CLEAR
+    NX_CRYPTO_MEMSET(k, 0, sizeof(k));
+    NX_CRYPTO_MEMSET(x2, 0, sizeof(x2));
+    NX_CRYPTO_MEMSET(z2, 0, sizeof(z2));
+    NX_CRYPTO_MEMSET(x3, 0, sizeof(x3));
+    NX_CRYPTO_MEMSET(z3, 0, sizeof(z3));
+#endif /* NX_SECURE_KEY_CLEAR  */
+
+    return(NX_CRYPTO_SUCCESS);
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_x25519_base_multiply                     PORTABLE C      */
+/*                                                           6.1          */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function computes the X25519 public key of a private scalar    */
+/*    by multiplying the base point u = 9.                                */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    output                                32-byte public key            */
+/*    scalar                                32-byte private key           */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_crypto_x25519_scalar_multiply     X25519 function               */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_crypto_ecdh_setup                 Setup ECDH local key pair     */
+/*                                                                        */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP UINT _nx_crypto_x25519_base_multiply(UCHAR *output, UCHAR *scalar)
+{
+    return(_nx_crypto_x25519_scalar_multiply(output, scalar, (UCHAR *)_nx_crypto_x25519_base_point));
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_method_ec_x25519_operation               PORTABLE C      */
+/*                                                           6.1          */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function returns the X25519 curve.                             */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    op                                    Operation                     */
+/*    handle                                Crypto handle                 */
+/*    method                                Cryption Method Object        */
+/*    key                                   Encryption Key                */
+/*    key_size_in_bits                      Key size in bits              */
+/*    input                                 Input data                    */
+/*    input_length_in_byte                  Input data size               */
+/*    iv_ptr                                Initial vector                */
+/*    output                                Output buffer                 */
+/*    output_length_in_byte                 Output buffer size            */
+/*    crypto_metadata                       Metadata area                 */
+/*    crypto_metadata_size                  Metadata area size            */
+/*    packet_ptr                            Pointer to packet             */
+/*    nx_crypto_hw_process_callback         Callback function pointer     */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP UINT _nx_crypto_method_ec_x25519_operation(UINT op,
+                                                          VOID *handle,
+                                                          struct NX_CRYPTO_METHOD_STRUCT *method,
+                                                          UCHAR *key, NX_CRYPTO_KEY_SIZE key_size_in_bits,
+                                                          UCHAR *input, ULONG input_length_in_byte,
+                                                          UCHAR *iv_ptr,
+                                                          UCHAR *output, ULONG output_length_in_byte,
+                                                          VOID *crypto_metadata, ULONG crypto_metadata_size,
+                                                          VOID *packet_ptr,
+                                                          VOID (*nx_crypto_hw_process_callback)(VOID *, UINT))
+{
+    NX_CRYPTO_PARAMETER_NOT_USED(handle);
+    NX_CRYPTO_PARAMETER_NOT_USED(method);
+    NX_CRYPTO_PARAMETER_NOT_USED(key);
+    NX_CRYPTO_PARAMETER_NOT_USED(key_size_in_bits);
+    NX_CRYPTO_PARAMETER_NOT_USED(input);
+    NX_CRYPTO_PARAMETER_NOT_USED(input_length_in_byte);
+    NX_CRYPTO_PARAMETER_NOT_USED(iv_ptr);
+    NX_CRYPTO_PARAMETER_NOT_USED(output_length_in_byte);
+    NX_CRYPTO_PARAMETER_NOT_USED(crypto_metadata);
+    NX_CRYPTO_PARAMETER_NOT_USED(crypto_metadata_size);
+    NX_CRYPTO_PARAMETER_NOT_USED(packet_ptr);
+    NX_CRYPTO_PARAMETER_NOT_USED(nx_crypto_hw_process_callback);
+
+    if (op != NX_CRYPTO_EC_CURVE_GET)
+    {
+        return(NX_CRYPTO_NOT_SUCCESSFUL);
+    }
+
+    *((NX_CRYPTO_EC **)output) = (NX_CRYPTO_EC *)&_nx_crypto_ec_x25519;
+
+    return(NX_CRYPTO_SUCCESS);
+}
@@ -0,0 +1,529 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Crypto Component                                                 */
+/**                                                                       */
+/**   AEAD Update Test                                                    */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+/**************************************************************************/
+/*                                                                        */
+/*  PROGRAM                                                RELEASE        */
+/*                                                                        */
+/*    nx_crypto_aead_update_test.c                        PORTABLE C      */
+/*                                                           6.1          */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This file is a host program, not part of the crypto library. It     */
+/*    checks that the AEAD methods TLS uses give the same result however  */
+/*    a message is split across NX_CRYPTO_ENCRYPT_UPDATE and              */
+/*    NX_CRYPTO_DECRYPT_UPDATE calls, as the record layer splits it at    */
+/*    packet boundaries. AES-128-GCM, AES-256-GCM, AES-CCM with 8 and 16  */
+/*    byte tags and ChaCha20-Poly1305 are tested.                         */
+/*                                                                        */
+/*    The one-shot NX_CRYPTO_ENCRYPT of each method is first checked      */
+/*    against a published vector, then used as the reference. Messages    */
+/*    are cut at every byte up to 100 bytes and at 255, 256, 257 and      */
+/*    1000 bytes, at every pair of bytes up to 48 bytes, and into random  */
+/*    chunks, some empty, up to 2048 bytes. Each split is encrypted and   */
+/*    decrypted both in place and out of place. The ciphertext, tag and   */
+/*    plaintext must match the reference, and a changed tag must fail.    */
+/*                                                                        */
+/*    Build and run it with the Makefile in this directory, as            */
+/*                                                                        */
+/*      nx_crypto_aead_update_test [-s seed]                              */
+/*                                                                        */
+/*    The program exits with 1 if any check fails.                        */
+/*                                                                        */
+/**************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "nx_crypto_aes.h"
+#include "nx_crypto_chacha20_poly1305.h"
+
+#define NX_CRYPTO_AEAD_UPDATE_TEST_MAX_LENGTH   2048
+#define NX_CRYPTO_AEAD_UPDATE_TEST_MAX_CUTS     64
+#define NX_CRYPTO_AEAD_UPDATE_TEST_CUT_LENGTH   100
+#define NX_CRYPTO_AEAD_UPDATE_TEST_PAIR_LENGTH  48
+#define NX_CRYPTO_AEAD_UPDATE_TEST_ROUNDS       2000
+#define NX_CRYPTO_AEAD_UPDATE_TEST_MAX_AAD      21
+
+#define NX_CRYPTO_AEAD_UPDATE_TEST_CHECK(condition) \
+    _nx_crypto_aead_update_test_check((condition), #condition, __LINE__)
+
+typedef struct NX_CRYPTO_AEAD_UPDATE_TEST_METHOD_STRUCT
+{
+    const CHAR       *nx_crypto_aead_update_test_name;
+    NX_CRYPTO_METHOD *nx_crypto_aead_update_test_method;
+
+    /* The published vector: key, IV with its length in the first byte, additional data,
+       plaintext and tag. The ciphertext is not kept, since the tag covers it. */
+    const UCHAR      *nx_crypto_aead_update_test_key;
+    const UCHAR      *nx_crypto_aead_update_test_iv;
+    const UCHAR      *nx_crypto_aead_update_test_aad;
+    UINT              nx_crypto_aead_update_test_aad_length;
+    const UCHAR      *nx_crypto_aead_update_test_plaintext;
+    UINT              nx_crypto_aead_update_test_plaintext_length;
+    const UCHAR      *nx_crypto_aead_update_test_tag;
+} NX_CRYPTO_AEAD_UPDATE_TEST_METHOD;
+
+extern NX_CRYPTO_METHOD crypto_method_aes_128_gcm_16;
+extern NX_CRYPTO_METHOD crypto_method_aes_256_gcm_16;
+extern NX_CRYPTO_METHOD crypto_method_aes_ccm_8;
+extern NX_CRYPTO_METHOD crypto_method_aes_ccm_16;
+extern NX_CRYPTO_METHOD crypto_method_chacha20_poly1305;
+
+/* GCM test cases 4 and 16 of the GCM specification, which share all but the key. */
+static const UCHAR _nx_crypto_aead_update_test_gcm_key[] =
+{
+    0xFE, 0xFF, 0xE9, 0x92, 0x86, 0x65, 0x73, 0x1C, 0x6D, 0x6A, 0x8F, 0x94, 0x67, 0x30, 0x83, 0x08,
+    0xFE, 0xFF, 0xE9, 0x92, 0x86, 0x65, 0x73, 0x1C, 0x6D, 0x6A, 0x8F, 0x94, 0x67, 0x30, 0x83, 0x08,
+};
+static const UCHAR _nx_crypto_aead_update_test_gcm_iv[] =
+{
+    12, 0xCA, 0xFE, 0xBA, 0xBE, 0xFA, 0xCE, 0xDB, 0xAD, 0xDE, 0xCA, 0xF8, 0x88,
+};
+static const UCHAR _nx_crypto_aead_update_test_gcm_aad[] =
+{
+    0xFE, 0xED, 0xFA, 0xCE, 0xDE, 0xAD, 0xBE, 0xEF, 0xFE, 0xED, 0xFA, 0xCE, 0xDE, 0xAD, 0xBE, 0xEF,
+    0xAB, 0xAD, 0xDA, 0xD2,
+};
+static const UCHAR _nx_crypto_aead_update_test_gcm_plaintext[] =
+{
+    0xD9, 0x31, 0x32, 0x25, 0xF8, 0x84, 0x06, 0xE5, 0xA5, 0x59, 0x09, 0xC5, 0xAF, 0xF5, 0x26, 0x9A,
+    0x86, 0xA7, 0xA9, 0x53, 0x15, 0x34, 0xF7, 0xDA, 0x2E, 0x4C, 0x30, 0x3D, 0x8A, 0x31, 0x8A, 0x72,
+    0x1C, 0x3C, 0x0C, 0x95, 0x95, 0x68, 0x09, 0x53, 0x2F, 0xCF, 0x0E, 0x24, 0x49, 0xA6, 0xB5, 0x25,
+    0xB1, 0x6A, 0xED, 0xF5, 0xAA, 0x0D, 0xE6, 0x57, 0xBA, 0x63, 0x7B, 0x39,
+};
+static const UCHAR _nx_crypto_aead_update_test_gcm_128_tag[] =
+{
+    0x5B, 0xC9, 0x4F, 0xBC, 0x32, 0x21, 0xA5, 0xDB, 0x94, 0xFA, 0xE9, 0x5A, 0xE7, 0x12, 0x1A, 0x47,
+};
+static const UCHAR _nx_crypto_aead_update_test_gcm_256_tag[] =
+{
+    0x76, 0xFC, 0x6E, 0xCE, 0x0F, 0x4E, 0x17, 0x68, 0xCD, 0xDF, 0x88, 0x53, 0xBB, 0x2D, 0x55, 0x1B,
+};
+
+/* Packet vector 1 of RFC 3610. The 16-byte tag is from the same inputs. */
+static const UCHAR _nx_crypto_aead_update_test_ccm_key[] =
+{
+    0xC0, 0xC1, 0xC2, 0xC3, 0xC4, 0xC5, 0xC6, 0xC7, 0xC8, 0xC9, 0xCA, 0xCB, 0xCC, 0xCD, 0xCE, 0xCF,
+};
+static const UCHAR _nx_crypto_aead_update_test_ccm_iv[] =
+{
+    13, 0x00, 0x00, 0x00, 0x03, 0x02, 0x01, 0x00, 0xA0, 0xA1, 0xA2, 0xA3, 0xA4, 0xA5,
+};
+static const UCHAR _nx_crypto_aead_update_test_ccm_aad[] =
+{
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+};
+static const UCHAR _nx_crypto_aead_update_test_ccm_plaintext[] =
+{
+    0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
+    0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E,
+};
+static const UCHAR _nx_crypto_aead_update_test_ccm_8_tag[] =
+{
+    0x17, 0xE8, 0xD1, 0x2C, 0xFD, 0xF9, 0x26, 0xE0,
+};
+static const UCHAR _nx_crypto_aead_update_test_ccm_16_tag[] =
+{
+    0x50, 0x9D, 0xA6, 0x54, 0xE3, 0x2D, 0xEA, 0xC3, 0x69, 0xC2, 0xDA, 0xE7, 0x13, 0x3C, 0xB0, 0x8D,
+};
+
+/* Section 2.8.2 of RFC 8439. */
+static const UCHAR _nx_crypto_aead_update_test_chacha_key[] =
+{
+    0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D, 0x8E, 0x8F,
+    0x90, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9A, 0x9B, 0x9C, 0x9D, 0x9E, 0x9F,
+};
+static const UCHAR _nx_crypto_aead_update_test_chacha_iv[] =
+{
+    12, 0x07, 0x00, 0x00, 0x00, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47,
+};
+static const UCHAR _nx_crypto_aead_update_test_chacha_aad[] =
+{
+    0x50, 0x51, 0x52, 0x53, 0xC0, 0xC1, 0xC2, 0xC3, 0xC4, 0xC5, 0xC6, 0xC7,
+};
+static const CHAR  _nx_crypto_aead_update_test_chacha_plaintext[] =
+    "Ladies and Gentlemen of the class of '99: If I could offer you only one tip for the future, sunscreen would be it.";
+static const UCHAR _nx_crypto_aead_update_test_chacha_tag[] =
+{
+    0x1A, 0xE1, 0x0B, 0x59, 0x4F, 0x09, 0xE2, 0x6A, 0x7E, 0x90, 0x2E, 0xCB, 0xD0, 0x60, 0x06, 0x91,
+};
+
+static const NX_CRYPTO_AEAD_UPDATE_TEST_METHOD _nx_crypto_aead_update_test_methods[] =
+{
+    {"aes-128-gcm", &crypto_method_aes_128_gcm_16, _nx_crypto_aead_update_test_gcm_key,
+     _nx_crypto_aead_update_test_gcm_iv, _nx_crypto_aead_update_test_gcm_aad, sizeof(_nx_crypto_aead_update_test_gcm_aad),
+     _nx_crypto_aead_update_test_gcm_plaintext, sizeof(_nx_crypto_aead_update_test_gcm_plaintext),
+     _nx_crypto_aead_update_test_gcm_128_tag},
+    {"aes-256-gcm", &crypto_method_aes_256_gcm_16, _nx_crypto_aead_update_test_gcm_key,
+     _nx_crypto_aead_update_test_gcm_iv, _nx_crypto_aead_update_test_gcm_aad, sizeof(_nx_crypto_aead_update_test_gcm_aad),
+     _nx_crypto_aead_update_test_gcm_plaintext, sizeof(_nx_crypto_aead_update_test_gcm_plaintext),
+     _nx_crypto_aead_update_test_gcm_256_tag},
+    {"aes-128-ccm-8", &crypto_method_aes_ccm_8, _nx_crypto_aead_update_test_ccm_key,
+     _nx_crypto_aead_update_test_ccm_iv, _nx_crypto_aead_update_test_ccm_aad, sizeof(_nx_crypto_aead_update_test_ccm_aad),
+     _nx_crypto_aead_update_test_ccm_plaintext, sizeof(_nx_crypto_aead_update_test_ccm_plaintext),
+     _nx_crypto_aead_update_test_ccm_8_tag},
+    {"aes-128-ccm-16", &crypto_method_aes_ccm_16, _nx_crypto_aead_update_test_ccm_key,
+     _nx_crypto_aead_update_test_ccm_iv, _nx_crypto_aead_update_test_ccm_aad, sizeof(_nx_crypto_aead_update_test_ccm_aad),
+     _nx_crypto_aead_update_test_ccm_plaintext, sizeof(_nx_crypto_aead_update_test_ccm_plaintext),
+     _nx_crypto_aead_update_test_ccm_16_tag},
+    {"chacha20-poly1305", &crypto_method_chacha20_poly1305, _nx_crypto_aead_update_test_chacha_key,
+     _nx_crypto_aead_update_test_chacha_iv, _nx_crypto_aead_update_test_chacha_aad, sizeof(_nx_crypto_aead_update_test_chacha_aad),
+     (const UCHAR *)_nx_crypto_aead_update_test_chacha_plaintext, sizeof(_nx_crypto_aead_update_test_chacha_plaintext) - 1,
+     _nx_crypto_aead_update_test_chacha_tag},
+};
+
+/* The method under test, its metadata and the additional data of the current message. */
+static const NX_CRYPTO_AEAD_UPDATE_TEST_METHOD *_nx_crypto_aead_update_test_current;
+static ULONG    _nx_crypto_aead_update_test_metadata[4096 / sizeof(ULONG)];
+static VOID    *_nx_crypto_aead_update_test_handler;
+static UCHAR    _nx_crypto_aead_update_test_aad[NX_CRYPTO_AEAD_UPDATE_TEST_MAX_AAD];
+static UINT     _nx_crypto_aead_update_test_aad_length;
+
+/* The plaintext, the one-shot reference, and the output of a split operation. */
+static UCHAR    _nx_crypto_aead_update_test_plaintext[NX_CRYPTO_AEAD_UPDATE_TEST_MAX_LENGTH];
+static UCHAR    _nx_crypto_aead_update_test_expected[NX_CRYPTO_AEAD_UPDATE_TEST_MAX_LENGTH + 16];
+static UCHAR    _nx_crypto_aead_update_test_output[NX_CRYPTO_AEAD_UPDATE_TEST_MAX_LENGTH];
+static UCHAR    _nx_crypto_aead_update_test_tag[16];
+static ULONG    _nx_crypto_aead_update_test_random_state;
+static UINT     _nx_crypto_aead_update_test_failures;
+
+static VOID  _nx_crypto_aead_update_test_check(UINT passed, const CHAR *condition, UINT line);
+static ULONG _nx_crypto_aead_update_test_random(VOID);
+static UINT  _nx_crypto_aead_update_test_operation(UINT op, UCHAR *input, UINT input_length, UCHAR *output,
+                                                   UINT output_length, UINT aad_length);
+static UINT  _nx_crypto_aead_update_test_known_answer(VOID);
+static UINT  _nx_crypto_aead_update_test_message(UINT length);
+static UINT  _nx_crypto_aead_update_test_split(UINT decrypt, UINT in_place, UINT length, const UINT *cuts, UINT cut_count);
+static UINT  _nx_crypto_aead_update_test_cuts(UINT length, const UINT *cuts, UINT cut_count);
+static UINT  _nx_crypto_aead_update_test_run(VOID);
+
+
+static VOID _nx_crypto_aead_update_test_check(UINT passed, const CHAR *condition, UINT line)
+{
+    if (!passed)
+    {
+        printf("  FAILED at line %u: %s\n", line, condition);
+        _nx_crypto_aead_update_test_failures++;
+    }
+}
+
+
+/* xorshift32, so that a failing seed can be run again. */
+static ULONG _nx_crypto_aead_update_test_random(VOID)
+{
+ULONG x = _nx_crypto_aead_update_test_random_state;
+
+    x ^= (x << 13) & 0xFFFFFFFFUL;
+    x ^= x >> 17;
+    x ^= (x << 5) & 0xFFFFFFFFUL;
+    _nx_crypto_aead_update_test_random_state = x;
+    return(x);
+}
+
+
+/* Call the current method with its key and IV. aad_length is the length of the additional
+   data, which the one-shot operations take from NX_CRYPTO_SET_ADDITIONAL_DATA. */
+static UINT _nx_crypto_aead_update_test_operation(UINT op, UCHAR *input, UINT input_length, UCHAR *output,
+                                                  UINT output_length, UINT aad_length)
+{
+NX_CRYPTO_METHOD *method = _nx_crypto_aead_update_test_current -> nx_crypto_aead_update_test_method;
+UINT              status;
+
+    if ((op == NX_CRYPTO_ENCRYPT) || (op == NX_CRYPTO_DECRYPT))
+    {
+        status = method -> nx_crypto_operation(NX_CRYPTO_SET_ADDITIONAL_DATA, _nx_crypto_aead_update_test_handler, method,
+                                               NX_CRYPTO_NULL, 0, _nx_crypto_aead_update_test_aad, aad_length,
+                                               NX_CRYPTO_NULL, NX_CRYPTO_NULL, 0,
+                                               _nx_crypto_aead_update_test_metadata,
+                                               sizeof(_nx_crypto_aead_update_test_metadata), NX_CRYPTO_NULL, NX_CRYPTO_NULL);
+        if (status != NX_CRYPTO_SUCCESS)
+        {
+            return(status);
+        }
+    }
+
+    return(method -> nx_crypto_operation(op, _nx_crypto_aead_update_test_handler, method,
+                                         (UCHAR *)_nx_crypto_aead_update_test_current -> nx_crypto_aead_update_test_key,
+                                         method -> nx_crypto_key_size_in_bits, input, input_length,
+                                         (UCHAR *)_nx_crypto_aead_update_test_current -> nx_crypto_aead_update_test_iv,
+                                         output, output_length, _nx_crypto_aead_update_test_metadata,
+                                         sizeof(_nx_crypto_aead_update_test_metadata), NX_CRYPTO_NULL, NX_CRYPTO_NULL));
+}
+
+
+/* Check the one-shot encrypt against the published vector. */
+static UINT _nx_crypto_aead_update_test_known_answer(VOID)
+{
+const NX_CRYPTO_AEAD_UPDATE_TEST_METHOD *current = _nx_crypto_aead_update_test_current;
+UINT                                     length = current -> nx_crypto_aead_update_test_plaintext_length;
+UINT                                     icv_size = current -> nx_crypto_aead_update_test_method -> nx_crypto_ICV_size_in_bits >> 3;
+
+    memcpy(_nx_crypto_aead_update_test_aad, current -> nx_crypto_aead_update_test_aad,
+           current -> nx_crypto_aead_update_test_aad_length);
+    memcpy(_nx_crypto_aead_update_test_plaintext, current -> nx_crypto_aead_update_test_plaintext, length);
+
+    if (_nx_crypto_aead_update_test_operation(NX_CRYPTO_ENCRYPT, _nx_crypto_aead_update_test_plaintext, length,
+                                              _nx_crypto_aead_update_test_expected, length + icv_size,
+                                              current -> nx_crypto_aead_update_test_aad_length) != NX_CRYPTO_SUCCESS)
+    {
+        return(NX_CRYPTO_FALSE);
+    }
+
+    return(memcmp(&_nx_crypto_aead_update_test_expected[length], current -> nx_crypto_aead_update_test_tag, icv_size) == 0);
+}
+
+
+/* Make a random message of the given length, with up to 20 bytes of additional data, and
+   its one-shot ciphertext and tag. */
+static UINT _nx_crypto_aead_update_test_message(UINT length)
+{
+UINT icv_size = _nx_crypto_aead_update_test_current -> nx_crypto_aead_update_test_method -> nx_crypto_ICV_size_in_bits >> 3;
+UINT i;
+
+    _nx_crypto_aead_update_test_aad_length = (UINT)(_nx_crypto_aead_update_test_random() % NX_CRYPTO_AEAD_UPDATE_TEST_MAX_AAD);
+    for (i = 0; i < _nx_crypto_aead_update_test_aad_length; i++)
+    {
+        _nx_crypto_aead_update_test_aad[i] = (UCHAR)_nx_crypto_aead_update_test_random();
+    }
+    for (i = 0; i < length; i++)
+    {
+        _nx_crypto_aead_update_test_plaintext[i] = (UCHAR)_nx_crypto_aead_update_test_random();
+    }
+
+    return(_nx_crypto_aead_update_test_operation(NX_CRYPTO_ENCRYPT, _nx_crypto_aead_update_test_plaintext, length,
+                                                 _nx_crypto_aead_update_test_expected, length + icv_size,
+                                                 _nx_crypto_aead_update_test_aad_length));
+}
+
+
+/* Encrypt the plaintext, or decrypt the reference ciphertext, with one update per chunk
+   between the given cuts, the way the record layer walks a packet chain. Return whether the
+   output and tag match the reference. */
+static UINT _nx_crypto_aead_update_test_split(UINT decrypt, UINT in_place, UINT length, const UINT *cuts, UINT cut_count)
+{
+UINT   icv_size = _nx_crypto_aead_update_test_current -> nx_crypto_aead_update_test_method -> nx_crypto_ICV_size_in_bits >> 3;
+UCHAR *input;
+UCHAR *expected;
+UINT   start = 0;
+UINT   end;
+UINT   i;
+UINT   status;
+
+    input = decrypt ? _nx_crypto_aead_update_test_expected : _nx_crypto_aead_update_test_plaintext;
+    expected = decrypt ? _nx_crypto_aead_update_test_plaintext : _nx_crypto_aead_update_test_expected;
+    if (in_place)
+    {
+        memcpy(_nx_crypto_aead_update_test_output, input, length);
+        input = _nx_crypto_aead_update_test_output;
+    }
+    else
+    {
+        memset(_nx_crypto_aead_update_test_output, 0, length);
+    }
+
+    status = _nx_crypto_aead_update_test_operation(decrypt ? NX_CRYPTO_DECRYPT_INITIALIZE : NX_CRYPTO_ENCRYPT_INITIALIZE,
+                                                   _nx_crypto_aead_update_test_aad, _nx_crypto_aead_update_test_aad_length,
+                                                   NX_CRYPTO_NULL, length, 0);
+    for (i = 0; (status == NX_CRYPTO_SUCCESS) && (i <= cut_count); i++)
+    {
+        end = (i < cut_count) ? cuts[i] : length;
+        status = _nx_crypto_aead_update_test_operation(decrypt ? NX_CRYPTO_DECRYPT_UPDATE : NX_CRYPTO_ENCRYPT_UPDATE,
+                                                       &input[start], end - start,
+                                                       &_nx_crypto_aead_update_test_output[start], end - start, 0);
+        start = end;
+    }
+    if (status != NX_CRYPTO_SUCCESS)
+    {
+        return(NX_CRYPTO_FALSE);
+    }
+
+    if (decrypt)
+    {
+
+        /* The tag is checked by the method. */
+        status = _nx_crypto_aead_update_test_operation(NX_CRYPTO_DECRYPT_CALCULATE, &_nx_crypto_aead_update_test_expected[length],
+                                                       icv_size, NX_CRYPTO_NULL, 0, 0);
+    }
+    else
+    {
+        status = _nx_crypto_aead_update_test_operation(NX_CRYPTO_ENCRYPT_CALCULATE, NX_CRYPTO_NULL, 0,
+                                                       _nx_crypto_aead_update_test_tag, icv_size, 0);
+        if (memcmp(_nx_crypto_aead_update_test_tag, &_nx_crypto_aead_update_test_expected[length], icv_size) != 0)
+        {
+            return(NX_CRYPTO_FALSE);
+        }
+    }
+
+    return((status == NX_CRYPTO_SUCCESS) && (memcmp(_nx_crypto_aead_update_test_output, expected, length) == 0));
+}
+
+
+/* Encrypt and decrypt the current message split at the given cuts, in place and out of place. */
+static UINT _nx_crypto_aead_update_test_cuts(UINT length, const UINT *cuts, UINT cut_count)
+{
+UINT decrypt;
+UINT in_place;
+UINT i;
+
+    for (decrypt = 0; decrypt < 2; decrypt++)
+    {
+        for (in_place = 0; in_place < 2; in_place++)
+        {
+            if (!_nx_crypto_aead_update_test_split(decrypt, in_place, length, cuts, cut_count))
+            {
+                printf("  %s %s %s, %u bytes, %u bytes of additional data, cuts at",
+                       _nx_crypto_aead_update_test_current -> nx_crypto_aead_update_test_name,
+                       decrypt ? "decrypt" : "encrypt", in_place ? "in place" : "out of place",
+                       length, _nx_crypto_aead_update_test_aad_length);
+                for (i = 0; i < cut_count; i++)
+                {
+                    printf(" %u", cuts[i]);
+                }
+                printf("\n");
+                return(1);
+            }
+        }
+    }
+
+    return(0);
+}
+
+
+/* Run every split of the current method. Return the number of failed splits. */
+static UINT _nx_crypto_aead_update_test_run(VOID)
+{
+static const UINT long_lengths[] = {255, 256, 257, 1000};
+UINT              icv_size = _nx_crypto_aead_update_test_current -> nx_crypto_aead_update_test_method -> nx_crypto_ICV_size_in_bits >> 3;
+UINT              cuts[NX_CRYPTO_AEAD_UPDATE_TEST_MAX_CUTS];
+UINT              cut_count;
+UINT              length;
+UINT              splits = 0;
+UINT              failures = 0;
+UINT              i;
+UINT              j;
+
+    /* One cut at every byte, which also covers the message in one update at either end. */
+    for (i = 0; i <= (NX_CRYPTO_AEAD_UPDATE_TEST_CUT_LENGTH + (sizeof(long_lengths) / sizeof(long_lengths[0]))); i++)
+    {
+        length = (i <= NX_CRYPTO_AEAD_UPDATE_TEST_CUT_LENGTH) ? i : long_lengths[i - NX_CRYPTO_AEAD_UPDATE_TEST_CUT_LENGTH - 1];
+        if (_nx_crypto_aead_update_test_message(length) != NX_CRYPTO_SUCCESS)
+        {
+            failures++;
+            continue;
+        }
+
+        for (cuts[0] = 0; cuts[0] <= length; cuts[0]++)
+        {
+            failures += _nx_crypto_aead_update_test_cuts(length, cuts, 1);
+            splits++;
+        }
+
+        /* A changed tag fails. */
+        _nx_crypto_aead_update_test_expected[length + icv_size - 1] ^= 0x01;
+        NX_CRYPTO_AEAD_UPDATE_TEST_CHECK(!_nx_crypto_aead_update_test_split(NX_CRYPTO_TRUE, NX_CRYPTO_FALSE, length, cuts, 0));
+    }
+
+    /* Two cuts at every pair of bytes. */
+    for (length = 0; length <= NX_CRYPTO_AEAD_UPDATE_TEST_PAIR_LENGTH; length++)
+    {
+        if (_nx_crypto_aead_update_test_message(length) != NX_CRYPTO_SUCCESS)
+        {
+            failures++;
+            continue;
+        }
+
+        for (cuts[0] = 0; cuts[0] <= length; cuts[0]++)
+        {
+            for (cuts[1] = cuts[0]; cuts[1] <= length; cuts[1]++)
+            {
+                failures += _nx_crypto_aead_update_test_cuts(length, cuts, 2);
+                splits++;
+            }
+        }
+    }
+
+    /* Random chunks, from empty to a few blocks long. */
+    for (i = 0; i < NX_CRYPTO_AEAD_UPDATE_TEST_ROUNDS; i++)
+    {
+        length = (UINT)(_nx_crypto_aead_update_test_random() % (NX_CRYPTO_AEAD_UPDATE_TEST_MAX_LENGTH + 1));
+        if (_nx_crypto_aead_update_test_message(length) != NX_CRYPTO_SUCCESS)
+        {
+            failures++;
+            continue;
+        }
+
+        cut_count = 0;
+        for (j = 0; cut_count < NX_CRYPTO_AEAD_UPDATE_TEST_MAX_CUTS; cut_count++)
+        {
+            j += (UINT)(_nx_crypto_aead_update_test_random() % 70);
+            if (j > length)
+            {
+                break;
+            }
+            cuts[cut_count] = j;
+        }
+        failures += _nx_crypto_aead_update_test_cuts(length, cuts, cut_count);
+        splits++;
+    }
+
+    printf("%-20s %u splits, %u failed\n", _nx_crypto_aead_update_test_current -> nx_crypto_aead_update_test_name,
+           splits, failures);
+    return(failures);
+}
+
+
+int main(int argc, char **argv)
+{
+ULONG seed = 0x2545F491;
+UINT  i;
+
+    if ((argc == 3) && (strcmp(argv[1], "-s") == 0))
+    {
+        seed = strtoul(argv[2], NX_CRYPTO_NULL, 0);
+    }
+    else if (argc != 1)
+    {
+        printf("usage: %s [-s seed]\n", argv[0]);
+        return(2);
+    }
+    _nx_crypto_aead_update_test_random_state = (seed & 0xFFFFFFFFUL) ? (seed & 0xFFFFFFFFUL) : 1;
+    printf("seed 0x%08lX\n", (unsigned long)seed);
+
+    for (i = 0; i < sizeof(_nx_crypto_aead_update_test_methods) / sizeof(_nx_crypto_aead_update_test_methods[0]); i++)
+    {
+        _nx_crypto_aead_update_test_current = &_nx_crypto_aead_update_test_methods[i];
+        NX_CRYPTO_AEAD_UPDATE_TEST_CHECK(_nx_crypto_aead_update_test_current -> nx_crypto_aead_update_test_method -> nx_crypto_init(
+                                             _nx_crypto_aead_update_test_current -> nx_crypto_aead_update_test_method,
+                                             (UCHAR *)_nx_crypto_aead_update_test_current -> nx_crypto_aead_update_test_key,
+                                             _nx_crypto_aead_update_test_current -> nx_crypto_aead_update_test_method -> nx_crypto_key_size_in_bits,
+                                             &_nx_crypto_aead_update_test_handler, _nx_crypto_aead_update_test_metadata,
+                                             sizeof(_nx_crypto_aead_update_test_metadata)) == NX_CRYPTO_SUCCESS);
+        NX_CRYPTO_AEAD_UPDATE_TEST_CHECK(_nx_crypto_aead_update_test_known_answer());
+        NX_CRYPTO_AEAD_UPDATE_TEST_CHECK(_nx_crypto_aead_update_test_run() == 0);
+    }
+
+    printf("%s, %u failed checks\n", _nx_crypto_aead_update_test_failures ? "FAILED" : "PASSED",
+           _nx_crypto_aead_update_test_failures);
+    return(_nx_crypto_aead_update_test_failures ? 1 : 0);
+}
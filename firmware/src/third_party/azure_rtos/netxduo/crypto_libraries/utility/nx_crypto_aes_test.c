@@ -0,0 +1,385 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Crypto Component                                                 */
+/**                                                                       */
+/**   AES Test                                                            */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+/**************************************************************************/
+/*                                                                        */
+/*  PROGRAM                                                RELEASE        */
+/*                                                                        */
+/*    nx_crypto_aes_test.c                                PORTABLE C      */
+/*                                                           6.1          */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This file is a host program, not part of the crypto library. It     */
+/*    checks the AES block core that the library was built with, then     */
+/*    times it.                                                           */
+/*                                                                        */
+/*    The checks run _nx_crypto_aes_key_set, _nx_crypto_aes_encrypt and   */
+/*    _nx_crypto_aes_decrypt directly, for 128, 192 and 256-bit keys:     */
+/*                                                                        */
+/*      - the FIPS-197 appendix C example vectors;                        */
+/*      - the SP 800-38A ECB vectors, with the blocks at an odd address   */
+/*        and in place as well;                                           */
+/*      - 100 keys of 1000 chained blocks in each direction, each key     */
+/*        derived from the previous output, against values from OpenSSL.  */
+/*                                                                        */
+/*    The benchmark then reports the median time of a single-block        */
+/*    encryption and decryption, and of a key setup, for each key size.   */
+/*                                                                        */
+/*    The Makefile in this directory builds it once for each AES core:    */
+/*    nx_crypto_aes_test with the default one,                            */
+/*    nx_crypto_aes_test_ttable with NX_CRYPTO_AES_USE_TTABLE_ROUNDS and  */
+/*    nx_crypto_aes_test_bitslice with NX_CRYPTO_AES_USE_BITSLICE.        */
+/*                                                                        */
+/*      make test                                                         */
+/*                                                                        */
+/*    runs all three. The program exits with 1 if any check fails.        */
+/*                                                                        */
+/**************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "nx_crypto_aes.h"
+
+#if defined(NX_CRYPTO_AES_USE_BITSLICE)
+#define NX_CRYPTO_AES_TEST_CORE             "bitsliced"
+#elif defined(NX_CRYPTO_AES_USE_TTABLE_ROUNDS)
+#define NX_CRYPTO_AES_TEST_CORE             "T-table rounds"
+#else
+#define NX_CRYPTO_AES_TEST_CORE             "default"
+#endif
+
+#define NX_CRYPTO_AES_TEST_REPETITIONS      9
+#define NX_CRYPTO_AES_TEST_BLOCKS           200000
+#define NX_CRYPTO_AES_TEST_KEYS             20000
+
+#define NX_CRYPTO_AES_TEST_CHECK(condition) _nx_crypto_aes_test_check((condition), #condition, __LINE__)
+
+typedef struct NX_CRYPTO_AES_TEST_VECTOR_STRUCT
+{
+    UINT        nx_crypto_aes_test_vector_key_bits;
+    const UCHAR nx_crypto_aes_test_vector_key[32];
+    const UCHAR nx_crypto_aes_test_vector_plaintext[64];
+    const UCHAR nx_crypto_aes_test_vector_ciphertext[64];
+} NX_CRYPTO_AES_TEST_VECTOR;
+
+/* FIPS-197 appendix C: one block. */
+static const NX_CRYPTO_AES_TEST_VECTOR _nx_crypto_aes_test_fips_197[] =
+{
+    {
+        128,
+        {0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F},
+        {0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88, 0x99, 0xAA, 0xBB, 0xCC, 0xDD, 0xEE, 0xFF},
+        {0x69, 0xC4, 0xE0, 0xD8, 0x6A, 0x7B, 0x04, 0x30, 0xD8, 0xCD, 0xB7, 0x80, 0x70, 0xB4, 0xC5, 0x5A},
+    },
+    {
+        192,
+        {0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F,
+         0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17},
+        {0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88, 0x99, 0xAA, 0xBB, 0xCC, 0xDD, 0xEE, 0xFF},
+        {0xDD, 0xA9, 0x7C, 0xA4, 0x86, 0x4C, 0xDF, 0xE0, 0x6E, 0xAF, 0x70, 0xA0, 0xEC, 0x0D, 0x71, 0x91},
+    },
+    {
+        256,
+        {0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F,
+         0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F},
+        {0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88, 0x99, 0xAA, 0xBB, 0xCC, 0xDD, 0xEE, 0xFF},
+        {0x8E, 0xA2, 0xB7, 0xCA, 0x51, 0x67, 0x45, 0xBF, 0xEA, 0xFC, 0x49, 0x90, 0x4B, 0x49, 0x60, 0x89},
+    },
+};
+
+/* SP 800-38A F.1: four ECB blocks. */
+#define NX_CRYPTO_AES_TEST_SP_800_38A_PLAINTEXT                                                         \
+        {0x6B, 0xC1, 0xBE, 0xE2, 0x2E, 0x40, 0x9F, 0x96, 0xE9, 0x3D, 0x7E, 0x11, 0x73, 0x93, 0x17, 0x2A, \
+         0xAE, 0x2D, 0x8A, 0x57, 0x1E, 0x03, 0xAC, 0x9C, 0x9E, 0xB7, 0x6F, 0xAC, 0x45, 0xAF, 0x8E, 0x51, \
+         0x30, 0xC8, 0x1C, 0x46, 0xA3, 0x5C, 0xE4, 0x11, 0xE5, 0xFB, 0xC1, 0x19, 0x1A, 0x0A, 0x52, 0xEF, \
+         0xF6, 0x9F, 0x24, 0x45, 0xDF, 0x4F, 0x9B, 0x17, 0xAD, 0x2B, 0x41, 0x7B, 0xE6, 0x6C, 0x37, 0x10}
+
+static const NX_CRYPTO_AES_TEST_VECTOR _nx_crypto_aes_test_sp_800_38a[] =
+{
+    {
+        128,
+        {0x2B, 0x7E, 0x15, 0x16, 0x28, 0xAE, 0xD2, 0xA6, 0xAB, 0xF7, 0x15, 0x88, 0x09, 0xCF, 0x4F, 0x3C},
+        NX_CRYPTO_AES_TEST_SP_800_38A_PLAINTEXT,
+        {0x3A, 0xD7, 0x7B, 0xB4, 0x0D, 0x7A, 0x36, 0x60, 0xA8, 0x9E, 0xCA, 0xF3, 0x24, 0x66, 0xEF, 0x97,
+         0xF5, 0xD3, 0xD5, 0x85, 0x03, 0xB9, 0x69, 0x9D, 0xE7, 0x85, 0x89, 0x5A, 0x96, 0xFD, 0xBA, 0xAF,
+         0x43, 0xB1, 0xCD, 0x7F, 0x59, 0x8E, 0xCE, 0x23, 0x88, 0x1B, 0x00, 0xE3, 0xED, 0x03, 0x06, 0x88,
+         0x7B, 0x0C, 0x78, 0x5E, 0x27, 0xE8, 0xAD, 0x3F, 0x82, 0x23, 0x20, 0x71, 0x04, 0x72, 0x5D, 0xD4},
+    },
+    {
+        192,
+        {0x8E, 0x73, 0xB0, 0xF7, 0xDA, 0x0E, 0x64, 0x52, 0xC8, 0x10, 0xF3, 0x2B, 0x80, 0x90, 0x79, 0xE5,
+         0x62, 0xF8, 0xEA, 0xD2, 0x52, 0x2C, 0x6B, 0x7B},
+        NX_CRYPTO_AES_TEST_SP_800_38A_PLAINTEXT,
+        {0xBD, 0x33, 0x4F, 0x1D, 0x6E, 0x45, 0xF2, 0x5F, 0xF7, 0x12, 0xA2, 0x14, 0x57, 0x1F, 0xA5, 0xCC,
+         0x97, 0x41, 0x04, 0x84, 0x6D, 0x0A, 0xD3, 0xAD, 0x77, 0x34, 0xEC, 0xB3, 0xEC, 0xEE, 0x4E, 0xEF,
+         0xEF, 0x7A, 0xFD, 0x22, 0x70, 0xE2, 0xE6, 0x0A, 0xDC, 0xE0, 0xBA, 0x2F, 0xAC, 0xE6, 0x44, 0x4E,
+         0x9A, 0x4B, 0x41, 0xBA, 0x73, 0x8D, 0x6C, 0x72, 0xFB, 0x16, 0x69, 0x16, 0x03, 0xC1, 0x8E, 0x0E},
+    },
+    {
+        256,
+        {0x60, 0x3D, 0xEB, 0x10, 0x15, 0xCA, 0x71, 0xBE, 0x2B, 0x73, 0xAE, 0xF0, 0x85, 0x7D, 0x77, 0x81,
+         0x1F, 0x35, 0x2C, 0x07, 0x3B, 0x61, 0x08, 0xD7, 0x2D, 0x98, 0x10, 0xA3, 0x09, 0x14, 0xDF, 0xF4},
+        NX_CRYPTO_AES_TEST_SP_800_38A_PLAINTEXT,
+        {0xF3, 0xEE, 0xD1, 0xBD, 0xB5, 0xD2, 0xA0, 0x3C, 0x06, 0x4B, 0x5A, 0x7E, 0x3D, 0xB1, 0x81, 0xF8,
+         0x59, 0x1C, 0xCB, 0x10, 0xD4, 0x10, 0xED, 0x26, 0xDC, 0x5B, 0xA7, 0x4A, 0x31, 0x36, 0x28, 0x70,
+         0xB6, 0xED, 0x21, 0xB9, 0x9C, 0xA6, 0xF4, 0xF9, 0xF1, 0x53, 0xE7, 0xB1, 0xBE, 0xAF, 0xED, 0x1D,
+         0x23, 0x30, 0x4B, 0x7A, 0x39, 0xF9, 0xF3, 0xFF, 0x06, 0x7D, 0x8D, 0x8F, 0x9E, 0x24, 0xEC, 0xC7},
+    },
+};
+
+/* Output of the chained test, encryption then decryption, for 128, 192 and 256-bit keys.
+   Computed with OpenSSL from the same starting key and block. */
+static const UCHAR _nx_crypto_aes_test_chained[2][3][16] =
+{
+    {
+        {0x4B, 0x9F, 0xFB, 0xAD, 0x77, 0x17, 0xD5, 0xEA, 0xF9, 0xD0, 0xB0, 0x0E, 0xFB, 0xAD, 0xBF, 0xDD},
+        {0xCA, 0x25, 0x3D, 0x43, 0xE6, 0xB2, 0x81, 0xB5, 0xC4, 0x31, 0xDA, 0xE2, 0x52, 0x82, 0x5A, 0xD9},
+        {0xB0, 0xFE, 0xF2, 0xCD, 0x66, 0x77, 0xF2, 0x29, 0xA9, 0x1C, 0x37, 0xB0, 0x44, 0xC4, 0x5C, 0xC2},
+    },
+    {
+        {0x9C, 0x51, 0x50, 0x32, 0xF4, 0xAD, 0xDE, 0x43, 0x98, 0xB2, 0x5B, 0xC5, 0x71, 0x03, 0x64, 0x9D},
+        {0xAF, 0xBF, 0xD2, 0xBB, 0xCC, 0x73, 0x41, 0x93, 0xC6, 0x11, 0xE0, 0x79, 0x2B, 0xAD, 0x45, 0x20},
+        {0xBD, 0xB8, 0x00, 0x90, 0x94, 0x1B, 0x0E, 0x03, 0x66, 0xAC, 0xB8, 0x75, 0xC4, 0xD0, 0xF0, 0xA3},
+    },
+};
+
+static NX_CRYPTO_AES  _nx_crypto_aes_test_context;
+static UINT           _nx_crypto_aes_test_failures;
+
+/* The last timed block is stored here so the compiler keeps the timed loops. */
+volatile UCHAR        _nx_crypto_aes_test_sink;
+
+static VOID   _nx_crypto_aes_test_check(INT passed, const CHAR *condition, INT line);
+static VOID   _nx_crypto_aes_test_vector(const NX_CRYPTO_AES_TEST_VECTOR *vector, UINT blocks, UINT offset);
+static VOID   _nx_crypto_aes_test_chain(UINT decrypt, UINT key_bits, const UCHAR *expected);
+static double _nx_crypto_aes_test_time(VOID);
+static double _nx_crypto_aes_test_median(double *values, UINT count);
+static int    _nx_crypto_aes_test_compare(const void *a, const void *b);
+
+
+static VOID _nx_crypto_aes_test_check(INT passed, const CHAR *condition, INT line)
+{
+    if (!passed)
+    {
+        printf("  FAILED at line %d: %s\n", line, condition);
+        _nx_crypto_aes_test_failures++;
+    }
+}
+
+
+/* Encrypt and decrypt the blocks of a vector one at a time, from buffers offset bytes past
+   an aligned address, then again in place. */
+static VOID _nx_crypto_aes_test_vector(const NX_CRYPTO_AES_TEST_VECTOR *vector, UINT blocks, UINT offset)
+{
+ULONG  input_area[(64 + 8) / sizeof(ULONG)];
+ULONG  output_area[(64 + 8) / sizeof(ULONG)];
+UCHAR *input = (UCHAR *)input_area + offset;
+UCHAR *output = (UCHAR *)output_area + offset;
+UINT   i;
+
+    NX_CRYPTO_AES_TEST_CHECK(_nx_crypto_aes_key_set(&_nx_crypto_aes_test_context,
+                                                    (UCHAR *)vector -> nx_crypto_aes_test_vector_key,
+                                                    vector -> nx_crypto_aes_test_vector_key_bits >> 5) == NX_CRYPTO_SUCCESS);
+
+    memcpy(input, vector -> nx_crypto_aes_test_vector_plaintext, blocks << 4);
+    for (i = 0; i < blocks; i++)
+    {
+        _nx_crypto_aes_encrypt(&_nx_crypto_aes_test_context, &input[i << 4], &output[i << 4], 16);
+    }
+    NX_CRYPTO_AES_TEST_CHECK(memcmp(output, vector -> nx_crypto_aes_test_vector_ciphertext, blocks << 4) == 0);
+
+    for (i = 0; i < blocks; i++)
+    {
+        _nx_crypto_aes_decrypt(&_nx_crypto_aes_test_context, &output[i << 4], &input[i << 4], 16);
+    }
+    NX_CRYPTO_AES_TEST_CHECK(memcmp(input, vector -> nx_crypto_aes_test_vector_plaintext, blocks << 4) == 0);
+
+    for (i = 0; i < blocks; i++)
+    {
+        _nx_crypto_aes_encrypt(&_nx_crypto_aes_test_context, &input[i << 4], &input[i << 4], 16);
+    }
+    NX_CRYPTO_AES_TEST_CHECK(memcmp(input, vector -> nx_crypto_aes_test_vector_ciphertext, blocks << 4) == 0);
+
+    for (i = 0; i < blocks; i++)
+    {
+        _nx_crypto_aes_decrypt(&_nx_crypto_aes_test_context, &input[i << 4], &input[i << 4], 16);
+    }
+    NX_CRYPTO_AES_TEST_CHECK(memcmp(input, vector -> nx_crypto_aes_test_vector_plaintext, blocks << 4) == 0);
+}
+
+
+/* Start from key 00 01 02 ... and block 00 11 22 ... For each of 100 keys, encrypt or decrypt
+   the block 1000 times in a chain, then XOR the block into the key. */
+static VOID _nx_crypto_aes_test_chain(UINT decrypt, UINT key_bits, const UCHAR *expected)
+{
+UCHAR key[32];
+UCHAR block[16];
+UINT  outer;
+UINT  inner;
+UINT  i;
+
+    for (i = 0; i < sizeof(key); i++)
+    {
+        key[i] = (UCHAR)i;
+    }
+    for (i = 0; i < sizeof(block); i++)
+    {
+        block[i] = (UCHAR)(0x11 * i);
+    }
+
+    for (outer = 0; outer < 100; outer++)
+    {
+        _nx_crypto_aes_key_set(&_nx_crypto_aes_test_context, key, key_bits >> 5);
+        for (inner = 0; inner < 1000; inner++)
+        {
+            if (decrypt)
+            {
+                _nx_crypto_aes_decrypt(&_nx_crypto_aes_test_context, block, block, 16);
+            }
+            else
+            {
+                _nx_crypto_aes_encrypt(&_nx_crypto_aes_test_context, block, block, 16);
+            }
+        }
+        for (i = 0; i < (key_bits >> 3); i++)
+        {
+            key[i] ^= block[i & 15];
+        }
+    }
+
+    NX_CRYPTO_AES_TEST_CHECK(memcmp(block, expected, sizeof(block)) == 0);
+}
+
+
+/* Monotonic time in seconds. */
+static double _nx_crypto_aes_test_time(VOID)
+{
+struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return((double)now.tv_sec + (double)now.tv_nsec * 1e-9);
+}
+
+
+/* qsort comparison of two doubles. */
+static int _nx_crypto_aes_test_compare(const void *a, const void *b)
+{
+double x = *(const double *)a;
+double y = *(const double *)b;
+
+    return((x > y) - (x < y));
+}
+
+
+static double _nx_crypto_aes_test_median(double *values, UINT count)
+{
+    qsort(values, count, sizeof(double), _nx_crypto_aes_test_compare);
+    return(values[count / 2]);
+}
+
+
+int main(void)
+{
+UCHAR  key[32];
+UCHAR  block[16];
+double encrypt_seconds[NX_CRYPTO_AES_TEST_REPETITIONS];
+double decrypt_seconds[NX_CRYPTO_AES_TEST_REPETITIONS];
+double key_seconds[NX_CRYPTO_AES_TEST_REPETITIONS];
+double encrypt_ns;
+double decrypt_ns;
+double start;
+UINT   key_bits;
+UINT   v;
+UINT   r;
+UINT   i;
+
+    printf("AES core: %s\n", NX_CRYPTO_AES_TEST_CORE);
+
+    for (v = 0; v < sizeof(_nx_crypto_aes_test_fips_197) / sizeof(_nx_crypto_aes_test_fips_197[0]); v++)
+    {
+        _nx_crypto_aes_test_vector(&_nx_crypto_aes_test_fips_197[v], 1, 0);
+    }
+
+    for (v = 0; v < sizeof(_nx_crypto_aes_test_sp_800_38a) / sizeof(_nx_crypto_aes_test_sp_800_38a[0]); v++)
+    {
+        _nx_crypto_aes_test_vector(&_nx_crypto_aes_test_sp_800_38a[v], 4, 0);
+        _nx_crypto_aes_test_vector(&_nx_crypto_aes_test_sp_800_38a[v], 4, 1);
+    }
+
+    for (v = 0; v < 3; v++)
+    {
+        _nx_crypto_aes_test_chain(NX_CRYPTO_FALSE, 128 + (v << 6), _nx_crypto_aes_test_chained[0][v]);
+        _nx_crypto_aes_test_chain(NX_CRYPTO_TRUE, 128 + (v << 6), _nx_crypto_aes_test_chained[1][v]);
+    }
+
+    printf("known answers: %s\n", _nx_crypto_aes_test_failures ? "FAILED" : "passed");
+
+    /* Single blocks in a chain, so each one waits for the last as in CBC and CCM. */
+    for (i = 0; i < sizeof(key); i++)
+    {
+        key[i] = (UCHAR)(i * 7 + 1);
+    }
+    memset(block, 0, sizeof(block));
+    printf("%-8s %12s %12s %12s %12s\n", "key", "encrypt ns", "decrypt ns", "encrypt MB/s", "key set ns");
+    for (key_bits = 128; key_bits <= 256; key_bits += 64)
+    {
+        for (r = 0; r < NX_CRYPTO_AES_TEST_REPETITIONS; r++)
+        {
+            _nx_crypto_aes_key_set(&_nx_crypto_aes_test_context, key, key_bits >> 5);
+
+            start = _nx_crypto_aes_test_time();
+            for (i = 0; i < NX_CRYPTO_AES_TEST_BLOCKS; i++)
+            {
+                _nx_crypto_aes_encrypt(&_nx_crypto_aes_test_context, block, block, 16);
+            }
+            encrypt_seconds[r] = _nx_crypto_aes_test_time() - start;
+
+            start = _nx_crypto_aes_test_time();
+            for (i = 0; i < NX_CRYPTO_AES_TEST_BLOCKS; i++)
+            {
+                _nx_crypto_aes_decrypt(&_nx_crypto_aes_test_context, block, block, 16);
+            }
+            decrypt_seconds[r] = _nx_crypto_aes_test_time() - start;
+
+            start = _nx_crypto_aes_test_time();
+            for (i = 0; i < NX_CRYPTO_AES_TEST_KEYS; i++)
+            {
+                key[0] ^= block[0];
+                _nx_crypto_aes_key_set(&_nx_crypto_aes_test_context, key, key_bits >> 5);
+            }
+            key_seconds[r] = _nx_crypto_aes_test_time() - start;
+        }
+
+        encrypt_ns = _nx_crypto_aes_test_median(encrypt_seconds, NX_CRYPTO_AES_TEST_REPETITIONS) * 1e9 / NX_CRYPTO_AES_TEST_BLOCKS;
+        decrypt_ns = _nx_crypto_aes_test_median(decrypt_seconds, NX_CRYPTO_AES_TEST_REPETITIONS) * 1e9 / NX_CRYPTO_AES_TEST_BLOCKS;
+        printf("AES-%-4u %12.1f %12.1f %12.1f %12.1f\n", key_bits, encrypt_ns, decrypt_ns, 16e3 / encrypt_ns,
+               _nx_crypto_aes_test_median(key_seconds, NX_CRYPTO_AES_TEST_REPETITIONS) * 1e9 / NX_CRYPTO_AES_TEST_KEYS);
+    }
+
+    _nx_crypto_aes_test_sink = block[0];
+
+    printf("%s, %u failed checks\n", _nx_crypto_aes_test_failures ? "FAILED" : "PASSED", _nx_crypto_aes_test_failures);
+    return(_nx_crypto_aes_test_failures ? 1 : 0);
+}
@@ -0,0 +1,358 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Crypto Component                                                 */
+/**                                                                       */
+/**   AES Timing Test                                                     */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+/**************************************************************************/
+/*                                                                        */
+/*  PROGRAM                                                RELEASE        */
+/*                                                                        */
+/*    nx_crypto_aes_timing_test.c                         PORTABLE C      */
+/*                                                           6.1          */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This file is a host program, not part of the crypto library. It     */
+/*    looks for data dependent timing in the AES core, in the manner of   */
+/*    dudect: each call is timed with one of two classes of input, fixed  */
+/*    or random, picked at random, and Welch's t-test compares the two    */
+/*    timing distributions. A core whose time does not depend on its      */
+/*    input gives a t statistic near zero however many calls are timed.   */
+/*                                                                        */
+/*    Three operations are tested: single-block encryption with a fixed   */
+/*    key and a fixed or random plaintext, single-block decryption with   */
+/*    a fixed or random ciphertext, and key setup with a fixed or random  */
+/*    key. The test is run on all the timings, and on those below each    */
+/*    of several percentiles of the first batch, which removes the long   */
+/*    tail of interrupts and cache misses that hides small differences.   */
+/*    The largest |t| of each operation is reported; the program exits    */
+/*    with 1 if it exceeds 10, the level at which dudect reports a leak.  */
+/*                                                                        */
+/*    Calls are timed with the time stamp counter on x86 hosts and with   */
+/*    the monotonic clock elsewhere.                                      */
+/*                                                                        */
+/*    The Makefile in this directory builds it with                       */
+/*    NX_CRYPTO_AES_USE_BITSLICE, the core meant to run in constant       */
+/*    time, and runs it from "make test". Run it as                       */
+/*                                                                        */
+/*      nx_crypto_aes_timing_test [-n measurements]                       */
+/*                                                                        */
+/*    The default is 1000000 measurements per operation.                  */
+/*                                                                        */
+/**************************************************************************/
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "nx_crypto_aes.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+#if defined(NX_CRYPTO_AES_USE_BITSLICE)
+#define NX_CRYPTO_AES_TIMING_TEST_CORE          "bitsliced"
+#elif defined(NX_CRYPTO_AES_USE_TTABLE_ROUNDS)
+#define NX_CRYPTO_AES_TIMING_TEST_CORE          "T-table rounds"
+#else
+#define NX_CRYPTO_AES_TIMING_TEST_CORE          "default"
+#endif
+
+#define NX_CRYPTO_AES_TIMING_TEST_BATCH         100000
+#define NX_CRYPTO_AES_TIMING_TEST_MEASUREMENTS  1000000
+#define NX_CRYPTO_AES_TIMING_TEST_CROPS         6
+#define NX_CRYPTO_AES_TIMING_TEST_LIMIT         10.0
+
+/* The operations under test. */
+#define NX_CRYPTO_AES_TIMING_TEST_ENCRYPT       0
+#define NX_CRYPTO_AES_TIMING_TEST_DECRYPT       1
+#define NX_CRYPTO_AES_TIMING_TEST_KEY_SET       2
+
+/* Running mean and sum of squared differences of the timings of each class. */
+typedef struct NX_CRYPTO_AES_TIMING_TEST_WELCH_STRUCT
+{
+    double nx_crypto_aes_timing_test_welch_count[2];
+    double nx_crypto_aes_timing_test_welch_mean[2];
+    double nx_crypto_aes_timing_test_welch_m2[2];
+} NX_CRYPTO_AES_TIMING_TEST_WELCH;
+
+/* Percentiles of the first batch the timings are cropped at; 100 keeps them all. */
+static const double _nx_crypto_aes_timing_test_percentiles[NX_CRYPTO_AES_TIMING_TEST_CROPS] =
+{
+    100.0, 99.0, 95.0, 90.0, 75.0, 50.0
+};
+
+static const CHAR *_nx_crypto_aes_timing_test_names[] =
+{
+    "encrypt, fixed or random plaintext",
+    "decrypt, fixed or random ciphertext",
+    "key set, fixed or random key",
+};
+
+static NX_CRYPTO_AES _nx_crypto_aes_timing_test_context;
+static UCHAR         _nx_crypto_aes_timing_test_inputs[NX_CRYPTO_AES_TIMING_TEST_BATCH][32];
+static UCHAR         _nx_crypto_aes_timing_test_classes[NX_CRYPTO_AES_TIMING_TEST_BATCH];
+static double        _nx_crypto_aes_timing_test_times[NX_CRYPTO_AES_TIMING_TEST_BATCH];
+static double        _nx_crypto_aes_timing_test_sorted[NX_CRYPTO_AES_TIMING_TEST_BATCH];
+static ULONG         _nx_crypto_aes_timing_test_random_state = 0x2545F491;
+
+/* The last output is stored here so the compiler keeps the timed calls. */
+volatile UCHAR       _nx_crypto_aes_timing_test_sink;
+
+static ULONG  _nx_crypto_aes_timing_test_random(VOID);
+static double _nx_crypto_aes_timing_test_now(VOID);
+static VOID   _nx_crypto_aes_timing_test_add(NX_CRYPTO_AES_TIMING_TEST_WELCH *welch, UINT input_class, double value);
+static double _nx_crypto_aes_timing_test_t(NX_CRYPTO_AES_TIMING_TEST_WELCH *welch);
+static int    _nx_crypto_aes_timing_test_compare(const void *a, const void *b);
+static double _nx_crypto_aes_timing_test_run(UINT operation, ULONG measurements);
+
+
+/* xorshift32. The inputs need not be unpredictable, only unrelated to the timing. */
+static ULONG _nx_crypto_aes_timing_test_random(VOID)
+{
+ULONG x = _nx_crypto_aes_timing_test_random_state;
+
+    x ^= (x << 13) & 0xFFFFFFFFUL;
+    x ^= x >> 17;
+    x ^= (x << 5) & 0xFFFFFFFFUL;
+    _nx_crypto_aes_timing_test_random_state = x;
+    return(x);
+}
+
+
+/* A timestamp in cycles where there is a counter, else in nanoseconds. */
+static double _nx_crypto_aes_timing_test_now(VOID)
+{
+#if defined(__x86_64__) || defined(__i386__)
+UINT            processor;
+
+    return((double)__rdtscp(&processor));
+#else
+struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return((double)now.tv_sec * 1e9 + (double)now.tv_nsec);
+#endif
+}
+
+
+static VOID _nx_crypto_aes_timing_test_add(NX_CRYPTO_AES_TIMING_TEST_WELCH *welch, UINT input_class, double value)
+{
+double delta;
+
+    welch -> nx_crypto_aes_timing_test_welch_count[input_class] += 1.0;
+    delta = value - welch -> nx_crypto_aes_timing_test_welch_mean[input_class];
+    welch -> nx_crypto_aes_timing_test_welch_mean[input_class] += delta / welch -> nx_crypto_aes_timing_test_welch_count[input_class];
+    welch -> nx_crypto_aes_timing_test_welch_m2[input_class] += delta * (value - welch -> nx_crypto_aes_timing_test_welch_mean[input_class]);
+}
+
+
+/* Welch's t statistic of the two classes, or 0 while either has too few timings. */
+static double _nx_crypto_aes_timing_test_t(NX_CRYPTO_AES_TIMING_TEST_WELCH *welch)
+{
+double variance[2];
+double denominator;
+UINT   i;
+
+    for (i = 0; i < 2; i++)
+    {
+        if (welch -> nx_crypto_aes_timing_test_welch_count[i] < 2.0)
+        {
+            return(0.0);
+        }
+        variance[i] = welch -> nx_crypto_aes_timing_test_welch_m2[i] / (welch -> nx_crypto_aes_timing_test_welch_count[i] - 1.0);
+    }
+
+    denominator = sqrt(variance[0] / welch -> nx_crypto_aes_timing_test_welch_count[0] +
+                       variance[1] / welch -> nx_crypto_aes_timing_test_welch_count[1]);
+    if (denominator == 0.0)
+    {
+        return(0.0);
+    }
+    return((welch -> nx_crypto_aes_timing_test_welch_mean[0] - welch -> nx_crypto_aes_timing_test_welch_mean[1]) / denominator);
+}
+
+
+/* qsort comparison of two doubles. */
+static int _nx_crypto_aes_timing_test_compare(const void *a, const void *b)
+{
+double x = *(const double *)a;
+double y = *(const double *)b;
+
+    return((x > y) - (x < y));
+}
+
+
+/* Time the operation on measurements inputs in batches, and return the largest |t| over the
+   crops. Class 0 is the fixed input, class 1 the random one. */
+static double _nx_crypto_aes_timing_test_run(UINT operation, ULONG measurements)
+{
+NX_CRYPTO_AES_TIMING_TEST_WELCH welch[NX_CRYPTO_AES_TIMING_TEST_CROPS];
+double                          thresholds[NX_CRYPTO_AES_TIMING_TEST_CROPS];
+UCHAR                           key[32];
+UCHAR                           fixed[32];
+UCHAR                           output[16];
+double                          start;
+double                          t;
+double                          largest = 0.0;
+ULONG                           done;
+UINT                            index;
+UINT                            batch;
+UINT                            c;
+UINT                            i;
+UINT                            j;
+
+    memset(welch, 0, sizeof(welch));
+    for (i = 0; i < sizeof(key); i++)
+    {
+        key[i] = (UCHAR)_nx_crypto_aes_timing_test_random();
+        fixed[i] = (UCHAR)_nx_crypto_aes_timing_test_random();
+    }
+    _nx_crypto_aes_key_set(&_nx_crypto_aes_timing_test_context, key, 4);
+
+    for (done = 0; done < measurements; done += batch)
+    {
+        batch = NX_CRYPTO_AES_TIMING_TEST_BATCH;
+        if ((measurements - done) < batch)
+        {
+            batch = (UINT)(measurements - done);
+        }
+
+        /* All inputs are made before timing starts, so only the call under test is timed. */
+        for (i = 0; i < batch; i++)
+        {
+            _nx_crypto_aes_timing_test_classes[i] = (UCHAR)(_nx_crypto_aes_timing_test_random() & 1);
+            for (j = 0; j < sizeof(_nx_crypto_aes_timing_test_inputs[i]); j++)
+            {
+                _nx_crypto_aes_timing_test_inputs[i][j] = _nx_crypto_aes_timing_test_classes[i] ?
+                    (UCHAR)_nx_crypto_aes_timing_test_random() : fixed[j];
+            }
+        }
+
+        for (i = 0; i < batch; i++)
+        {
+            switch (operation)
+            {
+            case NX_CRYPTO_AES_TIMING_TEST_ENCRYPT:
+                start = _nx_crypto_aes_timing_test_now();
+                _nx_crypto_aes_encrypt(&_nx_crypto_aes_timing_test_context, _nx_crypto_aes_timing_test_inputs[i], output, 16);
+                _nx_crypto_aes_timing_test_times[i] = _nx_crypto_aes_timing_test_now() - start;
+                break;
+
+            case NX_CRYPTO_AES_TIMING_TEST_DECRYPT:
+                start = _nx_crypto_aes_timing_test_now();
+                _nx_crypto_aes_decrypt(&_nx_crypto_aes_timing_test_context, _nx_crypto_aes_timing_test_inputs[i], output, 16);
+                _nx_crypto_aes_timing_test_times[i] = _nx_crypto_aes_timing_test_now() - start;
+                break;
+
+            default:
+                start = _nx_crypto_aes_timing_test_now();
+                _nx_crypto_aes_key_set(&_nx_crypto_aes_timing_test_context, _nx_crypto_aes_timing_test_inputs[i], 8);
+                _nx_crypto_aes_timing_test_times[i] = _nx_crypto_aes_timing_test_now() - start;
+                output[0] = (UCHAR)_nx_crypto_aes_timing_test_context.nx_crypto_aes_key_schedule[0];
+                break;
+            }
+            _nx_crypto_aes_timing_test_sink = output[0];
+        }
+
+        /* The crop thresholds come from the first batch. */
+        if (done == 0)
+        {
+            memcpy(_nx_crypto_aes_timing_test_sorted, _nx_crypto_aes_timing_test_times, batch * sizeof(double));
+            qsort(_nx_crypto_aes_timing_test_sorted, batch, sizeof(double), _nx_crypto_aes_timing_test_compare);
+            for (c = 0; c < NX_CRYPTO_AES_TIMING_TEST_CROPS; c++)
+            {
+                index = (UINT)((double)(batch - 1) * _nx_crypto_aes_timing_test_percentiles[c] / 100.0);
+                thresholds[c] = _nx_crypto_aes_timing_test_sorted[index];
+            }
+        }
+
+        for (i = 0; i < batch; i++)
+        {
+            for (c = 0; c < NX_CRYPTO_AES_TIMING_TEST_CROPS; c++)
+            {
+                if (_nx_crypto_aes_timing_test_times[i] <= thresholds[c])
+                {
+                    _nx_crypto_aes_timing_test_add(&welch[c], _nx_crypto_aes_timing_test_classes[i],
+                                                   _nx_crypto_aes_timing_test_times[i]);
+                }
+            }
+        }
+    }
+
+    for (c = 0; c < NX_CRYPTO_AES_TIMING_TEST_CROPS; c++)
+    {
+        t = fabs(_nx_crypto_aes_timing_test_t(&welch[c]));
+        printf("  below p%-5.0f  fixed %8.1f  random %8.1f  |t| %6.2f\n", _nx_crypto_aes_timing_test_percentiles[c],
+               welch[c].nx_crypto_aes_timing_test_welch_mean[0], welch[c].nx_crypto_aes_timing_test_welch_mean[1], t);
+        if (t > largest)
+        {
+            largest = t;
+        }
+    }
+
+    return(largest);
+}
+
+
+int main(int argc, char **argv)
+{
+ULONG  measurements = NX_CRYPTO_AES_TIMING_TEST_MEASUREMENTS;
+double t;
+UINT   failures = 0;
+UINT   operation;
+
+    if ((argc == 3) && (strcmp(argv[1], "-n") == 0))
+    {
+        measurements = strtoul(argv[2], NX_CRYPTO_NULL, 10);
+    }
+    else if (argc != 1)
+    {
+        fprintf(stderr, "Usage: %s [-n measurements]\n", argv[0]);
+        return(1);
+    }
+
+    printf("AES core: %s, %lu measurements per operation, times in %s\n", NX_CRYPTO_AES_TIMING_TEST_CORE,
+           (unsigned long)measurements,
+#if defined(__x86_64__) || defined(__i386__)
+           "cycles"
+#else
+           "ns"
+#endif
+           );
+
+    for (operation = NX_CRYPTO_AES_TIMING_TEST_ENCRYPT; operation <= NX_CRYPTO_AES_TIMING_TEST_KEY_SET; operation++)
+    {
+        printf("%s\n", _nx_crypto_aes_timing_test_names[operation]);
+        t = _nx_crypto_aes_timing_test_run(operation, measurements);
+        printf("  largest |t| %.2f: %s\n", t,
+               (t > NX_CRYPTO_AES_TIMING_TEST_LIMIT) ? "timing depends on the input" :
+               (t > 4.5) ? "possible dependence, run with more measurements" : "no dependence found");
+        if (t > NX_CRYPTO_AES_TIMING_TEST_LIMIT)
+        {
+            failures++;
+        }
+    }
+
+    printf("%s\n", failures ? "FAILED" : "PASSED");
+    return(failures ? 1 : 0);
+}
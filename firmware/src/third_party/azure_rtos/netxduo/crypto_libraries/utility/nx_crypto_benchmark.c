@@ -0,0 +1,1165 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Crypto Component                                                 */
+/**                                                                       */
+/**   Benchmark                                                           */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+/**************************************************************************/
+/*                                                                        */
+/*  PROGRAM                                                RELEASE        */
+/*                                                                        */
+/*    nx_crypto_benchmark.c                               PORTABLE C      */
+/*                                                           6.1          */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This file is a host program, not part of the crypto library. It     */
+/*    measures the crypto methods used by NetX Secure, each driven        */
+/*    through its nx_crypto_init and nx_crypto_operation entries the      */
+/*    same way TLS drives it: AES-CBC, AES-CTR, AES-GCM, AES-CCM,         */
+/*    ChaCha20-Poly1305, SHA-1/256/384/512, HMAC, the TLS PRFs, HKDF,     */
+/*    ECDSA and ECDH on P-256 and P-384, and RSA-2048. The global DRBG    */
+/*    behind NX_CRYPTO_RBG is called through _nx_crypto_drbg, which is    */
+/*    how TLS gets its randoms; "make benchmark-drbg" compares it with    */
+/*    and without NX_CRYPTO_DRBG_OUTPUT_BUFFER_SIZE.                      */
+/*                                                                        */
+/*    Every case is warmed up, then repeated; the repetition count and    */
+/*    the time of each repetition are set on the command line and the     */
+/*    median repetition is reported. Bulk cases run at fixed message      */
+/*    sizes. The result is written as CSV (default) or JSON on the        */
+/*    standard output, one record per case and size, with nanoseconds,    */
+/*    cycles per operation, cycles per byte, operations per second and    */
+/*    megabytes per second. Cycles are read from the time stamp counter   */
+/*    on x86 hosts; elsewhere, or when -m gives the core clock in MHz,    */
+/*    they are derived from the elapsed time.                             */
+/*                                                                        */
+/*    Build it with the Makefile in this directory, or by hand:           */
+/*                                                                        */
+/*      gcc -O2 -DNX_CRYPTO_STANDALONE_ENABLE -I../inc                    */
+/*          -I../ports/linux/gnu/inc                                      */
+/*          nx_crypto_benchmark.c ../src/nx_crypto*.c                     */
+/*          -o nx_crypto_benchmark                                        */
+/*                                                                        */
+/*    and run it as                                                       */
+/*                                                                        */
+/*      nx_crypto_benchmark [-j] [-r repetitions] [-t milliseconds]       */
+/*          [-w milliseconds] [-m MHz] [-s size[,size...]] [filter]       */
+/*                                                                        */
+/*    where filter, when given, selects the cases whose name contains     */
+/*    it, for example "gcm" or "p256".                                    */
+/*                                                                        */
+/**************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "nx_crypto_aes.h"
+#include "nx_crypto_chacha20_poly1305.h"
+#include "nx_crypto_drbg.h"
+#include "nx_crypto_ecdh.h"
+#include "nx_crypto_ecdsa.h"
+#include "nx_crypto_hkdf.h"
+#include "nx_crypto_rsa.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define NX_CRYPTO_BENCHMARK_CYCLES()        ((unsigned long long)__rdtsc())
+#endif
+
+/* Default message sizes of the bulk cases, in bytes. 16384 is a full TLS record. */
+#define NX_CRYPTO_BENCHMARK_MAX_SIZES       16
+#define NX_CRYPTO_BENCHMARK_MAX_SIZE        16384
+#define NX_CRYPTO_BENCHMARK_MAX_REPETITIONS 101
+
+/* Metadata of the largest method, RSA with a Montgomery window of 4, is about 7 KB. */
+#define NX_CRYPTO_BENCHMARK_METADATA_SIZE   16384
+
+/* Kinds of case, which select how a case is set up and run. */
+#define NX_CRYPTO_BENCHMARK_CIPHER          0   /* One-shot NX_CRYPTO_ENCRYPT.                 */
+#define NX_CRYPTO_BENCHMARK_AEAD            1   /* ENCRYPT_INITIALIZE, UPDATE and CALCULATE.   */
+#define NX_CRYPTO_BENCHMARK_HASH            2   /* One-shot NX_CRYPTO_AUTHENTICATE.            */
+#define NX_CRYPTO_BENCHMARK_HMAC            3   /* NX_CRYPTO_AUTHENTICATE, keyed on each call. */
+#define NX_CRYPTO_BENCHMARK_HMAC_CACHED     4   /* NX_CRYPTO_HMAC_CACHED_AUTHENTICATE.         */
+#define NX_CRYPTO_BENCHMARK_PRF             5   /* TLS PRF, size is the output length.        */
+#define NX_CRYPTO_BENCHMARK_HKDF            6   /* Extract then expand, size is the output.   */
+#define NX_CRYPTO_BENCHMARK_DRBG            7   /* _nx_crypto_drbg, size is the request.      */
+#define NX_CRYPTO_BENCHMARK_ECDSA_SIGN      8
+#define NX_CRYPTO_BENCHMARK_ECDSA_VERIFY    9
+#define NX_CRYPTO_BENCHMARK_ECDH_SETUP      10  /* Ephemeral key pair generation.             */
+#define NX_CRYPTO_BENCHMARK_ECDH_CALCULATE  11  /* Shared secret from the peer public key.    */
+#define NX_CRYPTO_BENCHMARK_RSA_PUBLIC      12
+#define NX_CRYPTO_BENCHMARK_RSA_PRIVATE     13  /* CRT with the primes set.                   */
+
+/* The DRBG case is named after the build of nx_crypto_drbg.c it is linked with. */
+#ifdef NX_CRYPTO_DRBG_OUTPUT_BUFFER_SIZE
+#define NX_CRYPTO_BENCHMARK_DRBG_NAME       "drbg-buffered"
+#else
+#define NX_CRYPTO_BENCHMARK_DRBG_NAME       "drbg"
+#endif
+
+extern NX_CRYPTO_METHOD crypto_method_aes_cbc_128;
+extern NX_CRYPTO_METHOD crypto_method_aes_cbc_256;
+extern NX_CRYPTO_METHOD crypto_method_aes_128_gcm_16;
+extern NX_CRYPTO_METHOD crypto_method_aes_256_gcm_16;
+extern NX_CRYPTO_METHOD crypto_method_aes_ccm_16;
+extern NX_CRYPTO_METHOD crypto_method_chacha20_poly1305;
+extern NX_CRYPTO_METHOD crypto_method_sha1;
+extern NX_CRYPTO_METHOD crypto_method_sha256;
+extern NX_CRYPTO_METHOD crypto_method_sha384;
+extern NX_CRYPTO_METHOD crypto_method_sha512;
+extern NX_CRYPTO_METHOD crypto_method_hmac_sha1;
+extern NX_CRYPTO_METHOD crypto_method_hmac_sha256;
+extern NX_CRYPTO_METHOD crypto_method_hmac_sha384;
+extern NX_CRYPTO_METHOD crypto_method_hmac;
+extern NX_CRYPTO_METHOD crypto_method_hkdf;
+extern NX_CRYPTO_METHOD crypto_method_drbg;
+extern NX_CRYPTO_METHOD crypto_method_tls_prf_sha256;
+extern NX_CRYPTO_METHOD crypto_method_tls_prf_sha384;
+extern NX_CRYPTO_METHOD crypto_method_ecdsa;
+extern NX_CRYPTO_METHOD crypto_method_ecdh;
+extern NX_CRYPTO_METHOD crypto_method_ec_secp256;
+extern NX_CRYPTO_METHOD crypto_method_ec_secp384;
+extern NX_CRYPTO_METHOD crypto_method_rsa;
+
+/* nx_crypto_methods.c has no AES-CTR method since TLS does not use it, so
+   declare one here. The key is followed by the 4-byte nonce.  */
+static NX_CRYPTO_METHOD _nx_crypto_benchmark_aes_ctr_128 =
+{
+    NX_CRYPTO_ENCRYPTION_AES_CTR,                /* AES crypto algorithm                   */
+    NX_CRYPTO_AES_128_KEY_LEN_IN_BITS,           /* Key size in bits                       */
+    NX_CRYPTO_AES_CTR_IV_LEN_IN_BITS,            /* IV size in bits                        */
+    0,                                           /* ICV size in bits, not used             */
+    (NX_CRYPTO_AES_BLOCK_SIZE_IN_BITS >> 3),     /* Block size in bytes                    */
+    sizeof(NX_CRYPTO_AES),                       /* Metadata size in bytes                 */
+    _nx_crypto_method_aes_init,                  /* AES-CTR initialization routine         */
+    _nx_crypto_method_aes_cleanup,               /* AES-CTR cleanup routine                */
+    _nx_crypto_method_aes_operation              /* AES-CTR operation                      */
+};
+
+typedef struct NX_CRYPTO_BENCHMARK_CASE_STRUCT
+{
+    const CHAR       *nx_crypto_benchmark_case_name;
+    const CHAR       *nx_crypto_benchmark_case_operation;
+    UINT              nx_crypto_benchmark_case_kind;
+    NX_CRYPTO_METHOD *nx_crypto_benchmark_case_method;
+
+    /* Key size in bits of ciphers and HMAC, or the bulk method. */
+    UINT              nx_crypto_benchmark_case_key_bits;
+
+    /* Curve of ECDSA and ECDH, hash of HKDF. */
+    NX_CRYPTO_METHOD *nx_crypto_benchmark_case_auxiliary_method;
+} NX_CRYPTO_BENCHMARK_CASE;
+
+static const NX_CRYPTO_BENCHMARK_CASE _nx_crypto_benchmark_cases[] =
+{
+    {"aes-128-cbc",       "encrypt",    NX_CRYPTO_BENCHMARK_CIPHER,         &crypto_method_aes_cbc_128,       128, NX_CRYPTO_NULL},
+    {"aes-256-cbc",       "encrypt",    NX_CRYPTO_BENCHMARK_CIPHER,         &crypto_method_aes_cbc_256,       256, NX_CRYPTO_NULL},
+    {"aes-128-ctr",       "encrypt",    NX_CRYPTO_BENCHMARK_CIPHER,         &_nx_crypto_benchmark_aes_ctr_128, 128, NX_CRYPTO_NULL},
+    {"aes-128-gcm",       "encrypt",    NX_CRYPTO_BENCHMARK_AEAD,           &crypto_method_aes_128_gcm_16,    128, NX_CRYPTO_NULL},
+    {"aes-256-gcm",       "encrypt",    NX_CRYPTO_BENCHMARK_AEAD,           &crypto_method_aes_256_gcm_16,    256, NX_CRYPTO_NULL},
+    {"aes-128-ccm",       "encrypt",    NX_CRYPTO_BENCHMARK_AEAD,           &crypto_method_aes_ccm_16,        128, NX_CRYPTO_NULL},
+    {"chacha20-poly1305", "encrypt",    NX_CRYPTO_BENCHMARK_AEAD,           &crypto_method_chacha20_poly1305, 256, NX_CRYPTO_NULL},
+    {"sha1",              "hash",       NX_CRYPTO_BENCHMARK_HASH,           &crypto_method_sha1,              0,   NX_CRYPTO_NULL},
+    {"sha256",            "hash",       NX_CRYPTO_BENCHMARK_HASH,           &crypto_method_sha256,            0,   NX_CRYPTO_NULL},
+    {"sha384",            "hash",       NX_CRYPTO_BENCHMARK_HASH,           &crypto_method_sha384,            0,   NX_CRYPTO_NULL},
+    {"sha512",            "hash",       NX_CRYPTO_BENCHMARK_HASH,           &crypto_method_sha512,            0,   NX_CRYPTO_NULL},
+    {"hmac-sha1",         "mac",        NX_CRYPTO_BENCHMARK_HMAC,           &crypto_method_hmac_sha1,         160, NX_CRYPTO_NULL},
+    {"hmac-sha1",         "mac-cached", NX_CRYPTO_BENCHMARK_HMAC_CACHED,    &crypto_method_hmac_sha1,         160, NX_CRYPTO_NULL},
+    {"hmac-sha256",       "mac",        NX_CRYPTO_BENCHMARK_HMAC,           &crypto_method_hmac_sha256,       256, NX_CRYPTO_NULL},
+    {"hmac-sha256",       "mac-cached", NX_CRYPTO_BENCHMARK_HMAC_CACHED,    &crypto_method_hmac_sha256,       256, NX_CRYPTO_NULL},
+    {"hmac-sha384",       "mac",        NX_CRYPTO_BENCHMARK_HMAC,           &crypto_method_hmac_sha384,       384, NX_CRYPTO_NULL},
+    {"hmac-sha384",       "mac-cached", NX_CRYPTO_BENCHMARK_HMAC_CACHED,    &crypto_method_hmac_sha384,       384, NX_CRYPTO_NULL},
+    {"tls-prf-sha256",    "derive",     NX_CRYPTO_BENCHMARK_PRF,            &crypto_method_tls_prf_sha256,    0,   NX_CRYPTO_NULL},
+    {"tls-prf-sha384",    "derive",     NX_CRYPTO_BENCHMARK_PRF,            &crypto_method_tls_prf_sha384,    0,   NX_CRYPTO_NULL},
+    {"hkdf-sha256",       "derive",     NX_CRYPTO_BENCHMARK_HKDF,           &crypto_method_hkdf,              0,   &crypto_method_sha256},
+    {"hkdf-sha384",       "derive",     NX_CRYPTO_BENCHMARK_HKDF,           &crypto_method_hkdf,              0,   &crypto_method_sha384},
+    {NX_CRYPTO_BENCHMARK_DRBG_NAME, "generate", NX_CRYPTO_BENCHMARK_DRBG, &crypto_method_drbg, 0, NX_CRYPTO_NULL},
+    {"ecdsa-p256",        "sign",       NX_CRYPTO_BENCHMARK_ECDSA_SIGN,     &crypto_method_ecdsa,             0,   &crypto_method_ec_secp256},
+    {"ecdsa-p256",        "verify",     NX_CRYPTO_BENCHMARK_ECDSA_VERIFY,   &crypto_method_ecdsa,             0,   &crypto_method_ec_secp256},
+    {"ecdsa-p384",        "sign",       NX_CRYPTO_BENCHMARK_ECDSA_SIGN,     &crypto_method_ecdsa,             0,   &crypto_method_ec_secp384},
+    {"ecdsa-p384",        "verify",     NX_CRYPTO_BENCHMARK_ECDSA_VERIFY,   &crypto_method_ecdsa,             0,   &crypto_method_ec_secp384},
+    {"ecdh-p256",         "setup",      NX_CRYPTO_BENCHMARK_ECDH_SETUP,     &crypto_method_ecdh,              0,   &crypto_method_ec_secp256},
+    {"ecdh-p256",         "calculate",  NX_CRYPTO_BENCHMARK_ECDH_CALCULATE, &crypto_method_ecdh,              0,   &crypto_method_ec_secp256},
+    {"ecdh-p384",         "setup",      NX_CRYPTO_BENCHMARK_ECDH_SETUP,     &crypto_method_ecdh,              0,   &crypto_method_ec_secp384},
+    {"ecdh-p384",         "calculate",  NX_CRYPTO_BENCHMARK_ECDH_CALCULATE, &crypto_method_ecdh,              0,   &crypto_method_ec_secp384},
+    {"rsa-2048",          "public",     NX_CRYPTO_BENCHMARK_RSA_PUBLIC,     &crypto_method_rsa,               2048, NX_CRYPTO_NULL},
+    {"rsa-2048",          "private",    NX_CRYPTO_BENCHMARK_RSA_PRIVATE,    &crypto_method_rsa,               2048, NX_CRYPTO_NULL},
+};
+
+/* RSA-2048 key used by the RSA cases, generated for this program only. */
+static const UCHAR _nx_crypto_benchmark_rsa_modulus[] =
+{
+    0xA2, 0x78, 0x54, 0xD5, 0xE6, 0x39, 0x18, 0x56, 0x0A, 0x85, 0x68, 0x5B, 0x59, 0x69, 0x6A, 0x58,
+    0x61, 0x59, 0x72, 0xAC, 0x85, 0xCB, 0xCF, 0x8C, 0xBF, 0xE8, 0x89, 0xDC, 0x71, 0x5D, 0x4E, 0x66,
+    0x90, 0x7E, 0x76, 0xDB, 0x2F, 0x74, 0xFF, 0xB7, 0x26, 0xE2, 0x3D, 0x83, 0x51, 0x49, 0xB8, 0x5F,
+    0xDB, 0xB7, 0x3D, 0xE8, 0x35, 0x19, 0xD2, 0xBF, 0x40, 0x0F, 0x16, 0x23, 0x9A, 0xD7, 0xB3, 0x83,
+    0x51, 0xD3, 0xB0, 0xBE, 0x73, 0x5C, 0x62, 0x99, 0x6A, 0xD8, 0x81, 0xA4, 0x9A, 0x6C, 0x6D, 0x4F,
+    0x1E, 0xF2, 0x45, 0xDD, 0x2F, 0xC2, 0x14, 0xD7, 0xEB, 0xAF, 0x78, 0x18, 0x1E, 0x29, 0xA9, 0x09,
+    0xC6, 0xB8, 0x57, 0x21, 0xC1, 0x9F, 0x3F, 0x27, 0x4F, 0x85, 0x79, 0x2C, 0xD5, 0x2F, 0xA1, 0xDC,
+    0x83, 0xE4, 0x60, 0x2C, 0x04, 0x5D, 0xC9, 0x4C, 0xC7, 0xB2, 0x3D, 0x88, 0x31, 0x29, 0x24, 0x35,
+    0x9D, 0xFE, 0x18, 0x7E, 0x47, 0x6C, 0x96, 0xF8, 0x95, 0xB3, 0x89, 0x52, 0xCA, 0xA6, 0x57, 0xF4,
+    0xA2, 0x6C, 0xC0, 0x88, 0x79, 0x1F, 0xCC, 0x94, 0x47, 0xC5, 0x3D, 0xA2, 0x43, 0x99, 0x92, 0x3D,
+    0xF9, 0x81, 0x98, 0x12, 0x82, 0xF2, 0x9C, 0x0E, 0xD6, 0x34, 0x16, 0x3A, 0xFF, 0x60, 0x3C, 0xC3,
+    0x00, 0xDB, 0x8C, 0x3B, 0x63, 0xF3, 0x40, 0x76, 0x44, 0x7D, 0x5F, 0xA8, 0xB6, 0x56, 0xA4, 0xD4,
+    0x7F, 0xD1, 0x67, 0x67, 0xC3, 0x61, 0xAE, 0x5E, 0xC8, 0xB3, 0xF5, 0xDC, 0x4B, 0x46, 0xB6, 0xAA,
+    0xBE, 0xFB, 0xE2, 0x0D, 0xEC, 0xD2, 0xC2, 0x6A, 0x2D, 0x3E, 0xD5, 0xBF, 0x43, 0xBE, 0x53, 0x9A,
+    0x48, 0xBA, 0xAE, 0x32, 0xE9, 0x0D, 0x09, 0x16, 0x99, 0x6D, 0x54, 0xD3, 0x5D, 0xEA, 0xD8, 0x0F,
+    0xF2, 0x49, 0xD2, 0xFC, 0xB1, 0xB7, 0xA1, 0x37, 0x33, 0x4C, 0x1A, 0xCF, 0x32, 0x76, 0x1C, 0x2D,
+};
+
+static const UCHAR _nx_crypto_benchmark_rsa_public_exponent[] = {0x00, 0x01, 0x00, 0x01};
+
+static const UCHAR _nx_crypto_benchmark_rsa_private_exponent[] =
+{
+    0x04, 0x21, 0x77, 0x94, 0xB5, 0xA5, 0x03, 0x79, 0xA2, 0x8C, 0x58, 0x46, 0x24, 0x4C, 0x92, 0x13,
+    0xDB, 0xAB, 0xC4, 0xC6, 0xDE, 0xA2, 0xFB, 0x2C, 0xAA, 0xAF, 0x6C, 0x9B, 0xE2, 0x74, 0xFB, 0x1A,
+    0x8F, 0xF7, 0x6B, 0x29, 0xB0, 0xF7, 0xF2, 0x4D, 0x73, 0x8B, 0x62, 0x81, 0x7D, 0x76, 0x58, 0x9D,
+    0xF5, 0x4D, 0xE0, 0x20, 0xD0, 0x82, 0xCE, 0xD1, 0x26, 0x7D, 0x8B, 0xB4, 0x4D, 0x8A, 0x48, 0xE9,
+    0xE0, 0x91, 0x77, 0x87, 0xAC, 0x12, 0xAF, 0xFE, 0x13, 0x11, 0x9C, 0xA0, 0x34, 0xFD, 0xE7, 0x3C,
+    0x90, 0xFE, 0x9B, 0x68, 0x9F, 0x7F, 0x79, 0x7C, 0xB0, 0xE5, 0x15, 0xF2, 0x55, 0x07, 0xFD, 0xA0,
+    0x7E, 0x41, 0x2F, 0x13, 0xF0, 0x62, 0x8E, 0x5E, 0x3F, 0x3F, 0x17, 0x40, 0xDC, 0xCD, 0xB8, 0x79,
+    0x8D, 0x0F, 0xE8, 0x23, 0x0E, 0x5C, 0x5D, 0x13, 0x1A, 0xEB, 0xAC, 0xF5, 0x52, 0xBC, 0xA7, 0x4B,
+    0x3C, 0x4F, 0x90, 0x27, 0x42, 0x75, 0x32, 0xD7, 0x80, 0x0A, 0xFA, 0x97, 0x99, 0x42, 0x72, 0x0D,
+    0x8B, 0x94, 0xC2, 0x50, 0x31, 0x2D, 0x11, 0x0D, 0x72, 0x44, 0xF6, 0x0C, 0xCA, 0x4F, 0xF5, 0x1D,
+    0x56, 0xC0, 0xC3, 0x21, 0xB9, 0xD2, 0xA5, 0x3E, 0x58, 0x58, 0xFD, 0x5E, 0xE5, 0x61, 0x91, 0xE9,
+    0x06, 0x8A, 0xC9, 0x8F, 0x3C, 0x55, 0x40, 0x8E, 0x53, 0x40, 0xD8, 0x33, 0xF9, 0x1A, 0xC8, 0x1D,
+    0xE6, 0xAC, 0x37, 0x8D, 0xB2, 0x8A, 0x23, 0x78, 0x17, 0xA6, 0x63, 0x3F, 0xD0, 0x58, 0x7B, 0x59,
+    0x0D, 0x28, 0xAD, 0xD3, 0x20, 0xB3, 0x4D, 0x27, 0x20, 0x87, 0x5E, 0x0A, 0xF7, 0xA4, 0x4F, 0xD6,
+    0x34, 0x7F, 0x74, 0x7F, 0x41, 0x81, 0x42, 0x35, 0x90, 0xEE, 0x92, 0x83, 0x75, 0x40, 0xA4, 0x96,
+    0x2E, 0xB2, 0x3D, 0x81, 0x87, 0x3A, 0x11, 0x85, 0x8E, 0xAC, 0x61, 0xAB, 0x78, 0x28, 0xDF, 0x81,
+};
+
+static const UCHAR _nx_crypto_benchmark_rsa_prime_p[] =
+{
+    0xD3, 0xEE, 0xBA, 0x6E, 0xFF, 0xAD, 0xD9, 0x83, 0x0F, 0x9A, 0x6D, 0x69, 0x66, 0xF7, 0xDF, 0xA8,
+    0x5F, 0xDF, 0x17, 0x12, 0x73, 0xAF, 0x34, 0xFE, 0x39, 0xB6, 0xAA, 0x42, 0x81, 0x14, 0xEE, 0xD2,
+    0x51, 0x6E, 0xFD, 0x36, 0x10, 0x78, 0x89, 0xD6, 0x6E, 0xBB, 0xF4, 0x01, 0xA3, 0x7C, 0x56, 0x11,
+    0xA3, 0xFE, 0x70, 0x19, 0xE1, 0xBB, 0x74, 0x4B, 0xE7, 0x28, 0xF1, 0xF5, 0x6D, 0xEC, 0xC9, 0xCD,
+    0x36, 0xA3, 0x49, 0x29, 0x52, 0x47, 0xF4, 0xB7, 0xE6, 0xEA, 0xE2, 0x18, 0x28, 0xE9, 0xD5, 0xB9,
+    0xCD, 0x5F, 0xD5, 0x58, 0x6F, 0x46, 0x58, 0xA4, 0x28, 0xEA, 0x22, 0x40, 0x40, 0x04, 0x88, 0xA4,
+    0x5E, 0x7D, 0x83, 0xEF, 0xDA, 0xA6, 0x48, 0xE6, 0xA9, 0x6C, 0xDC, 0xB7, 0x6E, 0xE5, 0x2C, 0x52,
+    0xDC, 0x3C, 0x81, 0xF2, 0x9D, 0xAA, 0x69, 0xF2, 0x73, 0x95, 0x91, 0x8E, 0xF7, 0xE9, 0x6A, 0x81,
+};
+
+static const UCHAR _nx_crypto_benchmark_rsa_prime_q[] =
+{
+    0xC4, 0x40, 0xB0, 0xDC, 0x10, 0x2C, 0x3C, 0xFC, 0xA0, 0xCB, 0xC5, 0x0E, 0x3F, 0x39, 0x59, 0x74,
+    0xD6, 0x9D, 0x32, 0x17, 0x6B, 0x87, 0xFC, 0xA3, 0xCB, 0x64, 0x5F, 0x40, 0x83, 0xFC, 0xD5, 0x4E,
+    0xB7, 0x4E, 0x45, 0xD2, 0xF7, 0x8C, 0x26, 0xE2, 0xDA, 0x1B, 0xE0, 0xF1, 0xFE, 0x5E, 0x3A, 0xB7,
+    0xE6, 0x52, 0x6F, 0x83, 0xBD, 0x10, 0x36, 0xDB, 0x00, 0x50, 0x66, 0xF7, 0xDF, 0xA1, 0xA1, 0x76,
+    0x79, 0xC0, 0x0A, 0x35, 0x0E, 0x38, 0x91, 0x18, 0x22, 0x33, 0x90, 0x69, 0xAA, 0x3F, 0xBC, 0x06,
+    0x42, 0x94, 0x7C, 0x47, 0xB6, 0x40, 0x7F, 0xFC, 0x39, 0x2E, 0xEE, 0xFA, 0xC7, 0xC3, 0x8D, 0x59,
+    0x58, 0x2E, 0x56, 0xFA, 0x0A, 0x0F, 0x11, 0x2E, 0x7E, 0xA2, 0x42, 0x41, 0x12, 0xC4, 0x17, 0x8A,
+    0xF4, 0xE0, 0xC4, 0xCD, 0x95, 0xF9, 0xF9, 0x10, 0x67, 0xB0, 0x07, 0xD5, 0x5C, 0x69, 0xA3, 0xAD,
+};
+
+/* Metadata of the case being measured, and the ECDSA/ECDH key material. */
+static ULONG    _nx_crypto_benchmark_metadata[NX_CRYPTO_BENCHMARK_METADATA_SIZE / sizeof(ULONG)];
+static HN_UBASE _nx_crypto_benchmark_scratch[1024];
+static UCHAR    _nx_crypto_benchmark_input[NX_CRYPTO_BENCHMARK_MAX_SIZE];
+static UCHAR    _nx_crypto_benchmark_output[NX_CRYPTO_BENCHMARK_MAX_SIZE + 64];
+static UCHAR    _nx_crypto_benchmark_private_key[68];
+static UCHAR    _nx_crypto_benchmark_public_key[140];
+static UINT     _nx_crypto_benchmark_public_key_length;
+static UCHAR    _nx_crypto_benchmark_signature[160];
+static UINT     _nx_crypto_benchmark_signature_length;
+static UINT     _nx_crypto_benchmark_private_key_size;
+static UINT     _nx_crypto_benchmark_message_length;
+static VOID    *_nx_crypto_benchmark_handler;
+
+/* Key, nonce, IV and additional data. The key is long enough for HMAC-SHA384,
+   the AES-CTR nonce follows the AES key and the GCM and CCM IV starts with
+   its length.  */
+static UCHAR    _nx_crypto_benchmark_key[64] =
+{
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F,
+    0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F,
+    0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F,
+    0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A, 0x3B, 0x3C, 0x3D, 0x3E, 0x3F,
+};
+static UCHAR    _nx_crypto_benchmark_iv[16] =
+{
+    12, 0xCA, 0xFE, 0xBA, 0xBE, 0xFA, 0xCE, 0xDB, 0xAD, 0xDE, 0xCA, 0xF8, 0x88, 0x00, 0x00, 0x00,
+};
+static UCHAR    _nx_crypto_benchmark_aad[13];
+static UCHAR    _nx_crypto_benchmark_secret[48];
+static UCHAR    _nx_crypto_benchmark_label[77] = "key expansion";
+
+static UINT  _nx_crypto_benchmark_setup(const NX_CRYPTO_BENCHMARK_CASE *benchmark_case);
+static UINT  _nx_crypto_benchmark_run(const NX_CRYPTO_BENCHMARK_CASE *benchmark_case, UINT size);
+static UINT  _nx_crypto_benchmark_hkdf(NX_CRYPTO_METHOD *hash_method, UINT size);
+static UINT  _nx_crypto_benchmark_ec_setup(const NX_CRYPTO_BENCHMARK_CASE *benchmark_case);
+static double _nx_crypto_benchmark_time(VOID);
+static int   _nx_crypto_benchmark_compare(const void *a, const void *b);
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_benchmark_setup                          PORTABLE C      */
+/*                                                           6.1          */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function initializes the method of a case once, before it is  */
+/*    measured, so a run only contains the work TLS does per record or    */
+/*    per handshake message.                                              */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    benchmark_case                        Case to set up                */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    [nx_crypto_init]                      Initialize the method         */
+/*    [nx_crypto_operation]                 Set the RSA primes            */
+/*    _nx_crypto_benchmark_ec_setup         Set up ECDSA or ECDH          */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    main                                  Run the benchmark             */
+/*                                                                        */
+/**************************************************************************/
+static UINT _nx_crypto_benchmark_setup(const NX_CRYPTO_BENCHMARK_CASE *benchmark_case)
+{
+NX_CRYPTO_METHOD *method = benchmark_case -> nx_crypto_benchmark_case_method;
+UINT              status = NX_CRYPTO_SUCCESS;
+
+    if (method -> nx_crypto_metadata_area_size > sizeof(_nx_crypto_benchmark_metadata))
+    {
+        return(NX_CRYPTO_INVALID_BUFFER_SIZE);
+    }
+
+    NX_CRYPTO_MEMSET(_nx_crypto_benchmark_metadata, 0, sizeof(_nx_crypto_benchmark_metadata));
+    _nx_crypto_benchmark_handler = NX_CRYPTO_NULL;
+
+    switch (benchmark_case -> nx_crypto_benchmark_case_kind)
+    {
+    case NX_CRYPTO_BENCHMARK_CIPHER:
+    case NX_CRYPTO_BENCHMARK_AEAD:
+    case NX_CRYPTO_BENCHMARK_HASH:
+    case NX_CRYPTO_BENCHMARK_HMAC:
+    case NX_CRYPTO_BENCHMARK_HMAC_CACHED:
+        if (method -> nx_crypto_init)
+        {
+            status = method -> nx_crypto_init(method, _nx_crypto_benchmark_key,
+                                              benchmark_case -> nx_crypto_benchmark_case_key_bits,
+                                              &_nx_crypto_benchmark_handler,
+                                              _nx_crypto_benchmark_metadata,
+                                              sizeof(_nx_crypto_benchmark_metadata));
+        }
+
+        /* The cached case sets the key once, as P_hash and HKDF-Expand do for each call. */
+        if ((status == NX_CRYPTO_SUCCESS) &&
+            (benchmark_case -> nx_crypto_benchmark_case_kind == NX_CRYPTO_BENCHMARK_HMAC_CACHED))
+        {
+            status = method -> nx_crypto_operation(NX_CRYPTO_HASH_INITIALIZE, _nx_crypto_benchmark_handler, method,
+                                                   _nx_crypto_benchmark_key,
+                                                   benchmark_case -> nx_crypto_benchmark_case_key_bits,
+                                                   NX_CRYPTO_NULL, 0, NX_CRYPTO_NULL, NX_CRYPTO_NULL, 0,
+                                                   _nx_crypto_benchmark_metadata,
+                                                   sizeof(_nx_crypto_benchmark_metadata),
+                                                   NX_CRYPTO_NULL, NX_CRYPTO_NULL);
+        }
+        break;
+
+    case NX_CRYPTO_BENCHMARK_ECDSA_SIGN:
+    case NX_CRYPTO_BENCHMARK_ECDSA_VERIFY:
+    case NX_CRYPTO_BENCHMARK_ECDH_SETUP:
+    case NX_CRYPTO_BENCHMARK_ECDH_CALCULATE:
+        status = _nx_crypto_benchmark_ec_setup(benchmark_case);
+        break;
+
+    case NX_CRYPTO_BENCHMARK_RSA_PUBLIC:
+    case NX_CRYPTO_BENCHMARK_RSA_PRIVATE:
+        status = method -> nx_crypto_init(method, (UCHAR *)_nx_crypto_benchmark_rsa_modulus,
+                                          sizeof(_nx_crypto_benchmark_rsa_modulus) << 3,
+                                          &_nx_crypto_benchmark_handler,
+                                          _nx_crypto_benchmark_metadata,
+                                          sizeof(_nx_crypto_benchmark_metadata));
+        if ((status == NX_CRYPTO_SUCCESS) &&
+            (benchmark_case -> nx_crypto_benchmark_case_kind == NX_CRYPTO_BENCHMARK_RSA_PRIVATE))
+        {
+            status = method -> nx_crypto_operation(NX_CRYPTO_SET_PRIME_P, _nx_crypto_benchmark_handler, method,
+                                                   NX_CRYPTO_NULL, 0,
+                                                   (UCHAR *)_nx_crypto_benchmark_rsa_prime_p,
+                                                   sizeof(_nx_crypto_benchmark_rsa_prime_p),
+                                                   NX_CRYPTO_NULL, NX_CRYPTO_NULL, 0,
+                                                   _nx_crypto_benchmark_metadata,
+                                                   sizeof(_nx_crypto_benchmark_metadata),
+                                                   NX_CRYPTO_NULL, NX_CRYPTO_NULL);
+            if (status == NX_CRYPTO_SUCCESS)
+            {
+                status = method -> nx_crypto_operation(NX_CRYPTO_SET_PRIME_Q, _nx_crypto_benchmark_handler, method,
+                                                       NX_CRYPTO_NULL, 0,
+                                                       (UCHAR *)_nx_crypto_benchmark_rsa_prime_q,
+                                                       sizeof(_nx_crypto_benchmark_rsa_prime_q),
+                                                       NX_CRYPTO_NULL, NX_CRYPTO_NULL, 0,
+                                                       _nx_crypto_benchmark_metadata,
+                                                       sizeof(_nx_crypto_benchmark_metadata),
+                                                       NX_CRYPTO_NULL, NX_CRYPTO_NULL);
+            }
+        }
+
+        /* The message must be smaller than the modulus. */
+        _nx_crypto_benchmark_input[0] = 0;
+        break;
+
+    default:
+
+        /* PRF and HKDF are initialized on every run, as TLS does. */
+        break;
+    }
+
+    return(status);
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_benchmark_ec_setup                       PORTABLE C      */
+/*                                                           6.1          */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function sets the curve of an ECDSA or ECDH case. For ECDSA    */
+/*    it generates the key pair and, for verification, the signature to  */
+/*    verify. For ECDH it generates the public key used as the peer key.  */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    benchmark_case                        Case to set up                */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    [nx_crypto_init]                      Initialize the method         */
+/*    [nx_crypto_operation]                 Set the curve and the hash,   */
+/*                                            generate keys               */
+/*    _nx_crypto_ec_key_pair_generation_extra                             */
+/*                                          Generate an ECDSA key pair    */
+/*    _nx_crypto_huge_number_extract_fixed_size                           */
+/*                                          Extract the private key       */
+/*    _nx_crypto_ec_point_extract_uncompressed                            */
+/*                                          Extract the public key        */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_crypto_benchmark_setup            Set up a case                 */
+/*                                                                        */
+/**************************************************************************/
+static UINT _nx_crypto_benchmark_ec_setup(const NX_CRYPTO_BENCHMARK_CASE *benchmark_case)
+{
+NX_CRYPTO_METHOD         *method = benchmark_case -> nx_crypto_benchmark_case_method;
+NX_CRYPTO_METHOD         *curve_method = benchmark_case -> nx_crypto_benchmark_case_auxiliary_method;
+NX_CRYPTO_EC             *curve = NX_CRYPTO_NULL;
+NX_CRYPTO_HUGE_NUMBER     private_key;
+NX_CRYPTO_EC_POINT        public_key;
+NX_CRYPTO_EXTENDED_OUTPUT extended_output;
+HN_UBASE                 *scratch;
+UINT                      buffer_size;
+UINT                      status;
+
+    status = curve_method -> nx_crypto_operation(NX_CRYPTO_EC_CURVE_GET, NX_CRYPTO_NULL, curve_method,
+                                                 NX_CRYPTO_NULL, 0, NX_CRYPTO_NULL, 0, NX_CRYPTO_NULL,
+                                                 (UCHAR *)&curve, sizeof(NX_CRYPTO_EC *),
+                                                 NX_CRYPTO_NULL, 0, NX_CRYPTO_NULL, NX_CRYPTO_NULL);
+    if (status)
+    {
+        return(status);
+    }
+
+    status = method -> nx_crypto_init(method, NX_CRYPTO_NULL, 0, &_nx_crypto_benchmark_handler,
+                                      _nx_crypto_benchmark_metadata, sizeof(_nx_crypto_benchmark_metadata));
+    if (status)
+    {
+        return(status);
+    }
+
+    /* ECDSA hashes the message, with SHA-256 on P-256 and SHA-384 on P-384 as TLS does. */
+    if (method == &crypto_method_ecdsa)
+    {
+        status = method -> nx_crypto_operation(NX_CRYPTO_HASH_METHOD_SET, _nx_crypto_benchmark_handler, method,
+                                               NX_CRYPTO_NULL, 0,
+                                               (UCHAR *)((curve -> nx_crypto_ec_bits > 256) ?
+                                                         &crypto_method_sha384 : &crypto_method_sha256),
+                                               sizeof(NX_CRYPTO_METHOD *),
+                                               NX_CRYPTO_NULL, NX_CRYPTO_NULL, 0,
+                                               _nx_crypto_benchmark_metadata,
+                                               sizeof(_nx_crypto_benchmark_metadata),
+                                               NX_CRYPTO_NULL, NX_CRYPTO_NULL);
+        if (status)
+        {
+            return(status);
+        }
+    }
+
+    status = method -> nx_crypto_operation(NX_CRYPTO_EC_CURVE_SET, _nx_crypto_benchmark_handler, method,
+                                           NX_CRYPTO_NULL, 0,
+                                           (UCHAR *)curve_method, sizeof(NX_CRYPTO_METHOD *),
+                                           NX_CRYPTO_NULL, NX_CRYPTO_NULL, 0,
+                                           _nx_crypto_benchmark_metadata, sizeof(_nx_crypto_benchmark_metadata),
+                                           NX_CRYPTO_NULL, NX_CRYPTO_NULL);
+    if (status)
+    {
+        return(status);
+    }
+
+    /* Sign a message as long as the hash. */
+    buffer_size = curve -> nx_crypto_ec_n.nx_crypto_huge_buffer_size;
+    _nx_crypto_benchmark_message_length = (curve -> nx_crypto_ec_bits + 7) >> 3;
+    _nx_crypto_benchmark_private_key_size = buffer_size;
+
+    if ((benchmark_case -> nx_crypto_benchmark_case_kind == NX_CRYPTO_BENCHMARK_ECDH_SETUP) ||
+        (benchmark_case -> nx_crypto_benchmark_case_kind == NX_CRYPTO_BENCHMARK_ECDH_CALCULATE))
+    {
+        extended_output.nx_crypto_extended_output_data = _nx_crypto_benchmark_public_key;
+        extended_output.nx_crypto_extended_output_length_in_byte = sizeof(_nx_crypto_benchmark_public_key);
+        status = method -> nx_crypto_operation(NX_CRYPTO_DH_SETUP, _nx_crypto_benchmark_handler, method,
+                                               NX_CRYPTO_NULL, 0, NX_CRYPTO_NULL, 0, NX_CRYPTO_NULL,
+                                               (UCHAR *)&extended_output, sizeof(extended_output),
+                                               _nx_crypto_benchmark_metadata,
+                                               sizeof(_nx_crypto_benchmark_metadata),
+                                               NX_CRYPTO_NULL, NX_CRYPTO_NULL);
+        _nx_crypto_benchmark_public_key_length = (UINT)extended_output.nx_crypto_extended_output_actual_size;
+        return(status);
+    }
+
+    scratch = _nx_crypto_benchmark_scratch;
+    NX_CRYPTO_EC_POINT_INITIALIZE(&public_key, NX_CRYPTO_EC_POINT_AFFINE, scratch, buffer_size);
+    NX_CRYPTO_HUGE_NUMBER_INITIALIZE(&private_key, scratch, buffer_size + 8);
+    status = _nx_crypto_ec_key_pair_generation_extra(curve, &curve -> nx_crypto_ec_g, &private_key,
+                                                     &public_key, scratch);
+    if (status)
+    {
+        return(status);
+    }
+
+    status = _nx_crypto_huge_number_extract_fixed_size(&private_key, _nx_crypto_benchmark_private_key, buffer_size);
+    if (status)
+    {
+        return(status);
+    }
+
+    _nx_crypto_benchmark_public_key_length = 0;
+    _nx_crypto_ec_point_extract_uncompressed(curve, &public_key, _nx_crypto_benchmark_public_key,
+                                             sizeof(_nx_crypto_benchmark_public_key),
+                                             &_nx_crypto_benchmark_public_key_length);
+
+    /* Sign once, so verification has a signature and signing is checked. */
+    extended_output.nx_crypto_extended_output_data = _nx_crypto_benchmark_signature;
+    extended_output.nx_crypto_extended_output_length_in_byte = sizeof(_nx_crypto_benchmark_signature);
+    status = method -> nx_crypto_operation(NX_CRYPTO_SIGNATURE_GENERATE, _nx_crypto_benchmark_handler, method,
+                                           _nx_crypto_benchmark_private_key, buffer_size << 3,
+                                           _nx_crypto_benchmark_input, _nx_crypto_benchmark_message_length,
+                                           NX_CRYPTO_NULL, (UCHAR *)&extended_output, sizeof(extended_output),
+                                           _nx_crypto_benchmark_metadata, sizeof(_nx_crypto_benchmark_metadata),
+                                           NX_CRYPTO_NULL, NX_CRYPTO_NULL);
+    _nx_crypto_benchmark_signature_length = (UINT)extended_output.nx_crypto_extended_output_actual_size;
+
+    return(status);
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_benchmark_hkdf                           PORTABLE C      */
+/*                                                           6.1          */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function runs an HKDF-Extract followed by an HKDF-Expand in    */
+/*    the sequence of _nx_secure_tls_hkdf_extract and                     */
+/*    _nx_secure_tls_hkdf_expand_label.                                   */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    hash_method                           Hash of the HKDF              */
+/*    size                                  Output length in bytes        */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    [nx_crypto_init]                      Initialize the HKDF           */
+/*    [nx_crypto_operation]                 Extract and expand            */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_crypto_benchmark_run              Run a case once               */
+/*                                                                        */
+/**************************************************************************/
+static UINT _nx_crypto_benchmark_hkdf(NX_CRYPTO_METHOD *hash_method, UINT size)
+{
+NX_CRYPTO_METHOD *method = &crypto_method_hkdf;
+UCHAR             prk[64];
+UINT              hash_length = hash_method -> nx_crypto_ICV_size_in_bits >> 3;
+UINT              step;
+UINT              status = NX_CRYPTO_SUCCESS;
+
+    for (step = 0; (step < 2) && (status == NX_CRYPTO_SUCCESS); step++)
+    {
+        status = method -> nx_crypto_init(method,
+                                          (step == 0) ? _nx_crypto_benchmark_secret : NX_CRYPTO_NULL,
+                                          (step == 0) ? (hash_length << 3) : 0, NX_CRYPTO_NULL,
+                                          _nx_crypto_benchmark_metadata, sizeof(_nx_crypto_benchmark_metadata));
+        if (status == NX_CRYPTO_SUCCESS)
+        {
+            status = method -> nx_crypto_operation(NX_CRYPTO_HKDF_SET_HMAC, NX_CRYPTO_NULL, &crypto_method_hmac,
+                                                   NX_CRYPTO_NULL, 0, NX_CRYPTO_NULL, 0, NX_CRYPTO_NULL,
+                                                   NX_CRYPTO_NULL, 0, _nx_crypto_benchmark_metadata,
+                                                   sizeof(_nx_crypto_benchmark_metadata),
+                                                   NX_CRYPTO_NULL, NX_CRYPTO_NULL);
+        }
+        if (status == NX_CRYPTO_SUCCESS)
+        {
+            status = method -> nx_crypto_operation(NX_CRYPTO_HKDF_SET_HASH, NX_CRYPTO_NULL, hash_method,
+                                                   NX_CRYPTO_NULL, 0, NX_CRYPTO_NULL, 0, NX_CRYPTO_NULL,
+                                                   NX_CRYPTO_NULL, 0, _nx_crypto_benchmark_metadata,
+                                                   sizeof(_nx_crypto_benchmark_metadata),
+                                                   NX_CRYPTO_NULL, NX_CRYPTO_NULL);
+        }
+        if (status != NX_CRYPTO_SUCCESS)
+        {
+            break;
+        }
+
+        if (step == 0)
+        {
+            status = method -> nx_crypto_operation(NX_CRYPTO_HKDF_EXTRACT, NX_CRYPTO_NULL, method,
+                                                   _nx_crypto_benchmark_key, hash_length << 3,
+                                                   _nx_crypto_benchmark_secret, hash_length, NX_CRYPTO_NULL,
+                                                   prk, sizeof(prk), _nx_crypto_benchmark_metadata,
+                                                   sizeof(_nx_crypto_benchmark_metadata),
+                                                   NX_CRYPTO_NULL, NX_CRYPTO_NULL);
+        }
+        else
+        {
+            status = method -> nx_crypto_operation(NX_CRYPTO_HKDF_SET_PRK, NX_CRYPTO_NULL, method,
+                                                   prk, hash_length << 3, NX_CRYPTO_NULL, 0, NX_CRYPTO_NULL,
+                                                   NX_CRYPTO_NULL, 0, _nx_crypto_benchmark_metadata,
+                                                   sizeof(_nx_crypto_benchmark_metadata),
+                                                   NX_CRYPTO_NULL, NX_CRYPTO_NULL);
+            if (status == NX_CRYPTO_SUCCESS)
+            {
+                status = method -> nx_crypto_operation(NX_CRYPTO_HKDF_EXPAND, NX_CRYPTO_NULL, method,
+                                                       _nx_crypto_benchmark_label, 13 << 3,
+                                                       NX_CRYPTO_NULL, 0, NX_CRYPTO_NULL,
+                                                       _nx_crypto_benchmark_output, size,
+                                                       _nx_crypto_benchmark_metadata,
+                                                       sizeof(_nx_crypto_benchmark_metadata),
+                                                       NX_CRYPTO_NULL, NX_CRYPTO_NULL);
+            }
+        }
+    }
+
+    return(status);
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_benchmark_run                            PORTABLE C      */
+/*                                                           6.1          */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function runs one operation of a case that has been set up.   */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    benchmark_case                        Case to run                   */
+/*    size                                  Message size in bytes         */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    [nx_crypto_init]                      Initialize the TLS PRF        */
+/*    [nx_crypto_operation]                 Run the operation             */
+/*    _nx_crypto_benchmark_hkdf             Run HKDF extract and expand   */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    main                                  Run the benchmark             */
+/*                                                                        */
+/**************************************************************************/
+static UINT _nx_crypto_benchmark_run(const NX_CRYPTO_BENCHMARK_CASE *benchmark_case, UINT size)
+{
+NX_CRYPTO_METHOD         *method = benchmark_case -> nx_crypto_benchmark_case_method;
+UINT                      key_bits = benchmark_case -> nx_crypto_benchmark_case_key_bits;
+VOID                     *handler = _nx_crypto_benchmark_handler;
+VOID                     *metadata = _nx_crypto_benchmark_metadata;
+ULONG                     metadata_size = sizeof(_nx_crypto_benchmark_metadata);
+NX_CRYPTO_EXTENDED_OUTPUT extended_output;
+UINT                      status;
+
+    switch (benchmark_case -> nx_crypto_benchmark_case_kind)
+    {
+    case NX_CRYPTO_BENCHMARK_CIPHER:
+        return(method -> nx_crypto_operation(NX_CRYPTO_ENCRYPT, handler, method,
+                                             _nx_crypto_benchmark_key, key_bits,
+                                             _nx_crypto_benchmark_input, size, _nx_crypto_benchmark_iv,
+                                             _nx_crypto_benchmark_output, size,
+                                             metadata, metadata_size, NX_CRYPTO_NULL, NX_CRYPTO_NULL));
+
+    case NX_CRYPTO_BENCHMARK_AEAD:
+        status = method -> nx_crypto_operation(NX_CRYPTO_ENCRYPT_INITIALIZE, handler, method,
+                                               _nx_crypto_benchmark_key, key_bits,
+                                               _nx_crypto_benchmark_aad, sizeof(_nx_crypto_benchmark_aad),
+                                               _nx_crypto_benchmark_iv, NX_CRYPTO_NULL, size,
+                                               metadata, metadata_size, NX_CRYPTO_NULL, NX_CRYPTO_NULL);
+        if (status == NX_CRYPTO_SUCCESS)
+        {
+            status = method -> nx_crypto_operation(NX_CRYPTO_ENCRYPT_UPDATE, handler, method,
+                                                   _nx_crypto_benchmark_key, key_bits,
+                                                   _nx_crypto_benchmark_input, size, NX_CRYPTO_NULL,
+                                                   _nx_crypto_benchmark_output, size,
+                                                   metadata, metadata_size, NX_CRYPTO_NULL, NX_CRYPTO_NULL);
+        }
+        if (status == NX_CRYPTO_SUCCESS)
+        {
+            status = method -> nx_crypto_operation(NX_CRYPTO_ENCRYPT_CALCULATE, handler, method,
+                                                   _nx_crypto_benchmark_key, key_bits,
+                                                   NX_CRYPTO_NULL, 0, NX_CRYPTO_NULL,
+                                                   &_nx_crypto_benchmark_output[size],
+                                                   method -> nx_crypto_ICV_size_in_bits >> 3,
+                                                   metadata, metadata_size, NX_CRYPTO_NULL, NX_CRYPTO_NULL);
+        }
+        return(status);
+
+    case NX_CRYPTO_BENCHMARK_HASH:
+    case NX_CRYPTO_BENCHMARK_HMAC:
+        return(method -> nx_crypto_operation(NX_CRYPTO_AUTHENTICATE, handler, method,
+                                             _nx_crypto_benchmark_key, key_bits,
+                                             _nx_crypto_benchmark_input, size, NX_CRYPTO_NULL,
+                                             _nx_crypto_benchmark_output, 64,
+                                             metadata, metadata_size, NX_CRYPTO_NULL, NX_CRYPTO_NULL));
+
+    case NX_CRYPTO_BENCHMARK_HMAC_CACHED:
+        return(method -> nx_crypto_operation(NX_CRYPTO_HMAC_CACHED_AUTHENTICATE, handler, method,
+                                             NX_CRYPTO_NULL, 0,
+                                             _nx_crypto_benchmark_input, size, NX_CRYPTO_NULL,
+                                             _nx_crypto_benchmark_output, 64,
+                                             metadata, metadata_size, NX_CRYPTO_NULL, NX_CRYPTO_NULL));
+
+    case NX_CRYPTO_BENCHMARK_PRF:
+        status = method -> nx_crypto_init(method, _nx_crypto_benchmark_secret, sizeof(_nx_crypto_benchmark_secret),
+                                          &handler, metadata, metadata_size);
+        if (status == NX_CRYPTO_SUCCESS)
+        {
+
+            /* Label "key expansion" followed by the 64-byte server and client randoms. */
+            status = method -> nx_crypto_operation(NX_CRYPTO_PRF, handler, method,
+                                                   _nx_crypto_benchmark_label, 13,
+                                                   &_nx_crypto_benchmark_label[13], 64, NX_CRYPTO_NULL,
+                                                   _nx_crypto_benchmark_output, size,
+                                                   metadata, metadata_size, NX_CRYPTO_NULL, NX_CRYPTO_NULL);
+        }
+        return(status);
+
+    case NX_CRYPTO_BENCHMARK_HKDF:
+        return(_nx_crypto_benchmark_hkdf(benchmark_case -> nx_crypto_benchmark_case_auxiliary_method, size));
+
+    case NX_CRYPTO_BENCHMARK_DRBG:
+
+        /* The global DRBG, which TLS uses for randoms, nonces and keys. */
+        return(_nx_crypto_drbg(size << 3, _nx_crypto_benchmark_output));
+
+    case NX_CRYPTO_BENCHMARK_ECDSA_SIGN:
+        extended_output.nx_crypto_extended_output_data = _nx_crypto_benchmark_output;
+        extended_output.nx_crypto_extended_output_length_in_byte = sizeof(_nx_crypto_benchmark_output);
+        return(method -> nx_crypto_operation(NX_CRYPTO_SIGNATURE_GENERATE, handler, method,
+                                             _nx_crypto_benchmark_private_key,
+                                             _nx_crypto_benchmark_private_key_size << 3,
+                                             _nx_crypto_benchmark_input, _nx_crypto_benchmark_message_length,
+                                             NX_CRYPTO_NULL, (UCHAR *)&extended_output, sizeof(extended_output),
+                                             metadata, metadata_size, NX_CRYPTO_NULL, NX_CRYPTO_NULL));
+
+    case NX_CRYPTO_BENCHMARK_ECDSA_VERIFY:
+        return(method -> nx_crypto_operation(NX_CRYPTO_SIGNATURE_VERIFY, handler, method,
+                                             _nx_crypto_benchmark_public_key,
+                                             _nx_crypto_benchmark_public_key_length << 3,
+                                             _nx_crypto_benchmark_input, _nx_crypto_benchmark_message_length,
+                                             NX_CRYPTO_NULL, _nx_crypto_benchmark_signature,
+                                             _nx_crypto_benchmark_signature_length,
+                                             metadata, metadata_size, NX_CRYPTO_NULL, NX_CRYPTO_NULL));
+
+    case NX_CRYPTO_BENCHMARK_ECDH_SETUP:
+    case NX_CRYPTO_BENCHMARK_ECDH_CALCULATE:
+        extended_output.nx_crypto_extended_output_data = _nx_crypto_benchmark_output;
+        extended_output.nx_crypto_extended_output_length_in_byte = sizeof(_nx_crypto_benchmark_output);
+        if (benchmark_case -> nx_crypto_benchmark_case_kind == NX_CRYPTO_BENCHMARK_ECDH_SETUP)
+        {
+            return(method -> nx_crypto_operation(NX_CRYPTO_DH_SETUP, handler, method,
+                                                 NX_CRYPTO_NULL, 0, NX_CRYPTO_NULL, 0, NX_CRYPTO_NULL,
+                                                 (UCHAR *)&extended_output, sizeof(extended_output),
+                                                 metadata, metadata_size, NX_CRYPTO_NULL, NX_CRYPTO_NULL));
+        }
+        return(method -> nx_crypto_operation(NX_CRYPTO_DH_CALCULATE, handler, method,
+                                             NX_CRYPTO_NULL, 0,
+                                             _nx_crypto_benchmark_public_key, _nx_crypto_benchmark_public_key_length,
+                                             NX_CRYPTO_NULL, (UCHAR *)&extended_output, sizeof(extended_output),
+                                             metadata, metadata_size, NX_CRYPTO_NULL, NX_CRYPTO_NULL));
+
+    case NX_CRYPTO_BENCHMARK_RSA_PUBLIC:
+        return(method -> nx_crypto_operation(NX_CRYPTO_ENCRYPT, handler, method,
+                                             (UCHAR *)_nx_crypto_benchmark_rsa_public_exponent,
+                                             sizeof(_nx_crypto_benchmark_rsa_public_exponent) << 3,
+                                             _nx_crypto_benchmark_input, sizeof(_nx_crypto_benchmark_rsa_modulus),
+                                             NX_CRYPTO_NULL, _nx_crypto_benchmark_output,
+                                             sizeof(_nx_crypto_benchmark_rsa_modulus),
+                                             metadata, metadata_size, NX_CRYPTO_NULL, NX_CRYPTO_NULL));
+
+    case NX_CRYPTO_BENCHMARK_RSA_PRIVATE:
+        return(method -> nx_crypto_operation(NX_CRYPTO_ENCRYPT, handler, method,
+                                             (UCHAR *)_nx_crypto_benchmark_rsa_private_exponent,
+                                             sizeof(_nx_crypto_benchmark_rsa_private_exponent) << 3,
+                                             _nx_crypto_benchmark_input, sizeof(_nx_crypto_benchmark_rsa_modulus),
+                                             NX_CRYPTO_NULL, _nx_crypto_benchmark_output,
+                                             sizeof(_nx_crypto_benchmark_rsa_modulus),
+                                             metadata, metadata_size, NX_CRYPTO_NULL, NX_CRYPTO_NULL));
+
+    default:
+        return(NX_CRYPTO_NOT_SUCCESSFUL);
+    }
+}
+
+
+/* Monotonic time in seconds. */
+static double _nx_crypto_benchmark_time(VOID)
+{
+struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return((double)now.tv_sec + (double)now.tv_nsec * 1e-9);
+}
+
+/* qsort comparison of two doubles. */
+static int _nx_crypto_benchmark_compare(const void *a, const void *b)
+{
+double x = *(const double *)a;
+double y = *(const double *)b;
+
+    return((x > y) - (x < y));
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    main                                                PORTABLE C      */
+/*                                                           6.1          */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function parses the options, then sets up, warms up and        */
+/*    measures every selected case at every size and prints the results. */
+/*    The number of runs in a repetition is chosen from the warmup so a   */
+/*    repetition takes about the requested time.                          */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    argc                                  Number of arguments           */
+/*    argv                                  Arguments                     */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                0 if every case succeeded     */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_crypto_benchmark_setup            Set up a case                 */
+/*    _nx_crypto_benchmark_run              Run a case once               */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Host                                                                */
+/*                                                                        */
+/**************************************************************************/
+int main(int argc, char **argv)
+{
+const NX_CRYPTO_BENCHMARK_CASE *benchmark_case;
+UINT                            sizes[NX_CRYPTO_BENCHMARK_MAX_SIZES] = {16, 64, 256, 1024, 8192, 16384};
+UINT                            size_count = 6;
+UINT                            bulk;
+UINT                            size;
+UINT                            repetitions = 5;
+double                          repetition_time = 0.1;
+double                          warmup_time = 0.05;
+double                          mhz = 0.0;
+INT                             json = 0;
+const CHAR                     *filter = NX_CRYPTO_NULL;
+double                          seconds[NX_CRYPTO_BENCHMARK_MAX_REPETITIONS];
+double                          cycles[NX_CRYPTO_BENCHMARK_MAX_REPETITIONS];
+double                          start;
+double                          elapsed;
+double                          per_op;
+double                          cycles_per_op;
+unsigned long long              runs;
+unsigned long long              iterations;
+unsigned long long              i;
+#ifdef NX_CRYPTO_BENCHMARK_CYCLES
+unsigned long long              start_cycles;
+#endif
+INT                             first = 1;
+INT                             arg;
+UINT                            c;
+UINT                            r;
+UINT                            s;
+UINT                            status;
+CHAR                           *next;
+
+    for (arg = 1; arg < argc; arg++)
+    {
+        if ((strcmp(argv[arg], "-j") == 0))
+        {
+            json = 1;
+        }
+        else if ((strcmp(argv[arg], "-r") == 0) && (arg + 1 < argc))
+        {
+            repetitions = (UINT)atoi(argv[++arg]);
+        }
+        else if ((strcmp(argv[arg], "-t") == 0) && (arg + 1 < argc))
+        {
+            repetition_time = atof(argv[++arg]) / 1000.0;
+        }
+        else if ((strcmp(argv[arg], "-w") == 0) && (arg + 1 < argc))
+        {
+            warmup_time = atof(argv[++arg]) / 1000.0;
+        }
+        else if ((strcmp(argv[arg], "-m") == 0) && (arg + 1 < argc))
+        {
+            mhz = atof(argv[++arg]);
+        }
+        else if ((strcmp(argv[arg], "-s") == 0) && (arg + 1 < argc))
+        {
+            next = argv[++arg];
+            for (size_count = 0; (size_count < NX_CRYPTO_BENCHMARK_MAX_SIZES) && *next; size_count++)
+            {
+                sizes[size_count] = (UINT)strtoul(next, &next, 10);
+                if ((sizes[size_count] == 0) || (sizes[size_count] > NX_CRYPTO_BENCHMARK_MAX_SIZE))
+                {
+                    fprintf(stderr, "Sizes must be between 1 and %u.\n", NX_CRYPTO_BENCHMARK_MAX_SIZE);
+                    return(1);
+                }
+                if (*next == ',')
+                {
+                    next++;
+                }
+            }
+        }
+        else if ((argv[arg][0] != '-') && (filter == NX_CRYPTO_NULL))
+        {
+            filter = argv[arg];
+        }
+        else
+        {
+            fprintf(stderr, "Usage: %s [-j] [-r repetitions] [-t milliseconds] [-w milliseconds] "
+                            "[-m MHz] [-s size[,size...]] [filter]\n", argv[0]);
+            return(1);
+        }
+    }
+
+    if ((repetitions == 0) || (repetitions > NX_CRYPTO_BENCHMARK_MAX_REPETITIONS) || (size_count == 0))
+    {
+        fprintf(stderr, "Repetitions must be between 1 and %u.\n", NX_CRYPTO_BENCHMARK_MAX_REPETITIONS);
+        return(1);
+    }
+
+#ifndef NX_CRYPTO_BENCHMARK_CYCLES
+    if (mhz == 0.0)
+    {
+        fprintf(stderr, "No cycle counter on this host, give the clock with -m to report cycles.\n");
+    }
+#endif
+
+    /* Fixed input so results of different builds are comparable. */
+    for (i = 0; i < sizeof(_nx_crypto_benchmark_input); i++)
+    {
+        _nx_crypto_benchmark_input[i] = (UCHAR)(i * 7 + 1);
+    }
+    srand(1);
+
+    if (json)
+    {
+        printf("[\n");
+    }
+    else
+    {
+        printf("name,operation,size,repetitions,runs,ns_per_op,cycles_per_op,cycles_per_byte,ops_per_second,mbytes_per_second\n");
+    }
+
+    for (c = 0; c < sizeof(_nx_crypto_benchmark_cases) / sizeof(_nx_crypto_benchmark_cases[0]); c++)
+    {
+        benchmark_case = &_nx_crypto_benchmark_cases[c];
+        if (filter && (strstr(benchmark_case -> nx_crypto_benchmark_case_name, filter) == NX_CRYPTO_NULL))
+        {
+            continue;
+        }
+
+        /* Ciphers, hashes, key derivations and the DRBG run at every size; signatures and key exchanges once. */
+        bulk = (benchmark_case -> nx_crypto_benchmark_case_kind <= NX_CRYPTO_BENCHMARK_DRBG);
+
+        for (s = 0; s < (bulk ? size_count : 1); s++)
+        {
+            size = bulk ? sizes[s] : 0;
+
+            /* The TLS PRF and HKDF are used for key blocks, which are short. */
+            if (((benchmark_case -> nx_crypto_benchmark_case_kind == NX_CRYPTO_BENCHMARK_PRF) ||
+                 (benchmark_case -> nx_crypto_benchmark_case_kind == NX_CRYPTO_BENCHMARK_HKDF)) &&
+                (size > 256))
+            {
+                continue;
+            }
+
+            status = _nx_crypto_benchmark_setup(benchmark_case);
+
+            /* Warm up, and time it to size the repetitions. */
+            runs = 0;
+            start = _nx_crypto_benchmark_time();
+            do
+            {
+                if (status == NX_CRYPTO_SUCCESS)
+                {
+                    status = _nx_crypto_benchmark_run(benchmark_case, size);
+                }
+                runs++;
+                elapsed = _nx_crypto_benchmark_time() - start;
+            } while ((status == NX_CRYPTO_SUCCESS) && (elapsed < warmup_time));
+
+            if (status != NX_CRYPTO_SUCCESS)
+            {
+                fprintf(stderr, "%s %s %u failed: 0x%x\n", benchmark_case -> nx_crypto_benchmark_case_name,
+                        benchmark_case -> nx_crypto_benchmark_case_operation, size, status);
+                return(1);
+            }
+
+            iterations = (unsigned long long)(repetition_time * (double)runs / elapsed);
+            if (iterations == 0)
+            {
+                iterations = 1;
+            }
+
+            for (r = 0; r < repetitions; r++)
+            {
+                start = _nx_crypto_benchmark_time();
+#ifdef NX_CRYPTO_BENCHMARK_CYCLES
+                start_cycles = NX_CRYPTO_BENCHMARK_CYCLES();
+#endif
+                for (i = 0; i < iterations; i++)
+                {
+                    status |= _nx_crypto_benchmark_run(benchmark_case, size);
+                }
+#ifdef NX_CRYPTO_BENCHMARK_CYCLES
+                cycles[r] = (double)(NX_CRYPTO_BENCHMARK_CYCLES() - start_cycles) / (double)iterations;
+#else
+                cycles[r] = 0.0;
+#endif
+                seconds[r] = (_nx_crypto_benchmark_time() - start) / (double)iterations;
+                if (mhz != 0.0)
+                {
+                    cycles[r] = seconds[r] * mhz * 1e6;
+                }
+            }
+
+            if (status != NX_CRYPTO_SUCCESS)
+            {
+                fprintf(stderr, "%s %s %u failed: 0x%x\n", benchmark_case -> nx_crypto_benchmark_case_name,
+                        benchmark_case -> nx_crypto_benchmark_case_operation, size, status);
+                return(1);
+            }
+
+            if (benchmark_case -> nx_crypto_benchmark_case_method -> nx_crypto_cleanup)
+            {
+                benchmark_case -> nx_crypto_benchmark_case_method -> nx_crypto_cleanup(_nx_crypto_benchmark_metadata);
+            }
+
+            /* Report the median repetition. */
+            qsort(seconds, repetitions, sizeof(double), _nx_crypto_benchmark_compare);
+            qsort(cycles, repetitions, sizeof(double), _nx_crypto_benchmark_compare);
+            per_op = seconds[repetitions / 2];
+            cycles_per_op = cycles[repetitions / 2];
+
+            if (json)
+            {
+                printf("%s  {\"name\": \"%s\", \"operation\": \"%s\", \"size\": %u, \"repetitions\": %u, "
+                       "\"runs\": %llu, \"ns_per_op\": %.1f, \"cycles_per_op\": %.1f, ",
+                       first ? "" : ",\n", benchmark_case -> nx_crypto_benchmark_case_name,
+                       benchmark_case -> nx_crypto_benchmark_case_operation, size, repetitions,
+                       iterations, per_op * 1e9, cycles_per_op);
+                if (size)
+                {
+                    printf("\"cycles_per_byte\": %.2f, \"ops_per_second\": %.1f, \"mbytes_per_second\": %.2f}",
+                           cycles_per_op / size, 1.0 / per_op, (double)size / per_op / 1e6);
+                }
+                else
+                {
+                    printf("\"cycles_per_byte\": null, \"ops_per_second\": %.1f, \"mbytes_per_second\": null}",
+                           1.0 / per_op);
+                }
+            }
+            else
+            {
+                printf("%s,%s,%u,%u,%llu,%.1f,%.1f,", benchmark_case -> nx_crypto_benchmark_case_name,
+                       benchmark_case -> nx_crypto_benchmark_case_operation, size, repetitions,
+                       iterations, per_op * 1e9, cycles_per_op);
+                if (size)
+                {
+                    printf("%.2f,%.1f,%.2f\n", cycles_per_op / size, 1.0 / per_op, (double)size / per_op / 1e6);
+                }
+                else
+                {
+
+                    /* Per-byte figures do not apply to signatures and key exchanges. */
+                    printf(",%.1f,\n", 1.0 / per_op);
+                }
+            }
+            fflush(stdout);
+            first = 0;
+        }
+    }
+
+    if (json)
+    {
+        printf("\n]\n");
+    }
+
+    return(0);
+}
@@ -0,0 +1,475 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Crypto Component                                                 */
+/**                                                                       */
+/**   Elliptical Curve Cryptography                                       */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+/**************************************************************************/
+/*                                                                        */
+/*  PROGRAM                                                RELEASE        */
+/*                                                                        */
+/*    nx_crypto_ec_fixed_points_generator.c               PORTABLE C      */
+/*                                                           6.1          */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This file is a host program, not part of the crypto library. It     */
+/*    generates the fixed points of a NIST prime curve with a chosen      */
+/*    comb width and prints them as the source of the matching            */
+/*    nx_crypto_ec_<curve>_fixed_points.c, so the shipped table can be    */
+/*    replaced by a wider (faster, larger) or narrower (slower,           */
+/*    smaller) one. The generated table is checked against the fixed      */
+/*    points currently linked into the library and against the            */
+/*    multiplication without fixed points, for random and edge-case       */
+/*    factors, before anything is printed.                                */
+/*                                                                        */
+/*    Build it on the host from this directory, for example:              */
+/*                                                                        */
+/*      gcc -DNX_CRYPTO_STANDALONE_ENABLE -I../inc                        */
+/*          -I../ports/linux/gnu/inc                                      */
+/*          nx_crypto_ec_fixed_points_generator.c                         */
+/*          ../src/nx_crypto_ec.c ../src/nx_crypto_ec_secp*.c             */
+/*          ../src/nx_crypto_huge_number*.c ../src/nx_crypto_initialize.c */
+/*          -o nx_crypto_ec_fixed_points_generator                        */
+/*                                                                        */
+/*    and run it as                                                       */
+/*                                                                        */
+/*      nx_crypto_ec_fixed_points_generator <curve> <width> [bits]        */
+/*          > nx_crypto_ec_<curve>_fixed_points.c                         */
+/*                                                                        */
+/*    where curve is secp192r1, secp224r1, secp256r1, secp384r1 or        */
+/*    secp521r1. bits defaults to the size of the curve and must not      */
+/*    be smaller than the order of the curve. See                         */
+/*    NX_CRYPTO_EC_FIXED_POINTS in nx_crypto_ec.h for the size and        */
+/*    cost of each width.                                                 */
+/*                                                                        */
+/*                                                                        */
+/**************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <string.h>
+#include "nx_crypto_ec.h"
+
+/* Number of factors checked for each generated table. */
+#ifndef NX_CRYPTO_EC_FIXED_POINTS_GENERATOR_VERIFY_COUNT
+#define NX_CRYPTO_EC_FIXED_POINTS_GENERATOR_VERIFY_COUNT 1000
+#endif
+
+/* Scratch buffer, in words. It holds the generated fixed points followed by
+   the scratch of each multiplication; the widest table of secp521r1 with a
+   width of 8 needs about 120 KB. */
+#define NX_CRYPTO_EC_FIXED_POINTS_GENERATOR_SCRATCH_SIZE (1 << 16)
+
+/* Largest curve size in bytes, rounded up to the huge number word size. */
+#define NX_CRYPTO_EC_FIXED_POINTS_GENERATOR_POINT_SIZE   68
+
+static HN_UBASE _nx_crypto_ec_fixed_points_generator_scratch[NX_CRYPTO_EC_FIXED_POINTS_GENERATOR_SCRATCH_SIZE];
+
+static const struct
+{
+    const CHAR *name;
+    UINT        id;
+} _nx_crypto_ec_fixed_points_generator_curves[] =
+{
+    {"secp192r1", NX_CRYPTO_EC_SECP192R1},
+    {"secp224r1", NX_CRYPTO_EC_SECP224R1},
+    {"secp256r1", NX_CRYPTO_EC_SECP256R1},
+    {"secp384r1", NX_CRYPTO_EC_SECP384R1},
+    {"secp521r1", NX_CRYPTO_EC_SECP521R1},
+};
+
+/* Head of the generated file, up to the fixed points. */
+static const CHAR *_nx_crypto_ec_fixed_points_generator_header[] =
+{
+    "/**************************************************************************/",
+    "/*                                                                        */",
+    "/*       Copyright (c) Microsoft Corporation. All rights reserved.        */",
+    "/*                                                                        */",
+    "/*       This software is licensed under the Microsoft Software License   */",
+    "/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */",
+    "/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */",
+    "/*       and in the root directory of this software.                      */",
+    "/*                                                                        */",
+    "/**************************************************************************/",
+    "",
+    "",
+    "/**************************************************************************/",
+    "/**************************************************************************/",
+    "/**                                                                       */",
+    "/** NetX Crypto Component                                                 */",
+    "/**                                                                       */",
+    "/**   Elliptical Curve Cryptography                                       */",
+    "/**                                                                       */",
+    "/**************************************************************************/",
+    "/**************************************************************************/",
+    "",
+    "#include \"nx_crypto_ec.h\"",
+    NX_CRYPTO_NULL
+};
+
+static INT  _nx_crypto_ec_fixed_points_generator_print(const CHAR *format, ...);
+static VOID _nx_crypto_ec_fixed_points_generator_factor(NX_CRYPTO_EC *curve, UINT index,
+                                                        NX_CRYPTO_HUGE_NUMBER *d);
+static UINT _nx_crypto_ec_fixed_points_generator_verify(NX_CRYPTO_EC *curve,
+                                                        NX_CRYPTO_EC *generated_curve,
+                                                        HN_UBASE *scratch);
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_ec_fixed_points_generator_print          PORTABLE C      */
+/*                                                           6.1          */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function prints the generated source to the standard output.   */
+/*    It is the output callback of _nx_crypto_ec_fixed_output.            */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    format                                Format string                 */
+/*    ...                                   Arguments of format           */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    count                                 Number of characters printed  */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_crypto_ec_fixed_output            Output the fixed points       */
+/*    main                                  Generate fixed points         */
+/*                                                                        */
+/*                                                                        */
+/**************************************************************************/
+static INT _nx_crypto_ec_fixed_points_generator_print(const CHAR *format, ...)
+{
+va_list args;
+INT     count;
+
+    va_start(args, format);
+    count = vprintf(format, args);
+    va_end(args);
+
+    return(count);
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_ec_fixed_points_generator_factor         PORTABLE C      */
+/*                                                           6.1          */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function builds the factor used by one verification step.      */
+/*    Small factors, factors just below the order and powers of two are   */
+/*    mixed with random factors, so that empty, full and single columns   */
+/*    of the comb are all exercised.                                      */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    curve                                 Pointer to curve              */
+/*    index                                 Index of verification step    */
+/*    d                                     Factor d                      */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    NX_CRYPTO_HUGE_NUMBER_COPY            Copy huge number              */
+/*    NX_CRYPTO_HUGE_NUMBER_SET_DIGIT       Set value of huge number      */
+/*    _nx_crypto_huge_number_is_zero        Check if number is zero or not*/
+/*    _nx_crypto_huge_number_modulus        Perform a modulus operation   */
+/*    _nx_crypto_huge_number_setup          Setup huge number             */
+/*    _nx_crypto_huge_number_subtract_digit_unsigned                      */
+/*                                          Calculate subtraction for     */
+/*                                            unsigned huge numbers       */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_crypto_ec_fixed_points_generator_verify                         */
+/*                                          Verify generated fixed points */
+/*                                                                        */
+/*                                                                        */
+/**************************************************************************/
+static VOID _nx_crypto_ec_fixed_points_generator_factor(NX_CRYPTO_EC *curve, UINT index,
+                                                        NX_CRYPTO_HUGE_NUMBER *d)
+{
+UCHAR buffer[NX_CRYPTO_EC_FIXED_POINTS_GENERATOR_POINT_SIZE];
+UINT  size;
+UINT  bit;
+UINT  i;
+
+    size = curve -> nx_crypto_ec_n.nx_crypto_huge_number_size << HN_SIZE_SHIFT;
+    NX_CRYPTO_MEMSET(buffer, 0, size);
+
+    switch (index & 3)
+    {
+    case 0:
+
+        /* Small factors, which leave most columns empty. */
+        buffer[size - 1] = (UCHAR)((index >> 2) + 1);
+        _nx_crypto_huge_number_setup(d, buffer, size);
+        break;
+
+    case 1:
+
+        /* Factors just below the order, which fill every column. */
+        NX_CRYPTO_HUGE_NUMBER_COPY(d, &curve -> nx_crypto_ec_n);
+        _nx_crypto_huge_number_subtract_digit_unsigned(d, (HN_UBASE)((index >> 2) + 1));
+        break;
+
+    case 2:
+
+        /* Powers of two, which select a single column entry. */
+        bit = ((index >> 2) * 7) % (curve -> nx_crypto_ec_bits - 1);
+        buffer[size - 1 - (bit >> 3)] = (UCHAR)(1 << (bit & 7));
+        _nx_crypto_huge_number_setup(d, buffer, size);
+        break;
+
+    default:
+        for (i = 0; i < size; i++)
+        {
+            buffer[i] = (UCHAR)rand();
+        }
+        _nx_crypto_huge_number_setup(d, buffer, size);
+        _nx_crypto_huge_number_modulus(d, &curve -> nx_crypto_ec_n);
+        break;
+    }
+
+    if (_nx_crypto_huge_number_is_zero(d))
+    {
+        NX_CRYPTO_HUGE_NUMBER_SET_DIGIT(d, 1);
+    }
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_ec_fixed_points_generator_verify         PORTABLE C      */
+/*                                                           6.1          */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function multiplies the base point by a set of factors with    */
+/*    the generated fixed points, with the fixed points currently linked  */
+/*    into the library and without fixed points, and counts the factors   */
+/*    for which the results differ.                                       */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    curve                                 Pointer to curve              */
+/*    generated_curve                       Curve with generated points   */
+/*    scratch                               Pointer to scratch buffer     */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    errors                                Number of mismatched factors  */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    NX_CRYPTO_EC_POINT_INITIALIZE         Initialize EC point           */
+/*    NX_CRYPTO_HUGE_NUMBER_INITIALIZE      Initialize the buffer of      */
+/*                                            huge number                 */
+/*    [nx_crypto_ec_multiple]               Perform multiplication for EC */
+/*    _nx_crypto_ec_fixed_points_generator_factor                         */
+/*                                          Build factor of one step      */
+/*    _nx_crypto_huge_number_compare        Compare two huge numbers      */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    main                                  Generate fixed points         */
+/*                                                                        */
+/*                                                                        */
+/**************************************************************************/
+static UINT _nx_crypto_ec_fixed_points_generator_verify(NX_CRYPTO_EC *curve,
+                                                        NX_CRYPTO_EC *generated_curve,
+                                                        HN_UBASE *scratch)
+{
+NX_CRYPTO_EC          generic_curve;
+NX_CRYPTO_HUGE_NUMBER d;
+NX_CRYPTO_EC_POINT    expected;
+NX_CRYPTO_EC_POINT    current;
+NX_CRYPTO_EC_POINT    generated;
+HN_UBASE              buffer[7 * (NX_CRYPTO_EC_FIXED_POINTS_GENERATOR_POINT_SIZE >> HN_SIZE_SHIFT)];
+HN_UBASE             *buffer_ptr = buffer;
+UINT                  buffer_size;
+UINT                  errors = 0;
+UINT                  i;
+
+    /* Same curve without fixed points, so that the width-w NAF is used. */
+    NX_CRYPTO_MEMCPY(&generic_curve, curve, sizeof(NX_CRYPTO_EC));
+    generic_curve.nx_crypto_ec_fixed_points = NX_CRYPTO_NULL;
+
+    buffer_size = curve -> nx_crypto_ec_g.nx_crypto_ec_point_x.nx_crypto_huge_buffer_size;
+    NX_CRYPTO_HUGE_NUMBER_INITIALIZE(&d, buffer_ptr, NX_CRYPTO_EC_FIXED_POINTS_GENERATOR_POINT_SIZE);
+    NX_CRYPTO_EC_POINT_INITIALIZE(&expected, NX_CRYPTO_EC_POINT_AFFINE, buffer_ptr, buffer_size);
+    NX_CRYPTO_EC_POINT_INITIALIZE(&current, NX_CRYPTO_EC_POINT_AFFINE, buffer_ptr, buffer_size);
+    NX_CRYPTO_EC_POINT_INITIALIZE(&generated, NX_CRYPTO_EC_POINT_AFFINE, buffer_ptr, buffer_size);
+
+    for (i = 0; i < NX_CRYPTO_EC_FIXED_POINTS_GENERATOR_VERIFY_COUNT; i++)
+    {
+        _nx_crypto_ec_fixed_points_generator_factor(curve, i, &d);
+
+        generic_curve.nx_crypto_ec_multiple(&generic_curve, &generic_curve.nx_crypto_ec_g,
+                                            &d, &expected, scratch);
+        curve -> nx_crypto_ec_multiple(curve, &curve -> nx_crypto_ec_g, &d, &current, scratch);
+        generated_curve -> nx_crypto_ec_multiple(generated_curve, &generated_curve -> nx_crypto_ec_g,
+                                                 &d, &generated, scratch);
+
+        if ((_nx_crypto_huge_number_compare(&current.nx_crypto_ec_point_x,
+                                            &generated.nx_crypto_ec_point_x) != NX_CRYPTO_HUGE_NUMBER_EQUAL) ||
+            (_nx_crypto_huge_number_compare(&current.nx_crypto_ec_point_y,
+                                            &generated.nx_crypto_ec_point_y) != NX_CRYPTO_HUGE_NUMBER_EQUAL) ||
+            (_nx_crypto_huge_number_compare(&expected.nx_crypto_ec_point_x,
+                                            &generated.nx_crypto_ec_point_x) != NX_CRYPTO_HUGE_NUMBER_EQUAL) ||
+            (_nx_crypto_huge_number_compare(&expected.nx_crypto_ec_point_y,
+                                            &generated.nx_crypto_ec_point_y) != NX_CRYPTO_HUGE_NUMBER_EQUAL))
+        {
+            errors++;
+        }
+    }
+
+    return(errors);
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    main                                                PORTABLE C      */
+/*                                                           6.1          */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function parses the curve, width and bits, precomputes the     */
+/*    fixed points on a copy of the curve, verifies them and prints them  */
+/*    as C source.                                                        */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    argc                                  Number of arguments           */
+/*    argv                                  Curve, width and bits         */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Zero on success               */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_crypto_ec_fixed_output            Output the fixed points       */
+/*    _nx_crypto_ec_fixed_points_generator_verify                         */
+/*                                          Verify generated fixed points */
+/*    _nx_crypto_ec_get_named_curve         Get named curve by ID         */
+/*    _nx_crypto_ec_precomputation          Precompute fixed points       */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Host shell                                                          */
+/*                                                                        */
+/*                                                                        */
+/**************************************************************************/
+int main(int argc, char **argv)
+{
+NX_CRYPTO_EC *curve = NX_CRYPTO_NULL;
+NX_CRYPTO_EC  generated_curve;
+HN_UBASE     *scratch;
+UINT          window_width;
+UINT          bits;
+UINT          order_bits;
+HN_UBASE      top;
+UINT          errors;
+UINT          i;
+
+    if ((argc != 3) && (argc != 4))
+    {
+        fprintf(stderr, "Usage: %s <curve> <width> [bits] > nx_crypto_ec_<curve>_fixed_points.c\n", argv[0]);
+        return(1);
+    }
+
+    for (i = 0; i < sizeof(_nx_crypto_ec_fixed_points_generator_curves) /
+                    sizeof(_nx_crypto_ec_fixed_points_generator_curves[0]); i++)
+    {
+        if (strcmp(argv[1], _nx_crypto_ec_fixed_points_generator_curves[i].name) == 0)
+        {
+            _nx_crypto_ec_get_named_curve(&curve, _nx_crypto_ec_fixed_points_generator_curves[i].id);
+            break;
+        }
+    }
+    if (curve == NX_CRYPTO_NULL)
+    {
+        fprintf(stderr, "Unknown curve %s.\n", argv[1]);
+        return(1);
+    }
+
+    /* Bits of the order, which is the largest factor the fixed points must cover. */
+    top = curve -> nx_crypto_ec_n.nx_crypto_huge_number_data[curve -> nx_crypto_ec_n.nx_crypto_huge_number_size - 1];
+    order_bits = (curve -> nx_crypto_ec_n.nx_crypto_huge_number_size - 1) * NX_CRYPTO_HUGE_NUMBER_BITS;
+    while (top)
+    {
+        order_bits++;
+        top >>= 1;
+    }
+
+    window_width = (UINT)atoi(argv[2]);
+    bits = (argc == 4) ? (UINT)atoi(argv[3]) : curve -> nx_crypto_ec_bits;
+
+    /* The first array holds 2 ^ w - 2 points and the column index is kept in a ULONG. */
+    if ((window_width < 2) || (window_width > 8))
+    {
+        fprintf(stderr, "Width must be between 2 and 8.\n");
+        return(1);
+    }
+    if (bits < order_bits)
+    {
+        fprintf(stderr, "Bits must be at least %u for %s.\n", order_bits, argv[1]);
+        return(1);
+    }
+
+    /* Precompute on a copy of the curve that has no fixed points yet. */
+    NX_CRYPTO_MEMCPY(&generated_curve, curve, sizeof(NX_CRYPTO_EC));
+    generated_curve.nx_crypto_ec_fixed_points = NX_CRYPTO_NULL;
+    scratch = _nx_crypto_ec_fixed_points_generator_scratch;
+    _nx_crypto_ec_precomputation(&generated_curve, window_width, bits, &scratch);
+
+    srand(1);
+    errors = _nx_crypto_ec_fixed_points_generator_verify(curve, &generated_curve, scratch);
+    fprintf(stderr, "%s: width %u, bits %u, %u fixed points, %u of %u factors differ.\n",
+            argv[1], window_width, bits, (2u << window_width) - 3,
+            errors, NX_CRYPTO_EC_FIXED_POINTS_GENERATOR_VERIFY_COUNT);
+    if (errors)
+    {
+        return(1);
+    }
+
+    for (i = 0; _nx_crypto_ec_fixed_points_generator_header[i]; i++)
+    {
+        _nx_crypto_ec_fixed_points_generator_print("%s\n", _nx_crypto_ec_fixed_points_generator_header[i]);
+    }
+    _nx_crypto_ec_fixed_output(&generated_curve, _nx_crypto_ec_fixed_points_generator_print, "    ", "\n");
+    _nx_crypto_ec_fixed_points_generator_print("\n");
+
+    return(0);
+}
@@ -0,0 +1,579 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Crypto Component                                                 */
+/**                                                                       */
+/**   Huge Number Test                                                    */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+/**************************************************************************/
+/*                                                                        */
+/*  PROGRAM                                                RELEASE        */
+/*                                                                        */
+/*    nx_crypto_huge_number_test.c                        PORTABLE C      */
+/*                                                           6.1          */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This file is a host program, not part of the crypto library. It     */
+/*    checks the column-wise _nx_crypto_huge_number_multiply,             */
+/*    _nx_crypto_huge_number_square and _nx_crypto_huge_number_mont on    */
+/*    random operands against the row-wise loops they replaced, which     */
+/*    are kept below as reference copies.                                 */
+/*                                                                        */
+/*    Operands are 1 to 2560 bits long, and their digits are random,      */
+/*    all ones, mostly zero, or zero. Multiply and square results must    */
+/*    be identical to the reference. Montgomery products are compared     */
+/*    with the reference when both inputs are below the modulus. The      */
+/*    old loop could lose a carry when an input was not reduced, so for   */
+/*    those inputs the result is compared with a plain reduction of the   */
+/*    full product instead.                                               */
+/*                                                                        */
+/*    The Makefile in this directory builds it with the default 32-bit    */
+/*    digits, and as nx_crypto_huge_number_test_16 with                   */
+/*    NX_CRYPTO_HUGE_NUMBER_BITS set to 16. Run it as                     */
+/*                                                                        */
+/*      nx_crypto_huge_number_test [-s seed]                              */
+/*                                                                        */
+/*    The program exits with 1 if any check fails.                        */
+/*                                                                        */
+/**************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "nx_crypto_huge_number.h"
+
+#define NX_CRYPTO_HUGE_NUMBER_TEST_ROUNDS       20000
+#define NX_CRYPTO_HUGE_NUMBER_TEST_DIGITS       (2560 / NX_CRYPTO_HUGE_NUMBER_BITS)
+#define NX_CRYPTO_HUGE_NUMBER_TEST_BUFFER       ((NX_CRYPTO_HUGE_NUMBER_TEST_DIGITS << 1) + 2)
+
+/* How the digits of an operand are filled. */
+#define NX_CRYPTO_HUGE_NUMBER_TEST_RANDOM       0
+#define NX_CRYPTO_HUGE_NUMBER_TEST_ONES         1
+#define NX_CRYPTO_HUGE_NUMBER_TEST_SPARSE       2
+#define NX_CRYPTO_HUGE_NUMBER_TEST_ZERO         3
+#define NX_CRYPTO_HUGE_NUMBER_TEST_PATTERNS     4
+
+#define NX_CRYPTO_HUGE_NUMBER_TEST_CHECK(condition) \
+    _nx_crypto_huge_number_test_check((condition), #condition, __LINE__)
+
+static HN_UBASE _nx_crypto_huge_number_test_m[NX_CRYPTO_HUGE_NUMBER_TEST_BUFFER];
+static HN_UBASE _nx_crypto_huge_number_test_x[NX_CRYPTO_HUGE_NUMBER_TEST_BUFFER];
+static HN_UBASE _nx_crypto_huge_number_test_y[NX_CRYPTO_HUGE_NUMBER_TEST_BUFFER];
+static HN_UBASE _nx_crypto_huge_number_test_result[NX_CRYPTO_HUGE_NUMBER_TEST_BUFFER];
+static HN_UBASE _nx_crypto_huge_number_test_expected[NX_CRYPTO_HUGE_NUMBER_TEST_BUFFER];
+static ULONG    _nx_crypto_huge_number_test_random_state;
+static UINT     _nx_crypto_huge_number_test_failures;
+
+static VOID     _nx_crypto_huge_number_test_check(UINT passed, const CHAR *condition, UINT line);
+static ULONG    _nx_crypto_huge_number_test_random(VOID);
+static VOID     _nx_crypto_huge_number_test_fill(NX_CRYPTO_HUGE_NUMBER *number, HN_UBASE *buffer, UINT size,
+                                                 UINT pattern);
+static UINT     _nx_crypto_huge_number_test_equal(NX_CRYPTO_HUGE_NUMBER *a, NX_CRYPTO_HUGE_NUMBER *b);
+static VOID     _nx_crypto_huge_number_test_multiply_rows(NX_CRYPTO_HUGE_NUMBER *left, NX_CRYPTO_HUGE_NUMBER *right,
+                                                          NX_CRYPTO_HUGE_NUMBER *result);
+static VOID     _nx_crypto_huge_number_test_square_rows(NX_CRYPTO_HUGE_NUMBER *value, NX_CRYPTO_HUGE_NUMBER *result);
+static VOID     _nx_crypto_huge_number_test_mont_rows(NX_CRYPTO_HUGE_NUMBER *m, UINT mi, NX_CRYPTO_HUGE_NUMBER *x,
+                                                      NX_CRYPTO_HUGE_NUMBER *y, NX_CRYPTO_HUGE_NUMBER *result);
+static VOID     _nx_crypto_huge_number_test_mont_reduce(NX_CRYPTO_HUGE_NUMBER *m, UINT mi, NX_CRYPTO_HUGE_NUMBER *x,
+                                                        NX_CRYPTO_HUGE_NUMBER *y, NX_CRYPTO_HUGE_NUMBER *result);
+static UINT     _nx_crypto_huge_number_test_multiply(VOID);
+static UINT     _nx_crypto_huge_number_test_square(VOID);
+static UINT     _nx_crypto_huge_number_test_mont(UINT *reduced);
+
+
+static VOID _nx_crypto_huge_number_test_check(UINT passed, const CHAR *condition, UINT line)
+{
+    if (!passed)
+    {
+        printf("  FAILED at line %u: %s\n", line, condition);
+        _nx_crypto_huge_number_test_failures++;
+    }
+}
+
+
+/* xorshift32, so that a failing seed can be run again. */
+static ULONG _nx_crypto_huge_number_test_random(VOID)
+{
+ULONG x = _nx_crypto_huge_number_test_random_state;
+
+    x ^= (x << 13) & 0xFFFFFFFFUL;
+    x ^= x >> 17;
+    x ^= (x << 5) & 0xFFFFFFFFUL;
+    _nx_crypto_huge_number_test_random_state = x;
+    return(x);
+}
+
+
+/* Fill a number of size digits. The top digit is kept non-zero, except for zero itself. */
+static VOID _nx_crypto_huge_number_test_fill(NX_CRYPTO_HUGE_NUMBER *number, HN_UBASE *buffer, UINT size,
+                                             UINT pattern)
+{
+UINT i;
+
+    number -> nx_crypto_huge_number_data = buffer;
+    number -> nx_crypto_huge_number_size = size;
+    number -> nx_crypto_huge_buffer_size = NX_CRYPTO_HUGE_NUMBER_TEST_BUFFER << HN_SIZE_SHIFT;
+    number -> nx_crypto_huge_number_is_negative = NX_CRYPTO_FALSE;
+
+    for (i = 0; i < size; i++)
+    {
+        switch (pattern)
+        {
+        case NX_CRYPTO_HUGE_NUMBER_TEST_ONES:
+            buffer[i] = HN_MASK;
+            break;
+
+        case NX_CRYPTO_HUGE_NUMBER_TEST_SPARSE:
+            buffer[i] = (_nx_crypto_huge_number_test_random() & 7) ?
+                        0 : (HN_UBASE)(_nx_crypto_huge_number_test_random() & HN_MASK);
+            break;
+
+        case NX_CRYPTO_HUGE_NUMBER_TEST_ZERO:
+            buffer[i] = 0;
+            break;
+
+        default:
+            buffer[i] = (HN_UBASE)(_nx_crypto_huge_number_test_random() & HN_MASK);
+            break;
+        }
+    }
+
+    if (pattern == NX_CRYPTO_HUGE_NUMBER_TEST_ZERO)
+    {
+        number -> nx_crypto_huge_number_size = 1;
+    }
+    else if (buffer[size - 1] == 0)
+    {
+        buffer[size - 1] = 1;
+    }
+}
+
+
+static UINT _nx_crypto_huge_number_test_equal(NX_CRYPTO_HUGE_NUMBER *a, NX_CRYPTO_HUGE_NUMBER *b)
+{
+    return((a -> nx_crypto_huge_number_size == b -> nx_crypto_huge_number_size) &&
+           (a -> nx_crypto_huge_number_is_negative == b -> nx_crypto_huge_number_is_negative) &&
+           (memcmp(a -> nx_crypto_huge_number_data, b -> nx_crypto_huge_number_data,
+                   a -> nx_crypto_huge_number_size << HN_SIZE_SHIFT) == 0));
+}
+
+
+/* The row-wise _nx_crypto_huge_number_multiply this test compares against. */
+static VOID _nx_crypto_huge_number_test_multiply_rows(NX_CRYPTO_HUGE_NUMBER *left, NX_CRYPTO_HUGE_NUMBER *right,
+                                                      NX_CRYPTO_HUGE_NUMBER *result)
+{
+UINT      index, right_index;
+HN_UBASE *left_buffer, *right_buffer;
+HN_UBASE2 product;
+UINT      left_size, right_size;
+HN_UBASE *result_buffer;
+HN_UBASE *temp_ptr;
+
+    left_size = left -> nx_crypto_huge_number_size;
+    right_size = right -> nx_crypto_huge_number_size;
+    left_buffer = left -> nx_crypto_huge_number_data;
+    right_buffer = right -> nx_crypto_huge_number_data;
+
+    result_buffer = result -> nx_crypto_huge_number_data;
+    result -> nx_crypto_huge_number_size = (left_size + right_size);
+
+    NX_CRYPTO_MEMSET(result_buffer, 0, (left_size + right_size) << HN_SIZE_SHIFT);
+
+    for (index = 0; index < left_size; ++index)
+    {
+        if (left_buffer[index] == 0)
+        {
+            continue;
+        }
+
+        product = 0;
+        temp_ptr = result_buffer + index;
+        for (right_index = 0; right_index < right_size; ++right_index, ++temp_ptr)
+        {
+            product >>= HN_SHIFT;
+            product += (HN_UBASE2)left_buffer[index] * (HN_UBASE2)right_buffer[right_index] + *temp_ptr;
+            *temp_ptr = (product & HN_MASK);
+        }
+        *temp_ptr = (HN_UBASE)((product >> HN_SHIFT));
+    }
+
+    if (left -> nx_crypto_huge_number_is_negative == right -> nx_crypto_huge_number_is_negative)
+    {
+        result -> nx_crypto_huge_number_is_negative = NX_CRYPTO_FALSE;
+    }
+    else
+    {
+        result -> nx_crypto_huge_number_is_negative = NX_CRYPTO_TRUE;
+    }
+
+    _nx_crypto_huge_number_adjust_size(result);
+}
+
+
+/* The row-wise _nx_crypto_huge_number_square (Yang et al.) this test compares against. */
+static VOID _nx_crypto_huge_number_test_square_rows(NX_CRYPTO_HUGE_NUMBER *value, NX_CRYPTO_HUGE_NUMBER *result)
+{
+HN_UBASE2 product;
+UINT      value_size;
+UINT      result_size;
+HN_UBASE *value_buffer;
+HN_UBASE *result_buffer;
+UINT      i, j;
+
+    value_size = value -> nx_crypto_huge_number_size;
+    result_size = (value_size << 1);
+    result -> nx_crypto_huge_number_size = result_size;
+    value_buffer = value -> nx_crypto_huge_number_data;
+    result_buffer = result -> nx_crypto_huge_number_data;
+
+    NX_CRYPTO_MEMSET(result_buffer, 0, result_size << HN_SIZE_SHIFT);
+
+    for (i = 0; i < value_size; i++)
+    {
+        product = 0;
+        for (j = i + 1; j < value_size; j++)
+        {
+            product >>= HN_SHIFT;
+            product += result_buffer[i + j] + (HN_UBASE2)value_buffer[i] * value_buffer[j];
+            result_buffer[i + j] = product & HN_MASK;
+        }
+        result_buffer[i + j] = (HN_UBASE)(product >> HN_SHIFT);
+    }
+
+    for (i = result_size - 1; i > 0; i--)
+    {
+        result_buffer[i] = (HN_UBASE)((result_buffer[i] << 1) | (result_buffer[i - 1] >> (HN_SHIFT - 1)));
+    }
+    result_buffer[0] = (HN_UBASE)(result_buffer[0] << 1);
+
+    product = 0;
+    for (i = 0; i < value_size; i++)
+    {
+        product >>= HN_SHIFT;
+        product += result_buffer[i << 1] + (HN_UBASE2)value_buffer[i] * value_buffer[i];
+        result_buffer[i << 1] = product & HN_MASK;
+        product >>= HN_SHIFT;
+        product += result_buffer[(i << 1) + 1];
+        result_buffer[(i << 1) + 1] = product & HN_MASK;
+    }
+
+    result -> nx_crypto_huge_number_is_negative = NX_CRYPTO_FALSE;
+    _nx_crypto_huge_number_adjust_size(result);
+}
+
+
+/* The row-wise _nx_crypto_huge_number_mont this test compares against. Valid for x, y < m. */
+static VOID _nx_crypto_huge_number_test_mont_rows(NX_CRYPTO_HUGE_NUMBER *m, UINT mi, NX_CRYPTO_HUGE_NUMBER *x,
+                                                  NX_CRYPTO_HUGE_NUMBER *y, NX_CRYPTO_HUGE_NUMBER *result)
+{
+UINT      i, j;
+HN_UBASE  u;
+HN_UBASE  xi;
+HN_UBASE2 product;
+UINT      m_len = m -> nx_crypto_huge_number_size;
+UINT      x_len = x -> nx_crypto_huge_number_size;
+UINT      y_len = y -> nx_crypto_huge_number_size;
+HN_UBASE *m_buffer = m -> nx_crypto_huge_number_data;
+HN_UBASE *x_buffer = x -> nx_crypto_huge_number_data;
+HN_UBASE *y_buffer = y -> nx_crypto_huge_number_data;
+HN_UBASE *result_buffer = result -> nx_crypto_huge_number_data;
+
+    NX_CRYPTO_MEMSET(result -> nx_crypto_huge_number_data, 0, (m_len + 1) * sizeof(HN_UBASE));
+
+    for (i = 0; i < x_len; i++)
+    {
+        xi = x_buffer[i];
+
+        product = 0;
+        for (j = 0; j < y_len; j++)
+        {
+            product >>= HN_SHIFT;
+            product += result_buffer[j] + (HN_UBASE2)xi * y_buffer[j];
+            result_buffer[j] = (product & HN_MASK);
+        }
+        for (; j < (m_len + 1); j++)
+        {
+            product >>= HN_SHIFT;
+            product += result_buffer[j];
+            result_buffer[j] = (product & HN_MASK);
+        }
+
+        u = (HN_UBASE)(result_buffer[0] * mi);
+
+        product = result_buffer[0] + (HN_UBASE2)u * m_buffer[0];
+        for (j = 1; j < m_len; j++)
+        {
+            product >>= HN_SHIFT;
+            product += result_buffer[j] + (HN_UBASE2)u * m_buffer[j];
+            result_buffer[j - 1] = (product & HN_MASK);
+        }
+        product >>= HN_SHIFT;
+        product += result_buffer[j];
+        result_buffer[j - 1] = (product & HN_MASK);
+        result_buffer[j] = (HN_UBASE)(product >> HN_SHIFT);
+    }
+
+    for (; i < m_len; i++)
+    {
+        u = ((result_buffer[0] * mi) & HN_MASK);
+
+        product = result_buffer[0] + (HN_UBASE2)u * m_buffer[0];
+        for (j = 1; j < m_len; j++)
+        {
+            product >>= HN_SHIFT;
+            product += result_buffer[j] + (HN_UBASE2)u * m_buffer[j];
+            result_buffer[j - 1] = (product & HN_MASK);
+        }
+        product >>= HN_SHIFT;
+        product += result_buffer[j];
+        result_buffer[j - 1] = (product & HN_MASK);
+        result_buffer[j] = (HN_UBASE)(product >> HN_SHIFT);
+    }
+
+    result -> nx_crypto_huge_number_size = m_len + 1;
+    _nx_crypto_huge_number_adjust_size(result);
+
+    if (_nx_crypto_huge_number_compare(result, m) != NX_CRYPTO_HUGE_NUMBER_LESS)
+    {
+        _nx_crypto_huge_number_subtract(result, m);
+    }
+}
+
+
+/* Montgomery reduction of the full product x * y, with the carries of every step propagated to the top.
+   It gives the result _nx_crypto_huge_number_mont is specified to return for any x, y of at most m_len digits. */
+static VOID _nx_crypto_huge_number_test_mont_reduce(NX_CRYPTO_HUGE_NUMBER *m, UINT mi, NX_CRYPTO_HUGE_NUMBER *x,
+                                                    NX_CRYPTO_HUGE_NUMBER *y, NX_CRYPTO_HUGE_NUMBER *result)
+{
+static HN_UBASE       product_buffer[NX_CRYPTO_HUGE_NUMBER_TEST_BUFFER];
+NX_CRYPTO_HUGE_NUMBER product;
+UINT                  m_len = m -> nx_crypto_huge_number_size;
+UINT                  size = (m_len << 1) + 1;
+UINT                  i, j;
+HN_UBASE              u;
+HN_UBASE2             carry;
+
+    product.nx_crypto_huge_number_data = product_buffer;
+    product.nx_crypto_huge_buffer_size = sizeof(product_buffer);
+    _nx_crypto_huge_number_test_multiply_rows(x, y, &product);
+    NX_CRYPTO_MEMSET(&product_buffer[product.nx_crypto_huge_number_size], 0,
+                     (size - product.nx_crypto_huge_number_size) << HN_SIZE_SHIFT);
+
+    /* T = (T + u * m * radix ^ i) for each low digit, which clears it. */
+    for (i = 0; i < m_len; i++)
+    {
+        u = (HN_UBASE)((product_buffer[i] * mi) & HN_MASK);
+        carry = 0;
+        for (j = 0; j < m_len; j++)
+        {
+            carry += product_buffer[i + j] + (HN_UBASE2)u * m -> nx_crypto_huge_number_data[j];
+            product_buffer[i + j] = (HN_UBASE)(carry & HN_MASK);
+            carry >>= HN_SHIFT;
+        }
+        for (j += i; (carry != 0) && (j < size); j++)
+        {
+            carry += product_buffer[j];
+            product_buffer[j] = (HN_UBASE)(carry & HN_MASK);
+            carry >>= HN_SHIFT;
+        }
+    }
+
+    /* r = T / radix ^ m_len, less m once if it is not below m. */
+    NX_CRYPTO_MEMCPY(result -> nx_crypto_huge_number_data, &product_buffer[m_len], (m_len + 1) << HN_SIZE_SHIFT);
+    result -> nx_crypto_huge_number_size = m_len + 1;
+    result -> nx_crypto_huge_number_is_negative = NX_CRYPTO_FALSE;
+    _nx_crypto_huge_number_adjust_size(result);
+
+    if (_nx_crypto_huge_number_compare(result, m) != NX_CRYPTO_HUGE_NUMBER_LESS)
+    {
+        _nx_crypto_huge_number_subtract(result, m);
+    }
+}
+
+
+/* Return the number of mismatches over all rounds. */
+static UINT _nx_crypto_huge_number_test_multiply(VOID)
+{
+NX_CRYPTO_HUGE_NUMBER x, y, result, expected;
+UINT                  round;
+UINT                  mismatches = 0;
+
+    result.nx_crypto_huge_number_data = _nx_crypto_huge_number_test_result;
+    result.nx_crypto_huge_buffer_size = sizeof(_nx_crypto_huge_number_test_result);
+    expected.nx_crypto_huge_number_data = _nx_crypto_huge_number_test_expected;
+    expected.nx_crypto_huge_buffer_size = sizeof(_nx_crypto_huge_number_test_expected);
+
+    for (round = 0; round < NX_CRYPTO_HUGE_NUMBER_TEST_ROUNDS; round++)
+    {
+        _nx_crypto_huge_number_test_fill(&x, _nx_crypto_huge_number_test_x,
+                                         1 + _nx_crypto_huge_number_test_random() % NX_CRYPTO_HUGE_NUMBER_TEST_DIGITS,
+                                         _nx_crypto_huge_number_test_random() % NX_CRYPTO_HUGE_NUMBER_TEST_PATTERNS);
+        _nx_crypto_huge_number_test_fill(&y, _nx_crypto_huge_number_test_y,
+                                         1 + _nx_crypto_huge_number_test_random() % NX_CRYPTO_HUGE_NUMBER_TEST_DIGITS,
+                                         _nx_crypto_huge_number_test_random() % NX_CRYPTO_HUGE_NUMBER_TEST_PATTERNS);
+        x.nx_crypto_huge_number_is_negative = _nx_crypto_huge_number_test_random() & 1;
+
+        _nx_crypto_huge_number_multiply(&x, &y, &result);
+        _nx_crypto_huge_number_test_multiply_rows(&x, &y, &expected);
+        if (!_nx_crypto_huge_number_test_equal(&result, &expected))
+        {
+            mismatches++;
+        }
+    }
+
+    return(mismatches);
+}
+
+
+static UINT _nx_crypto_huge_number_test_square(VOID)
+{
+NX_CRYPTO_HUGE_NUMBER x, result, expected;
+UINT                  round;
+UINT                  mismatches = 0;
+
+    result.nx_crypto_huge_number_data = _nx_crypto_huge_number_test_result;
+    result.nx_crypto_huge_buffer_size = sizeof(_nx_crypto_huge_number_test_result);
+    expected.nx_crypto_huge_number_data = _nx_crypto_huge_number_test_expected;
+    expected.nx_crypto_huge_buffer_size = sizeof(_nx_crypto_huge_number_test_expected);
+
+    for (round = 0; round < NX_CRYPTO_HUGE_NUMBER_TEST_ROUNDS; round++)
+    {
+        _nx_crypto_huge_number_test_fill(&x, _nx_crypto_huge_number_test_x,
+                                         1 + _nx_crypto_huge_number_test_random() % NX_CRYPTO_HUGE_NUMBER_TEST_DIGITS,
+                                         _nx_crypto_huge_number_test_random() % NX_CRYPTO_HUGE_NUMBER_TEST_PATTERNS);
+
+        _nx_crypto_huge_number_square(&x, &result);
+        _nx_crypto_huge_number_test_square_rows(&x, &expected);
+        if (!_nx_crypto_huge_number_test_equal(&result, &expected))
+        {
+            mismatches++;
+        }
+    }
+
+    return(mismatches);
+}
+
+
+/* reduced counts the rounds where x, y < m, which are also compared with the row-wise loop. */
+static UINT _nx_crypto_huge_number_test_mont(UINT *reduced)
+{
+NX_CRYPTO_HUGE_NUMBER m, x, y, result, expected;
+UINT                  round;
+UINT                  m_len;
+UINT                  mi;
+UINT                  i;
+UINT                  unreduced;
+UINT                  mismatches = 0;
+HN_UBASE              inverse;
+
+    result.nx_crypto_huge_number_data = _nx_crypto_huge_number_test_result;
+    result.nx_crypto_huge_buffer_size = sizeof(_nx_crypto_huge_number_test_result);
+    expected.nx_crypto_huge_number_data = _nx_crypto_huge_number_test_expected;
+    expected.nx_crypto_huge_buffer_size = sizeof(_nx_crypto_huge_number_test_expected);
+    *reduced = 0;
+
+    for (round = 0; round < NX_CRYPTO_HUGE_NUMBER_TEST_ROUNDS; round++)
+    {
+
+        /* An odd modulus, with all ones now and then. */
+        m_len = 1 + _nx_crypto_huge_number_test_random() % NX_CRYPTO_HUGE_NUMBER_TEST_DIGITS;
+        _nx_crypto_huge_number_test_fill(&m, _nx_crypto_huge_number_test_m, m_len,
+                                         (_nx_crypto_huge_number_test_random() & 7) ?
+                                         NX_CRYPTO_HUGE_NUMBER_TEST_RANDOM : NX_CRYPTO_HUGE_NUMBER_TEST_ONES);
+        _nx_crypto_huge_number_test_m[0] |= 1;
+
+        /* mi = -m ^ (-1) mod radix, by Newton's iteration. */
+        inverse = _nx_crypto_huge_number_test_m[0];
+        for (i = 0; i < 5; i++)
+        {
+            inverse = (HN_UBASE)((inverse * (2 - (HN_UBASE2)_nx_crypto_huge_number_test_m[0] * inverse)) & HN_MASK);
+        }
+        mi = (UINT)((0 - inverse) & HN_MASK);
+
+        /* x and y have at most m_len digits. In one round out of four they have m_len digits and are not
+           reduced, so most of them are above m. */
+        unreduced = ((_nx_crypto_huge_number_test_random() & 3) == 0);
+        _nx_crypto_huge_number_test_fill(&x, _nx_crypto_huge_number_test_x,
+                                         unreduced ? m_len : (1 + _nx_crypto_huge_number_test_random() % m_len),
+                                         _nx_crypto_huge_number_test_random() % NX_CRYPTO_HUGE_NUMBER_TEST_PATTERNS);
+        _nx_crypto_huge_number_test_fill(&y, _nx_crypto_huge_number_test_y,
+                                         unreduced ? m_len : (1 + _nx_crypto_huge_number_test_random() % m_len),
+                                         _nx_crypto_huge_number_test_random() % NX_CRYPTO_HUGE_NUMBER_TEST_PATTERNS);
+        if (!unreduced)
+        {
+            _nx_crypto_huge_number_modulus(&x, &m);
+            _nx_crypto_huge_number_modulus(&y, &m);
+        }
+
+        _nx_crypto_huge_number_mont(&m, mi, &x, &y, &result);
+        _nx_crypto_huge_number_test_mont_reduce(&m, mi, &x, &y, &expected);
+        if (!_nx_crypto_huge_number_test_equal(&result, &expected))
+        {
+            mismatches++;
+        }
+
+        if ((_nx_crypto_huge_number_compare(&x, &m) == NX_CRYPTO_HUGE_NUMBER_LESS) &&
+            (_nx_crypto_huge_number_compare(&y, &m) == NX_CRYPTO_HUGE_NUMBER_LESS))
+        {
+            (*reduced)++;
+            _nx_crypto_huge_number_test_mont_rows(&m, mi, &x, &y, &expected);
+            if (!_nx_crypto_huge_number_test_equal(&result, &expected))
+            {
+                mismatches++;
+            }
+        }
+    }
+
+    return(mismatches);
+}
+
+
+int main(int argc, char **argv)
+{
+ULONG seed = 0x2545F491;
+UINT  reduced;
+
+    if ((argc == 3) && (strcmp(argv[1], "-s") == 0))
+    {
+        seed = strtoul(argv[2], NX_CRYPTO_NULL, 0);
+    }
+    else if (argc != 1)
+    {
+        printf("usage: %s [-s seed]\n", argv[0]);
+        return(2);
+    }
+    _nx_crypto_huge_number_test_random_state = (seed & 0xFFFFFFFFUL) ? (seed & 0xFFFFFFFFUL) : 1;
+
+    printf("%u-bit digits, operands up to %u digits, seed 0x%08lX\n",
+           (UINT)NX_CRYPTO_HUGE_NUMBER_BITS, (UINT)NX_CRYPTO_HUGE_NUMBER_TEST_DIGITS, (unsigned long)seed);
+
+    NX_CRYPTO_HUGE_NUMBER_TEST_CHECK(_nx_crypto_huge_number_test_multiply() == 0);
+    printf("multiply: %u rounds\n", (UINT)NX_CRYPTO_HUGE_NUMBER_TEST_ROUNDS);
+
+    NX_CRYPTO_HUGE_NUMBER_TEST_CHECK(_nx_crypto_huge_number_test_square() == 0);
+    printf("square: %u rounds\n", (UINT)NX_CRYPTO_HUGE_NUMBER_TEST_ROUNDS);
+
+    NX_CRYPTO_HUGE_NUMBER_TEST_CHECK(_nx_crypto_huge_number_test_mont(&reduced) == 0);
+    printf("Montgomery product: %u rounds, %u with reduced inputs\n",
+           (UINT)NX_CRYPTO_HUGE_NUMBER_TEST_ROUNDS, reduced);
+
+    printf("%s, %u failed checks\n", _nx_crypto_huge_number_test_failures ? "FAILED" : "PASSED",
+           _nx_crypto_huge_number_test_failures);
+    return(_nx_crypto_huge_number_test_failures ? 1 : 0);
+}
@@ -0,0 +1,577 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Crypto Component                                                 */
+/**                                                                       */
+/**   SHA-256 Test                                                        */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+/**************************************************************************/
+/*                                                                        */
+/*  PROGRAM                                                RELEASE        */
+/*                                                                        */
+/*    nx_crypto_sha256_test.c                             PORTABLE C      */
+/*                                                           6.1          */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This file is a host program, not part of the crypto library. It     */
+/*    checks _nx_crypto_sha256_process_blocks and the update that feeds   */
+/*    it against the one-block compression function and update they       */
+/*    replaced, which are kept below as reference copies.                 */
+/*                                                                        */
+/*    Both are first checked against the FIPS 180-4 examples for SHA-224  */
+/*    and SHA-256. Then:                                                  */
+/*                                                                        */
+/*      - runs of 1 to 16 random blocks, at every input offset from 0     */
+/*        to 7, must leave the same state after one call to               */
+/*        _nx_crypto_sha256_process_blocks as after one reference call    */
+/*        per block;                                                      */
+/*      - random messages of 0 to 4096 bytes, half of them within two     */
+/*        bytes of a block boundary, at offsets 0 to 7, are hashed with   */
+/*        SHA-224 or SHA-256. The library gets each message in random     */
+/*        chunks, some empty, and the reference gets it in one call; the  */
+/*        digests must match.                                             */
+/*                                                                        */
+/*    Build and run it with the Makefile in this directory, as            */
+/*                                                                        */
+/*      nx_crypto_sha256_test [-s seed]                                   */
+/*                                                                        */
+/*    The program exits with 1 if any check fails.                        */
+/*                                                                        */
+/**************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "nx_crypto_sha2.h"
+
+#define NX_CRYPTO_SHA256_TEST_ROUNDS        5000
+#define NX_CRYPTO_SHA256_TEST_MAX_LENGTH    4096
+#define NX_CRYPTO_SHA256_TEST_MAX_BLOCKS    16
+#define NX_CRYPTO_SHA256_TEST_MILLION       1000000
+
+#define NX_CRYPTO_SHA256_TEST_CHECK(condition) \
+    _nx_crypto_sha256_test_check((condition), #condition, __LINE__)
+
+#define CH_FUNC(x, y, z)           (((x) & (y)) ^ ((~(x)) & (z)))
+#define MAJ_FUNC(x, y, z)          (((x) & (y)) ^ ((x) & (z)) ^ ((y) & (z)))
+
+#define RIGHT_SHIFT_CIRCULAR(x, n) (((x) >> (n)) | ((x) << (32 - (n))))
+#define LARGE_SIGMA_0(x)           (RIGHT_SHIFT_CIRCULAR((x),  2) ^ RIGHT_SHIFT_CIRCULAR((x), 13) ^ RIGHT_SHIFT_CIRCULAR((x), 22))
+#define LARGE_SIGMA_1(x)           (RIGHT_SHIFT_CIRCULAR((x),  6) ^ RIGHT_SHIFT_CIRCULAR((x), 11) ^ RIGHT_SHIFT_CIRCULAR((x), 25))
+#define SMALL_SIGMA_0(x)           (RIGHT_SHIFT_CIRCULAR((x),  7) ^ RIGHT_SHIFT_CIRCULAR((x), 18) ^ ((x) >> 3))
+#define SMALL_SIGMA_1(x)           (RIGHT_SHIFT_CIRCULAR((x), 17) ^ RIGHT_SHIFT_CIRCULAR((x), 19) ^ ((x) >> 10))
+
+#define W0(t) ((((ULONG)buffer[(t) * 4]) << 24) | (((ULONG)buffer[((t) * 4) + 1]) << 16) | (((ULONG)buffer[((t) * 4) + 2]) << 8) | ((ULONG)buffer[((t) * 4) + 3]))
+#define W16(t) (SMALL_SIGMA_1(w[(t) - 2]) + w[(t) - 7] + SMALL_SIGMA_0(w[(t) - 15]) + w[(t) - 16])
+
+typedef struct NX_CRYPTO_SHA256_TEST_VECTOR_STRUCT
+{
+    const CHAR  *nx_crypto_sha256_test_message;
+    UINT         nx_crypto_sha256_test_algorithm;
+    const UCHAR  nx_crypto_sha256_test_digest[32];
+} NX_CRYPTO_SHA256_TEST_VECTOR;
+
+extern const ULONG _sha2_round_constants[64];
+
+/* FIPS 180-4 examples. A null message stands for one million 'a's. */
+static const NX_CRYPTO_SHA256_TEST_VECTOR _nx_crypto_sha256_test_vectors[] =
+{
+    {"abc", NX_CRYPTO_HASH_SHA224,
+     {0x23, 0x09, 0x7D, 0x22, 0x34, 0x05, 0xD8, 0x22, 0x86, 0x42, 0xA4, 0x77, 0xBD, 0xA2, 0x55, 0xB3,
+      0x2A, 0xAD, 0xBC, 0xE4, 0xBD, 0xA0, 0xB3, 0xF7, 0xE3, 0x6C, 0x9D, 0xA7}},
+    {"abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq", NX_CRYPTO_HASH_SHA224,
+     {0x75, 0x38, 0x8B, 0x16, 0x51, 0x27, 0x76, 0xCC, 0x5D, 0xBA, 0x5D, 0xA1, 0xFD, 0x89, 0x01, 0x50,
+      0xB0, 0xC6, 0x45, 0x5C, 0xB4, 0xF5, 0x8B, 0x19, 0x52, 0x52, 0x25, 0x25}},
+    {NX_CRYPTO_NULL, NX_CRYPTO_HASH_SHA224,
+     {0x20, 0x79, 0x46, 0x55, 0x98, 0x0C, 0x91, 0xD8, 0xBB, 0xB4, 0xC1, 0xEA, 0x97, 0x61, 0x8A, 0x4B,
+      0xF0, 0x3F, 0x42, 0x58, 0x19, 0x48, 0xB2, 0xEE, 0x4E, 0xE7, 0xAD, 0x67}},
+    {"abc", NX_CRYPTO_HASH_SHA256,
+     {0xBA, 0x78, 0x16, 0xBF, 0x8F, 0x01, 0xCF, 0xEA, 0x41, 0x41, 0x40, 0xDE, 0x5D, 0xAE, 0x22, 0x23,
+      0xB0, 0x03, 0x61, 0xA3, 0x96, 0x17, 0x7A, 0x9C, 0xB4, 0x10, 0xFF, 0x61, 0xF2, 0x00, 0x15, 0xAD}},
+    {"abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq", NX_CRYPTO_HASH_SHA256,
+     {0x24, 0x8D, 0x6A, 0x61, 0xD2, 0x06, 0x38, 0xB8, 0xE5, 0xC0, 0x26, 0x93, 0x0C, 0x3E, 0x60, 0x39,
+      0xA3, 0x3C, 0xE4, 0x59, 0x64, 0xFF, 0x21, 0x67, 0xF6, 0xEC, 0xED, 0xD4, 0x19, 0xDB, 0x06, 0xC1}},
+    {NX_CRYPTO_NULL, NX_CRYPTO_HASH_SHA256,
+     {0xCD, 0xC7, 0x6E, 0x5C, 0x99, 0x14, 0xFB, 0x92, 0x81, 0xA1, 0xC7, 0xE2, 0x84, 0xD7, 0x3E, 0x67,
+      0xF1, 0x80, 0x9A, 0x48, 0xA4, 0x97, 0x20, 0x0E, 0x04, 0x6D, 0x39, 0xCC, 0xC7, 0x11, 0x2C, 0xD0}},
+};
+
+/* Room for the longest message at the largest offset. ULONG keeps the start word aligned. */
+static ULONG            _nx_crypto_sha256_test_data[(NX_CRYPTO_SHA256_TEST_MILLION + 8) / sizeof(ULONG) + 1];
+static NX_CRYPTO_SHA256 _nx_crypto_sha256_test_context;
+static NX_CRYPTO_SHA256 _nx_crypto_sha256_test_reference_context;
+static ULONG            _nx_crypto_sha256_test_random_state;
+static UINT             _nx_crypto_sha256_test_failures;
+
+static VOID  _nx_crypto_sha256_test_check(UINT passed, const CHAR *condition, UINT line);
+static ULONG _nx_crypto_sha256_test_random(VOID);
+static VOID  _nx_crypto_sha256_test_process_buffer(NX_CRYPTO_SHA256 *context, UCHAR buffer[64]);
+static VOID  _nx_crypto_sha256_test_update(NX_CRYPTO_SHA256 *context, UCHAR *input_ptr, UINT input_length);
+static VOID  _nx_crypto_sha256_test_digest(NX_CRYPTO_SHA256 *context, UCHAR *digest, UINT algorithm);
+static UINT  _nx_crypto_sha256_test_digest_size(UINT algorithm);
+static VOID  _nx_crypto_sha256_test_vector(const NX_CRYPTO_SHA256_TEST_VECTOR *vector);
+static UINT  _nx_crypto_sha256_test_blocks(VOID);
+static UINT  _nx_crypto_sha256_test_messages(VOID);
+
+
+static VOID _nx_crypto_sha256_test_check(UINT passed, const CHAR *condition, UINT line)
+{
+    if (!passed)
+    {
+        printf("  FAILED at line %u: %s\n", line, condition);
+        _nx_crypto_sha256_test_failures++;
+    }
+}
+
+
+/* xorshift32, so that a failing seed can be run again. */
+static ULONG _nx_crypto_sha256_test_random(VOID)
+{
+ULONG x = _nx_crypto_sha256_test_random_state;
+
+    x ^= (x << 13) & 0xFFFFFFFFUL;
+    x ^= x >> 17;
+    x ^= (x << 5) & 0xFFFFFFFFUL;
+    _nx_crypto_sha256_test_random_state = x;
+    return(x);
+}
+
+
+/* The one-block _nx_crypto_sha256_process_buffer this test compares against. */
+static VOID _nx_crypto_sha256_test_process_buffer(NX_CRYPTO_SHA256 *context, UCHAR buffer[64])
+{
+ULONG *w;
+UINT   t;
+ULONG  temp1, temp2;
+ULONG  a, b, c, d, e, f, g, h;
+
+
+    /* Setup pointers to the word array.  */
+    w =  context -> nx_sha256_word_array;
+
+    /* Initialize the state variables.  */
+    a =  context -> nx_sha256_states[0];
+    b =  context -> nx_sha256_states[1];
+    c =  context -> nx_sha256_states[2];
+    d =  context -> nx_sha256_states[3];
+    e =  context -> nx_sha256_states[4];
+    f =  context -> nx_sha256_states[5];
+    g =  context -> nx_sha256_states[6];
+    h =  context -> nx_sha256_states[7];
+
+    /* Now, perform Round operations.  */
+    for (t = 0; t < 16; t += 8)
+    {
+
+        /* Setup each entry.  */
+        w[t] =  W0(t);
+        temp1 = h + LARGE_SIGMA_1(e) + CH_FUNC(e, f, g) + _sha2_round_constants[t] + w[t];
+        temp2 = LARGE_SIGMA_0(a) + MAJ_FUNC(a, b, c);
+        d = d + temp1;
+        h = temp1 + temp2;
+
+        w[t + 1] =  W0(t + 1);
+        temp1 = g + LARGE_SIGMA_1(d) + CH_FUNC(d, e, f) + _sha2_round_constants[t + 1] + w[t + 1];
+        temp2 = LARGE_SIGMA_0(h) + MAJ_FUNC(h, a, b);
+        c = c + temp1;
+        g = temp1 + temp2;
+
+        w[t + 2] =  W0(t + 2);
+        temp1 = f + LARGE_SIGMA_1(c) + CH_FUNC(c, d, e) + _sha2_round_constants[t + 2] + w[t + 2];
+        temp2 = LARGE_SIGMA_0(g) + MAJ_FUNC(g, h, a);
+        b = b + temp1;
+        f = temp1 + temp2;
+
+        w[t + 3] =  W0(t + 3);
+        temp1 = e + LARGE_SIGMA_1(b) + CH_FUNC(b, c, d) + _sha2_round_constants[t + 3] + w[t + 3];
+        temp2 = LARGE_SIGMA_0(f) + MAJ_FUNC(f, g, h);
+        a = a + temp1;
+        e = temp1 + temp2;
+
+        w[t + 4] =  W0(t + 4);
+        temp1 = d + LARGE_SIGMA_1(a) + CH_FUNC(a, b, c) + _sha2_round_constants[t + 4] + w[t + 4];
+        temp2 = LARGE_SIGMA_0(e) + MAJ_FUNC(e, f, g);
+        h = h + temp1;
+        d = temp1 + temp2;
+
+
+        w[t + 5] =  W0(t + 5);
+        temp1 = c + LARGE_SIGMA_1(h) + CH_FUNC(h, a, b) + _sha2_round_constants[t + 5] + w[t + 5];
+        temp2 = LARGE_SIGMA_0(d) + MAJ_FUNC(d, e, f);
+        g = g + temp1;
+        c = temp1 + temp2;
+
+        w[t + 6] =  W0(t + 6);
+        temp1 = b + LARGE_SIGMA_1(g) + CH_FUNC(g, h, a) + _sha2_round_constants[t + 6] + w[t + 6];
+        temp2 = LARGE_SIGMA_0(c) + MAJ_FUNC(c, d, e);
+        f = f + temp1;
+        b = temp1 + temp2;
+
+        w[t + 7] =  W0(t + 7);
+        temp1 = a + LARGE_SIGMA_1(f) + CH_FUNC(f, g, h) + _sha2_round_constants[t + 7] + w[t + 7];
+        temp2 = LARGE_SIGMA_0(b) + MAJ_FUNC(b, c, d);
+        e = e + temp1;
+        a = temp1 + temp2;
+    }
+
+    for (; t < 64; t += 8)
+    {
+
+        /* Setup each entry.  */
+        w[t] =  W16(t);
+        temp1 = h + LARGE_SIGMA_1(e) + CH_FUNC(e, f, g) + _sha2_round_constants[t] + w[t];
+        temp2 = LARGE_SIGMA_0(a) + MAJ_FUNC(a, b, c);
+        d = d + temp1;
+        h = temp1 + temp2;
+
+        w[t + 1] =  W16(t + 1);
+        temp1 = g + LARGE_SIGMA_1(d) + CH_FUNC(d, e, f) + _sha2_round_constants[t + 1] + w[t + 1];
+        temp2 = LARGE_SIGMA_0(h) + MAJ_FUNC(h, a, b);
+        c = c + temp1;
+        g = temp1 + temp2;
+
+        w[t + 2] =  W16(t + 2);
+        temp1 = f + LARGE_SIGMA_1(c) + CH_FUNC(c, d, e) + _sha2_round_constants[t + 2] + w[t + 2];
+        temp2 = LARGE_SIGMA_0(g) + MAJ_FUNC(g, h, a);
+        b = b + temp1;
+        f = temp1 + temp2;
+
+        w[t + 3] =  W16(t + 3);
+        temp1 = e + LARGE_SIGMA_1(b) + CH_FUNC(b, c, d) + _sha2_round_constants[t + 3] + w[t + 3];
+        temp2 = LARGE_SIGMA_0(f) + MAJ_FUNC(f, g, h);
+        a = a + temp1;
+        e = temp1 + temp2;
+
+        w[t + 4] =  W16(t + 4);
+        temp1 = d + LARGE_SIGMA_1(a) + CH_FUNC(a, b, c) + _sha2_round_constants[t + 4] + w[t + 4];
+        temp2 = LARGE_SIGMA_0(e) + MAJ_FUNC(e, f, g);
+        h = h + temp1;
+        d = temp1 + temp2;
+
+
+        w[t + 5] =  W16(t + 5);
+        temp1 = c + LARGE_SIGMA_1(h) + CH_FUNC(h, a, b) + _sha2_round_constants[t + 5] + w[t + 5];
+        temp2 = LARGE_SIGMA_0(d) + MAJ_FUNC(d, e, f);
+        g = g + temp1;
+        c = temp1 + temp2;
+
+        w[t + 6] =  W16(t + 6);
+        temp1 = b + LARGE_SIGMA_1(g) + CH_FUNC(g, h, a) + _sha2_round_constants[t + 6] + w[t + 6];
+        temp2 = LARGE_SIGMA_0(c) + MAJ_FUNC(c, d, e);
+        f = f + temp1;
+        b = temp1 + temp2;
+
+        w[t + 7] =  W16(t + 7);
+        temp1 = a + LARGE_SIGMA_1(f) + CH_FUNC(f, g, h) + _sha2_round_constants[t + 7] + w[t + 7];
+        temp2 = LARGE_SIGMA_0(b) + MAJ_FUNC(b, c, d);
+        e = e + temp1;
+        a = temp1 + temp2;
+
+    }
+
+    /* Save the resulting in this SHA256 context.  */
+    context -> nx_sha256_states[0] +=  a;
+    context -> nx_sha256_states[1] +=  b;
+    context -> nx_sha256_states[2] +=  c;
+    context -> nx_sha256_states[3] +=  d;
+    context -> nx_sha256_states[4] +=  e;
+    context -> nx_sha256_states[5] +=  f;
+    context -> nx_sha256_states[6] +=  g;
+    context -> nx_sha256_states[7] +=  h;
+}
+
+
+/* The _nx_crypto_sha256_update this test compares against, which made one call per block. */
+static VOID _nx_crypto_sha256_test_update(NX_CRYPTO_SHA256 *context, UCHAR *input_ptr, UINT input_length)
+{
+ULONG current_bytes;
+ULONG needed_fill_bytes;
+
+    if (input_length == 0)
+    {
+        return;
+    }
+
+    current_bytes =  (context -> nx_sha256_bit_count[0] >> 3) & 0x3F;
+    needed_fill_bytes =  64 - current_bytes;
+
+    context -> nx_sha256_bit_count[0] += (input_length << 3);
+    if (context -> nx_sha256_bit_count[0] < (input_length << 3))
+    {
+        context -> nx_sha256_bit_count[1]++;
+    }
+    context -> nx_sha256_bit_count[1] +=  (input_length >> 29);
+
+    if ((current_bytes) && (input_length >= needed_fill_bytes))
+    {
+        memcpy(&(context -> nx_sha256_buffer[current_bytes]), input_ptr, needed_fill_bytes);
+        _nx_crypto_sha256_test_process_buffer(context, context -> nx_sha256_buffer);
+        input_length =  input_length - needed_fill_bytes;
+        input_ptr =     input_ptr + needed_fill_bytes;
+        current_bytes =  0;
+    }
+
+    while (input_length >= 64)
+    {
+        _nx_crypto_sha256_test_process_buffer(context, input_ptr);
+        input_length =  input_length - 64;
+        input_ptr =     input_ptr + 64;
+    }
+
+    if (input_length)
+    {
+        memcpy(&(context -> nx_sha256_buffer[current_bytes]), input_ptr, input_length);
+    }
+}
+
+
+/* _nx_crypto_sha256_digest_calculate on top of the reference update. */
+static VOID _nx_crypto_sha256_test_digest(NX_CRYPTO_SHA256 *context, UCHAR *digest, UINT algorithm)
+{
+UCHAR padding[64];
+UCHAR bit_count[8];
+ULONG current_byte_count;
+UINT  i;
+
+    memset(padding, 0, sizeof(padding));
+    padding[0] = 0x80;
+    for (i = 0; i < 4; i++)
+    {
+        bit_count[i] = (UCHAR)(context -> nx_sha256_bit_count[1] >> (24 - (i << 3)));
+        bit_count[i + 4] = (UCHAR)(context -> nx_sha256_bit_count[0] >> (24 - (i << 3)));
+    }
+
+    current_byte_count =  (context -> nx_sha256_bit_count[0] >> 3) & 0x3F;
+    _nx_crypto_sha256_test_update(context, padding,
+                                  (current_byte_count < 56) ? (56 - current_byte_count) : (120 - current_byte_count));
+    _nx_crypto_sha256_test_update(context, bit_count, 8);
+
+    for (i = 0; i < _nx_crypto_sha256_test_digest_size(algorithm); i++)
+    {
+        digest[i] = (UCHAR)(context -> nx_sha256_states[i >> 2] >> (24 - ((i & 3) << 3)));
+    }
+}
+
+
+static UINT _nx_crypto_sha256_test_digest_size(UINT algorithm)
+{
+    return((algorithm == NX_CRYPTO_HASH_SHA224) ? 28 : 32);
+}
+
+
+/* Hash one FIPS 180-4 example with the library and with the reference. */
+static VOID _nx_crypto_sha256_test_vector(const NX_CRYPTO_SHA256_TEST_VECTOR *vector)
+{
+UCHAR *message = (UCHAR *)_nx_crypto_sha256_test_data;
+UCHAR  digest[32];
+UCHAR  reference_digest[32];
+UINT   length;
+UINT   size = _nx_crypto_sha256_test_digest_size(vector -> nx_crypto_sha256_test_algorithm);
+
+    if (vector -> nx_crypto_sha256_test_message)
+    {
+        length = (UINT)strlen(vector -> nx_crypto_sha256_test_message);
+        memcpy(message, vector -> nx_crypto_sha256_test_message, length);
+    }
+    else
+    {
+        length = NX_CRYPTO_SHA256_TEST_MILLION;
+        memset(message, 'a', length);
+    }
+
+    _nx_crypto_sha256_initialize(&_nx_crypto_sha256_test_context, vector -> nx_crypto_sha256_test_algorithm);
+    _nx_crypto_sha256_update(&_nx_crypto_sha256_test_context, message, length);
+    _nx_crypto_sha256_digest_calculate(&_nx_crypto_sha256_test_context, digest, vector -> nx_crypto_sha256_test_algorithm);
+    NX_CRYPTO_SHA256_TEST_CHECK(memcmp(digest, vector -> nx_crypto_sha256_test_digest, size) == 0);
+
+    _nx_crypto_sha256_initialize(&_nx_crypto_sha256_test_reference_context, vector -> nx_crypto_sha256_test_algorithm);
+    _nx_crypto_sha256_test_update(&_nx_crypto_sha256_test_reference_context, message, length);
+    _nx_crypto_sha256_test_digest(&_nx_crypto_sha256_test_reference_context, reference_digest,
+                                  vector -> nx_crypto_sha256_test_algorithm);
+    NX_CRYPTO_SHA256_TEST_CHECK(memcmp(reference_digest, vector -> nx_crypto_sha256_test_digest, size) == 0);
+}
+
+
+/* Runs of whole blocks through _nx_crypto_sha256_process_blocks, carrying the state
+   from run to run. Returns the number of runs whose state differs from the reference. */
+static UINT _nx_crypto_sha256_test_blocks(VOID)
+{
+UCHAR *data = (UCHAR *)_nx_crypto_sha256_test_data;
+UINT   mismatches = 0;
+UINT   offset;
+UINT   blocks;
+UINT   round;
+UINT   i;
+
+    for (offset = 0; offset < 8; offset++)
+    {
+        _nx_crypto_sha256_initialize(&_nx_crypto_sha256_test_context, NX_CRYPTO_HASH_SHA256);
+        _nx_crypto_sha256_test_reference_context = _nx_crypto_sha256_test_context;
+
+        for (round = 0; round < 64; round++)
+        {
+            blocks = 1 + (round % NX_CRYPTO_SHA256_TEST_MAX_BLOCKS);
+            for (i = 0; i < (blocks << 6); i++)
+            {
+                data[offset + i] = (UCHAR)_nx_crypto_sha256_test_random();
+            }
+
+            _nx_crypto_sha256_process_blocks(&_nx_crypto_sha256_test_context, data + offset, blocks);
+            for (i = 0; i < blocks; i++)
+            {
+                _nx_crypto_sha256_test_process_buffer(&_nx_crypto_sha256_test_reference_context,
+                                                      data + offset + (i << 6));
+            }
+
+            if (memcmp(_nx_crypto_sha256_test_context.nx_sha256_states,
+                       _nx_crypto_sha256_test_reference_context.nx_sha256_states,
+                       sizeof(_nx_crypto_sha256_test_context.nx_sha256_states)) != 0)
+            {
+                printf("  offset %u, %u blocks: state differs\n", offset, blocks);
+                mismatches++;
+            }
+        }
+    }
+
+    return(mismatches);
+}
+
+
+/* Random messages, fed to the library in random chunks. Returns the number of
+   messages whose digest differs from the reference. */
+static UINT _nx_crypto_sha256_test_messages(VOID)
+{
+UCHAR *data = (UCHAR *)_nx_crypto_sha256_test_data;
+UCHAR *message;
+UCHAR  digest[32];
+UCHAR  reference_digest[32];
+UINT   mismatches = 0;
+UINT   algorithm;
+UINT   length;
+UINT   offset;
+UINT   chunk;
+UINT   done;
+UINT   round;
+UINT   i;
+
+    for (round = 0; round < NX_CRYPTO_SHA256_TEST_ROUNDS; round++)
+    {
+        algorithm = (_nx_crypto_sha256_test_random() & 1) ? NX_CRYPTO_HASH_SHA256 : NX_CRYPTO_HASH_SHA224;
+
+        /* Half of the lengths are within two bytes of a multiple of 64, or of the 56 bytes
+           after which the length needs another block. */
+        if (_nx_crypto_sha256_test_random() & 1)
+        {
+            length = (_nx_crypto_sha256_test_random() % (NX_CRYPTO_SHA256_TEST_MAX_LENGTH >> 6)) << 6;
+            length += (_nx_crypto_sha256_test_random() & 1) ? 56 : 0;
+            length += _nx_crypto_sha256_test_random() % 5;
+            length = (length < 2) ? 0 : (length - 2);
+        }
+        else
+        {
+            length = _nx_crypto_sha256_test_random() % (NX_CRYPTO_SHA256_TEST_MAX_LENGTH + 1);
+        }
+        offset = _nx_crypto_sha256_test_random() & 7;
+        message = data + offset;
+        for (i = 0; i < length; i++)
+        {
+            message[i] = (UCHAR)_nx_crypto_sha256_test_random();
+        }
+
+        _nx_crypto_sha256_initialize(&_nx_crypto_sha256_test_context, algorithm);
+        for (done = 0; done < length; done += chunk)
+        {
+
+            /* Mostly short chunks, so the partial block is exercised, with some long ones. */
+            switch (_nx_crypto_sha256_test_random() & 3)
+            {
+            case 0:
+                chunk = 0;
+                break;
+
+            case 1:
+                chunk = length - done;
+                break;
+
+            case 2:
+                chunk = _nx_crypto_sha256_test_random() % (length - done + 1);
+                break;
+
+            default:
+                chunk = _nx_crypto_sha256_test_random() % 130;
+                break;
+            }
+            if (chunk > length - done)
+            {
+                chunk = length - done;
+            }
+            _nx_crypto_sha256_update(&_nx_crypto_sha256_test_context, message + done, chunk);
+        }
+        _nx_crypto_sha256_digest_calculate(&_nx_crypto_sha256_test_context, digest, algorithm);
+
+        _nx_crypto_sha256_initialize(&_nx_crypto_sha256_test_reference_context, algorithm);
+        _nx_crypto_sha256_test_update(&_nx_crypto_sha256_test_reference_context, message, length);
+        _nx_crypto_sha256_test_digest(&_nx_crypto_sha256_test_reference_context, reference_digest, algorithm);
+
+        if (memcmp(digest, reference_digest, _nx_crypto_sha256_test_digest_size(algorithm)) != 0)
+        {
+            printf("  SHA-%u, %u bytes at offset %u: digest differs\n",
+                   (algorithm == NX_CRYPTO_HASH_SHA224) ? 224 : 256, length, offset);
+            mismatches++;
+        }
+    }
+
+    return(mismatches);
+}
+
+
+int main(int argc, char **argv)
+{
+ULONG seed = 0x5A256C0D;
+UINT  v;
+
+    if ((argc == 3) && (strcmp(argv[1], "-s") == 0))
+    {
+        seed = strtoul(argv[2], NX_CRYPTO_NULL, 0);
+    }
+    else if (argc != 1)
+    {
+        printf("usage: %s [-s seed]\n", argv[0]);
+        return(2);
+    }
+    _nx_crypto_sha256_test_random_state = (seed & 0xFFFFFFFFUL) ? (seed & 0xFFFFFFFFUL) : 1;
+
+    printf("seed 0x%08lX\n", (unsigned long)seed);
+
+    for (v = 0; v < sizeof(_nx_crypto_sha256_test_vectors) / sizeof(_nx_crypto_sha256_test_vectors[0]); v++)
+    {
+        _nx_crypto_sha256_test_vector(&_nx_crypto_sha256_test_vectors[v]);
+    }
+    printf("known answers: %s\n", _nx_crypto_sha256_test_failures ? "FAILED" : "passed");
+
+    NX_CRYPTO_SHA256_TEST_CHECK(_nx_crypto_sha256_test_blocks() == 0);
+    printf("block runs: %u\n", 8 * 64);
+
+    NX_CRYPTO_SHA256_TEST_CHECK(_nx_crypto_sha256_test_messages() == 0);
+    printf("messages: %u\n", (UINT)NX_CRYPTO_SHA256_TEST_ROUNDS);
+
+    printf("%s, %u failed checks\n", _nx_crypto_sha256_test_failures ? "FAILED" : "PASSED",
+           _nx_crypto_sha256_test_failures);
+    return(_nx_crypto_sha256_test_failures ? 1 : 0);
+}
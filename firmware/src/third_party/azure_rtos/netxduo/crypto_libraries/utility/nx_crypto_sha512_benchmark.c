@@ -0,0 +1,335 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Crypto Component                                                 */
+/**                                                                       */
+/**   SHA-512 Benchmark                                                   */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+/**************************************************************************/
+/*                                                                        */
+/*  PROGRAM                                                RELEASE        */
+/*                                                                        */
+/*    nx_crypto_sha512_benchmark.c                        PORTABLE C      */
+/*                                                           6.1          */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This file is a host program, not part of the crypto library. It     */
+/*    compares _nx_crypto_sha512_process_buffer with the compression      */
+/*    function it replaced, which is kept below as the previous one. The  */
+/*    previous function expanded all 80 schedule words into the context,  */
+/*    shifted the eight state variables after every round and loaded      */
+/*    each word a byte at a time. SHA-384 and the SHA-512/t variants use  */
+/*    the same function, so one comparison covers all of them.            */
+/*                                                                        */
+/*    Both functions first hash the same random blocks, at every input    */
+/*    offset from 0 to 7, and must give the same state. Then each one     */
+/*    hashes buffers of 128, 1024, 16384 and 65536 bytes, word aligned    */
+/*    and at an odd address, one call per block as _nx_crypto_sha512_     */
+/*    update makes them. The two take turns within each repetition, and   */
+/*    the median of the repetitions is reported in megabytes per second,  */
+/*    with the ratio of current to previous.                              */
+/*                                                                        */
+/*    Build and run it with the Makefile in this directory, as            */
+/*                                                                        */
+/*      make benchmark-sha512                                             */
+/*                                                                        */
+/*    or run it by hand as                                                */
+/*                                                                        */
+/*      nx_crypto_sha512_benchmark [-r repetitions] [-b bytes]            */
+/*                                                                        */
+/*    where bytes is how much each repetition hashes. The program exits   */
+/*    with 1 if the two functions disagree.                               */
+/*                                                                        */
+/**************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "nx_crypto_sha5.h"
+
+#define NX_CRYPTO_SHA512_BENCHMARK_MAX_SIZE        65536
+#define NX_CRYPTO_SHA512_BENCHMARK_MAX_REPETITIONS 101
+#define NX_CRYPTO_SHA512_BENCHMARK_CHECK_BLOCKS    1000
+
+#define CH_FUNC(x, y, z)           (((x) & (y)) ^ ((~(x)) & (z)))
+#define MAJ_FUNC(x, y, z)          (((x) & (y)) ^ ((x) & (z)) ^ ((y) & (z)))
+
+#define RIGHT_SHIFT_CIRCULAR(x, n) (((x) >> (n)) | ((x) << (64 - (n))))
+#define LARGE_SIGMA_0(x)           (RIGHT_SHIFT_CIRCULAR((x),  28) ^ RIGHT_SHIFT_CIRCULAR((x), 34) ^ RIGHT_SHIFT_CIRCULAR((x), 39))
+#define LARGE_SIGMA_1(x)           (RIGHT_SHIFT_CIRCULAR((x),  14) ^ RIGHT_SHIFT_CIRCULAR((x), 18) ^ RIGHT_SHIFT_CIRCULAR((x), 41))
+#define SMALL_SIGMA_0(x)           (RIGHT_SHIFT_CIRCULAR((x),  1) ^ RIGHT_SHIFT_CIRCULAR((x), 8) ^ ((x) >> 7))
+#define SMALL_SIGMA_1(x)           (RIGHT_SHIFT_CIRCULAR((x), 19) ^ RIGHT_SHIFT_CIRCULAR((x), 61) ^ ((x) >> 6))
+
+typedef VOID (*NX_CRYPTO_SHA512_BENCHMARK_FUNCTION)(NX_CRYPTO_SHA512 *context, UCHAR *buffer);
+
+extern const ULONG64 _sha5_round_constants[];
+
+static const UINT _nx_crypto_sha512_benchmark_sizes[] = {128, 1024, 16384, NX_CRYPTO_SHA512_BENCHMARK_MAX_SIZE};
+
+/* The data, with room for an odd offset. ULONG64 keeps the start word aligned. */
+static ULONG64          _nx_crypto_sha512_benchmark_data[(NX_CRYPTO_SHA512_BENCHMARK_MAX_SIZE + 64) / 8];
+static NX_CRYPTO_SHA512 _nx_crypto_sha512_benchmark_context;
+static UINT             _nx_crypto_sha512_benchmark_failures;
+static ULONG            _nx_crypto_sha512_benchmark_random_state = 0x5A512C0D;
+
+
+/* The compression function before the rounds were unrolled, as it was in
+   nx_crypto_sha5.c.  */
+static VOID _nx_crypto_sha512_benchmark_process_buffer_previous(NX_CRYPTO_SHA512 *context, UCHAR *buffer)
+{
+ULONG64 *w;
+UINT     t;
+ULONG64  temp1, temp2;
+ULONG64  a, b, c, d, e, f, g, h;
+
+
+    w =  context -> nx_sha512_word_array;
+
+    for (t = 0; t < 16; t++)
+    {
+        w[t] =  (((ULONG64)buffer[0]) << 56) |
+            (((ULONG64)buffer[1]) << 48) |
+            (((ULONG64)buffer[2]) << 40) |
+            (((ULONG64)buffer[3]) << 32) |
+            (((ULONG64)buffer[4]) << 24) |
+            (((ULONG64)buffer[5]) << 16) |
+            (((ULONG64)buffer[6]) << 8) |
+            ((ULONG64)buffer[7]);
+        buffer += 8;
+    }
+
+    for (t = 16; t < 80; t++)
+    {
+        w[t] =  SMALL_SIGMA_1(w[t - 2]) + w[t - 7] + SMALL_SIGMA_0(w[t - 15]) + w[t - 16];
+    }
+
+    a =  context -> nx_sha512_states[0];
+    b =  context -> nx_sha512_states[1];
+    c =  context -> nx_sha512_states[2];
+    d =  context -> nx_sha512_states[3];
+    e =  context -> nx_sha512_states[4];
+    f =  context -> nx_sha512_states[5];
+    g =  context -> nx_sha512_states[6];
+    h =  context -> nx_sha512_states[7];
+
+    for (t = 0; t < 80; t++)
+    {
+        temp1 = h + LARGE_SIGMA_1(e) + CH_FUNC(e, f, g) + _sha5_round_constants[t] + w[t];
+        temp2 = LARGE_SIGMA_0(a) + MAJ_FUNC(a, b, c);
+        h = g;
+        g = f;
+        f = e;
+        e = d + temp1;
+        d = c;
+        c = b;
+        b = a;
+        a = temp1 + temp2;
+    }
+
+    context -> nx_sha512_states[0] +=  a;
+    context -> nx_sha512_states[1] +=  b;
+    context -> nx_sha512_states[2] +=  c;
+    context -> nx_sha512_states[3] +=  d;
+    context -> nx_sha512_states[4] +=  e;
+    context -> nx_sha512_states[5] +=  f;
+    context -> nx_sha512_states[6] +=  g;
+    context -> nx_sha512_states[7] +=  h;
+}
+
+
+/* xorshift32, so a run can be repeated. */
+static ULONG _nx_crypto_sha512_benchmark_random(VOID)
+{
+ULONG x = _nx_crypto_sha512_benchmark_random_state;
+
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    _nx_crypto_sha512_benchmark_random_state = x;
+    return(x);
+}
+
+
+static double _nx_crypto_sha512_benchmark_time(VOID)
+{
+struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return((double)now.tv_sec + (double)now.tv_nsec * 1e-9);
+}
+
+
+/* qsort comparison of two doubles. */
+static int _nx_crypto_sha512_benchmark_compare(const void *a, const void *b)
+{
+double x = *(const double *)a;
+double y = *(const double *)b;
+
+    return((x > y) - (x < y));
+}
+
+
+static double _nx_crypto_sha512_benchmark_median(double *values, UINT count)
+{
+    qsort(values, count, sizeof(double), _nx_crypto_sha512_benchmark_compare);
+    return(values[count / 2]);
+}
+
+
+/* Hash random blocks at each offset with both functions, carrying the state
+   from block to block, and compare the states after every block.  */
+static VOID _nx_crypto_sha512_benchmark_check(VOID)
+{
+NX_CRYPTO_SHA512 previous;
+UCHAR           *data = (UCHAR *)_nx_crypto_sha512_benchmark_data;
+UINT             offset;
+UINT             block;
+UINT             i;
+
+    for (offset = 0; offset < 8; offset++)
+    {
+        _nx_crypto_sha512_initialize(&_nx_crypto_sha512_benchmark_context, NX_CRYPTO_HASH_SHA512);
+        previous = _nx_crypto_sha512_benchmark_context;
+
+        for (block = 0; block < NX_CRYPTO_SHA512_BENCHMARK_CHECK_BLOCKS; block++)
+        {
+            for (i = 0; i < 128; i++)
+            {
+                data[offset + i] = (UCHAR)_nx_crypto_sha512_benchmark_random();
+            }
+
+            _nx_crypto_sha512_process_buffer(&_nx_crypto_sha512_benchmark_context, data + offset);
+            _nx_crypto_sha512_benchmark_process_buffer_previous(&previous, data + offset);
+
+            if (memcmp(_nx_crypto_sha512_benchmark_context.nx_sha512_states, previous.nx_sha512_states,
+                       sizeof(previous.nx_sha512_states)) != 0)
+            {
+                printf("  FAILED: state differs at offset %u, block %u\n", offset, block);
+                _nx_crypto_sha512_benchmark_failures++;
+                break;
+            }
+        }
+    }
+}
+
+
+/* Seconds per byte of one repetition of one function on one buffer. */
+static double _nx_crypto_sha512_benchmark_run(NX_CRYPTO_SHA512_BENCHMARK_FUNCTION function, UCHAR *buffer,
+                                              UINT size, ULONG iterations)
+{
+double start;
+ULONG  n;
+UINT   i;
+
+    _nx_crypto_sha512_initialize(&_nx_crypto_sha512_benchmark_context, NX_CRYPTO_HASH_SHA512);
+
+    start = _nx_crypto_sha512_benchmark_time();
+    for (n = 0; n < iterations; n++)
+    {
+        for (i = 0; i < size; i += 128)
+        {
+            function(&_nx_crypto_sha512_benchmark_context, buffer + i);
+        }
+    }
+
+    return((_nx_crypto_sha512_benchmark_time() - start) / ((double)iterations * size));
+}
+
+
+int main(int argc, char **argv)
+{
+UCHAR *data = (UCHAR *)_nx_crypto_sha512_benchmark_data;
+UINT   repetitions = 31;
+ULONG  bytes = 1024 * 1024;
+double previous[NX_CRYPTO_SHA512_BENCHMARK_MAX_REPETITIONS];
+double current[NX_CRYPTO_SHA512_BENCHMARK_MAX_REPETITIONS];
+double previous_seconds;
+double current_seconds;
+ULONG  iterations;
+UINT   offset;
+UINT   size;
+UINT   s;
+UINT   r;
+UINT   i;
+int    arg;
+
+    for (arg = 1; arg < argc; arg++)
+    {
+        if ((strcmp(argv[arg], "-r") == 0) && (arg + 1 < argc))
+        {
+            repetitions = (UINT)strtoul(argv[++arg], NX_CRYPTO_NULL, 0);
+        }
+        else if ((strcmp(argv[arg], "-b") == 0) && (arg + 1 < argc))
+        {
+            bytes = strtoul(argv[++arg], NX_CRYPTO_NULL, 0);
+        }
+        else
+        {
+            printf("usage: %s [-r repetitions] [-b bytes]\n", argv[0]);
+            return(2);
+        }
+    }
+    if ((repetitions == 0) || (repetitions > NX_CRYPTO_SHA512_BENCHMARK_MAX_REPETITIONS) || (bytes == 0))
+    {
+        printf("repetitions must be 1 to %u and bytes more than 0\n", NX_CRYPTO_SHA512_BENCHMARK_MAX_REPETITIONS);
+        return(2);
+    }
+
+    _nx_crypto_sha512_benchmark_check();
+    printf("previous and current compression: %s\n", _nx_crypto_sha512_benchmark_failures ? "FAILED" : "match");
+
+    for (i = 0; i < sizeof(_nx_crypto_sha512_benchmark_data); i++)
+    {
+        data[i] = (UCHAR)_nx_crypto_sha512_benchmark_random();
+    }
+
+    printf("%-8s %-9s %14s %14s %8s\n", "size", "alignment", "previous MB/s", "current MB/s", "ratio");
+    for (s = 0; s < sizeof(_nx_crypto_sha512_benchmark_sizes) / sizeof(_nx_crypto_sha512_benchmark_sizes[0]); s++)
+    {
+        for (offset = 0; offset < 2; offset++)
+        {
+            size = _nx_crypto_sha512_benchmark_sizes[s];
+            iterations = (bytes + size - 1) / size;
+
+            /* The two functions take turns within each repetition, so both see the same
+               load on the host. The first repetition warms up and is not counted. */
+            for (r = 0; r <= repetitions; r++)
+            {
+                previous_seconds = _nx_crypto_sha512_benchmark_run(_nx_crypto_sha512_benchmark_process_buffer_previous,
+                                                                   data + offset, size, iterations);
+                current_seconds = _nx_crypto_sha512_benchmark_run(_nx_crypto_sha512_process_buffer,
+                                                                  data + offset, size, iterations);
+                if (r > 0)
+                {
+                    previous[r - 1] = previous_seconds;
+                    current[r - 1] = current_seconds;
+                }
+            }
+
+            previous_seconds = _nx_crypto_sha512_benchmark_median(previous, repetitions);
+            current_seconds = _nx_crypto_sha512_benchmark_median(current, repetitions);
+            printf("%-8u %-9s %14.1f %14.1f %8.2f\n", size,
+                   offset ? "odd" : "word", 1e-6 / previous_seconds, 1e-6 / current_seconds,
+                   previous_seconds / current_seconds);
+        }
+    }
+
+    return(_nx_crypto_sha512_benchmark_failures ? 1 : 0);
+}
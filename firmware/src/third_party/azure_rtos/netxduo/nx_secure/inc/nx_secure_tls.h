@@ -136,6 +136,27 @@ extern   "C" {
 #define NX_SECURE_AEAD_CIPHER_CHECK(a)                  NX_FALSE
 #endif /* NX_SECURE_AEAD_CIPHER_CHECK */
 
+/* AEAD ciphers whose update operation carries an unfinished block over to the next call.
+   Records in a packet chain are passed to them one packet at a time, so blocks that
+   straddle two packets are not copied through _nx_secure_tls_record_block_buffer. */
+#ifndef NX_SECURE_AEAD_CIPHER_PARTIAL_BLOCK_CHECK
+#define NX_SECURE_AEAD_CIPHER_PARTIAL_BLOCK_CHECK(a)    (((a) == NX_CRYPTO_ENCRYPTION_AES_CCM_8) ||          \
+                                                         ((a) == NX_CRYPTO_ENCRYPTION_AES_CCM_12) ||         \
+                                                         ((a) == NX_CRYPTO_ENCRYPTION_AES_CCM_16) ||         \
+                                                         ((a) == NX_CRYPTO_ENCRYPTION_AES_GCM_16) ||         \
+                                                         ((a) == NX_CRYPTO_ENCRYPTION_CHACHA20_POLY1305))
+#endif /* NX_SECURE_AEAD_CIPHER_PARTIAL_BLOCK_CHECK */
+
+/* AEAD ciphers whose decrypt update accepts the same buffer for input and output.
+   Application data records that lie within one packet are decrypted in place in the received packet. */
+#ifndef NX_SECURE_AEAD_CIPHER_IN_PLACE_CHECK
+#define NX_SECURE_AEAD_CIPHER_IN_PLACE_CHECK(a)         (((a) == NX_CRYPTO_ENCRYPTION_AES_CCM_8) ||          \
+                                                         ((a) == NX_CRYPTO_ENCRYPTION_AES_CCM_12) ||         \
+                                                         ((a) == NX_CRYPTO_ENCRYPTION_AES_CCM_16) ||         \
+                                                         ((a) == NX_CRYPTO_ENCRYPTION_AES_GCM_16) ||         \
+                                                         ((a) == NX_CRYPTO_ENCRYPTION_CHACHA20_POLY1305))
+#endif /* NX_SECURE_AEAD_CIPHER_IN_PLACE_CHECK */
+
 /* ID is used to determine if a TLS session has been initialized. */
 #define NX_SECURE_TLS_ID                                ((ULONG)0x544c5320)
 
@@ -286,6 +307,7 @@ extern   "C" {
 #define NX_SECURE_TLS_RECORD_OVERFLOW                   0x151       /* Received a TLSCiphertext record that had a length too long. */
 #define NX_SECURE_TLS_HANDSHAKE_FRAGMENT_RECEIVED       0x152       /* Received a fragmented handshake message - take appropriate action at a higher level of the state machine. */
 #define NX_SECURE_TLS_TRANSMIT_LOCKED                   0x153       /* Another thread is transmitting. */
+#define NX_SECURE_TLS_BAD_RECORD_SIZE_EXTENSION         0x154       /* The remote host sent a max_fragment_length or record_size_limit extension that is invalid or was not offered. */
 
 /* NX_CONTINUE is a symbol defined in NetX Duo 5.10.  For backward compatibility, this symbol is defined here */
 #if ((__NETXDUO_MAJOR_VERSION__ == 5) && (__NETXDUO_MINOR_VERSION__ == 9))
@@ -528,9 +550,12 @@ typedef struct NX_SECURE_VERSIONS_LIST_STRUCT
 #define TLS_ECDHE_RSA_WITH_AES_256_GCM_SHA384              0xC030
 #define TLS_ECDH_RSA_WITH_AES_128_GCM_SHA256               0xC031
 #define TLS_ECDH_RSA_WITH_AES_256_GCM_SHA384               0xC032
+#define TLS_ECDHE_RSA_WITH_CHACHA20_POLY1305_SHA256        0xCCA8
+#define TLS_ECDHE_ECDSA_WITH_CHACHA20_POLY1305_SHA256      0xCCA9
 
 #define TLS_AES_128_GCM_SHA256                             0x1301
 #define TLS_AES_256_GCM_SHA384                             0x1302
+#define TLS_CHACHA20_POLY1305_SHA256                       0x1303
 #define TLS_AES_128_CCM_SHA256                             0x1304
 #define TLS_AES_128_CCM_8_SHA256                           0x1305
 
@@ -613,6 +638,7 @@ typedef struct NX_SECURE_VERSIONS_LIST_STRUCT
 #define NX_SECURE_TLS_EXTENSION_EC_GROUPS                  (0x000A)
 #define NX_SECURE_TLS_EXTENSION_EC_POINT_FORMATS           (0x000B)
 #define NX_SECURE_TLS_EXTENSION_SIGNATURE_ALGORITHMS       (0x000D)
+#define NX_SECURE_TLS_EXTENSION_RECORD_SIZE_LIMIT          (0x001C)
 #define NX_SECURE_TLS_EXTENSION_PRE_SHARED_KEY             (0x0029)
 #define NX_SECURE_TLS_EXTENSION_EARLY_DATA                 (0x002A)
 #define NX_SECURE_TLS_EXTENSION_SUPPORTED_VERSIONS         (0x002B)
@@ -628,6 +654,9 @@ typedef struct NX_SECURE_VERSIONS_LIST_STRUCT
 
 /* Extension-specific values. */
 #define NX_SECURE_TLS_SNI_NAME_TYPE_DNS                    (0x0)
+#define NX_SECURE_TLS_MAX_FRAGMENT_LENGTH_512              (1)   /* RFC 6066 codes 1-4 ask for 2^9-2^12 byte records. */
+#define NX_SECURE_TLS_MAX_FRAGMENT_LENGTH_4096             (4)
+#define NX_SECURE_TLS_RECORD_SIZE_LIMIT_MIN                (64)  /* Smallest record_size_limit value allowed by RFC 8449. */
 
 /* Define the maximum number of structures allocated for TLS ClientHello and ServerHello extension data. */
 #define NX_SECURE_TLS_HELLO_EXTENSIONS_MAX                 (10)
@@ -668,6 +697,37 @@ typedef struct NX_SECURE_VERSIONS_LIST_STRUCT
 
 #define NX_SECURE_TLS_MAX_SESSION_TICKET_AGE               (604800) /* Maximum lifetime of a NewSessionTicket (in milliseconds). */
 
+#ifdef NX_SECURE_TLS_ENABLE_CLIENT_SESSION_CACHE
+/* Maximum length of the server name that identifies a cached TLS client session. */
+#ifndef NX_SECURE_TLS_SESSION_CACHE_NAME_SIZE
+#define NX_SECURE_TLS_SESSION_CACHE_NAME_SIZE              (NX_SECURE_X509_DNS_NAME_MAX)
+#endif
+
+/* Maximum size of a TLS 1.0-1.2 session ID stored in the session cache. */
+#define NX_SECURE_TLS_SESSION_CACHE_ID_SIZE                (32)
+
+/* Lifetime of a cached TLS client session in seconds, as returned by the session time function. */
+#ifndef NX_SECURE_TLS_SESSION_CACHE_LIFETIME
+#define NX_SECURE_TLS_SESSION_CACHE_LIFETIME               (86400)
+#endif
+
+#if (NX_SECURE_TLS_TLS_1_3_ENABLED)
+/* Maximum size of a TLS 1.3 session ticket stored in the session cache. Larger tickets are not cached. */
+#ifndef NX_SECURE_TLS_SESSION_CACHE_TICKET_SIZE
+#define NX_SECURE_TLS_SESSION_CACHE_TICKET_SIZE            (256)
+#endif
+#endif /* NX_SECURE_TLS_TLS_1_3_ENABLED */
+#endif /* NX_SECURE_TLS_ENABLE_CLIENT_SESSION_CACHE */
+
+/* Size of the buffer holding the ClientHello until the handshake hash is known. */
+#ifndef NX_SECURE_TLS_HANDSHAKE_CACHE_SIZE
+#if defined(NX_SECURE_TLS_ENABLE_CLIENT_SESSION_CACHE) && (NX_SECURE_TLS_TLS_1_3_ENABLED)
+#define NX_SECURE_TLS_HANDSHAKE_CACHE_SIZE                 (500 + NX_SECURE_TLS_SESSION_CACHE_TICKET_SIZE)
+#else
+#define NX_SECURE_TLS_HANDSHAKE_CACHE_SIZE                 (500)
+#endif
+#endif
+
 #define NX_SECURE_TLS_MAX_CIPHERTEXT_LENGTH                (18432) /* Maximum TLSCiphertext record length. */
 #define NX_SECURE_TLS_MAX_CIPHERTEXT_LENGTH_1_3            (16640) /* Maximum TLSCiphertext record length of TLS 1.3. */
 #define NX_SECURE_TLS_MAX_PLAINTEXT_LENGTH                 (16384) /* Maximum TLSPlaintext record length. */
@@ -948,7 +1008,7 @@ typedef struct NX_SECURE_TLS_KEY_MATERIAL_STRUCT
 
     /* Pointer to buffer where we can store handshake messages to hash once we know
        the hash routine we are using. */
-    UCHAR nx_secure_tls_handshake_cache[500];
+    UCHAR nx_secure_tls_handshake_cache[NX_SECURE_TLS_HANDSHAKE_CACHE_SIZE];
     UINT  nx_secure_tls_handshake_cache_length;
 
     /* The TLS protocol requires a "secret" used in the hash of each message,
@@ -1093,6 +1153,59 @@ typedef struct NX_SECURE_TLS_HELLO_EXTENSION_STRUCT
     const UCHAR *nx_secure_tls_extension_data;
 } NX_SECURE_TLS_HELLO_EXTENSION;
 
+#ifdef NX_SECURE_TLS_ENABLE_CLIENT_SESSION_CACHE
+/* A TLS client session saved for resumption with the session ID or, for TLS 1.3, the session ticket
+   issued by a server. The entry holds no pointers so it can be written to and restored from storage as is. */
+typedef struct NX_SECURE_TLS_SESSION_CACHE_ENTRY_STRUCT
+{
+    /* Name of the server the session was negotiated with. A zero length marks a free entry. */
+    UCHAR  nx_secure_tls_session_cache_server_name[NX_SECURE_TLS_SESSION_CACHE_NAME_SIZE];
+    USHORT nx_secure_tls_session_cache_server_name_length;
+
+    /* Protocol version and ciphersuite of the cached session. */
+    USHORT nx_secure_tls_session_cache_protocol_version;
+    USHORT nx_secure_tls_session_cache_ciphersuite;
+
+    /* Session ID issued by the server. */
+    UCHAR  nx_secure_tls_session_cache_session_id_length;
+    UCHAR  nx_secure_tls_session_cache_session_id[NX_SECURE_TLS_SESSION_CACHE_ID_SIZE];
+
+    /* Master secret of the cached session. For TLS 1.3 this is the PSK derived for the session ticket. */
+    UCHAR  nx_secure_tls_session_cache_master_secret[NX_SECURE_TLS_MASTER_SIZE];
+
+#if (NX_SECURE_TLS_TLS_1_3_ENABLED)
+    /* TLS 1.3 session ticket with its lifetime in seconds and the value that obfuscates its age. */
+    ULONG  nx_secure_tls_session_cache_ticket_lifetime;
+    ULONG  nx_secure_tls_session_cache_ticket_age_add;
+    USHORT nx_secure_tls_session_cache_ticket_length;
+    UCHAR  nx_secure_tls_session_cache_ticket[NX_SECURE_TLS_SESSION_CACHE_TICKET_SIZE];
+#endif /* NX_SECURE_TLS_TLS_1_3_ENABLED */
+
+    /* Time the session was established, from the session time function. */
+    ULONG  nx_secure_tls_session_cache_timestamp;
+
+    /* Age of the entry, used to replace the least recently stored session when the cache is full. */
+    ULONG  nx_secure_tls_session_cache_sequence;
+} NX_SECURE_TLS_SESSION_CACHE_ENTRY;
+
+/* A set of cached TLS client sessions that may be shared by several TLS sessions. */
+typedef struct NX_SECURE_TLS_SESSION_CACHE_STRUCT
+{
+    /* Array of cache entries, supplied by the application. */
+    NX_SECURE_TLS_SESSION_CACHE_ENTRY *nx_secure_tls_session_cache_entries;
+    UINT                               nx_secure_tls_session_cache_entry_count;
+
+    /* Counter used to age the cache entries. */
+    ULONG                              nx_secure_tls_session_cache_sequence;
+
+    /* Function (set by application) to call when an entry is stored or removed, for
+       example to save it to non-volatile storage. A removed entry is passed in with
+       a zero server name length. */
+    UINT (*nx_secure_tls_session_cache_update_callback)(struct NX_SECURE_TLS_SESSION_CACHE_STRUCT *cache,
+                                                        NX_SECURE_TLS_SESSION_CACHE_ENTRY *entry);
+} NX_SECURE_TLS_SESSION_CACHE;
+#endif /* NX_SECURE_TLS_ENABLE_CLIENT_SESSION_CACHE */
+
 
 /* Definition of the top-level TLS session control block used by the application. */
 typedef struct NX_SECURE_TLS_SESSION_STRUCT
@@ -1175,6 +1288,29 @@ typedef struct NX_SECURE_TLS_SESSION_STRUCT
     /* Session ID used for session re-negotiation. */
     UCHAR nx_secure_tls_session_id[NX_SECURE_TLS_SESSION_ID_SIZE];
 
+#ifdef NX_SECURE_TLS_ENABLE_CLIENT_SESSION_CACHE
+    /* Cache of resumable sessions and the name of the server this TLS Client connects to. */
+    NX_SECURE_TLS_SESSION_CACHE *nx_secure_tls_session_cache;
+    const UCHAR *nx_secure_tls_session_cache_server_name;
+    UINT   nx_secure_tls_session_cache_server_name_length;
+
+    /* Ciphersuite and protocol version of the cached session offered in the ClientHello.
+       The ciphersuite is zero if no session was offered. */
+    USHORT nx_secure_tls_session_cache_ciphersuite;
+    USHORT nx_secure_tls_session_cache_protocol_version;
+
+    /* Set when the server accepted the offered session and an abbreviated handshake is in progress. */
+    UCHAR  nx_secure_tls_session_resumed;
+
+#if (NX_SECURE_TLS_TLS_1_3_ENABLED)
+    /* Cache entry holding the session ticket to offer, only valid while the ClientHello is built. */
+    NX_SECURE_TLS_SESSION_CACHE_ENTRY *nx_secure_tls_session_cache_ticket_entry;
+
+    /* PSK of the offered session ticket. The PSK size is zero if no ticket was offered. */
+    NX_SECURE_TLS_PSK_STORE nx_secure_tls_session_cache_psk;
+#endif /* NX_SECURE_TLS_TLS_1_3_ENABLED */
+#endif /* NX_SECURE_TLS_ENABLE_CLIENT_SESSION_CACHE */
+
 #ifndef NX_SECURE_TLS_DISABLE_SECURE_RENEGOTIATION
     /* This flag indicates whether the remote host supports secure renegotiation
        as indicated in the initial Hello messages (SCSV or the renegotiation
@@ -1222,6 +1358,36 @@ typedef struct NX_SECURE_TLS_SESSION_STRUCT
     /* This mutex used for TLS session while transmitting packets. */
     TX_MUTEX nx_secure_tls_session_transmit_mutex;
 
+#ifdef NX_SECURE_TLS_ENABLE_SEND_COALESCING
+    /* Application data held back to be sent with later data in one record. */
+    NX_PACKET *nx_secure_tls_send_coalesce_packet;
+
+    /* Time the held data was first held back. */
+    ULONG nx_secure_tls_send_coalesce_time;
+
+    /* Sends smaller than the threshold (in bytes) are held back, for no longer than the timeout
+       (in ticks) when further data is sent. The timeout is checked on the next send only.
+       A threshold of zero disables coalescing. */
+    ULONG nx_secure_tls_send_coalesce_threshold;
+    ULONG nx_secure_tls_send_coalesce_timeout;
+#endif /* NX_SECURE_TLS_ENABLE_SEND_COALESCING */
+
+#ifdef NX_SECURE_TLS_ENABLE_RECORD_SIZE_LIMIT
+    /* Largest record (record_size_limit value, in bytes) the application asks the remote
+       host to send. Zero if not set. */
+    USHORT nx_secure_tls_record_size_limit;
+
+    /* The record_size_limit value and max_fragment_length code received from the remote host
+       in its hello (zero if not received). */
+    USHORT nx_secure_tls_remote_record_size_limit;
+    UCHAR  nx_secure_tls_remote_max_fragment_length;
+
+    /* Negotiated limits on the application data in each record sent and received, in bytes.
+       Zero if no limit was negotiated. */
+    USHORT nx_secure_tls_record_size_limit_send;
+    USHORT nx_secure_tls_record_size_limit_receive;
+#endif /* NX_SECURE_TLS_ENABLE_RECORD_SIZE_LIMIT */
+
 #ifndef NX_SECURE_TLS_DISABLE_SECURE_RENEGOTIATION
     /* If we receive a hello message from the remote server during a session,
        we have a re-negotiation handshake we need to process. */
@@ -1457,6 +1623,10 @@ UINT _nx_secure_tls_process_handshake_header(UCHAR *packet_buffer, USHORT *messa
                                              UINT *header_size, UINT *message_length);
 UINT _nx_secure_tls_process_record(NX_SECURE_TLS_SESSION *tls_session, NX_PACKET *packet_ptr,
                                    ULONG *bytes_processed, ULONG wait_option);
+#ifdef NX_SECURE_TLS_ENABLE_RECORD_SIZE_LIMIT
+UINT _nx_secure_tls_process_record_size_extension(NX_SECURE_TLS_SESSION *tls_session, USHORT extension_id,
+                                                  UCHAR *packet_buffer, UINT extension_length);
+#endif /* NX_SECURE_TLS_ENABLE_RECORD_SIZE_LIMIT */
 UINT _nx_secure_tls_process_remote_certificate(NX_SECURE_TLS_SESSION *tls_session,
                                                UCHAR *packet_buffer,
                                                UINT message_length,
@@ -1479,12 +1649,16 @@ UINT _nx_secure_tls_record_hash_update(NX_SECURE_TLS_SESSION *tls_session, UCHAR
                                        UINT length);
 UINT _nx_secure_tls_record_payload_decrypt(NX_SECURE_TLS_SESSION *tls_session, NX_PACKET *encrypted_packet,
                                            UINT offset, UINT message_length, NX_PACKET **decrypted_packet,
+                                           ULONG *plaintext_offset, UINT *plaintext_length,
                                            ULONG sequence_num[NX_SECURE_TLS_SEQUENCE_NUMBER_SIZE],
                                            UCHAR record_type, UINT wait_option);                                           
 UINT _nx_secure_tls_record_payload_encrypt(NX_SECURE_TLS_SESSION *tls_session,
                                            NX_PACKET *send_packet,
                                            ULONG sequence_num[NX_SECURE_TLS_SEQUENCE_NUMBER_SIZE],
                                            UCHAR record_type);
+#ifdef NX_SECURE_TLS_ENABLE_RECORD_SIZE_LIMIT
+UINT _nx_secure_tls_record_size_limit_update(NX_SECURE_TLS_SESSION *tls_session);
+#endif /* NX_SECURE_TLS_ENABLE_RECORD_SIZE_LIMIT */
 UINT _nx_secure_tls_remote_certificate_free(NX_SECURE_TLS_SESSION *tls_session,
                                             NX_SECURE_X509_DISTINGUISHED_NAME *name);
 UINT _nx_secure_tls_remote_certificate_verify(NX_SECURE_TLS_SESSION *tls_session);
@@ -1509,6 +1683,16 @@ UINT _nx_secure_tls_send_handshake_record(NX_SECURE_TLS_SESSION *tls_session,
 UINT _nx_secure_tls_send_hellorequest(NX_SECURE_TLS_SESSION *tls_session, NX_PACKET *send_packet);
 UINT _nx_secure_tls_send_certificate_verify(NX_SECURE_TLS_SESSION *tls_session,
                                             NX_PACKET *send_packet);
+#ifdef NX_SECURE_TLS_ENABLE_SEND_COALESCING
+UINT _nx_secure_tls_send_coalesced_record(NX_SECURE_TLS_SESSION *tls_session, ULONG wait_option);
+#endif /* NX_SECURE_TLS_ENABLE_SEND_COALESCING */
+#ifdef NX_SECURE_TLS_ENABLE_RECORD_SIZE_LIMIT
+UINT _nx_secure_tls_send_fragmented_record(NX_SECURE_TLS_SESSION *tls_session, NX_PACKET *send_packet,
+                                           ULONG wait_option);
+UINT _nx_secure_tls_send_record_size_extensions(NX_SECURE_TLS_SESSION *tls_session, UCHAR *packet_buffer,
+                                                ULONG *packet_offset, USHORT *extension_length,
+                                                ULONG available_size);
+#endif /* NX_SECURE_TLS_ENABLE_RECORD_SIZE_LIMIT */
 UINT _nx_secure_tls_send_record(NX_SECURE_TLS_SESSION *tls_session, NX_PACKET *send_packet,
                                 UCHAR record_type, ULONG wait_option);
 UINT _nx_secure_tls_send_server_key_exchange(NX_SECURE_TLS_SESSION *tls_session,
@@ -1524,6 +1708,20 @@ UINT _nx_secure_tls_server_certificate_find(NX_SECURE_TLS_SESSION *tls_session,
 UINT _nx_secure_tls_server_certificate_remove(NX_SECURE_TLS_SESSION *tls_session, UINT cert_id);
 UINT _nx_secure_tls_server_handshake(NX_SECURE_TLS_SESSION *tls_session, UCHAR *packet_buffer,
                                      UINT data_length, ULONG wait_option);
+#ifdef NX_SECURE_TLS_ENABLE_CLIENT_SESSION_CACHE
+NX_SECURE_TLS_SESSION_CACHE_ENTRY *_nx_secure_tls_session_cache_entry_select(NX_SECURE_TLS_SESSION_CACHE *cache,
+                                                                            const UCHAR *server_name,
+                                                                            UINT server_name_length);
+UINT _nx_secure_tls_session_cache_find(NX_SECURE_TLS_SESSION *tls_session,
+                                       NX_SECURE_TLS_SESSION_CACHE_ENTRY **entry);
+UINT _nx_secure_tls_session_cache_remove(NX_SECURE_TLS_SESSION *tls_session);
+UINT _nx_secure_tls_session_cache_store(NX_SECURE_TLS_SESSION *tls_session);
+#if (NX_SECURE_TLS_TLS_1_3_ENABLED)
+UINT _nx_secure_tls_session_cache_ticket_store(NX_SECURE_TLS_SESSION *tls_session, ULONG ticket_lifetime,
+                                               ULONG ticket_age_add, const UCHAR *ticket, UINT ticket_length,
+                                               const UCHAR *psk, UINT psk_length);
+#endif /* NX_SECURE_TLS_TLS_1_3_ENABLED */
+#endif /* NX_SECURE_TLS_ENABLE_CLIENT_SESSION_CACHE */
 UINT _nx_secure_tls_session_iv_size_get(NX_SECURE_TLS_SESSION *tls_session, USHORT *iv_size);
 UINT _nx_secure_tls_session_keys_set(NX_SECURE_TLS_SESSION *tls_session, USHORT key_set);
 UINT _nx_secure_tls_session_receive_records(NX_SECURE_TLS_SESSION *tls_session,
@@ -1578,6 +1776,15 @@ UINT _nx_secure_tls_server_certificate_find(NX_SECURE_TLS_SESSION *tls_session,
 UINT _nx_secure_tls_server_certificate_remove(NX_SECURE_TLS_SESSION *tls_session, UINT cert_id);
 UINT _nx_secure_tls_session_alert_value_get(NX_SECURE_TLS_SESSION *tls_session,
                                             UINT *alert_level, UINT *alert_value);
+#ifdef NX_SECURE_TLS_ENABLE_CLIENT_SESSION_CACHE
+UINT _nx_secure_tls_session_cache_create(NX_SECURE_TLS_SESSION_CACHE *cache, VOID *entry_buffer, ULONG buffer_size,
+                                         UINT (*update_callback)(NX_SECURE_TLS_SESSION_CACHE *cache,
+                                                                 NX_SECURE_TLS_SESSION_CACHE_ENTRY *entry));
+UINT _nx_secure_tls_session_cache_entry_restore(NX_SECURE_TLS_SESSION_CACHE *cache,
+                                                NX_SECURE_TLS_SESSION_CACHE_ENTRY *entry);
+UINT _nx_secure_tls_session_cache_set(NX_SECURE_TLS_SESSION *tls_session, NX_SECURE_TLS_SESSION_CACHE *cache,
+                                      const UCHAR *server_name, UINT server_name_length);
+#endif /* NX_SECURE_TLS_ENABLE_CLIENT_SESSION_CACHE */
 UINT _nx_secure_tls_session_certificate_callback_set(NX_SECURE_TLS_SESSION *tls_session,
                                                      ULONG (*func_ptr)(NX_SECURE_TLS_SESSION *session,
                                                                        NX_SECURE_X509_CERT *certificate));
@@ -1608,6 +1815,11 @@ UINT _nx_secure_tls_session_protocol_version_override(NX_SECURE_TLS_SESSION *tls
                                                       USHORT protocol_version);
 UINT _nx_secure_tls_session_receive(NX_SECURE_TLS_SESSION *tls_session, NX_PACKET **packet_ptr_ptr,
                                     ULONG wait_option);
+#ifdef NX_SECURE_TLS_ENABLE_RECORD_SIZE_LIMIT
+UINT _nx_secure_tls_session_record_size_limit_get(NX_SECURE_TLS_SESSION *tls_session, ULONG *send_limit,
+                                                  ULONG *receive_limit);
+UINT _nx_secure_tls_session_record_size_limit_set(NX_SECURE_TLS_SESSION *tls_session, ULONG record_size_limit);
+#endif /* NX_SECURE_TLS_ENABLE_RECORD_SIZE_LIMIT */
 UINT _nx_secure_tls_session_renegotiate(NX_SECURE_TLS_SESSION *tls_session,
                                         UINT wait_option);
 UINT _nx_secure_tls_session_renegotiate_callback_set(NX_SECURE_TLS_SESSION *tls_session,
@@ -1615,6 +1827,11 @@ UINT _nx_secure_tls_session_renegotiate_callback_set(NX_SECURE_TLS_SESSION *tls_
 UINT _nx_secure_tls_session_reset(NX_SECURE_TLS_SESSION *tls_session);
 UINT _nx_secure_tls_session_send(NX_SECURE_TLS_SESSION *tls_session, NX_PACKET *packet_ptr,
                                  ULONG wait_option);
+#ifdef NX_SECURE_TLS_ENABLE_SEND_COALESCING
+UINT _nx_secure_tls_session_send_coalesce_set(NX_SECURE_TLS_SESSION *tls_session, ULONG threshold,
+                                              ULONG timeout);
+UINT _nx_secure_tls_session_send_flush(NX_SECURE_TLS_SESSION *tls_session, ULONG wait_option);
+#endif /* NX_SECURE_TLS_ENABLE_SEND_COALESCING */
 UINT _nx_secure_tls_session_server_callback_set(NX_SECURE_TLS_SESSION *tls_session,
                                                 ULONG (*func_ptr)(NX_SECURE_TLS_SESSION *tls_session,
                                                                   NX_SECURE_TLS_HELLO_EXTENSION *extensions,
@@ -1677,6 +1894,15 @@ UINT _nxe_secure_tls_server_certificate_find(NX_SECURE_TLS_SESSION *tls_session,
 UINT _nxe_secure_tls_server_certificate_remove(NX_SECURE_TLS_SESSION *tls_session, UINT cert_id);
 UINT  _nxe_secure_tls_session_alert_value_get(NX_SECURE_TLS_SESSION *tls_session,
                                                         UINT *alert_level, UINT *alert_value);
+#ifdef NX_SECURE_TLS_ENABLE_CLIENT_SESSION_CACHE
+UINT _nxe_secure_tls_session_cache_create(NX_SECURE_TLS_SESSION_CACHE *cache, VOID *entry_buffer, ULONG buffer_size,
+                                          UINT (*update_callback)(NX_SECURE_TLS_SESSION_CACHE *cache,
+                                                                  NX_SECURE_TLS_SESSION_CACHE_ENTRY *entry));
+UINT _nxe_secure_tls_session_cache_entry_restore(NX_SECURE_TLS_SESSION_CACHE *cache,
+                                                 NX_SECURE_TLS_SESSION_CACHE_ENTRY *entry);
+UINT _nxe_secure_tls_session_cache_set(NX_SECURE_TLS_SESSION *tls_session, NX_SECURE_TLS_SESSION_CACHE *cache,
+                                       const UCHAR *server_name, UINT server_name_length);
+#endif /* NX_SECURE_TLS_ENABLE_CLIENT_SESSION_CACHE */
 UINT _nxe_secure_tls_session_certificate_callback_set(NX_SECURE_TLS_SESSION *tls_session,
                                                       ULONG (*func_ptr)(NX_SECURE_TLS_SESSION *session,
                                                                         NX_SECURE_X509_CERT *certificate));
@@ -1700,6 +1926,11 @@ UINT _nxe_secure_tls_session_protocol_version_override(NX_SECURE_TLS_SESSION *tl
                                                        USHORT protocol_version);
 UINT _nxe_secure_tls_session_receive(NX_SECURE_TLS_SESSION *tls_session, NX_PACKET **packet_ptr_ptr,
                                      ULONG wait_option);
+#ifdef NX_SECURE_TLS_ENABLE_RECORD_SIZE_LIMIT
+UINT _nxe_secure_tls_session_record_size_limit_get(NX_SECURE_TLS_SESSION *tls_session, ULONG *send_limit,
+                                                   ULONG *receive_limit);
+UINT _nxe_secure_tls_session_record_size_limit_set(NX_SECURE_TLS_SESSION *tls_session, ULONG record_size_limit);
+#endif /* NX_SECURE_TLS_ENABLE_RECORD_SIZE_LIMIT */
 UINT _nxe_secure_tls_session_renegotiate(NX_SECURE_TLS_SESSION *tls_session,
                                          UINT wait_option);
 UINT _nxe_secure_tls_session_renegotiate_callback_set(NX_SECURE_TLS_SESSION *tls_session,
@@ -1707,6 +1938,11 @@ UINT _nxe_secure_tls_session_renegotiate_callback_set(NX_SECURE_TLS_SESSION *tls
 UINT _nxe_secure_tls_session_reset(NX_SECURE_TLS_SESSION *tls_session);
 UINT _nxe_secure_tls_session_send(NX_SECURE_TLS_SESSION *tls_session, NX_PACKET *packet_ptr,
                                   ULONG wait_option);
+#ifdef NX_SECURE_TLS_ENABLE_SEND_COALESCING
+UINT _nxe_secure_tls_session_send_coalesce_set(NX_SECURE_TLS_SESSION *tls_session, ULONG threshold,
+                                               ULONG timeout);
+UINT _nxe_secure_tls_session_send_flush(NX_SECURE_TLS_SESSION *tls_session, ULONG wait_option);
+#endif /* NX_SECURE_TLS_ENABLE_SEND_COALESCING */
 UINT _nxe_secure_tls_session_server_callback_set(NX_SECURE_TLS_SESSION *tls_session,
                                                  ULONG (*func_ptr)(NX_SECURE_TLS_SESSION *tls_session,
                                                                    NX_SECURE_TLS_HELLO_EXTENSION *extensions,
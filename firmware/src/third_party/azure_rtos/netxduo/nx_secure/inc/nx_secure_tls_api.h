@@ -85,6 +85,11 @@ extern   "C" {
 #define nx_secure_tls_server_certificate_find              _nx_secure_tls_server_certificate_find
 #define nx_secure_tls_server_certificate_remove            _nx_secure_tls_server_certificate_remove
 #define nx_secure_tls_session_alert_value_get              _nx_secure_tls_session_alert_value_get
+#ifdef NX_SECURE_TLS_ENABLE_CLIENT_SESSION_CACHE
+#define nx_secure_tls_session_cache_create                 _nx_secure_tls_session_cache_create
+#define nx_secure_tls_session_cache_entry_restore          _nx_secure_tls_session_cache_entry_restore
+#define nx_secure_tls_session_cache_set                    _nx_secure_tls_session_cache_set
+#endif /* NX_SECURE_TLS_ENABLE_CLIENT_SESSION_CACHE */
 #define nx_secure_tls_session_certificate_callback_set     _nx_secure_tls_session_certificate_callback_set
 #define nx_secure_tls_session_client_callback_set          _nx_secure_tls_session_client_callback_set
 #define nx_secure_tls_session_client_verify_disable        _nx_secure_tls_session_client_verify_disable
@@ -96,10 +101,18 @@ extern   "C" {
 #define nx_secure_tls_session_packet_buffer_set            _nx_secure_tls_session_packet_buffer_set
 #define nx_secure_tls_session_protocol_version_override    _nx_secure_tls_session_protocol_version_override
 #define nx_secure_tls_session_receive                      _nx_secure_tls_session_receive
+#ifdef NX_SECURE_TLS_ENABLE_RECORD_SIZE_LIMIT
+#define nx_secure_tls_session_record_size_limit_get        _nx_secure_tls_session_record_size_limit_get
+#define nx_secure_tls_session_record_size_limit_set        _nx_secure_tls_session_record_size_limit_set
+#endif /* NX_SECURE_TLS_ENABLE_RECORD_SIZE_LIMIT */
 #define nx_secure_tls_session_renegotiate                  _nx_secure_tls_session_renegotiate
 #define nx_secure_tls_session_renegotiate_callback_set     _nx_secure_tls_session_renegotiate_callback_set
 #define nx_secure_tls_session_reset                        _nx_secure_tls_session_reset
 #define nx_secure_tls_session_send                         _nx_secure_tls_session_send
+#ifdef NX_SECURE_TLS_ENABLE_SEND_COALESCING
+#define nx_secure_tls_session_send_coalesce_set            _nx_secure_tls_session_send_coalesce_set
+#define nx_secure_tls_session_send_flush                   _nx_secure_tls_session_send_flush
+#endif /* NX_SECURE_TLS_ENABLE_SEND_COALESCING */
 #define nx_secure_tls_session_server_callback_set          _nx_secure_tls_session_server_callback_set
 #define nx_secure_tls_session_sni_extension_parse          _nx_secure_tls_session_sni_extension_parse
 #define nx_secure_tls_session_sni_extension_set            _nx_secure_tls_session_sni_extension_set
@@ -127,6 +140,11 @@ extern   "C" {
 #define nx_secure_tls_server_certificate_find              _nxe_secure_tls_server_certificate_find
 #define nx_secure_tls_server_certificate_remove            _nxe_secure_tls_server_certificate_remove
 #define nx_secure_tls_session_alert_value_get              _nxe_secure_tls_session_alert_value_get
+#ifdef NX_SECURE_TLS_ENABLE_CLIENT_SESSION_CACHE
+#define nx_secure_tls_session_cache_create                 _nxe_secure_tls_session_cache_create
+#define nx_secure_tls_session_cache_entry_restore          _nxe_secure_tls_session_cache_entry_restore
+#define nx_secure_tls_session_cache_set                    _nxe_secure_tls_session_cache_set
+#endif /* NX_SECURE_TLS_ENABLE_CLIENT_SESSION_CACHE */
 #define nx_secure_tls_session_certificate_callback_set     _nxe_secure_tls_session_certificate_callback_set
 #define nx_secure_tls_session_client_callback_set          _nxe_secure_tls_session_client_callback_set
 #define nx_secure_tls_session_client_verify_disable        _nxe_secure_tls_session_client_verify_disable
@@ -138,10 +156,18 @@ extern   "C" {
 #define nx_secure_tls_session_packet_buffer_set            _nxe_secure_tls_session_packet_buffer_set
 #define nx_secure_tls_session_protocol_version_override    _nxe_secure_tls_session_protocol_version_override
 #define nx_secure_tls_session_receive                      _nxe_secure_tls_session_receive
+#ifdef NX_SECURE_TLS_ENABLE_RECORD_SIZE_LIMIT
+#define nx_secure_tls_session_record_size_limit_get        _nxe_secure_tls_session_record_size_limit_get
+#define nx_secure_tls_session_record_size_limit_set        _nxe_secure_tls_session_record_size_limit_set
+#endif /* NX_SECURE_TLS_ENABLE_RECORD_SIZE_LIMIT */
 #define nx_secure_tls_session_renegotiate                  _nxe_secure_tls_session_renegotiate
 #define nx_secure_tls_session_renegotiate_callback_set     _nxe_secure_tls_session_renegotiate_callback_set
 #define nx_secure_tls_session_reset                        _nxe_secure_tls_session_reset
 #define nx_secure_tls_session_send                         _nxe_secure_tls_session_send
+#ifdef NX_SECURE_TLS_ENABLE_SEND_COALESCING
+#define nx_secure_tls_session_send_coalesce_set            _nxe_secure_tls_session_send_coalesce_set
+#define nx_secure_tls_session_send_flush                   _nxe_secure_tls_session_send_flush
+#endif /* NX_SECURE_TLS_ENABLE_SEND_COALESCING */
 #define nx_secure_tls_session_server_callback_set          _nxe_secure_tls_session_server_callback_set
 #define nx_secure_tls_session_sni_extension_parse          _nxe_secure_tls_session_sni_extension_parse
 #define nx_secure_tls_session_sni_extension_set            _nxe_secure_tls_session_sni_extension_set
@@ -198,6 +224,15 @@ UINT nx_secure_tls_server_certificate_find(NX_SECURE_TLS_SESSION *tls_session,
 UINT nx_secure_tls_server_certificate_remove(NX_SECURE_TLS_SESSION *tls_session, UINT cert_id);
 UINT  nx_secure_tls_session_alert_value_get(NX_SECURE_TLS_SESSION *tls_session,
                                             UINT *alert_level, UINT *alert_value);
+#ifdef NX_SECURE_TLS_ENABLE_CLIENT_SESSION_CACHE
+UINT nx_secure_tls_session_cache_create(NX_SECURE_TLS_SESSION_CACHE *cache, VOID *entry_buffer, ULONG buffer_size,
+                                        UINT (*update_callback)(NX_SECURE_TLS_SESSION_CACHE *cache,
+                                                                NX_SECURE_TLS_SESSION_CACHE_ENTRY *entry));
+UINT nx_secure_tls_session_cache_entry_restore(NX_SECURE_TLS_SESSION_CACHE *cache,
+                                               NX_SECURE_TLS_SESSION_CACHE_ENTRY *entry);
+UINT nx_secure_tls_session_cache_set(NX_SECURE_TLS_SESSION *tls_session, NX_SECURE_TLS_SESSION_CACHE *cache,
+                                     const UCHAR *server_name, UINT server_name_length);
+#endif /* NX_SECURE_TLS_ENABLE_CLIENT_SESSION_CACHE */
 UINT nx_secure_tls_session_certificate_callback_set(NX_SECURE_TLS_SESSION *tls_session,
                                                     ULONG (*func_ptr)(NX_SECURE_TLS_SESSION *session,
                                                                       NX_SECURE_X509_CERT *certificate));
@@ -222,12 +257,22 @@ UINT nx_secure_tls_session_protocol_version_override(NX_SECURE_TLS_SESSION *tls_
                                                      USHORT protocol_version);
 UINT nx_secure_tls_session_receive(NX_SECURE_TLS_SESSION *tls_session, NX_PACKET **packet_ptr_ptr,
                                    ULONG wait_option);
+#ifdef NX_SECURE_TLS_ENABLE_RECORD_SIZE_LIMIT
+UINT nx_secure_tls_session_record_size_limit_get(NX_SECURE_TLS_SESSION *tls_session, ULONG *send_limit,
+                                                 ULONG *receive_limit);
+UINT nx_secure_tls_session_record_size_limit_set(NX_SECURE_TLS_SESSION *tls_session, ULONG record_size_limit);
+#endif /* NX_SECURE_TLS_ENABLE_RECORD_SIZE_LIMIT */
 UINT nx_secure_tls_session_renegotiate(NX_SECURE_TLS_SESSION *tls_session, UINT wait_option);
 UINT nx_secure_tls_session_renegotiate_callback_set(NX_SECURE_TLS_SESSION *tls_session,
                                                     ULONG (*func_ptr)(NX_SECURE_TLS_SESSION *session));
 UINT nx_secure_tls_session_reset(NX_SECURE_TLS_SESSION *tls_session);
 UINT nx_secure_tls_session_send(NX_SECURE_TLS_SESSION *tls_session, NX_PACKET *packet_ptr,
                                 ULONG wait_option);
+#ifdef NX_SECURE_TLS_ENABLE_SEND_COALESCING
+UINT nx_secure_tls_session_send_coalesce_set(NX_SECURE_TLS_SESSION *tls_session, ULONG threshold,
+                                             ULONG timeout);
+UINT nx_secure_tls_session_send_flush(NX_SECURE_TLS_SESSION *tls_session, ULONG wait_option);
+#endif /* NX_SECURE_TLS_ENABLE_SEND_COALESCING */
 UINT nx_secure_tls_session_server_callback_set(NX_SECURE_TLS_SESSION *tls_session,
                                                ULONG (*func_ptr)(NX_SECURE_TLS_SESSION *tls_session,
                                                                  NX_SECURE_TLS_HELLO_EXTENSION *extensions,
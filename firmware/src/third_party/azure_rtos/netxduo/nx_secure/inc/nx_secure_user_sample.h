@@ -108,6 +108,25 @@
    #define NX_SECURE_AEAD_CIPHER_CHECK(a) NX_FALSE
 */
 
+/* NX_SECURE_AEAD_CIPHER_PARTIAL_BLOCK_CHECK lists the AEAD algorithms whose update operation accepts
+   data that does not end on a block boundary. TLS records in chained packets are passed to these
+   ciphers one packet at a time. By default it covers AES-CCM, AES-GCM and ChaCha20-Poly1305 as
+   implemented in NetX Crypto. Define it as NX_FALSE if these algorithms are replaced by
+   implementations that need whole blocks. */
+/*
+   #define NX_SECURE_AEAD_CIPHER_PARTIAL_BLOCK_CHECK(a) NX_FALSE
+*/
+
+/* NX_SECURE_AEAD_CIPHER_IN_PLACE_CHECK lists the AEAD algorithms whose decrypt operation accepts
+   the same buffer for input and output. Application data records that lie within one received
+   packet are decrypted in place, and returned in that packet without a copy.
+   By default it covers AES-CCM, AES-GCM and ChaCha20-Poly1305 as implemented in NetX Crypto.
+   Define it as NX_FALSE if these algorithms are replaced by implementations that cannot
+   decrypt in place. */
+/*
+   #define NX_SECURE_AEAD_CIPHER_IN_PLACE_CHECK(a) NX_FALSE
+*/
+
 /* NX_SECURE_ALLOW_SELF_SIGNED_CERTIFICATES enables self signed certificates. By default
    this feature is not enabled. */
 /*
@@ -282,6 +301,40 @@
    #define NX_SECURE_TLS_USE_SCSV_CIPHPERSUITE
 */
 
+/* NX_SECURE_TLS_ENABLE_CLIENT_SESSION_CACHE enables TLS 1.2 client session resumption using
+   session IDs kept in an application-supplied cache (nx_secure_tls_session_cache_create).
+   Entries are dropped after NX_SECURE_TLS_SESSION_CACHE_LIFETIME seconds when a time function
+   is set on the session. With TLS 1.3 enabled, the cache also keeps session tickets of up to
+   NX_SECURE_TLS_SESSION_CACHE_TICKET_SIZE bytes (default 256) for PSK resumption.
+   By default this feature is not enabled. */
+/*
+   #define NX_SECURE_TLS_ENABLE_CLIENT_SESSION_CACHE
+*/
+
+/* NX_SECURE_TLS_ENABLE_SEND_COALESCING allows small application sends on a TLS session to be
+   held back and sent together in one record (nx_secure_tls_session_send_coalesce_set). Held
+   data is sent once the size threshold is reached, with the next send after the timeout, or by
+   nx_secure_tls_session_send_flush. The timeout is checked on the next send only; no timer runs,
+   so data held on an idle session stays held until it is flushed. The MQTT client flushes after
+   each request it sends, and once for the acknowledgements and retransmissions sent while
+   processing received packets.
+   By default this feature is not enabled. */
+/*
+   #define NX_SECURE_TLS_ENABLE_SEND_COALESCING
+*/
+
+/* NX_SECURE_TLS_ENABLE_RECORD_SIZE_LIMIT allows a TLS session to negotiate smaller records with the
+   remote host, for devices with small receive buffers. With a limit set by
+   nx_secure_tls_session_record_size_limit_set, a client offers the record_size_limit (RFC 8449) and
+   max_fragment_length (RFC 6066) extensions, and a server replies to either. Larger application data
+   is then sent in several records, and larger application data records received are rejected; the
+   handshake messages sent are not split. The negotiated sizes are returned by
+   nx_secure_tls_session_record_size_limit_get.
+   By default this feature is not enabled. */
+/*
+   #define NX_SECURE_TLS_ENABLE_RECORD_SIZE_LIMIT
+*/
+
 /* NX_SECURE_TLS_DISABLE_SECURE_RENEGOTIATION disables secure session renegotiation extension (RFC 5746).
    By default this feature is enabled. */
 /*
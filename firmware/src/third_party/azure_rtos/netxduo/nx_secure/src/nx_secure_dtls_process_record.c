@@ -177,8 +177,8 @@ NX_PACKET             *decrypted_packet;
 
         /* Decrypt the record data. */
         status = _nx_secure_tls_record_payload_decrypt(tls_session, packet_ptr, header_length, message_length,
-                                                       &decrypted_packet, (ULONG *)epoch_seq_num, (UCHAR)message_type,
-                                                       wait_option);
+                                                       &decrypted_packet, NX_NULL, NX_NULL, (ULONG *)epoch_seq_num,
+                                                       (UCHAR)message_type, wait_option);
 
         /* Check the MAC hash. */
         if (status == NX_SECURE_TLS_SUCCESS)
@@ -310,6 +310,14 @@ const UCHAR    *server_random;
             status = _nx_secure_tls_process_encrypted_extensions(tls_session, packet_buffer, message_length);
             break;
         case NX_SECURE_TLS_CERTIFICATE_MSG:
+#ifdef NX_SECURE_TLS_ENABLE_CLIENT_SESSION_CACHE
+            /* A session resumed with a ticket has no server Certificate. */
+            if (tls_session -> nx_secure_tls_session_resumed)
+            {
+                break;
+            }
+#endif /* NX_SECURE_TLS_ENABLE_CLIENT_SESSION_CACHE */
+
             /* Server has sent its certificate message. */
             status = _nx_secure_tls_process_remote_certificate(tls_session, packet_buffer, message_length, packet_buffer_length);
 
@@ -336,6 +344,13 @@ const UCHAR    *server_random;
             status = _nx_secure_tls_process_certificate_request(tls_session, packet_buffer, message_length);
             break;
         case NX_SECURE_TLS_FINISHED:
+#ifdef NX_SECURE_TLS_ENABLE_CLIENT_SESSION_CACHE
+            /* Only a session resumed with a ticket lets the server finish without authenticating itself. */
+            if (!tls_session -> nx_secure_tls_received_remote_credentials)
+            {
+                break;
+            }
+#endif /* NX_SECURE_TLS_ENABLE_CLIENT_SESSION_CACHE */
 
             /* Save the transcript hash to this point for processing Finished. */
             status = _nx_secure_tls_1_3_transcript_hash_save(tls_session, NX_SECURE_TLS_TRANSCRIPT_IDX_SERVER_FINISHED, NX_TRUE);
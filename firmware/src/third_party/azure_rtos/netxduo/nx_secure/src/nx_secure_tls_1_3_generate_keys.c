@@ -115,6 +115,14 @@ UINT is_resumption_psk = NX_FALSE;
     psk_secret = (UCHAR *)psk_entry->nx_secure_tls_psk_data;
     psk_secret_length = psk_entry->nx_secure_tls_psk_data_size;
 
+#ifdef NX_SECURE_TLS_ENABLE_CLIENT_SESSION_CACHE
+    /* The PSK of a cached session ticket is a resumption PSK. */
+    if (psk_entry == &(tls_session -> nx_secure_tls_session_cache_psk))
+    {
+        is_resumption_psk = NX_TRUE;
+    }
+#endif /* NX_SECURE_TLS_ENABLE_CLIENT_SESSION_CACHE */
+
     NX_SECURE_MEMSET(_nx_secure_tls_zeroes, 0, sizeof(_nx_secure_tls_zeroes));
 
     /* Perform an HKDF-Extract to get the "early secret". */
@@ -884,6 +892,16 @@ UINT is_resumption_psk = NX_FALSE;
         psk_secret_length = tls_session->nx_secure_tls_credentials.nx_secure_tls_client_psk.nx_secure_tls_psk_data_size;
     }
 
+#ifdef NX_SECURE_TLS_ENABLE_CLIENT_SESSION_CACHE
+    /* The server accepted the session ticket we offered, so the handshake is keyed with its PSK. */
+    if (tls_session -> nx_secure_tls_session_resumed)
+    {
+        psk_secret = tls_session -> nx_secure_tls_session_cache_psk.nx_secure_tls_psk_data;
+        psk_secret_length = tls_session -> nx_secure_tls_session_cache_psk.nx_secure_tls_psk_data_size;
+        is_resumption_psk = NX_TRUE;
+    }
+#endif /* NX_SECURE_TLS_ENABLE_CLIENT_SESSION_CACHE */
+
     NX_SECURE_MEMSET(_nx_secure_tls_zeroes, 0, sizeof(_nx_secure_tls_zeroes));
     
     if(secrets->tls_early_secret_len == 0)
@@ -222,6 +222,75 @@ const NX_CRYPTO_METHOD
             /* Final handshake message from the server, process it (verify the server handshake hash). */
             status = _nx_secure_tls_process_finished(tls_session, packet_buffer, message_length);
 
+#ifdef NX_SECURE_TLS_ENABLE_CLIENT_SESSION_CACHE
+            if (tls_session -> nx_secure_tls_session_resumed)
+            {
+
+                /* In an abbreviated handshake the server Finished comes first. Our own Finished covers it,
+                   so hash it and answer with our ChangeCipherSpec and Finished before the handshake hash
+                   is cleaned up below. */
+                if (status == NX_SUCCESS)
+                {
+                    status = _nx_secure_tls_handshake_hash_update(tls_session, packet_start, message_length + header_bytes);
+                }
+
+                if (status == NX_SUCCESS)
+                {
+
+                    /* Release the protection before suspending on nx_packet_allocate. */
+                    tx_mutex_put(&_nx_secure_tls_protection);
+
+                    status = _nx_secure_tls_packet_allocate(tls_session, packet_pool, &send_packet, wait_option);
+
+                    /* Get the protection after nx_packet_allocate. */
+                    tx_mutex_get(&_nx_secure_tls_protection, TX_WAIT_FOREVER);
+                }
+
+                if (status == NX_SUCCESS)
+                {
+
+                    /* ChangeCipherSpec is NOT a handshake message, so send as a normal TLS record. */
+                    _nx_secure_tls_send_changecipherspec(tls_session, send_packet);
+
+                    status = _nx_secure_tls_send_record(tls_session, send_packet, NX_SECURE_TLS_CHANGE_CIPHER_SPEC, wait_option);
+
+                    if (status != NX_SUCCESS)
+                    {
+
+                        /* Release packet on send error. */
+                        nx_secure_tls_packet_release(send_packet);
+                    }
+                }
+
+                if (status == NX_SUCCESS)
+                {
+
+                    /* Reset the sequence number now that we are starting a new session. */
+                    NX_SECURE_MEMSET(tls_session -> nx_secure_tls_local_sequence_number, 0, sizeof(tls_session -> nx_secure_tls_local_sequence_number));
+
+                    /* Set our local session keys since we are sent a CCS message. */
+                    _nx_secure_tls_session_keys_set(tls_session, NX_SECURE_TLS_KEY_SET_LOCAL);
+
+                    status = _nx_secure_tls_allocate_handshake_packet(tls_session, packet_pool, &send_packet, wait_option);
+                }
+
+                if (status == NX_SUCCESS)
+                {
+
+                    /* Generate and send the finished message, which completes the handshake. */
+                    _nx_secure_tls_send_finished(tls_session, send_packet);
+
+                    status = _nx_secure_tls_send_handshake_record(tls_session, send_packet, NX_SECURE_TLS_FINISHED, wait_option);
+                }
+            }
+            else if (status == NX_SUCCESS)
+            {
+
+                /* The full handshake is complete, save the session so the next connection can resume it. */
+                _nx_secure_tls_session_cache_store(tls_session);
+            }
+#endif /* NX_SECURE_TLS_ENABLE_CLIENT_SESSION_CACHE */
+
             /* For client, cleanup hash handler after received the finished message from server. */
             /* NOTE: we want to run all of the nx_crypto_cleanup calls regardless of the status of the finished processing above
                      so use a secondary status to track their return status values. */
@@ -315,6 +384,14 @@ const NX_CRYPTO_METHOD
             error_number = status;
             _nx_secure_tls_map_error_to_alert(error_number, &alert_number, &alert_level);
 
+#ifdef NX_SECURE_TLS_ENABLE_CLIENT_SESSION_CACHE
+            /* Do not offer the cached session again after a failed handshake. */
+            if (tls_session -> nx_secure_tls_session_cache_ciphersuite != 0)
+            {
+                _nx_secure_tls_session_cache_remove(tls_session);
+            }
+#endif /* NX_SECURE_TLS_ENABLE_CLIENT_SESSION_CACHE */
+
             /* Release the protection before suspending on nx_packet_allocate. */
             tx_mutex_put(&_nx_secure_tls_protection);
 
@@ -417,6 +494,15 @@ const NX_CRYPTO_METHOD
 
                 _nx_secure_tls_handshake_hash_update(tls_session, packet_start, message_length + header_bytes);
             }
+
+#ifdef NX_SECURE_TLS_ENABLE_CLIENT_SESSION_CACHE
+            /* The server resumed our cached session. The session keys come from the cached master secret
+               and the new random values, and must be ready for the server ChangeCipherSpec that follows. */
+            if (tls_session -> nx_secure_tls_session_resumed)
+            {
+                status = _nx_secure_tls_generate_keys(tls_session);
+            }
+#endif /* NX_SECURE_TLS_ENABLE_CLIENT_SESSION_CACHE */
             break;
         case NX_SECURE_TLS_CLIENT_STATE_SERVER_CERTIFICATE:
             /* Processed a server certificate above. Here, we extract the public key and do any verification
@@ -602,6 +688,14 @@ const NX_CRYPTO_METHOD
             error_number = status;
             _nx_secure_tls_map_error_to_alert(error_number, &alert_number, &alert_level);
 
+#ifdef NX_SECURE_TLS_ENABLE_CLIENT_SESSION_CACHE
+            /* Do not offer the cached session again after a failed handshake. */
+            if (tls_session -> nx_secure_tls_session_cache_ciphersuite != 0)
+            {
+                _nx_secure_tls_session_cache_remove(tls_session);
+            }
+#endif /* NX_SECURE_TLS_ENABLE_CLIENT_SESSION_CACHE */
+
             /* Release the protection before suspending on nx_packet_allocate. */
             tx_mutex_put(&_nx_secure_tls_protection);
 
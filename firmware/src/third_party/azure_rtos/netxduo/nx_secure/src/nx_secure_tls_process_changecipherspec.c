@@ -101,6 +101,18 @@ UINT status = NX_SUCCESS;
         }
 #endif
 #ifndef NX_SECURE_TLS_CLIENT_DISABLED
+#ifdef NX_SECURE_TLS_ENABLE_CLIENT_SESSION_CACHE
+        /* In an abbreviated handshake the server sends its ChangeCipherSpec right after the ServerHello. */
+        if (tls_session -> nx_secure_tls_socket_type == NX_SECURE_TLS_SESSION_TYPE_CLIENT &&
+            tls_session -> nx_secure_tls_session_resumed)
+        {
+            if (tls_session -> nx_secure_tls_client_state != NX_SECURE_TLS_CLIENT_STATE_SERVERHELLO)
+            {
+                return(NX_SECURE_TLS_UNEXPECTED_MESSAGE);
+            }
+        }
+        else
+#endif /* NX_SECURE_TLS_ENABLE_CLIENT_SESSION_CACHE */
         if (tls_session -> nx_secure_tls_socket_type == NX_SECURE_TLS_SESSION_TYPE_CLIENT &&
             tls_session -> nx_secure_tls_client_state != NX_SECURE_TLS_CLIENT_STATE_SERVERHELLO_DONE)
         {
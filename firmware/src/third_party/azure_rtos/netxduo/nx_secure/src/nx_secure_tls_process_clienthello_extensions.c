@@ -88,6 +88,8 @@ static UINT _nx_secure_tls_process_clienthello_psk_extension(NX_SECURE_TLS_SESSI
 /*    _nx_secure_tls_proc_clienthello_ec_point_formats_extension          */
 /*                                          Process ClientHello           */
 /*                                            EC point formats extension  */
+/*    _nx_secure_tls_process_record_size_extension                        */
+/*                                          Process record size extension */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -227,9 +229,25 @@ USHORT supported_version = tls_session -> nx_secure_tls_protocol_version;
 #endif
 #endif
 
+#ifdef NX_SECURE_TLS_ENABLE_RECORD_SIZE_LIMIT
+        case NX_SECURE_TLS_EXTENSION_MAX_FRAGMENT_LENGTH:
+        case NX_SECURE_TLS_EXTENSION_RECORD_SIZE_LIMIT:
+            /* Save the client's limit for the reply in ServerHello or EncryptedExtensions. */
+            status = _nx_secure_tls_process_record_size_extension(tls_session, extension_id,
+                                                                  &packet_buffer[offset], extension_length);
+
+            if (status)
+            {
+                return(status);
+            }
+            break;
+#endif /* NX_SECURE_TLS_ENABLE_RECORD_SIZE_LIMIT */
+
         case NX_SECURE_TLS_EXTENSION_SIGNATURE_ALGORITHMS:
         case NX_SECURE_TLS_EXTENSION_SERVER_NAME_INDICATION:
+#ifndef NX_SECURE_TLS_ENABLE_RECORD_SIZE_LIMIT
         case NX_SECURE_TLS_EXTENSION_MAX_FRAGMENT_LENGTH:
+#endif /* NX_SECURE_TLS_ENABLE_RECORD_SIZE_LIMIT */
         case NX_SECURE_TLS_EXTENSION_CLIENT_CERTIFICATE_URL:
         case NX_SECURE_TLS_EXTENSION_TRUSTED_CA_INDICATION:
         case NX_SECURE_TLS_EXTENSION_CERTIFICATE_STATUS_REQUEST:
@@ -882,9 +900,18 @@ NX_SECURE_TLS_ECC *ecc_info;
       so don't advance the offset! */
     legacy_form = pubkey[0];
 
-    if(legacy_form != 0x4)
+    if (key_group == (USHORT)NX_CRYPTO_EC_X25519)
+    {
+
+        /* X25519 key shares are the bare 32-byte u-coordinate (RFC 8446, section 4.2.8.2). */
+        if (key_length != 32)
+        {
+            return(NX_SECURE_TLS_BAD_CLIENTHELLO_KEYSHARE);
+        }
+    }
+    else if(legacy_form != 0x4)
     {
-        /* In TLS 1.3, the only valid form is 0x4. */
+        /* In TLS 1.3, the only valid form for the NIST curves is 0x4. */
         return(NX_SECURE_TLS_BAD_CLIENTHELLO_KEYSHARE);
     }
 
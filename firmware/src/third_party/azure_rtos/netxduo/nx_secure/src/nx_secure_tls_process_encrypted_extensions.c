@@ -53,6 +53,10 @@
 /*  CALLS                                                                 */
 /*                                                                        */
 /*    _nx_secure_tls_ciphersuite_lookup     Lookup current ciphersuite    */
+/*    _nx_secure_tls_process_record_size_extension                        */
+/*                                          Process record size extension */
+/*    _nx_secure_tls_record_size_limit_update                             */
+/*                                          Set negotiated record limits  */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -71,13 +75,72 @@
 UINT _nx_secure_tls_process_encrypted_extensions(NX_SECURE_TLS_SESSION *tls_session,
                                                  UCHAR *packet_buffer, UINT message_length)
 {
-UINT status;
+UINT   status;
+#if defined(NX_SECURE_TLS_ENABLE_RECORD_SIZE_LIMIT) && !defined(NX_SECURE_TLS_CLIENT_DISABLED)
+UINT   offset;
+UINT   extension_length;
+USHORT extension_id;
+#endif /* NX_SECURE_TLS_ENABLE_RECORD_SIZE_LIMIT && !NX_SECURE_TLS_CLIENT_DISABLED */
 
     status = NX_SUCCESS;
 
+#if defined(NX_SECURE_TLS_ENABLE_RECORD_SIZE_LIMIT) && !defined(NX_SECURE_TLS_CLIENT_DISABLED)
+    /* The extensions list is preceded by its 16-bit length. */
+    if (message_length < 2)
+    {
+        return(NX_SECURE_TLS_INCORRECT_MESSAGE_LENGTH);
+    }
+
+    extension_length = (UINT)((packet_buffer[0] << 8) + packet_buffer[1]);
+    if ((extension_length + 2) > message_length)
+    {
+        return(NX_SECURE_TLS_INCORRECT_MESSAGE_LENGTH);
+    }
+    message_length = extension_length + 2;
+    offset = 2;
+
+    /* Process the server's reply to the record size extensions and ignore any others. */
+    while (offset < message_length)
+    {
+        if ((offset + 4) > message_length)
+        {
+            return(NX_SECURE_TLS_INCORRECT_MESSAGE_LENGTH);
+        }
+
+        extension_id = (USHORT)((packet_buffer[offset] << 8) + packet_buffer[offset + 1]);
+        extension_length = (UINT)((packet_buffer[offset + 2] << 8) + packet_buffer[offset + 3]);
+        offset += 4;
+
+        if ((offset + extension_length) > message_length)
+        {
+            return(NX_SECURE_TLS_INCORRECT_MESSAGE_LENGTH);
+        }
+
+        if ((extension_id == NX_SECURE_TLS_EXTENSION_RECORD_SIZE_LIMIT) ||
+            (extension_id == NX_SECURE_TLS_EXTENSION_MAX_FRAGMENT_LENGTH))
+        {
+            status = _nx_secure_tls_process_record_size_extension(tls_session, extension_id,
+                                                                  &packet_buffer[offset], extension_length);
+            if (status != NX_SUCCESS)
+            {
+                return(status);
+            }
+        }
+
+        offset += extension_length;
+    }
+
+    /* The version is known, so the negotiated limits can be set. */
+    status = _nx_secure_tls_record_size_limit_update(tls_session);
+    if (status != NX_SUCCESS)
+    {
+        return(status);
+    }
+#else
     /* Process encrypted extensions here! */
     NX_PARAMETER_NOT_USED(packet_buffer);
     NX_PARAMETER_NOT_USED(message_length);
+#endif /* NX_SECURE_TLS_ENABLE_RECORD_SIZE_LIMIT && !NX_SECURE_TLS_CLIENT_DISABLED */
 
 #ifndef NX_SECURE_TLS_CLIENT_DISABLED
 
@@ -44,7 +44,8 @@
 /*  INPUT                                                                 */
 /*                                                                        */
 /*    tls_session                           TLS control block             */
-/*    send_packet                           Packet used to send message   */
+/*    packet_buffer                         Pointer to message data       */
+/*    message_length                        Length of message data (bytes)*/
 /*                                                                        */
 /*  OUTPUT                                                                */
 /*                                                                        */
@@ -52,11 +53,14 @@
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
-/*    N/A                                                                 */
+/*    _nx_secure_tls_1_3_session_psk_generate                             */
+/*                                          Generate the ticket PSK       */
+/*    _nx_secure_tls_session_cache_ticket_store                           */
+/*                                          Save the session ticket       */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
-/*    _nx_secure_tls_client_handshake       TLS client state machine      */
+/*    _nx_secure_tls_process_record         Process TLS record            */
 /*                                                                        */
 /*  RELEASE HISTORY                                                       */
 /*                                                                        */
@@ -75,11 +79,15 @@ UINT _nx_secure_tls_process_newsessionticket(NX_SECURE_TLS_SESSION *tls_session,
 {
 UINT             status = NX_SUCCESS;
 UINT             lifetime;
-UINT             nonce;
+UINT             age_add;
+UCHAR           *nonce;
 UINT             nonce_len;
 UINT             ticket_len;
 UCHAR            *ticket;
+UINT             length;
+#ifndef NX_SECURE_TLS_ENABLE_CLIENT_SESSION_CACHE
 UINT             psk_count;
+#endif /* NX_SECURE_TLS_ENABLE_CLIENT_SESSION_CACHE */
 NX_SECURE_TLS_PSK_STORE *ticket_psk;
 
     /* From RFC 8446:
@@ -145,6 +153,11 @@ NX_SECURE_TLS_PSK_STORE *ticket_psk;
 
     */
 
+#ifdef NX_SECURE_TLS_ENABLE_CLIENT_SESSION_CACHE
+    /* The ticket is saved in the session cache. Generate its PSK in the PSK store used for
+       offering tickets, which is not needed once the handshake is complete. */
+    ticket_psk = &(tls_session -> nx_secure_tls_session_cache_psk);
+#else
     /* Get a PSK entry into which we can copy the ticket data we received. */
     psk_count = tls_session->nx_secure_tls_credentials.nx_secure_tls_psk_count;
     psk_count++;
@@ -153,11 +166,16 @@ NX_SECURE_TLS_PSK_STORE *ticket_psk;
         psk_count = 0;
     }
     ticket_psk = &(tls_session->nx_secure_tls_credentials.nx_secure_tls_psk_store[psk_count]);
+#endif /* NX_SECURE_TLS_ENABLE_CLIENT_SESSION_CACHE */
 
+    /* Lifetime, age add and the nonce length field are fixed size. */
+    if (message_length < 9)
+    {
+        return(NX_SECURE_TLS_INCORRECT_MESSAGE_LENGTH);
+    }
 
-    /* First, the ticket lifetime in ms - 604800 is the maximum. */
+    /* First, the ticket lifetime in seconds - 604800 is the maximum. */
     lifetime = (UINT)((packet_buffer[0] << 24) + (packet_buffer[1] << 16) + (packet_buffer[2] << 8) + packet_buffer[3]);
-    packet_buffer = &packet_buffer[4];
 
     if(lifetime > NX_SECURE_TLS_MAX_SESSION_TICKET_AGE)
     {
@@ -167,40 +185,61 @@ NX_SECURE_TLS_PSK_STORE *ticket_psk;
     /* Save the lifetime of the ticket. */
     ticket_psk->nx_secure_tls_psk_ticket_lifetime = lifetime;
 
-    /* Skip the age add value. */
-    packet_buffer = &packet_buffer[4];
+    /* The age add value obfuscates the ticket age sent when the ticket is offered. */
+    age_add = (UINT)((packet_buffer[4] << 24) + (packet_buffer[5] << 16) + (packet_buffer[6] << 8) + packet_buffer[7]);
 
     /* Get the nonce length. */
-    nonce_len = packet_buffer[0];
-    packet_buffer = &packet_buffer[1];
+    nonce_len = packet_buffer[8];
+    length = 9;
 
     /* Get the nonce. */
-    if(nonce_len > message_length || nonce_len > NX_SECURE_TLS_MAX_PSK_NONCE_SIZE)
+    if((length + nonce_len + 2) > message_length)
     {
-        return(NX_SECURE_TLS_INVALID_SESSION_TICKET);
+        return(NX_SECURE_TLS_INCORRECT_MESSAGE_LENGTH);
     }
-    nonce = (UINT)((packet_buffer[0] << 24) + (packet_buffer[1] << 16) + (packet_buffer[2] << 8) + packet_buffer[3]);;
-    packet_buffer = &packet_buffer[nonce_len];
+    nonce = &packet_buffer[length];
+    length += nonce_len;
 
     /* Now for the ticket ID itself. 16-bit length with the ticket being a label
        used as the PSK identity. */
-    ticket_len = (USHORT)((packet_buffer[0] << 8) + packet_buffer[1]);
-    packet_buffer = &packet_buffer[2];
-    ticket =  (UCHAR *)(&packet_buffer[0]);
+    ticket_len = (USHORT)((packet_buffer[length] << 8) + packet_buffer[length + 1]);
+    length += 2;
+    ticket =  (UCHAR *)(&packet_buffer[length]);
+
+    if((ticket_len == 0) || ((length + ticket_len) > message_length))
+    {
+        return(NX_SECURE_TLS_INCORRECT_MESSAGE_LENGTH);
+    }
+
+    /* We can now generate the PSK for this session using our ticket nonce and the cryptographic
+       secrets we created earlier in the handshake. */
+    status = _nx_secure_tls_1_3_session_psk_generate(tls_session, ticket_psk, nonce, nonce_len);
 
-    if(ticket_len > message_length || ticket_len > NX_SECURE_TLS_MAX_PSK_ID_SIZE)
+    if(status != NX_SUCCESS)
+    {
+        return(status);
+    }
+
+#ifdef NX_SECURE_TLS_ENABLE_CLIENT_SESSION_CACHE
+    /* Save the ticket so the next connection to this server can resume the session. */
+    status = _nx_secure_tls_session_cache_ticket_store(tls_session, lifetime, age_add, ticket, ticket_len,
+                                                       ticket_psk -> nx_secure_tls_psk_data,
+                                                       ticket_psk -> nx_secure_tls_psk_data_size);
+
+    /* Clear the PSK now that it is saved. */
+    NX_SECURE_MEMSET(ticket_psk, 0, sizeof(NX_SECURE_TLS_PSK_STORE));
+#else
+    NX_PARAMETER_NOT_USED(age_add);
+
+    if(ticket_len > NX_SECURE_TLS_MAX_PSK_ID_SIZE)
     {
         return(NX_SECURE_TLS_INVALID_SESSION_TICKET);
     }
-    packet_buffer = &packet_buffer[ticket_len];
 
     /* Copy ticket to PSK store - the ticket is the PSK ID used to identify the PSK in the future. */
     NX_SECURE_MEMCPY(ticket_psk->nx_secure_tls_psk_id, ticket, ticket_len); /* Use case of memcpy is verified. */
     ticket_psk->nx_secure_tls_psk_id_size = ticket_len;
-
-    /* We can now generate the PSK for this session using our ticket nonce and the cryptographic
-       secrets we created earlier in the handshake. */
-    status = _nx_secure_tls_1_3_session_psk_generate(tls_session, ticket_psk, (UCHAR *)nonce, nonce_len);
+#endif /* NX_SECURE_TLS_ENABLE_CLIENT_SESSION_CACHE */
 
     return(status);
 }
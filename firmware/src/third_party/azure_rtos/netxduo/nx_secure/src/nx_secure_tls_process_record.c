@@ -25,6 +25,9 @@
 #include "nx_secure_tls.h"
 
 static VOID _nx_secure_tls_packet_trim(NX_PACKET *packet_ptr);
+static NX_PACKET *_nx_secure_tls_record_queue_detach(NX_SECURE_TLS_SESSION *tls_session, ULONG plaintext_offset,
+                                                     UINT plaintext_length, ULONG record_end,
+                                                     ULONG *bytes_processed);
 
 /**************************************************************************/
 /*                                                                        */
@@ -61,6 +64,8 @@ static VOID _nx_secure_tls_packet_trim(NX_PACKET *packet_ptr);
 /*                                          Process ChangeCipherSpec      */
 /*    _nx_secure_tls_process_header         Process record header         */
 /*    _nx_secure_tls_record_payload_decrypt Decrypt record data           */
+/*    _nx_secure_tls_record_queue_detach    Detach record decrypted in    */
+/*                                            place from record queue     */
 /*    _nx_secure_tls_server_handshake       TLS Server state machine      */
 /*    _nx_secure_tls_verify_mac             Verify record MAC checksum    */
 /*    nx_packet_allocate                    NetX Packet allocation call   */
@@ -110,6 +115,16 @@ UCHAR     *packet_data = NX_NULL;
 ULONG      record_offset = 0;
 ULONG      record_offset_next = 0;
 NX_PACKET *decrypted_packet;
+ULONG      plaintext_offset;
+UINT       plaintext_length;
+UINT      *in_place_length;
+UINT       decrypted_in_place;
+#if (NX_SECURE_TLS_TLS_1_3_ENABLED) && !defined(NX_SECURE_TLS_CLIENT_DISABLED) && defined(NX_SECURE_TLS_ENABLE_CLIENT_SESSION_CACHE)
+USHORT     handshake_type;
+UINT       handshake_header_size;
+UINT       handshake_length;
+UINT       handshake_offset;
+#endif
 
     /* Basic state machine:
      * 1. Process header, which will set the state and return some data.
@@ -195,6 +210,7 @@ NX_PACKET *decrypted_packet;
             tls_session -> nx_secure_record_decrypted_packet = NX_NULL;
         }
         decrypted_packet = NX_NULL;
+        decrypted_in_place = NX_FALSE;
 
         /* Retrieve the saved record offset when more TCP packet is received for this one record. */
         if (tls_session -> nx_secure_tls_record_offset)
@@ -264,9 +280,37 @@ NX_PACKET *decrypted_packet;
                 }
             }
 
+            /* An application data record that fills the end of the last packet in the queue may be
+               decrypted in place, since that packet can then be taken off the queue and returned as
+               it is. Records received during the handshake are always decrypted into a new packet,
+               which the handshake expects to be handed back. */
+            in_place_length = NX_NULL;
+            if ((message_type == NX_SECURE_TLS_APPLICATION_DATA) &&
+                (record_offset_next == packet_ptr -> nx_packet_length) &&
+                ((ULONG)(packet_ptr -> nx_packet_last -> nx_packet_append_ptr -
+                         packet_ptr -> nx_packet_last -> nx_packet_prepend_ptr) >= message_length))
+            {
+#ifndef NX_SECURE_TLS_CLIENT_DISABLED
+                if ((tls_session -> nx_secure_tls_socket_type == NX_SECURE_TLS_SESSION_TYPE_CLIENT) &&
+                    (tls_session -> nx_secure_tls_client_state == NX_SECURE_TLS_CLIENT_STATE_HANDSHAKE_FINISHED))
+                {
+                    in_place_length = &plaintext_length;
+                }
+#endif /* NX_SECURE_TLS_CLIENT_DISABLED */
+
+#ifndef NX_SECURE_TLS_SERVER_DISABLED
+                if ((tls_session -> nx_secure_tls_socket_type == NX_SECURE_TLS_SESSION_TYPE_SERVER) &&
+                    (tls_session -> nx_secure_tls_server_state == NX_SECURE_TLS_SERVER_STATE_HANDSHAKE_FINISHED))
+                {
+                    in_place_length = &plaintext_length;
+                }
+#endif /* NX_SECURE_TLS_SERVER_DISABLED */
+            }
+
             /* Decrypt the record data. */
             status = _nx_secure_tls_record_payload_decrypt(tls_session, packet_ptr, record_offset,
                                                            message_length, &decrypted_packet,
+                                                           &plaintext_offset, in_place_length,
                                                            tls_session -> nx_secure_tls_remote_sequence_number,
                                                            (UCHAR)message_type, wait_option);
 
@@ -279,6 +323,14 @@ NX_PACKET *decrypted_packet;
                 /* Save off the error status so we can return it after the mac check. */
                 error_status = status;
             }
+            else if (decrypted_packet == NX_NULL)
+            {
+
+                /* The plaintext is in the record queue, where the cipher text was. */
+                decrypted_in_place = NX_TRUE;
+                record_offset = plaintext_offset;
+                message_length = plaintext_length;
+            }
             else
             {
 
@@ -299,9 +351,18 @@ NX_PACKET *decrypted_packet;
                     /* In TLS 1.3, encrypted records have a single byte at the
                     record that contains the message type (e.g. application data,
                     ect.), which is now the ACTUAL message type. */
-                    status = nx_packet_data_extract_offset(decrypted_packet,
-                                                           decrypted_packet -> nx_packet_length - 1,
-                                                           &message_type, 1, &bytes_copied);
+                    if (decrypted_in_place)
+                    {
+                        status = nx_packet_data_extract_offset(packet_ptr,
+                                                               record_offset + message_length - 1,
+                                                               &message_type, 1, &bytes_copied);
+                    }
+                    else
+                    {
+                        status = nx_packet_data_extract_offset(decrypted_packet,
+                                                               decrypted_packet -> nx_packet_length - 1,
+                                                               &message_type, 1, &bytes_copied);
+                    }
                     if (status || (bytes_copied != 1))
                     {
                         error_status = NX_SECURE_TLS_INVALID_PACKET;
@@ -311,7 +372,10 @@ NX_PACKET *decrypted_packet;
                     message_length = message_length - 1;
 
                     /* Adjust packet length. */
-                    decrypted_packet -> nx_packet_length = message_length;
+                    if (!decrypted_in_place)
+                    {
+                        decrypted_packet -> nx_packet_length = message_length;
+                    }
 
                     /* Increment the sequence number. This is done in the MAC verify
                     step for 1.2 and earlier, but AEAD includes the MAC so we don't
@@ -337,6 +401,10 @@ NX_PACKET *decrypted_packet;
                                   padding was valid or not, causing an information leak. */
                     status = _nx_secure_tls_verify_mac(tls_session, header_data, header_length, packet_ptr, record_offset, &message_length);
                 }
+                else if (decrypted_in_place)
+                {
+                    status = _nx_secure_tls_verify_mac(tls_session, header_data, header_length, packet_ptr, record_offset, &message_length);
+                }
                 else
                 {
                     status = _nx_secure_tls_verify_mac(tls_session, header_data, header_length, decrypted_packet, 0, &message_length);
@@ -368,8 +436,21 @@ NX_PACKET *decrypted_packet;
                 return(NX_SECURE_TLS_RECORD_OVERFLOW);
             }
 
+#ifdef NX_SECURE_TLS_ENABLE_RECORD_SIZE_LIMIT
+            /* Application data must also fit the record size negotiated for constrained receive buffers. */
+            if ((message_type == NX_SECURE_TLS_APPLICATION_DATA) &&
+                (tls_session -> nx_secure_tls_record_size_limit_receive != 0) &&
+                (message_length > tls_session -> nx_secure_tls_record_size_limit_receive))
+            {
+                return(NX_SECURE_TLS_RECORD_OVERFLOW);
+            }
+#endif /* NX_SECURE_TLS_ENABLE_RECORD_SIZE_LIMIT */
+
             /* Trim packet. */
-            _nx_secure_tls_packet_trim(decrypted_packet);
+            if (!decrypted_in_place)
+            {
+                _nx_secure_tls_packet_trim(decrypted_packet);
+            }
         }
 
         if (message_type != NX_SECURE_TLS_APPLICATION_DATA)
@@ -433,7 +514,7 @@ NX_PACKET *decrypted_packet;
         case NX_SECURE_TLS_CHANGE_CIPHER_SPEC:
             /* Received a ChangeCipherSpec message - from now on all messages from remote host
                will be encrypted using the session keys. */
-            _nx_secure_tls_process_changecipherspec(tls_session, packet_data, message_length);
+            status = _nx_secure_tls_process_changecipherspec(tls_session, packet_data, message_length);
 
             break;
         case NX_SECURE_TLS_ALERT:
@@ -441,6 +522,14 @@ NX_PACKET *decrypted_packet;
             /* The alert level is the first octet in the alert. The alert number is the second. */
             if(packet_data[0] == NX_SECURE_TLS_ALERT_LEVEL_FATAL)
             {
+#ifdef NX_SECURE_TLS_ENABLE_CLIENT_SESSION_CACHE
+                /* A session terminated by a fatal alert must not be resumed (RFC 5246, Section 7.2.2). */
+                if (tls_session -> nx_secure_tls_socket_type == NX_SECURE_TLS_SESSION_TYPE_CLIENT)
+                {
+                    _nx_secure_tls_session_cache_remove(tls_session);
+                }
+#endif /* NX_SECURE_TLS_ENABLE_CLIENT_SESSION_CACHE */
+
                 /* If we receive a fatal alert, clear all session keys. */
                 _nx_secure_tls_session_reset(tls_session);
             }
@@ -456,6 +545,31 @@ NX_PACKET *decrypted_packet;
             /* TLS 1.3 can send post-handshake messages with TLS HANDSHAKE record type. Process those separately. */
             if(tls_session->nx_secure_tls_1_3 && tls_session -> nx_secure_tls_client_state == NX_SECURE_TLS_CLIENT_STATE_HANDSHAKE_FINISHED)
             {
+#ifdef NX_SECURE_TLS_ENABLE_CLIENT_SESSION_CACHE
+                /* Save the session tickets the server issues so the next connection can resume the session.
+                   Tickets are optional, so one that cannot be processed is simply not saved. */
+                handshake_offset = 0;
+                while ((handshake_offset + NX_SECURE_TLS_HANDSHAKE_HEADER_SIZE) <= message_length)
+                {
+                    status = _nx_secure_tls_process_handshake_header(&packet_data[handshake_offset], &handshake_type,
+                                                                     &handshake_header_size, &handshake_length);
+
+                    if ((status != NX_SUCCESS) ||
+                        ((handshake_offset + handshake_header_size + handshake_length) > message_length))
+                    {
+                        break;
+                    }
+
+                    if (handshake_type == NX_SECURE_TLS_NEW_SESSION_TICKET)
+                    {
+                        _nx_secure_tls_process_newsessionticket(tls_session, &packet_data[handshake_offset + handshake_header_size],
+                                                                handshake_length);
+                    }
+
+                    handshake_offset += handshake_header_size + handshake_length;
+                }
+#endif /* NX_SECURE_TLS_ENABLE_CLIENT_SESSION_CACHE */
+
                 /* Process post-handshake messages. */
                 status = NX_SECURE_TLS_POST_HANDSHAKE_RECEIVED;
                 break;
@@ -555,6 +669,14 @@ NX_PACKET *decrypted_packet;
             }
             else
             {
+                if (decrypted_in_place)
+                {
+
+                    /* Take the packet holding the record off the queue and return the plaintext in it. */
+                    tls_session -> nx_secure_record_decrypted_packet =
+                        _nx_secure_tls_record_queue_detach(tls_session, record_offset, message_length,
+                                                           record_offset_next, bytes_processed);
+                }
                 status = NX_SECURE_TLS_SUCCESS;
             }
             break;
@@ -656,3 +778,83 @@ NX_PACKET *current_ptr;
         message_length -= (ULONG)(current_ptr -> nx_packet_append_ptr - current_ptr -> nx_packet_prepend_ptr);
     }
 }
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_secure_tls_record_queue_detach                  PORTABLE C      */
+/*                                                           6.1          */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function takes the last packet off the record queue after the  */
+/*    record ending it was decrypted in place, and trims the packet down  */
+/*    to the plaintext so it can be returned to the application without   */
+/*    a copy. The bytes processed are reduced by the size of the packet,  */
+/*    so only the packets left in the queue are released by the caller.   */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    tls_session                           TLS control block             */
+/*    plaintext_offset                      Offset of plaintext in queue  */
+/*    plaintext_length                      Length of plaintext           */
+/*    record_end                            Offset of the end of record,  */
+/*                                            which is the queue length   */
+/*    bytes_processed                       Bytes processed in queue      */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    packet_ptr                            Packet holding plaintext      */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_secure_tls_process_record         Process TLS records           */
+/*                                                                        */
+/*                                                                        */
+/**************************************************************************/
+static NX_PACKET *_nx_secure_tls_record_queue_detach(NX_SECURE_TLS_SESSION *tls_session, ULONG plaintext_offset,
+                                                     UINT plaintext_length, ULONG record_end,
+                                                     ULONG *bytes_processed)
+{
+NX_PACKET *queue_header = tls_session -> nx_secure_record_queue_header;
+NX_PACKET *packet_ptr = queue_header -> nx_packet_last;
+NX_PACKET *previous_packet;
+ULONG      packet_length;
+
+    packet_length = (ULONG)(packet_ptr -> nx_packet_append_ptr - packet_ptr -> nx_packet_prepend_ptr);
+
+    if (packet_ptr == queue_header)
+    {
+
+        /* The record was in the only packet, so the queue is now empty. */
+        tls_session -> nx_secure_record_queue_header = NX_NULL;
+    }
+    else
+    {
+
+        /* Unlink the last packet. The packets before it have been processed. */
+        for (previous_packet = queue_header; previous_packet -> nx_packet_next != packet_ptr;
+             previous_packet = previous_packet -> nx_packet_next)
+        {
+        }
+        previous_packet -> nx_packet_next = NX_NULL;
+        queue_header -> nx_packet_last = previous_packet;
+        queue_header -> nx_packet_length -= packet_length;
+    }
+
+    *bytes_processed -= packet_length;
+    tls_session -> nx_secure_tls_bytes_processed = *bytes_processed;
+
+    /* Leave only the plaintext in the packet. */
+    packet_ptr -> nx_packet_prepend_ptr += plaintext_offset - (record_end - packet_length);
+    packet_ptr -> nx_packet_append_ptr = packet_ptr -> nx_packet_prepend_ptr + plaintext_length;
+    packet_ptr -> nx_packet_length = plaintext_length;
+    packet_ptr -> nx_packet_next = NX_NULL;
+    packet_ptr -> nx_packet_last = packet_ptr;
+
+    return(packet_ptr);
+}
@@ -0,0 +1,145 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Secure Component                                                 */
+/**                                                                       */
+/**    Transport Layer Security (TLS)                                     */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SECURE_SOURCE_CODE
+
+#include "nx_secure_tls.h"
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_secure_tls_process_record_size_extension        PORTABLE C      */
+/*                                                           6.1          */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function processes a max_fragment_length (RFC 6066) or         */
+/*    record_size_limit (RFC 8449) extension received in a hello or       */
+/*    EncryptedExtensions message, and saves its value in the TLS         */
+/*    session. A client only accepts the extensions it offered.           */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    tls_session                           TLS control block             */
+/*    extension_id                          Extension type                */
+/*    packet_buffer                         Pointer to extension data     */
+/*    extension_length                      Length of extension data      */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_secure_tls_process_clienthello_extensions                       */
+/*                                          Process ClientHello           */
+/*                                            extensions                  */
+/*    _nx_secure_tls_process_encrypted_extensions                         */
+/*                                          Process EncryptedExtensions   */
+/*    _nx_secure_tls_process_serverhello_extensions                       */
+/*                                          Process ServerHello           */
+/*                                            extensions                  */
+/*                                                                        */
+/*                                                                        */
+/**************************************************************************/
+#ifdef NX_SECURE_TLS_ENABLE_RECORD_SIZE_LIMIT
+UINT _nx_secure_tls_process_record_size_extension(NX_SECURE_TLS_SESSION *tls_session, USHORT extension_id,
+                                                  UCHAR *packet_buffer, UINT extension_length)
+{
+USHORT record_size_limit;
+UCHAR  max_fragment_length;
+UCHAR  offered_length;
+
+    /* The record_size_limit extension holds a 2-byte limit, and the max_fragment_length
+       extension a 1-byte code. */
+    record_size_limit = tls_session -> nx_secure_tls_record_size_limit;
+
+    if (extension_id == NX_SECURE_TLS_EXTENSION_RECORD_SIZE_LIMIT)
+    {
+        if (extension_length != 2)
+        {
+            return(NX_SECURE_TLS_INCORRECT_MESSAGE_LENGTH);
+        }
+
+        /* A server only replies with the extension if the client offered it. */
+        if ((tls_session -> nx_secure_tls_socket_type == NX_SECURE_TLS_SESSION_TYPE_CLIENT) &&
+            (record_size_limit == 0))
+        {
+            return(NX_SECURE_TLS_BAD_RECORD_SIZE_EXTENSION);
+        }
+
+        record_size_limit = (USHORT)((packet_buffer[0] << 8) + packet_buffer[1]);
+
+        if (record_size_limit < NX_SECURE_TLS_RECORD_SIZE_LIMIT_MIN)
+        {
+            return(NX_SECURE_TLS_BAD_RECORD_SIZE_EXTENSION);
+        }
+
+        tls_session -> nx_secure_tls_remote_record_size_limit = record_size_limit;
+    }
+    else
+    {
+        if (extension_length != 1)
+        {
+            return(NX_SECURE_TLS_INCORRECT_MESSAGE_LENGTH);
+        }
+
+        max_fragment_length = packet_buffer[0];
+
+        if ((max_fragment_length < NX_SECURE_TLS_MAX_FRAGMENT_LENGTH_512) ||
+            (max_fragment_length > NX_SECURE_TLS_MAX_FRAGMENT_LENGTH_4096))
+        {
+            return(NX_SECURE_TLS_BAD_RECORD_SIZE_EXTENSION);
+        }
+
+        if (tls_session -> nx_secure_tls_socket_type == NX_SECURE_TLS_SESSION_TYPE_CLIENT)
+        {
+
+            /* The server must echo the length the client asked for (RFC 6066, Section 4), which is the
+               largest length not over the record size limit. */
+            offered_length = 0;
+            if ((record_size_limit >= 512) && (record_size_limit < NX_SECURE_TLS_MAX_PLAINTEXT_LENGTH))
+            {
+                offered_length = NX_SECURE_TLS_MAX_FRAGMENT_LENGTH_512;
+                while ((offered_length < NX_SECURE_TLS_MAX_FRAGMENT_LENGTH_4096) &&
+                       (record_size_limit >= (512u << offered_length)))
+                {
+                    offered_length++;
+                }
+            }
+
+            if (max_fragment_length != offered_length)
+            {
+                return(NX_SECURE_TLS_BAD_RECORD_SIZE_EXTENSION);
+            }
+        }
+
+        tls_session -> nx_secure_tls_remote_max_fragment_length = max_fragment_length;
+    }
+
+    return(NX_SUCCESS);
+}
+#endif /* NX_SECURE_TLS_ENABLE_RECORD_SIZE_LIMIT */
@@ -95,6 +95,9 @@ USHORT                                ciphersuite;
 USHORT                                ciphersuite_priority;
 NX_SECURE_TLS_HELLO_EXTENSION         extension_data[NX_SECURE_TLS_HELLO_EXTENSIONS_MAX];
 UINT                                  num_extensions;
+#ifdef NX_SECURE_TLS_ENABLE_CLIENT_SESSION_CACHE
+UINT                                  session_id_match = NX_FALSE;
+#endif /* NX_SECURE_TLS_ENABLE_CLIENT_SESSION_CACHE */
 #if (NX_SECURE_TLS_TLS_1_3_ENABLED)
 USHORT                                tls_1_3 = tls_session -> nx_secure_tls_1_3;
 NX_SECURE_TLS_SERVER_STATE            old_client_state = tls_session -> nx_secure_tls_client_state;
@@ -167,6 +170,26 @@ NX_SECURE_TLS_SERVER_STATE            old_client_state = tls_session -> nx_secur
     }
     length += NX_SECURE_TLS_RANDOM_SIZE;
 
+#ifdef NX_SECURE_TLS_ENABLE_CLIENT_SESSION_CACHE
+    /* The server resumes the session we offered by echoing its session ID. */
+    if ((tls_session -> nx_secure_tls_session_cache_ciphersuite != 0) &&
+        (packet_buffer[length] == tls_session -> nx_secure_tls_session_id_length) &&
+        ((length + 1 + packet_buffer[length]) <= message_length) &&
+        (NX_SECURE_MEMCMP(tls_session -> nx_secure_tls_session_id, &packet_buffer[length + 1], packet_buffer[length]) == 0))
+    {
+        session_id_match = NX_TRUE;
+    }
+#if (NX_SECURE_TLS_TLS_1_3_ENABLED)
+    else if (tls_session -> nx_secure_tls_1_3)
+    {
+
+        /* A ServerHello negotiating TLS 1.2 is processed again after its session ID has replaced
+           the offered one below. Withdraw the offer now so that the new ID cannot match it then. */
+        tls_session -> nx_secure_tls_session_cache_ciphersuite = 0;
+    }
+#endif /* NX_SECURE_TLS_TLS_1_3_ENABLED */
+#endif /* NX_SECURE_TLS_ENABLE_CLIENT_SESSION_CACHE */
+
     /* Session ID length is one byte. */
     tls_session -> nx_secure_tls_session_id_length = packet_buffer[length];
     length++;
@@ -259,6 +282,28 @@ NX_SECURE_TLS_SERVER_STATE            old_client_state = tls_session -> nx_secur
             }
         }
     }
+#if (NX_SECURE_TLS_TLS_1_3_ENABLED)
+    else if (tls_session -> nx_secure_tls_1_3)
+    {
+
+        /* Without extensions there is no supported_versions extension, so the server negotiates
+           a version of TLS prior to TLS 1.3. A TLS 1.2 server resuming a session does this. */
+        if (tls_session -> nx_secure_tls_protocol_version_override != 0)
+        {
+
+            /* Protocol version is overridden to TLS 1.3. */
+            return(NX_SECURE_TLS_UNSUPPORTED_TLS_VERSION);
+        }
+
+        tls_session -> nx_secure_tls_1_3 = NX_FALSE;
+#ifndef NX_SECURE_TLS_DISABLE_SECURE_RENEGOTIATION
+        tls_session -> nx_secure_tls_renegotation_enabled = NX_TRUE;
+#endif /* NX_SECURE_TLS_DISABLE_SECURE_RENEGOTIATION */
+
+        /* Server negotiates a version of TLS prior to TLS 1.3. */
+        return(NX_SUCCESS);
+    }
+#endif /* NX_SECURE_TLS_TLS_1_3_ENABLED */
 
 #ifndef NX_SECURE_TLS_DISABLE_SECURE_RENEGOTIATION
 #ifdef NX_SECURE_TLS_REQUIRE_RENEGOTIATION_EXT
@@ -292,6 +337,42 @@ NX_SECURE_TLS_SERVER_STATE            old_client_state = tls_session -> nx_secur
     return(NX_SECURE_TLS_INVALID_STATE);
 #else
 
+#ifdef NX_SECURE_TLS_ENABLE_CLIENT_SESSION_CACHE
+#if (NX_SECURE_TLS_TLS_1_3_ENABLED)
+    if (tls_session -> nx_secure_tls_1_3)
+    {
+
+        /* A TLS 1.3 server echoes the legacy session ID without resuming anything. */
+        session_id_match = NX_FALSE;
+
+        /* A server that did not select the session ticket we offered will not accept it later either. */
+        if ((tls_session -> nx_secure_tls_session_cache_psk.nx_secure_tls_psk_data_size != 0) &&
+            (!tls_session -> nx_secure_tls_session_resumed) &&
+            (tls_session -> nx_secure_tls_client_state != NX_SECURE_TLS_CLIENT_STATE_HELLO_RETRY))
+        {
+            _nx_secure_tls_session_cache_remove(tls_session);
+        }
+    }
+#endif /* NX_SECURE_TLS_TLS_1_3_ENABLED */
+
+    if (session_id_match)
+    {
+
+        /* A resumed session keeps the protocol version and ciphersuite it was negotiated with. */
+        if ((version != tls_session -> nx_secure_tls_session_cache_protocol_version) ||
+            (ciphersuite != tls_session -> nx_secure_tls_session_cache_ciphersuite))
+        {
+            return(NX_SECURE_TLS_HANDSHAKE_FAILURE);
+        }
+
+        /* The master secret was restored when the session was offered. The server
+           was authenticated in the handshake that established the session, so no
+           Certificate or key exchange messages follow in the abbreviated handshake. */
+        tls_session -> nx_secure_tls_session_resumed = NX_TRUE;
+        tls_session -> nx_secure_tls_received_remote_credentials = NX_TRUE;
+    }
+#endif /* NX_SECURE_TLS_ENABLE_CLIENT_SESSION_CACHE */
+
 #if (NX_SECURE_TLS_TLS_1_3_ENABLED)
     if ((tls_session -> nx_secure_tls_1_3) && (old_client_state == NX_SECURE_TLS_CLIENT_STATE_IDLE))
     {
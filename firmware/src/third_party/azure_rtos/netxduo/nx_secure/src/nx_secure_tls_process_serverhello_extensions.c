@@ -94,6 +94,10 @@ static UINT _nx_secure_tls_proc_serverhello_ecjpake_key_kp_pair(NX_SECURE_TLS_SE
 /*    _nx_secure_tls_proc_serverhello_sec_reneg_extension                 */
 /*                                          Process ServerHello           */
 /*                                            Renegotiation extension     */
+/*    _nx_secure_tls_process_record_size_extension                        */
+/*                                          Process record size extension */
+/*    _nx_secure_tls_record_size_limit_update                             */
+/*                                          Set negotiated record limits  */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -261,7 +265,67 @@ USHORT                                supported_version = tls_session -> nx_secu
             }
 
             break;
+#ifdef NX_SECURE_TLS_ENABLE_CLIENT_SESSION_CACHE
+        case NX_SECURE_TLS_EXTENSION_PRE_SHARED_KEY:
+            extension_length = (USHORT)((packet_buffer[offset] << 8) + packet_buffer[offset + 1]);
+            offset += 2;
+
+            if (extension_length + offset > message_length)
+            {
+                return(NX_SECURE_TLS_INCORRECT_MESSAGE_LENGTH);
+            }
+
+            /* A cached session ticket is always offered as the first identity, so the
+               server resumes the session if it selects identity zero. */
+            if ((tls_session -> nx_secure_tls_1_3) &&
+                (tls_session -> nx_secure_tls_session_cache_psk.nx_secure_tls_psk_data_size != 0))
+            {
+                if (extension_length != 2)
+                {
+                    return(NX_SECURE_TLS_INCORRECT_MESSAGE_LENGTH);
+                }
+
+                if ((packet_buffer[offset] == 0) && (packet_buffer[offset + 1] == 0))
+                {
+
+                    /* The selected ciphersuite must use the hash the ticket was issued with (RFC 8446, Section 4.2.11). */
+                    if ((tls_session -> nx_secure_tls_session_ciphersuite == NX_NULL) ||
+                        (tls_session -> nx_secure_tls_session_ciphersuite -> nx_secure_tls_hash !=
+                         tls_session -> nx_secure_tls_session_cache_psk.nx_secure_tls_psk_binder_ciphersuite -> nx_secure_tls_hash))
+                    {
+                        return(NX_SECURE_TLS_HANDSHAKE_FAILURE);
+                    }
+
+                    /* The server was authenticated in the handshake that issued the ticket, so
+                       no Certificate or CertificateVerify follows. */
+                    tls_session -> nx_secure_tls_session_resumed = NX_TRUE;
+                    tls_session -> nx_secure_tls_received_remote_credentials = NX_TRUE;
+                }
+            }
+
+            break;
+#endif /* NX_SECURE_TLS_ENABLE_CLIENT_SESSION_CACHE */
 #endif
+#ifdef NX_SECURE_TLS_ENABLE_RECORD_SIZE_LIMIT
+        case NX_SECURE_TLS_EXTENSION_MAX_FRAGMENT_LENGTH:
+        case NX_SECURE_TLS_EXTENSION_RECORD_SIZE_LIMIT:
+            extension_length = (USHORT)((packet_buffer[offset] << 8) + packet_buffer[offset + 1]);
+            offset += 2;
+
+            if (extension_length + offset > message_length)
+            {
+                return(NX_SECURE_TLS_INCORRECT_MESSAGE_LENGTH);
+            }
+
+            /* The server's reply to the record size extensions offered in the ClientHello. */
+            status = _nx_secure_tls_process_record_size_extension(tls_session, extension_id,
+                                                                  &packet_buffer[offset], extension_length);
+            if (status)
+            {
+                return(status);
+            }
+            break;
+#endif /* NX_SECURE_TLS_ENABLE_RECORD_SIZE_LIMIT */
 #ifdef NX_SECURE_ENABLE_ECJPAKE_CIPHERSUITE
         /* ECJPAKE ciphersuite extensions. */
         case NX_SECURE_TLS_EXTENSION_EC_POINT_FORMATS:
@@ -284,7 +348,9 @@ USHORT                                supported_version = tls_session -> nx_secu
         case NX_SECURE_TLS_EXTENSION_ECJPAKE_KEY_KP_PAIR:
 #endif /* NX_SECURE_ENABLE_ECJPAKE_CIPHERSUITE */
         case NX_SECURE_TLS_EXTENSION_SERVER_NAME_INDICATION:
+#ifndef NX_SECURE_TLS_ENABLE_RECORD_SIZE_LIMIT
         case NX_SECURE_TLS_EXTENSION_MAX_FRAGMENT_LENGTH:
+#endif /* NX_SECURE_TLS_ENABLE_RECORD_SIZE_LIMIT */
         case NX_SECURE_TLS_EXTENSION_CLIENT_CERTIFICATE_URL:
         case NX_SECURE_TLS_EXTENSION_TRUSTED_CA_INDICATION:
         case NX_SECURE_TLS_EXTENSION_CERTIFICATE_STATUS_REQUEST:
@@ -372,6 +438,16 @@ USHORT                                supported_version = tls_session -> nx_secu
     }
 #endif
 
+#ifdef NX_SECURE_TLS_ENABLE_RECORD_SIZE_LIMIT
+#if (NX_SECURE_TLS_TLS_1_3_ENABLED)
+    /* A TLS 1.3 server replies to the record size extensions in EncryptedExtensions. */
+    if (!tls_session -> nx_secure_tls_1_3)
+#endif
+    {
+        status = _nx_secure_tls_record_size_limit_update(tls_session);
+    }
+#endif /* NX_SECURE_TLS_ENABLE_RECORD_SIZE_LIMIT */
+
     return(status);
 #else    
     /* If Client TLS is disabled and we recieve a server key exchange, error! */    
@@ -893,9 +969,18 @@ NX_SECURE_TLS_ECC *ecc_info;
           so don't advance the offset! */
         legacy_form = packet_buffer[offset];
 
-        if(legacy_form != 0x4)
+        if (key_group == (USHORT)NX_CRYPTO_EC_X25519)
+        {
+
+            /* X25519 key shares are the bare 32-byte u-coordinate (RFC 8446, section 4.2.8.2). */
+            if (key_length != 32)
+            {
+                return(NX_SECURE_TLS_BAD_SERVERHELLO_KEYSHARE);
+            }
+        }
+        else if(legacy_form != 0x4)
         {
-            /* In TLS 1.3, the only valid form is 0x4. */
+            /* In TLS 1.3, the only valid form for the NIST curves is 0x4. */
             return(NX_SECURE_TLS_BAD_SERVERHELLO_KEYSHARE);
         }
         
@@ -40,6 +40,12 @@ static UINT _nx_secure_tls_record_packet_decrypt(NX_SECURE_TLS_SESSION *tls_sess
                                                  UINT wait_option);
 static UINT _nx_secure_tls_data_decrypt(NX_SECURE_TLS_SESSION *tls_session,
                                         UCHAR *input, UCHAR *output, UINT length);
+#ifdef NX_SECURE_ENABLE_AEAD_CIPHER
+static UINT _nx_secure_tls_record_in_place_decrypt(NX_SECURE_TLS_SESSION *tls_session,
+                                                   UCHAR *data, UINT message_length,
+                                                   UCHAR *additional_data, UINT additional_data_size,
+                                                   UCHAR *iv);
+#endif /* NX_SECURE_ENABLE_AEAD_CIPHER */
 
 /* Defined in nx_secure_tls_record_payload_encrypt.c */
 extern UCHAR _nx_secure_tls_record_block_buffer[NX_SECURE_TLS_MAX_CIPHER_BLOCK_SIZE];
@@ -60,6 +66,11 @@ extern UCHAR _nx_secure_tls_record_block_buffer[NX_SECURE_TLS_MAX_CIPHER_BLOCK_S
 /*    the session keys generated and ciphersuite determined during the    */
 /*    TLS handshake.                                                      */
 /*                                                                        */
+/*    If plaintext_length is not NX_NULL, an AEAD record that lies within */
+/*    one packet is decrypted in place. decrypted_packet is then set to   */
+/*    NX_NULL, and the plaintext is left in encrypted_packet at           */
+/*    plaintext_offset.                                                   */
+/*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
 /*    tls_session                           TLS control block             */
@@ -71,6 +82,11 @@ extern UCHAR _nx_secure_tls_record_block_buffer[NX_SECURE_TLS_MAX_CIPHER_BLOCK_S
 /*                                            encrypted_packet            */
 /*    decrypted_packet                      Pointer to packet containing  */
 /*                                            decrypted_packet            */
+/*    plaintext_offset                      Offset of data decrypted in   */
+/*                                            place in encrypted_packet   */
+/*    plaintext_length                      Length of data decrypted in   */
+/*                                            place, or NX_NULL to always */
+/*                                            use decrypted_packet        */
 /*    sequence_num                          Record sequence number        */
 /*    record_type                           Record type                   */
 /*    wait_option                           Control timeout options       */
@@ -85,6 +101,8 @@ extern UCHAR _nx_secure_tls_record_block_buffer[NX_SECURE_TLS_MAX_CIPHER_BLOCK_S
 /*    nx_secure_tls_packet_release          Release packet                */
 /*    _nx_secure_tls_record_chained_packet_decrypt                        */
 /*                                          Decrypt chained packet        */
+/*    _nx_secure_tls_record_in_place_decrypt                              */
+/*                                          Decrypt data in place         */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -105,6 +123,7 @@ extern UCHAR _nx_secure_tls_record_block_buffer[NX_SECURE_TLS_MAX_CIPHER_BLOCK_S
 /**************************************************************************/
 UINT _nx_secure_tls_record_payload_decrypt(NX_SECURE_TLS_SESSION *tls_session, NX_PACKET *encrypted_packet,
                                            UINT offset, UINT message_length, NX_PACKET **decrypted_packet,
+                                           ULONG *plaintext_offset, UINT *plaintext_length,
                                            ULONG sequence_num[NX_SECURE_TLS_SEQUENCE_NUMBER_SIZE],
                                            UCHAR record_type, UINT wait_option)
 {
@@ -121,7 +140,13 @@ UINT                                  icv_size;
 UCHAR                                 additional_data[13];
 UINT                                  additional_data_size;
 UCHAR                                 nonce[13];
+NX_PACKET                            *packet_ptr;
+UCHAR                                *data;
+UINT                                  data_offset;
+UINT                                  packet_length;
 #else
+    NX_PARAMETER_NOT_USED(plaintext_offset);
+    NX_PARAMETER_NOT_USED(plaintext_length);
     NX_PARAMETER_NOT_USED(sequence_num);
     NX_PARAMETER_NOT_USED(record_type);
 #endif /* NX_SECURE_ENABLE_AEAD_CIPHER */
@@ -160,6 +185,7 @@ UCHAR                                 nonce[13];
         (session_cipher_method -> nx_crypto_algorithm == NX_CRYPTO_ENCRYPTION_AES_CCM_12) ||
         (session_cipher_method -> nx_crypto_algorithm == NX_CRYPTO_ENCRYPTION_AES_CCM_16) ||
         (session_cipher_method -> nx_crypto_algorithm == NX_CRYPTO_ENCRYPTION_AES_GCM_16) ||
+        (session_cipher_method -> nx_crypto_algorithm == NX_CRYPTO_ENCRYPTION_CHACHA20_POLY1305) ||
         NX_SECURE_AEAD_CIPHER_CHECK(session_cipher_method -> nx_crypto_algorithm))
     {
 #if (NX_SECURE_TLS_TLS_1_3_ENABLED)
@@ -228,6 +254,55 @@ UCHAR                                 nonce[13];
         }
         else
 #endif
+        if (session_cipher_method -> nx_crypto_algorithm == NX_CRYPTO_ENCRYPTION_CHACHA20_POLY1305)
+        {
+
+            /* ChaCha20-Poly1305 in TLS 1.2 has no nonce_explicit (RFC 7905). The nonce is
+               the 12-byte write IV XORed with the sequence number padded on the left, as
+               in TLS 1.3, and the additional data is the same as for the other AEAD ciphers. */
+            icv_size = (session_cipher_method -> nx_crypto_ICV_size_in_bits >> 3);
+
+            if (message_length < icv_size)
+            {
+                return(NX_SECURE_TLS_AEAD_DECRYPT_FAIL);
+            }
+
+            /* The length of the nonce is 12 bytes.  */
+            nonce[0] = 12;
+
+            /* Copy client_write_IV or server_write_IV.  */
+            NX_SECURE_MEMCPY(&nonce[1], iv, 12); /* Use case of memcpy is verified. */
+
+            nonce[5]  = (UCHAR)(nonce[5] ^ (sequence_num[1] >> 24));
+            nonce[6]  = (UCHAR)(nonce[6] ^ (sequence_num[1] >> 16));
+            nonce[7]  = (UCHAR)(nonce[7] ^ (sequence_num[1] >> 8));
+            nonce[8]  = (UCHAR)(nonce[8] ^ (sequence_num[1]));
+            nonce[9]  = (UCHAR)(nonce[9] ^ (sequence_num[0] >> 24));
+            nonce[10] = (UCHAR)(nonce[10] ^ (sequence_num[0] >> 16));
+            nonce[11] = (UCHAR)(nonce[11] ^ (sequence_num[0] >> 8));
+            nonce[12] = (UCHAR)(nonce[12] ^ (sequence_num[0]));
+
+            /*  additional_data = seq_num + TLSCompressed.type +
+                            TLSCompressed.version + TLSCompressed.length;
+             */
+            additional_data[0]  = (UCHAR)(sequence_num[1] >> 24);
+            additional_data[1]  = (UCHAR)(sequence_num[1] >> 16);
+            additional_data[2]  = (UCHAR)(sequence_num[1] >> 8);
+            additional_data[3]  = (UCHAR)(sequence_num[1]);
+            additional_data[4]  = (UCHAR)(sequence_num[0] >> 24);
+            additional_data[5]  = (UCHAR)(sequence_num[0] >> 16);
+            additional_data[6]  = (UCHAR)(sequence_num[0] >> 8);
+            additional_data[7]  = (UCHAR)(sequence_num[0]);
+            additional_data[8]  = record_type;
+            additional_data[9]  = (UCHAR)(tls_session -> nx_secure_tls_protocol_version >> 8);
+            additional_data[10] = (UCHAR)(tls_session -> nx_secure_tls_protocol_version);
+            additional_data[11] = (UCHAR)((message_length - icv_size) >> 8);
+            additional_data[12] = (UCHAR)(message_length - icv_size);
+
+            /* We have 13 bytes of additional data (8 bytes seq num + 5 bytes header). */
+            additional_data_size = 13;
+        }
+        else
         {
             /* AEAD ciphers structure:
                  struct {
@@ -305,8 +380,49 @@ UCHAR                                 nonce[13];
             return(NX_SECURE_TLS_AEAD_DECRYPT_FAIL);
         }
 
+        /* Find the payload if the caller allows it to be decrypted in place and it is not split across packets. */
+        data = NX_NULL;
+        if ((plaintext_length != NX_NULL) &&
+            NX_SECURE_AEAD_CIPHER_IN_PLACE_CHECK(session_cipher_method -> nx_crypto_algorithm))
+        {
+            data_offset = offset;
+            for (packet_ptr = encrypted_packet; packet_ptr; packet_ptr = packet_ptr -> nx_packet_next)
+            {
+                packet_length = (UINT)(packet_ptr -> nx_packet_append_ptr - packet_ptr -> nx_packet_prepend_ptr);
+                if (data_offset < packet_length)
+                {
+                    if ((packet_length - data_offset) >= message_length)
+                    {
+                        data = packet_ptr -> nx_packet_prepend_ptr + data_offset;
+                    }
+                    break;
+                }
+                data_offset -= packet_length;
+            }
+        }
+
         /* Decrypt the message payload using the session crypto method, and move the decrypted data to the beginning of the buffer. */
-        if (session_cipher_method -> nx_crypto_operation)
+        if (data != NX_NULL)
+        {
+
+            /* Decrypt the payload where it is. The caller takes the plaintext from encrypted_packet. */
+            status = _nx_secure_tls_record_in_place_decrypt(tls_session, data, message_length,
+                                                            additional_data, additional_data_size, nonce);
+#ifdef NX_SECURE_KEY_CLEAR
+            NX_SECURE_MEMSET(additional_data, 0, sizeof(additional_data));
+            NX_SECURE_MEMSET(nonce, 0, sizeof(nonce));
+#endif /* NX_SECURE_KEY_CLEAR  */
+
+            if (status != NX_SECURE_TLS_SUCCESS)
+            {
+                return(status);
+            }
+
+            *decrypted_packet = NX_NULL;
+            *plaintext_offset = offset;
+            *plaintext_length = message_length - icv_size;
+        }
+        else if (session_cipher_method -> nx_crypto_operation)
         {
 
             /* Decrypt the message payload using the session crypto method, and move the decrypted data to the beginning of the buffer. */
@@ -763,8 +879,16 @@ UINT original_offset = offset;
     block_size = session_cipher_method -> nx_crypto_block_size_in_bytes;
     NX_ASSERT(block_size <= sizeof(_nx_secure_tls_record_block_buffer));
 
-    /* Locate input data. */
-    while (offset)
+    /* Ciphers that carry an unfinished block over to the next update take the data
+       of each packet as it is, so no block is copied across packets. */
+    if (NX_SECURE_AEAD_CIPHER_PARTIAL_BLOCK_CHECK(session_cipher_method -> nx_crypto_algorithm))
+    {
+        block_size = 0;
+    }
+
+    /* Locate input data. Empty packets are skipped as well, since the data of each
+       packet is used as it is when block_size is zero. */
+    for (;;)
     {
         encrypted_length = (UINT)(encrypted_packet -> nx_packet_append_ptr - encrypted_packet -> nx_packet_prepend_ptr);
         if (encrypted_length > offset)
@@ -996,3 +1120,131 @@ const NX_CRYPTO_METHOD *session_cipher_method;
 
     return(status);
 }
+
+#ifdef NX_SECURE_ENABLE_AEAD_CIPHER
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_secure_tls_record_in_place_decrypt              PORTABLE C      */
+/*                                                           6.1          */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function decrypts and authenticates the payload of an incoming */
+/*    AEAD record held in contiguous memory. The plaintext overwrites the */
+/*    cipher text, and the ICV is read from where it follows the payload. */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    tls_session                           TLS control block             */
+/*    data                                  Pointer to cipher text and    */
+/*                                            ICV                         */
+/*    message_length                        Length of cipher text and ICV */
+/*    additional_data                       Pointer to additional data    */
+/*    additional_data_size                  Size of additional data       */
+/*    iv                                    Pointer to nonce              */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    [nx_crypto_operation]                 Crypto operation              */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_secure_tls_record_payload_decrypt Decrypt TLS record payload    */
+/*                                                                        */
+/*                                                                        */
+/**************************************************************************/
+static UINT _nx_secure_tls_record_in_place_decrypt(NX_SECURE_TLS_SESSION *tls_session,
+                                                   UCHAR *data, UINT message_length,
+                                                   UCHAR *additional_data, UINT additional_data_size,
+                                                   UCHAR *iv)
+{
+UINT                    status;
+UINT                    icv_size;
+VOID                   *handler = NX_NULL;
+VOID                   *crypto_method_metadata;
+const NX_CRYPTO_METHOD *session_cipher_method;
+
+    session_cipher_method = tls_session -> nx_secure_tls_session_ciphersuite -> nx_secure_tls_session_cipher;
+
+    /* The ICV follows the cipher text. */
+    icv_size = session_cipher_method -> nx_crypto_ICV_size_in_bits >> 3;
+    if (icv_size > message_length)
+    {
+
+        /* Invalid packet. */
+        return(NX_SECURE_TLS_INVALID_PACKET);
+    }
+    message_length -= icv_size;
+
+    /* Select our proper data structures. */
+    if (tls_session -> nx_secure_tls_socket_type == NX_SECURE_TLS_SESSION_TYPE_SERVER)
+    {
+
+        /* The socket is a TLS server, so use the *CLIENT* cipher to decrypt. */
+        crypto_method_metadata = tls_session -> nx_secure_session_cipher_metadata_area_client;
+        handler = tls_session -> nx_secure_session_cipher_handler_client;
+    }
+    else
+    {
+
+        /* The socket is a TLS client, so use the *SERVER* cipher to decrypt. */
+        crypto_method_metadata = tls_session -> nx_secure_session_cipher_metadata_area_server;
+        handler = tls_session -> nx_secure_session_cipher_handler_server;
+    }
+
+    /* Set additional data pointer and length.  */
+    status = session_cipher_method -> nx_crypto_operation(NX_CRYPTO_DECRYPT_INITIALIZE,
+                                                          handler,
+                                                          (NX_CRYPTO_METHOD*)session_cipher_method,
+                                                          NX_NULL, 0,
+                                                          additional_data,
+                                                          additional_data_size,
+                                                          iv,
+                                                          NX_NULL,
+                                                          message_length,
+                                                          crypto_method_metadata,
+                                                          tls_session -> nx_secure_session_cipher_metadata_size,
+                                                          NX_NULL, NX_NULL);
+
+    if (status != NX_CRYPTO_SUCCESS)
+    {
+        return(status);
+    }
+
+    /* Decrypt the whole payload in one update, writing the plaintext over the cipher text. */
+    if (message_length > 0)
+    {
+        status = _nx_secure_tls_data_decrypt(tls_session, data, data, message_length);
+        if (status != NX_CRYPTO_SUCCESS)
+        {
+            return(status);
+        }
+    }
+
+    /* Verify the ICV. */
+    status = session_cipher_method -> nx_crypto_operation(NX_CRYPTO_DECRYPT_CALCULATE,
+                                                          handler,
+                                                          (NX_CRYPTO_METHOD*)session_cipher_method,
+                                                          NX_NULL, 0,
+                                                          data + message_length,
+                                                          icv_size,
+                                                          NX_NULL,
+                                                          NX_NULL,
+                                                          0,
+                                                          crypto_method_metadata,
+                                                          tls_session -> nx_secure_session_cipher_metadata_size,
+                                                          NX_NULL, NX_NULL);
+
+    if (status == NX_CRYPTO_AUTHENTICATION_FAILED)
+    {
+        return(NX_SECURE_TLS_AEAD_DECRYPT_FAIL);
+    }
+
+    return(status);
+}
+#endif /* NX_SECURE_ENABLE_AEAD_CIPHER */
@@ -148,6 +148,14 @@ UCHAR                                *icv_ptr = NX_NULL;
     /* Make sure our block size is small enough to fit into our buffer. */
     NX_ASSERT((iv_size <= NX_SECURE_TLS_MAX_CIPHER_BLOCK_SIZE) &&
               (block_size <= NX_SECURE_TLS_MAX_CIPHER_BLOCK_SIZE));
+
+    /* Ciphers that carry an unfinished block over to the next update encrypt each
+       packet in place as it is, so no block is copied across packets. */
+    if (NX_SECURE_AEAD_CIPHER_PARTIAL_BLOCK_CHECK(session_cipher_method -> nx_crypto_algorithm))
+    {
+        block_size = 0;
+    }
+
     status = _nx_secure_tls_record_data_encrypt_init(tls_session, send_packet, sequence_num,
                                                      record_type, &data_offset, session_cipher_method);
     if (status)
@@ -475,6 +483,7 @@ UINT                                  message_length;
         (session_cipher_method -> nx_crypto_algorithm == NX_CRYPTO_ENCRYPTION_AES_CCM_12) ||
         (session_cipher_method -> nx_crypto_algorithm == NX_CRYPTO_ENCRYPTION_AES_CCM_16) ||
         (session_cipher_method -> nx_crypto_algorithm == NX_CRYPTO_ENCRYPTION_AES_GCM_16) ||
+        (session_cipher_method -> nx_crypto_algorithm == NX_CRYPTO_ENCRYPTION_CHACHA20_POLY1305) ||
         NX_SECURE_AEAD_CIPHER_CHECK(session_cipher_method -> nx_crypto_algorithm))
     {
 #if (NX_SECURE_TLS_TLS_1_3_ENABLED)
@@ -544,6 +553,50 @@ UINT                                  message_length;
         }
         else
 #endif
+        if (session_cipher_method -> nx_crypto_algorithm == NX_CRYPTO_ENCRYPTION_CHACHA20_POLY1305)
+        {
+
+            /* ChaCha20-Poly1305 in TLS 1.2 has no nonce_explicit (RFC 7905). The nonce is
+               the 12-byte write IV XORed with the sequence number padded on the left, as
+               in TLS 1.3, and the additional data is the same as for the other AEAD ciphers. */
+
+            /* The length of the nonce is 12 bytes.  */
+            nonce[0] = 12;
+
+            /* Copy client_write_IV or server_write_IV.  */
+            NX_SECURE_MEMCPY(&nonce[1], iv, 12); /* Use case of memcpy is verified. */
+
+            nonce[5]  = (UCHAR)(nonce[5] ^ (sequence_num[1] >> 24));
+            nonce[6]  = (UCHAR)(nonce[6] ^ (sequence_num[1] >> 16));
+            nonce[7]  = (UCHAR)(nonce[7] ^ (sequence_num[1] >> 8));
+            nonce[8]  = (UCHAR)(nonce[8] ^ (sequence_num[1]));
+            nonce[9]  = (UCHAR)(nonce[9] ^ (sequence_num[0] >> 24));
+            nonce[10] = (UCHAR)(nonce[10] ^ (sequence_num[0] >> 16));
+            nonce[11] = (UCHAR)(nonce[11] ^ (sequence_num[0] >> 8));
+            nonce[12] = (UCHAR)(nonce[12] ^ (sequence_num[0]));
+
+            /*  additional_data = seq_num + TLSCompressed.type +
+                            TLSCompressed.version + TLSCompressed.length;
+             */
+            message_length = send_packet -> nx_packet_length;
+            additional_data[0]  = (UCHAR)(sequence_num[1] >> 24);
+            additional_data[1]  = (UCHAR)(sequence_num[1] >> 16);
+            additional_data[2]  = (UCHAR)(sequence_num[1] >> 8);
+            additional_data[3]  = (UCHAR)(sequence_num[1]);
+            additional_data[4]  = (UCHAR)(sequence_num[0] >> 24);
+            additional_data[5]  = (UCHAR)(sequence_num[0] >> 16);
+            additional_data[6]  = (UCHAR)(sequence_num[0] >> 8);
+            additional_data[7]  = (UCHAR)(sequence_num[0]);
+            additional_data[8]  = record_type;
+            additional_data[9]  = (UCHAR)(tls_session -> nx_secure_tls_protocol_version >> 8);
+            additional_data[10] = (UCHAR)(tls_session -> nx_secure_tls_protocol_version);
+            additional_data[11] = (UCHAR)(message_length >> 8);
+            additional_data[12] = (UCHAR)(message_length);
+
+            /* We have 13 bytes of additional data (8 bytes seq num + 5 bytes header). */
+            additional_data_size = 13;
+        }
+        else
         {
 
             /* AEAD ciphers structure:
@@ -0,0 +1,127 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Secure Component                                                 */
+/**                                                                       */
+/**    Transport Layer Security (TLS)                                     */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SECURE_SOURCE_CODE
+
+#include "nx_secure_tls.h"
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_secure_tls_record_size_limit_update             PORTABLE C      */
+/*                                                           6.1          */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function sets the limits on application data sent and          */
+/*    received in each record, from the record_size_limit or              */
+/*    max_fragment_length extensions exchanged in the handshake. It is    */
+/*    called once the protocol version is known and the extensions from   */
+/*    both hosts have been processed. A limit of zero means none was      */
+/*    negotiated.                                                         */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    tls_session                           TLS control block             */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_secure_tls_process_encrypted_extensions                         */
+/*                                          Process EncryptedExtensions   */
+/*    _nx_secure_tls_process_serverhello_extensions                       */
+/*                                          Process ServerHello           */
+/*                                            extensions                  */
+/*    _nx_secure_tls_send_record_size_extensions                          */
+/*                                          Send record size extensions   */
+/*                                                                        */
+/*                                                                        */
+/**************************************************************************/
+#ifdef NX_SECURE_TLS_ENABLE_RECORD_SIZE_LIMIT
+UINT _nx_secure_tls_record_size_limit_update(NX_SECURE_TLS_SESSION *tls_session)
+{
+UINT send_limit;
+UINT receive_limit;
+UINT content_type_length;
+
+    /* In TLS 1.3 the record_size_limit covers the inner content type byte (RFC 8449, Section 4). */
+    content_type_length = 0;
+#if (NX_SECURE_TLS_TLS_1_3_ENABLED)
+    if (tls_session -> nx_secure_tls_1_3)
+    {
+        content_type_length = 1;
+    }
+#endif
+
+    send_limit = 0;
+    receive_limit = 0;
+
+    if (tls_session -> nx_secure_tls_remote_record_size_limit != 0)
+    {
+
+        /* A client must not receive both extensions from a server (RFC 8449, Section 5). */
+        if ((tls_session -> nx_secure_tls_socket_type == NX_SECURE_TLS_SESSION_TYPE_CLIENT) &&
+            (tls_session -> nx_secure_tls_remote_max_fragment_length != 0))
+        {
+            return(NX_SECURE_TLS_BAD_RECORD_SIZE_EXTENSION);
+        }
+
+        /* Both hosts sent record_size_limit, and each sends records no larger than the other asked for. */
+        send_limit = (UINT)(tls_session -> nx_secure_tls_remote_record_size_limit - content_type_length);
+
+        if (tls_session -> nx_secure_tls_record_size_limit != 0)
+        {
+            receive_limit = (UINT)(tls_session -> nx_secure_tls_record_size_limit - content_type_length);
+        }
+    }
+    else if (tls_session -> nx_secure_tls_remote_max_fragment_length != 0)
+    {
+
+        /* Codes 1 to 4 limit records to 2^9 to 2^12 bytes in both directions. */
+        send_limit = 256u << tls_session -> nx_secure_tls_remote_max_fragment_length;
+        receive_limit = send_limit;
+    }
+
+    /* Limits at or over the protocol maximum are not limits. */
+    if (send_limit >= NX_SECURE_TLS_MAX_PLAINTEXT_LENGTH)
+    {
+        send_limit = 0;
+    }
+
+    if (receive_limit >= NX_SECURE_TLS_MAX_PLAINTEXT_LENGTH)
+    {
+        receive_limit = 0;
+    }
+
+    tls_session -> nx_secure_tls_record_size_limit_send = (USHORT)send_limit;
+    tls_session -> nx_secure_tls_record_size_limit_receive = (USHORT)receive_limit;
+
+    return(NX_SUCCESS);
+}
+#endif /* NX_SECURE_TLS_ENABLE_RECORD_SIZE_LIMIT */
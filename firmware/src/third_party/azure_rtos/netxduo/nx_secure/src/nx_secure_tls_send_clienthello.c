@@ -100,6 +100,14 @@ UINT                        status;
 UINT                        fallback_enabled = NX_FALSE;
 const NX_SECURE_TLS_CRYPTO *crypto_table;
 ULONG                      extension_length, total_extensions_length;
+#ifdef NX_SECURE_TLS_ENABLE_CLIENT_SESSION_CACHE
+NX_SECURE_TLS_SESSION_CACHE_ENTRY
+                           *cache_entry;
+#if (NX_SECURE_TLS_TLS_1_3_ENABLED)
+NX_SECURE_TLS_PSK_STORE    *ticket_psk;
+USHORT                      ciphersuite_priority;
+#endif /* NX_SECURE_TLS_TLS_1_3_ENABLED */
+#endif /* NX_SECURE_TLS_ENABLE_CLIENT_SESSION_CACHE */
 
 
     /* ClientHello structure:
@@ -153,6 +161,51 @@ ULONG                      extension_length, total_extensions_length;
         ciphersuites_length = (USHORT)(ciphersuites_length + 2);
     }
 
+#ifdef NX_SECURE_TLS_ENABLE_CLIENT_SESSION_CACHE
+    /* On an initial handshake, offer the session cached for this server for resumption. The master
+       secret is restored now so that it matches the offered session ID even if the cache entry is
+       replaced before the ServerHello arrives. */
+    tls_session -> nx_secure_tls_session_cache_ciphersuite = 0;
+    tls_session -> nx_secure_tls_session_resumed = NX_FALSE;
+#if (NX_SECURE_TLS_TLS_1_3_ENABLED)
+    ticket_psk = &(tls_session -> nx_secure_tls_session_cache_psk);
+    tls_session -> nx_secure_tls_session_cache_ticket_entry = NX_NULL;
+    NX_SECURE_MEMSET(ticket_psk, 0, sizeof(NX_SECURE_TLS_PSK_STORE));
+#endif /* NX_SECURE_TLS_TLS_1_3_ENABLED */
+    if (!tls_session -> nx_secure_tls_local_session_active &&
+        (_nx_secure_tls_session_cache_find(tls_session, &cache_entry) == NX_SUCCESS))
+    {
+#if (NX_SECURE_TLS_TLS_1_3_ENABLED)
+        if (cache_entry -> nx_secure_tls_session_cache_ticket_length != 0)
+        {
+
+            /* A TLS 1.3 session is resumed by offering its ticket in the pre_shared_key extension.
+               The binder is computed with the hash of the ciphersuite the ticket was issued for. */
+            if (tls_session -> nx_secure_tls_1_3 &&
+                (_nx_secure_tls_ciphersuite_lookup(tls_session, cache_entry -> nx_secure_tls_session_cache_ciphersuite,
+                                                   &ticket_psk -> nx_secure_tls_psk_binder_ciphersuite,
+                                                   &ciphersuite_priority) == NX_SUCCESS))
+            {
+                ticket_psk -> nx_secure_tls_psk_data_size = ticket_psk -> nx_secure_tls_psk_binder_ciphersuite -> nx_secure_tls_hash_size;
+                NX_SECURE_MEMCPY(ticket_psk -> nx_secure_tls_psk_data, cache_entry -> nx_secure_tls_session_cache_master_secret,
+                                 ticket_psk -> nx_secure_tls_psk_data_size); /* Use case of memcpy is verified. */
+                tls_session -> nx_secure_tls_session_cache_ticket_entry = cache_entry;
+            }
+        }
+        else
+#endif /* NX_SECURE_TLS_TLS_1_3_ENABLED */
+        {
+            tls_session -> nx_secure_tls_session_id_length = cache_entry -> nx_secure_tls_session_cache_session_id_length;
+            NX_SECURE_MEMCPY(tls_session -> nx_secure_tls_session_id, cache_entry -> nx_secure_tls_session_cache_session_id,
+                             cache_entry -> nx_secure_tls_session_cache_session_id_length); /* Use case of memcpy is verified. */
+            NX_SECURE_MEMCPY(tls_session -> nx_secure_tls_key_material.nx_secure_tls_master_secret,
+                             cache_entry -> nx_secure_tls_session_cache_master_secret, NX_SECURE_TLS_MASTER_SIZE); /* Use case of memcpy is verified. */
+            tls_session -> nx_secure_tls_session_cache_ciphersuite = cache_entry -> nx_secure_tls_session_cache_ciphersuite;
+            tls_session -> nx_secure_tls_session_cache_protocol_version = cache_entry -> nx_secure_tls_session_cache_protocol_version;
+        }
+    }
+#endif /* NX_SECURE_TLS_ENABLE_CLIENT_SESSION_CACHE */
+
     if (((ULONG)(send_packet -> nx_packet_data_end) - (ULONG)(send_packet -> nx_packet_append_ptr)) <
         (9u + sizeof(tls_session -> nx_secure_tls_key_material.nx_secure_tls_client_random) +
          tls_session -> nx_secure_tls_session_id_length + ciphersuites_length))
@@ -203,7 +256,12 @@ ULONG                      extension_length, total_extensions_length;
     length += sizeof(tls_session -> nx_secure_tls_key_material.nx_secure_tls_client_random);
 
     /* Session ID length is one byte. */
-    tls_session -> nx_secure_tls_session_id_length  = 0;
+#ifdef NX_SECURE_TLS_ENABLE_CLIENT_SESSION_CACHE
+    if (tls_session -> nx_secure_tls_session_cache_ciphersuite == 0)
+#endif /* NX_SECURE_TLS_ENABLE_CLIENT_SESSION_CACHE */
+    {
+        tls_session -> nx_secure_tls_session_id_length  = 0;
+    }
     packet_buffer[length] = tls_session -> nx_secure_tls_session_id_length;
     length++;
 
@@ -301,7 +359,11 @@ ULONG                      extension_length, total_extensions_length;
     /* !!! NOTE !!! The TLS 1.3 PSK extension MUST be the LAST extension in the ClientHello! (RFC 8446, Section 4.2.11) */
 #if (NX_SECURE_TLS_TLS_1_3_ENABLED)
     /* Send TLS 1.3 PSK extension, but only if there is a PSK to send. */
-    if(tls_session->nx_secure_tls_1_3 && tls_session->nx_secure_tls_credentials.nx_secure_tls_psk_count > 0)
+    if(tls_session->nx_secure_tls_1_3 && ((tls_session->nx_secure_tls_credentials.nx_secure_tls_psk_count > 0)
+#ifdef NX_SECURE_TLS_ENABLE_CLIENT_SESSION_CACHE
+                                          || (tls_session -> nx_secure_tls_session_cache_ticket_entry != NX_NULL)
+#endif /* NX_SECURE_TLS_ENABLE_CLIENT_SESSION_CACHE */
+                                          ))
     {
         status = _nx_secure_tls_send_clienthello_psk_extension(tls_session, packet_buffer, &length, 
                                                                extension_offset, total_extensions_length,
@@ -313,6 +375,11 @@ ULONG                      extension_length, total_extensions_length;
         }
         total_extensions_length += extension_length;
     }
+
+#ifdef NX_SECURE_TLS_ENABLE_CLIENT_SESSION_CACHE
+    /* The cache entry may change once the protection is released. The PSK of the offered ticket was copied. */
+    tls_session -> nx_secure_tls_session_cache_ticket_entry = NX_NULL;
+#endif /* NX_SECURE_TLS_ENABLE_CLIENT_SESSION_CACHE */
 #endif
 
     /* Put the extensions length into the packet at our original offset and add
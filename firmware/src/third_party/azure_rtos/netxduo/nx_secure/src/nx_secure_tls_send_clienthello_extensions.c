@@ -117,6 +117,8 @@ static UINT _nx_secure_tls_send_clienthello_sec_reneg_extension(NX_SECURE_TLS_SE
 /*                                          Send ClientHello SNI extension*/
 /*    _nx_secure_tls_send_clienthello_ec_extension                        */
 /*                                          Send ClientHello EC extension */
+/*    _nx_secure_tls_send_record_size_extensions                          */
+/*                                          Send record size extensions   */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -243,8 +245,22 @@ UINT   status;
     total_extensions_length = (USHORT)(total_extensions_length + extension_length);
 #endif
 
+#ifdef NX_SECURE_TLS_ENABLE_RECORD_SIZE_LIMIT
+    /* Ask the server to send smaller records if the application has set a record size limit. */
+    status = _nx_secure_tls_send_record_size_extensions(tls_session, packet_buffer, &length, &extension_length, available_size);
+    if(status != NX_SUCCESS)
+    {
+        return(status);
+    }
+    total_extensions_length = (USHORT)(total_extensions_length + extension_length);
+#endif /* NX_SECURE_TLS_ENABLE_RECORD_SIZE_LIMIT */
+
 #if (NX_SECURE_TLS_TLS_1_3_ENABLED)
-    if(tls_session->nx_secure_tls_1_3 && tls_session->nx_secure_tls_credentials.nx_secure_tls_psk_count > 0)
+    if(tls_session->nx_secure_tls_1_3 && ((tls_session->nx_secure_tls_credentials.nx_secure_tls_psk_count > 0)
+#ifdef NX_SECURE_TLS_ENABLE_CLIENT_SESSION_CACHE
+                                          || (tls_session -> nx_secure_tls_session_cache_ticket_entry != NX_NULL)
+#endif /* NX_SECURE_TLS_ENABLE_CLIENT_SESSION_CACHE */
+                                          ))
     {
         status = _nx_secure_tls_send_clienthello_psk_kem_extension(tls_session, packet_buffer, &length, &extension_length);
         if (status != NX_SUCCESS)
@@ -894,7 +910,12 @@ UINT   binder_offset;
 UINT   binder_total;
 UINT   status;
 UINT   partial_client_hello_len;
+UINT   ticket_offered = 0;
 NX_SECURE_TLS_PSK_STORE *psk_store;
+NX_SECURE_TLS_PSK_STORE *psk_entry;
+#ifdef NX_SECURE_TLS_ENABLE_CLIENT_SESSION_CACHE
+NX_SECURE_TLS_SESSION_CACHE_ENTRY *ticket_entry;
+#endif /* NX_SECURE_TLS_ENABLE_CLIENT_SESSION_CACHE */
 
 
     /* Key Share Extension structure (From TLS 1.3 RFC 8446):
@@ -981,12 +1002,46 @@ NX_SECURE_TLS_PSK_STORE *psk_store;
     ids_total = 0;
     binder_total = 0;
 
+#ifdef NX_SECURE_TLS_ENABLE_CLIENT_SESSION_CACHE
+    /* A cached session ticket is offered as the first identity, ahead of the user-defined PSKs. */
+    ticket_entry = tls_session -> nx_secure_tls_session_cache_ticket_entry;
+    if (ticket_entry != NX_NULL)
+    {
+        ticket_offered = 1;
+        num_ids++;
+    }
+#endif /* NX_SECURE_TLS_ENABLE_CLIENT_SESSION_CACHE */
+
     /* Loop through all IDs. */
     for(i = 0; i < num_ids; ++i)
     {
         /* Setup the ID list. */
-        id_len = psk_store[i].nx_secure_tls_psk_id_size;
-        id = psk_store[i].nx_secure_tls_psk_id;
+#ifdef NX_SECURE_TLS_ENABLE_CLIENT_SESSION_CACHE
+        if (i < ticket_offered)
+        {
+            psk_entry = &(tls_session -> nx_secure_tls_session_cache_psk);
+            id_len = ticket_entry -> nx_secure_tls_session_cache_ticket_length;
+            id = ticket_entry -> nx_secure_tls_session_cache_ticket;
+
+            /* The obfuscated age is the age of the ticket in milliseconds plus the ticket_age_add
+               value from the server, modulo 2^32 (RFC 8446, Section 4.2.11.1). */
+            age = (UINT)(ticket_entry -> nx_secure_tls_session_cache_ticket_age_add);
+            if (tls_session -> nx_secure_tls_session_time_function != NX_NULL)
+            {
+                age += (UINT)((tls_session -> nx_secure_tls_session_time_function() -
+                               ticket_entry -> nx_secure_tls_session_cache_timestamp) * 1000);
+            }
+        }
+        else
+#endif /* NX_SECURE_TLS_ENABLE_CLIENT_SESSION_CACHE */
+        {
+            psk_entry = &psk_store[i - ticket_offered];
+            id_len = psk_entry -> nx_secure_tls_psk_id_size;
+            id = psk_entry -> nx_secure_tls_psk_id;
+
+            /* External PSKs have no age. */
+            age = 0;
+        }
 
         if (available_size < (offset + 6u + id_len))
         {
@@ -1004,7 +1059,6 @@ NX_SECURE_TLS_PSK_STORE *psk_store;
         offset += (UINT)(id_len);
 
         /* Set the obfuscated PSK age. */
-        age = 0;
         packet_buffer[offset]     = (UCHAR)((age & 0xFF000000) >> 24);
         packet_buffer[offset + 1] = (UCHAR)((age & 0x00FF0000) >> 16);
         packet_buffer[offset + 2] = (UCHAR)((age & 0x0000FF00) >> 8);
@@ -1014,6 +1068,16 @@ NX_SECURE_TLS_PSK_STORE *psk_store;
         /* Update the length with the ID length (id_len), length field (2), and age field (4). */
         ids_total = ids_total + (UINT)(id_len + 2 + 4);
         
+        /* The binder is the size of the hash associated with the PSK, SHA-256 by default. */
+        if (psk_entry -> nx_secure_tls_psk_binder_ciphersuite != NX_NULL)
+        {
+            binder_len = psk_entry -> nx_secure_tls_psk_binder_ciphersuite -> nx_secure_tls_hash_size;
+        }
+        else
+        {
+            binder_len = (tls_session -> nx_secure_tls_crypto_table -> nx_secure_tls_handshake_hash_sha256_method -> nx_crypto_ICV_size_in_bits >> 3);
+        }
+
         /* Caclulate the length of the binder list - binder for each PSK + the length field. */
         binder_total += (UINT)(1 + binder_len);        
     }
@@ -1029,8 +1093,6 @@ NX_SECURE_TLS_PSK_STORE *psk_store;
     
     /* Update the total length of the extension with the anticipated size of the binders - this is used in generating
        the binder hashes. */
-//    printf(">>>Binder list length: %d\n", binder_total);
-    binder_total = 33;
     data_length += binder_total; 
 
     /* Extension length. */
@@ -1119,7 +1181,22 @@ NX_SECURE_TLS_PSK_STORE *psk_store;
     /* Loop through all IDs and set the binders accordingly. */
     for(i = 0; i < num_ids; ++i)
     {
-        _nx_secure_tls_psk_binder_generate(tls_session, &psk_store[i]);
+#ifdef NX_SECURE_TLS_ENABLE_CLIENT_SESSION_CACHE
+        if (i < ticket_offered)
+        {
+            psk_entry = &(tls_session -> nx_secure_tls_session_cache_psk);
+        }
+        else
+#endif /* NX_SECURE_TLS_ENABLE_CLIENT_SESSION_CACHE */
+        {
+            psk_entry = &psk_store[i - ticket_offered];
+        }
+
+        status = _nx_secure_tls_psk_binder_generate(tls_session, psk_entry);
+        if (status != NX_SUCCESS)
+        {
+            return(status);
+        }
     }
 
     if (available_size < (offset + 2u))
@@ -1137,8 +1214,19 @@ NX_SECURE_TLS_PSK_STORE *psk_store;
     num_binders = num_ids;
     for(i = 0; i < num_binders; ++i)
     {
-        binder_len = psk_store[i].nx_secure_tls_psk_binder_size;
-        binder = psk_store[i].nx_secure_tls_psk_binder;
+#ifdef NX_SECURE_TLS_ENABLE_CLIENT_SESSION_CACHE
+        if (i < ticket_offered)
+        {
+            psk_entry = &(tls_session -> nx_secure_tls_session_cache_psk);
+        }
+        else
+#endif /* NX_SECURE_TLS_ENABLE_CLIENT_SESSION_CACHE */
+        {
+            psk_entry = &psk_store[i - ticket_offered];
+        }
+
+        binder_len = psk_entry -> nx_secure_tls_psk_binder_size;
+        binder = psk_entry -> nx_secure_tls_psk_binder;
 
         if (available_size < (offset + 1u + binder_len))
         {
@@ -0,0 +1,91 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Secure Component                                                 */
+/**                                                                       */
+/**    Transport Layer Security (TLS)                                     */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SECURE_SOURCE_CODE
+
+#include "nx_secure_tls.h"
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_secure_tls_send_coalesced_record                PORTABLE C      */
+/*                                                           6.1          */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function sends the application data held back on a TLS        */
+/*    session as one application data record. The held packet is taken   */
+/*    off the session first, and is released if it cannot be sent.       */
+/*    The caller must hold the TLS protection mutex.                      */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    tls_session                           TLS control block             */
+/*    wait_option                           Indicates behavior if TCP     */
+/*                                          socket cannot send packet     */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_secure_tls_send_record            Send TLS encrypted record     */
+/*    nx_secure_tls_packet_release          Release packet                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_secure_tls_session_end            End TLS session               */
+/*    _nx_secure_tls_session_send           Send data over TLS session    */
+/*    _nx_secure_tls_session_send_flush     Send held application data    */
+/*                                                                        */
+/*                                                                        */
+/**************************************************************************/
+#ifdef NX_SECURE_TLS_ENABLE_SEND_COALESCING
+UINT _nx_secure_tls_send_coalesced_record(NX_SECURE_TLS_SESSION *tls_session, ULONG wait_option)
+{
+UINT       status;
+NX_PACKET *send_packet;
+
+    send_packet = tls_session -> nx_secure_tls_send_coalesce_packet;
+    if (send_packet == NX_NULL)
+    {
+
+        /* Nothing is held back. */
+        return(NX_SUCCESS);
+    }
+
+    /* Take the packet off the session, since the protection is released while it is sent. */
+    tls_session -> nx_secure_tls_send_coalesce_packet = NX_NULL;
+
+    status = _nx_secure_tls_send_record(tls_session, send_packet, NX_SECURE_TLS_APPLICATION_DATA, wait_option);
+
+    if (status != NX_SUCCESS)
+    {
+
+        /* The application has handed the data over, so the packet is released here. */
+        nx_secure_tls_packet_release(send_packet);
+    }
+
+    return(status);
+}
+#endif /* NX_SECURE_TLS_ENABLE_SEND_COALESCING */
@@ -53,6 +53,8 @@
 /*  CALLS                                                                 */
 /*                                                                        */
 /*    _nx_secure_tls_ciphersuite_lookup     Lookup current ciphersuite    */
+/*    _nx_secure_tls_send_record_size_extensions                          */
+/*                                          Send record size extensions   */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -70,14 +72,15 @@
 /**************************************************************************/
 UINT _nx_secure_tls_send_encrypted_extensions(NX_SECURE_TLS_SESSION *tls_session, NX_PACKET *send_packet)
 {
-UINT status;
+UINT   status;
+USHORT extension_length = 0;
+#ifdef NX_SECURE_TLS_ENABLE_RECORD_SIZE_LIMIT
+ULONG  length;
+#endif /* NX_SECURE_TLS_ENABLE_RECORD_SIZE_LIMIT */
 
     status = NX_SUCCESS;
 
-    /* Populate encrypted extensions here. */
-    NX_PARAMETER_NOT_USED(tls_session);
-
-    /* Sending 0-length encrypted extensions - still requires the length field (16 bits). */
+    /* Even 0-length encrypted extensions still require the length field (16 bits). */
     if (((ULONG)(send_packet -> nx_packet_data_end) - (ULONG)(send_packet -> nx_packet_append_ptr)) < 2u)
     {
         
@@ -85,10 +88,25 @@ UINT status;
         return(NX_SECURE_TLS_PACKET_BUFFER_TOO_SMALL);
     }
 
-    send_packet -> nx_packet_append_ptr[0] = 0x0;
-    send_packet -> nx_packet_append_ptr[1] = 0x0;
-    send_packet -> nx_packet_append_ptr = send_packet -> nx_packet_append_ptr + 2;
-    send_packet -> nx_packet_length = 2;
+#ifdef NX_SECURE_TLS_ENABLE_RECORD_SIZE_LIMIT
+    /* Reply to a record_size_limit or max_fragment_length extension from the client. */
+    length = 2;
+    status = _nx_secure_tls_send_record_size_extensions(tls_session, send_packet -> nx_packet_append_ptr, &length,
+                                                        &extension_length,
+                                                        (ULONG)(send_packet -> nx_packet_data_end) -
+                                                        (ULONG)(send_packet -> nx_packet_append_ptr));
+    if (status != NX_SUCCESS)
+    {
+        return(status);
+    }
+#else
+    NX_PARAMETER_NOT_USED(tls_session);
+#endif /* NX_SECURE_TLS_ENABLE_RECORD_SIZE_LIMIT */
+
+    send_packet -> nx_packet_append_ptr[0] = (UCHAR)(extension_length >> 8);
+    send_packet -> nx_packet_append_ptr[1] = (UCHAR)(extension_length);
+    send_packet -> nx_packet_append_ptr = send_packet -> nx_packet_append_ptr + 2 + extension_length;
+    send_packet -> nx_packet_length = (ULONG)(2 + extension_length);
 
 
 
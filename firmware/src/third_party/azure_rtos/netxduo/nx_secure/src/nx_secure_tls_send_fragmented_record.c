@@ -0,0 +1,152 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Secure Component                                                 */
+/**                                                                       */
+/**    Transport Layer Security (TLS)                                     */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SECURE_SOURCE_CODE
+
+#include "nx_secure_tls.h"
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_secure_tls_send_fragmented_record               PORTABLE C      */
+/*                                                           6.1          */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function sends application data larger than the record size   */
+/*    negotiated with the remote host as several records, each no larger  */
+/*    than the limit. The data is copied into a new packet for each       */
+/*    record, and the packet passed in is released once all of the        */
+/*    records are sent. On error the caller keeps the packet. The caller  */
+/*    must hold the TLS protection mutex.                                 */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    tls_session                           TLS control block             */
+/*    send_packet                           Packet data to send           */
+/*    wait_option                           Indicates behavior if TCP     */
+/*                                          socket cannot send packet     */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_secure_tls_packet_allocate        Allocate internal TLS packet  */
+/*    _nx_secure_tls_send_record            Send TLS encrypted record     */
+/*    nx_packet_data_append                 Append data to packet         */
+/*    nx_secure_tls_packet_release          Release packet                */
+/*    tx_mutex_get                          Get protection mutex          */
+/*    tx_mutex_put                          Put protection mutex          */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_secure_tls_session_send           Send data over TLS session    */
+/*                                                                        */
+/*                                                                        */
+/**************************************************************************/
+#ifdef NX_SECURE_TLS_ENABLE_RECORD_SIZE_LIMIT
+UINT _nx_secure_tls_send_fragmented_record(NX_SECURE_TLS_SESSION *tls_session, NX_PACKET *send_packet,
+                                           ULONG wait_option)
+{
+UINT       status;
+NX_PACKET *fragment_packet;
+NX_PACKET *current_packet;
+UCHAR     *data_ptr;
+ULONG      remaining_length;
+ULONG      fragment_length;
+ULONG      copy_length;
+ULONG      copied_length;
+
+
+    status = NX_SUCCESS;
+    current_packet = send_packet;
+    data_ptr = send_packet -> nx_packet_prepend_ptr;
+    remaining_length = send_packet -> nx_packet_length;
+
+    while (remaining_length > 0)
+    {
+        fragment_length = tls_session -> nx_secure_tls_record_size_limit_send;
+        if ((fragment_length == 0) || (fragment_length > remaining_length))
+        {
+            fragment_length = remaining_length;
+        }
+
+        /* Don't hold the protection while waiting for packets. */
+        tx_mutex_put(&_nx_secure_tls_protection);
+
+        status = _nx_secure_tls_packet_allocate(tls_session, send_packet -> nx_packet_pool_owner,
+                                                &fragment_packet, wait_option);
+
+        /* Copy the next fragment of the data, which may span packets of a chain. */
+        copied_length = 0;
+        while ((status == NX_SUCCESS) && (copied_length < fragment_length))
+        {
+            while (data_ptr >= current_packet -> nx_packet_append_ptr)
+            {
+                current_packet = current_packet -> nx_packet_next;
+                data_ptr = current_packet -> nx_packet_prepend_ptr;
+            }
+
+            copy_length = (ULONG)(current_packet -> nx_packet_append_ptr - data_ptr);
+            if (copy_length > (fragment_length - copied_length))
+            {
+                copy_length = fragment_length - copied_length;
+            }
+
+            status = nx_packet_data_append(fragment_packet, data_ptr, copy_length,
+                                           send_packet -> nx_packet_pool_owner, wait_option);
+
+            if (status != NX_SUCCESS)
+            {
+                nx_secure_tls_packet_release(fragment_packet);
+            }
+
+            data_ptr += copy_length;
+            copied_length += copy_length;
+        }
+
+        tx_mutex_get(&_nx_secure_tls_protection, TX_WAIT_FOREVER);
+
+        if (status != NX_SUCCESS)
+        {
+            return(status);
+        }
+
+        status = _nx_secure_tls_send_record(tls_session, fragment_packet, NX_SECURE_TLS_APPLICATION_DATA, wait_option);
+
+        if (status != NX_SUCCESS)
+        {
+            nx_secure_tls_packet_release(fragment_packet);
+            return(status);
+        }
+
+        remaining_length -= fragment_length;
+    }
+
+    /* All of the data has been copied and sent. */
+    nx_secure_tls_packet_release(send_packet);
+
+    return(NX_SUCCESS);
+}
+#endif /* NX_SECURE_TLS_ENABLE_RECORD_SIZE_LIMIT */
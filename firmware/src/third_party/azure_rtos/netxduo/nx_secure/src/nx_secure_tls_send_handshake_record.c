@@ -138,6 +138,14 @@ UINT       buffer_offset;
             if (handshake_type == NX_SECURE_TLS_CLIENT_HELLO)
 #endif /* (NX_SECURE_TLS_TLS_1_3_ENABLED) */
             {
+                if ((buffer_offset + length) > sizeof(tls_session->nx_secure_tls_key_material.nx_secure_tls_handshake_cache))
+                {
+
+                    /* The message does not fit in the handshake cache. */
+                    nx_secure_tls_packet_release(send_packet);
+                    return(NX_SECURE_TLS_PACKET_BUFFER_TOO_SMALL);
+                }
+
                 NX_SECURE_MEMCPY(&tls_session->nx_secure_tls_key_material.nx_secure_tls_handshake_cache[buffer_offset],
                                  current_packet -> nx_packet_prepend_ptr, (UINT)length); /* Use case of memcpy is verified. */
 
@@ -0,0 +1,185 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Secure Component                                                 */
+/**                                                                       */
+/**    Transport Layer Security (TLS)                                     */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SECURE_SOURCE_CODE
+
+#include "nx_secure_tls.h"
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_secure_tls_send_record_size_extensions          PORTABLE C      */
+/*                                                           6.1          */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function adds the record_size_limit (RFC 8449) and             */
+/*    max_fragment_length (RFC 6066) extensions to an outgoing hello or   */
+/*    EncryptedExtensions message. A client offers both when the          */
+/*    application has set a record size limit, with max_fragment_length   */
+/*    for servers that don't support record_size_limit. A server replies  */
+/*    to the extension the client sent, preferring record_size_limit,     */
+/*    and sets the negotiated limits.                                     */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    tls_session                           TLS control block             */
+/*    packet_buffer                         Outgoing TLS packet           */
+/*    packet_offset                         Offset into packet buffer     */
+/*    extension_length                      Return length of data         */
+/*    available_size                        Available size of buffer      */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_secure_tls_record_size_limit_update                             */
+/*                                          Set negotiated record limits  */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_secure_tls_send_clienthello_extensions                          */
+/*                                          Send ClientHello extensions   */
+/*    _nx_secure_tls_send_encrypted_extensions                            */
+/*                                          Send EncryptedExtensions      */
+/*    _nx_secure_tls_send_serverhello_extensions                          */
+/*                                          Send ServerHello extensions   */
+/*                                                                        */
+/*                                                                        */
+/**************************************************************************/
+#ifdef NX_SECURE_TLS_ENABLE_RECORD_SIZE_LIMIT
+UINT _nx_secure_tls_send_record_size_extensions(NX_SECURE_TLS_SESSION *tls_session, UCHAR *packet_buffer,
+                                                ULONG *packet_offset, USHORT *extension_length,
+                                                ULONG available_size)
+{
+UINT   status;
+ULONG  offset;
+UINT   record_size_limit;
+UINT   max_record_size_limit;
+UCHAR  max_fragment_length;
+
+    /* Extension structures:
+     * |     2    |     2   |    2   |       |     2    |     2   |   1  |
+     * | Ext Type | Ext Len |  Limit |  ...  | Ext Type | Ext Len | Code |
+     */
+    record_size_limit = 0;
+    max_fragment_length = 0;
+
+    if (tls_session -> nx_secure_tls_socket_type == NX_SECURE_TLS_SESSION_TYPE_CLIENT)
+    {
+
+        /* Values from an earlier handshake don't apply to the reply to this hello. */
+        tls_session -> nx_secure_tls_remote_record_size_limit = 0;
+        tls_session -> nx_secure_tls_remote_max_fragment_length = 0;
+
+        record_size_limit = tls_session -> nx_secure_tls_record_size_limit;
+
+        /* Ask for the largest max_fragment_length not over the limit. */
+        if ((record_size_limit >= 512) && (record_size_limit < NX_SECURE_TLS_MAX_PLAINTEXT_LENGTH))
+        {
+            max_fragment_length = NX_SECURE_TLS_MAX_FRAGMENT_LENGTH_512;
+            while ((max_fragment_length < NX_SECURE_TLS_MAX_FRAGMENT_LENGTH_4096) &&
+                   (record_size_limit >= (512u << max_fragment_length)))
+            {
+                max_fragment_length++;
+            }
+        }
+    }
+    else
+    {
+
+        /* A server that receives both extensions uses record_size_limit (RFC 8449, Section 5). */
+        if (tls_session -> nx_secure_tls_remote_record_size_limit != 0)
+        {
+            max_record_size_limit = NX_SECURE_TLS_MAX_PLAINTEXT_LENGTH;
+#if (NX_SECURE_TLS_TLS_1_3_ENABLED)
+            if (tls_session -> nx_secure_tls_1_3)
+            {
+
+                /* The limit covers the inner content type byte in TLS 1.3. */
+                max_record_size_limit++;
+            }
+#endif
+
+            record_size_limit = tls_session -> nx_secure_tls_record_size_limit;
+            if ((record_size_limit == 0) || (record_size_limit > max_record_size_limit))
+            {
+                record_size_limit = max_record_size_limit;
+            }
+        }
+        else
+        {
+
+            /* Accept the length the client asked for. */
+            max_fragment_length = tls_session -> nx_secure_tls_remote_max_fragment_length;
+        }
+
+        status = _nx_secure_tls_record_size_limit_update(tls_session);
+        if (status != NX_SUCCESS)
+        {
+            return(status);
+        }
+
+        /* The values received from the client have been used. */
+        tls_session -> nx_secure_tls_remote_record_size_limit = 0;
+        tls_session -> nx_secure_tls_remote_max_fragment_length = 0;
+    }
+
+    offset = *packet_offset;
+
+    if (available_size < (offset + ((record_size_limit != 0) ? 6u : 0u) + ((max_fragment_length != 0) ? 5u : 0u)))
+    {
+
+        /* Packet buffer too small. */
+        return(NX_SECURE_TLS_PACKET_BUFFER_TOO_SMALL);
+    }
+
+    if (record_size_limit != 0)
+    {
+        packet_buffer[offset] = (UCHAR)(NX_SECURE_TLS_EXTENSION_RECORD_SIZE_LIMIT >> 8);
+        packet_buffer[offset + 1] = (UCHAR)(NX_SECURE_TLS_EXTENSION_RECORD_SIZE_LIMIT);
+        packet_buffer[offset + 2] = 0;
+        packet_buffer[offset + 3] = 2;
+        packet_buffer[offset + 4] = (UCHAR)(record_size_limit >> 8);
+        packet_buffer[offset + 5] = (UCHAR)(record_size_limit);
+        offset += 6;
+    }
+
+    if (max_fragment_length != 0)
+    {
+        packet_buffer[offset] = (UCHAR)(NX_SECURE_TLS_EXTENSION_MAX_FRAGMENT_LENGTH >> 8);
+        packet_buffer[offset + 1] = (UCHAR)(NX_SECURE_TLS_EXTENSION_MAX_FRAGMENT_LENGTH);
+        packet_buffer[offset + 2] = 0;
+        packet_buffer[offset + 3] = 1;
+        packet_buffer[offset + 4] = max_fragment_length;
+        offset += 5;
+    }
+
+    /* Return the total length of the extensions added. */
+    *extension_length = (USHORT)(offset - *packet_offset);
+    *packet_offset = offset;
+
+    return(NX_SUCCESS);
+}
+#endif /* NX_SECURE_TLS_ENABLE_RECORD_SIZE_LIMIT */
@@ -83,6 +83,8 @@ static UINT _nx_secure_tls_send_serverhello_psk_extension(NX_SECURE_TLS_SESSION
 /*                                            extension                   */
 /*    _nx_secure_tls_send_serverhello_ec_extension                        */
 /*                                          Send ClientHello EC extension */
+/*    _nx_secure_tls_send_record_size_extensions                          */
+/*                                          Send record size extensions   */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -104,9 +106,10 @@ UINT _nx_secure_tls_send_serverhello_extensions(NX_SECURE_TLS_SESSION *tls_sessi
 {
 ULONG  length = *packet_offset;
 UCHAR *extension_offset;
-#if !defined(NX_SECURE_TLS_DISABLE_SECURE_RENEGOTIATION) || ((NX_SECURE_TLS_TLS_1_3_ENABLED) && !defined(NX_SECURE_TLS_SERVER_DISABLED))
+#if !defined(NX_SECURE_TLS_DISABLE_SECURE_RENEGOTIATION) || ((NX_SECURE_TLS_TLS_1_3_ENABLED) && !defined(NX_SECURE_TLS_SERVER_DISABLED)) || \
+    defined(NX_SECURE_TLS_ENABLE_RECORD_SIZE_LIMIT)
 USHORT extension_length = 0;
-#endif /* !defined(NX_SECURE_TLS_DISABLE_SECURE_RENEGOTIATION) || (NX_SECURE_TLS_TLS_1_3_ENABLED)  */
+#endif /* !defined(NX_SECURE_TLS_DISABLE_SECURE_RENEGOTIATION) || (NX_SECURE_TLS_TLS_1_3_ENABLED) || NX_SECURE_TLS_ENABLE_RECORD_SIZE_LIMIT */
 USHORT total_extensions_length;
 UINT   status = NX_SUCCESS;
 
@@ -147,6 +150,23 @@ UINT   status = NX_SUCCESS;
     }
 #endif /* NX_SECURE_TLS_DISABLE_SECURE_RENEGOTIATION */
 
+#ifdef NX_SECURE_TLS_ENABLE_RECORD_SIZE_LIMIT
+#if (NX_SECURE_TLS_TLS_1_3_ENABLED) && !defined(NX_SECURE_TLS_SERVER_DISABLED)
+    /* TLS 1.3 servers reply in EncryptedExtensions instead. */
+    if(!tls_session->nx_secure_tls_1_3)
+#endif
+    {
+        /* Reply to a record_size_limit or max_fragment_length extension from the client. */
+        status = _nx_secure_tls_send_record_size_extensions(tls_session, packet_buffer, &length,
+                                                            &extension_length, available_size);
+        total_extensions_length = (USHORT)(total_extensions_length + extension_length);
+
+        if(status != NX_SUCCESS)
+        {
+            return(status);
+        }
+    }
+#endif /* NX_SECURE_TLS_ENABLE_RECORD_SIZE_LIMIT */
 
 #if (NX_SECURE_TLS_TLS_1_3_ENABLED) && !defined(NX_SECURE_TLS_SERVER_DISABLED)
     if(tls_session->nx_secure_tls_1_3)
@@ -0,0 +1,85 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Secure Component                                                 */
+/**                                                                       */
+/**    Transport Layer Security (TLS)                                     */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SECURE_SOURCE_CODE
+
+#include "nx_secure_tls.h"
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_secure_tls_session_cache_create                 PORTABLE C      */
+/*                                                           6.1          */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function initializes a cache of TLS client sessions that can   */
+/*    be resumed with the session ID issued by a TLS server. The entries  */
+/*    are placed in the buffer supplied by the application. The optional */
+/*    update callback is invoked whenever an entry is stored or removed  */
+/*    so the application can keep a copy in non-volatile storage.         */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    cache                                 Session cache control block   */
+/*    entry_buffer                          Buffer for the cache entries  */
+/*    buffer_size                           Size of the entry buffer      */
+/*    update_callback                       Callback on entry changes     */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    tx_mutex_get                          Get protection mutex          */
+/*    tx_mutex_put                          Put protection mutex          */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*                                                                        */
+/**************************************************************************/
+#ifdef NX_SECURE_TLS_ENABLE_CLIENT_SESSION_CACHE
+UINT _nx_secure_tls_session_cache_create(NX_SECURE_TLS_SESSION_CACHE *cache, VOID *entry_buffer, ULONG buffer_size,
+                                         UINT (*update_callback)(NX_SECURE_TLS_SESSION_CACHE *cache,
+                                                                 NX_SECURE_TLS_SESSION_CACHE_ENTRY *entry))
+{
+
+    /* Get the protection. */
+    tx_mutex_get(&_nx_secure_tls_protection, TX_WAIT_FOREVER);
+
+    /* All entries start out free. */
+    NX_SECURE_MEMSET(entry_buffer, 0, buffer_size);
+
+    cache -> nx_secure_tls_session_cache_entries = (NX_SECURE_TLS_SESSION_CACHE_ENTRY *)entry_buffer;
+    cache -> nx_secure_tls_session_cache_entry_count = (UINT)(buffer_size / sizeof(NX_SECURE_TLS_SESSION_CACHE_ENTRY));
+    cache -> nx_secure_tls_session_cache_sequence = 0;
+    cache -> nx_secure_tls_session_cache_update_callback = update_callback;
+
+    /* Release the protection. */
+    tx_mutex_put(&_nx_secure_tls_protection);
+
+    return(NX_SUCCESS);
+}
+#endif /* NX_SECURE_TLS_ENABLE_CLIENT_SESSION_CACHE */
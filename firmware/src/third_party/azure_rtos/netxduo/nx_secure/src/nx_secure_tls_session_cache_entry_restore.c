@@ -0,0 +1,91 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Secure Component                                                 */
+/**                                                                       */
+/**    Transport Layer Security (TLS)                                     */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SECURE_SOURCE_CODE
+
+#include "nx_secure_tls.h"
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_secure_tls_session_cache_entry_restore          PORTABLE C      */
+/*                                                           6.1          */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function puts an entry saved by the application, for example  */
+/*    from non-volatile storage after a reboot, back into a TLS client    */
+/*    session cache. The entry replaces any entry for the same server,    */
+/*    otherwise it takes a free entry or the oldest entry in the cache.   */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    cache                                 Session cache control block   */
+/*    entry                                 Saved cache entry             */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_secure_tls_session_cache_entry_select                           */
+/*                                          Select a cache entry          */
+/*    tx_mutex_get                          Get protection mutex          */
+/*    tx_mutex_put                          Put protection mutex          */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*                                                                        */
+/**************************************************************************/
+#ifdef NX_SECURE_TLS_ENABLE_CLIENT_SESSION_CACHE
+UINT _nx_secure_tls_session_cache_entry_restore(NX_SECURE_TLS_SESSION_CACHE *cache,
+                                                NX_SECURE_TLS_SESSION_CACHE_ENTRY *entry)
+{
+NX_SECURE_TLS_SESSION_CACHE_ENTRY *selected_entry;
+
+    /* Get the protection. */
+    tx_mutex_get(&_nx_secure_tls_protection, TX_WAIT_FOREVER);
+
+    /* Use the entry for the same server if there is one, else a free entry, else the oldest entry. */
+    selected_entry = _nx_secure_tls_session_cache_entry_select(cache, entry -> nx_secure_tls_session_cache_server_name,
+                                                               entry -> nx_secure_tls_session_cache_server_name_length);
+
+    if (selected_entry != NX_NULL)
+    {
+        NX_SECURE_MEMCPY(selected_entry, entry, sizeof(NX_SECURE_TLS_SESSION_CACHE_ENTRY)); /* Use case of memcpy is verified. */
+
+        /* Keep entries stored from now on newer than the restored ones. */
+        if (cache -> nx_secure_tls_session_cache_sequence < entry -> nx_secure_tls_session_cache_sequence)
+        {
+            cache -> nx_secure_tls_session_cache_sequence = entry -> nx_secure_tls_session_cache_sequence;
+        }
+    }
+
+    /* Release the protection. */
+    tx_mutex_put(&_nx_secure_tls_protection);
+
+    return(NX_SUCCESS);
+}
+#endif /* NX_SECURE_TLS_ENABLE_CLIENT_SESSION_CACHE */
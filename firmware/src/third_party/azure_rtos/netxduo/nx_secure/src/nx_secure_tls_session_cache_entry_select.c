@@ -0,0 +1,94 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Secure Component                                                 */
+/**                                                                       */
+/**    Transport Layer Security (TLS)                                     */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SECURE_SOURCE_CODE
+
+#include "nx_secure_tls.h"
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_secure_tls_session_cache_entry_select           PORTABLE C      */
+/*                                                           6.1          */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function selects the session cache entry to store a session   */
+/*    for the given server in: the entry already used for that server if  */
+/*    there is one, else a free entry, else the least recently stored     */
+/*    entry.                                                              */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    cache                                 Session cache                 */
+/*    server_name                           Name of the server            */
+/*    server_name_length                    Length of the server name     */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    entry                                 Selected entry, NX_NULL if    */
+/*                                            the cache has no entries    */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_secure_tls_session_cache_entry_restore                          */
+/*                                          Restore a saved session       */
+/*    _nx_secure_tls_session_cache_store    Save a TLS 1.2 session        */
+/*    _nx_secure_tls_session_cache_ticket_store                           */
+/*                                          Save a TLS 1.3 session ticket */
+/*                                                                        */
+/*                                                                        */
+/**************************************************************************/
+#ifdef NX_SECURE_TLS_ENABLE_CLIENT_SESSION_CACHE
+NX_SECURE_TLS_SESSION_CACHE_ENTRY *_nx_secure_tls_session_cache_entry_select(NX_SECURE_TLS_SESSION_CACHE *cache,
+                                                                            const UCHAR *server_name,
+                                                                            UINT server_name_length)
+{
+UINT                               i;
+NX_SECURE_TLS_SESSION_CACHE_ENTRY *cache_entry;
+NX_SECURE_TLS_SESSION_CACHE_ENTRY *selected_entry = NX_NULL;
+
+    for (i = 0; i < cache -> nx_secure_tls_session_cache_entry_count; i++)
+    {
+        cache_entry = &cache -> nx_secure_tls_session_cache_entries[i];
+
+        if ((cache_entry -> nx_secure_tls_session_cache_server_name_length == server_name_length) &&
+            (NX_SECURE_MEMCMP(cache_entry -> nx_secure_tls_session_cache_server_name, server_name, server_name_length) == 0))
+        {
+            return(cache_entry);
+        }
+
+        if ((selected_entry == NX_NULL) ||
+            ((selected_entry -> nx_secure_tls_session_cache_server_name_length != 0) &&
+             ((cache_entry -> nx_secure_tls_session_cache_server_name_length == 0) ||
+              (cache_entry -> nx_secure_tls_session_cache_sequence < selected_entry -> nx_secure_tls_session_cache_sequence))))
+        {
+            selected_entry = cache_entry;
+        }
+    }
+
+    return(selected_entry);
+}
+#endif /* NX_SECURE_TLS_ENABLE_CLIENT_SESSION_CACHE */
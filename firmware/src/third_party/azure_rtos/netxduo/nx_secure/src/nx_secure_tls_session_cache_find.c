@@ -0,0 +1,119 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Secure Component                                                 */
+/**                                                                       */
+/**    Transport Layer Security (TLS)                                     */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SECURE_SOURCE_CODE
+
+#include "nx_secure_tls.h"
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_secure_tls_session_cache_find                   PORTABLE C      */
+/*                                                           6.1          */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function looks up the cache entry for the server a TLS client  */
+/*    session connects to. An entry older than the session cache          */
+/*    lifetime, or a session ticket past the lifetime set by the server,  */
+/*    is removed instead of being returned.                               */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    tls_session                           TLS control block             */
+/*    entry                                 Return the cache entry        */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    [nx_secure_tls_session_time_function] Get the current time          */
+/*    [nx_secure_tls_session_cache_update_callback]                       */
+/*                                          Notify the application        */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_secure_tls_send_clienthello       Send TLS ClientHello          */
+/*    _nx_secure_tls_session_cache_remove   Remove a cached session       */
+/*                                                                        */
+/*                                                                        */
+/**************************************************************************/
+#ifdef NX_SECURE_TLS_ENABLE_CLIENT_SESSION_CACHE
+UINT _nx_secure_tls_session_cache_find(NX_SECURE_TLS_SESSION *tls_session,
+                                       NX_SECURE_TLS_SESSION_CACHE_ENTRY **entry)
+{
+UINT                               i;
+ULONG                              current_time;
+NX_SECURE_TLS_SESSION_CACHE       *cache = tls_session -> nx_secure_tls_session_cache;
+NX_SECURE_TLS_SESSION_CACHE_ENTRY *cache_entry;
+
+    if (cache == NX_NULL)
+    {
+        return(NX_NOT_FOUND);
+    }
+
+    for (i = 0; i < cache -> nx_secure_tls_session_cache_entry_count; i++)
+    {
+        cache_entry = &cache -> nx_secure_tls_session_cache_entries[i];
+
+        if ((cache_entry -> nx_secure_tls_session_cache_server_name_length != tls_session -> nx_secure_tls_session_cache_server_name_length) ||
+            (NX_SECURE_MEMCMP(cache_entry -> nx_secure_tls_session_cache_server_name, tls_session -> nx_secure_tls_session_cache_server_name,
+                              tls_session -> nx_secure_tls_session_cache_server_name_length) != 0))
+        {
+            continue;
+        }
+
+        /* Without a time source, cached sessions are kept until replaced or rejected by the server. */
+        if (tls_session -> nx_secure_tls_session_time_function != NX_NULL)
+        {
+            current_time = tls_session -> nx_secure_tls_session_time_function();
+
+            if (((current_time - cache_entry -> nx_secure_tls_session_cache_timestamp) > NX_SECURE_TLS_SESSION_CACHE_LIFETIME)
+#if (NX_SECURE_TLS_TLS_1_3_ENABLED)
+                /* A session ticket also expires at the end of the lifetime set by the server. */
+                || ((cache_entry -> nx_secure_tls_session_cache_ticket_length != 0) &&
+                    ((current_time - cache_entry -> nx_secure_tls_session_cache_timestamp) >= cache_entry -> nx_secure_tls_session_cache_ticket_lifetime))
+#endif /* NX_SECURE_TLS_TLS_1_3_ENABLED */
+               )
+            {
+
+                /* The session has expired, free the entry. */
+                NX_SECURE_MEMSET(cache_entry, 0, sizeof(NX_SECURE_TLS_SESSION_CACHE_ENTRY));
+
+                if (cache -> nx_secure_tls_session_cache_update_callback != NX_NULL)
+                {
+                    cache -> nx_secure_tls_session_cache_update_callback(cache, cache_entry);
+                }
+
+                return(NX_NOT_FOUND);
+            }
+        }
+
+        *entry = cache_entry;
+        return(NX_SUCCESS);
+    }
+
+    return(NX_NOT_FOUND);
+}
+#endif /* NX_SECURE_TLS_ENABLE_CLIENT_SESSION_CACHE */
@@ -0,0 +1,88 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Secure Component                                                 */
+/**                                                                       */
+/**    Transport Layer Security (TLS)                                     */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SECURE_SOURCE_CODE
+
+#include "nx_secure_tls.h"
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_secure_tls_session_cache_remove                 PORTABLE C      */
+/*                                                           6.1          */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function removes the cached session of the server a TLS client */
+/*    session connects to. It is called when a handshake fails or the     */
+/*    server sends a fatal alert, so a broken session is not offered      */
+/*    again.                                                              */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    tls_session                           TLS control block             */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_secure_tls_session_cache_find     Find the cache entry          */
+/*    [nx_secure_tls_session_cache_update_callback]                       */
+/*                                          Notify the application        */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_secure_tls_client_handshake       TLS client state machine      */
+/*    _nx_secure_tls_process_record         Process TLS record            */
+/*    _nx_secure_tls_session_receive_records                              */
+/*                                          Receive TLS records           */
+/*                                                                        */
+/*                                                                        */
+/**************************************************************************/
+#ifdef NX_SECURE_TLS_ENABLE_CLIENT_SESSION_CACHE
+UINT _nx_secure_tls_session_cache_remove(NX_SECURE_TLS_SESSION *tls_session)
+{
+UINT                               status;
+NX_SECURE_TLS_SESSION_CACHE       *cache = tls_session -> nx_secure_tls_session_cache;
+NX_SECURE_TLS_SESSION_CACHE_ENTRY *cache_entry;
+
+    status = _nx_secure_tls_session_cache_find(tls_session, &cache_entry);
+
+    if (status != NX_SUCCESS)
+    {
+
+        /* Nothing cached for this server. */
+        return(NX_SUCCESS);
+    }
+
+    NX_SECURE_MEMSET(cache_entry, 0, sizeof(NX_SECURE_TLS_SESSION_CACHE_ENTRY));
+
+    if (cache -> nx_secure_tls_session_cache_update_callback != NX_NULL)
+    {
+        status = cache -> nx_secure_tls_session_cache_update_callback(cache, cache_entry);
+    }
+
+    return(status);
+}
+#endif /* NX_SECURE_TLS_ENABLE_CLIENT_SESSION_CACHE */
@@ -0,0 +1,75 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Secure Component                                                 */
+/**                                                                       */
+/**    Transport Layer Security (TLS)                                     */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SECURE_SOURCE_CODE
+
+#include "nx_secure_tls.h"
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_secure_tls_session_cache_set                    PORTABLE C      */
+/*                                                           6.1          */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function assigns a session cache to a TLS client session. The  */
+/*    server name selects the cache entry: a session stored for the name  */
+/*    is offered for resumption in the ClientHello, and the session       */
+/*    negotiated by a full handshake is stored under the name. The name   */
+/*    is not copied and must remain valid while the session is in use.    */
+/*    Passing a NULL cache stops the TLS session from using the cache.    */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    tls_session                           TLS control block             */
+/*    cache                                 Session cache control block   */
+/*    server_name                           Name of the remote server     */
+/*    server_name_length                    Length of the server name     */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*                                                                        */
+/**************************************************************************/
+#ifdef NX_SECURE_TLS_ENABLE_CLIENT_SESSION_CACHE
+UINT _nx_secure_tls_session_cache_set(NX_SECURE_TLS_SESSION *tls_session, NX_SECURE_TLS_SESSION_CACHE *cache,
+                                      const UCHAR *server_name, UINT server_name_length)
+{
+
+    /* Set the cache and the name used to look up entries for this TLS session. */
+    tls_session -> nx_secure_tls_session_cache = cache;
+    tls_session -> nx_secure_tls_session_cache_server_name = server_name;
+    tls_session -> nx_secure_tls_session_cache_server_name_length = server_name_length;
+
+    return(NX_SUCCESS);
+}
+#endif /* NX_SECURE_TLS_ENABLE_CLIENT_SESSION_CACHE */
@@ -0,0 +1,124 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Secure Component                                                 */
+/**                                                                       */
+/**    Transport Layer Security (TLS)                                     */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SECURE_SOURCE_CODE
+
+#include "nx_secure_tls.h"
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_secure_tls_session_cache_store                  PORTABLE C      */
+/*                                                           6.1          */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function saves the session ID and master secret of a TLS 1.2  */
+/*    or earlier client session after a successful full handshake, so the */
+/*    next connection to the same server can resume the session. Nothing  */
+/*    is stored if the server did not issue a session ID.                 */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    tls_session                           TLS control block             */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_secure_tls_session_cache_entry_select                           */
+/*                                          Select a cache entry          */
+/*    [nx_secure_tls_session_time_function] Get the current time          */
+/*    [nx_secure_tls_session_cache_update_callback]                       */
+/*                                          Notify the application        */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_secure_tls_client_handshake       TLS client state machine      */
+/*                                                                        */
+/*                                                                        */
+/**************************************************************************/
+#ifdef NX_SECURE_TLS_ENABLE_CLIENT_SESSION_CACHE
+UINT _nx_secure_tls_session_cache_store(NX_SECURE_TLS_SESSION *tls_session)
+{
+UINT                               status = NX_SUCCESS;
+NX_SECURE_TLS_SESSION_CACHE       *cache = tls_session -> nx_secure_tls_session_cache;
+NX_SECURE_TLS_SESSION_CACHE_ENTRY *selected_entry;
+
+    if ((cache == NX_NULL) || (tls_session -> nx_secure_tls_session_ciphersuite == NX_NULL) ||
+        (tls_session -> nx_secure_tls_session_id_length == 0) ||
+        (tls_session -> nx_secure_tls_session_id_length > NX_SECURE_TLS_SESSION_CACHE_ID_SIZE))
+    {
+
+        /* The session cannot be resumed. */
+        return(NX_SUCCESS);
+    }
+
+#if (NX_SECURE_TLS_TLS_1_3_ENABLED)
+    if (tls_session -> nx_secure_tls_1_3)
+    {
+
+        /* TLS 1.3 resumes sessions with tickets instead. */
+        return(NX_SUCCESS);
+    }
+#endif
+
+    /* Use the entry for the same server if there is one, else a free entry, else the oldest entry. */
+    selected_entry = _nx_secure_tls_session_cache_entry_select(cache, tls_session -> nx_secure_tls_session_cache_server_name,
+                                                               tls_session -> nx_secure_tls_session_cache_server_name_length);
+
+    if (selected_entry == NX_NULL)
+    {
+
+        /* The cache has no entries. */
+        return(NX_SUCCESS);
+    }
+
+    NX_SECURE_MEMSET(selected_entry, 0, sizeof(NX_SECURE_TLS_SESSION_CACHE_ENTRY));
+    NX_SECURE_MEMCPY(selected_entry -> nx_secure_tls_session_cache_server_name, tls_session -> nx_secure_tls_session_cache_server_name,
+                     tls_session -> nx_secure_tls_session_cache_server_name_length); /* Use case of memcpy is verified. */
+    selected_entry -> nx_secure_tls_session_cache_server_name_length = (USHORT)tls_session -> nx_secure_tls_session_cache_server_name_length;
+    selected_entry -> nx_secure_tls_session_cache_protocol_version = tls_session -> nx_secure_tls_protocol_version;
+    selected_entry -> nx_secure_tls_session_cache_ciphersuite = tls_session -> nx_secure_tls_session_ciphersuite -> nx_secure_tls_ciphersuite;
+    selected_entry -> nx_secure_tls_session_cache_session_id_length = tls_session -> nx_secure_tls_session_id_length;
+    NX_SECURE_MEMCPY(selected_entry -> nx_secure_tls_session_cache_session_id, tls_session -> nx_secure_tls_session_id,
+                     tls_session -> nx_secure_tls_session_id_length); /* Use case of memcpy is verified. */
+    NX_SECURE_MEMCPY(selected_entry -> nx_secure_tls_session_cache_master_secret, tls_session -> nx_secure_tls_key_material.nx_secure_tls_master_secret,
+                     NX_SECURE_TLS_MASTER_SIZE); /* Use case of memcpy is verified. */
+
+    selected_entry -> nx_secure_tls_session_cache_timestamp = 0;
+    if (tls_session -> nx_secure_tls_session_time_function != NX_NULL)
+    {
+        selected_entry -> nx_secure_tls_session_cache_timestamp = tls_session -> nx_secure_tls_session_time_function();
+    }
+    selected_entry -> nx_secure_tls_session_cache_sequence = ++cache -> nx_secure_tls_session_cache_sequence;
+
+    if (cache -> nx_secure_tls_session_cache_update_callback != NX_NULL)
+    {
+        status = cache -> nx_secure_tls_session_cache_update_callback(cache, selected_entry);
+    }
+
+    return(status);
+}
+#endif /* NX_SECURE_TLS_ENABLE_CLIENT_SESSION_CACHE */
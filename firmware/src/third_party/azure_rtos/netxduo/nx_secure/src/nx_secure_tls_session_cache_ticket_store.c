@@ -0,0 +1,126 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Secure Component                                                 */
+/**                                                                       */
+/**    Transport Layer Security (TLS)                                     */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SECURE_SOURCE_CODE
+
+#include "nx_secure_tls.h"
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_secure_tls_session_cache_ticket_store           PORTABLE C      */
+/*                                                           6.1          */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function saves a session ticket received in a TLS 1.3          */
+/*    NewSessionTicket message together with the PSK derived for it, so   */
+/*    the next connection to the same server can resume the session. A    */
+/*    ticket replaces any session cached earlier for the server. Tickets  */
+/*    with a zero lifetime or too large for the cache are not stored.     */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    tls_session                           TLS control block             */
+/*    ticket_lifetime                       Ticket lifetime in seconds    */
+/*    ticket_age_add                        Ticket age obfuscation value  */
+/*    ticket                                Session ticket                */
+/*    ticket_length                         Length of session ticket      */
+/*    psk                                   PSK derived for the ticket    */
+/*    psk_length                            Length of the PSK             */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_secure_tls_session_cache_entry_select                           */
+/*                                          Select a cache entry          */
+/*    [nx_secure_tls_session_time_function] Get the current time          */
+/*    [nx_secure_tls_session_cache_update_callback]                       */
+/*                                          Notify the application        */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_secure_tls_process_newsessionticket                             */
+/*                                          Process NewSessionTicket      */
+/*                                                                        */
+/*                                                                        */
+/**************************************************************************/
+#if defined(NX_SECURE_TLS_ENABLE_CLIENT_SESSION_CACHE) && (NX_SECURE_TLS_TLS_1_3_ENABLED)
+UINT _nx_secure_tls_session_cache_ticket_store(NX_SECURE_TLS_SESSION *tls_session, ULONG ticket_lifetime,
+                                               ULONG ticket_age_add, const UCHAR *ticket, UINT ticket_length,
+                                               const UCHAR *psk, UINT psk_length)
+{
+UINT                               status = NX_SUCCESS;
+NX_SECURE_TLS_SESSION_CACHE       *cache = tls_session -> nx_secure_tls_session_cache;
+NX_SECURE_TLS_SESSION_CACHE_ENTRY *selected_entry;
+
+    if ((cache == NX_NULL) || (tls_session -> nx_secure_tls_session_ciphersuite == NX_NULL) ||
+        (ticket_lifetime == 0) || (ticket_length == 0) ||
+        (ticket_length > NX_SECURE_TLS_SESSION_CACHE_TICKET_SIZE) ||
+        (psk_length > NX_SECURE_TLS_MASTER_SIZE))
+    {
+
+        /* The ticket cannot be used for resumption. */
+        return(NX_SUCCESS);
+    }
+
+    /* Use the entry for the same server if there is one, else a free entry, else the oldest entry. */
+    selected_entry = _nx_secure_tls_session_cache_entry_select(cache, tls_session -> nx_secure_tls_session_cache_server_name,
+                                                               tls_session -> nx_secure_tls_session_cache_server_name_length);
+
+    if (selected_entry == NX_NULL)
+    {
+
+        /* The cache has no entries. */
+        return(NX_SUCCESS);
+    }
+
+    NX_SECURE_MEMSET(selected_entry, 0, sizeof(NX_SECURE_TLS_SESSION_CACHE_ENTRY));
+    NX_SECURE_MEMCPY(selected_entry -> nx_secure_tls_session_cache_server_name, tls_session -> nx_secure_tls_session_cache_server_name,
+                     tls_session -> nx_secure_tls_session_cache_server_name_length); /* Use case of memcpy is verified. */
+    selected_entry -> nx_secure_tls_session_cache_server_name_length = (USHORT)tls_session -> nx_secure_tls_session_cache_server_name_length;
+    selected_entry -> nx_secure_tls_session_cache_protocol_version = NX_SECURE_TLS_VERSION_TLS_1_3;
+    selected_entry -> nx_secure_tls_session_cache_ciphersuite = tls_session -> nx_secure_tls_session_ciphersuite -> nx_secure_tls_ciphersuite;
+    NX_SECURE_MEMCPY(selected_entry -> nx_secure_tls_session_cache_master_secret, psk, psk_length); /* Use case of memcpy is verified. */
+    selected_entry -> nx_secure_tls_session_cache_ticket_lifetime = ticket_lifetime;
+    selected_entry -> nx_secure_tls_session_cache_ticket_age_add = ticket_age_add;
+    selected_entry -> nx_secure_tls_session_cache_ticket_length = (USHORT)ticket_length;
+    NX_SECURE_MEMCPY(selected_entry -> nx_secure_tls_session_cache_ticket, ticket, ticket_length); /* Use case of memcpy is verified. */
+
+    /* The age of the ticket is counted from the time it is received. */
+    selected_entry -> nx_secure_tls_session_cache_timestamp = 0;
+    if (tls_session -> nx_secure_tls_session_time_function != NX_NULL)
+    {
+        selected_entry -> nx_secure_tls_session_cache_timestamp = tls_session -> nx_secure_tls_session_time_function();
+    }
+    selected_entry -> nx_secure_tls_session_cache_sequence = ++cache -> nx_secure_tls_session_cache_sequence;
+
+    if (cache -> nx_secure_tls_session_cache_update_callback != NX_NULL)
+    {
+        status = cache -> nx_secure_tls_session_cache_update_callback(cache, selected_entry);
+    }
+
+    return(status);
+}
+#endif /* NX_SECURE_TLS_ENABLE_CLIENT_SESSION_CACHE && NX_SECURE_TLS_TLS_1_3_ENABLED */
@@ -54,6 +54,7 @@
 /*                                                                        */
 /*    _nx_secure_tls_packet_allocate        Allocate internal TLS packet  */
 /*    _nx_secure_tls_send_alert             Generate the CloseNotify      */
+/*    _nx_secure_tls_send_coalesced_record  Send held application data    */
 /*    _nx_secure_tls_send_record            Send the CloseNotify          */
 /*    _nx_secure_tls_session_reset          Clear out the session         */
 /*    nx_secure_tls_packet_release          Release packet                */
@@ -120,6 +121,31 @@ NX_PACKET *tmp_ptr;
 
     if (send_close_notify)
     {
+#ifdef NX_SECURE_TLS_ENABLE_SEND_COALESCING
+        /* Application data held back for coalescing is sent ahead of the close-notify. */
+        status = _nx_secure_tls_send_coalesced_record(tls_session, wait_option);
+
+        if (status != NX_SUCCESS)
+        {
+
+            /* Release the protection. */
+            tx_mutex_put(&_nx_secure_tls_protection);
+
+            /* Save the return status before resetting the TLS session. */
+            error_return = status;
+
+            /* Reset the TLS state so this socket can be reused. */
+            status = _nx_secure_tls_session_reset(tls_session);
+
+            if(status != NX_SUCCESS)
+            {
+                return(status);
+            }
+
+            return(error_return);
+        }
+#endif /* NX_SECURE_TLS_ENABLE_SEND_COALESCING */
+
         /* Release the protection before suspending on nx_packet_allocate. */
         tx_mutex_put(&_nx_secure_tls_protection);
 
@@ -58,6 +58,7 @@
 /*    _nx_secure_tls_process_record         Process TLS record data       */
 /*    _nx_secure_tls_send_alert             Send TLS alert                */
 /*    _nx_secure_tls_send_record            Send the TLS record           */
+/*    _nx_secure_tls_session_cache_remove   Remove cached session         */
 /*    nx_secure_tls_packet_release          Release packet                */
 /*    nx_tcp_socket_receive                 Receive TCP data              */
 /*    tx_mutex_get                          Get protection mutex          */
@@ -149,51 +150,56 @@ UCHAR          handshake_finished = NX_FALSE;
     if (status == NX_SUCCESS || status == NX_SECURE_TLS_POST_HANDSHAKE_RECEIVED)
     {
 
-        /* Remove processed packets. Data in released packet will be cleared by nx_secure_tls_packet_release. */
-        tls_session -> nx_secure_record_queue_header -> nx_packet_length -= bytes_processed;
-        current_packet = tls_session -> nx_secure_record_queue_header;
-        previous_packet = NX_NULL;
-        while (current_packet)
+        /* The queue is empty if the packet holding the last record was returned as it is. */
+        if (tls_session -> nx_secure_record_queue_header)
         {
-            packet_fragment_length = (ULONG)(current_packet -> nx_packet_append_ptr) - (ULONG)(current_packet -> nx_packet_prepend_ptr);
 
-            /* Determine if all data in the current fragment have been processed. */
-            if (packet_fragment_length <= bytes_processed)
+            /* Remove processed packets. Data in released packet will be cleared by nx_secure_tls_packet_release. */
+            tls_session -> nx_secure_record_queue_header -> nx_packet_length -= bytes_processed;
+            current_packet = tls_session -> nx_secure_record_queue_header;
+            previous_packet = NX_NULL;
+            while (current_packet)
             {
-                bytes_processed -= packet_fragment_length;
+                packet_fragment_length = (ULONG)(current_packet -> nx_packet_append_ptr) - (ULONG)(current_packet -> nx_packet_prepend_ptr);
+
+                /* Determine if all data in the current fragment have been processed. */
+                if (packet_fragment_length <= bytes_processed)
+                {
+                    bytes_processed -= packet_fragment_length;
+                }
+                else
+                {
+                    current_packet -> nx_packet_prepend_ptr += bytes_processed;
+                    bytes_processed = 0;
+                    break;
+                }
+                previous_packet = current_packet;
+                current_packet = current_packet -> nx_packet_next;
             }
-            else
+
+            if (!current_packet)
             {
-                current_packet -> nx_packet_prepend_ptr += bytes_processed;
-                bytes_processed = 0;
-                break;
+                nx_secure_tls_packet_release(tls_session -> nx_secure_record_queue_header);
+                tls_session -> nx_secure_record_queue_header = NX_NULL;
             }
-            previous_packet = current_packet;
-            current_packet = current_packet -> nx_packet_next;
-        }
-
-        if (!current_packet)
-        {
-            nx_secure_tls_packet_release(tls_session -> nx_secure_record_queue_header);
-            tls_session -> nx_secure_record_queue_header = NX_NULL;
-        }
-        else if (previous_packet)
-        {
+            else if (previous_packet)
+            {
 
-            /* Release trimmed packets. */
-            /* Packets from tls_session -> nx_secure_record_queue_header till previous_packet can be trimmed. */
-            previous_packet -> nx_packet_next = NX_NULL;
+                /* Release trimmed packets. */
+                /* Packets from tls_session -> nx_secure_record_queue_header till previous_packet can be trimmed. */
+                previous_packet -> nx_packet_next = NX_NULL;
 
-            /* Update the length and last packet of remaining packets. */
-            current_packet -> nx_packet_length = tls_session -> nx_secure_record_queue_header -> nx_packet_length;
-            current_packet -> nx_packet_last = tls_session -> nx_secure_record_queue_header -> nx_packet_last;
+                /* Update the length and last packet of remaining packets. */
+                current_packet -> nx_packet_length = tls_session -> nx_secure_record_queue_header -> nx_packet_length;
+                current_packet -> nx_packet_last = tls_session -> nx_secure_record_queue_header -> nx_packet_last;
 
-            /* Correct the last packet to be trimmed. */
-            tls_session -> nx_secure_record_queue_header -> nx_packet_last = previous_packet;
-            nx_secure_tls_packet_release(tls_session -> nx_secure_record_queue_header);
+                /* Correct the last packet to be trimmed. */
+                tls_session -> nx_secure_record_queue_header -> nx_packet_last = previous_packet;
+                nx_secure_tls_packet_release(tls_session -> nx_secure_record_queue_header);
 
-            /* Update the remaining packets. */
-            tls_session -> nx_secure_record_queue_header = current_packet;
+                /* Update the remaining packets. */
+                tls_session -> nx_secure_record_queue_header = current_packet;
+            }
         }
 
         if (bytes_processed)
@@ -221,7 +227,9 @@ UCHAR          handshake_finished = NX_FALSE;
         }
 #endif /* NX_SECURE_TLS_CLIENT_DISABLED */
 
-        if (handshake_finished)
+        /* Post-handshake messages are consumed by TLS; leave the decrypted record in the session
+           so it is released with the next record rather than returned to the caller. */
+        if (handshake_finished && (status == NX_SUCCESS))
         {
             if (tls_session -> nx_secure_record_decrypted_packet == NX_NULL)
             {
@@ -253,6 +261,16 @@ UCHAR          handshake_finished = NX_FALSE;
         if (tls_session -> nx_secure_tls_socket_type == NX_SECURE_TLS_SESSION_TYPE_CLIENT)
         {
             tls_session -> nx_secure_tls_client_state = NX_SECURE_TLS_CLIENT_STATE_ERROR;
+
+#ifdef NX_SECURE_TLS_ENABLE_CLIENT_SESSION_CACHE
+            /* The fatal alert sent below ends the session (RFC 5246, Section 7.2.2). Records that
+               fail to decrypt or arrive out of order never reach the client state machine, so the
+               cached entry is dropped here. */
+            if ((error_number != NX_SECURE_TLS_ALERT_RECEIVED) && (alert_level == NX_SECURE_TLS_ALERT_LEVEL_FATAL))
+            {
+                _nx_secure_tls_session_cache_remove(tls_session);
+            }
+#endif /* NX_SECURE_TLS_ENABLE_CLIENT_SESSION_CACHE */
         }
 #endif
 
@@ -0,0 +1,91 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Secure Component                                                 */
+/**                                                                       */
+/**    Transport Layer Security (TLS)                                     */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SECURE_SOURCE_CODE
+
+#include "nx_secure_tls.h"
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_secure_tls_session_record_size_limit_get        PORTABLE C      */
+/*                                                           6.1          */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function returns the largest amount of application data sent  */
+/*    and received in one record on the TLS session, as negotiated in the */
+/*    last handshake. If no smaller size was negotiated, the protocol     */
+/*    maximum of 16384 bytes is returned. Once the handshake completes,   */
+/*    the application can use the receive limit to size its buffers.      */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    tls_session                           TLS control block             */
+/*    send_limit                            Return largest data sent in   */
+/*                                            a record (bytes)            */
+/*    receive_limit                         Return largest data received  */
+/*                                            in a record (bytes)         */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    tx_mutex_get                          Get protection mutex          */
+/*    tx_mutex_put                          Put protection mutex          */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*                                                                        */
+/**************************************************************************/
+#ifdef NX_SECURE_TLS_ENABLE_RECORD_SIZE_LIMIT
+UINT _nx_secure_tls_session_record_size_limit_get(NX_SECURE_TLS_SESSION *tls_session, ULONG *send_limit,
+                                                  ULONG *receive_limit)
+{
+
+    /* Get the protection. */
+    tx_mutex_get(&_nx_secure_tls_protection, TX_WAIT_FOREVER);
+
+    *send_limit = tls_session -> nx_secure_tls_record_size_limit_send;
+    *receive_limit = tls_session -> nx_secure_tls_record_size_limit_receive;
+
+    /* Release the protection. */
+    tx_mutex_put(&_nx_secure_tls_protection);
+
+    /* Zero means no limit was negotiated. */
+    if (*send_limit == 0)
+    {
+        *send_limit = NX_SECURE_TLS_MAX_PLAINTEXT_LENGTH;
+    }
+
+    if (*receive_limit == 0)
+    {
+        *receive_limit = NX_SECURE_TLS_MAX_PLAINTEXT_LENGTH;
+    }
+
+    return(NX_SUCCESS);
+}
+#endif /* NX_SECURE_TLS_ENABLE_RECORD_SIZE_LIMIT */
@@ -52,6 +52,7 @@
 /*    _nx_secure_tls_key_material_init      Clear TLS key material        */
 /*    _nx_secure_tls_remote_certificate_free_all                          */
 /*                                          Free all remote certificates  */
+/*    nx_secure_tls_packet_release          Release packet                */
 /*    tx_mutex_get                          Get protection mutex          */
 /*    tx_mutex_put                          Put protection mutex          */
 /*                                                                        */
@@ -148,6 +149,33 @@ UINT temp_status;
     /* Clear out Session ID used for session re-negotiation. */
     NX_SECURE_MEMSET(session_ptr -> nx_secure_tls_session_id, 0, NX_SECURE_TLS_SESSION_ID_SIZE);
 
+#ifdef NX_SECURE_TLS_ENABLE_CLIENT_SESSION_CACHE
+    /* No cached session is offered or resumed until the next ClientHello. */
+    session_ptr -> nx_secure_tls_session_cache_ciphersuite = 0;
+    session_ptr -> nx_secure_tls_session_resumed = NX_FALSE;
+#if (NX_SECURE_TLS_TLS_1_3_ENABLED)
+    session_ptr -> nx_secure_tls_session_cache_ticket_entry = NX_NULL;
+    NX_SECURE_MEMSET(&(session_ptr -> nx_secure_tls_session_cache_psk), 0, sizeof(NX_SECURE_TLS_PSK_STORE));
+#endif /* NX_SECURE_TLS_TLS_1_3_ENABLED */
+#endif /* NX_SECURE_TLS_ENABLE_CLIENT_SESSION_CACHE */
+
+#ifdef NX_SECURE_TLS_ENABLE_SEND_COALESCING
+    /* Drop application data held back for coalescing. */
+    if (session_ptr -> nx_secure_tls_send_coalesce_packet)
+    {
+        nx_secure_tls_packet_release(session_ptr -> nx_secure_tls_send_coalesce_packet);
+        session_ptr -> nx_secure_tls_send_coalesce_packet = NX_NULL;
+    }
+#endif /* NX_SECURE_TLS_ENABLE_SEND_COALESCING */
+
+#ifdef NX_SECURE_TLS_ENABLE_RECORD_SIZE_LIMIT
+    /* Record sizes are negotiated again in the next handshake. The limit set by the application is kept. */
+    session_ptr -> nx_secure_tls_remote_record_size_limit = 0;
+    session_ptr -> nx_secure_tls_remote_max_fragment_length = 0;
+    session_ptr -> nx_secure_tls_record_size_limit_send = 0;
+    session_ptr -> nx_secure_tls_record_size_limit_receive = 0;
+#endif /* NX_SECURE_TLS_ENABLE_RECORD_SIZE_LIMIT */
+
     /* Clear out sequence numbers for the current TLS session. */
     NX_SECURE_MEMSET(session_ptr -> nx_secure_tls_local_sequence_number, 0, sizeof(session_ptr -> nx_secure_tls_local_sequence_number));
     NX_SECURE_MEMSET(session_ptr -> nx_secure_tls_remote_sequence_number, 0, sizeof(session_ptr -> nx_secure_tls_remote_sequence_number));
@@ -40,6 +40,13 @@
 /*    all encryption and hashing before sending data over the established */
 /*    TCP socket connection.                    .                         */
 /*                                                                        */
+/*    If coalescing is configured on the session, a send smaller than the */
+/*    threshold is held back and its data is sent in one record with the  */
+/*    data of the sends that follow it.                                   */
+/*                                                                        */
+/*    If a smaller record size was negotiated with the remote host, data  */
+/*    larger than it is sent in several records.                          */
+/*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
 /*    tls_session                           TLS control block             */
@@ -53,7 +60,12 @@
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
+/*    _nx_secure_tls_send_coalesced_record  Send held application data    */
+/*    _nx_secure_tls_send_fragmented_record Send data in several records  */
 /*    _nx_secure_tls_send_record            Send TLS encrypted record     */
+/*    _nx_secure_tls_session_reset          Reset TLS session             */
+/*    nx_packet_data_append                 Append data to packet         */
+/*    nx_secure_tls_packet_release          Release packet                */
 /*    tx_mutex_get                          Get protection mutex          */
 /*    tx_mutex_put                          Put protection mutex          */
 /*                                                                        */
@@ -73,13 +85,126 @@
 UINT _nx_secure_tls_session_send(NX_SECURE_TLS_SESSION *tls_session, NX_PACKET *packet_ptr,
                                  ULONG wait_option)
 {
-UINT status;
+UINT       status;
+#ifdef NX_SECURE_TLS_ENABLE_SEND_COALESCING
+NX_PACKET *held_packet;
+ULONG      threshold;
+#endif /* NX_SECURE_TLS_ENABLE_SEND_COALESCING */
 
 
     /* Get the protection. */
     tx_mutex_get(&_nx_secure_tls_protection, TX_WAIT_FOREVER);
 
-    status = _nx_secure_tls_send_record(tls_session, packet_ptr, NX_SECURE_TLS_APPLICATION_DATA, wait_option);
+#ifdef NX_SECURE_TLS_ENABLE_SEND_COALESCING
+    held_packet = tls_session -> nx_secure_tls_send_coalesce_packet;
+    threshold = tls_session -> nx_secure_tls_send_coalesce_threshold;
+
+#ifdef NX_SECURE_TLS_ENABLE_RECORD_SIZE_LIMIT
+    /* Held data is sent in one record, so it must fit the record size negotiated with the remote host. */
+    if ((tls_session -> nx_secure_tls_record_size_limit_send != 0) &&
+        (threshold > tls_session -> nx_secure_tls_record_size_limit_send))
+    {
+        threshold = tls_session -> nx_secure_tls_record_size_limit_send;
+    }
+#endif /* NX_SECURE_TLS_ENABLE_RECORD_SIZE_LIMIT */
+
+    /* Send the held data first if this data would take it past the threshold, or if it has
+       been held for the timeout. Chained packets are never added to held data. */
+    if ((held_packet != NX_NULL) &&
+        ((packet_ptr -> nx_packet_next != NX_NULL) ||
+         ((held_packet -> nx_packet_length + packet_ptr -> nx_packet_length) > threshold) ||
+         ((tls_session -> nx_secure_tls_send_coalesce_timeout != 0) &&
+          ((tx_time_get() - tls_session -> nx_secure_tls_send_coalesce_time) >=
+           tls_session -> nx_secure_tls_send_coalesce_timeout))))
+    {
+        status = _nx_secure_tls_send_coalesced_record(tls_session, wait_option);
+
+        if (status != NX_SUCCESS)
+        {
+
+            /* Make sure we clear keys on errors. */
+            _nx_secure_tls_session_reset(tls_session);
+
+            /* Release the protection. */
+            tx_mutex_put(&_nx_secure_tls_protection);
+
+            return(status);
+        }
+
+        /* Another thread may have held back data while the protection was released. */
+        held_packet = tls_session -> nx_secure_tls_send_coalesce_packet;
+    }
+
+    /* Hold back data smaller than the threshold. */
+    if ((packet_ptr -> nx_packet_next == NX_NULL) && (packet_ptr -> nx_packet_length < threshold))
+    {
+        if (held_packet == NX_NULL)
+        {
+
+            /* The packet is kept as it is, and data sent after it is appended to it. */
+            tls_session -> nx_secure_tls_send_coalesce_packet = packet_ptr;
+            tls_session -> nx_secure_tls_send_coalesce_time = tx_time_get();
+
+            /* Release the protection. */
+            tx_mutex_put(&_nx_secure_tls_protection);
+
+            return(NX_SUCCESS);
+        }
+
+        /* Don't wait for packets while holding the protection. If the pool is empty, the held
+           data and this packet are sent as separate records. */
+        if (((held_packet -> nx_packet_length + packet_ptr -> nx_packet_length) <= threshold) &&
+            (nx_packet_data_append(held_packet, packet_ptr -> nx_packet_prepend_ptr, packet_ptr -> nx_packet_length,
+                                   held_packet -> nx_packet_pool_owner, NX_NO_WAIT) == NX_SUCCESS))
+        {
+
+            /* Send the held data once it reaches the threshold. */
+            if (held_packet -> nx_packet_length >= threshold)
+            {
+                status = _nx_secure_tls_send_coalesced_record(tls_session, wait_option);
+
+                if (status != NX_SUCCESS)
+                {
+
+                    /* Make sure we clear keys on errors. The caller releases the packet. */
+                    _nx_secure_tls_session_reset(tls_session);
+
+                    /* Release the protection. */
+                    tx_mutex_put(&_nx_secure_tls_protection);
+
+                    return(status);
+                }
+            }
+
+            /* The data is copied to the held packet. */
+            nx_secure_tls_packet_release(packet_ptr);
+
+            /* Release the protection. */
+            tx_mutex_put(&_nx_secure_tls_protection);
+
+            return(NX_SUCCESS);
+        }
+    }
+
+    /* Anything still held back goes before this packet. */
+    status = _nx_secure_tls_send_coalesced_record(tls_session, wait_option);
+
+    if (status == NX_SUCCESS)
+#endif /* NX_SECURE_TLS_ENABLE_SEND_COALESCING */
+    {
+#ifdef NX_SECURE_TLS_ENABLE_RECORD_SIZE_LIMIT
+        /* Data larger than the record size negotiated with the remote host is sent in several records. */
+        if ((tls_session -> nx_secure_tls_record_size_limit_send != 0) &&
+            (packet_ptr -> nx_packet_length > tls_session -> nx_secure_tls_record_size_limit_send))
+        {
+            status = _nx_secure_tls_send_fragmented_record(tls_session, packet_ptr, wait_option);
+        }
+        else
+#endif /* NX_SECURE_TLS_ENABLE_RECORD_SIZE_LIMIT */
+        {
+            status = _nx_secure_tls_send_record(tls_session, packet_ptr, NX_SECURE_TLS_APPLICATION_DATA, wait_option);
+        }
+    }
 
     if(status != NX_SUCCESS)
     {
@@ -0,0 +1,86 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Secure Component                                                 */
+/**                                                                       */
+/**    Transport Layer Security (TLS)                                     */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SECURE_SOURCE_CODE
+
+#include "nx_secure_tls.h"
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_secure_tls_session_send_coalesce_set            PORTABLE C      */
+/*                                                           6.1          */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function configures coalescing of application data sent on a  */
+/*    TLS session. A send smaller than the threshold is held back and     */
+/*    sent in one record with the data that follows it, once the held    */
+/*    data reaches the threshold. Held data is sent with the next send    */
+/*    after it has been held for the timeout, and is always sent by       */
+/*    nx_secure_tls_session_send_flush. The timeout is checked on the     */
+/*    next send only; no timer runs, so data held on an idle session is   */
+/*    sent only when the session is flushed. A timeout of zero only       */
+/*    limits the size, and a threshold of zero disables coalescing, in    */
+/*    which case any held data is sent with the next send or flush.       */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    tls_session                           TLS control block             */
+/*    threshold                             Size of data to hold back     */
+/*                                            before sending (bytes)      */
+/*    timeout                               Time to hold data back for    */
+/*                                            (ticks), checked on the     */
+/*                                            next send only              */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    tx_mutex_get                          Get protection mutex          */
+/*    tx_mutex_put                          Put protection mutex          */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*                                                                        */
+/**************************************************************************/
+#ifdef NX_SECURE_TLS_ENABLE_SEND_COALESCING
+UINT _nx_secure_tls_session_send_coalesce_set(NX_SECURE_TLS_SESSION *tls_session, ULONG threshold,
+                                              ULONG timeout)
+{
+
+    /* Get the protection. */
+    tx_mutex_get(&_nx_secure_tls_protection, TX_WAIT_FOREVER);
+
+    tls_session -> nx_secure_tls_send_coalesce_threshold = threshold;
+    tls_session -> nx_secure_tls_send_coalesce_timeout = timeout;
+
+    /* Release the protection. */
+    tx_mutex_put(&_nx_secure_tls_protection);
+
+    return(NX_SUCCESS);
+}
+#endif /* NX_SECURE_TLS_ENABLE_SEND_COALESCING */
@@ -0,0 +1,90 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Secure Component                                                 */
+/**                                                                       */
+/**    Transport Layer Security (TLS)                                     */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SECURE_SOURCE_CODE
+
+#include "nx_secure_tls.h"
+
+/* Bring in externs for caller checking code.  */
+
+NX_SECURE_CALLER_CHECKING_EXTERNS
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nxe_secure_tls_session_cache_create                PORTABLE C      */
+/*                                                           6.1          */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function checks for errors when creating a TLS client session */
+/*    cache.                                                              */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    cache                                 Session cache control block   */
+/*    entry_buffer                          Buffer for the cache entries  */
+/*    buffer_size                           Size of the entry buffer      */
+/*    update_callback                       Callback on entry changes     */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_secure_tls_session_cache_create   Actual cache create function  */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*                                                                        */
+/**************************************************************************/
+#ifdef NX_SECURE_TLS_ENABLE_CLIENT_SESSION_CACHE
+UINT _nxe_secure_tls_session_cache_create(NX_SECURE_TLS_SESSION_CACHE *cache, VOID *entry_buffer, ULONG buffer_size,
+                                          UINT (*update_callback)(NX_SECURE_TLS_SESSION_CACHE *cache,
+                                                                  NX_SECURE_TLS_SESSION_CACHE_ENTRY *entry))
+{
+UINT status;
+
+
+    if ((cache == NX_NULL) || (entry_buffer == NX_NULL))
+    {
+        return(NX_PTR_ERROR);
+    }
+
+    /* The buffer must hold at least one word-aligned entry. */
+    if ((buffer_size < sizeof(NX_SECURE_TLS_SESSION_CACHE_ENTRY)) || (((ULONG)entry_buffer) & 0x3))
+    {
+        return(NX_INVALID_PARAMETERS);
+    }
+
+    /* Check for appropriate caller.  */
+    NX_THREADS_ONLY_CALLER_CHECKING
+
+    /* Create the session cache. */
+    status = _nx_secure_tls_session_cache_create(cache, entry_buffer, buffer_size, update_callback);
+
+    return(status);
+}
+#endif /* NX_SECURE_TLS_ENABLE_CLIENT_SESSION_CACHE */
@@ -0,0 +1,101 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Secure Component                                                 */
+/**                                                                       */
+/**    Transport Layer Security (TLS)                                     */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SECURE_SOURCE_CODE
+
+#include "nx_secure_tls.h"
+
+/* Bring in externs for caller checking code.  */
+
+NX_SECURE_CALLER_CHECKING_EXTERNS
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nxe_secure_tls_session_cache_entry_restore         PORTABLE C      */
+/*                                                           6.1          */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function checks for errors when restoring a saved entry into  */
+/*    a TLS client session cache.                                         */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    cache                                 Session cache control block   */
+/*    entry                                 Saved cache entry             */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_secure_tls_session_cache_entry_restore                          */
+/*                                          Actual entry restore function */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*                                                                        */
+/**************************************************************************/
+#ifdef NX_SECURE_TLS_ENABLE_CLIENT_SESSION_CACHE
+UINT _nxe_secure_tls_session_cache_entry_restore(NX_SECURE_TLS_SESSION_CACHE *cache,
+                                                 NX_SECURE_TLS_SESSION_CACHE_ENTRY *entry)
+{
+UINT status;
+
+
+    if ((cache == NX_NULL) || (entry == NX_NULL) || (cache -> nx_secure_tls_session_cache_entries == NX_NULL))
+    {
+        return(NX_PTR_ERROR);
+    }
+
+    /* Reject entries that could not have been stored by the cache. */
+    if ((entry -> nx_secure_tls_session_cache_server_name_length == 0) ||
+        (entry -> nx_secure_tls_session_cache_server_name_length > NX_SECURE_TLS_SESSION_CACHE_NAME_SIZE) ||
+        (entry -> nx_secure_tls_session_cache_session_id_length > NX_SECURE_TLS_SESSION_CACHE_ID_SIZE))
+    {
+        return(NX_INVALID_PARAMETERS);
+    }
+
+#if (NX_SECURE_TLS_TLS_1_3_ENABLED)
+    /* The entry holds either a session ID or a session ticket. */
+    if ((entry -> nx_secure_tls_session_cache_ticket_length > NX_SECURE_TLS_SESSION_CACHE_TICKET_SIZE) ||
+        ((entry -> nx_secure_tls_session_cache_session_id_length == 0) && (entry -> nx_secure_tls_session_cache_ticket_length == 0)))
+#else
+    if (entry -> nx_secure_tls_session_cache_session_id_length == 0)
+#endif /* NX_SECURE_TLS_TLS_1_3_ENABLED */
+    {
+        return(NX_INVALID_PARAMETERS);
+    }
+
+    /* Check for appropriate caller.  */
+    NX_THREADS_ONLY_CALLER_CHECKING
+
+    /* Restore the entry. */
+    status = _nx_secure_tls_session_cache_entry_restore(cache, entry);
+
+    return(status);
+}
+#endif /* NX_SECURE_TLS_ENABLE_CLIENT_SESSION_CACHE */
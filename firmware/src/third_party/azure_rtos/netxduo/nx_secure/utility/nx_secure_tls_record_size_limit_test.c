@@ -0,0 +1,909 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Secure Component                                                 */
+/**                                                                       */
+/**    Transport Layer Security (TLS)                                     */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+/**************************************************************************/
+/*                                                                        */
+/*  PROGRAM                                                RELEASE        */
+/*                                                                        */
+/*    nx_secure_tls_record_size_limit_test.c              PORTABLE C      */
+/*                                                           6.1          */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This file is a host program, not part of NetX Secure. It checks     */
+/*    the record sizes the client negotiates with record_size_limit and   */
+/*    max_fragment_length, and the records sent and received with them.   */
+/*                                                                        */
+/*    The NX Secure client runs in the calling thread. Its TCP send and   */
+/*    receive are replaced by a socket pair, and the other end is served  */
+/*    by OpenSSL in a second thread, with a self-signed P-256 certificate */
+/*    made at startup. OpenSSL has no record_size_limit of its own, so    */
+/*    the server adds it as a custom extension when a case needs it.      */
+/*    AES-128-GCM is negotiated in TLS 1.2, and with TLS 1.3 built in, in */
+/*    TLS 1.3 as well. Each case streams data both ways:                  */
+/*                                                                        */
+/*      - with record_size_limit, the server answers with a limit of its  */
+/*        own. The send limit comes from the server's value and the       */
+/*        receive limit from the client's, both one less in TLS 1.3       */
+/*        where the limit covers the content type byte. A server value    */
+/*        of 16385 leaves the send side unlimited. Below 512 the client   */
+/*        must not offer max_fragment_length as well;                     */
+/*      - with a server that only knows max_fragment_length, the client's */
+/*        limit is rounded down to 512, 1024, 2048 or 4096 bytes, which   */
+/*        then applies both ways;                                         */
+/*      - the largest record the client sends is its send limit, and the  */
+/*        largest it receives is its receive limit;                       */
+/*      - a server that accepts the client's record_size_limit but sends  */
+/*        larger records makes the receive fail with                      */
+/*        NX_SECURE_TLS_RECORD_OVERFLOW;                                  */
+/*      - the packet pool is back to its starting level at the end.       */
+/*                                                                        */
+/*    The program exits with 1 if any check fails.                        */
+/*                                                                        */
+/*    Build and run it with the Makefile in this directory:               */
+/*                                                                        */
+/*      make test                                                         */
+/*                                                                        */
+/**************************************************************************/
+
+#include <pthread.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <openssl/err.h>
+#include <openssl/ssl.h>
+#include <openssl/x509v3.h>
+#include "tx_api.h"
+#include "nx_api.h"
+#include "nx_packet.h"
+#include "nx_secure_tls_api.h"
+
+#define NX_SECURE_RECORD_SIZE_TEST_SERVER_NAME       "localhost"
+#define NX_SECURE_RECORD_SIZE_TEST_PACKET_SIZE       1600
+#define NX_SECURE_RECORD_SIZE_TEST_PACKET_COUNT      80
+#define NX_SECURE_RECORD_SIZE_TEST_STREAM_LENGTH     20000
+#define NX_SECURE_RECORD_SIZE_TEST_SEND_LENGTH       4000
+
+/* Records the server sends when it ignores the client's limit. */
+#define NX_SECURE_RECORD_SIZE_TEST_OVERFLOW_LENGTH   1024
+
+/* The data streams repeat with this period, so any part of them can be compared with the pattern. */
+#define NX_SECURE_RECORD_SIZE_TEST_PATTERN_PERIOD    251
+
+#define NX_SECURE_RECORD_SIZE_TEST_CHECK(condition)  _nx_secure_record_size_test_check((condition), #condition, __LINE__)
+
+typedef struct NX_SECURE_RECORD_SIZE_TEST_CASE_STRUCT
+{
+    const CHAR *nx_secure_record_size_test_case_name;
+
+    /* The client's record_size_limit, and the server's, or zero for a server that only knows
+       max_fragment_length. */
+    USHORT      nx_secure_record_size_test_case_client_limit;
+    USHORT      nx_secure_record_size_test_case_server_limit;
+
+    /* The max_fragment_length code the server must see, and the limits the client must get
+       in TLS 1.2. */
+    UCHAR       nx_secure_record_size_test_case_max_fragment_length;
+    ULONG       nx_secure_record_size_test_case_send_limit;
+    ULONG       nx_secure_record_size_test_case_receive_limit;
+} NX_SECURE_RECORD_SIZE_TEST_CASE;
+
+typedef struct NX_SECURE_RECORD_SIZE_TEST_SERVER_STRUCT
+{
+    SSL_CTX  *nx_secure_record_size_test_server_context;
+    int       nx_secure_record_size_test_server_socket;
+
+    /* The server's record_size_limit, and whether it sends records larger than the client's. */
+    USHORT    nx_secure_record_size_test_server_limit;
+    UINT      nx_secure_record_size_test_server_overflow;
+
+    /* Set by the server thread: the client's record_size_limit and max_fragment_length code,
+       and whether OpenSSL read the client's stream intact. */
+    USHORT    nx_secure_record_size_test_server_client_limit;
+    UCHAR     nx_secure_record_size_test_server_max_fragment_length;
+    UINT      nx_secure_record_size_test_server_stream_matched;
+} NX_SECURE_RECORD_SIZE_TEST_SERVER;
+
+typedef struct NX_SECURE_RECORD_SIZE_TEST_RESULT_STRUCT
+{
+    UINT     nx_secure_record_size_test_result_status;
+    UINT     nx_secure_record_size_test_result_receive_status;
+
+    /* The limits nx_secure_tls_session_record_size_limit_get returned. */
+    ULONG    nx_secure_record_size_test_result_send_limit;
+    ULONG    nx_secure_record_size_test_result_receive_limit;
+
+    /* The largest application data the client received and sent in one record. */
+    ULONG    nx_secure_record_size_test_result_largest_received;
+    ULONG    nx_secure_record_size_test_result_largest_sent;
+
+    /* Whether each stream arrived intact, at the client and at the server. */
+    UINT     nx_secure_record_size_test_result_received;
+    UINT     nx_secure_record_size_test_result_sent;
+} NX_SECURE_RECORD_SIZE_TEST_RESULT;
+
+extern const NX_SECURE_TLS_CRYPTO nx_crypto_tls_ciphers_ecc;
+extern const USHORT               nx_crypto_ecc_supported_groups[];
+extern const NX_CRYPTO_METHOD    *nx_crypto_ecc_curves[];
+extern const UINT                 nx_crypto_ecc_supported_groups_size;
+
+/* The ThreadX services NetX uses. The client runs in a single thread, so none of them wait. */
+UINT                 _tx_thread_preempt_disable;
+volatile ULONG       _tx_thread_system_state;
+TX_THREAD            _tx_timer_thread;
+static TX_THREAD     _nx_secure_record_size_test_thread;
+TX_THREAD           *_tx_thread_current_ptr = &_nx_secure_record_size_test_thread;
+NX_PACKET_POOL      *_nx_packet_pool_created_ptr;
+ULONG                _nx_packet_pool_created_count;
+
+static NX_IP                  _nx_secure_record_size_test_ip;
+static NX_PACKET_POOL         _nx_secure_record_size_test_pool;
+static ULONG                  _nx_secure_record_size_test_pool_area[NX_SECURE_RECORD_SIZE_TEST_PACKET_COUNT *
+                                                                    (NX_SECURE_RECORD_SIZE_TEST_PACKET_SIZE + sizeof(NX_PACKET)) / sizeof(ULONG)];
+static NX_TCP_SOCKET          _nx_secure_record_size_test_tcp_socket;
+static NX_SECURE_TLS_SESSION  _nx_secure_record_size_test_session;
+static ULONG                  _nx_secure_record_size_test_metadata[20000 / sizeof(ULONG)];
+static UCHAR                  _nx_secure_record_size_test_packet_buffer[NX_SECURE_TLS_MAX_PLAINTEXT_LENGTH + 1024];
+static UCHAR                  _nx_secure_record_size_test_remote_buffer[8000];
+static NX_SECURE_X509_CERT    _nx_secure_record_size_test_trusted_certificate;
+static UINT                   _nx_secure_record_size_test_failures;
+
+/* The server certificate and key, made by OpenSSL. The client trusts the certificate. */
+static EVP_PKEY              *_nx_secure_record_size_test_key;
+static X509                  *_nx_secure_record_size_test_certificate;
+static UCHAR                  _nx_secure_record_size_test_certificate_der[1024];
+static UINT                   _nx_secure_record_size_test_certificate_der_length;
+
+/* The stream pattern, long enough to compare one whole record from any offset in the period. */
+static UCHAR                  _nx_secure_record_size_test_pattern[NX_SECURE_RECORD_SIZE_TEST_PATTERN_PERIOD +
+                                                                  NX_SECURE_TLS_MAX_PLAINTEXT_LENGTH];
+
+/* State of the current connection: the client's end of the socket pair, and the largest record
+   the client has written since the handshake, without its header. */
+static int                    _nx_secure_record_size_test_socket;
+static UINT                   _nx_secure_record_size_test_handshake_done;
+static ULONG                  _nx_secure_record_size_test_largest_record;
+static UCHAR                  _nx_secure_record_size_test_output[NX_SECURE_RECORD_SIZE_TEST_PACKET_SIZE *
+                                                                 NX_SECURE_RECORD_SIZE_TEST_PACKET_COUNT];
+
+static VOID  _nx_secure_record_size_test_check(INT passed, const CHAR *condition, INT line);
+static ULONG _nx_secure_record_size_test_time(VOID);
+static UINT  _nx_secure_record_size_test_certificate_create(VOID);
+static int   _nx_secure_record_size_test_extension_add(SSL *ssl, unsigned int extension_type, unsigned int context,
+                                                       const unsigned char **out, size_t *out_length, X509 *certificate,
+                                                       size_t chain_index, int *alert, void *argument);
+static int   _nx_secure_record_size_test_extension_parse(SSL *ssl, unsigned int extension_type, unsigned int context,
+                                                         const unsigned char *in, size_t in_length, X509 *certificate,
+                                                         size_t chain_index, int *alert, void *argument);
+static SSL_CTX *_nx_secure_record_size_test_context_create(INT version, const CHAR *ciphersuite,
+                                                           NX_SECURE_RECORD_SIZE_TEST_SERVER *server);
+static UINT  _nx_secure_record_size_test_server_read(SSL *ssl, ULONG length);
+static VOID *_nx_secure_record_size_test_server_thread(VOID *argument);
+static UINT  _nx_secure_record_size_test_client_receive(NX_SECURE_TLS_SESSION *session, ULONG length,
+                                                        NX_SECURE_RECORD_SIZE_TEST_RESULT *result);
+static UINT  _nx_secure_record_size_test_client_send(NX_SECURE_TLS_SESSION *session, ULONG length);
+static UINT  _nx_secure_record_size_test_connect(NX_SECURE_RECORD_SIZE_TEST_SERVER *server, USHORT client_limit,
+                                                 UINT record_expansion, NX_SECURE_RECORD_SIZE_TEST_RESULT *result);
+static VOID  _nx_secure_record_size_test_run(const CHAR *name, INT version, const CHAR *ciphersuite,
+                                             UINT record_expansion);
+static VOID  _nx_secure_record_size_test_overflow_run(const CHAR *name, INT version, const CHAR *ciphersuite);
+
+
+VOID _tx_thread_system_suspend(TX_THREAD *thread_ptr)
+{
+    NX_PARAMETER_NOT_USED(thread_ptr);
+}
+
+VOID _tx_thread_system_resume(TX_THREAD *thread_ptr)
+{
+    NX_PARAMETER_NOT_USED(thread_ptr);
+}
+
+UINT _tx_thread_sleep(ULONG timer_ticks)
+{
+    NX_PARAMETER_NOT_USED(timer_ticks);
+    return(TX_SUCCESS);
+}
+
+TX_THREAD *_tx_thread_identify(VOID)
+{
+    return(&_nx_secure_record_size_test_thread);
+}
+
+ULONG _tx_time_get(VOID)
+{
+    return(0);
+}
+
+UINT _tx_mutex_create(TX_MUTEX *mutex_ptr, CHAR *name_ptr, UINT inherit)
+{
+    NX_PARAMETER_NOT_USED(mutex_ptr);
+    NX_PARAMETER_NOT_USED(name_ptr);
+    NX_PARAMETER_NOT_USED(inherit);
+    return(TX_SUCCESS);
+}
+
+UINT _tx_mutex_delete(TX_MUTEX *mutex_ptr)
+{
+    NX_PARAMETER_NOT_USED(mutex_ptr);
+    return(TX_SUCCESS);
+}
+
+UINT _tx_mutex_get(TX_MUTEX *mutex_ptr, ULONG wait_option)
+{
+    NX_PARAMETER_NOT_USED(mutex_ptr);
+    NX_PARAMETER_NOT_USED(wait_option);
+    return(TX_SUCCESS);
+}
+
+UINT _tx_mutex_put(TX_MUTEX *mutex_ptr)
+{
+    NX_PARAMETER_NOT_USED(mutex_ptr);
+    return(TX_SUCCESS);
+}
+
+VOID _nx_packet_pool_cleanup(TX_THREAD *thread_ptr, ULONG suspension_sequence)
+{
+    NX_PARAMETER_NOT_USED(thread_ptr);
+    NX_PARAMETER_NOT_USED(suspension_sequence);
+}
+
+
+/* Write the records the client sends to the server, and note the largest after the handshake. */
+UINT _nx_tcp_socket_send(NX_TCP_SOCKET *socket_ptr, NX_PACKET *packet_ptr, ULONG wait_option)
+{
+ULONG      length = 0;
+ULONG      offset;
+ULONG      record_length;
+NX_PACKET *current_packet;
+ULONG      packet_length;
+
+    NX_PARAMETER_NOT_USED(socket_ptr);
+    NX_PARAMETER_NOT_USED(wait_option);
+
+    for (current_packet = packet_ptr; current_packet != NX_NULL; current_packet = current_packet -> nx_packet_next)
+    {
+        packet_length = (ULONG)(current_packet -> nx_packet_append_ptr - current_packet -> nx_packet_prepend_ptr);
+        memcpy(&_nx_secure_record_size_test_output[length], current_packet -> nx_packet_prepend_ptr, packet_length);
+        length += packet_length;
+    }
+
+    if (write(_nx_secure_record_size_test_socket, _nx_secure_record_size_test_output, length) != (ssize_t)length)
+    {
+        return(NX_NOT_CONNECTED);
+    }
+
+    /* Each send holds whole records. */
+    for (offset = 0; _nx_secure_record_size_test_handshake_done && ((offset + 5) <= length); offset += 5 + record_length)
+    {
+        record_length = (ULONG)((_nx_secure_record_size_test_output[offset + 3] << 8) |
+                                _nx_secure_record_size_test_output[offset + 4]);
+        if (record_length > _nx_secure_record_size_test_largest_record)
+        {
+            _nx_secure_record_size_test_largest_record = record_length;
+        }
+    }
+
+    _nx_packet_release(packet_ptr);
+    return(NX_SUCCESS);
+}
+
+
+/* Pass the client what the server has written. */
+UINT _nx_tcp_socket_receive(NX_TCP_SOCKET *socket_ptr, NX_PACKET **packet_ptr, ULONG wait_option)
+{
+NX_PACKET *packet;
+ssize_t    received;
+
+    NX_PARAMETER_NOT_USED(wait_option);
+
+    if (_nx_packet_allocate(socket_ptr -> nx_tcp_socket_ip_ptr -> nx_ip_default_packet_pool, &packet,
+                            NX_IPv4_TCP_PACKET, NX_NO_WAIT) != NX_SUCCESS)
+    {
+        return(NX_NO_PACKET);
+    }
+
+    received = recv(_nx_secure_record_size_test_socket, packet -> nx_packet_prepend_ptr,
+                    (size_t)(packet -> nx_packet_data_end - packet -> nx_packet_prepend_ptr), 0);
+    if (received <= 0)
+    {
+        _nx_packet_release(packet);
+        return(NX_NOT_CONNECTED);
+    }
+    packet -> nx_packet_append_ptr = packet -> nx_packet_prepend_ptr + received;
+    packet -> nx_packet_length = (ULONG)received;
+
+    *packet_ptr = packet;
+    return(NX_SUCCESS);
+}
+
+
+static VOID _nx_secure_record_size_test_check(INT passed, const CHAR *condition, INT line)
+{
+    if (!passed)
+    {
+        printf("  FAILED at line %d: %s\n", line, condition);
+        _nx_secure_record_size_test_failures++;
+    }
+}
+
+
+static ULONG _nx_secure_record_size_test_time(VOID)
+{
+    return((ULONG)time(NX_NULL));
+}
+
+
+/* Make a self-signed P-256 certificate for the server name. */
+static UINT _nx_secure_record_size_test_certificate_create(VOID)
+{
+X509_NAME      *name;
+X509_EXTENSION *extension;
+X509V3_CTX      extension_context;
+UCHAR          *der = _nx_secure_record_size_test_certificate_der;
+INT             length;
+
+    _nx_secure_record_size_test_key = EVP_EC_gen("P-256");
+    _nx_secure_record_size_test_certificate = X509_new();
+    if ((_nx_secure_record_size_test_key == NX_NULL) || (_nx_secure_record_size_test_certificate == NX_NULL))
+    {
+        return(NX_NOT_SUCCESSFUL);
+    }
+
+    X509_set_version(_nx_secure_record_size_test_certificate, X509_VERSION_3);
+    ASN1_INTEGER_set(X509_get_serialNumber(_nx_secure_record_size_test_certificate), 1);
+    X509_gmtime_adj(X509_getm_notBefore(_nx_secure_record_size_test_certificate), -3600);
+    X509_gmtime_adj(X509_getm_notAfter(_nx_secure_record_size_test_certificate), 86400);
+    X509_set_pubkey(_nx_secure_record_size_test_certificate, _nx_secure_record_size_test_key);
+
+    name = X509_get_subject_name(_nx_secure_record_size_test_certificate);
+    X509_NAME_add_entry_by_txt(name, "CN", MBSTRING_ASC, (const UCHAR *)NX_SECURE_RECORD_SIZE_TEST_SERVER_NAME, -1, -1, 0);
+    X509_set_issuer_name(_nx_secure_record_size_test_certificate, name);
+
+    X509V3_set_ctx(&extension_context, _nx_secure_record_size_test_certificate, _nx_secure_record_size_test_certificate,
+                   NX_NULL, NX_NULL, 0);
+    extension = X509V3_EXT_conf_nid(NX_NULL, &extension_context, NID_basic_constraints, "critical,CA:TRUE");
+    if (extension == NX_NULL)
+    {
+        return(NX_NOT_SUCCESSFUL);
+    }
+    X509_add_ext(_nx_secure_record_size_test_certificate, extension, -1);
+    X509_EXTENSION_free(extension);
+
+    if (X509_sign(_nx_secure_record_size_test_certificate, _nx_secure_record_size_test_key, EVP_sha256()) == 0)
+    {
+        return(NX_NOT_SUCCESSFUL);
+    }
+
+    length = i2d_X509(_nx_secure_record_size_test_certificate, NX_NULL);
+    if ((length <= 0) || ((UINT)length > sizeof(_nx_secure_record_size_test_certificate_der)))
+    {
+        return(NX_NOT_SUCCESSFUL);
+    }
+    _nx_secure_record_size_test_certificate_der_length = (UINT)i2d_X509(_nx_secure_record_size_test_certificate, &der);
+
+    return(NX_SUCCESS);
+}
+
+
+/* Answer the client's record_size_limit with the server's, in the ServerHello in TLS 1.2 and
+   in EncryptedExtensions in TLS 1.3. */
+static int _nx_secure_record_size_test_extension_add(SSL *ssl, unsigned int extension_type, unsigned int context,
+                                                     const unsigned char **out, size_t *out_length, X509 *certificate,
+                                                     size_t chain_index, int *alert, void *argument)
+{
+NX_SECURE_RECORD_SIZE_TEST_SERVER *server = argument;
+static UCHAR                       limit[2];
+
+    NX_PARAMETER_NOT_USED(ssl);
+    NX_PARAMETER_NOT_USED(extension_type);
+    NX_PARAMETER_NOT_USED(context);
+    NX_PARAMETER_NOT_USED(certificate);
+    NX_PARAMETER_NOT_USED(chain_index);
+    NX_PARAMETER_NOT_USED(alert);
+
+    limit[0] = (UCHAR)(server -> nx_secure_record_size_test_server_limit >> 8);
+    limit[1] = (UCHAR)server -> nx_secure_record_size_test_server_limit;
+    *out = limit;
+    *out_length = sizeof(limit);
+
+    return(1);
+}
+
+
+/* Take the client's record_size_limit from its ClientHello. */
+static int _nx_secure_record_size_test_extension_parse(SSL *ssl, unsigned int extension_type, unsigned int context,
+                                                       const unsigned char *in, size_t in_length, X509 *certificate,
+                                                       size_t chain_index, int *alert, void *argument)
+{
+NX_SECURE_RECORD_SIZE_TEST_SERVER *server = argument;
+
+    NX_PARAMETER_NOT_USED(ssl);
+    NX_PARAMETER_NOT_USED(extension_type);
+    NX_PARAMETER_NOT_USED(context);
+    NX_PARAMETER_NOT_USED(certificate);
+    NX_PARAMETER_NOT_USED(chain_index);
+
+    if (in_length != 2)
+    {
+        *alert = SSL_AD_DECODE_ERROR;
+        return(0);
+    }
+    server -> nx_secure_record_size_test_server_client_limit = (USHORT)((in[0] << 8) | in[1]);
+
+    return(1);
+}
+
+
+/* A server context for one protocol version that accepts only the given ciphersuite, and if the
+   server has a record_size_limit, answers the client's. */
+static SSL_CTX *_nx_secure_record_size_test_context_create(INT version, const CHAR *ciphersuite,
+                                                           NX_SECURE_RECORD_SIZE_TEST_SERVER *server)
+{
+SSL_CTX *context = SSL_CTX_new(TLS_server_method());
+
+    if ((context == NX_NULL) ||
+        !SSL_CTX_set_min_proto_version(context, version) ||
+        !SSL_CTX_set_max_proto_version(context, version) ||
+        ((version == TLS1_3_VERSION) ? !SSL_CTX_set_ciphersuites(context, ciphersuite) :
+                                       !SSL_CTX_set_cipher_list(context, ciphersuite)) ||
+        !SSL_CTX_set_num_tickets(context, 0) ||
+        !SSL_CTX_use_certificate(context, _nx_secure_record_size_test_certificate) ||
+        !SSL_CTX_use_PrivateKey(context, _nx_secure_record_size_test_key) ||
+        ((server -> nx_secure_record_size_test_server_limit != 0) &&
+         !SSL_CTX_add_custom_ext(context, NX_SECURE_TLS_EXTENSION_RECORD_SIZE_LIMIT,
+                                 SSL_EXT_CLIENT_HELLO | SSL_EXT_TLS1_2_SERVER_HELLO | SSL_EXT_TLS1_3_ENCRYPTED_EXTENSIONS,
+                                 _nx_secure_record_size_test_extension_add, NX_NULL, server,
+                                 _nx_secure_record_size_test_extension_parse, server)))
+    {
+        ERR_print_errors_fp(stderr);
+        exit(1);
+    }
+    SSL_CTX_set_options(context, SSL_OP_NO_TICKET);
+    SSL_CTX_set_session_cache_mode(context, SSL_SESS_CACHE_OFF);
+
+    return(context);
+}
+
+
+/* Read length bytes of the stream from the client, and return whether they match the pattern. */
+static UINT _nx_secure_record_size_test_server_read(SSL *ssl, ULONG length)
+{
+UCHAR data[NX_SECURE_TLS_MAX_PLAINTEXT_LENGTH];
+ULONG offset = 0;
+UINT  matched = NX_TRUE;
+INT   received;
+
+    while (offset < length)
+    {
+        received = SSL_read(ssl, data, (INT)(((length - offset) < sizeof(data)) ? (length - offset) : sizeof(data)));
+        if (received <= 0)
+        {
+            return(NX_FALSE);
+        }
+        if (memcmp(data, &_nx_secure_record_size_test_pattern[offset % NX_SECURE_RECORD_SIZE_TEST_PATTERN_PERIOD],
+                   (size_t)received) != 0)
+        {
+            matched = NX_FALSE;
+        }
+        offset += (ULONG)received;
+    }
+
+    return(matched);
+}
+
+
+/* Serve one connection: complete the handshake, write the stream to the client, and read the
+   client's stream back. OpenSSL keeps to a max_fragment_length by itself. A record_size_limit
+   is kept to by writing no more than the client's limit at a time, unless the server is to
+   overflow it. */
+static VOID *_nx_secure_record_size_test_server_thread(VOID *argument)
+{
+NX_SECURE_RECORD_SIZE_TEST_SERVER *server = argument;
+SSL                               *ssl = SSL_new(server -> nx_secure_record_size_test_server_context);
+ULONG                              offset;
+UINT                               record_length;
+UINT                               length;
+
+    SSL_set_fd(ssl, server -> nx_secure_record_size_test_server_socket);
+    if (SSL_accept(ssl) == 1)
+    {
+        server -> nx_secure_record_size_test_server_max_fragment_length =
+            SSL_SESSION_get_max_fragment_length(SSL_get_session(ssl));
+
+        record_length = NX_SECURE_TLS_MAX_PLAINTEXT_LENGTH;
+        if (server -> nx_secure_record_size_test_server_overflow)
+        {
+            record_length = NX_SECURE_RECORD_SIZE_TEST_OVERFLOW_LENGTH;
+        }
+        else if ((server -> nx_secure_record_size_test_server_limit != 0) &&
+                 (server -> nx_secure_record_size_test_server_client_limit != 0))
+        {
+            record_length = server -> nx_secure_record_size_test_server_client_limit;
+            if (SSL_version(ssl) == TLS1_3_VERSION)
+            {
+                record_length--;
+            }
+        }
+
+        for (offset = 0; offset < NX_SECURE_RECORD_SIZE_TEST_STREAM_LENGTH; offset += length)
+        {
+            length = record_length;
+            if (length > (NX_SECURE_RECORD_SIZE_TEST_STREAM_LENGTH - offset))
+            {
+                length = (UINT)(NX_SECURE_RECORD_SIZE_TEST_STREAM_LENGTH - offset);
+            }
+            if (SSL_write(ssl, &_nx_secure_record_size_test_pattern[offset % NX_SECURE_RECORD_SIZE_TEST_PATTERN_PERIOD],
+                          (INT)length) <= 0)
+            {
+                break;
+            }
+        }
+
+        if (offset == NX_SECURE_RECORD_SIZE_TEST_STREAM_LENGTH)
+        {
+            server -> nx_secure_record_size_test_server_stream_matched =
+                _nx_secure_record_size_test_server_read(ssl, NX_SECURE_RECORD_SIZE_TEST_STREAM_LENGTH);
+        }
+        SSL_shutdown(ssl);
+    }
+    SSL_free(ssl);
+    close(server -> nx_secure_record_size_test_server_socket);
+    ERR_clear_error();
+
+    return(NX_NULL);
+}
+
+
+/* Receive length bytes of the stream from the server, note the largest record, and return the
+   status of the last receive. */
+static UINT _nx_secure_record_size_test_client_receive(NX_SECURE_TLS_SESSION *session, ULONG length,
+                                                       NX_SECURE_RECORD_SIZE_TEST_RESULT *result)
+{
+NX_PACKET *packet;
+NX_PACKET *current_packet;
+ULONG      offset = 0;
+ULONG      packet_length;
+UINT       matched = NX_TRUE;
+UINT       status;
+
+    while (offset < length)
+    {
+        status = nx_secure_tls_session_receive(session, &packet, NX_WAIT_FOREVER);
+        if (status != NX_SUCCESS)
+        {
+            return(status);
+        }
+
+        /* Each receive returns one record. */
+        if (packet -> nx_packet_length > result -> nx_secure_record_size_test_result_largest_received)
+        {
+            result -> nx_secure_record_size_test_result_largest_received = packet -> nx_packet_length;
+        }
+
+        for (current_packet = packet; current_packet != NX_NULL; current_packet = current_packet -> nx_packet_next)
+        {
+            packet_length = (ULONG)(current_packet -> nx_packet_append_ptr - current_packet -> nx_packet_prepend_ptr);
+            if ((packet_length > (length - offset)) ||
+                (memcmp(current_packet -> nx_packet_prepend_ptr,
+                        &_nx_secure_record_size_test_pattern[offset % NX_SECURE_RECORD_SIZE_TEST_PATTERN_PERIOD],
+                        packet_length) != 0))
+            {
+                matched = NX_FALSE;
+            }
+            offset += packet_length;
+        }
+        _nx_packet_release(packet);
+    }
+
+    result -> nx_secure_record_size_test_result_received = matched && (offset == length);
+    return(NX_SUCCESS);
+}
+
+
+/* Send length bytes of the stream to the server, in sends larger than any limit under test. */
+static UINT _nx_secure_record_size_test_client_send(NX_SECURE_TLS_SESSION *session, ULONG length)
+{
+NX_PACKET *packet;
+ULONG      offset;
+UINT       send_length;
+
+    for (offset = 0; offset < length; offset += send_length)
+    {
+        send_length = NX_SECURE_RECORD_SIZE_TEST_SEND_LENGTH;
+        if (send_length > (length - offset))
+        {
+            send_length = (UINT)(length - offset);
+        }
+
+        if (nx_secure_tls_packet_allocate(session, &_nx_secure_record_size_test_pool, &packet, NX_NO_WAIT) != NX_SUCCESS)
+        {
+            return(NX_NO_PACKET);
+        }
+        if (_nx_packet_data_append(packet, &_nx_secure_record_size_test_pattern[offset % NX_SECURE_RECORD_SIZE_TEST_PATTERN_PERIOD],
+                                   send_length, &_nx_secure_record_size_test_pool, NX_NO_WAIT) != NX_SUCCESS)
+        {
+            _nx_packet_release(packet);
+            return(NX_NO_PACKET);
+        }
+        if (nx_secure_tls_session_send(session, packet, NX_WAIT_FOREVER) != NX_SUCCESS)
+        {
+            _nx_packet_release(packet);
+            return(NX_NOT_SUCCESSFUL);
+        }
+    }
+
+    return(NX_SUCCESS);
+}
+
+
+/* Run one connection of the NX Secure client, asking for client_limit, to the server. Each
+   record the client sends adds record_expansion bytes to its data. */
+static UINT _nx_secure_record_size_test_connect(NX_SECURE_RECORD_SIZE_TEST_SERVER *server, USHORT client_limit,
+                                                UINT record_expansion, NX_SECURE_RECORD_SIZE_TEST_RESULT *result)
+{
+NX_SECURE_TLS_SESSION *session = &_nx_secure_record_size_test_session;
+pthread_t              server_thread;
+int                    sockets[2];
+struct timeval         timeout = { 5, 0 };
+UINT                   status;
+
+    memset(result, 0, sizeof(NX_SECURE_RECORD_SIZE_TEST_RESULT));
+    _nx_secure_record_size_test_handshake_done = NX_FALSE;
+    _nx_secure_record_size_test_largest_record = 0;
+
+    status = nx_secure_tls_session_create(session, &nx_crypto_tls_ciphers_ecc,
+                                          _nx_secure_record_size_test_metadata, sizeof(_nx_secure_record_size_test_metadata));
+    if (status == NX_SUCCESS)
+    {
+        status = nx_secure_tls_ecc_initialize(session, nx_crypto_ecc_supported_groups,
+                                              nx_crypto_ecc_supported_groups_size, nx_crypto_ecc_curves);
+    }
+    if (status == NX_SUCCESS)
+    {
+        status = nx_secure_tls_session_packet_buffer_set(session, _nx_secure_record_size_test_packet_buffer,
+                                                         sizeof(_nx_secure_record_size_test_packet_buffer));
+    }
+    if (status == NX_SUCCESS)
+    {
+        status = nx_secure_tls_remote_certificate_buffer_allocate(session, 2, _nx_secure_record_size_test_remote_buffer,
+                                                                  sizeof(_nx_secure_record_size_test_remote_buffer));
+    }
+    if (status == NX_SUCCESS)
+    {
+        memset(&_nx_secure_record_size_test_trusted_certificate, 0, sizeof(NX_SECURE_X509_CERT));
+        status = nx_secure_x509_certificate_initialize(&_nx_secure_record_size_test_trusted_certificate,
+                                                       _nx_secure_record_size_test_certificate_der,
+                                                       (USHORT)_nx_secure_record_size_test_certificate_der_length,
+                                                       NX_NULL, 0, NX_NULL, 0, NX_SECURE_X509_KEY_TYPE_NONE);
+    }
+    if (status == NX_SUCCESS)
+    {
+        status = nx_secure_tls_trusted_certificate_add(session, &_nx_secure_record_size_test_trusted_certificate);
+    }
+    if (status == NX_SUCCESS)
+    {
+        status = nx_secure_tls_session_time_function_set(session, _nx_secure_record_size_test_time);
+    }
+    if (status == NX_SUCCESS)
+    {
+        status = nx_secure_tls_session_record_size_limit_set(session, client_limit);
+    }
+    if ((status != NX_SUCCESS) || (socketpair(AF_UNIX, SOCK_STREAM, 0, sockets) != 0))
+    {
+        printf("  session setup failed, status 0x%x\n", status);
+        exit(1);
+    }
+
+    server -> nx_secure_record_size_test_server_socket = sockets[1];
+    server -> nx_secure_record_size_test_server_client_limit = 0;
+    server -> nx_secure_record_size_test_server_max_fragment_length = 0;
+    server -> nx_secure_record_size_test_server_stream_matched = NX_FALSE;
+    if (pthread_create(&server_thread, NX_NULL, _nx_secure_record_size_test_server_thread, server) != 0)
+    {
+        printf("  server thread failed\n");
+        exit(1);
+    }
+    _nx_secure_record_size_test_socket = sockets[0];
+
+    /* A client that waits for data the server will not send gives up instead of hanging. */
+    setsockopt(sockets[0], SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+
+    status = nx_secure_tls_session_start(session, &_nx_secure_record_size_test_tcp_socket, NX_WAIT_FOREVER);
+    result -> nx_secure_record_size_test_result_status = status;
+    _nx_secure_record_size_test_handshake_done = NX_TRUE;
+
+    if (status == NX_SUCCESS)
+    {
+        nx_secure_tls_session_record_size_limit_get(session, &result -> nx_secure_record_size_test_result_send_limit,
+                                                    &result -> nx_secure_record_size_test_result_receive_limit);
+
+        result -> nx_secure_record_size_test_result_receive_status =
+            _nx_secure_record_size_test_client_receive(session, NX_SECURE_RECORD_SIZE_TEST_STREAM_LENGTH, result);
+        if ((result -> nx_secure_record_size_test_result_receive_status == NX_SUCCESS) &&
+            (_nx_secure_record_size_test_client_send(session, NX_SECURE_RECORD_SIZE_TEST_STREAM_LENGTH) == NX_SUCCESS))
+        {
+            result -> nx_secure_record_size_test_result_largest_sent = _nx_secure_record_size_test_largest_record - record_expansion;
+        }
+    }
+
+    nx_secure_tls_session_end(session, NX_NO_WAIT);
+
+    close(sockets[0]);
+    pthread_join(server_thread, NX_NULL);
+    result -> nx_secure_record_size_test_result_sent = server -> nx_secure_record_size_test_server_stream_matched;
+
+    nx_secure_tls_session_delete(session);
+
+    return(status);
+}
+
+
+/* Check the limits negotiated with each server and the records sent and received with them. */
+static VOID _nx_secure_record_size_test_run(const CHAR *name, INT version, const CHAR *ciphersuite,
+                                            UINT record_expansion)
+{
+static const NX_SECURE_RECORD_SIZE_TEST_CASE cases[] =
+{
+    {"record_size_limit 256/1024",   256,  1024,  0, 1024,  256},
+    {"record_size_limit 64/16385",    64, 16385,  0, NX_SECURE_TLS_MAX_PLAINTEXT_LENGTH, 64},
+    {"record_size_limit 300/512",    300,   512,  0,  512,  300},
+    {"max_fragment_length 512",      512,     0,  1,  512,  512},
+    {"max_fragment_length 1500",    1500,     0,  2, 1024, 1024},
+    {"max_fragment_length 2048",    2048,     0,  3, 2048, 2048},
+    {"max_fragment_length 4096",    4096,     0,  4, 4096, 4096},
+};
+NX_SECURE_RECORD_SIZE_TEST_SERVER        server;
+NX_SECURE_RECORD_SIZE_TEST_RESULT        result;
+const NX_SECURE_RECORD_SIZE_TEST_CASE   *test_case;
+ULONG                                    send_limit;
+ULONG                                    receive_limit;
+UINT                                     i;
+
+    for (i = 0; i < sizeof(cases) / sizeof(cases[0]); i++)
+    {
+        test_case = &cases[i];
+        memset(&server, 0, sizeof(server));
+        server.nx_secure_record_size_test_server_limit = test_case -> nx_secure_record_size_test_case_server_limit;
+        server.nx_secure_record_size_test_server_context = _nx_secure_record_size_test_context_create(version, ciphersuite,
+                                                                                                      &server);
+
+        /* In TLS 1.3 a record_size_limit counts the content type byte. */
+        send_limit = test_case -> nx_secure_record_size_test_case_send_limit;
+        receive_limit = test_case -> nx_secure_record_size_test_case_receive_limit;
+        if ((version == TLS1_3_VERSION) && (test_case -> nx_secure_record_size_test_case_server_limit != 0))
+        {
+            if (send_limit < NX_SECURE_TLS_MAX_PLAINTEXT_LENGTH)
+            {
+                send_limit--;
+            }
+            receive_limit--;
+        }
+
+        _nx_secure_record_size_test_connect(&server, test_case -> nx_secure_record_size_test_case_client_limit,
+                                            record_expansion, &result);
+        printf("%-32s %-27s: status 0x%02x, limits %5lu/%5lu, largest records sent %5lu, received %5lu\n",
+               name, test_case -> nx_secure_record_size_test_case_name, result.nx_secure_record_size_test_result_status,
+               (unsigned long)result.nx_secure_record_size_test_result_send_limit,
+               (unsigned long)result.nx_secure_record_size_test_result_receive_limit,
+               (unsigned long)result.nx_secure_record_size_test_result_largest_sent,
+               (unsigned long)result.nx_secure_record_size_test_result_largest_received);
+        NX_SECURE_RECORD_SIZE_TEST_CHECK(result.nx_secure_record_size_test_result_status == NX_SUCCESS);
+        NX_SECURE_RECORD_SIZE_TEST_CHECK(result.nx_secure_record_size_test_result_receive_status == NX_SUCCESS);
+        NX_SECURE_RECORD_SIZE_TEST_CHECK(server.nx_secure_record_size_test_server_max_fragment_length ==
+                                         test_case -> nx_secure_record_size_test_case_max_fragment_length);
+        if (test_case -> nx_secure_record_size_test_case_server_limit != 0)
+        {
+            NX_SECURE_RECORD_SIZE_TEST_CHECK(server.nx_secure_record_size_test_server_client_limit ==
+                                             test_case -> nx_secure_record_size_test_case_client_limit);
+        }
+        NX_SECURE_RECORD_SIZE_TEST_CHECK(result.nx_secure_record_size_test_result_send_limit == send_limit);
+        NX_SECURE_RECORD_SIZE_TEST_CHECK(result.nx_secure_record_size_test_result_receive_limit == receive_limit);
+        NX_SECURE_RECORD_SIZE_TEST_CHECK(result.nx_secure_record_size_test_result_largest_sent ==
+                                         ((send_limit < NX_SECURE_RECORD_SIZE_TEST_SEND_LENGTH) ?
+                                          send_limit : NX_SECURE_RECORD_SIZE_TEST_SEND_LENGTH));
+        NX_SECURE_RECORD_SIZE_TEST_CHECK(result.nx_secure_record_size_test_result_largest_received == receive_limit);
+        NX_SECURE_RECORD_SIZE_TEST_CHECK(result.nx_secure_record_size_test_result_received);
+        NX_SECURE_RECORD_SIZE_TEST_CHECK(result.nx_secure_record_size_test_result_sent);
+
+        SSL_CTX_free(server.nx_secure_record_size_test_server_context);
+    }
+}
+
+
+/* A server that accepts a record_size_limit of 256 but sends 1024-byte records. */
+static VOID _nx_secure_record_size_test_overflow_run(const CHAR *name, INT version, const CHAR *ciphersuite)
+{
+NX_SECURE_RECORD_SIZE_TEST_SERVER server;
+NX_SECURE_RECORD_SIZE_TEST_RESULT result;
+
+    memset(&server, 0, sizeof(server));
+    server.nx_secure_record_size_test_server_limit = 1024;
+    server.nx_secure_record_size_test_server_overflow = NX_TRUE;
+    server.nx_secure_record_size_test_server_context = _nx_secure_record_size_test_context_create(version, ciphersuite,
+                                                                                                  &server);
+
+    _nx_secure_record_size_test_connect(&server, 256, 0, &result);
+    printf("%-32s %-27s: status 0x%02x, receive status 0x%03x\n", name, "over the limit",
+           result.nx_secure_record_size_test_result_status, result.nx_secure_record_size_test_result_receive_status);
+    NX_SECURE_RECORD_SIZE_TEST_CHECK(result.nx_secure_record_size_test_result_status == NX_SUCCESS);
+    NX_SECURE_RECORD_SIZE_TEST_CHECK(result.nx_secure_record_size_test_result_receive_status == NX_SECURE_TLS_RECORD_OVERFLOW);
+    NX_SECURE_RECORD_SIZE_TEST_CHECK(result.nx_secure_record_size_test_result_largest_received == 0);
+
+    SSL_CTX_free(server.nx_secure_record_size_test_server_context);
+}
+
+
+int main(void)
+{
+ULONG packets_available;
+UINT  i;
+
+    signal(SIGPIPE, SIG_IGN);
+
+    for (i = 0; i < sizeof(_nx_secure_record_size_test_pattern); i++)
+    {
+        _nx_secure_record_size_test_pattern[i] = (UCHAR)(i % NX_SECURE_RECORD_SIZE_TEST_PATTERN_PERIOD);
+    }
+
+    if (_nx_secure_record_size_test_certificate_create() != NX_SUCCESS)
+    {
+        ERR_print_errors_fp(stderr);
+        return(1);
+    }
+
+    if (_nx_packet_pool_create(&_nx_secure_record_size_test_pool, "pool", NX_SECURE_RECORD_SIZE_TEST_PACKET_SIZE,
+                               _nx_secure_record_size_test_pool_area, sizeof(_nx_secure_record_size_test_pool_area)) != NX_SUCCESS)
+    {
+        return(1);
+    }
+    packets_available = _nx_secure_record_size_test_pool.nx_packet_pool_available;
+    _nx_secure_record_size_test_ip.nx_ip_default_packet_pool = &_nx_secure_record_size_test_pool;
+    _nx_secure_record_size_test_tcp_socket.nx_tcp_socket_ip_ptr = &_nx_secure_record_size_test_ip;
+    _nx_secure_record_size_test_tcp_socket.nx_tcp_socket_client_type = NX_TRUE;
+    _nx_secure_record_size_test_tcp_socket.nx_tcp_socket_state = NX_TCP_ESTABLISHED;
+    _nx_secure_record_size_test_tcp_socket.nx_tcp_socket_connect_ip.nxd_ip_version = NX_IP_VERSION_V4;
+
+    nx_secure_tls_initialize();
+
+    /* A record's data is followed by the 16-byte tag, and in TLS 1.2 preceded by the 8-byte
+       explicit nonce, or in TLS 1.3 followed by the content type byte. */
+    _nx_secure_record_size_test_run("TLS 1.2 ECDHE-ECDSA-AES128-GCM", TLS1_2_VERSION, "ECDHE-ECDSA-AES128-GCM-SHA256", 24);
+    _nx_secure_record_size_test_overflow_run("TLS 1.2 ECDHE-ECDSA-AES128-GCM", TLS1_2_VERSION, "ECDHE-ECDSA-AES128-GCM-SHA256");
+#if (NX_SECURE_TLS_TLS_1_3_ENABLED)
+    _nx_secure_record_size_test_run("TLS 1.3 AES128-GCM", TLS1_3_VERSION, "TLS_AES_128_GCM_SHA256", 17);
+    _nx_secure_record_size_test_overflow_run("TLS 1.3 AES128-GCM", TLS1_3_VERSION, "TLS_AES_128_GCM_SHA256");
+#endif
+
+    /* Every packet went back to the pool. */
+    NX_SECURE_RECORD_SIZE_TEST_CHECK(_nx_secure_record_size_test_pool.nx_packet_pool_available == packets_available);
+
+    X509_free(_nx_secure_record_size_test_certificate);
+    EVP_PKEY_free(_nx_secure_record_size_test_key);
+
+    printf("%s, %u failed checks\n", _nx_secure_record_size_test_failures ? "FAILED" : "PASSED", _nx_secure_record_size_test_failures);
+    return(_nx_secure_record_size_test_failures ? 1 : 0);
+}
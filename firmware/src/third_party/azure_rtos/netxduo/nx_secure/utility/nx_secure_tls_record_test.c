@@ -0,0 +1,951 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Secure Component                                                 */
+/**                                                                       */
+/**    Transport Layer Security (TLS)                                     */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+/**************************************************************************/
+/*                                                                        */
+/*  PROGRAM                                                RELEASE        */
+/*                                                                        */
+/*    nx_secure_tls_record_test.c                         PORTABLE C      */
+/*                                                           6.1          */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This file is a host program, not part of NetX Secure. It checks     */
+/*    and times the application data records of an established TLS        */
+/*    session.                                                            */
+/*                                                                        */
+/*    The NX Secure client runs in the calling thread. Its TCP send and   */
+/*    receive are replaced by a socket pair, and the other end is served  */
+/*    by OpenSSL in a second thread, with a self-signed P-256 certificate */
+/*    made at startup. For each case the server picks one ciphersuite,    */
+/*    then streams data to the client and reads data back from it:        */
+/*                                                                        */
+/*      - ChaCha20-Poly1305 and AES-128-GCM are negotiated in TLS 1.2,    */
+/*        and with TLS 1.3 built in, in TLS 1.3 as well;                  */
+/*      - every byte the client receives or sends is compared with the    */
+/*        stream the other end wrote;                                     */
+/*      - 1024-byte records are also passed to the client one record per  */
+/*        packet; split after three header bytes, so that each record     */
+/*        starts in one packet and ends the next; and split in the        */
+/*        middle of the payload. The first two are decrypted in place     */
+/*        and handed back in the packet they ended, which for the second  */
+/*        one is detached from a queue of two packets. The third takes    */
+/*        the chained path, and no record may come back in place;         */
+/*      - with TLS 1.3 built in, a server limited to X25519 completes     */
+/*        the handshake without a HelloRetryRequest, and its ServerHello  */
+/*        key_share carries an X25519 key;                                */
+/*      - the packet pool is back to its starting level at the end.       */
+/*                                                                        */
+/*    The client receive and send rates are printed for full-size and     */
+/*    small records, and the receive rate for each way of splitting. They */
+/*    include the OpenSSL end, so they compare ciphersuites and paths     */
+/*    rather than give the rate of the device. The program exits with 1   */
+/*    if any check fails.                                                 */
+/*                                                                        */
+/*    Build and run it with the Makefile in this directory:               */
+/*                                                                        */
+/*      make test                                                         */
+/*                                                                        */
+/**************************************************************************/
+
+#include <pthread.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <openssl/err.h>
+#include <openssl/ssl.h>
+#include <openssl/x509v3.h>
+#include "tx_api.h"
+#include "nx_api.h"
+#include "nx_packet.h"
+#include "nx_secure_tls_api.h"
+
+#define NX_SECURE_RECORD_TEST_SERVER_NAME       "localhost"
+#define NX_SECURE_RECORD_TEST_PACKET_SIZE       1600
+#define NX_SECURE_RECORD_TEST_PACKET_COUNT      80
+#define NX_SECURE_RECORD_TEST_STREAM_LENGTH     (8 * 1024 * 1024)
+
+/* How the server's stream is cut into the packets the client receives. */
+#define NX_SECURE_RECORD_TEST_SPLIT_STREAM      0   /* As much as one recv() returns.                    */
+#define NX_SECURE_RECORD_TEST_SPLIT_RECORD      1   /* One record per packet.                            */
+#define NX_SECURE_RECORD_TEST_SPLIT_HEADER      2   /* Three header bytes, then the rest of the record.  */
+#define NX_SECURE_RECORD_TEST_SPLIT_PAYLOAD     3   /* Header and half the payload, then the rest.       */
+
+/* The data streams repeat with this period, so any part of them can be compared with the pattern. */
+#define NX_SECURE_RECORD_TEST_PATTERN_PERIOD    251
+
+#define NX_SECURE_RECORD_TEST_CHECK(condition)  _nx_secure_record_test_check((condition), #condition, __LINE__)
+
+typedef struct NX_SECURE_RECORD_TEST_SERVER_STRUCT
+{
+    SSL_CTX *nx_secure_record_test_server_context;
+    int      nx_secure_record_test_server_socket;
+    UINT     nx_secure_record_test_server_record_length;
+
+    /* Set by the server thread: OpenSSL completed the handshake, the group it agreed for the
+       key exchange, and whether it read the stream intact. */
+    UINT     nx_secure_record_test_server_handshake;
+    INT      nx_secure_record_test_server_group;
+    UINT     nx_secure_record_test_server_stream_matched;
+} NX_SECURE_RECORD_TEST_SERVER;
+
+typedef struct NX_SECURE_RECORD_TEST_RESULT_STRUCT
+{
+    UINT     nx_secure_record_test_result_status;
+    UINT     nx_secure_record_test_result_tls_1_3;
+    USHORT   nx_secure_record_test_result_ciphersuite;
+
+    /* The group and key length of the key_share in the ServerHello, and the server's group. */
+    USHORT   nx_secure_record_test_result_key_share_group;
+    USHORT   nx_secure_record_test_result_key_share_length;
+    INT      nx_secure_record_test_result_server_group;
+
+    /* Whether each stream arrived intact, at the client and at the server. */
+    UINT     nx_secure_record_test_result_received;
+    UINT     nx_secure_record_test_result_sent;
+
+    /* Records the client received, and how many of them came back in the packet they ended. */
+    ULONG    nx_secure_record_test_result_records;
+    ULONG    nx_secure_record_test_result_in_place;
+
+    double   nx_secure_record_test_result_receive_rate;
+    double   nx_secure_record_test_result_send_rate;
+} NX_SECURE_RECORD_TEST_RESULT;
+
+extern const NX_SECURE_TLS_CRYPTO nx_crypto_tls_ciphers_ecc;
+extern const USHORT               nx_crypto_ecc_supported_groups[];
+extern const NX_CRYPTO_METHOD    *nx_crypto_ecc_curves[];
+extern const UINT                 nx_crypto_ecc_supported_groups_size;
+
+/* The ThreadX services NetX uses. The client runs in a single thread, so none of them wait. */
+UINT                 _tx_thread_preempt_disable;
+volatile ULONG       _tx_thread_system_state;
+TX_THREAD            _tx_timer_thread;
+static TX_THREAD     _nx_secure_record_test_thread;
+TX_THREAD           *_tx_thread_current_ptr = &_nx_secure_record_test_thread;
+NX_PACKET_POOL      *_nx_packet_pool_created_ptr;
+ULONG                _nx_packet_pool_created_count;
+
+static NX_IP                  _nx_secure_record_test_ip;
+static NX_PACKET_POOL         _nx_secure_record_test_pool;
+static ULONG                  _nx_secure_record_test_pool_area[NX_SECURE_RECORD_TEST_PACKET_COUNT *
+                                                               (NX_SECURE_RECORD_TEST_PACKET_SIZE + sizeof(NX_PACKET)) / sizeof(ULONG)];
+static NX_TCP_SOCKET          _nx_secure_record_test_tcp_socket;
+static NX_SECURE_TLS_SESSION  _nx_secure_record_test_session;
+static ULONG                  _nx_secure_record_test_metadata[20000 / sizeof(ULONG)];
+static UCHAR                  _nx_secure_record_test_packet_buffer[NX_SECURE_TLS_MAX_PLAINTEXT_LENGTH + 1024];
+static UCHAR                  _nx_secure_record_test_remote_buffer[8000];
+static NX_SECURE_X509_CERT    _nx_secure_record_test_trusted_certificate;
+static UINT                   _nx_secure_record_test_failures;
+
+/* The server certificate and key, made by OpenSSL. The client trusts the certificate. */
+static EVP_PKEY              *_nx_secure_record_test_key;
+static X509                  *_nx_secure_record_test_certificate;
+static UCHAR                  _nx_secure_record_test_certificate_der[1024];
+static UINT                   _nx_secure_record_test_certificate_der_length;
+
+/* The stream pattern, long enough to compare one whole record from any offset in the period. */
+static UCHAR                  _nx_secure_record_test_pattern[NX_SECURE_RECORD_TEST_PATTERN_PERIOD +
+                                                             NX_SECURE_TLS_MAX_PLAINTEXT_LENGTH];
+
+/* State of the current connection. The start of the server's stream is kept so that its
+   ServerHello can be looked at after the handshake. */
+static int                    _nx_secure_record_test_socket;
+static UCHAR                  _nx_secure_record_test_server_hello[1024];
+static UINT                   _nx_secure_record_test_server_hello_length;
+static UINT                   _nx_secure_record_test_split;
+static UINT                   _nx_secure_record_test_record_cut;
+static UINT                   _nx_secure_record_test_record_passed;
+static UINT                   _nx_secure_record_test_record_left;
+static NX_PACKET             *_nx_secure_record_test_last_packet;
+static UCHAR                  _nx_secure_record_test_output[NX_SECURE_RECORD_TEST_PACKET_SIZE * NX_SECURE_RECORD_TEST_PACKET_COUNT];
+
+static VOID  _nx_secure_record_test_check(INT passed, const CHAR *condition, INT line);
+static ULONG _nx_secure_record_test_time(VOID);
+static double _nx_secure_record_test_seconds(struct timespec *start);
+static UINT  _nx_secure_record_test_certificate_create(VOID);
+static SSL_CTX *_nx_secure_record_test_context_create(INT version, const CHAR *ciphersuite, const CHAR *groups);
+static VOID  _nx_secure_record_test_key_share_find(NX_SECURE_RECORD_TEST_RESULT *result);
+static UINT  _nx_secure_record_test_server_read(SSL *ssl, ULONG length);
+static VOID *_nx_secure_record_test_server_thread(VOID *argument);
+static UINT  _nx_secure_record_test_client_receive(NX_SECURE_TLS_SESSION *session, ULONG length,
+                                                   NX_SECURE_RECORD_TEST_RESULT *result);
+static UINT  _nx_secure_record_test_client_send(NX_SECURE_TLS_SESSION *session, ULONG length, UINT record_length);
+static UINT  _nx_secure_record_test_connect(SSL_CTX *server_context, UINT record_length, UINT split,
+                                            NX_SECURE_RECORD_TEST_RESULT *result);
+static VOID  _nx_secure_record_test_run(const CHAR *name, INT version, const CHAR *ciphersuite, USHORT expected_ciphersuite);
+static VOID  _nx_secure_record_test_split_run(const CHAR *name, INT version, const CHAR *ciphersuite);
+#if (NX_SECURE_TLS_TLS_1_3_ENABLED)
+static VOID  _nx_secure_record_test_x25519_run(VOID);
+#endif
+
+
+VOID _tx_thread_system_suspend(TX_THREAD *thread_ptr)
+{
+    NX_PARAMETER_NOT_USED(thread_ptr);
+}
+
+VOID _tx_thread_system_resume(TX_THREAD *thread_ptr)
+{
+    NX_PARAMETER_NOT_USED(thread_ptr);
+}
+
+UINT _tx_thread_sleep(ULONG timer_ticks)
+{
+    NX_PARAMETER_NOT_USED(timer_ticks);
+    return(TX_SUCCESS);
+}
+
+TX_THREAD *_tx_thread_identify(VOID)
+{
+    return(&_nx_secure_record_test_thread);
+}
+
+ULONG _tx_time_get(VOID)
+{
+    return(0);
+}
+
+UINT _tx_mutex_create(TX_MUTEX *mutex_ptr, CHAR *name_ptr, UINT inherit)
+{
+    NX_PARAMETER_NOT_USED(mutex_ptr);
+    NX_PARAMETER_NOT_USED(name_ptr);
+    NX_PARAMETER_NOT_USED(inherit);
+    return(TX_SUCCESS);
+}
+
+UINT _tx_mutex_delete(TX_MUTEX *mutex_ptr)
+{
+    NX_PARAMETER_NOT_USED(mutex_ptr);
+    return(TX_SUCCESS);
+}
+
+UINT _tx_mutex_get(TX_MUTEX *mutex_ptr, ULONG wait_option)
+{
+    NX_PARAMETER_NOT_USED(mutex_ptr);
+    NX_PARAMETER_NOT_USED(wait_option);
+    return(TX_SUCCESS);
+}
+
+UINT _tx_mutex_put(TX_MUTEX *mutex_ptr)
+{
+    NX_PARAMETER_NOT_USED(mutex_ptr);
+    return(TX_SUCCESS);
+}
+
+VOID _nx_packet_pool_cleanup(TX_THREAD *thread_ptr, ULONG suspension_sequence)
+{
+    NX_PARAMETER_NOT_USED(thread_ptr);
+    NX_PARAMETER_NOT_USED(suspension_sequence);
+}
+
+
+/* Write the records the client sends to the server. */
+UINT _nx_tcp_socket_send(NX_TCP_SOCKET *socket_ptr, NX_PACKET *packet_ptr, ULONG wait_option)
+{
+ULONG      length = 0;
+NX_PACKET *current_packet;
+ULONG      packet_length;
+
+    NX_PARAMETER_NOT_USED(socket_ptr);
+    NX_PARAMETER_NOT_USED(wait_option);
+
+    for (current_packet = packet_ptr; current_packet != NX_NULL; current_packet = current_packet -> nx_packet_next)
+    {
+        packet_length = (ULONG)(current_packet -> nx_packet_append_ptr - current_packet -> nx_packet_prepend_ptr);
+        memcpy(&_nx_secure_record_test_output[length], current_packet -> nx_packet_prepend_ptr, packet_length);
+        length += packet_length;
+    }
+
+    if (write(_nx_secure_record_test_socket, _nx_secure_record_test_output, length) != (ssize_t)length)
+    {
+        return(NX_NOT_CONNECTED);
+    }
+
+    _nx_packet_release(packet_ptr);
+    return(NX_SUCCESS);
+}
+
+
+/* Pass the client what the server has written, one packet at a time, cut as
+   _nx_secure_record_test_split says. */
+UINT _nx_tcp_socket_receive(NX_TCP_SOCKET *socket_ptr, NX_PACKET **packet_ptr, ULONG wait_option)
+{
+NX_PACKET *packet;
+ssize_t    received;
+UCHAR      header[5];
+size_t     length;
+
+    NX_PARAMETER_NOT_USED(wait_option);
+
+    if (_nx_packet_allocate(socket_ptr -> nx_tcp_socket_ip_ptr -> nx_ip_default_packet_pool, &packet,
+                            NX_IPv4_TCP_PACKET, NX_NO_WAIT) != NX_SUCCESS)
+    {
+        return(NX_NO_PACKET);
+    }
+
+    length = (size_t)(packet -> nx_packet_data_end - packet -> nx_packet_prepend_ptr);
+    if (_nx_secure_record_test_split == NX_SECURE_RECORD_TEST_SPLIT_STREAM)
+    {
+        received = recv(_nx_secure_record_test_socket, packet -> nx_packet_prepend_ptr, length, 0);
+    }
+    else
+    {
+
+        /* At the start of a record, look at its header to find where to cut it. */
+        if (_nx_secure_record_test_record_left == 0)
+        {
+            if (recv(_nx_secure_record_test_socket, header, sizeof(header), MSG_PEEK | MSG_WAITALL) != (ssize_t)sizeof(header))
+            {
+                _nx_packet_release(packet);
+                return(NX_NOT_CONNECTED);
+            }
+            _nx_secure_record_test_record_left = sizeof(header) + (UINT)((header[3] << 8) | header[4]);
+            _nx_secure_record_test_record_passed = 0;
+            switch (_nx_secure_record_test_split)
+            {
+            case NX_SECURE_RECORD_TEST_SPLIT_HEADER:
+                _nx_secure_record_test_record_cut = 3;
+                break;
+
+            case NX_SECURE_RECORD_TEST_SPLIT_PAYLOAD:
+                _nx_secure_record_test_record_cut = sizeof(header) + (UINT)((header[3] << 8) | header[4]) / 2;
+                break;
+
+            default:
+                _nx_secure_record_test_record_cut = _nx_secure_record_test_record_left;
+                break;
+            }
+        }
+
+        /* Up to the cut, then the rest of the record, as far as each packet holds. */
+        if (_nx_secure_record_test_record_passed < _nx_secure_record_test_record_cut)
+        {
+            if (length > (_nx_secure_record_test_record_cut - _nx_secure_record_test_record_passed))
+            {
+                length = _nx_secure_record_test_record_cut - _nx_secure_record_test_record_passed;
+            }
+        }
+        else if (length > _nx_secure_record_test_record_left)
+        {
+            length = _nx_secure_record_test_record_left;
+        }
+
+        received = recv(_nx_secure_record_test_socket, packet -> nx_packet_prepend_ptr, length, MSG_WAITALL);
+        if (received > 0)
+        {
+            _nx_secure_record_test_record_passed += (UINT)received;
+            _nx_secure_record_test_record_left -= (UINT)received;
+        }
+    }
+    if (received <= 0)
+    {
+        _nx_packet_release(packet);
+        return(NX_NOT_CONNECTED);
+    }
+    packet -> nx_packet_append_ptr = packet -> nx_packet_prepend_ptr + received;
+    packet -> nx_packet_length = (ULONG)received;
+
+    if (_nx_secure_record_test_server_hello_length < sizeof(_nx_secure_record_test_server_hello))
+    {
+        if ((ULONG)received > (sizeof(_nx_secure_record_test_server_hello) - _nx_secure_record_test_server_hello_length))
+        {
+            received = (ssize_t)(sizeof(_nx_secure_record_test_server_hello) - _nx_secure_record_test_server_hello_length);
+        }
+        memcpy(&_nx_secure_record_test_server_hello[_nx_secure_record_test_server_hello_length],
+               packet -> nx_packet_prepend_ptr, (size_t)received);
+        _nx_secure_record_test_server_hello_length += (UINT)received;
+    }
+
+    _nx_secure_record_test_last_packet = packet;
+    *packet_ptr = packet;
+    return(NX_SUCCESS);
+}
+
+
+static VOID _nx_secure_record_test_check(INT passed, const CHAR *condition, INT line)
+{
+    if (!passed)
+    {
+        printf("  FAILED at line %d: %s\n", line, condition);
+        _nx_secure_record_test_failures++;
+    }
+}
+
+
+static ULONG _nx_secure_record_test_time(VOID)
+{
+    return((ULONG)time(NX_NULL));
+}
+
+
+static double _nx_secure_record_test_seconds(struct timespec *start)
+{
+struct timespec end;
+
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    return((double)(end.tv_sec - start -> tv_sec) + (double)(end.tv_nsec - start -> tv_nsec) / 1e9);
+}
+
+
+/* Make a self-signed P-256 certificate for the server name. */
+static UINT _nx_secure_record_test_certificate_create(VOID)
+{
+X509_NAME      *name;
+X509_EXTENSION *extension;
+X509V3_CTX      extension_context;
+UCHAR          *der = _nx_secure_record_test_certificate_der;
+INT             length;
+
+    _nx_secure_record_test_key = EVP_EC_gen("P-256");
+    _nx_secure_record_test_certificate = X509_new();
+    if ((_nx_secure_record_test_key == NX_NULL) || (_nx_secure_record_test_certificate == NX_NULL))
+    {
+        return(NX_NOT_SUCCESSFUL);
+    }
+
+    X509_set_version(_nx_secure_record_test_certificate, X509_VERSION_3);
+    ASN1_INTEGER_set(X509_get_serialNumber(_nx_secure_record_test_certificate), 1);
+    X509_gmtime_adj(X509_getm_notBefore(_nx_secure_record_test_certificate), -3600);
+    X509_gmtime_adj(X509_getm_notAfter(_nx_secure_record_test_certificate), 86400);
+    X509_set_pubkey(_nx_secure_record_test_certificate, _nx_secure_record_test_key);
+
+    name = X509_get_subject_name(_nx_secure_record_test_certificate);
+    X509_NAME_add_entry_by_txt(name, "CN", MBSTRING_ASC, (const UCHAR *)NX_SECURE_RECORD_TEST_SERVER_NAME, -1, -1, 0);
+    X509_set_issuer_name(_nx_secure_record_test_certificate, name);
+
+    X509V3_set_ctx(&extension_context, _nx_secure_record_test_certificate, _nx_secure_record_test_certificate,
+                   NX_NULL, NX_NULL, 0);
+    extension = X509V3_EXT_conf_nid(NX_NULL, &extension_context, NID_basic_constraints, "critical,CA:TRUE");
+    if (extension == NX_NULL)
+    {
+        return(NX_NOT_SUCCESSFUL);
+    }
+    X509_add_ext(_nx_secure_record_test_certificate, extension, -1);
+    X509_EXTENSION_free(extension);
+
+    if (X509_sign(_nx_secure_record_test_certificate, _nx_secure_record_test_key, EVP_sha256()) == 0)
+    {
+        return(NX_NOT_SUCCESSFUL);
+    }
+
+    length = i2d_X509(_nx_secure_record_test_certificate, NX_NULL);
+    if ((length <= 0) || ((UINT)length > sizeof(_nx_secure_record_test_certificate_der)))
+    {
+        return(NX_NOT_SUCCESSFUL);
+    }
+    _nx_secure_record_test_certificate_der_length = (UINT)i2d_X509(_nx_secure_record_test_certificate, &der);
+
+    return(NX_SUCCESS);
+}
+
+
+/* A server context for one protocol version that accepts only the given ciphersuite, and if
+   groups is not NX_NULL, only those key exchange groups. */
+static SSL_CTX *_nx_secure_record_test_context_create(INT version, const CHAR *ciphersuite, const CHAR *groups)
+{
+SSL_CTX *context = SSL_CTX_new(TLS_server_method());
+
+    if ((context == NX_NULL) ||
+        !SSL_CTX_set_min_proto_version(context, version) ||
+        !SSL_CTX_set_max_proto_version(context, version) ||
+        ((version == TLS1_3_VERSION) ? !SSL_CTX_set_ciphersuites(context, ciphersuite) :
+                                       !SSL_CTX_set_cipher_list(context, ciphersuite)) ||
+        ((groups != NX_NULL) && !SSL_CTX_set1_groups_list(context, groups)) ||
+        !SSL_CTX_set_num_tickets(context, 0) ||
+        !SSL_CTX_use_certificate(context, _nx_secure_record_test_certificate) ||
+        !SSL_CTX_use_PrivateKey(context, _nx_secure_record_test_key))
+    {
+        ERR_print_errors_fp(stderr);
+        exit(1);
+    }
+    SSL_CTX_set_options(context, SSL_OP_NO_TICKET);
+    SSL_CTX_set_session_cache_mode(context, SSL_SESS_CACHE_OFF);
+
+    return(context);
+}
+
+
+/* Find the key_share extension of the ServerHello at the start of the server's stream. A
+   HelloRetryRequest has one too, but with no key in it. */
+static VOID _nx_secure_record_test_key_share_find(NX_SECURE_RECORD_TEST_RESULT *result)
+{
+UCHAR *record = _nx_secure_record_test_server_hello;
+UINT   length = _nx_secure_record_test_server_hello_length;
+UINT   offset;
+UINT   extensions_end;
+
+    /* Record header (5), handshake header (4), version (2), random (32), session ID length (1). */
+    if ((length < 44) || (record[0] != NX_SECURE_TLS_HANDSHAKE) || (record[5] != NX_SECURE_TLS_SERVER_HELLO))
+    {
+        return;
+    }
+    if (length > (5u + (UINT)((record[3] << 8) | record[4])))
+    {
+        length = 5u + (UINT)((record[3] << 8) | record[4]);
+    }
+
+    /* Session ID, ciphersuite (2), compression method (1), then the extensions. */
+    offset = 44u + record[43] + 3;
+    if ((offset + 2) > length)
+    {
+        return;
+    }
+    extensions_end = offset + 2 + (UINT)((record[offset] << 8) | record[offset + 1]);
+    if (extensions_end > length)
+    {
+        extensions_end = length;
+    }
+
+    for (offset += 2; (offset + 4) <= extensions_end; offset += 4 + (UINT)((record[offset + 2] << 8) | record[offset + 3]))
+    {
+        if ((((record[offset] << 8) | record[offset + 1]) == NX_SECURE_TLS_EXTENSION_KEY_SHARE) &&
+            ((offset + 6) <= extensions_end))
+        {
+            result -> nx_secure_record_test_result_key_share_group = (USHORT)((record[offset + 4] << 8) | record[offset + 5]);
+            if ((offset + 8) <= extensions_end)
+            {
+                result -> nx_secure_record_test_result_key_share_length = (USHORT)((record[offset + 6] << 8) | record[offset + 7]);
+            }
+        }
+    }
+}
+
+
+/* Read length bytes of the stream from the client, and return whether they match the pattern. */
+static UINT _nx_secure_record_test_server_read(SSL *ssl, ULONG length)
+{
+UCHAR data[NX_SECURE_TLS_MAX_PLAINTEXT_LENGTH];
+ULONG offset = 0;
+UINT  matched = NX_TRUE;
+INT   received;
+
+    while (offset < length)
+    {
+        received = SSL_read(ssl, data, (INT)(((length - offset) < sizeof(data)) ? (length - offset) : sizeof(data)));
+        if (received <= 0)
+        {
+            return(NX_FALSE);
+        }
+        if (memcmp(data, &_nx_secure_record_test_pattern[offset % NX_SECURE_RECORD_TEST_PATTERN_PERIOD],
+                   (size_t)received) != 0)
+        {
+            matched = NX_FALSE;
+        }
+        offset += (ULONG)received;
+    }
+
+    return(matched);
+}
+
+
+/* Serve one connection: complete the handshake, write the stream to the client in records of
+   the given length, read the client's stream back, and answer it with one byte. */
+static VOID *_nx_secure_record_test_server_thread(VOID *argument)
+{
+NX_SECURE_RECORD_TEST_SERVER *server = argument;
+SSL                          *ssl = SSL_new(server -> nx_secure_record_test_server_context);
+ULONG                         offset;
+UINT                          length;
+
+    SSL_set_fd(ssl, server -> nx_secure_record_test_server_socket);
+    if (SSL_accept(ssl) == 1)
+    {
+        server -> nx_secure_record_test_server_handshake = NX_TRUE;
+        server -> nx_secure_record_test_server_group = (INT)SSL_get_negotiated_group(ssl);
+
+        for (offset = 0; offset < NX_SECURE_RECORD_TEST_STREAM_LENGTH; offset += length)
+        {
+            length = server -> nx_secure_record_test_server_record_length;
+            if (length > (NX_SECURE_RECORD_TEST_STREAM_LENGTH - offset))
+            {
+                length = (UINT)(NX_SECURE_RECORD_TEST_STREAM_LENGTH - offset);
+            }
+            if (SSL_write(ssl, &_nx_secure_record_test_pattern[offset % NX_SECURE_RECORD_TEST_PATTERN_PERIOD],
+                          (INT)length) <= 0)
+            {
+                break;
+            }
+        }
+
+        if ((offset == NX_SECURE_RECORD_TEST_STREAM_LENGTH) &&
+            _nx_secure_record_test_server_read(ssl, NX_SECURE_RECORD_TEST_STREAM_LENGTH))
+        {
+            server -> nx_secure_record_test_server_stream_matched = NX_TRUE;
+            SSL_write(ssl, "", 1);
+        }
+        SSL_shutdown(ssl);
+    }
+    SSL_free(ssl);
+    close(server -> nx_secure_record_test_server_socket);
+    ERR_clear_error();
+
+    return(NX_NULL);
+}
+
+
+/* Receive length bytes of the stream from the server, and return whether they match the pattern.
+   A record decrypted in place comes back in the last packet the client received. */
+static UINT _nx_secure_record_test_client_receive(NX_SECURE_TLS_SESSION *session, ULONG length,
+                                                  NX_SECURE_RECORD_TEST_RESULT *result)
+{
+NX_PACKET *packet;
+NX_PACKET *current_packet;
+ULONG      offset = 0;
+ULONG      packet_length;
+UINT       matched = NX_TRUE;
+
+    while (offset < length)
+    {
+        if (nx_secure_tls_session_receive(session, &packet, NX_WAIT_FOREVER) != NX_SUCCESS)
+        {
+            return(NX_FALSE);
+        }
+        result -> nx_secure_record_test_result_records++;
+        if (packet == _nx_secure_record_test_last_packet)
+        {
+            result -> nx_secure_record_test_result_in_place++;
+        }
+
+        /* Records that were split across packets come back as a chain. */
+        for (current_packet = packet; current_packet != NX_NULL; current_packet = current_packet -> nx_packet_next)
+        {
+            packet_length = (ULONG)(current_packet -> nx_packet_append_ptr - current_packet -> nx_packet_prepend_ptr);
+            if ((packet_length > (length - offset)) ||
+                (memcmp(current_packet -> nx_packet_prepend_ptr,
+                        &_nx_secure_record_test_pattern[offset % NX_SECURE_RECORD_TEST_PATTERN_PERIOD],
+                        packet_length) != 0))
+            {
+                matched = NX_FALSE;
+            }
+            offset += packet_length;
+        }
+        _nx_packet_release(packet);
+    }
+
+    return(matched && (offset == length));
+}
+
+
+/* Send length bytes of the stream to the server, record_length bytes per send. */
+static UINT _nx_secure_record_test_client_send(NX_SECURE_TLS_SESSION *session, ULONG length, UINT record_length)
+{
+NX_PACKET *packet;
+ULONG      offset;
+UINT       send_length;
+
+    for (offset = 0; offset < length; offset += send_length)
+    {
+        send_length = record_length;
+        if (send_length > (length - offset))
+        {
+            send_length = (UINT)(length - offset);
+        }
+
+        if (nx_secure_tls_packet_allocate(session, &_nx_secure_record_test_pool, &packet, NX_NO_WAIT) != NX_SUCCESS)
+        {
+            return(NX_NO_PACKET);
+        }
+        if (_nx_packet_data_append(packet, &_nx_secure_record_test_pattern[offset % NX_SECURE_RECORD_TEST_PATTERN_PERIOD],
+                                   send_length, &_nx_secure_record_test_pool, NX_NO_WAIT) != NX_SUCCESS)
+        {
+            _nx_packet_release(packet);
+            return(NX_NO_PACKET);
+        }
+        if (nx_secure_tls_session_send(session, packet, NX_WAIT_FOREVER) != NX_SUCCESS)
+        {
+            _nx_packet_release(packet);
+            return(NX_NOT_SUCCESSFUL);
+        }
+    }
+
+    return(NX_SUCCESS);
+}
+
+
+/* Run one connection of the NX Secure client to an OpenSSL server using server_context, with
+   records of record_length bytes in both directions, and the server's stream cut into packets
+   as split says. */
+static UINT _nx_secure_record_test_connect(SSL_CTX *server_context, UINT record_length, UINT split,
+                                           NX_SECURE_RECORD_TEST_RESULT *result)
+{
+NX_SECURE_TLS_SESSION       *session = &_nx_secure_record_test_session;
+NX_SECURE_RECORD_TEST_SERVER server;
+pthread_t                    server_thread;
+int                          sockets[2];
+struct timeval               timeout = { 5, 0 };
+struct timespec              start;
+NX_PACKET                   *packet;
+UINT                         status;
+
+    memset(result, 0, sizeof(NX_SECURE_RECORD_TEST_RESULT));
+    _nx_secure_record_test_server_hello_length = 0;
+    _nx_secure_record_test_split = split;
+    _nx_secure_record_test_record_left = 0;
+    _nx_secure_record_test_last_packet = NX_NULL;
+
+    status = nx_secure_tls_session_create(session, &nx_crypto_tls_ciphers_ecc,
+                                          _nx_secure_record_test_metadata, sizeof(_nx_secure_record_test_metadata));
+    if (status == NX_SUCCESS)
+    {
+        status = nx_secure_tls_ecc_initialize(session, nx_crypto_ecc_supported_groups,
+                                              nx_crypto_ecc_supported_groups_size, nx_crypto_ecc_curves);
+    }
+    if (status == NX_SUCCESS)
+    {
+        status = nx_secure_tls_session_packet_buffer_set(session, _nx_secure_record_test_packet_buffer,
+                                                         sizeof(_nx_secure_record_test_packet_buffer));
+    }
+    if (status == NX_SUCCESS)
+    {
+        status = nx_secure_tls_remote_certificate_buffer_allocate(session, 2, _nx_secure_record_test_remote_buffer,
+                                                                  sizeof(_nx_secure_record_test_remote_buffer));
+    }
+    if (status == NX_SUCCESS)
+    {
+        memset(&_nx_secure_record_test_trusted_certificate, 0, sizeof(NX_SECURE_X509_CERT));
+        status = nx_secure_x509_certificate_initialize(&_nx_secure_record_test_trusted_certificate,
+                                                       _nx_secure_record_test_certificate_der,
+                                                       (USHORT)_nx_secure_record_test_certificate_der_length,
+                                                       NX_NULL, 0, NX_NULL, 0, NX_SECURE_X509_KEY_TYPE_NONE);
+    }
+    if (status == NX_SUCCESS)
+    {
+        status = nx_secure_tls_trusted_certificate_add(session, &_nx_secure_record_test_trusted_certificate);
+    }
+    if (status == NX_SUCCESS)
+    {
+        status = nx_secure_tls_session_time_function_set(session, _nx_secure_record_test_time);
+    }
+    if ((status != NX_SUCCESS) || (socketpair(AF_UNIX, SOCK_STREAM, 0, sockets) != 0))
+    {
+        printf("  session setup failed, status 0x%x\n", status);
+        exit(1);
+    }
+
+    memset(&server, 0, sizeof(server));
+    server.nx_secure_record_test_server_context = server_context;
+    server.nx_secure_record_test_server_socket = sockets[1];
+    server.nx_secure_record_test_server_record_length = record_length;
+    if (pthread_create(&server_thread, NX_NULL, _nx_secure_record_test_server_thread, &server) != 0)
+    {
+        printf("  server thread failed\n");
+        exit(1);
+    }
+    _nx_secure_record_test_socket = sockets[0];
+
+    /* A client that waits for data the server will not send gives up instead of hanging. */
+    setsockopt(sockets[0], SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+
+    status = nx_secure_tls_session_start(session, &_nx_secure_record_test_tcp_socket, NX_WAIT_FOREVER);
+    result -> nx_secure_record_test_result_status = status;
+#if (NX_SECURE_TLS_TLS_1_3_ENABLED)
+    result -> nx_secure_record_test_result_tls_1_3 = session -> nx_secure_tls_1_3;
+#endif
+    _nx_secure_record_test_key_share_find(result);
+
+    if (status == NX_SUCCESS)
+    {
+        result -> nx_secure_record_test_result_ciphersuite = session -> nx_secure_tls_session_ciphersuite -> nx_secure_tls_ciphersuite;
+
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        result -> nx_secure_record_test_result_received =
+            _nx_secure_record_test_client_receive(session, NX_SECURE_RECORD_TEST_STREAM_LENGTH, result);
+        result -> nx_secure_record_test_result_receive_rate =
+            NX_SECURE_RECORD_TEST_STREAM_LENGTH / 1e6 / _nx_secure_record_test_seconds(&start);
+
+        /* The send is timed until the server's answer, so that it covers the last record. */
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        if ((_nx_secure_record_test_client_send(session, NX_SECURE_RECORD_TEST_STREAM_LENGTH, record_length) == NX_SUCCESS) &&
+            (nx_secure_tls_session_receive(session, &packet, NX_WAIT_FOREVER) == NX_SUCCESS))
+        {
+            result -> nx_secure_record_test_result_send_rate =
+                NX_SECURE_RECORD_TEST_STREAM_LENGTH / 1e6 / _nx_secure_record_test_seconds(&start);
+            _nx_packet_release(packet);
+        }
+    }
+
+    nx_secure_tls_session_end(session, NX_NO_WAIT);
+
+    close(sockets[0]);
+    pthread_join(server_thread, NX_NULL);
+    result -> nx_secure_record_test_result_sent = server.nx_secure_record_test_server_stream_matched;
+    result -> nx_secure_record_test_result_server_group = server.nx_secure_record_test_server_group;
+
+    nx_secure_tls_session_delete(session);
+
+    return(status);
+}
+
+
+/* Check and time the records of one ciphersuite, with full-size and small records. */
+static VOID _nx_secure_record_test_run(const CHAR *name, INT version, const CHAR *ciphersuite, USHORT expected_ciphersuite)
+{
+static const UINT            record_lengths[] = {NX_SECURE_TLS_MAX_PLAINTEXT_LENGTH, 1024};
+SSL_CTX                     *server_context = _nx_secure_record_test_context_create(version, ciphersuite, NX_NULL);
+NX_SECURE_RECORD_TEST_RESULT result;
+UINT                         i;
+
+    for (i = 0; i < sizeof(record_lengths) / sizeof(record_lengths[0]); i++)
+    {
+        _nx_secure_record_test_connect(server_context, record_lengths[i], NX_SECURE_RECORD_TEST_SPLIT_STREAM, &result);
+        printf("%-32s %5u-byte records: status 0x%02x, suite 0x%04x, receive %7.1f MB/s, send %7.1f MB/s\n",
+               name, record_lengths[i], result.nx_secure_record_test_result_status,
+               result.nx_secure_record_test_result_ciphersuite, result.nx_secure_record_test_result_receive_rate,
+               result.nx_secure_record_test_result_send_rate);
+        NX_SECURE_RECORD_TEST_CHECK(result.nx_secure_record_test_result_status == NX_SUCCESS);
+        NX_SECURE_RECORD_TEST_CHECK(result.nx_secure_record_test_result_ciphersuite == expected_ciphersuite);
+        NX_SECURE_RECORD_TEST_CHECK(result.nx_secure_record_test_result_tls_1_3 == (version == TLS1_3_VERSION));
+        NX_SECURE_RECORD_TEST_CHECK(result.nx_secure_record_test_result_received);
+        NX_SECURE_RECORD_TEST_CHECK(result.nx_secure_record_test_result_sent);
+    }
+
+    SSL_CTX_free(server_context);
+}
+
+
+/* Receive 1024-byte records cut into packets in each way, and check which of them were decrypted in place.
+   The handshake records are cut in the same way. */
+static VOID _nx_secure_record_test_split_run(const CHAR *name, INT version, const CHAR *ciphersuite)
+{
+static const UINT            splits[] = {NX_SECURE_RECORD_TEST_SPLIT_RECORD, NX_SECURE_RECORD_TEST_SPLIT_HEADER,
+                                         NX_SECURE_RECORD_TEST_SPLIT_PAYLOAD};
+static const CHAR           *split_names[] = {"one record per packet", "header split", "payload split"};
+SSL_CTX                     *server_context = _nx_secure_record_test_context_create(version, ciphersuite, NX_NULL);
+NX_SECURE_RECORD_TEST_RESULT result;
+UINT                         i;
+
+    for (i = 0; i < sizeof(splits) / sizeof(splits[0]); i++)
+    {
+        _nx_secure_record_test_connect(server_context, 1024, splits[i], &result);
+        printf("%-32s %-21s: status 0x%02x, receive %7.1f MB/s, %lu of %lu records in place\n",
+               name, split_names[i], result.nx_secure_record_test_result_status,
+               result.nx_secure_record_test_result_receive_rate,
+               (unsigned long)result.nx_secure_record_test_result_in_place,
+               (unsigned long)result.nx_secure_record_test_result_records);
+        NX_SECURE_RECORD_TEST_CHECK(result.nx_secure_record_test_result_status == NX_SUCCESS);
+        NX_SECURE_RECORD_TEST_CHECK(result.nx_secure_record_test_result_received);
+        NX_SECURE_RECORD_TEST_CHECK(result.nx_secure_record_test_result_sent);
+        NX_SECURE_RECORD_TEST_CHECK(result.nx_secure_record_test_result_records ==
+                                    (NX_SECURE_RECORD_TEST_STREAM_LENGTH / 1024));
+        if (splits[i] == NX_SECURE_RECORD_TEST_SPLIT_PAYLOAD)
+        {
+            NX_SECURE_RECORD_TEST_CHECK(result.nx_secure_record_test_result_in_place == 0);
+        }
+        else
+        {
+            NX_SECURE_RECORD_TEST_CHECK(result.nx_secure_record_test_result_in_place ==
+                                        result.nx_secure_record_test_result_records);
+        }
+    }
+
+    SSL_CTX_free(server_context);
+}
+
+
+#if (NX_SECURE_TLS_TLS_1_3_ENABLED)
+/* A TLS 1.3 server that only accepts X25519 takes the key share the client sends first. */
+static VOID _nx_secure_record_test_x25519_run(VOID)
+{
+SSL_CTX                     *server_context = _nx_secure_record_test_context_create(TLS1_3_VERSION, "TLS_AES_128_GCM_SHA256",
+                                                                                    "X25519");
+NX_SECURE_RECORD_TEST_RESULT result;
+
+    _nx_secure_record_test_connect(server_context, 1024, NX_SECURE_RECORD_TEST_SPLIT_STREAM, &result);
+    printf("%-32s status 0x%02x, key_share group 0x%04x with a %u-byte key, server group %s\n", "TLS 1.3 X25519 key_share",
+           result.nx_secure_record_test_result_status, result.nx_secure_record_test_result_key_share_group,
+           result.nx_secure_record_test_result_key_share_length,
+           (result.nx_secure_record_test_result_server_group == NID_X25519) ? "X25519" : "other");
+    NX_SECURE_RECORD_TEST_CHECK(result.nx_secure_record_test_result_status == NX_SUCCESS);
+    NX_SECURE_RECORD_TEST_CHECK(result.nx_secure_record_test_result_tls_1_3);
+    NX_SECURE_RECORD_TEST_CHECK(result.nx_secure_record_test_result_key_share_group == 0x001D);
+    NX_SECURE_RECORD_TEST_CHECK(result.nx_secure_record_test_result_key_share_length == 32);
+    NX_SECURE_RECORD_TEST_CHECK(result.nx_secure_record_test_result_server_group == NID_X25519);
+    NX_SECURE_RECORD_TEST_CHECK(result.nx_secure_record_test_result_received);
+    NX_SECURE_RECORD_TEST_CHECK(result.nx_secure_record_test_result_sent);
+
+    SSL_CTX_free(server_context);
+}
+#endif
+
+
+int main(void)
+{
+ULONG packets_available;
+UINT  i;
+
+    signal(SIGPIPE, SIG_IGN);
+
+    for (i = 0; i < sizeof(_nx_secure_record_test_pattern); i++)
+    {
+        _nx_secure_record_test_pattern[i] = (UCHAR)(i % NX_SECURE_RECORD_TEST_PATTERN_PERIOD);
+    }
+
+    if (_nx_secure_record_test_certificate_create() != NX_SUCCESS)
+    {
+        ERR_print_errors_fp(stderr);
+        return(1);
+    }
+
+    if (_nx_packet_pool_create(&_nx_secure_record_test_pool, "pool", NX_SECURE_RECORD_TEST_PACKET_SIZE,
+                               _nx_secure_record_test_pool_area, sizeof(_nx_secure_record_test_pool_area)) != NX_SUCCESS)
+    {
+        return(1);
+    }
+    packets_available = _nx_secure_record_test_pool.nx_packet_pool_available;
+    _nx_secure_record_test_ip.nx_ip_default_packet_pool = &_nx_secure_record_test_pool;
+    _nx_secure_record_test_tcp_socket.nx_tcp_socket_ip_ptr = &_nx_secure_record_test_ip;
+    _nx_secure_record_test_tcp_socket.nx_tcp_socket_client_type = NX_TRUE;
+    _nx_secure_record_test_tcp_socket.nx_tcp_socket_state = NX_TCP_ESTABLISHED;
+    _nx_secure_record_test_tcp_socket.nx_tcp_socket_connect_ip.nxd_ip_version = NX_IP_VERSION_V4;
+
+    nx_secure_tls_initialize();
+
+    _nx_secure_record_test_run("TLS 1.2 ECDHE-ECDSA-AES128-GCM", TLS1_2_VERSION,
+                               "ECDHE-ECDSA-AES128-GCM-SHA256", TLS_ECDHE_ECDSA_WITH_AES_128_GCM_SHA256);
+    _nx_secure_record_test_run("TLS 1.2 ECDHE-ECDSA-CHACHA20", TLS1_2_VERSION,
+                               "ECDHE-ECDSA-CHACHA20-POLY1305", TLS_ECDHE_ECDSA_WITH_CHACHA20_POLY1305_SHA256);
+    _nx_secure_record_test_split_run("TLS 1.2 ECDHE-ECDSA-AES128-GCM", TLS1_2_VERSION, "ECDHE-ECDSA-AES128-GCM-SHA256");
+    _nx_secure_record_test_split_run("TLS 1.2 ECDHE-ECDSA-CHACHA20", TLS1_2_VERSION, "ECDHE-ECDSA-CHACHA20-POLY1305");
+#if (NX_SECURE_TLS_TLS_1_3_ENABLED)
+    _nx_secure_record_test_run("TLS 1.3 AES128-GCM", TLS1_3_VERSION,
+                               "TLS_AES_128_GCM_SHA256", TLS_AES_128_GCM_SHA256);
+    _nx_secure_record_test_run("TLS 1.3 CHACHA20", TLS1_3_VERSION,
+                               "TLS_CHACHA20_POLY1305_SHA256", TLS_CHACHA20_POLY1305_SHA256);
+    _nx_secure_record_test_split_run("TLS 1.3 AES128-GCM", TLS1_3_VERSION, "TLS_AES_128_GCM_SHA256");
+    _nx_secure_record_test_x25519_run();
+#endif
+
+    /* Every packet went back to the pool. */
+    NX_SECURE_RECORD_TEST_CHECK(_nx_secure_record_test_pool.nx_packet_pool_available == packets_available);
+
+    X509_free(_nx_secure_record_test_certificate);
+    EVP_PKEY_free(_nx_secure_record_test_key);
+
+    printf("%s, %u failed checks\n", _nx_secure_record_test_failures ? "FAILED" : "PASSED", _nx_secure_record_test_failures);
+    return(_nx_secure_record_test_failures ? 1 : 0);
+}
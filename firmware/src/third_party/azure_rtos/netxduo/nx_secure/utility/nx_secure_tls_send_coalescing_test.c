@@ -0,0 +1,1062 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Secure Component                                                 */
+/**                                                                       */
+/**    Transport Layer Security (TLS)                                     */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+/**************************************************************************/
+/*                                                                        */
+/*  PROGRAM                                                RELEASE        */
+/*                                                                        */
+/*    nx_secure_tls_send_coalescing_test.c                PORTABLE C      */
+/*                                                           6.1          */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This file is a host program, not part of NetX Secure. It checks     */
+/*    that small application sends on a TLS session are coalesced into    */
+/*    fewer records, and counts the records and bytes the client puts on  */
+/*    the wire.                                                           */
+/*                                                                        */
+/*    The NX Secure client runs in the calling thread. Its TCP send and   */
+/*    receive are replaced by a socket pair, and the other end is served  */
+/*    by OpenSSL in a second thread, with a self-signed P-256 certificate */
+/*    made at startup. AES-128-GCM is negotiated in TLS 1.2, and with     */
+/*    TLS 1.3 built in, in TLS 1.3 as well:                               */
+/*                                                                        */
+/*      - 200 sends of 40 bytes are made with no threshold, and with      */
+/*        thresholds of 1024 and 16384 bytes, then flushed. They must     */
+/*        take 200, 8 and 1 records, and the bytes on the wire must be    */
+/*        the data plus the overhead of each record;                      */
+/*      - three sends of 40 bytes below the threshold put nothing on the  */
+/*        wire. Ending the session sends them in one record ahead of the  */
+/*        close_notify, and the server reads all of them before it sees   */
+/*        the alert;                                                      */
+/*      - the MQTT client, built into this program, publishes one QoS 1   */
+/*        message on a coalescing session. The PUBLISH goes out at once.  */
+/*        A small broker in the server thread answers with a PUBACK and   */
+/*        three QoS 1 messages in one record. The PUBACK clears the       */
+/*        message the client keeps for retransmission, and the three      */
+/*        PUBACKs the client sends back leave in one record;              */
+/*      - the server reads every byte the client sent, and sees a clean   */
+/*        close_notify at the end;                                        */
+/*      - the packet pool is back to its starting level at the end.       */
+/*                                                                        */
+/*    The program exits with 1 if any check fails.                        */
+/*                                                                        */
+/*    Build and run it with the Makefile in this directory:               */
+/*                                                                        */
+/*      make test                                                         */
+/*                                                                        */
+/**************************************************************************/
+
+#include <errno.h>
+#include <poll.h>
+#include <pthread.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <openssl/err.h>
+#include <openssl/ssl.h>
+#include <openssl/x509v3.h>
+
+/* The MQTT client is built into this program, because its receive processing is internal to
+   it. It comes first, so that it is built with the options it sets for itself. Like NetX, it
+   calls ThreadX without the error checking front-ends, which the program provides stubs for. */
+#define TX_DISABLE_ERROR_CHECKING
+#include "nxd_mqtt_client.c"
+
+#include "nx_packet.h"
+
+#define NX_SECURE_COALESCING_TEST_SERVER_NAME       "localhost"
+#define NX_SECURE_COALESCING_TEST_PACKET_SIZE       1600
+#define NX_SECURE_COALESCING_TEST_PACKET_COUNT      80
+#define NX_SECURE_COALESCING_TEST_SENDS             200
+#define NX_SECURE_COALESCING_TEST_SEND_LENGTH       40
+#define NX_SECURE_COALESCING_TEST_HELD_SENDS        3
+#define NX_SECURE_COALESCING_TEST_THRESHOLD         1024
+
+/* The data stream repeats with this period, so any part of it can be compared with the pattern. */
+#define NX_SECURE_COALESCING_TEST_PATTERN_PERIOD    251
+
+/* The MQTT messages, and the packet identifiers of the three the broker publishes to the client. */
+#define NX_SECURE_COALESCING_TEST_TOPIC             "nx/coalesce"
+#define NX_SECURE_COALESCING_TEST_MESSAGE           "coalesce"
+#define NX_SECURE_COALESCING_TEST_BROKER_MESSAGES   3
+#define NX_SECURE_COALESCING_TEST_BROKER_PACKET_ID  0x0100
+
+#define NX_SECURE_COALESCING_TEST_CHECK(condition)  _nx_secure_coalescing_test_check((condition), #condition, __LINE__)
+
+typedef struct NX_SECURE_COALESCING_TEST_SERVER_STRUCT
+{
+    SSL_CTX  *nx_secure_coalescing_test_server_context;
+    int       nx_secure_coalescing_test_server_socket;
+
+    /* Bytes of the stream to read from the client, or zero to act as an MQTT broker. */
+    ULONG     nx_secure_coalescing_test_server_length;
+
+    /* Set by the server thread: OpenSSL completed the handshake, read the stream or exchanged
+       the MQTT messages as expected, and then read a close_notify. */
+    UINT      nx_secure_coalescing_test_server_handshake;
+    UINT      nx_secure_coalescing_test_server_matched;
+    UINT      nx_secure_coalescing_test_server_closed;
+} NX_SECURE_COALESCING_TEST_SERVER;
+
+extern const NX_SECURE_TLS_CRYPTO nx_crypto_tls_ciphers_ecc;
+extern const USHORT               nx_crypto_ecc_supported_groups[];
+extern const NX_CRYPTO_METHOD    *nx_crypto_ecc_curves[];
+extern const UINT                 nx_crypto_ecc_supported_groups_size;
+
+/* The ThreadX services NetX uses. The client runs in a single thread, so none of them wait. */
+UINT                 _tx_thread_preempt_disable;
+volatile ULONG       _tx_thread_system_state;
+TX_THREAD            _tx_timer_thread;
+static TX_THREAD     _nx_secure_coalescing_test_thread;
+TX_THREAD           *_tx_thread_current_ptr = &_nx_secure_coalescing_test_thread;
+NX_PACKET_POOL      *_nx_packet_pool_created_ptr;
+ULONG                _nx_packet_pool_created_count;
+
+static NX_IP                  _nx_secure_coalescing_test_ip;
+static NX_PACKET_POOL         _nx_secure_coalescing_test_pool;
+static ULONG                  _nx_secure_coalescing_test_pool_area[NX_SECURE_COALESCING_TEST_PACKET_COUNT *
+                                                                   (NX_SECURE_COALESCING_TEST_PACKET_SIZE + sizeof(NX_PACKET)) / sizeof(ULONG)];
+static NX_TCP_SOCKET          _nx_secure_coalescing_test_tcp_socket;
+static NX_SECURE_TLS_SESSION  _nx_secure_coalescing_test_session;
+static NXD_MQTT_CLIENT        _nx_secure_coalescing_test_mqtt_client;
+static ULONG                  _nx_secure_coalescing_test_metadata[20000 / sizeof(ULONG)];
+static UCHAR                  _nx_secure_coalescing_test_packet_buffer[NX_SECURE_TLS_MAX_PLAINTEXT_LENGTH + 1024];
+static UCHAR                  _nx_secure_coalescing_test_remote_buffer[8000];
+static NX_SECURE_X509_CERT    _nx_secure_coalescing_test_trusted_certificate;
+static UINT                   _nx_secure_coalescing_test_failures;
+
+/* The server certificate and key, made by OpenSSL. The client trusts the certificate. */
+static EVP_PKEY              *_nx_secure_coalescing_test_key;
+static X509                  *_nx_secure_coalescing_test_certificate;
+static UCHAR                  _nx_secure_coalescing_test_certificate_der[1024];
+static UINT                   _nx_secure_coalescing_test_certificate_der_length;
+
+/* The stream pattern, long enough to compare one whole record from any offset in the period. */
+static UCHAR                  _nx_secure_coalescing_test_pattern[NX_SECURE_COALESCING_TEST_PATTERN_PERIOD +
+                                                                 NX_SECURE_TLS_MAX_PLAINTEXT_LENGTH];
+
+/* State of the current connection: the client's end of the socket pair, the server, the records
+   and bytes the client has written since the counts were last cleared, and the ThreadX events
+   the MQTT client has set. */
+static int                              _nx_secure_coalescing_test_socket;
+static NX_SECURE_COALESCING_TEST_SERVER _nx_secure_coalescing_test_server;
+static pthread_t                        _nx_secure_coalescing_test_server_thread_id;
+static ULONG                            _nx_secure_coalescing_test_records;
+static ULONG                            _nx_secure_coalescing_test_bytes;
+static ULONG                            _nx_secure_coalescing_test_events;
+static UCHAR                            _nx_secure_coalescing_test_output[NX_SECURE_COALESCING_TEST_PACKET_SIZE *
+                                                                          NX_SECURE_COALESCING_TEST_PACKET_COUNT];
+
+static VOID  _nx_secure_coalescing_test_check(INT passed, const CHAR *condition, INT line);
+static ULONG _nx_secure_coalescing_test_time(VOID);
+static UINT  _nx_secure_coalescing_test_certificate_create(VOID);
+static SSL_CTX *_nx_secure_coalescing_test_context_create(INT version, const CHAR *ciphersuite);
+static UINT  _nx_secure_coalescing_test_server_read(SSL *ssl, ULONG length);
+static UINT  _nx_secure_coalescing_test_broker(SSL *ssl);
+static VOID *_nx_secure_coalescing_test_server_thread(VOID *argument);
+static UINT  _nx_secure_coalescing_test_client_send(NX_SECURE_TLS_SESSION *session, UINT sends);
+static UINT  _nx_secure_coalescing_test_connect(SSL_CTX *server_context, NX_SECURE_TLS_SESSION *session,
+                                                ULONG server_length);
+static VOID  _nx_secure_coalescing_test_disconnect(NX_SECURE_TLS_SESSION *session);
+static VOID  _nx_secure_coalescing_test_sends_run(const CHAR *name, SSL_CTX *server_context, UINT record_overhead);
+static VOID  _nx_secure_coalescing_test_close_run(const CHAR *name, SSL_CTX *server_context, UINT record_overhead);
+static VOID  _nx_secure_coalescing_test_mqtt_run(const CHAR *name, SSL_CTX *server_context, UINT record_overhead);
+static VOID  _nx_secure_coalescing_test_run(const CHAR *name, INT version, const CHAR *ciphersuite, UINT record_overhead);
+
+
+VOID _tx_thread_system_suspend(TX_THREAD *thread_ptr)
+{
+    NX_PARAMETER_NOT_USED(thread_ptr);
+}
+
+VOID _tx_thread_system_resume(TX_THREAD *thread_ptr)
+{
+    NX_PARAMETER_NOT_USED(thread_ptr);
+}
+
+UINT _tx_thread_sleep(ULONG timer_ticks)
+{
+    NX_PARAMETER_NOT_USED(timer_ticks);
+    return(TX_SUCCESS);
+}
+
+TX_THREAD *_tx_thread_identify(VOID)
+{
+    return(&_nx_secure_coalescing_test_thread);
+}
+
+ULONG _tx_time_get(VOID)
+{
+    return(0);
+}
+
+UINT _tx_mutex_create(TX_MUTEX *mutex_ptr, CHAR *name_ptr, UINT inherit)
+{
+    NX_PARAMETER_NOT_USED(mutex_ptr);
+    NX_PARAMETER_NOT_USED(name_ptr);
+    NX_PARAMETER_NOT_USED(inherit);
+    return(TX_SUCCESS);
+}
+
+UINT _tx_mutex_delete(TX_MUTEX *mutex_ptr)
+{
+    NX_PARAMETER_NOT_USED(mutex_ptr);
+    return(TX_SUCCESS);
+}
+
+UINT _tx_mutex_get(TX_MUTEX *mutex_ptr, ULONG wait_option)
+{
+    NX_PARAMETER_NOT_USED(mutex_ptr);
+    NX_PARAMETER_NOT_USED(wait_option);
+    return(TX_SUCCESS);
+}
+
+UINT _tx_mutex_put(TX_MUTEX *mutex_ptr)
+{
+    NX_PARAMETER_NOT_USED(mutex_ptr);
+    return(TX_SUCCESS);
+}
+
+VOID _nx_packet_pool_cleanup(TX_THREAD *thread_ptr, ULONG suspension_sequence)
+{
+    NX_PARAMETER_NOT_USED(thread_ptr);
+    NX_PARAMETER_NOT_USED(suspension_sequence);
+}
+
+/* The MQTT client reports a broken connection through its event flags. */
+UINT _tx_event_flags_set(TX_EVENT_FLAGS_GROUP *group_ptr, ULONG flags_to_set, UINT set_option)
+{
+    NX_PARAMETER_NOT_USED(group_ptr);
+    NX_PARAMETER_NOT_USED(set_option);
+    _nx_secure_coalescing_test_events |= flags_to_set;
+    return(TX_SUCCESS);
+}
+
+
+/* The rest of the services the MQTT client links against. The test sets up the client's
+   session itself and never runs the client thread, so they are not called. */
+UINT _tx_event_flags_create(TX_EVENT_FLAGS_GROUP *group_ptr, CHAR *name_ptr)
+{
+    NX_PARAMETER_NOT_USED(group_ptr);
+    NX_PARAMETER_NOT_USED(name_ptr);
+    return(TX_GROUP_ERROR);
+}
+
+UINT _tx_event_flags_delete(TX_EVENT_FLAGS_GROUP *group_ptr)
+{
+    NX_PARAMETER_NOT_USED(group_ptr);
+    return(TX_GROUP_ERROR);
+}
+
+UINT _tx_event_flags_get(TX_EVENT_FLAGS_GROUP *group_ptr, ULONG requested_flags,
+                         UINT get_option, ULONG *actual_flags_ptr, ULONG wait_option)
+{
+    NX_PARAMETER_NOT_USED(group_ptr);
+    NX_PARAMETER_NOT_USED(requested_flags);
+    NX_PARAMETER_NOT_USED(get_option);
+    NX_PARAMETER_NOT_USED(actual_flags_ptr);
+    NX_PARAMETER_NOT_USED(wait_option);
+    return(TX_GROUP_ERROR);
+}
+
+UINT _tx_thread_create(TX_THREAD *thread_ptr, CHAR *name_ptr, VOID (*entry_function)(ULONG entry_input),
+                       ULONG entry_input, VOID *stack_start, ULONG stack_size, UINT priority,
+                       UINT preempt_threshold, ULONG time_slice, UINT auto_start)
+{
+    NX_PARAMETER_NOT_USED(thread_ptr);
+    NX_PARAMETER_NOT_USED(name_ptr);
+    NX_PARAMETER_NOT_USED(entry_function);
+    NX_PARAMETER_NOT_USED(entry_input);
+    NX_PARAMETER_NOT_USED(stack_start);
+    NX_PARAMETER_NOT_USED(stack_size);
+    NX_PARAMETER_NOT_USED(priority);
+    NX_PARAMETER_NOT_USED(preempt_threshold);
+    NX_PARAMETER_NOT_USED(time_slice);
+    NX_PARAMETER_NOT_USED(auto_start);
+    return(TX_THREAD_ERROR);
+}
+
+UINT _tx_thread_delete(TX_THREAD *thread_ptr)
+{
+    NX_PARAMETER_NOT_USED(thread_ptr);
+    return(TX_THREAD_ERROR);
+}
+
+UINT _tx_thread_info_get(TX_THREAD *thread_ptr, CHAR **name, UINT *state, ULONG *run_count,
+                         UINT *priority, UINT *preemption_threshold, ULONG *time_slice,
+                         TX_THREAD **next_thread, TX_THREAD **next_suspended_thread)
+{
+    NX_PARAMETER_NOT_USED(thread_ptr);
+    NX_PARAMETER_NOT_USED(name);
+    NX_PARAMETER_NOT_USED(state);
+    NX_PARAMETER_NOT_USED(run_count);
+    NX_PARAMETER_NOT_USED(priority);
+    NX_PARAMETER_NOT_USED(preemption_threshold);
+    NX_PARAMETER_NOT_USED(time_slice);
+    NX_PARAMETER_NOT_USED(next_thread);
+    NX_PARAMETER_NOT_USED(next_suspended_thread);
+    return(TX_THREAD_ERROR);
+}
+
+UINT _tx_thread_priority_change(TX_THREAD *thread_ptr, UINT new_priority, UINT *old_priority)
+{
+    NX_PARAMETER_NOT_USED(thread_ptr);
+    NX_PARAMETER_NOT_USED(new_priority);
+    NX_PARAMETER_NOT_USED(old_priority);
+    return(TX_THREAD_ERROR);
+}
+
+UINT _tx_thread_resume(TX_THREAD *thread_ptr)
+{
+    NX_PARAMETER_NOT_USED(thread_ptr);
+    return(TX_THREAD_ERROR);
+}
+
+UINT _tx_timer_create(TX_TIMER *timer_ptr, CHAR *name_ptr, VOID (*expiration_function)(ULONG input),
+                      ULONG expiration_input, ULONG initial_ticks, ULONG reschedule_ticks, UINT auto_activate)
+{
+    NX_PARAMETER_NOT_USED(timer_ptr);
+    NX_PARAMETER_NOT_USED(name_ptr);
+    NX_PARAMETER_NOT_USED(expiration_function);
+    NX_PARAMETER_NOT_USED(expiration_input);
+    NX_PARAMETER_NOT_USED(initial_ticks);
+    NX_PARAMETER_NOT_USED(reschedule_ticks);
+    NX_PARAMETER_NOT_USED(auto_activate);
+    return(TX_TIMER_ERROR);
+}
+
+UINT _tx_timer_delete(TX_TIMER *timer_ptr)
+{
+    NX_PARAMETER_NOT_USED(timer_ptr);
+    return(TX_TIMER_ERROR);
+}
+
+UINT _nx_tcp_socket_create(NX_IP *ip_ptr, NX_TCP_SOCKET *socket_ptr, CHAR *name,
+                           ULONG type_of_service, ULONG fragment, UINT time_to_live, ULONG window_size,
+                           VOID (*tcp_urgent_data_callback)(NX_TCP_SOCKET *socket_ptr),
+                           VOID (*tcp_disconnect_callback)(NX_TCP_SOCKET *socket_ptr))
+{
+    NX_PARAMETER_NOT_USED(ip_ptr);
+    NX_PARAMETER_NOT_USED(socket_ptr);
+    NX_PARAMETER_NOT_USED(name);
+    NX_PARAMETER_NOT_USED(type_of_service);
+    NX_PARAMETER_NOT_USED(fragment);
+    NX_PARAMETER_NOT_USED(time_to_live);
+    NX_PARAMETER_NOT_USED(window_size);
+    NX_PARAMETER_NOT_USED(tcp_urgent_data_callback);
+    NX_PARAMETER_NOT_USED(tcp_disconnect_callback);
+    return(NX_NOT_SUCCESSFUL);
+}
+
+UINT _nx_tcp_socket_delete(NX_TCP_SOCKET *socket_ptr)
+{
+    NX_PARAMETER_NOT_USED(socket_ptr);
+    return(NX_NOT_SUCCESSFUL);
+}
+
+UINT _nx_tcp_socket_disconnect(NX_TCP_SOCKET *socket_ptr, ULONG wait_option)
+{
+    NX_PARAMETER_NOT_USED(socket_ptr);
+    NX_PARAMETER_NOT_USED(wait_option);
+    return(NX_NOT_SUCCESSFUL);
+}
+
+UINT _nx_tcp_socket_establish_notify(NX_TCP_SOCKET *socket_ptr, VOID (*tcp_establish_notify)(NX_TCP_SOCKET *socket_ptr))
+{
+    NX_PARAMETER_NOT_USED(socket_ptr);
+    NX_PARAMETER_NOT_USED(tcp_establish_notify);
+    return(NX_NOT_SUCCESSFUL);
+}
+
+UINT _nx_tcp_socket_receive_notify(NX_TCP_SOCKET *socket_ptr, VOID (*tcp_receive_notify)(NX_TCP_SOCKET *socket_ptr))
+{
+    NX_PARAMETER_NOT_USED(socket_ptr);
+    NX_PARAMETER_NOT_USED(tcp_receive_notify);
+    return(NX_NOT_SUCCESSFUL);
+}
+
+UINT _nx_tcp_client_socket_bind(NX_TCP_SOCKET *socket_ptr, UINT port, ULONG wait_option)
+{
+    NX_PARAMETER_NOT_USED(socket_ptr);
+    NX_PARAMETER_NOT_USED(port);
+    NX_PARAMETER_NOT_USED(wait_option);
+    return(NX_NOT_SUCCESSFUL);
+}
+
+UINT _nx_tcp_client_socket_unbind(NX_TCP_SOCKET *socket_ptr)
+{
+    NX_PARAMETER_NOT_USED(socket_ptr);
+    return(NX_NOT_SUCCESSFUL);
+}
+
+UINT _nxd_tcp_client_socket_connect(NX_TCP_SOCKET *socket_ptr, NXD_ADDRESS *server_ip, UINT server_port, ULONG wait_option)
+{
+    NX_PARAMETER_NOT_USED(socket_ptr);
+    NX_PARAMETER_NOT_USED(server_ip);
+    NX_PARAMETER_NOT_USED(server_port);
+    NX_PARAMETER_NOT_USED(wait_option);
+    return(NX_NOT_SUCCESSFUL);
+}
+
+
+/* Write the records the client sends to the server, and count them. */
+UINT _nx_tcp_socket_send(NX_TCP_SOCKET *socket_ptr, NX_PACKET *packet_ptr, ULONG wait_option)
+{
+ULONG      length = 0;
+ULONG      offset;
+NX_PACKET *current_packet;
+ULONG      packet_length;
+
+    NX_PARAMETER_NOT_USED(socket_ptr);
+    NX_PARAMETER_NOT_USED(wait_option);
+
+    for (current_packet = packet_ptr; current_packet != NX_NULL; current_packet = current_packet -> nx_packet_next)
+    {
+        packet_length = (ULONG)(current_packet -> nx_packet_append_ptr - current_packet -> nx_packet_prepend_ptr);
+        memcpy(&_nx_secure_coalescing_test_output[length], current_packet -> nx_packet_prepend_ptr, packet_length);
+        length += packet_length;
+    }
+
+    if (write(_nx_secure_coalescing_test_socket, _nx_secure_coalescing_test_output, length) != (ssize_t)length)
+    {
+        return(NX_NOT_CONNECTED);
+    }
+
+    /* Each send holds whole records. */
+    for (offset = 0; (offset + 5) <= length;
+         offset += 5 + (ULONG)((_nx_secure_coalescing_test_output[offset + 3] << 8) |
+                               _nx_secure_coalescing_test_output[offset + 4]))
+    {
+        _nx_secure_coalescing_test_records++;
+    }
+    _nx_secure_coalescing_test_bytes += length;
+
+    _nx_packet_release(packet_ptr);
+    return(NX_SUCCESS);
+}
+
+
+/* Pass the client what the server has written. Without a wait, report no packet when there
+   is nothing to read, as NetX does. */
+UINT _nx_tcp_socket_receive(NX_TCP_SOCKET *socket_ptr, NX_PACKET **packet_ptr, ULONG wait_option)
+{
+NX_PACKET *packet;
+ssize_t    received;
+
+    if (_nx_packet_allocate(socket_ptr -> nx_tcp_socket_ip_ptr -> nx_ip_default_packet_pool, &packet,
+                            NX_IPv4_TCP_PACKET, NX_NO_WAIT) != NX_SUCCESS)
+    {
+        return(NX_NO_PACKET);
+    }
+
+    received = recv(_nx_secure_coalescing_test_socket, packet -> nx_packet_prepend_ptr,
+                    (size_t)(packet -> nx_packet_data_end - packet -> nx_packet_prepend_ptr),
+                    (wait_option == NX_NO_WAIT) ? MSG_DONTWAIT : 0);
+    if (received <= 0)
+    {
+        _nx_packet_release(packet);
+        if ((received < 0) && (wait_option == NX_NO_WAIT) && ((errno == EAGAIN) || (errno == EWOULDBLOCK)))
+        {
+            return(NX_NO_PACKET);
+        }
+        return(NX_NOT_CONNECTED);
+    }
+    packet -> nx_packet_append_ptr = packet -> nx_packet_prepend_ptr + received;
+    packet -> nx_packet_length = (ULONG)received;
+
+    *packet_ptr = packet;
+    return(NX_SUCCESS);
+}
+
+
+static VOID _nx_secure_coalescing_test_check(INT passed, const CHAR *condition, INT line)
+{
+    if (!passed)
+    {
+        printf("  FAILED at line %d: %s\n", line, condition);
+        _nx_secure_coalescing_test_failures++;
+    }
+}
+
+
+static ULONG _nx_secure_coalescing_test_time(VOID)
+{
+    return((ULONG)time(NX_NULL));
+}
+
+
+/* Make a self-signed P-256 certificate for the server name. */
+static UINT _nx_secure_coalescing_test_certificate_create(VOID)
+{
+X509_NAME      *name;
+X509_EXTENSION *extension;
+X509V3_CTX      extension_context;
+UCHAR          *der = _nx_secure_coalescing_test_certificate_der;
+INT             length;
+
+    _nx_secure_coalescing_test_key = EVP_EC_gen("P-256");
+    _nx_secure_coalescing_test_certificate = X509_new();
+    if ((_nx_secure_coalescing_test_key == NX_NULL) || (_nx_secure_coalescing_test_certificate == NX_NULL))
+    {
+        return(NX_NOT_SUCCESSFUL);
+    }
+
+    X509_set_version(_nx_secure_coalescing_test_certificate, X509_VERSION_3);
+    ASN1_INTEGER_set(X509_get_serialNumber(_nx_secure_coalescing_test_certificate), 1);
+    X509_gmtime_adj(X509_getm_notBefore(_nx_secure_coalescing_test_certificate), -3600);
+    X509_gmtime_adj(X509_getm_notAfter(_nx_secure_coalescing_test_certificate), 86400);
+    X509_set_pubkey(_nx_secure_coalescing_test_certificate, _nx_secure_coalescing_test_key);
+
+    name = X509_get_subject_name(_nx_secure_coalescing_test_certificate);
+    X509_NAME_add_entry_by_txt(name, "CN", MBSTRING_ASC, (const UCHAR *)NX_SECURE_COALESCING_TEST_SERVER_NAME, -1, -1, 0);
+    X509_set_issuer_name(_nx_secure_coalescing_test_certificate, name);
+
+    X509V3_set_ctx(&extension_context, _nx_secure_coalescing_test_certificate, _nx_secure_coalescing_test_certificate,
+                   NX_NULL, NX_NULL, 0);
+    extension = X509V3_EXT_conf_nid(NX_NULL, &extension_context, NID_basic_constraints, "critical,CA:TRUE");
+    if (extension == NX_NULL)
+    {
+        return(NX_NOT_SUCCESSFUL);
+    }
+    X509_add_ext(_nx_secure_coalescing_test_certificate, extension, -1);
+    X509_EXTENSION_free(extension);
+
+    if (X509_sign(_nx_secure_coalescing_test_certificate, _nx_secure_coalescing_test_key, EVP_sha256()) == 0)
+    {
+        return(NX_NOT_SUCCESSFUL);
+    }
+
+    length = i2d_X509(_nx_secure_coalescing_test_certificate, NX_NULL);
+    if ((length <= 0) || ((UINT)length > sizeof(_nx_secure_coalescing_test_certificate_der)))
+    {
+        return(NX_NOT_SUCCESSFUL);
+    }
+    _nx_secure_coalescing_test_certificate_der_length = (UINT)i2d_X509(_nx_secure_coalescing_test_certificate, &der);
+
+    return(NX_SUCCESS);
+}
+
+
+/* A server context for one protocol version that accepts only the given ciphersuite. */
+static SSL_CTX *_nx_secure_coalescing_test_context_create(INT version, const CHAR *ciphersuite)
+{
+SSL_CTX *context = SSL_CTX_new(TLS_server_method());
+
+    if ((context == NX_NULL) ||
+        !SSL_CTX_set_min_proto_version(context, version) ||
+        !SSL_CTX_set_max_proto_version(context, version) ||
+        ((version == TLS1_3_VERSION) ? !SSL_CTX_set_ciphersuites(context, ciphersuite) :
+                                       !SSL_CTX_set_cipher_list(context, ciphersuite)) ||
+        !SSL_CTX_set_num_tickets(context, 0) ||
+        !SSL_CTX_use_certificate(context, _nx_secure_coalescing_test_certificate) ||
+        !SSL_CTX_use_PrivateKey(context, _nx_secure_coalescing_test_key))
+    {
+        ERR_print_errors_fp(stderr);
+        exit(1);
+    }
+    SSL_CTX_set_options(context, SSL_OP_NO_TICKET);
+    SSL_CTX_set_session_cache_mode(context, SSL_SESS_CACHE_OFF);
+
+    return(context);
+}
+
+
+/* Read length bytes of the stream from the client, and return whether they match the pattern. */
+static UINT _nx_secure_coalescing_test_server_read(SSL *ssl, ULONG length)
+{
+UCHAR data[NX_SECURE_TLS_MAX_PLAINTEXT_LENGTH];
+ULONG offset = 0;
+UINT  matched = NX_TRUE;
+INT   received;
+
+    while (offset < length)
+    {
+        received = SSL_read(ssl, data, (INT)(((length - offset) < sizeof(data)) ? (length - offset) : sizeof(data)));
+        if (received <= 0)
+        {
+            return(NX_FALSE);
+        }
+        if (memcmp(data, &_nx_secure_coalescing_test_pattern[offset % NX_SECURE_COALESCING_TEST_PATTERN_PERIOD],
+                   (size_t)received) != 0)
+        {
+            matched = NX_FALSE;
+        }
+        offset += (ULONG)received;
+    }
+
+    return(matched);
+}
+
+
+/* Act as an MQTT broker for one QoS 1 message from the client. Each SSL_read returns the data
+   of one record, so the PUBLISH and the PUBACKs must each come in one record. */
+static UINT _nx_secure_coalescing_test_broker(SSL *ssl)
+{
+UCHAR  data[256];
+UINT   topic_length = sizeof(NX_SECURE_COALESCING_TEST_TOPIC) - 1;
+UINT   message_length = sizeof(NX_SECURE_COALESCING_TEST_MESSAGE) - 1;
+UINT   remaining_length = 2 + topic_length + 2 + message_length;
+UINT   length = 0;
+UINT   i;
+USHORT packet_id;
+INT    received;
+
+    /* The PUBLISH: fixed header, topic, packet identifier and message. */
+    received = SSL_read(ssl, data, sizeof(data));
+    if ((received != (INT)(2 + remaining_length)) ||
+        (data[0] != ((MQTT_CONTROL_PACKET_TYPE_PUBLISH << 4) | MQTT_PUBLISH_QOS_LEVEL_1)) ||
+        (data[1] != remaining_length) || (data[2] != 0) || (data[3] != topic_length) ||
+        (memcmp(&data[4], NX_SECURE_COALESCING_TEST_TOPIC, topic_length) != 0) ||
+        (memcmp(&data[6 + topic_length], NX_SECURE_COALESCING_TEST_MESSAGE, message_length) != 0))
+    {
+        return(NX_FALSE);
+    }
+    packet_id = (USHORT)((data[4 + topic_length] << 8) | data[5 + topic_length]);
+
+    /* One record with its PUBACK, and messages for the client on the same topic. */
+    data[length++] = MQTT_CONTROL_PACKET_TYPE_PUBACK << 4;
+    data[length++] = 2;
+    data[length++] = (UCHAR)(packet_id >> 8);
+    data[length++] = (UCHAR)packet_id;
+    for (i = 0; i < NX_SECURE_COALESCING_TEST_BROKER_MESSAGES; i++)
+    {
+        data[length++] = (MQTT_CONTROL_PACKET_TYPE_PUBLISH << 4) | MQTT_PUBLISH_QOS_LEVEL_1;
+        data[length++] = (UCHAR)remaining_length;
+        data[length++] = 0;
+        data[length++] = (UCHAR)topic_length;
+        memcpy(&data[length], NX_SECURE_COALESCING_TEST_TOPIC, topic_length);
+        length += topic_length;
+        data[length++] = (UCHAR)((NX_SECURE_COALESCING_TEST_BROKER_PACKET_ID + i) >> 8);
+        data[length++] = (UCHAR)(NX_SECURE_COALESCING_TEST_BROKER_PACKET_ID + i);
+        memcpy(&data[length], NX_SECURE_COALESCING_TEST_MESSAGE, message_length);
+        length += message_length;
+    }
+    if (SSL_write(ssl, data, (INT)length) <= 0)
+    {
+        return(NX_FALSE);
+    }
+
+    /* The client's PUBACKs, all in one record. */
+    received = SSL_read(ssl, data, sizeof(data));
+    if (received != (INT)(4 * NX_SECURE_COALESCING_TEST_BROKER_MESSAGES))
+    {
+        return(NX_FALSE);
+    }
+    for (i = 0; i < NX_SECURE_COALESCING_TEST_BROKER_MESSAGES; i++)
+    {
+        if ((data[i * 4] != (MQTT_CONTROL_PACKET_TYPE_PUBACK << 4)) || (data[i * 4 + 1] != 2) ||
+            ((UINT)((data[i * 4 + 2] << 8) | data[i * 4 + 3]) != (NX_SECURE_COALESCING_TEST_BROKER_PACKET_ID + i)))
+        {
+            return(NX_FALSE);
+        }
+    }
+
+    return(NX_TRUE);
+}
+
+
+/* Serve one connection: complete the handshake, read the client's stream or act as an MQTT
+   broker, then read until the client's close_notify. */
+static VOID *_nx_secure_coalescing_test_server_thread(VOID *argument)
+{
+NX_SECURE_COALESCING_TEST_SERVER *server = argument;
+SSL                              *ssl = SSL_new(server -> nx_secure_coalescing_test_server_context);
+UCHAR                             data[1];
+INT                               received;
+
+    SSL_set_fd(ssl, server -> nx_secure_coalescing_test_server_socket);
+    if (SSL_accept(ssl) == 1)
+    {
+        server -> nx_secure_coalescing_test_server_handshake = NX_TRUE;
+
+        if (server -> nx_secure_coalescing_test_server_length != 0)
+        {
+            server -> nx_secure_coalescing_test_server_matched =
+                _nx_secure_coalescing_test_server_read(ssl, server -> nx_secure_coalescing_test_server_length);
+        }
+        else
+        {
+            server -> nx_secure_coalescing_test_server_matched = _nx_secure_coalescing_test_broker(ssl);
+        }
+
+        /* Nothing but the close_notify may follow. */
+        if (server -> nx_secure_coalescing_test_server_matched)
+        {
+            received = SSL_read(ssl, data, sizeof(data));
+            server -> nx_secure_coalescing_test_server_closed = (received <= 0) &&
+                                                                (SSL_get_error(ssl, received) == SSL_ERROR_ZERO_RETURN);
+        }
+        SSL_shutdown(ssl);
+    }
+    SSL_free(ssl);
+    close(server -> nx_secure_coalescing_test_server_socket);
+    ERR_clear_error();
+
+    return(NX_NULL);
+}
+
+
+/* Send sends pieces of the stream from the client, each in its own packet. */
+static UINT _nx_secure_coalescing_test_client_send(NX_SECURE_TLS_SESSION *session, UINT sends)
+{
+NX_PACKET *packet;
+UINT       i;
+
+    for (i = 0; i < sends; i++)
+    {
+        if (nx_secure_tls_packet_allocate(session, &_nx_secure_coalescing_test_pool, &packet, NX_NO_WAIT) != NX_SUCCESS)
+        {
+            return(NX_NO_PACKET);
+        }
+        if (_nx_packet_data_append(packet, &_nx_secure_coalescing_test_pattern[(i * NX_SECURE_COALESCING_TEST_SEND_LENGTH) %
+                                                                               NX_SECURE_COALESCING_TEST_PATTERN_PERIOD],
+                                   NX_SECURE_COALESCING_TEST_SEND_LENGTH, &_nx_secure_coalescing_test_pool,
+                                   NX_NO_WAIT) != NX_SUCCESS)
+        {
+            _nx_packet_release(packet);
+            return(NX_NO_PACKET);
+        }
+        if (nx_secure_tls_session_send(session, packet, NX_WAIT_FOREVER) != NX_SUCCESS)
+        {
+            _nx_packet_release(packet);
+            return(NX_NOT_SUCCESSFUL);
+        }
+    }
+
+    return(NX_SUCCESS);
+}
+
+
+/* Start a session of the NX Secure client with an OpenSSL server using server_context, which
+   reads server_length bytes of the stream, or acts as an MQTT broker if that is zero. The
+   record counts start from the end of the handshake. */
+static UINT _nx_secure_coalescing_test_connect(SSL_CTX *server_context, NX_SECURE_TLS_SESSION *session,
+                                               ULONG server_length)
+{
+NX_SECURE_COALESCING_TEST_SERVER *server = &_nx_secure_coalescing_test_server;
+int                               sockets[2];
+struct timeval                    timeout = { 5, 0 };
+UINT                              status;
+
+    status = nx_secure_tls_session_create(session, &nx_crypto_tls_ciphers_ecc,
+                                          _nx_secure_coalescing_test_metadata, sizeof(_nx_secure_coalescing_test_metadata));
+    if (status == NX_SUCCESS)
+    {
+        status = nx_secure_tls_ecc_initialize(session, nx_crypto_ecc_supported_groups,
+                                              nx_crypto_ecc_supported_groups_size, nx_crypto_ecc_curves);
+    }
+    if (status == NX_SUCCESS)
+    {
+        status = nx_secure_tls_session_packet_buffer_set(session, _nx_secure_coalescing_test_packet_buffer,
+                                                         sizeof(_nx_secure_coalescing_test_packet_buffer));
+    }
+    if (status == NX_SUCCESS)
+    {
+        status = nx_secure_tls_remote_certificate_buffer_allocate(session, 2, _nx_secure_coalescing_test_remote_buffer,
+                                                                  sizeof(_nx_secure_coalescing_test_remote_buffer));
+    }
+    if (status == NX_SUCCESS)
+    {
+        memset(&_nx_secure_coalescing_test_trusted_certificate, 0, sizeof(NX_SECURE_X509_CERT));
+        status = nx_secure_x509_certificate_initialize(&_nx_secure_coalescing_test_trusted_certificate,
+                                                       _nx_secure_coalescing_test_certificate_der,
+                                                       (USHORT)_nx_secure_coalescing_test_certificate_der_length,
+                                                       NX_NULL, 0, NX_NULL, 0, NX_SECURE_X509_KEY_TYPE_NONE);
+    }
+    if (status == NX_SUCCESS)
+    {
+        status = nx_secure_tls_trusted_certificate_add(session, &_nx_secure_coalescing_test_trusted_certificate);
+    }
+    if (status == NX_SUCCESS)
+    {
+        status = nx_secure_tls_session_time_function_set(session, _nx_secure_coalescing_test_time);
+    }
+    if ((status != NX_SUCCESS) || (socketpair(AF_UNIX, SOCK_STREAM, 0, sockets) != 0))
+    {
+        printf("  session setup failed, status 0x%x\n", status);
+        exit(1);
+    }
+
+    memset(server, 0, sizeof(NX_SECURE_COALESCING_TEST_SERVER));
+    server -> nx_secure_coalescing_test_server_context = server_context;
+    server -> nx_secure_coalescing_test_server_socket = sockets[1];
+    server -> nx_secure_coalescing_test_server_length = server_length;
+    if (pthread_create(&_nx_secure_coalescing_test_server_thread_id, NX_NULL,
+                       _nx_secure_coalescing_test_server_thread, server) != 0)
+    {
+        printf("  server thread failed\n");
+        exit(1);
+    }
+    _nx_secure_coalescing_test_socket = sockets[0];
+
+    /* A client that waits for data the server will not send gives up instead of hanging. */
+    setsockopt(sockets[0], SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+
+    status = nx_secure_tls_session_start(session, &_nx_secure_coalescing_test_tcp_socket, NX_WAIT_FOREVER);
+
+    _nx_secure_coalescing_test_records = 0;
+    _nx_secure_coalescing_test_bytes = 0;
+    _nx_secure_coalescing_test_events = 0;
+
+    return(status);
+}
+
+
+/* End the session, which sends anything still held back and the close_notify, and wait for
+   the server to finish. */
+static VOID _nx_secure_coalescing_test_disconnect(NX_SECURE_TLS_SESSION *session)
+{
+    nx_secure_tls_session_end(session, NX_WAIT_FOREVER);
+
+    close(_nx_secure_coalescing_test_socket);
+    pthread_join(_nx_secure_coalescing_test_server_thread_id, NX_NULL);
+
+    nx_secure_tls_session_delete(session);
+}
+
+
+/* Many small sends, with coalescing off and with a threshold below and at the largest record.
+   Each record carries record_overhead bytes besides the data. */
+static VOID _nx_secure_coalescing_test_sends_run(const CHAR *name, SSL_CTX *server_context, UINT record_overhead)
+{
+static const UINT                 thresholds[] = {0, NX_SECURE_COALESCING_TEST_THRESHOLD, NX_SECURE_TLS_MAX_PLAINTEXT_LENGTH};
+NX_SECURE_TLS_SESSION            *session = &_nx_secure_coalescing_test_session;
+ULONG                             length = NX_SECURE_COALESCING_TEST_SENDS * NX_SECURE_COALESCING_TEST_SEND_LENGTH;
+ULONG                             sends_per_record;
+ULONG                             expected_records;
+UINT                              status;
+UINT                              i;
+
+    for (i = 0; i < sizeof(thresholds) / sizeof(thresholds[0]); i++)
+    {
+
+        /* Held data is sent before a send that would take it past the threshold. */
+        sends_per_record = (thresholds[i] == 0) ? 1 : (thresholds[i] / NX_SECURE_COALESCING_TEST_SEND_LENGTH);
+        expected_records = (NX_SECURE_COALESCING_TEST_SENDS + sends_per_record - 1) / sends_per_record;
+
+        status = _nx_secure_coalescing_test_connect(server_context, session, length);
+        if (status == NX_SUCCESS)
+        {
+            status = nx_secure_tls_session_send_coalesce_set(session, thresholds[i], 0);
+        }
+        if (status == NX_SUCCESS)
+        {
+            status = _nx_secure_coalescing_test_client_send(session, NX_SECURE_COALESCING_TEST_SENDS);
+        }
+        if (status == NX_SUCCESS)
+        {
+            status = nx_secure_tls_session_send_flush(session, NX_WAIT_FOREVER);
+        }
+        printf("%-32s threshold %5u: status 0x%02x, %3lu records, %5lu bytes on the wire for %lu bytes\n",
+               name, thresholds[i], status, (unsigned long)_nx_secure_coalescing_test_records,
+               (unsigned long)_nx_secure_coalescing_test_bytes, (unsigned long)length);
+        NX_SECURE_COALESCING_TEST_CHECK(status == NX_SUCCESS);
+        NX_SECURE_COALESCING_TEST_CHECK(_nx_secure_coalescing_test_records == expected_records);
+        NX_SECURE_COALESCING_TEST_CHECK(_nx_secure_coalescing_test_bytes == (length + expected_records * record_overhead));
+
+        _nx_secure_coalescing_test_disconnect(session);
+        NX_SECURE_COALESCING_TEST_CHECK(_nx_secure_coalescing_test_server.nx_secure_coalescing_test_server_handshake);
+        NX_SECURE_COALESCING_TEST_CHECK(_nx_secure_coalescing_test_server.nx_secure_coalescing_test_server_matched);
+        NX_SECURE_COALESCING_TEST_CHECK(_nx_secure_coalescing_test_server.nx_secure_coalescing_test_server_closed);
+    }
+}
+
+
+/* Data still held back when the session ends goes out ahead of the close_notify. */
+static VOID _nx_secure_coalescing_test_close_run(const CHAR *name, SSL_CTX *server_context, UINT record_overhead)
+{
+NX_SECURE_TLS_SESSION *session = &_nx_secure_coalescing_test_session;
+ULONG                  length = NX_SECURE_COALESCING_TEST_HELD_SENDS * NX_SECURE_COALESCING_TEST_SEND_LENGTH;
+ULONG                  held_records = 0;
+UINT                   status;
+
+    status = _nx_secure_coalescing_test_connect(server_context, session, length);
+    if (status == NX_SUCCESS)
+    {
+        status = nx_secure_tls_session_send_coalesce_set(session, NX_SECURE_COALESCING_TEST_THRESHOLD, 0);
+    }
+    if (status == NX_SUCCESS)
+    {
+        status = _nx_secure_coalescing_test_client_send(session, NX_SECURE_COALESCING_TEST_HELD_SENDS);
+        held_records = _nx_secure_coalescing_test_records;
+    }
+
+    /* The held data, then the two bytes of the close_notify. */
+    _nx_secure_coalescing_test_disconnect(session);
+    printf("%-32s session end   : status 0x%02x, %3lu records while held, %lu records, %lu bytes at the end\n",
+           name, status, (unsigned long)held_records, (unsigned long)_nx_secure_coalescing_test_records,
+           (unsigned long)_nx_secure_coalescing_test_bytes);
+    NX_SECURE_COALESCING_TEST_CHECK(status == NX_SUCCESS);
+    NX_SECURE_COALESCING_TEST_CHECK(held_records == 0);
+    NX_SECURE_COALESCING_TEST_CHECK(_nx_secure_coalescing_test_records == 2);
+    NX_SECURE_COALESCING_TEST_CHECK(_nx_secure_coalescing_test_bytes == (length + 2 + 2 * record_overhead));
+    NX_SECURE_COALESCING_TEST_CHECK(_nx_secure_coalescing_test_server.nx_secure_coalescing_test_server_matched);
+    NX_SECURE_COALESCING_TEST_CHECK(_nx_secure_coalescing_test_server.nx_secure_coalescing_test_server_closed);
+}
+
+
+/* An MQTT QoS 1 message each way over a coalescing session. */
+static VOID _nx_secure_coalescing_test_mqtt_run(const CHAR *name, SSL_CTX *server_context, UINT record_overhead)
+{
+NXD_MQTT_CLIENT *client = &_nx_secure_coalescing_test_mqtt_client;
+NX_PACKET       *packet;
+struct pollfd    poll_socket;
+ULONG            publish_records = 0;
+UINT             status;
+
+    /* A connected client, as the client thread leaves it after the CONNACK. */
+    memset(client, 0, sizeof(NXD_MQTT_CLIENT));
+    client -> nxd_mqtt_client_state = NXD_MQTT_CLIENT_STATE_CONNECTED;
+    client -> nxd_mqtt_client_use_tls = NX_TRUE;
+    client -> nxd_mqtt_client_mutex_ptr = &client -> nxd_mqtt_protection;
+    client -> nxd_mqtt_client_packet_pool_ptr = &_nx_secure_coalescing_test_pool;
+    client -> nxd_mqtt_client_packet_identifier = 1;
+
+    status = _nx_secure_coalescing_test_connect(server_context, &client -> nxd_mqtt_tls_session, 0);
+    if (status == NX_SUCCESS)
+    {
+        status = nx_secure_tls_session_send_coalesce_set(&client -> nxd_mqtt_tls_session,
+                                                         NX_SECURE_COALESCING_TEST_THRESHOLD, 0);
+    }
+
+    /* The PUBLISH is sent at once, and kept until it is acknowledged. */
+    if (status == NX_SUCCESS)
+    {
+        status = _nxd_mqtt_client_publish(client, NX_SECURE_COALESCING_TEST_TOPIC, sizeof(NX_SECURE_COALESCING_TEST_TOPIC) - 1,
+                                          NX_SECURE_COALESCING_TEST_MESSAGE, sizeof(NX_SECURE_COALESCING_TEST_MESSAGE) - 1,
+                                          0, 1, NX_WAIT_FOREVER);
+        publish_records = _nx_secure_coalescing_test_records;
+        NX_SECURE_COALESCING_TEST_CHECK(client -> message_transmit_queue_head != NX_NULL);
+    }
+
+    /* Once the broker's record is in, process it as the client thread does on a receive event. */
+    poll_socket.fd = _nx_secure_coalescing_test_socket;
+    poll_socket.events = POLLIN;
+    if ((status == NX_SUCCESS) && (poll(&poll_socket, 1, 5000) == 1))
+    {
+        _nx_secure_coalescing_test_records = 0;
+        _nx_secure_coalescing_test_bytes = 0;
+        tx_mutex_get(client -> nxd_mqtt_client_mutex_ptr, TX_WAIT_FOREVER);
+        _nxd_mqtt_packet_receive_process(client);
+        tx_mutex_put(client -> nxd_mqtt_client_mutex_ptr);
+    }
+    else
+    {
+        status = NX_NOT_SUCCESSFUL;
+    }
+    printf("%-32s MQTT QoS 1    : status 0x%02x, %lu record for the PUBLISH, %lu record, %lu bytes for %u PUBACKs\n",
+           name, status, (unsigned long)publish_records, (unsigned long)_nx_secure_coalescing_test_records,
+           (unsigned long)_nx_secure_coalescing_test_bytes, NX_SECURE_COALESCING_TEST_BROKER_MESSAGES);
+    NX_SECURE_COALESCING_TEST_CHECK(status == NX_SUCCESS);
+    NX_SECURE_COALESCING_TEST_CHECK(publish_records == 1);
+    NX_SECURE_COALESCING_TEST_CHECK(client -> message_transmit_queue_head == NX_NULL);
+    NX_SECURE_COALESCING_TEST_CHECK(client -> message_receive_queue_depth == NX_SECURE_COALESCING_TEST_BROKER_MESSAGES);
+    NX_SECURE_COALESCING_TEST_CHECK(_nx_secure_coalescing_test_records == 1);
+    NX_SECURE_COALESCING_TEST_CHECK(_nx_secure_coalescing_test_bytes ==
+                                    (4 * NX_SECURE_COALESCING_TEST_BROKER_MESSAGES + record_overhead));
+    NX_SECURE_COALESCING_TEST_CHECK((_nx_secure_coalescing_test_events & MQTT_NETWORK_DISCONNECT_EVENT) == 0);
+
+    /* The messages the application would have read. */
+    while (client -> message_receive_queue_head != NX_NULL)
+    {
+        packet = client -> message_receive_queue_head;
+        client -> message_receive_queue_head = packet -> nx_packet_queue_next;
+        _nx_packet_release(packet);
+    }
+    while (client -> message_transmit_queue_head != NX_NULL)
+    {
+        packet = client -> message_transmit_queue_head;
+        client -> message_transmit_queue_head = packet -> nx_packet_queue_next;
+        _nx_packet_release(packet);
+    }
+
+    _nx_secure_coalescing_test_disconnect(&client -> nxd_mqtt_tls_session);
+    NX_SECURE_COALESCING_TEST_CHECK(_nx_secure_coalescing_test_server.nx_secure_coalescing_test_server_matched);
+    NX_SECURE_COALESCING_TEST_CHECK(_nx_secure_coalescing_test_server.nx_secure_coalescing_test_server_closed);
+}
+
+
+static VOID _nx_secure_coalescing_test_run(const CHAR *name, INT version, const CHAR *ciphersuite, UINT record_overhead)
+{
+SSL_CTX *server_context = _nx_secure_coalescing_test_context_create(version, ciphersuite);
+
+    _nx_secure_coalescing_test_sends_run(name, server_context, record_overhead);
+    _nx_secure_coalescing_test_close_run(name, server_context, record_overhead);
+    _nx_secure_coalescing_test_mqtt_run(name, server_context, record_overhead);
+
+    SSL_CTX_free(server_context);
+}
+
+
+int main(void)
+{
+ULONG packets_available;
+UINT  i;
+
+    signal(SIGPIPE, SIG_IGN);
+
+    for (i = 0; i < sizeof(_nx_secure_coalescing_test_pattern); i++)
+    {
+        _nx_secure_coalescing_test_pattern[i] = (UCHAR)(i % NX_SECURE_COALESCING_TEST_PATTERN_PERIOD);
+    }
+
+    if (_nx_secure_coalescing_test_certificate_create() != NX_SUCCESS)
+    {
+        ERR_print_errors_fp(stderr);
+        return(1);
+    }
+
+    if (_nx_packet_pool_create(&_nx_secure_coalescing_test_pool, "pool", NX_SECURE_COALESCING_TEST_PACKET_SIZE,
+                               _nx_secure_coalescing_test_pool_area, sizeof(_nx_secure_coalescing_test_pool_area)) != NX_SUCCESS)
+    {
+        return(1);
+    }
+    packets_available = _nx_secure_coalescing_test_pool.nx_packet_pool_available;
+    _nx_secure_coalescing_test_ip.nx_ip_default_packet_pool = &_nx_secure_coalescing_test_pool;
+    _nx_secure_coalescing_test_tcp_socket.nx_tcp_socket_ip_ptr = &_nx_secure_coalescing_test_ip;
+    _nx_secure_coalescing_test_tcp_socket.nx_tcp_socket_client_type = NX_TRUE;
+    _nx_secure_coalescing_test_tcp_socket.nx_tcp_socket_state = NX_TCP_ESTABLISHED;
+    _nx_secure_coalescing_test_tcp_socket.nx_tcp_socket_connect_ip.nxd_ip_version = NX_IP_VERSION_V4;
+
+    nx_secure_tls_initialize();
+
+    /* A record adds its 5-byte header and the 16-byte tag, and in TLS 1.2 the 8-byte explicit
+       nonce, or in TLS 1.3 the content type byte. */
+    _nx_secure_coalescing_test_run("TLS 1.2 ECDHE-ECDSA-AES128-GCM", TLS1_2_VERSION, "ECDHE-ECDSA-AES128-GCM-SHA256", 29);
+#if (NX_SECURE_TLS_TLS_1_3_ENABLED)
+    _nx_secure_coalescing_test_run("TLS 1.3 AES128-GCM", TLS1_3_VERSION, "TLS_AES_128_GCM_SHA256", 22);
+#endif
+
+    /* Every packet went back to the pool. */
+    NX_SECURE_COALESCING_TEST_CHECK(_nx_secure_coalescing_test_pool.nx_packet_pool_available == packets_available);
+
+    X509_free(_nx_secure_coalescing_test_certificate);
+    EVP_PKEY_free(_nx_secure_coalescing_test_key);
+
+    printf("%s, %u failed checks\n", _nx_secure_coalescing_test_failures ? "FAILED" : "PASSED", _nx_secure_coalescing_test_failures);
+    return(_nx_secure_coalescing_test_failures ? 1 : 0);
+}
@@ -0,0 +1,1145 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Secure Component                                                 */
+/**                                                                       */
+/**    Transport Layer Security (TLS)                                     */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+/**************************************************************************/
+/*                                                                        */
+/*  PROGRAM                                                RELEASE        */
+/*                                                                        */
+/*    nx_secure_tls_session_cache_test.c                  PORTABLE C      */
+/*                                                           6.1          */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This file is a host program, not part of NetX Secure. It tests      */
+/*    TLS 1.2 session resumption from the client session cache, and       */
+/*    measures how much it saves on reconnect.                            */
+/*                                                                        */
+/*    The NX Secure client runs in the calling thread. Its TCP send and   */
+/*    receive are replaced by a socket pair, and the other end is served  */
+/*    by OpenSSL in a second thread, with a self-signed P-256 certificate */
+/*    made at startup. Records from the server pass through a filter      */
+/*    that can change the ServerHello, or insert or drop a                */
+/*    ChangeCipherSpec, to drive the client down its failure paths:       */
+/*                                                                        */
+/*      - a full handshake stores the session, the next one resumes it,   */
+/*        and so does a cache restored from the saved entry;              */
+/*      - a ServerHello echoing the session ID with another version or    */
+/*        ciphersuite fails the handshake and drops the entry;            */
+/*      - a ChangeCipherSpec before the server Finished of a full         */
+/*        handshake is rejected, with or without a session offered;       */
+/*      - a resumed handshake missing the server ChangeCipherSpec fails;  */
+/*      - an entry with the wrong master secret fails on the server       */
+/*        Finished and is dropped;                                        */
+/*      - an expired entry is not offered;                                */
+/*      - with TLS 1.3 built in, a TLS 1.2 server still resumes, and a    */
+/*        TLS 1.3 server echoing the legacy session ID does not;          */
+/*      - with TLS 1.3 built in, a session ticket is stored and offered   */
+/*        as a PSK, resumes from a cache restored from the saved entry,   */
+/*        and when a server rejects it the client falls back to a full    */
+/*        handshake and stores the new ticket.                            */
+/*                                                                        */
+/*    The average time and bytes of full and resumed handshakes, and of   */
+/*    full and ticket handshakes with TLS 1.3, are printed. The program   */
+/*    exits with 1 if any check fails.                                    */
+/*                                                                        */
+/*    Build and run it with the Makefile in this directory:               */
+/*                                                                        */
+/*      make test                                                         */
+/*                                                                        */
+/**************************************************************************/
+
+#include <pthread.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <openssl/err.h>
+#include <openssl/ssl.h>
+#include <openssl/x509v3.h>
+#include "tx_api.h"
+#include "nx_api.h"
+#include "nx_packet.h"
+#include "nx_secure_tls_api.h"
+
+#define NX_SECURE_CACHE_TEST_SERVER_NAME        "localhost"
+#define NX_SECURE_CACHE_TEST_TIMED_CONNECTIONS  20
+#define NX_SECURE_CACHE_TEST_PACKET_SIZE        1600
+#define NX_SECURE_CACHE_TEST_PACKET_COUNT       40
+
+/* How the records from the server are changed on their way to the client. */
+#define NX_SECURE_CACHE_TEST_TAMPER_NONE        0
+#define NX_SECURE_CACHE_TEST_TAMPER_VERSION     1   /* ServerHello version becomes TLS 1.1.            */
+#define NX_SECURE_CACHE_TEST_TAMPER_CIPHERSUITE 2   /* ServerHello AES-128-GCM becomes AES-128-CBC.    */
+#define NX_SECURE_CACHE_TEST_TAMPER_EARLY_CCS   3   /* ChangeCipherSpec inserted after the ServerHello. */
+#define NX_SECURE_CACHE_TEST_TAMPER_DROP_CCS    4   /* The server ChangeCipherSpec is dropped.          */
+
+#define NX_SECURE_CACHE_TEST_CHECK(condition)   _nx_secure_cache_test_check((condition), #condition, __LINE__)
+
+typedef struct NX_SECURE_CACHE_TEST_SERVER_STRUCT
+{
+    SSL_CTX *nx_secure_cache_test_server_context;
+    int      nx_secure_cache_test_server_socket;
+
+    /* Set by the server thread: OpenSSL completed the handshake, and resumed a session. */
+    UINT     nx_secure_cache_test_server_handshake;
+    UINT     nx_secure_cache_test_server_resumed;
+} NX_SECURE_CACHE_TEST_SERVER;
+
+typedef struct NX_SECURE_CACHE_TEST_RESULT_STRUCT
+{
+    UINT     nx_secure_cache_test_result_status;
+    UINT     nx_secure_cache_test_result_resumed;
+    UINT     nx_secure_cache_test_result_tls_1_3;
+
+    /* What went over the wire: whether the ClientHello offered a session ID or a ticket, whether
+       the ServerHello echoed the ID and carried extensions, and whether the data came back. */
+    UINT     nx_secure_cache_test_result_offered;
+    UINT     nx_secure_cache_test_result_ticket_offered;
+    UINT     nx_secure_cache_test_result_echoed;
+    UINT     nx_secure_cache_test_result_extensions;
+    UINT     nx_secure_cache_test_result_data_echoed;
+    UINT     nx_secure_cache_test_result_server_handshake;
+    UINT     nx_secure_cache_test_result_server_resumed;
+
+    double   nx_secure_cache_test_result_milliseconds;
+    ULONG    nx_secure_cache_test_result_bytes_sent;
+    ULONG    nx_secure_cache_test_result_bytes_received;
+} NX_SECURE_CACHE_TEST_RESULT;
+
+extern const NX_SECURE_TLS_CRYPTO nx_crypto_tls_ciphers_ecc;
+extern const USHORT               nx_crypto_ecc_supported_groups[];
+extern const NX_CRYPTO_METHOD    *nx_crypto_ecc_curves[];
+extern const UINT                 nx_crypto_ecc_supported_groups_size;
+
+/* The ThreadX services NetX uses. The client runs in a single thread, so none of them wait. */
+UINT                 _tx_thread_preempt_disable;
+volatile ULONG       _tx_thread_system_state;
+TX_THREAD            _tx_timer_thread;
+static TX_THREAD     _nx_secure_cache_test_thread;
+TX_THREAD           *_tx_thread_current_ptr = &_nx_secure_cache_test_thread;
+NX_PACKET_POOL      *_nx_packet_pool_created_ptr;
+ULONG                _nx_packet_pool_created_count;
+
+static NX_IP                             _nx_secure_cache_test_ip;
+static NX_PACKET_POOL                    _nx_secure_cache_test_pool;
+static ULONG                             _nx_secure_cache_test_pool_area[NX_SECURE_CACHE_TEST_PACKET_COUNT *
+                                                                         (NX_SECURE_CACHE_TEST_PACKET_SIZE + sizeof(NX_PACKET)) / sizeof(ULONG)];
+static NX_TCP_SOCKET                     _nx_secure_cache_test_tcp_socket;
+static NX_SECURE_TLS_SESSION             _nx_secure_cache_test_session;
+static ULONG                             _nx_secure_cache_test_metadata[20000 / sizeof(ULONG)];
+static UCHAR                             _nx_secure_cache_test_packet_buffer[8000];
+static UCHAR                             _nx_secure_cache_test_remote_buffer[8000];
+static NX_SECURE_X509_CERT               _nx_secure_cache_test_trusted_certificate;
+static NX_SECURE_TLS_SESSION_CACHE       _nx_secure_cache_test_cache;
+static NX_SECURE_TLS_SESSION_CACHE_ENTRY _nx_secure_cache_test_entries[2];
+static NX_SECURE_TLS_SESSION_CACHE_ENTRY _nx_secure_cache_test_saved_entry;
+static UINT                              _nx_secure_cache_test_updates;
+static ULONG                             _nx_secure_cache_test_time_offset;
+static UINT                              _nx_secure_cache_test_failures;
+
+/* The server certificate and key, made by OpenSSL. The client trusts the certificate. */
+static EVP_PKEY                         *_nx_secure_cache_test_key;
+static X509                             *_nx_secure_cache_test_certificate;
+static UCHAR                             _nx_secure_cache_test_certificate_der[1024];
+static UINT                              _nx_secure_cache_test_certificate_der_length;
+
+/* State of the current connection. Bytes from the server are held in the input buffer until
+   their records are whole, so that the filter sees each record once before the client does. */
+static int                               _nx_secure_cache_test_socket;
+static UINT                              _nx_secure_cache_test_tamper;
+static UCHAR                             _nx_secure_cache_test_input[65536];
+static UINT                              _nx_secure_cache_test_input_length;
+static UINT                              _nx_secure_cache_test_input_checked;
+static UINT                              _nx_secure_cache_test_server_ccs;
+static UCHAR                             _nx_secure_cache_test_offered_id[32];
+static UINT                              _nx_secure_cache_test_offered_id_length;
+static NX_SECURE_CACHE_TEST_RESULT      *_nx_secure_cache_test_result;
+
+static VOID  _nx_secure_cache_test_check(INT passed, const CHAR *condition, INT line);
+static ULONG _nx_secure_cache_test_time(VOID);
+static UINT  _nx_secure_cache_test_update(NX_SECURE_TLS_SESSION_CACHE *cache, NX_SECURE_TLS_SESSION_CACHE_ENTRY *entry);
+static UINT  _nx_secure_cache_test_entries_used(NX_SECURE_TLS_SESSION_CACHE_ENTRY *entries, UINT count);
+static UINT  _nx_secure_cache_test_ticket_offered(const UCHAR *record, ULONG length);
+static UINT  _nx_secure_cache_test_certificate_create(VOID);
+static SSL_CTX *_nx_secure_cache_test_context_create(INT version, long cache_mode);
+#if (NX_SECURE_TLS_TLS_1_3_ENABLED)
+static SSL_CTX *_nx_secure_cache_test_ticket_context_create(VOID);
+#endif
+static VOID *_nx_secure_cache_test_server_thread(VOID *argument);
+static VOID  _nx_secure_cache_test_input_resize(UINT offset, UINT remove_length, const UCHAR *insert, UINT insert_length);
+static UINT  _nx_secure_cache_test_record_inspect(UINT offset);
+static UINT  _nx_secure_cache_test_connect(SSL_CTX *server_context, NX_SECURE_TLS_SESSION_CACHE *cache, UINT tamper,
+                                           NX_SECURE_CACHE_TEST_RESULT *result);
+static VOID  _nx_secure_cache_test_report(const CHAR *name, NX_SECURE_CACHE_TEST_RESULT *result);
+
+
+VOID _tx_thread_system_suspend(TX_THREAD *thread_ptr)
+{
+    NX_PARAMETER_NOT_USED(thread_ptr);
+}
+
+VOID _tx_thread_system_resume(TX_THREAD *thread_ptr)
+{
+    NX_PARAMETER_NOT_USED(thread_ptr);
+}
+
+UINT _tx_thread_sleep(ULONG timer_ticks)
+{
+    NX_PARAMETER_NOT_USED(timer_ticks);
+    return(TX_SUCCESS);
+}
+
+TX_THREAD *_tx_thread_identify(VOID)
+{
+    return(&_nx_secure_cache_test_thread);
+}
+
+ULONG _tx_time_get(VOID)
+{
+    return(0);
+}
+
+UINT _tx_mutex_create(TX_MUTEX *mutex_ptr, CHAR *name_ptr, UINT inherit)
+{
+    NX_PARAMETER_NOT_USED(mutex_ptr);
+    NX_PARAMETER_NOT_USED(name_ptr);
+    NX_PARAMETER_NOT_USED(inherit);
+    return(TX_SUCCESS);
+}
+
+UINT _tx_mutex_delete(TX_MUTEX *mutex_ptr)
+{
+    NX_PARAMETER_NOT_USED(mutex_ptr);
+    return(TX_SUCCESS);
+}
+
+UINT _tx_mutex_get(TX_MUTEX *mutex_ptr, ULONG wait_option)
+{
+    NX_PARAMETER_NOT_USED(mutex_ptr);
+    NX_PARAMETER_NOT_USED(wait_option);
+    return(TX_SUCCESS);
+}
+
+UINT _tx_mutex_put(TX_MUTEX *mutex_ptr)
+{
+    NX_PARAMETER_NOT_USED(mutex_ptr);
+    return(TX_SUCCESS);
+}
+
+VOID _nx_packet_pool_cleanup(TX_THREAD *thread_ptr, ULONG suspension_sequence)
+{
+    NX_PARAMETER_NOT_USED(thread_ptr);
+    NX_PARAMETER_NOT_USED(suspension_sequence);
+}
+
+
+/* Write the records the client sends to the server, noting the session ID and ticket its ClientHello offers. */
+UINT _nx_tcp_socket_send(NX_TCP_SOCKET *socket_ptr, NX_PACKET *packet_ptr, ULONG wait_option)
+{
+UCHAR      output[NX_SECURE_CACHE_TEST_PACKET_SIZE * NX_SECURE_CACHE_TEST_PACKET_COUNT];
+ULONG      length = 0;
+NX_PACKET *current_packet;
+ULONG      packet_length;
+
+    NX_PARAMETER_NOT_USED(socket_ptr);
+    NX_PARAMETER_NOT_USED(wait_option);
+
+    for (current_packet = packet_ptr; current_packet != NX_NULL; current_packet = current_packet -> nx_packet_next)
+    {
+        packet_length = (ULONG)(current_packet -> nx_packet_append_ptr - current_packet -> nx_packet_prepend_ptr);
+        memcpy(&output[length], current_packet -> nx_packet_prepend_ptr, packet_length);
+        length += packet_length;
+    }
+
+    /* Record header (5), handshake header (4), version (2), random (32), session ID length (1). */
+    if ((length > 44) && (output[0] == NX_SECURE_TLS_HANDSHAKE) && (output[5] == NX_SECURE_TLS_CLIENT_HELLO) &&
+        (output[43] <= sizeof(_nx_secure_cache_test_offered_id)) && (length >= 44u + output[43]))
+    {
+        _nx_secure_cache_test_offered_id_length = output[43];
+        memcpy(_nx_secure_cache_test_offered_id, &output[44], output[43]);
+        _nx_secure_cache_test_result -> nx_secure_cache_test_result_offered = (output[43] != 0);
+        _nx_secure_cache_test_result -> nx_secure_cache_test_result_ticket_offered =
+            _nx_secure_cache_test_ticket_offered(output, length);
+    }
+
+    if (write(_nx_secure_cache_test_socket, output, length) != (ssize_t)length)
+    {
+        return(NX_NOT_CONNECTED);
+    }
+    _nx_secure_cache_test_result -> nx_secure_cache_test_result_bytes_sent += length;
+
+    _nx_packet_release(packet_ptr);
+    return(NX_SUCCESS);
+}
+
+
+/* Pass the client the whole records received from the server, after the filter has seen them. */
+UINT _nx_tcp_socket_receive(NX_TCP_SOCKET *socket_ptr, NX_PACKET **packet_ptr, ULONG wait_option)
+{
+NX_PACKET *packet;
+ssize_t    received;
+UINT       record_end;
+UINT       length;
+
+    NX_PARAMETER_NOT_USED(wait_option);
+
+    while (_nx_secure_cache_test_input_checked == 0)
+    {
+        received = recv(_nx_secure_cache_test_socket, &_nx_secure_cache_test_input[_nx_secure_cache_test_input_length],
+                        sizeof(_nx_secure_cache_test_input) - _nx_secure_cache_test_input_length, 0);
+        if (received <= 0)
+        {
+            return(NX_NOT_CONNECTED);
+        }
+        _nx_secure_cache_test_input_length += (UINT)received;
+        _nx_secure_cache_test_result -> nx_secure_cache_test_result_bytes_received += (ULONG)received;
+
+        while (_nx_secure_cache_test_input_checked + 5 <= _nx_secure_cache_test_input_length)
+        {
+            record_end = _nx_secure_cache_test_input_checked + 5 +
+                         (UINT)((_nx_secure_cache_test_input[_nx_secure_cache_test_input_checked + 3] << 8) |
+                                _nx_secure_cache_test_input[_nx_secure_cache_test_input_checked + 4]);
+            if (record_end > _nx_secure_cache_test_input_length)
+            {
+                break;
+            }
+            _nx_secure_cache_test_input_checked = _nx_secure_cache_test_record_inspect(_nx_secure_cache_test_input_checked);
+        }
+    }
+
+    if (_nx_packet_allocate(socket_ptr -> nx_tcp_socket_ip_ptr -> nx_ip_default_packet_pool, &packet,
+                            NX_IPv4_TCP_PACKET, NX_NO_WAIT) != NX_SUCCESS)
+    {
+        return(NX_NO_PACKET);
+    }
+
+    length = (UINT)(packet -> nx_packet_data_end - packet -> nx_packet_prepend_ptr);
+    if (length > _nx_secure_cache_test_input_checked)
+    {
+        length = _nx_secure_cache_test_input_checked;
+    }
+    memcpy(packet -> nx_packet_prepend_ptr, _nx_secure_cache_test_input, length);
+    packet -> nx_packet_append_ptr = packet -> nx_packet_prepend_ptr + length;
+    packet -> nx_packet_length = length;
+    _nx_secure_cache_test_input_resize(0, length, NX_NULL, 0);
+    _nx_secure_cache_test_input_checked -= length;
+
+    *packet_ptr = packet;
+    return(NX_SUCCESS);
+}
+
+
+static VOID _nx_secure_cache_test_check(INT passed, const CHAR *condition, INT line)
+{
+    if (!passed)
+    {
+        printf("  FAILED at line %d: %s\n", line, condition);
+        _nx_secure_cache_test_failures++;
+    }
+}
+
+
+static ULONG _nx_secure_cache_test_time(VOID)
+{
+    return((ULONG)time(NX_NULL) + _nx_secure_cache_test_time_offset);
+}
+
+
+/* The cache update callback. An application would write the entry to flash here. */
+static UINT _nx_secure_cache_test_update(NX_SECURE_TLS_SESSION_CACHE *cache, NX_SECURE_TLS_SESSION_CACHE_ENTRY *entry)
+{
+    NX_PARAMETER_NOT_USED(cache);
+
+    _nx_secure_cache_test_updates++;
+    if (entry -> nx_secure_tls_session_cache_server_name_length != 0)
+    {
+        _nx_secure_cache_test_saved_entry = *entry;
+    }
+    return(NX_SUCCESS);
+}
+
+
+/* Whether the ClientHello record of the given length carries a pre_shared_key extension,
+   which is how the client offers a TLS 1.3 ticket. The session ID is known to fit. */
+static UINT _nx_secure_cache_test_ticket_offered(const UCHAR *record, ULONG length)
+{
+ULONG offset = 44u + record[43];
+ULONG extensions_end;
+
+    /* Ciphersuites, compression methods, then the extensions. */
+    if ((offset + 2) > length)
+    {
+        return(NX_FALSE);
+    }
+    offset += 2 + (ULONG)((record[offset] << 8) | record[offset + 1]);
+    if ((offset + 1) > length)
+    {
+        return(NX_FALSE);
+    }
+    offset += 1 + (ULONG)record[offset];
+    if ((offset + 2) > length)
+    {
+        return(NX_FALSE);
+    }
+    extensions_end = offset + 2 + (ULONG)((record[offset] << 8) | record[offset + 1]);
+    if (extensions_end > length)
+    {
+        extensions_end = length;
+    }
+
+    for (offset += 2; (offset + 4) <= extensions_end; offset += 4 + (ULONG)((record[offset + 2] << 8) | record[offset + 3]))
+    {
+        if (((record[offset] << 8) | record[offset + 1]) == NX_SECURE_TLS_EXTENSION_PRE_SHARED_KEY)
+        {
+            return(NX_TRUE);
+        }
+    }
+    return(NX_FALSE);
+}
+
+
+static UINT _nx_secure_cache_test_entries_used(NX_SECURE_TLS_SESSION_CACHE_ENTRY *entries, UINT count)
+{
+UINT used = 0;
+UINT i;
+
+    for (i = 0; i < count; i++)
+    {
+        if (entries[i].nx_secure_tls_session_cache_server_name_length != 0)
+        {
+            used++;
+        }
+    }
+    return(used);
+}
+
+
+/* Make a self-signed P-256 certificate for the server name. */
+static UINT _nx_secure_cache_test_certificate_create(VOID)
+{
+X509_NAME      *name;
+X509_EXTENSION *extension;
+X509V3_CTX      extension_context;
+UCHAR          *der = _nx_secure_cache_test_certificate_der;
+INT             length;
+
+    _nx_secure_cache_test_key = EVP_EC_gen("P-256");
+    _nx_secure_cache_test_certificate = X509_new();
+    if ((_nx_secure_cache_test_key == NX_NULL) || (_nx_secure_cache_test_certificate == NX_NULL))
+    {
+        return(NX_NOT_SUCCESSFUL);
+    }
+
+    X509_set_version(_nx_secure_cache_test_certificate, X509_VERSION_3);
+    ASN1_INTEGER_set(X509_get_serialNumber(_nx_secure_cache_test_certificate), 1);
+    X509_gmtime_adj(X509_getm_notBefore(_nx_secure_cache_test_certificate), -3600);
+    X509_gmtime_adj(X509_getm_notAfter(_nx_secure_cache_test_certificate), 2 * NX_SECURE_TLS_SESSION_CACHE_LIFETIME);
+    X509_set_pubkey(_nx_secure_cache_test_certificate, _nx_secure_cache_test_key);
+
+    name = X509_get_subject_name(_nx_secure_cache_test_certificate);
+    X509_NAME_add_entry_by_txt(name, "CN", MBSTRING_ASC, (const UCHAR *)NX_SECURE_CACHE_TEST_SERVER_NAME, -1, -1, 0);
+    X509_set_issuer_name(_nx_secure_cache_test_certificate, name);
+
+    X509V3_set_ctx(&extension_context, _nx_secure_cache_test_certificate, _nx_secure_cache_test_certificate,
+                   NX_NULL, NX_NULL, 0);
+    extension = X509V3_EXT_conf_nid(NX_NULL, &extension_context, NID_basic_constraints, "critical,CA:TRUE");
+    if (extension == NX_NULL)
+    {
+        return(NX_NOT_SUCCESSFUL);
+    }
+    X509_add_ext(_nx_secure_cache_test_certificate, extension, -1);
+    X509_EXTENSION_free(extension);
+
+    if (X509_sign(_nx_secure_cache_test_certificate, _nx_secure_cache_test_key, EVP_sha256()) == 0)
+    {
+        return(NX_NOT_SUCCESSFUL);
+    }
+
+    length = i2d_X509(_nx_secure_cache_test_certificate, NX_NULL);
+    if ((length <= 0) || ((UINT)length > sizeof(_nx_secure_cache_test_certificate_der)))
+    {
+        return(NX_NOT_SUCCESSFUL);
+    }
+    _nx_secure_cache_test_certificate_der_length = (UINT)i2d_X509(_nx_secure_cache_test_certificate, &der);
+
+    return(NX_SUCCESS);
+}
+
+
+/* A server context for one protocol version. Tickets are off, so sessions resume by ID only. */
+static SSL_CTX *_nx_secure_cache_test_context_create(INT version, long cache_mode)
+{
+SSL_CTX *context = SSL_CTX_new(TLS_server_method());
+
+    if ((context == NX_NULL) ||
+        !SSL_CTX_set_min_proto_version(context, version) ||
+        !SSL_CTX_set_max_proto_version(context, version) ||
+        !SSL_CTX_set_cipher_list(context, "ECDHE-ECDSA-AES128-GCM-SHA256") ||
+        !SSL_CTX_set_num_tickets(context, 0) ||
+        !SSL_CTX_set_session_id_context(context, (const UCHAR *)"nx", 2) ||
+        !SSL_CTX_use_certificate(context, _nx_secure_cache_test_certificate) ||
+        !SSL_CTX_use_PrivateKey(context, _nx_secure_cache_test_key))
+    {
+        ERR_print_errors_fp(stderr);
+        exit(1);
+    }
+    SSL_CTX_set_options(context, SSL_OP_NO_TICKET);
+    SSL_CTX_set_session_cache_mode(context, cache_mode);
+
+    return(context);
+}
+
+
+#if (NX_SECURE_TLS_TLS_1_3_ENABLED)
+/* A TLS 1.3 server context that issues one ticket per connection. Each context has its own
+   ticket key, so a ticket from one is rejected by another. */
+static SSL_CTX *_nx_secure_cache_test_ticket_context_create(VOID)
+{
+SSL_CTX *context = _nx_secure_cache_test_context_create(TLS1_3_VERSION, SSL_SESS_CACHE_SERVER);
+
+    SSL_CTX_clear_options(context, SSL_OP_NO_TICKET);
+    if (!SSL_CTX_set_num_tickets(context, 1) ||
+        !SSL_CTX_set_ciphersuites(context, "TLS_AES_128_GCM_SHA256"))
+    {
+        ERR_print_errors_fp(stderr);
+        exit(1);
+    }
+
+    return(context);
+}
+#endif
+
+
+/* Serve one connection: complete the handshake and echo one read. */
+static VOID *_nx_secure_cache_test_server_thread(VOID *argument)
+{
+NX_SECURE_CACHE_TEST_SERVER *server = argument;
+SSL                         *ssl = SSL_new(server -> nx_secure_cache_test_server_context);
+CHAR                         data[64];
+INT                          length;
+
+    SSL_set_fd(ssl, server -> nx_secure_cache_test_server_socket);
+    if (SSL_accept(ssl) == 1)
+    {
+        server -> nx_secure_cache_test_server_handshake = NX_TRUE;
+        server -> nx_secure_cache_test_server_resumed = (UINT)SSL_session_reused(ssl);
+
+        length = SSL_read(ssl, data, sizeof(data));
+        if (length > 0)
+        {
+            SSL_write(ssl, data, length);
+        }
+        SSL_shutdown(ssl);
+    }
+    SSL_free(ssl);
+    close(server -> nx_secure_cache_test_server_socket);
+    ERR_clear_error();
+
+    return(NX_NULL);
+}
+
+
+/* Replace remove_length bytes of the input buffer at offset with insert_length bytes. */
+static VOID _nx_secure_cache_test_input_resize(UINT offset, UINT remove_length, const UCHAR *insert, UINT insert_length)
+{
+    if ((_nx_secure_cache_test_input_length - remove_length + insert_length) > sizeof(_nx_secure_cache_test_input))
+    {
+        fprintf(stderr, "Input buffer overflow.\n");
+        exit(1);
+    }
+
+    memmove(&_nx_secure_cache_test_input[offset + insert_length], &_nx_secure_cache_test_input[offset + remove_length],
+            _nx_secure_cache_test_input_length - offset - remove_length);
+    if (insert_length != 0)
+    {
+        memcpy(&_nx_secure_cache_test_input[offset], insert, insert_length);
+    }
+    _nx_secure_cache_test_input_length = _nx_secure_cache_test_input_length - remove_length + insert_length;
+}
+
+
+/* Look at the whole record at offset, change it as the current tamper mode says, and
+   return the offset of the next record. Only the plaintext records before the server
+   ChangeCipherSpec are looked into. */
+static UINT _nx_secure_cache_test_record_inspect(UINT offset)
+{
+static const UCHAR change_cipher_spec[] = {NX_SECURE_TLS_CHANGE_CIPHER_SPEC, 0x03, 0x03, 0x00, 0x01, 0x01};
+UCHAR             *record = &_nx_secure_cache_test_input[offset];
+UINT               record_length = (UINT)((record[3] << 8) | record[4]);
+UINT               message_offset;
+UINT               message_length;
+UINT               id_length;
+UINT               split;
+UCHAR             *hello;
+UCHAR              insert[sizeof(change_cipher_spec) + 5];
+
+    if (_nx_secure_cache_test_server_ccs)
+    {
+        return(offset + 5 + record_length);
+    }
+
+    if (record[0] == NX_SECURE_TLS_CHANGE_CIPHER_SPEC)
+    {
+        _nx_secure_cache_test_server_ccs = NX_TRUE;
+        if (_nx_secure_cache_test_tamper == NX_SECURE_CACHE_TEST_TAMPER_DROP_CCS)
+        {
+            _nx_secure_cache_test_input_resize(offset, 5 + record_length, NX_NULL, 0);
+            return(offset);
+        }
+        return(offset + 5 + record_length);
+    }
+
+    if (record[0] != NX_SECURE_TLS_HANDSHAKE)
+    {
+        return(offset + 5 + record_length);
+    }
+
+    for (message_offset = 5; (message_offset + 4) <= (5 + record_length); message_offset += 4 + message_length)
+    {
+        message_length = (UINT)((record[message_offset + 1] << 16) | (record[message_offset + 2] << 8) | record[message_offset + 3]);
+        if (record[message_offset] != NX_SECURE_TLS_SERVER_HELLO)
+        {
+            continue;
+        }
+
+        /* Version (2), random (32), session ID, ciphersuite (2), compression (1), extensions. */
+        hello = &record[message_offset + 4];
+        id_length = hello[34];
+        _nx_secure_cache_test_result -> nx_secure_cache_test_result_echoed =
+            (_nx_secure_cache_test_offered_id_length != 0) && (id_length == _nx_secure_cache_test_offered_id_length) &&
+            (memcmp(&hello[35], _nx_secure_cache_test_offered_id, id_length) == 0);
+        _nx_secure_cache_test_result -> nx_secure_cache_test_result_extensions = (message_length > (35 + id_length + 3));
+
+        switch (_nx_secure_cache_test_tamper)
+        {
+        case NX_SECURE_CACHE_TEST_TAMPER_VERSION:
+            hello[1] = 0x02;
+            break;
+
+        case NX_SECURE_CACHE_TEST_TAMPER_CIPHERSUITE:
+            if (hello[35 + id_length + 1] == 0x2B)
+            {
+                hello[35 + id_length + 1] = 0x23;
+            }
+            break;
+
+        case NX_SECURE_CACHE_TEST_TAMPER_EARLY_CCS:
+
+            /* End the record after the ServerHello, add the ChangeCipherSpec, and put any
+               messages that followed the ServerHello in a record of their own. */
+            split = message_offset + 4 + message_length;
+            memcpy(insert, change_cipher_spec, sizeof(change_cipher_spec));
+            insert[sizeof(change_cipher_spec)] = NX_SECURE_TLS_HANDSHAKE;
+            insert[sizeof(change_cipher_spec) + 1] = record[1];
+            insert[sizeof(change_cipher_spec) + 2] = record[2];
+            insert[sizeof(change_cipher_spec) + 3] = (UCHAR)((5 + record_length - split) >> 8);
+            insert[sizeof(change_cipher_spec) + 4] = (UCHAR)(5 + record_length - split);
+            record[3] = (UCHAR)((split - 5) >> 8);
+            record[4] = (UCHAR)(split - 5);
+            _nx_secure_cache_test_input_resize(offset + split, 0, insert,
+                                               (split < 5 + record_length) ? sizeof(insert) : sizeof(change_cipher_spec));
+            _nx_secure_cache_test_tamper = NX_SECURE_CACHE_TEST_TAMPER_NONE;
+            return(offset + split + sizeof(change_cipher_spec));
+
+        default:
+            break;
+        }
+    }
+
+    return(offset + 5 + record_length);
+}
+
+
+/* Run one connection of the NX Secure client to an OpenSSL server using server_context. */
+static UINT _nx_secure_cache_test_connect(SSL_CTX *server_context, NX_SECURE_TLS_SESSION_CACHE *cache, UINT tamper,
+                                          NX_SECURE_CACHE_TEST_RESULT *result)
+{
+NX_SECURE_TLS_SESSION      *session = &_nx_secure_cache_test_session;
+NX_SECURE_CACHE_TEST_SERVER server;
+pthread_t                   server_thread;
+int                         sockets[2];
+struct timeval              timeout = { 1, 0 };
+struct timespec             start;
+struct timespec             end;
+NX_PACKET                  *packet;
+CHAR                        data[16];
+ULONG                       data_length;
+UINT                        status;
+
+    memset(result, 0, sizeof(NX_SECURE_CACHE_TEST_RESULT));
+    _nx_secure_cache_test_result = result;
+    _nx_secure_cache_test_tamper = tamper;
+    _nx_secure_cache_test_input_length = 0;
+    _nx_secure_cache_test_input_checked = 0;
+    _nx_secure_cache_test_server_ccs = NX_FALSE;
+    _nx_secure_cache_test_offered_id_length = 0;
+
+    status = nx_secure_tls_session_create(session, &nx_crypto_tls_ciphers_ecc,
+                                          _nx_secure_cache_test_metadata, sizeof(_nx_secure_cache_test_metadata));
+    if (status == NX_SUCCESS)
+    {
+        status = nx_secure_tls_ecc_initialize(session, nx_crypto_ecc_supported_groups,
+                                              nx_crypto_ecc_supported_groups_size, nx_crypto_ecc_curves);
+    }
+    if (status == NX_SUCCESS)
+    {
+        status = nx_secure_tls_session_packet_buffer_set(session, _nx_secure_cache_test_packet_buffer,
+                                                         sizeof(_nx_secure_cache_test_packet_buffer));
+    }
+    if (status == NX_SUCCESS)
+    {
+        status = nx_secure_tls_remote_certificate_buffer_allocate(session, 2, _nx_secure_cache_test_remote_buffer,
+                                                                  sizeof(_nx_secure_cache_test_remote_buffer));
+    }
+    if (status == NX_SUCCESS)
+    {
+        memset(&_nx_secure_cache_test_trusted_certificate, 0, sizeof(NX_SECURE_X509_CERT));
+        status = nx_secure_x509_certificate_initialize(&_nx_secure_cache_test_trusted_certificate,
+                                                       _nx_secure_cache_test_certificate_der,
+                                                       (USHORT)_nx_secure_cache_test_certificate_der_length,
+                                                       NX_NULL, 0, NX_NULL, 0, NX_SECURE_X509_KEY_TYPE_NONE);
+    }
+    if (status == NX_SUCCESS)
+    {
+        status = nx_secure_tls_trusted_certificate_add(session, &_nx_secure_cache_test_trusted_certificate);
+    }
+    if (status == NX_SUCCESS)
+    {
+        status = nx_secure_tls_session_time_function_set(session, _nx_secure_cache_test_time);
+    }
+    if ((status == NX_SUCCESS) && (cache != NX_NULL))
+    {
+        status = nx_secure_tls_session_cache_set(session, cache, (const UCHAR *)NX_SECURE_CACHE_TEST_SERVER_NAME,
+                                                 sizeof(NX_SECURE_CACHE_TEST_SERVER_NAME) - 1);
+    }
+    if ((status != NX_SUCCESS) || (socketpair(AF_UNIX, SOCK_STREAM, 0, sockets) != 0))
+    {
+        printf("  session setup failed, status 0x%x\n", status);
+        exit(1);
+    }
+
+    memset(&server, 0, sizeof(server));
+    server.nx_secure_cache_test_server_context = server_context;
+    server.nx_secure_cache_test_server_socket = sockets[1];
+    if (pthread_create(&server_thread, NX_NULL, _nx_secure_cache_test_server_thread, &server) != 0)
+    {
+        printf("  server thread failed\n");
+        exit(1);
+    }
+    _nx_secure_cache_test_socket = sockets[0];
+
+    /* A client that waits for a record the filter removed gives up instead of blocking the server. */
+    setsockopt(sockets[0], SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    status = nx_secure_tls_session_start(session, &_nx_secure_cache_test_tcp_socket, NX_WAIT_FOREVER);
+    clock_gettime(CLOCK_MONOTONIC, &end);
+
+    result -> nx_secure_cache_test_result_status = status;
+    result -> nx_secure_cache_test_result_resumed = session -> nx_secure_tls_session_resumed;
+#if (NX_SECURE_TLS_TLS_1_3_ENABLED)
+    result -> nx_secure_cache_test_result_tls_1_3 = session -> nx_secure_tls_1_3;
+#endif
+    result -> nx_secure_cache_test_result_milliseconds = (double)(end.tv_sec - start.tv_sec) * 1e3 +
+                                                         (double)(end.tv_nsec - start.tv_nsec) / 1e6;
+
+    if (status == NX_SUCCESS)
+    {
+        if (nx_secure_tls_packet_allocate(session, &_nx_secure_cache_test_pool, &packet, NX_NO_WAIT) == NX_SUCCESS)
+        {
+            _nx_packet_data_append(packet, "ping", 4, &_nx_secure_cache_test_pool, NX_NO_WAIT);
+            if (nx_secure_tls_session_send(session, packet, NX_NO_WAIT) != NX_SUCCESS)
+            {
+                _nx_packet_release(packet);
+            }
+            else if (nx_secure_tls_session_receive(session, &packet, NX_WAIT_FOREVER) == NX_SUCCESS)
+            {
+                memset(data, 0, sizeof(data));
+                _nx_packet_data_extract_offset(packet, 0, data, sizeof(data) - 1, &data_length);
+                result -> nx_secure_cache_test_result_data_echoed = (data_length == 4) && (memcmp(data, "ping", 4) == 0);
+                _nx_packet_release(packet);
+            }
+        }
+    }
+
+    /* The session keeps the records it had received when the handshake failed until it is ended. */
+    nx_secure_tls_session_end(session, NX_NO_WAIT);
+
+    close(sockets[0]);
+    pthread_join(server_thread, NX_NULL);
+    result -> nx_secure_cache_test_result_server_handshake = server.nx_secure_cache_test_server_handshake;
+    result -> nx_secure_cache_test_result_server_resumed = server.nx_secure_cache_test_server_resumed;
+
+    nx_secure_tls_session_delete(session);
+
+    return(status);
+}
+
+
+static VOID _nx_secure_cache_test_report(const CHAR *name, NX_SECURE_CACHE_TEST_RESULT *result)
+{
+    printf("%-40s status 0x%02x, %s%s, offered %u, ticket %u, echoed %u, server resumed %u, %.2f ms, %lu/%lu bytes\n", name,
+           result -> nx_secure_cache_test_result_status,
+           result -> nx_secure_cache_test_result_tls_1_3 ? "TLS 1.3" : "TLS 1.2",
+           result -> nx_secure_cache_test_result_resumed ? " resumed" : "",
+           result -> nx_secure_cache_test_result_offered,
+           result -> nx_secure_cache_test_result_ticket_offered,
+           result -> nx_secure_cache_test_result_echoed,
+           result -> nx_secure_cache_test_result_server_resumed,
+           result -> nx_secure_cache_test_result_milliseconds,
+           (unsigned long)result -> nx_secure_cache_test_result_bytes_sent,
+           (unsigned long)result -> nx_secure_cache_test_result_bytes_received);
+}
+
+
+int main(void)
+{
+SSL_CTX                          *server_context;
+SSL_CTX                          *uncached_server_context;
+#if (NX_SECURE_TLS_TLS_1_3_ENABLED)
+SSL_CTX                          *tls_1_3_server_context;
+SSL_CTX                          *ticket_server_context;
+SSL_CTX                          *restarted_server_context;
+NX_SECURE_TLS_SESSION_CACHE       ticket_cache;
+NX_SECURE_TLS_SESSION_CACHE_ENTRY ticket_entries[1];
+UCHAR                             saved_ticket_entry[sizeof(NX_SECURE_TLS_SESSION_CACHE_ENTRY)];
+NX_SECURE_TLS_SESSION_CACHE_ENTRY restored_ticket_entry;
+#endif
+NX_SECURE_TLS_SESSION_CACHE       restored_cache;
+NX_SECURE_TLS_SESSION_CACHE_ENTRY restored_entries[1];
+NX_SECURE_CACHE_TEST_RESULT       result;
+NX_SECURE_CACHE_TEST_RESULT       full_result;
+double                            full_milliseconds = 0.0;
+double                            resumed_milliseconds = 0.0;
+ULONG                             full_bytes = 0;
+ULONG                             resumed_bytes = 0;
+ULONG                             packets_available;
+UINT                              updates;
+UINT                              i;
+
+    signal(SIGPIPE, SIG_IGN);
+
+    if (_nx_secure_cache_test_certificate_create() != NX_SUCCESS)
+    {
+        ERR_print_errors_fp(stderr);
+        return(1);
+    }
+    server_context = _nx_secure_cache_test_context_create(TLS1_2_VERSION, SSL_SESS_CACHE_SERVER);
+    uncached_server_context = _nx_secure_cache_test_context_create(TLS1_2_VERSION, SSL_SESS_CACHE_OFF);
+#if (NX_SECURE_TLS_TLS_1_3_ENABLED)
+    tls_1_3_server_context = _nx_secure_cache_test_context_create(TLS1_3_VERSION, SSL_SESS_CACHE_SERVER);
+#endif
+
+    if (_nx_packet_pool_create(&_nx_secure_cache_test_pool, "pool", NX_SECURE_CACHE_TEST_PACKET_SIZE,
+                               _nx_secure_cache_test_pool_area, sizeof(_nx_secure_cache_test_pool_area)) != NX_SUCCESS)
+    {
+        return(1);
+    }
+    packets_available = _nx_secure_cache_test_pool.nx_packet_pool_available;
+    _nx_secure_cache_test_ip.nx_ip_default_packet_pool = &_nx_secure_cache_test_pool;
+    _nx_secure_cache_test_tcp_socket.nx_tcp_socket_ip_ptr = &_nx_secure_cache_test_ip;
+    _nx_secure_cache_test_tcp_socket.nx_tcp_socket_client_type = NX_TRUE;
+    _nx_secure_cache_test_tcp_socket.nx_tcp_socket_state = NX_TCP_ESTABLISHED;
+    _nx_secure_cache_test_tcp_socket.nx_tcp_socket_connect_ip.nxd_ip_version = NX_IP_VERSION_V4;
+
+    nx_secure_tls_initialize();
+    if (nx_secure_tls_session_cache_create(&_nx_secure_cache_test_cache, _nx_secure_cache_test_entries,
+                                           sizeof(_nx_secure_cache_test_entries), _nx_secure_cache_test_update) != NX_SUCCESS)
+    {
+        return(1);
+    }
+
+    /* A full handshake stores the session, and the next connection resumes it. */
+    _nx_secure_cache_test_connect(server_context, &_nx_secure_cache_test_cache, NX_SECURE_CACHE_TEST_TAMPER_NONE, &full_result);
+    _nx_secure_cache_test_report("full handshake", &full_result);
+    NX_SECURE_CACHE_TEST_CHECK(full_result.nx_secure_cache_test_result_status == NX_SUCCESS);
+    NX_SECURE_CACHE_TEST_CHECK(!full_result.nx_secure_cache_test_result_offered);
+    NX_SECURE_CACHE_TEST_CHECK(!full_result.nx_secure_cache_test_result_resumed);
+    NX_SECURE_CACHE_TEST_CHECK(!full_result.nx_secure_cache_test_result_tls_1_3);
+    NX_SECURE_CACHE_TEST_CHECK(full_result.nx_secure_cache_test_result_data_echoed);
+    NX_SECURE_CACHE_TEST_CHECK(_nx_secure_cache_test_entries_used(_nx_secure_cache_test_entries, 2) == 1);
+    NX_SECURE_CACHE_TEST_CHECK(_nx_secure_cache_test_saved_entry.nx_secure_tls_session_cache_ciphersuite == 0xC02B);
+
+    _nx_secure_cache_test_connect(server_context, &_nx_secure_cache_test_cache, NX_SECURE_CACHE_TEST_TAMPER_NONE, &result);
+    _nx_secure_cache_test_report("resumed handshake", &result);
+    NX_SECURE_CACHE_TEST_CHECK(result.nx_secure_cache_test_result_status == NX_SUCCESS);
+    NX_SECURE_CACHE_TEST_CHECK(result.nx_secure_cache_test_result_echoed);
+    NX_SECURE_CACHE_TEST_CHECK(result.nx_secure_cache_test_result_resumed);
+    NX_SECURE_CACHE_TEST_CHECK(result.nx_secure_cache_test_result_server_resumed);
+    NX_SECURE_CACHE_TEST_CHECK(!result.nx_secure_cache_test_result_tls_1_3);
+    NX_SECURE_CACHE_TEST_CHECK(result.nx_secure_cache_test_result_data_echoed);
+    NX_SECURE_CACHE_TEST_CHECK(result.nx_secure_cache_test_result_bytes_received <
+                               full_result.nx_secure_cache_test_result_bytes_received);
+
+    /* The entry given to the update callback resumes the session from a new cache, as after a reboot. */
+    if (nx_secure_tls_session_cache_create(&restored_cache, restored_entries, sizeof(restored_entries),
+                                           NX_NULL) != NX_SUCCESS)
+    {
+        return(1);
+    }
+    NX_SECURE_CACHE_TEST_CHECK(nx_secure_tls_session_cache_entry_restore(&restored_cache,
+                                                                         &_nx_secure_cache_test_saved_entry) == NX_SUCCESS);
+    _nx_secure_cache_test_connect(server_context, &restored_cache, NX_SECURE_CACHE_TEST_TAMPER_NONE, &result);
+    _nx_secure_cache_test_report("restored entry", &result);
+    NX_SECURE_CACHE_TEST_CHECK(result.nx_secure_cache_test_result_status == NX_SUCCESS);
+    NX_SECURE_CACHE_TEST_CHECK(result.nx_secure_cache_test_result_resumed);
+    NX_SECURE_CACHE_TEST_CHECK(result.nx_secure_cache_test_result_server_resumed);
+
+    /* Reconnect time, without and with the cache. */
+    for (i = 0; i < NX_SECURE_CACHE_TEST_TIMED_CONNECTIONS; i++)
+    {
+        _nx_secure_cache_test_connect(server_context, NX_NULL, NX_SECURE_CACHE_TEST_TAMPER_NONE, &result);
+        NX_SECURE_CACHE_TEST_CHECK(result.nx_secure_cache_test_result_status == NX_SUCCESS);
+        NX_SECURE_CACHE_TEST_CHECK(!result.nx_secure_cache_test_result_resumed);
+        full_milliseconds += result.nx_secure_cache_test_result_milliseconds;
+        full_bytes += result.nx_secure_cache_test_result_bytes_sent + result.nx_secure_cache_test_result_bytes_received;
+
+        _nx_secure_cache_test_connect(server_context, &_nx_secure_cache_test_cache, NX_SECURE_CACHE_TEST_TAMPER_NONE, &result);
+        NX_SECURE_CACHE_TEST_CHECK(result.nx_secure_cache_test_result_status == NX_SUCCESS);
+        NX_SECURE_CACHE_TEST_CHECK(result.nx_secure_cache_test_result_resumed);
+        resumed_milliseconds += result.nx_secure_cache_test_result_milliseconds;
+        resumed_bytes += result.nx_secure_cache_test_result_bytes_sent + result.nx_secure_cache_test_result_bytes_received;
+    }
+    printf("%-40s %.2f ms, %lu bytes\n", "average full handshake",
+           full_milliseconds / NX_SECURE_CACHE_TEST_TIMED_CONNECTIONS,
+           (unsigned long)(full_bytes / NX_SECURE_CACHE_TEST_TIMED_CONNECTIONS));
+    printf("%-40s %.2f ms, %lu bytes\n", "average resumed handshake",
+           resumed_milliseconds / NX_SECURE_CACHE_TEST_TIMED_CONNECTIONS,
+           (unsigned long)(resumed_bytes / NX_SECURE_CACHE_TEST_TIMED_CONNECTIONS));
+    NX_SECURE_CACHE_TEST_CHECK(resumed_milliseconds < full_milliseconds);
+
+    /* A session ID echoed with another ciphersuite or version fails, and the entry is dropped. */
+    updates = _nx_secure_cache_test_updates;
+    _nx_secure_cache_test_connect(server_context, &_nx_secure_cache_test_cache, NX_SECURE_CACHE_TEST_TAMPER_CIPHERSUITE, &result);
+    _nx_secure_cache_test_report("echo with another ciphersuite", &result);
+    NX_SECURE_CACHE_TEST_CHECK(result.nx_secure_cache_test_result_echoed);
+    NX_SECURE_CACHE_TEST_CHECK(result.nx_secure_cache_test_result_status == NX_SECURE_TLS_HANDSHAKE_FAILURE);
+    NX_SECURE_CACHE_TEST_CHECK(!result.nx_secure_cache_test_result_server_handshake);
+    NX_SECURE_CACHE_TEST_CHECK(_nx_secure_cache_test_entries_used(_nx_secure_cache_test_entries, 2) == 0);
+    NX_SECURE_CACHE_TEST_CHECK(_nx_secure_cache_test_updates > updates);
+
+    _nx_secure_cache_test_connect(server_context, &_nx_secure_cache_test_cache, NX_SECURE_CACHE_TEST_TAMPER_NONE, &result);
+    _nx_secure_cache_test_report("after a failed resumption", &result);
+    NX_SECURE_CACHE_TEST_CHECK(result.nx_secure_cache_test_result_status == NX_SUCCESS);
+    NX_SECURE_CACHE_TEST_CHECK(!result.nx_secure_cache_test_result_offered);
+    NX_SECURE_CACHE_TEST_CHECK(_nx_secure_cache_test_entries_used(_nx_secure_cache_test_entries, 2) == 1);
+
+    _nx_secure_cache_test_connect(server_context, &_nx_secure_cache_test_cache, NX_SECURE_CACHE_TEST_TAMPER_VERSION, &result);
+    _nx_secure_cache_test_report("echo with another version", &result);
+    NX_SECURE_CACHE_TEST_CHECK(result.nx_secure_cache_test_result_echoed);
+    NX_SECURE_CACHE_TEST_CHECK(result.nx_secure_cache_test_result_status == NX_SECURE_TLS_HANDSHAKE_FAILURE);
+    NX_SECURE_CACHE_TEST_CHECK(_nx_secure_cache_test_entries_used(_nx_secure_cache_test_entries, 2) == 0);
+
+    /* A ChangeCipherSpec right after the ServerHello of a full handshake is rejected. */
+    _nx_secure_cache_test_connect(server_context, NX_NULL, NX_SECURE_CACHE_TEST_TAMPER_EARLY_CCS, &result);
+    _nx_secure_cache_test_report("early ChangeCipherSpec", &result);
+    NX_SECURE_CACHE_TEST_CHECK(result.nx_secure_cache_test_result_status == NX_SECURE_TLS_UNEXPECTED_MESSAGE);
+
+    /* So is it when a session was offered but the server did not resume it. A server without a
+       cache does not, and the client falls back to a full handshake and stores the new session. */
+    _nx_secure_cache_test_connect(server_context, &_nx_secure_cache_test_cache, NX_SECURE_CACHE_TEST_TAMPER_NONE, &result);
+    NX_SECURE_CACHE_TEST_CHECK(result.nx_secure_cache_test_result_status == NX_SUCCESS);
+    _nx_secure_cache_test_connect(uncached_server_context, &_nx_secure_cache_test_cache, NX_SECURE_CACHE_TEST_TAMPER_NONE, &result);
+    _nx_secure_cache_test_report("server without a cache", &result);
+    NX_SECURE_CACHE_TEST_CHECK(result.nx_secure_cache_test_result_status == NX_SUCCESS);
+    NX_SECURE_CACHE_TEST_CHECK(result.nx_secure_cache_test_result_offered);
+    NX_SECURE_CACHE_TEST_CHECK(!result.nx_secure_cache_test_result_echoed);
+    NX_SECURE_CACHE_TEST_CHECK(!result.nx_secure_cache_test_result_resumed);
+
+    _nx_secure_cache_test_connect(uncached_server_context, &_nx_secure_cache_test_cache, NX_SECURE_CACHE_TEST_TAMPER_EARLY_CCS, &result);
+    _nx_secure_cache_test_report("early ChangeCipherSpec, not resumed", &result);
+    NX_SECURE_CACHE_TEST_CHECK(result.nx_secure_cache_test_result_offered);
+    NX_SECURE_CACHE_TEST_CHECK(!result.nx_secure_cache_test_result_echoed);
+    NX_SECURE_CACHE_TEST_CHECK(result.nx_secure_cache_test_result_status == NX_SECURE_TLS_UNEXPECTED_MESSAGE);
+    NX_SECURE_CACHE_TEST_CHECK(_nx_secure_cache_test_entries_used(_nx_secure_cache_test_entries, 2) == 0);
+
+    /* A resumed handshake without the server ChangeCipherSpec does not complete. */
+    _nx_secure_cache_test_connect(server_context, &_nx_secure_cache_test_cache, NX_SECURE_CACHE_TEST_TAMPER_NONE, &result);
+    NX_SECURE_CACHE_TEST_CHECK(result.nx_secure_cache_test_result_status == NX_SUCCESS);
+    _nx_secure_cache_test_connect(server_context, &_nx_secure_cache_test_cache, NX_SECURE_CACHE_TEST_TAMPER_DROP_CCS, &result);
+    _nx_secure_cache_test_report("resumed, ChangeCipherSpec dropped", &result);
+    NX_SECURE_CACHE_TEST_CHECK(result.nx_secure_cache_test_result_echoed);
+    NX_SECURE_CACHE_TEST_CHECK(result.nx_secure_cache_test_result_status != NX_SUCCESS);
+    NX_SECURE_CACHE_TEST_CHECK(!result.nx_secure_cache_test_result_server_handshake);
+
+    /* An entry with the wrong master secret fails on the server Finished, and is dropped. */
+    _nx_secure_cache_test_connect(server_context, &restored_cache, NX_SECURE_CACHE_TEST_TAMPER_NONE, &result);
+    NX_SECURE_CACHE_TEST_CHECK(result.nx_secure_cache_test_result_status == NX_SUCCESS);
+    restored_entries[0].nx_secure_tls_session_cache_master_secret[0] ^= 0x01;
+    _nx_secure_cache_test_connect(server_context, &restored_cache, NX_SECURE_CACHE_TEST_TAMPER_NONE, &result);
+    _nx_secure_cache_test_report("wrong master secret", &result);
+    NX_SECURE_CACHE_TEST_CHECK(result.nx_secure_cache_test_result_echoed);
+    NX_SECURE_CACHE_TEST_CHECK(result.nx_secure_cache_test_result_status != NX_SUCCESS);
+    NX_SECURE_CACHE_TEST_CHECK(!result.nx_secure_cache_test_result_server_handshake);
+    NX_SECURE_CACHE_TEST_CHECK(_nx_secure_cache_test_entries_used(restored_entries, 1) == 0);
+
+    _nx_secure_cache_test_connect(server_context, &restored_cache, NX_SECURE_CACHE_TEST_TAMPER_NONE, &result);
+    _nx_secure_cache_test_report("after a wrong master secret", &result);
+    NX_SECURE_CACHE_TEST_CHECK(result.nx_secure_cache_test_result_status == NX_SUCCESS);
+    NX_SECURE_CACHE_TEST_CHECK(!result.nx_secure_cache_test_result_offered);
+
+    /* An entry older than its lifetime is not offered. */
+    _nx_secure_cache_test_connect(server_context, &_nx_secure_cache_test_cache, NX_SECURE_CACHE_TEST_TAMPER_NONE, &result);
+    NX_SECURE_CACHE_TEST_CHECK(result.nx_secure_cache_test_result_status == NX_SUCCESS);
+    _nx_secure_cache_test_time_offset = NX_SECURE_TLS_SESSION_CACHE_LIFETIME + 1;
+    _nx_secure_cache_test_connect(server_context, &_nx_secure_cache_test_cache, NX_SECURE_CACHE_TEST_TAMPER_NONE, &result);
+    _nx_secure_cache_test_time_offset = 0;
+    _nx_secure_cache_test_report("expired entry", &result);
+    NX_SECURE_CACHE_TEST_CHECK(result.nx_secure_cache_test_result_status == NX_SUCCESS);
+    NX_SECURE_CACHE_TEST_CHECK(!result.nx_secure_cache_test_result_offered);
+    NX_SECURE_CACHE_TEST_CHECK(!result.nx_secure_cache_test_result_resumed);
+
+#if (NX_SECURE_TLS_TLS_1_3_ENABLED)
+    /* A TLS 1.3 server echoes the legacy session ID without resuming the TLS 1.2 session. */
+    _nx_secure_cache_test_connect(server_context, &_nx_secure_cache_test_cache, NX_SECURE_CACHE_TEST_TAMPER_NONE, &result);
+    NX_SECURE_CACHE_TEST_CHECK(result.nx_secure_cache_test_result_status == NX_SUCCESS);
+    _nx_secure_cache_test_connect(tls_1_3_server_context, &_nx_secure_cache_test_cache, NX_SECURE_CACHE_TEST_TAMPER_NONE, &result);
+    _nx_secure_cache_test_report("TLS 1.3 server", &result);
+    NX_SECURE_CACHE_TEST_CHECK(result.nx_secure_cache_test_result_status == NX_SUCCESS);
+    NX_SECURE_CACHE_TEST_CHECK(result.nx_secure_cache_test_result_tls_1_3);
+    NX_SECURE_CACHE_TEST_CHECK(result.nx_secure_cache_test_result_offered);
+    NX_SECURE_CACHE_TEST_CHECK(result.nx_secure_cache_test_result_echoed);
+    NX_SECURE_CACHE_TEST_CHECK(!result.nx_secure_cache_test_result_resumed);
+    NX_SECURE_CACHE_TEST_CHECK(result.nx_secure_cache_test_result_data_echoed);
+    SSL_CTX_free(tls_1_3_server_context);
+
+    /* A TLS 1.3 full handshake stores the server's ticket, and the next connection offers it
+       as a PSK and resumes. */
+    ticket_server_context = _nx_secure_cache_test_ticket_context_create();
+    if (nx_secure_tls_session_cache_create(&ticket_cache, ticket_entries, sizeof(ticket_entries),
+                                           _nx_secure_cache_test_update) != NX_SUCCESS)
+    {
+        return(1);
+    }
+    _nx_secure_cache_test_connect(ticket_server_context, &ticket_cache, NX_SECURE_CACHE_TEST_TAMPER_NONE, &full_result);
+    _nx_secure_cache_test_report("TLS 1.3 full handshake", &full_result);
+    NX_SECURE_CACHE_TEST_CHECK(full_result.nx_secure_cache_test_result_status == NX_SUCCESS);
+    NX_SECURE_CACHE_TEST_CHECK(full_result.nx_secure_cache_test_result_tls_1_3);
+    NX_SECURE_CACHE_TEST_CHECK(!full_result.nx_secure_cache_test_result_ticket_offered);
+    NX_SECURE_CACHE_TEST_CHECK(!full_result.nx_secure_cache_test_result_resumed);
+    NX_SECURE_CACHE_TEST_CHECK(full_result.nx_secure_cache_test_result_data_echoed);
+    NX_SECURE_CACHE_TEST_CHECK(_nx_secure_cache_test_entries_used(ticket_entries, 1) == 1);
+    NX_SECURE_CACHE_TEST_CHECK(ticket_entries[0].nx_secure_tls_session_cache_protocol_version == NX_SECURE_TLS_VERSION_TLS_1_3);
+    NX_SECURE_CACHE_TEST_CHECK(ticket_entries[0].nx_secure_tls_session_cache_ticket_length != 0);
+
+    _nx_secure_cache_test_connect(ticket_server_context, &ticket_cache, NX_SECURE_CACHE_TEST_TAMPER_NONE, &result);
+    _nx_secure_cache_test_report("ticket handshake", &result);
+    NX_SECURE_CACHE_TEST_CHECK(result.nx_secure_cache_test_result_status == NX_SUCCESS);
+    NX_SECURE_CACHE_TEST_CHECK(result.nx_secure_cache_test_result_tls_1_3);
+    NX_SECURE_CACHE_TEST_CHECK(result.nx_secure_cache_test_result_ticket_offered);
+    NX_SECURE_CACHE_TEST_CHECK(result.nx_secure_cache_test_result_resumed);
+    NX_SECURE_CACHE_TEST_CHECK(result.nx_secure_cache_test_result_server_resumed);
+    NX_SECURE_CACHE_TEST_CHECK(result.nx_secure_cache_test_result_data_echoed);
+    NX_SECURE_CACHE_TEST_CHECK(result.nx_secure_cache_test_result_bytes_received <
+                               full_result.nx_secure_cache_test_result_bytes_received);
+
+    /* The ticket entry given to the update callback, saved as bytes and read back as after a
+       reboot, resumes the session from a new cache. */
+    memcpy(saved_ticket_entry, &_nx_secure_cache_test_saved_entry, sizeof(saved_ticket_entry));
+    memcpy(&restored_ticket_entry, saved_ticket_entry, sizeof(restored_ticket_entry));
+    if (nx_secure_tls_session_cache_create(&restored_cache, restored_entries, sizeof(restored_entries),
+                                           NX_NULL) != NX_SUCCESS)
+    {
+        return(1);
+    }
+    NX_SECURE_CACHE_TEST_CHECK(restored_ticket_entry.nx_secure_tls_session_cache_ticket_length != 0);
+    NX_SECURE_CACHE_TEST_CHECK(nx_secure_tls_session_cache_entry_restore(&restored_cache, &restored_ticket_entry) == NX_SUCCESS);
+    NX_SECURE_CACHE_TEST_CHECK(memcmp(&restored_entries[0], &restored_ticket_entry, sizeof(restored_ticket_entry)) == 0);
+    _nx_secure_cache_test_connect(ticket_server_context, &restored_cache, NX_SECURE_CACHE_TEST_TAMPER_NONE, &result);
+    _nx_secure_cache_test_report("restored ticket", &result);
+    NX_SECURE_CACHE_TEST_CHECK(result.nx_secure_cache_test_result_status == NX_SUCCESS);
+    NX_SECURE_CACHE_TEST_CHECK(result.nx_secure_cache_test_result_ticket_offered);
+    NX_SECURE_CACHE_TEST_CHECK(result.nx_secure_cache_test_result_resumed);
+    NX_SECURE_CACHE_TEST_CHECK(result.nx_secure_cache_test_result_server_resumed);
+
+    /* Reconnect time with TLS 1.3, without and with the ticket. */
+    full_milliseconds = 0.0;
+    resumed_milliseconds = 0.0;
+    full_bytes = 0;
+    resumed_bytes = 0;
+    for (i = 0; i < NX_SECURE_CACHE_TEST_TIMED_CONNECTIONS; i++)
+    {
+        _nx_secure_cache_test_connect(ticket_server_context, NX_NULL, NX_SECURE_CACHE_TEST_TAMPER_NONE, &result);
+        NX_SECURE_CACHE_TEST_CHECK(result.nx_secure_cache_test_result_status == NX_SUCCESS);
+        NX_SECURE_CACHE_TEST_CHECK(!result.nx_secure_cache_test_result_resumed);
+        full_milliseconds += result.nx_secure_cache_test_result_milliseconds;
+        full_bytes += result.nx_secure_cache_test_result_bytes_sent + result.nx_secure_cache_test_result_bytes_received;
+
+        _nx_secure_cache_test_connect(ticket_server_context, &ticket_cache, NX_SECURE_CACHE_TEST_TAMPER_NONE, &result);
+        NX_SECURE_CACHE_TEST_CHECK(result.nx_secure_cache_test_result_status == NX_SUCCESS);
+        NX_SECURE_CACHE_TEST_CHECK(result.nx_secure_cache_test_result_resumed);
+        resumed_milliseconds += result.nx_secure_cache_test_result_milliseconds;
+        resumed_bytes += result.nx_secure_cache_test_result_bytes_sent + result.nx_secure_cache_test_result_bytes_received;
+    }
+    printf("%-40s %.2f ms, %lu bytes\n", "average TLS 1.3 full handshake",
+           full_milliseconds / NX_SECURE_CACHE_TEST_TIMED_CONNECTIONS,
+           (unsigned long)(full_bytes / NX_SECURE_CACHE_TEST_TIMED_CONNECTIONS));
+    printf("%-40s %.2f ms, %lu bytes\n", "average ticket handshake",
+           resumed_milliseconds / NX_SECURE_CACHE_TEST_TIMED_CONNECTIONS,
+           (unsigned long)(resumed_bytes / NX_SECURE_CACHE_TEST_TIMED_CONNECTIONS));
+    NX_SECURE_CACHE_TEST_CHECK(resumed_milliseconds < full_milliseconds);
+
+    /* A restarted server has a new ticket key and rejects the ticket. The client falls back to a
+       full handshake, replaces the entry with the new server's ticket, and resumes with that. */
+    restarted_server_context = _nx_secure_cache_test_ticket_context_create();
+    updates = _nx_secure_cache_test_updates;
+    memcpy(&restored_ticket_entry, &ticket_entries[0], sizeof(restored_ticket_entry));
+    _nx_secure_cache_test_connect(restarted_server_context, &ticket_cache, NX_SECURE_CACHE_TEST_TAMPER_NONE, &result);
+    _nx_secure_cache_test_report("rejected ticket", &result);
+    NX_SECURE_CACHE_TEST_CHECK(result.nx_secure_cache_test_result_status == NX_SUCCESS);
+    NX_SECURE_CACHE_TEST_CHECK(result.nx_secure_cache_test_result_ticket_offered);
+    NX_SECURE_CACHE_TEST_CHECK(!result.nx_secure_cache_test_result_resumed);
+    NX_SECURE_CACHE_TEST_CHECK(!result.nx_secure_cache_test_result_server_resumed);
+    NX_SECURE_CACHE_TEST_CHECK(result.nx_secure_cache_test_result_data_echoed);
+    NX_SECURE_CACHE_TEST_CHECK(_nx_secure_cache_test_updates > updates);
+    NX_SECURE_CACHE_TEST_CHECK(_nx_secure_cache_test_entries_used(ticket_entries, 1) == 1);
+    NX_SECURE_CACHE_TEST_CHECK((ticket_entries[0].nx_secure_tls_session_cache_ticket_length !=
+                                restored_ticket_entry.nx_secure_tls_session_cache_ticket_length) ||
+                               (memcmp(ticket_entries[0].nx_secure_tls_session_cache_ticket,
+                                       restored_ticket_entry.nx_secure_tls_session_cache_ticket,
+                                       restored_ticket_entry.nx_secure_tls_session_cache_ticket_length) != 0));
+
+    _nx_secure_cache_test_connect(restarted_server_context, &ticket_cache, NX_SECURE_CACHE_TEST_TAMPER_NONE, &result);
+    _nx_secure_cache_test_report("after a rejected ticket", &result);
+    NX_SECURE_CACHE_TEST_CHECK(result.nx_secure_cache_test_result_status == NX_SUCCESS);
+    NX_SECURE_CACHE_TEST_CHECK(result.nx_secure_cache_test_result_resumed);
+    NX_SECURE_CACHE_TEST_CHECK(result.nx_secure_cache_test_result_server_resumed);
+
+    SSL_CTX_free(ticket_server_context);
+    SSL_CTX_free(restarted_server_context);
+#endif
+
+    /* Every packet went back to the pool, on the failure paths too. */
+    NX_SECURE_CACHE_TEST_CHECK(_nx_secure_cache_test_pool.nx_packet_pool_available == packets_available);
+
+    SSL_CTX_free(server_context);
+    SSL_CTX_free(uncached_server_context);
+    X509_free(_nx_secure_cache_test_certificate);
+    EVP_PKEY_free(_nx_secure_cache_test_key);
+
+    printf("%s, %u failed checks\n", _nx_secure_cache_test_failures ? "FAILED" : "PASSED", _nx_secure_cache_test_failures);
+    return(_nx_secure_cache_test_failures ? 1 : 0);
+}